@@ -0,0 +1,198 @@
+#include "stm32h7xx.h"
+#include "boot_header.h"
+
+/*
+ * Bootloader: sector 0 of each bank, linked with STM32H743ZITX_BOOT.ld.
+ *
+ * It checks the application header (boot_header.h) and starts the
+ * application, touching only core and flash registers. There is no C
+ * runtime: no .data or .bss, nothing to copy or clear, and the stack is
+ * in DTCM. The core stays on HSI at 64 MHz, as after reset. The flash
+ * drops to one wait state and both caches are on for the CRC pass, which
+ * is most of the boot time and grows with the image. Everything is put
+ * back to reset state before the jump, apart from the FPU access, the
+ * wait states and the cycle counter, which the application keeps running.
+ *
+ * If the application here does not check out but the one in the other
+ * bank does, SWAP_BANK is flipped and the core reset into that bank's
+ * bootloader. Otherwise the core sleeps.
+ */
+#define BOOT_OTHER_BANK      (BOOT_APP_BASE + FLASH_BANK_SIZE)   /*!< The same image in the bank not running */
+#define BOOT_DWT_LAR_UNLOCK  0xC5ACCE55UL
+
+typedef void (*boot_vector)(void);
+
+extern uint32_t _estack;   /* Linker script */
+
+void Boot_Reset(void) __attribute__((noreturn));
+static void Boot_Fault(void);
+
+/* Only the core exceptions: no interrupt is ever enabled here */
+__attribute__((section(".isr_vector"), used))
+static const boot_vector boot_vectors[16] =
+{
+  (boot_vector)&_estack,
+  Boot_Reset,
+  Boot_Fault,   /* NMI */
+  Boot_Fault,   /* HardFault */
+  Boot_Fault,   /* MemManage */
+  Boot_Fault,   /* BusFault */
+  Boot_Fault,   /* UsageFault */
+};
+
+static void Boot_Fault(void)
+{
+  for (;;)
+  {
+  }
+}
+
+/* Feed words to the CRC unit; unrolled so the loop keeps up with it */
+static void boot_crc_feed(const uint32_t *word, uint32_t count)
+{
+  while (count >= 8U)
+  {
+    CRC->DR = word[0];
+    CRC->DR = word[1];
+    CRC->DR = word[2];
+    CRC->DR = word[3];
+    CRC->DR = word[4];
+    CRC->DR = word[5];
+    CRC->DR = word[6];
+    CRC->DR = word[7];
+    word += 8;
+    count -= 8U;
+  }
+  while (count > 0U)
+  {
+    CRC->DR = *word++;
+    count--;
+  }
+}
+
+/* Initial stack pointer inside AXI SRAM or DTCM (short of boot_info) */
+static uint32_t boot_stack_ok(uint32_t sp)
+{
+  if ((sp & 7U) != 0U)
+  {
+    return 0U;
+  }
+  return (((sp - 1U) - D1_AXISRAM_BASE < 0x80000U) ||
+          ((sp - 1U) - D1_DTCMRAM_BASE < BOOT_INFO_ADDRESS - D1_DTCMRAM_BASE)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Check the application image at @p base: header, vectors, CRC.
+  *         The image is linked at BOOT_APP_BASE wherever it is read from.
+  * @retval The header, or NULL if the image must not run.
+  */
+static const boot_app_header *boot_check(uint32_t base)
+{
+  const uint32_t *image = (const uint32_t *)base;
+  const boot_app_header *header = (const boot_app_header *)(base + BOOT_HEADER_OFFSET);
+  const uint32_t skip = (BOOT_HEADER_OFFSET + sizeof(boot_app_header)) / 4U;
+
+  if ((header->magic != BOOT_APP_MAGIC) ||
+      (header->version < BOOT_MIN_VERSION) || (header->version == 0xFFFFFFFFU) ||
+      (header->size < skip * 4U) || (header->size > BOOT_APP_MAX_SIZE) || ((header->size % 4U) != 0U))
+  {
+    return NULL;
+  }
+  if ((boot_stack_ok(image[0]) == 0U) || ((image[1] & 1U) == 0U) || (image[1] - BOOT_APP_BASE >= header->size))
+  {
+    return NULL;
+  }
+
+  CRC->CR = CRC_CR_RESET;
+  boot_crc_feed(image, BOOT_HEADER_OFFSET / 4U);
+  boot_crc_feed(image + skip, (header->size / 4U) - skip);
+  return (CRC->DR == header->crc) ? header : NULL;
+}
+
+/* Put the caches and the CRC unit back as they were after reset */
+static void boot_restore(void)
+{
+  SCB_DisableDCache();
+  SCB_DisableICache();
+  RCC->AHB4RSTR |= RCC_AHB4RSTR_CRCRST;
+  RCC->AHB4RSTR &= ~RCC_AHB4RSTR_CRCRST;
+  RCC->AHB4ENR &= ~RCC_AHB4ENR_CRCEN;
+}
+
+/* Flip SWAP_BANK and reset: the other bank's bootloader runs next */
+static void boot_swap(void) __attribute__((noreturn));
+static void boot_swap(void)
+{
+  FLASH->OPTKEYR = FLASH_OPT_KEY1;
+  FLASH->OPTKEYR = FLASH_OPT_KEY2;
+  FLASH->OPTSR_PRG ^= FLASH_OPTSR_SWAP_BANK_OPT;
+  FLASH->OPTCR |= FLASH_OPTCR_OPTSTART;
+  while ((FLASH->OPTSR_CUR & FLASH_OPTSR_OPT_BUSY) != 0U)
+  {
+  }
+  NVIC_SystemReset();
+}
+
+/* Load the application's stack pointer and branch to its reset handler */
+static void boot_jump(uint32_t sp, uint32_t pc) __attribute__((noreturn));
+static void boot_jump(uint32_t sp, uint32_t pc)
+{
+  __asm volatile ("msr msp, %0\n\t"
+                  "bx  %1"
+                  :
+                  : "r" (sp), "r" (pc)
+                  : "memory");
+  __builtin_unreachable();
+}
+
+void Boot_Reset(void)
+{
+  const boot_app_header *header;
+  const uint32_t *vectors = (const uint32_t *)BOOT_APP_BASE;
+
+  /* The build is hard-float: allow the compiler its FPU registers, as SystemInit() does */
+  SCB->CPACR |= (3UL << (10U * 2U)) | (3UL << (11U * 2U));
+  __DSB();
+  __ISB();
+
+  /* Count from here; a system reset does not clear the counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = BOOT_DWT_LAR_UNLOCK;
+  DWT->CYCCNT = 0U;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  /* Reset leaves the flash at seven wait states; one is enough for 64 MHz at VOS3 */
+  FLASH->ACR = (FLASH->ACR & ~FLASH_ACR_LATENCY) | FLASH_ACR_LATENCY_1WS;
+  while ((FLASH->ACR & FLASH_ACR_LATENCY) != FLASH_ACR_LATENCY_1WS)
+  {
+  }
+  SCB_EnableICache();
+  SCB_EnableDCache();
+  RCC->AHB4ENR |= RCC_AHB4ENR_CRCEN;
+  (void)RCC->AHB4ENR;
+
+  header = boot_check(BOOT_APP_BASE);
+  if (header == NULL)
+  {
+    if (boot_check(BOOT_OTHER_BANK) != NULL)
+    {
+      boot_restore();
+      boot_swap();
+    }
+    boot_restore();
+    for (;;)
+    {
+      __WFI();
+    }
+  }
+  boot_restore();
+
+  BOOT_INFO->version = header->version;
+  BOOT_INFO->magic = BOOT_INFO_MAGIC;
+  BOOT_INFO->cycles = DWT->CYCCNT;
+
+  SCB->VTOR = BOOT_APP_BASE;
+  __DSB();
+  __ISB();
+  boot_jump(vectors[0], vectors[1]);
+}
@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32h7xx_hal.h"
+#include "benchmark.h"
+#include "memory_sections.h"
+#include "nn.h"
+#include "nn_math.h"
+#include "perf.h"
+
+/* 16x16x16 -> 3x3 conv, 32 channels, same padding */
+#define BENCH_CONV_H      16
+#define BENCH_CONV_W      16
+#define BENCH_CONV_C      16
+#define BENCH_CONV_OC     32
+#define BENCH_CONV_K      3
+#define BENCH_CONV_OUT    (BENCH_CONV_H * BENCH_CONV_W * BENCH_CONV_OC)
+#define BENCH_CONV_MACS   (BENCH_CONV_OUT * BENCH_CONV_K * BENCH_CONV_K * BENCH_CONV_C)
+
+static int8_t bench_conv_in[BENCH_CONV_H * BENCH_CONV_W * BENCH_CONV_C] __attribute__((aligned(32)));
+static int8_t bench_conv_w[BENCH_CONV_OC * BENCH_CONV_K * BENCH_CONV_K * BENCH_CONV_C];
+static int8_t bench_conv_out[BENCH_CONV_OUT] __attribute__((aligned(32)));
+static int8_t bench_conv_ref[BENCH_CONV_OUT] __attribute__((aligned(32)));
+static int32_t bench_conv_acc[BENCH_CONV_OUT];
+static int32_t bench_conv_bias[BENCH_CONV_OC];
+static int32_t bench_conv_mult[BENCH_CONV_OC];
+static int32_t bench_conv_shift[BENCH_CONV_OC];
+static uint8_t bench_conv_tile[8192] MEM_DTCM_BSS __attribute__((aligned(32)));
+
+static const nn_conv_params bench_conv_params =
+{
+  .input_offset = 128, .output_offset = -128, .stride = { 1, 1 }, .padding = { 1, 1 },
+  .activation = { -128, 127 },
+};
+static const nn_dims bench_conv_in_dims = { 1, BENCH_CONV_H, BENCH_CONV_W, BENCH_CONV_C };
+static const nn_dims bench_conv_filter_dims = { BENCH_CONV_OC, BENCH_CONV_K, BENCH_CONV_K, BENCH_CONV_C };
+static const nn_dims bench_conv_out_dims = { 1, BENCH_CONV_H, BENCH_CONV_W, BENCH_CONV_OC };
+
+/**
+  * @brief  Unfused baseline: the MACs write int32 partial sums, then bias,
+  *         requantization and the clamp each make a pass over them.
+  */
+static void bench_conv_unfused(void)
+{
+  const nn_conv_params *p = &bench_conv_params;
+  int32_t oy, ox, oc, ky, i;
+
+  for (oy = 0; oy < BENCH_CONV_H; oy++)
+  {
+    for (ox = 0; ox < BENCH_CONV_W; ox++)
+    {
+      for (oc = 0; oc < BENCH_CONV_OC; oc++)
+      {
+        const int32_t kx_first = NN_MAX(0, p->padding.w - ox);
+        const int32_t kx_last = NN_MIN(BENCH_CONV_K, BENCH_CONV_W + p->padding.w - ox);
+        int32_t acc = 0;
+
+        for (ky = 0; ky < BENCH_CONV_K; ky++)
+        {
+          const int32_t iy = oy - p->padding.h + ky;
+
+          if ((iy < 0) || (iy >= BENCH_CONV_H))
+          {
+            continue;
+          }
+          acc = nn_dot_s8(&bench_conv_in[(iy * BENCH_CONV_W + ox - p->padding.w + kx_first) * BENCH_CONV_C],
+                          &bench_conv_w[((oc * BENCH_CONV_K + ky) * BENCH_CONV_K + kx_first) * BENCH_CONV_C],
+                          (kx_last - kx_first) * BENCH_CONV_C, p->input_offset, acc);
+        }
+        bench_conv_acc[(oy * BENCH_CONV_W + ox) * BENCH_CONV_OC + oc] = acc;
+      }
+    }
+  }
+
+  for (i = 0; i < BENCH_CONV_OUT; i++)
+  {
+    bench_conv_acc[i] += bench_conv_bias[i % BENCH_CONV_OC];
+  }
+  for (i = 0; i < BENCH_CONV_OUT; i++)
+  {
+    bench_conv_acc[i] = nn_requantize(bench_conv_acc[i], bench_conv_mult[i % BENCH_CONV_OC],
+                                      bench_conv_shift[i % BENCH_CONV_OC]) + p->output_offset;
+  }
+  for (i = 0; i < BENCH_CONV_OUT; i++)
+  {
+    bench_conv_ref[i] = (int8_t)NN_MIN(NN_MAX(bench_conv_acc[i], p->activation.min), p->activation.max);
+  }
+}
+
+static void bench_conv_print(const char *name, uint32_t cycles, uint32_t extra_bytes)
+{
+  const uint32_t macs_x100 = (cycles != 0U) ? (uint32_t)(((uint64_t)BENCH_CONV_MACS * 100U) / cycles) : 0U;
+
+  printf("  %-14s %8lu cyc %lu.%02lu MAC/cyc, %lu B intermediate\n", name, (unsigned long)cycles,
+         (unsigned long)(macs_x100 / 100U), (unsigned long)(macs_x100 % 100U), (unsigned long)extra_bytes);
+}
+
+/**
+  * @brief  Fused nn_conv2d_s8 (direct and DTCM-tiled) against an unfused
+  *         conv -> bias -> requantize -> clamp pipeline on the same data.
+  * @note   Input and output are in AXI SRAM; MACs are counted as if every
+  *         tap were in bounds.
+  */
+void Bench_Conv(void)
+{
+  const nn_per_channel_quant_params quant = { bench_conv_mult, bench_conv_shift };
+  const nn_context tile = { bench_conv_tile, sizeof(bench_conv_tile) };
+  uint32_t seed = 7U;
+  uint32_t start;
+  uint32_t i;
+
+  for (i = 0U; i < sizeof(bench_conv_in); i++)
+  {
+    seed = seed * 1664525U + 1013904223U;
+    bench_conv_in[i] = (int8_t)(seed >> 24);
+  }
+  for (i = 0U; i < sizeof(bench_conv_w); i++)
+  {
+    seed = seed * 1664525U + 1013904223U;
+    bench_conv_w[i] = (int8_t)(seed >> 24);
+  }
+  for (i = 0U; i < BENCH_CONV_OC; i++)
+  {
+    bench_conv_bias[i] = (int32_t)(i * 101U) - 1600;
+    bench_conv_mult[i] = 1431655765 - (int32_t)(i * 1000000U);
+    bench_conv_shift[i] = -9;
+  }
+
+  printf("conv: %lu MACs\n", (unsigned long)BENCH_CONV_MACS);
+
+  start = PERF_Cycles();
+  bench_conv_unfused();
+  bench_conv_print("unfused", PERF_Elapsed(start), BENCH_CONV_OUT * 24U);
+
+  start = PERF_Cycles();
+  (void)nn_conv2d_s8(NULL, &bench_conv_params, &quant, &bench_conv_in_dims, bench_conv_in,
+                     &bench_conv_filter_dims, bench_conv_w, bench_conv_bias, &bench_conv_out_dims, bench_conv_out);
+  bench_conv_print("fused", PERF_Elapsed(start), 0U);
+  if (memcmp(bench_conv_out, bench_conv_ref, sizeof(bench_conv_out)) != 0)
+  {
+    printf("  fused: MISMATCH against unfused\n");
+  }
+
+  memset(bench_conv_out, 0, sizeof(bench_conv_out));
+  start = PERF_Cycles();
+  (void)nn_conv2d_s8(&tile, &bench_conv_params, &quant, &bench_conv_in_dims, bench_conv_in,
+                     &bench_conv_filter_dims, bench_conv_w, bench_conv_bias, &bench_conv_out_dims, bench_conv_out);
+  bench_conv_print("fused, DTCM tile", PERF_Elapsed(start), 0U);
+  if (memcmp(bench_conv_out, bench_conv_ref, sizeof(bench_conv_out)) != 0)
+  {
+    printf("  tiled: MISMATCH against unfused\n");
+  }
+}
@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32h7xx_hal.h"
+#include "benchmark.h"
+#include "dma_memcpy.h"
+#include "memory_sections.h"
+#include "perf.h"
+
+#define BENCH_DMA_MEM_BYTES    16384U
+
+static uint8_t bench_axi_src[BENCH_DMA_MEM_BYTES] __attribute__((aligned(32)));
+static uint8_t bench_axi_dst[BENCH_DMA_MEM_BYTES] __attribute__((aligned(32)));
+static uint8_t bench_d2_src[BENCH_DMA_MEM_BYTES] MEM_D2_BSS __attribute__((aligned(32)));
+static uint8_t bench_d2_dst[BENCH_DMA_MEM_BYTES] MEM_D2_BSS __attribute__((aligned(32)));
+static uint8_t bench_dtcm_src[BENCH_DMA_MEM_BYTES] MEM_DTCM_BSS __attribute__((aligned(32)));
+static uint8_t bench_dtcm_dst[BENCH_DMA_MEM_BYTES] MEM_DTCM_BSS __attribute__((aligned(32)));
+
+typedef struct
+{
+  const char *Name;
+  uint8_t    *Src;
+  uint8_t    *Dst;
+} Bench_RegionTypeDef;
+
+static const Bench_RegionTypeDef bench_region[] =
+{
+  { "AXI->AXI",   bench_axi_src,  bench_axi_dst  },
+  { "D2->D2",     bench_d2_src,   bench_d2_dst   },
+  { "DTCM->DTCM", bench_dtcm_src, bench_dtcm_dst },
+  { "AXI->DTCM",  bench_axi_src,  bench_dtcm_dst },
+  { "D2->AXI",    bench_d2_src,   bench_axi_dst  },
+};
+
+static const uint32_t bench_size[] = { DMA_MEM_THRESHOLD, 4096U, 8192U, BENCH_DMA_MEM_BYTES };
+
+/**
+  * @brief  CPU memcpy against MDMA dma_memcpy per region and size.
+  * @note   MDMA figures include submit and completion interrupt overhead.
+  *         Expects dma_mem_init() to have run at boot.
+  */
+void Bench_DmaMem(void)
+{
+  DMA_MemFutureTypeDef future;
+  uint32_t region;
+  uint32_t size;
+  uint32_t start;
+  uint32_t cpu;
+  uint32_t mdma;
+
+  printf("dma_mem: MB/s cpu / mdma\n");
+  for (region = 0U; region < sizeof(bench_region) / sizeof(bench_region[0]); region++)
+  {
+    const Bench_RegionTypeDef *r = &bench_region[region];
+
+    memset(r->Src, 0x5A, BENCH_DMA_MEM_BYTES);
+
+    for (size = 0U; size < sizeof(bench_size) / sizeof(bench_size[0]); size++)
+    {
+      uint32_t bytes = bench_size[size];
+
+      start = PERF_Cycles();
+      memcpy(r->Dst, r->Src, bytes);
+      cpu = PERF_Elapsed(start);
+
+      start = PERF_Cycles();
+      if (dma_memcpy(r->Dst, r->Src, bytes, &future) != HAL_OK)
+      {
+        printf("  %s %lu: submit failed\n", r->Name, (unsigned long)bytes);
+        continue;
+      }
+      (void)dma_mem_wait(&future, 100U);
+      mdma = PERF_Elapsed(start);
+
+      printf("  %-10s %6lu B: %4lu / %4lu%s\n", r->Name, (unsigned long)bytes,
+             (unsigned long)Benchmark_MBps(bytes, cpu), (unsigned long)Benchmark_MBps(bytes, mdma),
+             (future.Status == HAL_OK) ? "" : " (error)");
+    }
+  }
+}
@@ -0,0 +1,186 @@
+#include <stdio.h>
+
+#include "stm32h7xx_hal.h"
+#include "benchmark.h"
+#include "dsp.h"
+#include "memory_sections.h"
+#include "perf.h"
+
+/* 64-tap FIRs, 4-stage biquads, decimate/interpolate by 4, over 256-sample blocks in DTCM */
+#define BENCH_DSP_BLOCK    256U
+#define BENCH_DSP_TAPS     64U
+#define BENCH_DSP_STAGES   4U
+#define BENCH_DSP_FACTOR   4U
+
+static dsp_q15 bench_dsp_in_q15[BENCH_DSP_BLOCK] MEM_DTCM_BSS __attribute__((aligned(4)));
+static dsp_q15 bench_dsp_out_q15[BENCH_DSP_BLOCK * BENCH_DSP_FACTOR] MEM_DTCM_BSS __attribute__((aligned(4)));
+static dsp_q31 bench_dsp_in_q31[BENCH_DSP_BLOCK] MEM_DTCM_BSS;
+static dsp_q31 bench_dsp_out_q31[BENCH_DSP_BLOCK * BENCH_DSP_FACTOR] MEM_DTCM_BSS;
+static float bench_dsp_in_f32[BENCH_DSP_BLOCK] MEM_DTCM_BSS;
+static float bench_dsp_out_f32[BENCH_DSP_BLOCK * BENCH_DSP_FACTOR] MEM_DTCM_BSS;
+
+static dsp_q15 bench_dsp_coeffs_q15[BENCH_DSP_TAPS] __attribute__((aligned(4)));
+static dsp_q15 bench_dsp_poly_q15[BENCH_DSP_TAPS] __attribute__((aligned(4)));
+static dsp_q15 bench_dsp_state_q15[2U * (BENCH_DSP_TAPS + 1U)] MEM_DTCM_BSS __attribute__((aligned(4)));
+static dsp_q31 bench_dsp_coeffs_q31[BENCH_DSP_TAPS];
+static dsp_q31 bench_dsp_poly_q31[BENCH_DSP_TAPS];
+static dsp_q31 bench_dsp_state_q31[2U * (BENCH_DSP_TAPS + 1U)] MEM_DTCM_BSS;
+static float bench_dsp_coeffs_f32[BENCH_DSP_TAPS];
+static float bench_dsp_poly_f32[BENCH_DSP_TAPS];
+static float bench_dsp_state_f32[2U * (BENCH_DSP_TAPS + 1U)] MEM_DTCM_BSS;
+
+/* Butterworth-like low-pass sections, a's negated, scaled by 2^-1 for the fixed-point post_shift */
+static const float bench_dsp_biquad_f32[5U * BENCH_DSP_STAGES] =
+{
+  0.0675f, 0.1350f, 0.0675f, 1.1430f, -0.4128f,
+  0.0675f, 0.1350f, 0.0675f, 1.1430f, -0.4128f,
+  0.0675f, 0.1350f, 0.0675f, 1.1430f, -0.4128f,
+  0.0675f, 0.1350f, 0.0675f, 1.1430f, -0.4128f,
+};
+static dsp_q15 bench_dsp_biquad_q15[6U * BENCH_DSP_STAGES] __attribute__((aligned(4)));
+static dsp_q31 bench_dsp_biquad_q31[5U * BENCH_DSP_STAGES];
+
+typedef union
+{
+  dsp_fir_inst_q15    fir_q15;
+  dsp_fir_inst_q31    fir_q31;
+  dsp_fir_inst_f32    fir_f32;
+  dsp_decim_inst_q15  decim_q15;
+  dsp_decim_inst_q31  decim_q31;
+  dsp_decim_inst_f32  decim_f32;
+  dsp_interp_inst_q15 interp_q15;
+  dsp_interp_inst_q31 interp_q31;
+  dsp_interp_inst_f32 interp_f32;
+  dsp_biquad_inst_q15 biquad_q15;
+  dsp_biquad_inst_q31 biquad_q31;
+  dsp_biquad_inst_f32 biquad_f32;
+} bench_dsp_inst;
+
+static void bench_dsp_report(const char *name, uint32_t cycles)
+{
+  const uint32_t per_sample_x10 = (cycles * 10U) / BENCH_DSP_BLOCK;
+  const uint32_t ksps = (uint32_t)(((uint64_t)BENCH_DSP_BLOCK * SystemCoreClock) / ((uint64_t)cycles * 1000U));
+
+  printf("  %-12s %8lu cycles %4lu.%lu cycles/sample %8lu ksps\n", name, (unsigned long)cycles,
+         (unsigned long)(per_sample_x10 / 10U), (unsigned long)(per_sample_x10 % 10U), (unsigned long)ksps);
+}
+
+static void bench_dsp_setup(void)
+{
+  uint32_t seed = 7U;
+  uint32_t i;
+
+  for (i = 0U; i < BENCH_DSP_BLOCK; i++)
+  {
+    seed = seed * 1664525U + 1013904223U;
+    bench_dsp_in_q15[i] = (dsp_q15)(seed >> 17);
+    bench_dsp_in_q31[i] = (dsp_q31)seed >> 1;
+    bench_dsp_in_f32[i] = (float)bench_dsp_in_q31[i] * (1.0f / 2147483648.0f);
+  }
+  for (i = 0U; i < BENCH_DSP_TAPS; i++)
+  {
+    /* Triangular window low-pass; shape does not matter for timing */
+    const float h = (float)((i < (BENCH_DSP_TAPS / 2U)) ? (i + 1U) : (BENCH_DSP_TAPS - i)) /
+                    (float)((BENCH_DSP_TAPS / 2U) * (BENCH_DSP_TAPS / 2U + 1U));
+
+    bench_dsp_coeffs_f32[i] = h;
+    bench_dsp_coeffs_q15[i] = (dsp_q15)(h * 32768.0f);
+    bench_dsp_coeffs_q31[i] = (dsp_q31)(h * 2147483648.0f);
+  }
+  for (i = 0U; i < BENCH_DSP_STAGES; i++)
+  {
+    const float *c = &bench_dsp_biquad_f32[5U * i];
+    uint32_t k;
+
+    bench_dsp_biquad_q15[6U * i] = (dsp_q15)(c[0] * 16384.0f);
+    bench_dsp_biquad_q15[6U * i + 1U] = 0;
+    for (k = 0U; k < 5U; k++)
+    {
+      bench_dsp_biquad_q31[5U * i + k] = (dsp_q31)(c[k] * 1073741824.0f);
+      if (k != 0U)
+      {
+        bench_dsp_biquad_q15[6U * i + 1U + k] = (dsp_q15)(c[k] * 16384.0f);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Cycles and throughput of each filter over one block, inputs and state in DTCM.
+  */
+void Bench_Dsp(void)
+{
+  bench_dsp_inst inst;
+  uint32_t start;
+
+  bench_dsp_setup();
+  printf("dsp: %u-sample blocks, %u taps, %u biquad stages, factor %u\n", (unsigned)BENCH_DSP_BLOCK,
+         (unsigned)BENCH_DSP_TAPS, (unsigned)BENCH_DSP_STAGES, (unsigned)BENCH_DSP_FACTOR);
+
+  (void)dsp_fir_init_q15(&inst.fir_q15, BENCH_DSP_TAPS, bench_dsp_coeffs_q15, bench_dsp_state_q15);
+  start = PERF_Cycles();
+  dsp_fir_q15(&inst.fir_q15, bench_dsp_in_q15, bench_dsp_out_q15, BENCH_DSP_BLOCK);
+  bench_dsp_report("fir q15", PERF_Elapsed(start));
+
+  (void)dsp_fir_init_q31(&inst.fir_q31, BENCH_DSP_TAPS, bench_dsp_coeffs_q31, bench_dsp_state_q31);
+  start = PERF_Cycles();
+  dsp_fir_q31(&inst.fir_q31, bench_dsp_in_q31, bench_dsp_out_q31, BENCH_DSP_BLOCK);
+  bench_dsp_report("fir q31", PERF_Elapsed(start));
+
+  (void)dsp_fir_init_f32(&inst.fir_f32, BENCH_DSP_TAPS, bench_dsp_coeffs_f32, bench_dsp_state_f32);
+  start = PERF_Cycles();
+  dsp_fir_f32(&inst.fir_f32, bench_dsp_in_f32, bench_dsp_out_f32, BENCH_DSP_BLOCK);
+  bench_dsp_report("fir f32", PERF_Elapsed(start));
+
+  (void)dsp_biquad_init_q15(&inst.biquad_q15, BENCH_DSP_STAGES, bench_dsp_biquad_q15, bench_dsp_state_q15, 1);
+  start = PERF_Cycles();
+  dsp_biquad_q15(&inst.biquad_q15, bench_dsp_in_q15, bench_dsp_out_q15, BENCH_DSP_BLOCK);
+  bench_dsp_report("biquad q15", PERF_Elapsed(start));
+
+  (void)dsp_biquad_init_q31(&inst.biquad_q31, BENCH_DSP_STAGES, bench_dsp_biquad_q31, bench_dsp_state_q31, 1);
+  start = PERF_Cycles();
+  dsp_biquad_q31(&inst.biquad_q31, bench_dsp_in_q31, bench_dsp_out_q31, BENCH_DSP_BLOCK);
+  bench_dsp_report("biquad q31", PERF_Elapsed(start));
+
+  (void)dsp_biquad_init_f32(&inst.biquad_f32, BENCH_DSP_STAGES, bench_dsp_biquad_f32, bench_dsp_state_f32);
+  start = PERF_Cycles();
+  dsp_biquad_f32(&inst.biquad_f32, bench_dsp_in_f32, bench_dsp_out_f32, BENCH_DSP_BLOCK);
+  bench_dsp_report("biquad f32", PERF_Elapsed(start));
+
+  /* Rates below are input samples per second */
+  (void)dsp_decim_init_q15(&inst.decim_q15, BENCH_DSP_FACTOR, BENCH_DSP_TAPS, bench_dsp_coeffs_q15,
+                           bench_dsp_state_q15);
+  start = PERF_Cycles();
+  (void)dsp_decim_q15(&inst.decim_q15, bench_dsp_in_q15, bench_dsp_out_q15, BENCH_DSP_BLOCK);
+  bench_dsp_report("decim q15", PERF_Elapsed(start));
+
+  (void)dsp_decim_init_q31(&inst.decim_q31, BENCH_DSP_FACTOR, BENCH_DSP_TAPS, bench_dsp_coeffs_q31,
+                           bench_dsp_state_q31);
+  start = PERF_Cycles();
+  (void)dsp_decim_q31(&inst.decim_q31, bench_dsp_in_q31, bench_dsp_out_q31, BENCH_DSP_BLOCK);
+  bench_dsp_report("decim q31", PERF_Elapsed(start));
+
+  (void)dsp_decim_init_f32(&inst.decim_f32, BENCH_DSP_FACTOR, BENCH_DSP_TAPS, bench_dsp_coeffs_f32,
+                           bench_dsp_state_f32);
+  start = PERF_Cycles();
+  (void)dsp_decim_f32(&inst.decim_f32, bench_dsp_in_f32, bench_dsp_out_f32, BENCH_DSP_BLOCK);
+  bench_dsp_report("decim f32", PERF_Elapsed(start));
+
+  (void)dsp_interp_init_q15(&inst.interp_q15, BENCH_DSP_FACTOR, BENCH_DSP_TAPS, bench_dsp_coeffs_q15,
+                            bench_dsp_poly_q15, bench_dsp_state_q15);
+  start = PERF_Cycles();
+  dsp_interp_q15(&inst.interp_q15, bench_dsp_in_q15, bench_dsp_out_q15, BENCH_DSP_BLOCK);
+  bench_dsp_report("interp q15", PERF_Elapsed(start));
+
+  (void)dsp_interp_init_q31(&inst.interp_q31, BENCH_DSP_FACTOR, BENCH_DSP_TAPS, bench_dsp_coeffs_q31,
+                            bench_dsp_poly_q31, bench_dsp_state_q31);
+  start = PERF_Cycles();
+  dsp_interp_q31(&inst.interp_q31, bench_dsp_in_q31, bench_dsp_out_q31, BENCH_DSP_BLOCK);
+  bench_dsp_report("interp q31", PERF_Elapsed(start));
+
+  (void)dsp_interp_init_f32(&inst.interp_f32, BENCH_DSP_FACTOR, BENCH_DSP_TAPS, bench_dsp_coeffs_f32,
+                            bench_dsp_poly_f32, bench_dsp_state_f32);
+  start = PERF_Cycles();
+  dsp_interp_f32(&inst.interp_f32, bench_dsp_in_f32, bench_dsp_out_f32, BENCH_DSP_BLOCK);
+  bench_dsp_report("interp f32", PERF_Elapsed(start));
+}
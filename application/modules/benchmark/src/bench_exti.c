@@ -0,0 +1,154 @@
+#include <stdio.h>
+
+#include "stm32h7xx_hal.h"
+#include "benchmark.h"
+#include "event_group.h"
+#include "exti_dispatch.h"
+#include "irq_config.h"
+#include "perf.h"
+
+/*
+ * EXTI dispatch on software lines (no pin), raised by EXTIDisp_Trigger():
+ * the cycles from the SWIER store to the callback, for one line of
+ * EXTI9_5 and for all five at once, served in one entry. The event group
+ * form is timed up to the waiter's return. The dispatcher's own stats
+ * give the entry to handler cost, without the exception entry.
+ */
+#define BENCH_EXTI_RUNS     256U
+#define BENCH_EXTI_FIRST    5U
+#define BENCH_EXTI_COUNT    5U
+#define BENCH_EXTI_GROUP    10U
+
+static volatile uint32_t bench_exti_start;
+static volatile uint32_t bench_exti_cycles;
+static volatile uint32_t bench_exti_calls;
+static EventGroup_TypeDef bench_exti_group;
+
+static void bench_exti_callback(uint32_t line, void *context)
+{
+  (void)line;
+  (void)context;
+  bench_exti_cycles = PERF_Elapsed(bench_exti_start);
+  bench_exti_calls++;
+}
+
+static void bench_exti_report(const char *name, uint32_t total, uint32_t max)
+{
+  printf("  %-22s %5lu cycles avg, %5lu max\n", name, (unsigned long)(total / BENCH_EXTI_RUNS),
+         (unsigned long)max);
+}
+
+/* Raises lines and waits for all their callbacks; returns the last one's latency */
+static uint32_t bench_exti_raise(uint32_t lines, uint32_t count)
+{
+  uint32_t line;
+
+  bench_exti_calls = 0U;
+  bench_exti_start = PERF_Cycles();
+  if (count == 1U)
+  {
+    EXTIDisp_Trigger(31U - __CLZ(lines));
+  }
+  else
+  {
+    EXTI->SWIER1 = lines;
+  }
+  for (line = 0U; (bench_exti_calls < count) && (line < 100000U); line++)
+  {
+  }
+  return bench_exti_cycles;
+}
+
+/**
+  * @brief  Trigger to callback latency through the exti_dispatch vectors.
+  */
+void Bench_Exti(void)
+{
+  EXTIDisp_LineConfigTypeDef config = {0};
+  EXTIDisp_StatsTypeDef      stats;
+  uint32_t lines = 0U;
+  uint32_t line;
+  uint32_t run;
+  uint32_t cycles;
+  uint32_t total;
+  uint32_t max;
+  uint32_t served;
+
+  printf("exti: software lines %u-%u on EXTI9_5, %u runs\n", (unsigned)BENCH_EXTI_FIRST,
+         (unsigned)(BENCH_EXTI_FIRST + BENCH_EXTI_COUNT - 1U), (unsigned)BENCH_EXTI_RUNS);
+
+  config.Trigger = EXTI_TRIGGER_RISING;
+  config.Priority = IRQ_PRIO_KERNEL_HIGH;
+  config.Callback = bench_exti_callback;
+  for (line = BENCH_EXTI_FIRST; line < (BENCH_EXTI_FIRST + BENCH_EXTI_COUNT); line++)
+  {
+    if (EXTIDisp_Register(line, &config) != HAL_OK)
+    {
+      printf("  line %lu: register failed\n", (unsigned long)line);
+      return;
+    }
+    lines |= 1UL << line;
+  }
+
+  EventGroup_Init(&bench_exti_group);
+  config.Callback = NULL;
+  config.Group = &bench_exti_group;
+  config.Bits = 0x1U;
+  if (EXTIDisp_Register(BENCH_EXTI_GROUP, &config) != HAL_OK)
+  {
+    printf("  line %u: register failed\n", (unsigned)BENCH_EXTI_GROUP);
+    return;
+  }
+
+  EXTIDisp_ResetStats();
+  total = 0U;
+  max = 0U;
+  for (run = 0U; run < BENCH_EXTI_RUNS; run++)
+  {
+    cycles = bench_exti_raise(1UL << BENCH_EXTI_FIRST, 1U);
+    total += cycles;
+    max = (cycles > max) ? cycles : max;
+  }
+  bench_exti_report("one line", total, max);
+
+  EXTIDisp_GetStats(&stats);
+  served = stats.Entries - stats.Spurious;
+  printf("  %-22s %5lu cycles avg, %5lu max, %lu entries, %lu spurious\n", "entry to handler",
+         (unsigned long)(stats.TotalCycles / ((served != 0U) ? served : 1U)),
+         (unsigned long)stats.MaxCycles, (unsigned long)stats.Entries, (unsigned long)stats.Spurious);
+
+  EXTIDisp_ResetStats();
+  total = 0U;
+  max = 0U;
+  for (run = 0U; run < BENCH_EXTI_RUNS; run++)
+  {
+    cycles = bench_exti_raise(lines, BENCH_EXTI_COUNT);
+    total += cycles;
+    max = (cycles > max) ? cycles : max;
+  }
+  bench_exti_report("five lines, to last", total, max);
+
+  EXTIDisp_GetStats(&stats);
+  printf("  %-22s %5lu dispatches in %lu entries\n", "batching",
+         (unsigned long)stats.Dispatches, (unsigned long)stats.Entries);
+
+  total = 0U;
+  max = 0U;
+  for (run = 0U; run < BENCH_EXTI_RUNS; run++)
+  {
+    const uint32_t start = PERF_Cycles();
+
+    EXTIDisp_Trigger(BENCH_EXTI_GROUP);
+    (void)EventGroup_Wait(&bench_exti_group, 0x1U, EVENT_GROUP_WAIT_ANY | EVENT_GROUP_WAIT_CLEAR, 10U);
+    cycles = PERF_Elapsed(start);
+    total += cycles;
+    max = (cycles > max) ? cycles : max;
+  }
+  bench_exti_report("event group to waiter", total, max);
+
+  for (line = BENCH_EXTI_FIRST; line < (BENCH_EXTI_FIRST + BENCH_EXTI_COUNT); line++)
+  {
+    EXTIDisp_Unregister(line);
+  }
+  EXTIDisp_Unregister(BENCH_EXTI_GROUP);
+}
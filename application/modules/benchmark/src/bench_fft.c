@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32h7xx_hal.h"
+#include "benchmark.h"
+#include "dsp.h"
+#include "dsp_fft_tables.h"
+#include "memory_sections.h"
+#include "perf.h"
+
+/* Complex and real transforms of 256..2048 points, data in DTCM */
+#define BENCH_FFT_MIN_N    256U
+#define BENCH_FFT_MAX_N    2048U
+
+static union
+{
+  float   f32[2U * BENCH_FFT_MAX_N];
+  dsp_q15 q15[2U * BENCH_FFT_MAX_N];
+} bench_fft_data MEM_DTCM_BSS __attribute__((aligned(8)));
+
+/* DTCM copy of whichever twiddle table is being timed */
+static union
+{
+  float   f32[2U * DSP_FFT_TWIDDLES];
+  dsp_q15 q15[2U * DSP_FFT_TWIDDLES];
+} bench_fft_twiddles MEM_DTCM_BSS __attribute__((aligned(8)));
+
+typedef union
+{
+  dsp_cfft_inst_f32 cfft_f32;
+  dsp_cfft_inst_q15 cfft_q15;
+  dsp_rfft_inst_f32 rfft_f32;
+  dsp_rfft_inst_q15 rfft_q15;
+} bench_fft_inst;
+
+typedef enum
+{
+  BENCH_FFT_CFFT_F32 = 0,
+  BENCH_FFT_CFFT_Q15,
+  BENCH_FFT_RFFT_F32,
+  BENCH_FFT_RFFT_Q15,
+  BENCH_FFT_KINDS
+} bench_fft_kind;
+
+static const char *const bench_fft_names[BENCH_FFT_KINDS] = {"cfft f32", "cfft q15", "rfft f32", "rfft q15"};
+
+static void bench_fft_fill(uint32_t n)
+{
+  uint32_t seed = 11U;
+  uint32_t i;
+
+  for (i = 0U; i < 2U * n; i++)
+  {
+    seed = seed * 1664525U + 1013904223U;
+    bench_fft_data.q15[i] = (dsp_q15)((int32_t)seed >> 20);   /* q15 view: small enough for any size */
+  }
+  for (i = 0U; i < 2U * n; i++)
+  {
+    seed = seed * 1664525U + 1013904223U;
+    bench_fft_data.f32[i] = (float)((int32_t)seed >> 8) * (1.0f / 8388608.0f);
+  }
+}
+
+/**
+  * @brief  Cycles of one forward transform; the first (cold) run fills the caches
+  *         for flash-resident code or tables and is discarded.
+  */
+static uint32_t bench_fft_time(bench_fft_kind kind, uint32_t n, const void *twiddles)
+{
+  bench_fft_inst inst;
+  uint32_t cycles = 0U;
+  uint32_t start;
+  uint32_t run;
+
+  for (run = 0U; run < 2U; run++)
+  {
+    switch (kind)
+    {
+      case BENCH_FFT_CFFT_F32:
+        (void)dsp_cfft_init_f32(&inst.cfft_f32, (uint16_t)n, (const float *)twiddles);
+        bench_fft_fill(n);
+        start = PERF_Cycles();
+        dsp_cfft_f32(&inst.cfft_f32, bench_fft_data.f32, 0U);
+        cycles = PERF_Elapsed(start);
+        break;
+      case BENCH_FFT_CFFT_Q15:
+        (void)dsp_cfft_init_q15(&inst.cfft_q15, (uint16_t)n, (const dsp_q15 *)twiddles);
+        bench_fft_fill(n);
+        start = PERF_Cycles();
+        dsp_cfft_q15(&inst.cfft_q15, bench_fft_data.q15, 0U);
+        cycles = PERF_Elapsed(start);
+        break;
+      case BENCH_FFT_RFFT_F32:
+        (void)dsp_rfft_init_f32(&inst.rfft_f32, (uint16_t)n, (const float *)twiddles);
+        bench_fft_fill(n);
+        start = PERF_Cycles();
+        dsp_rfft_f32(&inst.rfft_f32, bench_fft_data.f32, 0U);
+        cycles = PERF_Elapsed(start);
+        break;
+      default:
+        (void)dsp_rfft_init_q15(&inst.rfft_q15, (uint16_t)n, (const dsp_q15 *)twiddles);
+        bench_fft_fill(n);
+        start = PERF_Cycles();
+        dsp_rfft_q15(&inst.rfft_q15, bench_fft_data.q15, 0U);
+        cycles = PERF_Elapsed(start);
+        break;
+    }
+  }
+  return cycles;
+}
+
+/**
+  * @brief  Cycles per transform and size, with the twiddles read from the built-in
+  *         table and from a DTCM copy. Code placement is fixed by DSP_FFT_ITCM.
+  */
+void Bench_Fft(void)
+{
+  uint32_t kind;
+  uint32_t n;
+
+  printf("fft: code in %s, built-in tables in %s\n", DSP_FFT_ITCM ? "ITCM" : "flash",
+         DSP_FFT_TABLES_DTCM ? "DTCM" : "flash");
+  printf("  %-9s %5s %10s %10s %9s\n", "kind", "n", "built-in", "dtcm", "us(dtcm)");
+
+  for (kind = 0U; kind < (uint32_t)BENCH_FFT_KINDS; kind++)
+  {
+    const uint8_t is_q15 = (kind == (uint32_t)BENCH_FFT_CFFT_Q15) || (kind == (uint32_t)BENCH_FFT_RFFT_Q15);
+
+    if (is_q15)
+    {
+      memcpy(bench_fft_twiddles.q15, dsp_fft_twiddle_q15, sizeof(dsp_fft_twiddle_q15));
+    }
+    else
+    {
+      memcpy(bench_fft_twiddles.f32, dsp_fft_twiddle_f32, sizeof(dsp_fft_twiddle_f32));
+    }
+
+    for (n = BENCH_FFT_MIN_N; n <= BENCH_FFT_MAX_N; n *= 2U)
+    {
+      const uint32_t builtin = bench_fft_time((bench_fft_kind)kind, n, NULL);
+      const uint32_t dtcm = bench_fft_time((bench_fft_kind)kind, n, &bench_fft_twiddles);
+      const uint32_t us = (uint32_t)(((uint64_t)dtcm * 1000000U) / SystemCoreClock);
+
+      printf("  %-9s %5lu %10lu %10lu %9lu\n", bench_fft_names[kind], (unsigned long)n,
+             (unsigned long)builtin, (unsigned long)dtcm, (unsigned long)us);
+    }
+  }
+}
@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32h7xx_hal.h"
+#include "benchmark.h"
+#include "flash_service.h"
+#include "perf.h"
+
+/* Bank 2, sector 5: the last sector of the fw_update slot, so running this unseals a staged update */
+#define BENCH_FLASH_ADDRESS   0x081A0000U
+#define BENCH_FLASH_BYTES     (32U * 1024U)
+
+static uint8_t bench_flash_data[BENCH_FLASH_BYTES] __attribute__((aligned(32)));
+static volatile uint32_t bench_flash_done;
+static volatile HAL_StatusTypeDef bench_flash_status;
+
+/* Read from bank 1 while bank 2 is busy */
+static const uint32_t bench_flash_table[64] =
+{
+  0x9E3779B9U, 0x7F4A7C15U, 0xF39CC060U, 0x5CEDC834U, 0x2FE12A6DU, 0x3E4F1A4BU, 0x8D1C7E5AU, 0x11D3A4F7U,
+  0x6A09E667U, 0xBB67AE85U, 0x3C6EF372U, 0xA54FF53AU, 0x510E527FU, 0x9B05688CU, 0x1F83D9ABU, 0x5BE0CD19U,
+  0x428A2F98U, 0x71374491U, 0xB5C0FBCFU, 0xE9B5DBA5U, 0x3956C25BU, 0x59F111F1U, 0x923F82A4U, 0xAB1C5ED5U,
+  0xD807AA98U, 0x12835B01U, 0x243185BEU, 0x550C7DC3U, 0x72BE5D74U, 0x80DEB1FEU, 0x9BDC06A7U, 0xC19BF174U,
+  0xE49B69C1U, 0xEFBE4786U, 0x0FC19DC6U, 0x240CA1CCU, 0x2DE92C6FU, 0x4A7484AAU, 0x5CB0A9DCU, 0x76F988DAU,
+  0x983E5152U, 0xA831C66DU, 0xB00327C8U, 0xBF597FC7U, 0xC6E00BF3U, 0xD5A79147U, 0x06CA6351U, 0x14292967U,
+  0x27B70A85U, 0x2E1B2138U, 0x4D2C6DFCU, 0x53380D13U, 0x650A7354U, 0x766A0ABBU, 0x81C2C92EU, 0x92722C85U,
+  0xA2BFE8A1U, 0xA81A664BU, 0xC24B8B70U, 0xC76C51A3U, 0xD192E819U, 0xD6990624U, 0xF40E3585U, 0x106AA070U,
+};
+
+static void bench_flash_callback(HAL_StatusTypeDef status, uint32_t address, void *context)
+{
+  UNUSED(address);
+  UNUSED(context);
+  bench_flash_status = status;
+  bench_flash_done = 1U;
+}
+
+/* Counts loops of bank 1 reads until the queued job calls back */
+static uint32_t bench_flash_work(void)
+{
+  uint32_t loops = 0U;
+  uint32_t sum = 0U;
+
+  while (bench_flash_done == 0U)
+  {
+    sum += bench_flash_table[loops & 63U];
+    loops++;
+  }
+  __asm volatile ("" : : "r" (sum));
+  return loops;
+}
+
+static uint32_t bench_flash_ms(uint32_t cycles)
+{
+  return (uint32_t)(((uint64_t)cycles * 1000U) / SystemCoreClock);
+}
+
+static uint32_t bench_flash_blocking(uint32_t *erase_cycles, uint32_t *program_cycles)
+{
+  FLASH_EraseInitTypeDef erase = {0};
+  uint32_t sector_error;
+  uint32_t start;
+  uint32_t offset;
+  HAL_StatusTypeDef status;
+
+  erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+  erase.Banks = FLASH_BANK_2;
+  erase.Sector = (BENCH_FLASH_ADDRESS - FLASH_BANK2_BASE) / FLASH_SECTOR_SIZE;
+  erase.NbSectors = 1U;
+  erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+  HAL_FLASH_Unlock();
+  start = PERF_Cycles();
+  status = HAL_FLASHEx_Erase(&erase, &sector_error);
+  *erase_cycles = PERF_Elapsed(start);
+
+  start = PERF_Cycles();
+  for (offset = 0U; (offset < BENCH_FLASH_BYTES) && (status == HAL_OK); offset += FLASH_SVC_WORD)
+  {
+    status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_FLASHWORD, BENCH_FLASH_ADDRESS + offset,
+                               (uint32_t)&bench_flash_data[offset]);
+  }
+  *program_cycles = PERF_Elapsed(start);
+  HAL_FLASH_Lock();
+  SCB_InvalidateDCache_by_Addr((uint32_t *)BENCH_FLASH_ADDRESS, (int32_t)BENCH_FLASH_BYTES);
+
+  return (status == HAL_OK) ? 1U : 0U;
+}
+
+/**
+  * @brief  Flash service against the blocking HAL calls on one bank 2 sector:
+  *         erase time, program KB/s, and how much bank 1 work the core gets
+  *         done while the service keeps bank 2 busy.
+  */
+void Bench_Flash(void)
+{
+  FlashSvc_StatsTypeDef stats;
+  uint32_t erase_cycles;
+  uint32_t program_cycles;
+  uint32_t erase_loops;
+  uint32_t program_loops;
+  uint32_t submit;
+  uint32_t start;
+  uint32_t i;
+
+  for (i = 0U; i < BENCH_FLASH_BYTES; i++)
+  {
+    bench_flash_data[i] = (uint8_t)((i * 7U) ^ (i >> 8));
+  }
+
+  printf("flash: bank 2 sector 5, %lu KB program\n", (unsigned long)(BENCH_FLASH_BYTES / 1024U));
+
+  /* Service: erase, then program, counting bank 1 work done meanwhile */
+  FlashSvc_ResetStats();
+  bench_flash_done = 0U;
+  start = PERF_Cycles();
+  (void)FlashSvc_Erase(BENCH_FLASH_ADDRESS, 1U, bench_flash_callback, NULL);
+  submit = PERF_Elapsed(start);
+  erase_loops = bench_flash_work();
+
+  bench_flash_done = 0U;
+  (void)FlashSvc_Program(BENCH_FLASH_ADDRESS, bench_flash_data, BENCH_FLASH_BYTES, bench_flash_callback, NULL);
+  program_loops = bench_flash_work();
+
+  FlashSvc_GetStats(&stats);
+  printf("  service:  erase %lu ms, program %lu KB/s, submit %lu cycles, %lu+%lu work loops meanwhile, %s\n",
+         (unsigned long)bench_flash_ms((uint32_t)stats.EraseCycles),
+         (unsigned long)FlashSvc_KBps(stats.ProgramBytes, stats.ProgramCycles), (unsigned long)submit,
+         (unsigned long)erase_loops, (unsigned long)program_loops,
+         ((bench_flash_status == HAL_OK) && (memcmp((const void *)BENCH_FLASH_ADDRESS, bench_flash_data,
+                                                    BENCH_FLASH_BYTES) == 0)) ? "verified" : "MISMATCH");
+
+  /* Blocking HAL: the core waits out every operation */
+  if (bench_flash_blocking(&erase_cycles, &program_cycles) == 0U)
+  {
+    printf("  blocking: FAILED\n");
+    return;
+  }
+  printf("  blocking: erase %lu ms, program %lu KB/s, no work meanwhile, %s\n",
+         (unsigned long)bench_flash_ms(erase_cycles),
+         (unsigned long)FlashSvc_KBps(BENCH_FLASH_BYTES, program_cycles),
+         (memcmp((const void *)BENCH_FLASH_ADDRESS, bench_flash_data, BENCH_FLASH_BYTES) == 0) ? "verified"
+                                                                                             : "MISMATCH");
+}
@@ -0,0 +1,92 @@
+#include <stdio.h>
+
+#include "stm32h7xx_hal.h"
+#include "benchmark.h"
+#include "fmath.h"
+#include "memory_sections.h"
+#include "perf.h"
+
+/* Arrays of 256 arguments in DTCM, spread over each function's useful range */
+#define BENCH_FMATH_N    256U
+
+static float bench_fmath_in[BENCH_FMATH_N] MEM_DTCM_BSS;
+static float bench_fmath_out[BENCH_FMATH_N] MEM_DTCM_BSS;
+static double bench_fmath_in64[BENCH_FMATH_N] MEM_DTCM_BSS;
+static volatile double bench_fmath_sink;
+
+typedef void (*bench_fmath_vec)(const float *in, float *out, uint32_t n);
+
+static void bench_fmath_fill(float lo, float hi)
+{
+  uint32_t i;
+
+  for (i = 0U; i < BENCH_FMATH_N; i++)
+  {
+    bench_fmath_in[i] = lo + (hi - lo) * (float)i / (float)BENCH_FMATH_N;
+    bench_fmath_in64[i] = (double)bench_fmath_in[i];
+  }
+}
+
+static void bench_fmath_report(const char *name, uint32_t cycles)
+{
+  const uint32_t per_x10 = (cycles * 10U) / BENCH_FMATH_N;
+
+  printf("  %-10s %7lu cycles %4lu.%lu cycles/element\n", name, (unsigned long)cycles,
+         (unsigned long)(per_x10 / 10U), (unsigned long)(per_x10 % 10U));
+}
+
+static void bench_fmath_run(const char *name, bench_fmath_vec fn, float lo, float hi)
+{
+  uint32_t start;
+
+  bench_fmath_fill(lo, hi);
+  fn(bench_fmath_in, bench_fmath_out, BENCH_FMATH_N);   /* warm the caches */
+  start = PERF_Cycles();
+  fn(bench_fmath_in, bench_fmath_out, BENCH_FMATH_N);
+  bench_fmath_report(name, PERF_Elapsed(start));
+}
+
+/**
+  * @brief  Cycles per element of each array kernel, and of the double-precision
+  *         scalars run over an array.
+  */
+void Bench_Fmath(void)
+{
+  double acc = 0.0;
+  uint32_t start;
+  uint32_t i;
+
+  printf("fmath: %u elements per call\n", (unsigned)BENCH_FMATH_N);
+  bench_fmath_run("expf", fmath_expf_vec, -10.0f, 10.0f);
+  bench_fmath_run("logf", fmath_logf_vec, 0.001f, 1000.0f);
+  bench_fmath_run("sinf", fmath_sinf_vec, -10.0f, 10.0f);
+  bench_fmath_run("cosf", fmath_cosf_vec, -10.0f, 10.0f);
+  bench_fmath_run("tanhf", fmath_tanhf_vec, -5.0f, 5.0f);
+  bench_fmath_run("sigmoidf", fmath_sigmoidf_vec, -8.0f, 8.0f);
+  bench_fmath_run("sqrtf", fmath_sqrtf_vec, 0.0f, 1000.0f);
+
+  /* Doubles: sum the results so the loop cannot be dropped */
+  bench_fmath_fill(-10.0f, 10.0f);
+  start = PERF_Cycles();
+  for (i = 0U; i < BENCH_FMATH_N; i++)
+  {
+    acc += fmath_exp(bench_fmath_in64[i]);
+  }
+  bench_fmath_report("exp", PERF_Elapsed(start));
+
+  bench_fmath_fill(0.001f, 1000.0f);
+  start = PERF_Cycles();
+  for (i = 0U; i < BENCH_FMATH_N; i++)
+  {
+    acc += fmath_log(bench_fmath_in64[i]);
+  }
+  bench_fmath_report("log", PERF_Elapsed(start));
+
+  start = PERF_Cycles();
+  for (i = 0U; i < BENCH_FMATH_N; i++)
+  {
+    acc += fmath_sqrt(bench_fmath_in64[i]);
+  }
+  bench_fmath_report("sqrt", PERF_Elapsed(start));
+  bench_fmath_sink = acc;
+}
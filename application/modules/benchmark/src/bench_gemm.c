@@ -0,0 +1,161 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32h7xx_hal.h"
+#include "benchmark.h"
+#include "memory_sections.h"
+#include "nn_gemm.h"
+#include "nn_math.h"
+#include "nn_ref.h"
+#include "perf.h"
+
+/* Largest M * K, N * K and M * N of the sweep below */
+#define BENCH_GEMM_MAX_MK    16384
+#define BENCH_GEMM_MAX_NK    16384
+#define BENCH_GEMM_MAX_MN    4096
+#define BENCH_GEMM_MAX_N     128
+#define BENCH_GEMM_MAX_K     1024
+
+typedef struct
+{
+  int32_t m;
+  int32_t n;
+  int32_t k;
+} bench_gemm_shape;
+
+/* GEMV, growing M, shallow K, and odd shapes that exercise every edge kernel */
+static const bench_gemm_shape bench_gemm_shapes[] =
+{
+  {  1,  64, 256 },
+  {  4,  64, 256 },
+  { 16,  64, 256 },
+  { 64,  64, 256 },
+  { 64,  64,  64 },
+  { 64,  64,  16 },
+  { 16,  16, 1024 },
+  { 32, 128, 128 },
+  { 13,  31,  63 },
+  { 49,  10, 250 },
+};
+
+static int8_t bench_gemm_in[BENCH_GEMM_MAX_MK] __attribute__((aligned(32)));
+static int8_t bench_gemm_w[BENCH_GEMM_MAX_NK] __attribute__((aligned(32)));
+static uint32_t bench_gemm_packed[BENCH_GEMM_MAX_NK / 2] __attribute__((aligned(32)));
+static int8_t bench_gemm_out[BENCH_GEMM_MAX_MN] __attribute__((aligned(32)));
+static int8_t bench_gemm_ref[BENCH_GEMM_MAX_MN] __attribute__((aligned(32)));
+static int32_t bench_gemm_bias[BENCH_GEMM_MAX_N];
+static int32_t bench_gemm_mult[BENCH_GEMM_MAX_N];
+static int32_t bench_gemm_shift[BENCH_GEMM_MAX_N];
+static uint32_t bench_gemm_scratch[NN_GEMM_MR * BENCH_GEMM_MAX_K / 2] MEM_DTCM_BSS;
+
+static const nn_fc_params bench_gemm_params =
+{
+  .input_offset = 128, .filter_offset = 0, .output_offset = -128, .activation = { -128, 127 },
+};
+
+static void bench_gemm_fill(int8_t *data, uint32_t size, uint32_t *seed)
+{
+  uint32_t i;
+
+  for (i = 0U; i < size; i++)
+  {
+    *seed = *seed * 1664525U + 1013904223U;
+    data[i] = (int8_t)(*seed >> 24);
+  }
+}
+
+/**
+  * @brief  Unblocked baseline: one nn_dot_s8 per output, both operands
+  *         unpacked in the inner loop (what nn_fully_connected_s8 does per row).
+  */
+static void bench_gemm_dot(const bench_gemm_shape *shape)
+{
+  const nn_per_channel_quant_params quant = { bench_gemm_mult, bench_gemm_shift };
+  int32_t row, col;
+
+  for (row = 0; row < shape->m; row++)
+  {
+    for (col = 0; col < shape->n; col++)
+    {
+      const int32_t acc = nn_dot_s8(&bench_gemm_in[row * shape->k], &bench_gemm_w[col * shape->k], shape->k,
+                                    bench_gemm_params.input_offset, bench_gemm_bias[col]);
+
+      bench_gemm_out[row * shape->n + col] = nn_output_s8(acc, quant.multiplier[col], quant.shift[col],
+                                                          bench_gemm_params.output_offset,
+                                                          &bench_gemm_params.activation);
+    }
+  }
+}
+
+/* MACs per cycle with two decimals */
+static void bench_gemm_rate(const char *name, uint32_t macs, uint32_t cycles)
+{
+  const uint32_t x100 = (uint32_t)(((uint64_t)macs * 100U) / ((cycles != 0U) ? cycles : 1U));
+
+  printf(" %s %lu.%02lu", name, (unsigned long)(x100 / 100U), (unsigned long)(x100 % 100U));
+}
+
+/**
+  * @brief  Packed 4x2-blocked GEMM over an M/N/K sweep: MAC/cycle against the
+  *         unblocked dot-product loop, weight packing cost, and bit-exactness
+  *         against nn_ref_gemm_s8.
+  */
+void Bench_Gemm(void)
+{
+  const nn_context ctx = { bench_gemm_scratch, (int32_t)sizeof(bench_gemm_scratch) };
+  const nn_per_channel_quant_params quant = { bench_gemm_mult, bench_gemm_shift };
+  uint32_t seed = 5U;
+  uint32_t s;
+  int32_t i;
+
+  bench_gemm_fill(bench_gemm_in, sizeof(bench_gemm_in), &seed);
+  bench_gemm_fill(bench_gemm_w, sizeof(bench_gemm_w), &seed);
+  for (i = 0; i < BENCH_GEMM_MAX_N; i++)
+  {
+    bench_gemm_bias[i] = (i * 97) - 5000;
+    bench_gemm_mult[i] = 1518500250 + (i * 1000003);
+    bench_gemm_shift[i] = -9 - (i & 1);
+  }
+
+  printf("gemm: int8 %dx%d blocking, MAC/cycle (packed vs unblocked dot)\n", NN_GEMM_MR, NN_GEMM_NR);
+  for (s = 0U; s < sizeof(bench_gemm_shapes) / sizeof(bench_gemm_shapes[0]); s++)
+  {
+    const bench_gemm_shape *shape = &bench_gemm_shapes[s];
+    const uint32_t macs = (uint32_t)(shape->m * shape->n * shape->k);
+    uint32_t start;
+    uint32_t pack;
+    uint32_t gemm;
+    uint32_t dot;
+    nn_status status;
+
+    start = PERF_Cycles();
+    (void)nn_gemm_pack_weights_s8(bench_gemm_w, shape->n, shape->k, bench_gemm_packed);
+    pack = PERF_Elapsed(start);
+
+    (void)nn_gemm_s8(&ctx, &bench_gemm_params, &quant, shape->m, shape->n, shape->k, bench_gemm_in,
+                     bench_gemm_packed, bench_gemm_bias, bench_gemm_out);   /* warm the caches */
+    start = PERF_Cycles();
+    status = nn_gemm_s8(&ctx, &bench_gemm_params, &quant, shape->m, shape->n, shape->k, bench_gemm_in,
+                        bench_gemm_packed, bench_gemm_bias, bench_gemm_out);
+    gemm = PERF_Elapsed(start);
+
+    (void)nn_ref_gemm_s8(&bench_gemm_params, &quant, shape->m, shape->n, shape->k, bench_gemm_in, bench_gemm_w,
+                         bench_gemm_bias, bench_gemm_ref);
+
+    printf("  M %3ld N %3ld K %4ld: %7lu cycles", (long)shape->m, (long)shape->n, (long)shape->k,
+           (unsigned long)gemm);
+    bench_gemm_rate("gemm", macs, gemm);
+    if ((status != NN_OK) || (memcmp(bench_gemm_out, bench_gemm_ref, (size_t)(shape->m * shape->n)) != 0))
+    {
+      printf("  MISMATCH\n");
+      continue;
+    }
+
+    start = PERF_Cycles();
+    bench_gemm_dot(shape);
+    dot = PERF_Elapsed(start);
+    bench_gemm_rate("dot", macs, dot);
+    printf(" pack %lu cycles, %s\n", (unsigned long)pack,
+           (memcmp(bench_gemm_out, bench_gemm_ref, (size_t)(shape->m * shape->n)) == 0) ? "bit-exact" : "dot MISMATCH");
+  }
+}
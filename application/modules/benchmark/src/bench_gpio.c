@@ -0,0 +1,135 @@
+#include <stdio.h>
+
+#include "stm32h7xx_hal.h"
+#include "benchmark.h"
+#include "gpio_fast.h"
+#include "perf.h"
+
+/*
+ * Cycles per pin change on LD1 (PB0, an output since MX_GPIO_Init()), and
+ * on LD1 with LD3 (PB14) for two pins at once. Each loop pass makes 16
+ * changes, to amortise the loop.
+ *
+ * The sequences are also compiled on their own, as the bench_gpio_*_strobe
+ * functions, for their code size: arm-none-eabi-nm -S ML_LD.elf lists them,
+ * with HAL_GPIO_WritePin() beside.
+ */
+#define BENCH_GPIO_PASSES   64U
+#define BENCH_GPIO_CHANGES  (BENCH_GPIO_PASSES * 16U)
+
+#define BENCH_GPIO_LD1      GPIO_FAST_PIN(GPIOB, GPIO_PIN_0)
+#define BENCH_GPIO_BOTH     GPIO_FAST_PIN(GPIOB, GPIO_PIN_0 | GPIO_PIN_14)
+
+#define BENCH_GPIO_X8(op)   op; op; op; op; op; op; op; op
+
+static void bench_gpio_report(const char *name, uint32_t cycles)
+{
+  const uint32_t per_x10 = (cycles * 10U) / BENCH_GPIO_CHANGES;
+
+  printf("  %-22s %4lu.%lu cycles/change\n", name, (unsigned long)(per_x10 / 10U),
+         (unsigned long)(per_x10 % 10U));
+}
+
+static __attribute__((noinline)) void bench_gpio_hal_strobe(void)
+{
+  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_0, GPIO_PIN_SET);
+  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_0, GPIO_PIN_RESET);
+}
+
+static __attribute__((noinline)) void bench_gpio_fast_strobe(void)
+{
+  GPIOFast_Set(BENCH_GPIO_LD1);
+  GPIOFast_Reset(BENCH_GPIO_LD1);
+}
+
+static __attribute__((noinline)) void bench_gpio_hal_toggle_strobe(void)
+{
+  HAL_GPIO_TogglePin(GPIOB, GPIO_PIN_0);
+}
+
+static __attribute__((noinline)) void bench_gpio_fast_toggle_strobe(void)
+{
+  GPIOFast_Toggle(BENCH_GPIO_LD1);
+}
+
+/**
+  * @brief  HAL_GPIO_WritePin()/TogglePin() against the gpio_fast accesses.
+  */
+void Bench_Gpio(void)
+{
+  uint32_t start;
+  uint32_t pass;
+  uint32_t level = 0U;
+
+  printf("gpio: %u changes of PB0\n", (unsigned)BENCH_GPIO_CHANGES);
+
+  start = PERF_Cycles();
+  for (pass = 0U; pass < BENCH_GPIO_PASSES; pass++)
+  {
+    BENCH_GPIO_X8(HAL_GPIO_WritePin(GPIOB, GPIO_PIN_0, GPIO_PIN_SET);
+                  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_0, GPIO_PIN_RESET));
+  }
+  bench_gpio_report("HAL_GPIO_WritePin", PERF_Elapsed(start));
+
+  start = PERF_Cycles();
+  for (pass = 0U; pass < BENCH_GPIO_PASSES; pass++)
+  {
+    BENCH_GPIO_X8(GPIOFast_Set(BENCH_GPIO_LD1); GPIOFast_Reset(BENCH_GPIO_LD1));
+  }
+  bench_gpio_report("GPIOFast_Set/Reset", PERF_Elapsed(start));
+
+  /* Level from a register, as a bit-banged bus has it */
+  start = PERF_Cycles();
+  for (pass = 0U; pass < BENCH_GPIO_PASSES; pass++)
+  {
+    BENCH_GPIO_X8(GPIOFast_Write(BENCH_GPIO_LD1, level); level ^= 1U; GPIOFast_Write(BENCH_GPIO_LD1, level);
+                  level ^= 1U);
+  }
+  bench_gpio_report("GPIOFast_Write", PERF_Elapsed(start));
+
+  start = PERF_Cycles();
+  for (pass = 0U; pass < BENCH_GPIO_PASSES; pass++)
+  {
+    BENCH_GPIO_X8(HAL_GPIO_TogglePin(GPIOB, GPIO_PIN_0); HAL_GPIO_TogglePin(GPIOB, GPIO_PIN_0));
+  }
+  bench_gpio_report("HAL_GPIO_TogglePin", PERF_Elapsed(start));
+
+  start = PERF_Cycles();
+  for (pass = 0U; pass < BENCH_GPIO_PASSES; pass++)
+  {
+    BENCH_GPIO_X8(GPIOFast_Toggle(BENCH_GPIO_LD1); GPIOFast_Toggle(BENCH_GPIO_LD1));
+  }
+  bench_gpio_report("GPIOFast_Toggle", PERF_Elapsed(start));
+
+  start = PERF_Cycles();
+  for (pass = 0U; pass < BENCH_GPIO_PASSES; pass++)
+  {
+    BENCH_GPIO_X8(GPIOFast_Pulse(BENCH_GPIO_LD1); GPIOFast_Pulse(BENCH_GPIO_LD1));
+  }
+  bench_gpio_report("GPIOFast_Pulse (x2)", PERF_Elapsed(start) / 2U);
+
+  /* Two pins to opposite levels: two HAL calls, one store */
+  start = PERF_Cycles();
+  for (pass = 0U; pass < BENCH_GPIO_PASSES; pass++)
+  {
+    BENCH_GPIO_X8(HAL_GPIO_WritePin(GPIOB, GPIO_PIN_0, GPIO_PIN_SET);
+                  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_14, GPIO_PIN_RESET);
+                  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_0, GPIO_PIN_RESET);
+                  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_14, GPIO_PIN_SET));
+  }
+  bench_gpio_report("HAL, PB0+PB14", PERF_Elapsed(start));
+
+  start = PERF_Cycles();
+  for (pass = 0U; pass < BENCH_GPIO_PASSES; pass++)
+  {
+    BENCH_GPIO_X8(GPIOFast_WritePort(GPIOB, BENCH_GPIO_BOTH.Mask, GPIO_PIN_0);
+                  GPIOFast_WritePort(GPIOB, BENCH_GPIO_BOTH.Mask, GPIO_PIN_14));
+  }
+  bench_gpio_report("GPIOFast_WritePort", PERF_Elapsed(start));
+
+  GPIOFast_Reset(BENCH_GPIO_BOTH);
+  bench_gpio_hal_strobe();
+  bench_gpio_fast_strobe();
+  bench_gpio_hal_toggle_strobe();
+  bench_gpio_fast_toggle_strobe();
+}
@@ -0,0 +1,208 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32h7xx_hal.h"
+#include "benchmark.h"
+#include "memory_sections.h"
+#include "nn.h"
+#include "nn_arena.h"
+#include "nn_model.h"
+#include "nn_pipeline.h"
+#include "nn_ref.h"
+#include "perf.h"
+
+/*
+ * Synthetic network with random weights, sized like a small keyword-spotting
+ * model: 16x16x8 -> conv 3x3x16 -> depthwise 3x3 -> avg pool 2x2 -> add
+ * (residual) -> max pool 2x2 -> fully connected 10 -> softmax.
+ */
+#define BENCH_NN_IN_C     8
+#define BENCH_NN_CONV_C   16
+#define BENCH_NN_CLASSES  10
+
+static int8_t bench_nn_conv_w[BENCH_NN_CONV_C * 3 * 3 * BENCH_NN_IN_C];
+static int8_t bench_nn_dw_w[3 * 3 * BENCH_NN_CONV_C];
+static int8_t bench_nn_fc_w[BENCH_NN_CLASSES * 4 * 4 * BENCH_NN_CONV_C];
+static int32_t bench_nn_bias[BENCH_NN_CONV_C];
+static int32_t bench_nn_mult[BENCH_NN_CONV_C];
+static int32_t bench_nn_shift[BENCH_NN_CONV_C];
+
+/* Input in AXI SRAM, so the conv streams it through the DTCM scratch in row bands */
+static int8_t bench_nn_t0[16 * 16 * BENCH_NN_IN_C];
+static uint8_t bench_nn_scratch[8 * 16 * BENCH_NN_IN_C] MEM_DTCM_BSS __attribute__((aligned(4)));
+static uint8_t bench_nn_dtcm_arena[8192] MEM_DTCM_BSS __attribute__((aligned(8)));
+static uint8_t bench_nn_axi_arena[16384] __attribute__((aligned(8)));
+static int8_t bench_nn_check[16 * 16 * BENCH_NN_CONV_C] MEM_DTCM_BSS;
+static uint8_t bench_nn_weights[2][sizeof(bench_nn_fc_w)] MEM_DTCM_BSS __attribute__((aligned(8)));
+
+static const nn_conv_layer bench_nn_conv =
+{
+  .conv        = { .input_offset = 0, .output_offset = -128, .stride = { 1, 1 }, .padding = { 1, 1 },
+                   .activation = { -128, 127 } },
+  .quant       = { bench_nn_mult, bench_nn_shift },
+  .filter_dims = { BENCH_NN_CONV_C, 3, 3, BENCH_NN_IN_C },
+  .filter      = bench_nn_conv_w,
+  .bias        = bench_nn_bias,
+};
+
+static const nn_dw_conv_layer bench_nn_dw =
+{
+  .conv        = { .ch_mult = 1, .input_offset = 128, .output_offset = -128, .stride = { 1, 1 },
+                   .padding = { 1, 1 }, .activation = { -128, 127 } },
+  .quant       = { bench_nn_mult, bench_nn_shift },
+  .filter_dims = { 1, 3, 3, BENCH_NN_CONV_C },
+  .filter      = bench_nn_dw_w,
+  .bias        = bench_nn_bias,
+};
+
+static const nn_pool_layer bench_nn_pool =
+{
+  .pool        = { .stride = { 2, 2 }, .padding = { 0, 0 }, .activation = { -128, 127 } },
+  .filter_dims = { 1, 2, 2, 1 },
+};
+
+static const nn_add_params bench_nn_add =
+{
+  .input_1_offset = 128, .input_1_multiplier = 1073741824, .input_1_shift = 0,
+  .input_2_offset = 128, .input_2_multiplier = 1073741824, .input_2_shift = 0,
+  .left_shift = 20, .output_offset = -128, .output_multiplier = 1073741824, .output_shift = -19,
+  .activation = { -128, 127 },
+};
+
+static const nn_fc_layer bench_nn_fc =
+{
+  .fc          = { .input_offset = 128, .filter_offset = 0, .output_offset = 0, .activation = { -128, 127 } },
+  .quant       = { 1288490189, -10 },
+  .filter_dims = { 4 * 4 * BENCH_NN_CONV_C, 1, 1, 1 },
+  .filter      = bench_nn_fc_w,
+  .bias        = NULL,
+};
+
+static const nn_softmax_params bench_nn_softmax = { 1073741824, 23, -248 };
+
+static nn_tensor bench_nn_tensors[] =
+{
+  { { 1, 16, 16, BENCH_NN_IN_C },   bench_nn_t0 },
+  { { 1, 16, 16, BENCH_NN_CONV_C }, NULL },
+  { { 1, 16, 16, BENCH_NN_CONV_C }, NULL },
+  { { 1, 8, 8, BENCH_NN_CONV_C },   NULL },
+  { { 1, 8, 8, BENCH_NN_CONV_C },   NULL },
+  { { 1, 4, 4, BENCH_NN_CONV_C },   NULL },
+  { { 1, 1, 1, BENCH_NN_CLASSES },  NULL },
+  { { 1, 1, 1, BENCH_NN_CLASSES },  NULL },
+};
+
+static const nn_layer bench_nn_layers[] =
+{
+  { NN_OP_CONV2D,           0, 0, 1, &bench_nn_conv    },
+  { NN_OP_DEPTHWISE_CONV2D, 1, 0, 2, &bench_nn_dw      },
+  { NN_OP_AVG_POOL,         2, 0, 3, &bench_nn_pool    },
+  { NN_OP_ADD,              3, 3, 4, &bench_nn_add     },
+  { NN_OP_MAX_POOL,         4, 0, 5, &bench_nn_pool    },
+  { NN_OP_FULLY_CONNECTED,  5, 0, 6, &bench_nn_fc      },
+  { NN_OP_SOFTMAX,          6, 0, 7, &bench_nn_softmax },
+};
+
+static nn_arena_region bench_nn_regions[] =
+{
+  { "DTCM", bench_nn_dtcm_arena, sizeof(bench_nn_dtcm_arena), 0U },
+  { "AXI",  bench_nn_axi_arena,  sizeof(bench_nn_axi_arena),  0U },
+};
+
+static uint32_t bench_nn_cycles[sizeof(bench_nn_layers) / sizeof(bench_nn_layers[0])];
+
+static uint32_t bench_nn_stall[sizeof(bench_nn_layers) / sizeof(bench_nn_layers[0])];
+static uint32_t bench_nn_staged[sizeof(bench_nn_layers) / sizeof(bench_nn_layers[0])];
+
+static nn_pipeline bench_nn_pipe =
+{
+  .buffer      = { bench_nn_weights[0], bench_nn_weights[1] },
+  .buffer_size = sizeof(bench_nn_weights[0]),
+  .stall       = bench_nn_stall,
+  .staged      = bench_nn_staged,
+};
+
+static nn_model bench_nn_model =
+{
+  .tensors      = bench_nn_tensors,
+  .tensor_count = sizeof(bench_nn_tensors) / sizeof(bench_nn_tensors[0]),
+  .layers       = bench_nn_layers,
+  .layer_count  = sizeof(bench_nn_layers) / sizeof(bench_nn_layers[0]),
+  .cycles       = bench_nn_cycles,
+  .scratch      = { bench_nn_scratch, sizeof(bench_nn_scratch) },
+};
+
+static void bench_nn_fill(int8_t *data, uint32_t size, uint32_t *seed)
+{
+  uint32_t i;
+
+  for (i = 0U; i < size; i++)
+  {
+    *seed = *seed * 1664525U + 1013904223U;
+    data[i] = (int8_t)(*seed >> 24);
+  }
+}
+
+/**
+  * @brief  Arena plan and per-layer cycles of the synthetic model, plus the optimized conv
+  *         against nn_ref on the same data (cycles and bit-exactness), then the same model
+  *         with weights prefetched into DTCM by the MDMA.
+  */
+void Bench_Nn(void)
+{
+  uint32_t seed = 1U;
+  uint32_t i;
+  uint32_t start;
+  uint32_t opt;
+  uint32_t ref;
+  int8_t probs[BENCH_NN_CLASSES];
+  nn_status status;
+
+  bench_nn_fill(bench_nn_conv_w, sizeof(bench_nn_conv_w), &seed);
+  bench_nn_fill(bench_nn_dw_w, sizeof(bench_nn_dw_w), &seed);
+  bench_nn_fill(bench_nn_fc_w, sizeof(bench_nn_fc_w), &seed);
+  bench_nn_fill(bench_nn_t0, sizeof(bench_nn_t0), &seed);
+  for (i = 0U; i < BENCH_NN_CONV_C; i++)
+  {
+    bench_nn_bias[i] = (int32_t)(i * 37U) - 300;
+    bench_nn_mult[i] = 1518500250;   /* 1/sqrt(2) in Q31 */
+    bench_nn_shift[i] = -8;
+  }
+
+  status = nn_arena_plan(&bench_nn_model, bench_nn_regions, sizeof(bench_nn_regions) / sizeof(bench_nn_regions[0]));
+  if ((status != NN_OK) || (nn_arena_check(&bench_nn_model) != NN_OK))
+  {
+    printf("nn: arena plan failed (%d)\n", (int)status);
+    return;
+  }
+  nn_arena_print(&bench_nn_model, bench_nn_regions, sizeof(bench_nn_regions) / sizeof(bench_nn_regions[0]));
+
+  status = nn_model_invoke(&bench_nn_model);
+  if (status != NN_OK)
+  {
+    printf("nn: invoke failed (%d)\n", (int)status);
+    return;
+  }
+  nn_model_print_profile(&bench_nn_model);
+
+  start = PERF_Cycles();
+  (void)nn_ref_conv2d_s8(&bench_nn_conv.conv, &bench_nn_conv.quant, &bench_nn_tensors[0].dims, bench_nn_t0,
+                         &bench_nn_conv.filter_dims, bench_nn_conv_w, bench_nn_bias,
+                         &bench_nn_tensors[1].dims, bench_nn_check);
+  ref = PERF_Elapsed(start);
+  opt = bench_nn_cycles[0];
+
+  printf("nn: conv2d %lu cycles vs reference %lu, %s\n", (unsigned long)opt, (unsigned long)ref,
+         (memcmp(bench_nn_check, bench_nn_tensors[1].data, sizeof(bench_nn_check)) == 0) ? "bit-exact" : "MISMATCH");
+
+  memcpy(probs, bench_nn_tensors[7].data, sizeof(probs));
+  status = nn_pipeline_invoke(&bench_nn_model, &bench_nn_pipe);
+  if (status != NN_OK)
+  {
+    printf("nn: pipelined invoke failed (%d)\n", (int)status);
+    return;
+  }
+  nn_pipeline_print_profile(&bench_nn_model, &bench_nn_pipe);
+  printf("nn: pipelined output %s\n",
+         (memcmp(probs, bench_nn_tensors[7].data, sizeof(probs)) == 0) ? "bit-exact" : "MISMATCH");
+}
@@ -0,0 +1,41 @@
+#include <stdio.h>
+
+#include "stm32h7xx_hal.h"
+#include "benchmark.h"
+#include "perf.h"
+
+/**
+  * @brief  Runs every benchmark in turn. Results go to stdout (ITM).
+  */
+void Benchmark_Run(void)
+{
+  PERF_Init();
+
+  printf("benchmark: core %lu Hz, D-cache %s\n", (unsigned long)SystemCoreClock,
+         ((SCB->CCR & SCB_CCR_DC_Msk) != 0U) ? "on" : "off");
+
+  Bench_Memory();
+  Bench_DmaMem();
+  Bench_Nn();
+  Bench_Conv();
+  Bench_Gemm();
+  Bench_Dsp();
+  Bench_Fft();
+  Bench_Fmath();
+  Bench_Flash();
+  Bench_Gpio();
+  Bench_Exti();
+}
+
+/**
+  * @brief  Throughput in MB/s (10^6 bytes per second) at the current core clock.
+  */
+uint32_t Benchmark_MBps(uint32_t bytes, uint32_t cycles)
+{
+  if (cycles == 0U)
+  {
+    return 0U;
+  }
+
+  return (uint32_t)(((uint64_t)bytes * SystemCoreClock) / ((uint64_t)cycles * 1000000U));
+}
@@ -0,0 +1,21 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdint.h>
+
+void     Benchmark_Run(void);
+uint32_t Benchmark_MBps(uint32_t bytes, uint32_t cycles);
+
+void Bench_DmaMem(void);
+void Bench_Memory(void);
+void Bench_Nn(void);
+void Bench_Conv(void);
+void Bench_Gemm(void);
+void Bench_Dsp(void);
+void Bench_Fft(void);
+void Bench_Fmath(void);
+void Bench_Flash(void);
+void Bench_Gpio(void);
+void Bench_Exti(void);
+
+#endif /* BENCHMARK_H */
@@ -0,0 +1,38 @@
+#include <stdio.h>
+
+#include "boot_app.h"
+
+extern const uint8_t _eflash_image[];   /* Linker script */
+
+/* Checked by the bootloader; crc is filled in by tools/app_seal.c */
+__attribute__((section(".app_header"), used))
+const boot_app_header boot_app_header_record =
+{
+  .magic = BOOT_APP_MAGIC,
+  .version = APP_VERSION,
+  .size = (uint32_t)_eflash_image - BOOT_APP_BASE,
+  .crc = BOOT_CRC_UNSEALED,
+};
+
+/**
+  * @brief  Print how long the cold start took.
+  * @param  main_cycles DWT CYCCNT read first thing in main(). The bootloader
+  *         starts the counter at reset and leaves it running, so this is
+  *         reset to main(), bootloader included.
+  */
+void Boot_Report(uint32_t main_cycles)
+{
+  const uint32_t cycles_per_us = HSI_VALUE / 1000000U;   /* Both run from HSI until SystemClock_Config() */
+
+  if (BOOT_INFO->magic != BOOT_INFO_MAGIC)
+  {
+    printf("boot: not started by the bootloader\n");
+    return;
+  }
+  printf("boot: v%lu, jump after %lu cycles (%lu us), main() after %lu cycles (%lu us)\n",
+         (unsigned long)BOOT_INFO->version,
+         (unsigned long)BOOT_INFO->cycles, (unsigned long)(BOOT_INFO->cycles / cycles_per_us),
+         (unsigned long)main_cycles, (unsigned long)(main_cycles / cycles_per_us));
+
+  BOOT_INFO->magic = 0U;   /* A debugger reset into the app does not report this boot again */
+}
@@ -0,0 +1,14 @@
+#ifndef BOOT_APP_H
+#define BOOT_APP_H
+
+#include "stm32h7xx_hal.h"
+#include "boot_header.h"
+
+/* Set from the build for each release; the bootloader refuses < BOOT_MIN_VERSION */
+#ifndef APP_VERSION
+#define APP_VERSION   1U
+#endif
+
+void Boot_Report(uint32_t main_cycles);
+
+#endif /* BOOT_APP_H */
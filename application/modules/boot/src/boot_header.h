@@ -0,0 +1,57 @@
+#ifndef BOOT_HEADER_H
+#define BOOT_HEADER_H
+
+#include <stdint.h>
+
+/*
+ * Contract between the bootloader (application/bootloader), the application
+ * and tools/app_seal.c. Plain C so that the host tools can include it.
+ *
+ * The bootloader owns sector 0 of the bank (0x08000000) and the application
+ * starts at sector 1 with its vector table. The application header sits at
+ * BOOT_HEADER_OFFSET past it, where the linker script places .app_header.
+ * size counts bytes from BOOT_APP_BASE to the end of the image, header
+ * included. crc is the CRC unit's reset configuration (CRC-32/MPEG-2:
+ * polynomial 0x04C11DB7, initial value 0xFFFFFFFF, no reflection, no final
+ * XOR) over the image as little-endian 32-bit words, less the header's own
+ * words. The link leaves it at BOOT_CRC_UNSEALED; app_seal fills it in.
+ *
+ * The bootloader starts the application only if the magic, size, version
+ * and CRC all hold. It then leaves a boot_info record at the top of DTCM,
+ * which neither image links anything into.
+ */
+#define BOOT_APP_BASE          0x08020000U   /*!< Sector 1 of the running bank */
+#define BOOT_APP_MAX_SIZE      (0x000A0000U - 128U)   /*!< Sectors 1-5 less the fw_update trailer burst */
+#define BOOT_HEADER_OFFSET     0x400U        /*!< Past the vector table */
+#define BOOT_APP_MAGIC         0x48505041U   /* "APPH" */
+#define BOOT_CRC_UNSEALED      0xFFFFFFFFU
+
+/* Images older than this are refused; raise it to retire a release */
+#ifndef BOOT_MIN_VERSION
+#define BOOT_MIN_VERSION       1U
+#endif
+
+typedef struct
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;       /*!< Bytes from BOOT_APP_BASE, a multiple of 4 */
+  uint32_t crc;
+} boot_app_header;
+
+#define BOOT_APP_HEADER        ((const boot_app_header *)(BOOT_APP_BASE + BOOT_HEADER_OFFSET))
+
+#define BOOT_INFO_ADDRESS      0x2001FFE0U   /*!< Last 32 bytes of DTCM */
+#define BOOT_INFO_MAGIC        0x464E4942U   /* "BINF" */
+
+typedef struct
+{
+  uint32_t magic;
+  uint32_t cycles;     /*!< Core cycles from reset to the jump (DWT CYCCNT) */
+  uint32_t version;    /*!< Of the application started */
+  uint32_t reserved[5];
+} boot_info;
+
+#define BOOT_INFO              ((volatile boot_info *)BOOT_INFO_ADDRESS)
+
+#endif /* BOOT_HEADER_H */
@@ -0,0 +1,700 @@
+#include <string.h>
+
+#include "dma_manager.h"
+#include "irq_config.h"
+
+#define DMA_MGR_STREAMS_PER_CTRL   8U
+#define DMA_MGR_MDMA_CHANNELS      16U
+#define DMA_MGR_MAX_ITEMS          65535U
+#define DMA_MGR_MDMA_MAX_BLOCK     65536U
+#define DMA_MGR_MDMA_MAX_BLOCKS    4096U
+
+static DMAMgr_ChannelTypeDef  dma_mgr_pool[DMA_MGR_MAX_CHANNELS];
+static DMAMgr_ChannelTypeDef *dma_mgr_owner[DMA_MGR_CONTROLLERS][DMA_MGR_MDMA_CHANNELS];
+
+static void * const dma_mgr_instance[DMA_MGR_CONTROLLERS][DMA_MGR_MDMA_CHANNELS] =
+{
+  { DMA1_Stream0, DMA1_Stream1, DMA1_Stream2, DMA1_Stream3,
+    DMA1_Stream4, DMA1_Stream5, DMA1_Stream6, DMA1_Stream7 },
+  { DMA2_Stream0, DMA2_Stream1, DMA2_Stream2, DMA2_Stream3,
+    DMA2_Stream4, DMA2_Stream5, DMA2_Stream6, DMA2_Stream7 },
+  { BDMA_Channel0, BDMA_Channel1, BDMA_Channel2, BDMA_Channel3,
+    BDMA_Channel4, BDMA_Channel5, BDMA_Channel6, BDMA_Channel7 },
+  { MDMA_Channel0,  MDMA_Channel1,  MDMA_Channel2,  MDMA_Channel3,
+    MDMA_Channel4,  MDMA_Channel5,  MDMA_Channel6,  MDMA_Channel7,
+    MDMA_Channel8,  MDMA_Channel9,  MDMA_Channel10, MDMA_Channel11,
+    MDMA_Channel12, MDMA_Channel13, MDMA_Channel14, MDMA_Channel15 },
+};
+
+/* MDMA channels share MDMA_IRQn and are not listed */
+static const IRQn_Type dma_mgr_irqn[DMA_MGR_MDMA][DMA_MGR_STREAMS_PER_CTRL] =
+{
+  { DMA1_Stream0_IRQn, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn,
+    DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, DMA1_Stream7_IRQn },
+  { DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn,
+    DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn },
+  { BDMA_Channel0_IRQn, BDMA_Channel1_IRQn, BDMA_Channel2_IRQn, BDMA_Channel3_IRQn,
+    BDMA_Channel4_IRQn, BDMA_Channel5_IRQn, BDMA_Channel6_IRQn, BDMA_Channel7_IRQn },
+};
+
+static const uint32_t dma_mgr_streams[DMA_MGR_CONTROLLERS] =
+{
+  DMA_MGR_STREAMS_PER_CTRL, DMA_MGR_STREAMS_PER_CTRL, DMA_MGR_STREAMS_PER_CTRL, DMA_MGR_MDMA_CHANNELS
+};
+
+static const uint32_t dma_mgr_dma_priority[] =
+{
+  DMA_PRIORITY_LOW, DMA_PRIORITY_MEDIUM, DMA_PRIORITY_HIGH, DMA_PRIORITY_VERY_HIGH
+};
+
+static const uint32_t dma_mgr_mdma_priority[] =
+{
+  MDMA_PRIORITY_LOW, MDMA_PRIORITY_MEDIUM, MDMA_PRIORITY_HIGH, MDMA_PRIORITY_VERY_HIGH
+};
+
+static const uint32_t dma_mgr_dma_burst[] =
+{
+  DMA_MBURST_SINGLE, DMA_MBURST_INC4, DMA_MBURST_INC8, DMA_MBURST_INC16
+};
+
+static const uint32_t dma_mgr_mdma_src_burst[] =
+{
+  MDMA_SOURCE_BURST_SINGLE, MDMA_SOURCE_BURST_4BEATS, MDMA_SOURCE_BURST_8BEATS, MDMA_SOURCE_BURST_16BEATS
+};
+
+static const uint32_t dma_mgr_mdma_dst_burst[] =
+{
+  MDMA_DEST_BURST_SINGLE, MDMA_DEST_BURST_4BEATS, MDMA_DEST_BURST_8BEATS, MDMA_DEST_BURST_16BEATS
+};
+
+static uint32_t DMAMgr_IsCacheable(uint32_t address)
+{
+  if ((SCB->CCR & SCB_CCR_DC_Msk) == 0U)
+  {
+    return 0U;
+  }
+
+  /* TCMs bypass the cache; peripherals are device memory */
+  if ((address >= D1_DTCMRAM_BASE) && (address < (D1_DTCMRAM_BASE + 0x20000U)))
+  {
+    return 0U;
+  }
+
+  return ((address >= FLASH_BANK1_BASE) && (address < PERIPH_BASE)) ? 1U : 0U;
+}
+
+void DMAMgr_CacheClean(uint32_t address, uint32_t size)
+{
+  if ((size != 0U) && (DMAMgr_IsCacheable(address) != 0U))
+  {
+    uint32_t start = address & ~(DMA_MGR_CACHE_LINE - 1U);
+
+    SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)((address + size) - start));
+  }
+}
+
+void DMAMgr_CacheInvalidate(uint32_t address, uint32_t size)
+{
+  if ((size != 0U) && (DMAMgr_IsCacheable(address) != 0U))
+  {
+    uint32_t start = address & ~(DMA_MGR_CACHE_LINE - 1U);
+
+    SCB_InvalidateDCache_by_Addr((uint32_t *)start, (int32_t)((address + size) - start));
+  }
+}
+
+/**
+  * @brief  Whether a controller's bus matrix port can reach a memory address.
+  * @note   DMA1/DMA2 cannot see the TCMs; BDMA only sees D3 SRAM4.
+  */
+uint32_t DMAMgr_IsReachable(DMAMgr_ControllerTypeDef controller, uint32_t address)
+{
+  uint32_t tcm = ((address < (D1_ITCMRAM_BASE + 0x10000U)) ||
+                  ((address >= D1_DTCMRAM_BASE) && (address < (D1_DTCMRAM_BASE + 0x20000U)))) ? 1U : 0U;
+
+  switch (controller)
+  {
+    case DMA_MGR_DMA1:
+    case DMA_MGR_DMA2:
+      return (tcm == 0U) ? 1U : 0U;
+
+    case DMA_MGR_BDMA:
+      return ((address >= D3_SRAM_BASE) && (address < (D3_SRAM_BASE + 0x10000U))) ? 1U : 0U;
+
+    case DMA_MGR_MDMA:
+      return 1U;
+
+    default:
+      return 0U;
+  }
+}
+
+static uint32_t DMAMgr_ElementBytes(const DMAMgr_ChannelTypeDef *channel)
+{
+  return 1UL << (uint32_t)channel->Config.DataSize;
+}
+
+static uint32_t DMAMgr_ReceivesIntoMemory(const DMAMgr_ChannelTypeDef *channel)
+{
+  return (channel->Config.Direction != DMA_MGR_DIR_MEM_TO_PERIPH) ? 1U : 0U;
+}
+
+static void DMAMgr_Notify(DMAMgr_ChannelTypeDef *channel, uint32_t event)
+{
+  if (DMAMgr_ReceivesIntoMemory(channel) != 0U)
+  {
+    uint32_t half = channel->MemBytes / 2U;
+
+    switch (event)
+    {
+      case DMA_MGR_EVENT_HALF:
+        DMAMgr_CacheInvalidate(channel->MemAddress[0], half);
+        break;
+
+      case DMA_MGR_EVENT_COMPLETE:
+        if (channel->Config.Mode == DMA_MGR_MODE_CIRCULAR)
+        {
+          DMAMgr_CacheInvalidate(channel->MemAddress[0] + half, channel->MemBytes - half);
+        }
+        else
+        {
+          DMAMgr_CacheInvalidate(channel->MemAddress[0], channel->MemBytes);
+        }
+        break;
+
+      case DMA_MGR_EVENT_M1_COMPLETE:
+        DMAMgr_CacheInvalidate(channel->MemAddress[1], channel->MemBytes);
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  if (channel->Config.Callback != NULL)
+  {
+    channel->Config.Callback(channel, event, channel->Config.Context);
+  }
+
+  if (channel->Config.EventGroup != NULL)
+  {
+    (void)EventGroup_Set(channel->Config.EventGroup, event << channel->Config.EventShift);
+  }
+}
+
+static void DMAMgr_DmaHalf(DMA_HandleTypeDef *hdma)     { DMAMgr_Notify(hdma->Parent, DMA_MGR_EVENT_HALF); }
+static void DMAMgr_DmaCplt(DMA_HandleTypeDef *hdma)     { DMAMgr_Notify(hdma->Parent, DMA_MGR_EVENT_COMPLETE); }
+static void DMAMgr_DmaM1Cplt(DMA_HandleTypeDef *hdma)   { DMAMgr_Notify(hdma->Parent, DMA_MGR_EVENT_M1_COMPLETE); }
+static void DMAMgr_DmaError(DMA_HandleTypeDef *hdma)    { DMAMgr_Notify(hdma->Parent, DMA_MGR_EVENT_ERROR); }
+static void DMAMgr_MdmaCplt(MDMA_HandleTypeDef *hmdma)  { DMAMgr_Notify(hmdma->Parent, DMA_MGR_EVENT_COMPLETE); }
+static void DMAMgr_MdmaError(MDMA_HandleTypeDef *hmdma) { DMAMgr_Notify(hmdma->Parent, DMA_MGR_EVENT_ERROR); }
+
+static void DMAMgr_EnableClock(DMAMgr_ControllerTypeDef controller)
+{
+  switch (controller)
+  {
+    case DMA_MGR_DMA1: __HAL_RCC_DMA1_CLK_ENABLE(); break;
+    case DMA_MGR_DMA2: __HAL_RCC_DMA2_CLK_ENABLE(); break;
+    case DMA_MGR_BDMA: __HAL_RCC_BDMA_CLK_ENABLE(); break;
+    case DMA_MGR_MDMA: __HAL_RCC_MDMA_CLK_ENABLE(); break;
+    default: break;
+  }
+}
+
+/**
+  * @brief  Whether another channel already holds the same DMAMUX request line.
+  */
+static uint32_t DMAMgr_RequestTaken(const DMAMgr_ConfigTypeDef *config)
+{
+  uint32_t i;
+
+  if (((config->Controller != DMA_MGR_MDMA) && (config->Request == DMA_REQUEST_MEM2MEM)) ||
+      ((config->Controller == DMA_MGR_MDMA) && (config->Request == MDMA_REQUEST_SW)))
+  {
+    return 0U;
+  }
+
+  for (i = 0U; i < DMA_MGR_MAX_CHANNELS; i++)
+  {
+    const DMAMgr_ConfigTypeDef *other = &dma_mgr_pool[i].Config;
+    uint32_t same_mux;
+
+    if (dma_mgr_pool[i].InUse == 0U)
+    {
+      continue;
+    }
+
+    /* DMA1 and DMA2 share DMAMUX1; BDMA has DMAMUX2; MDMA has its own lines */
+    same_mux = ((config->Controller == other->Controller) ||
+                ((config->Controller <= DMA_MGR_DMA2) && (other->Controller <= DMA_MGR_DMA2))) ? 1U : 0U;
+
+    if ((same_mux != 0U) && (other->Request == config->Request))
+    {
+      return 1U;
+    }
+  }
+
+  return 0U;
+}
+
+static HAL_StatusTypeDef DMAMgr_InitDma(DMAMgr_ChannelTypeDef *channel)
+{
+  static const uint32_t direction[] = { DMA_PERIPH_TO_MEMORY, DMA_MEMORY_TO_PERIPH, DMA_MEMORY_TO_MEMORY };
+  static const uint32_t periph_size[] = { DMA_PDATAALIGN_BYTE, DMA_PDATAALIGN_HALFWORD, DMA_PDATAALIGN_WORD };
+  static const uint32_t mem_size[] = { DMA_MDATAALIGN_BYTE, DMA_MDATAALIGN_HALFWORD, DMA_MDATAALIGN_WORD };
+  const DMAMgr_ConfigTypeDef *config = &channel->Config;
+  DMA_HandleTypeDef *hdma = &channel->Handle.dma;
+
+  hdma->Instance = dma_mgr_instance[config->Controller][channel->Stream];
+  hdma->Init.Request = config->Request;
+  hdma->Init.Direction = direction[config->Direction];
+  hdma->Init.PeriphInc = (config->PeriphInc != 0U) ? DMA_PINC_ENABLE : DMA_PINC_DISABLE;
+  hdma->Init.MemInc = DMA_MINC_ENABLE;
+  hdma->Init.PeriphDataAlignment = periph_size[config->DataSize];
+  hdma->Init.MemDataAlignment = mem_size[config->DataSize];
+  hdma->Init.Mode = (config->Mode == DMA_MGR_MODE_NORMAL) ? DMA_NORMAL : DMA_CIRCULAR;
+  hdma->Init.Priority = dma_mgr_dma_priority[config->Priority];
+  hdma->Init.FIFOMode = DMA_FIFOMODE_ENABLE;
+  hdma->Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+  hdma->Init.MemBurst = dma_mgr_dma_burst[config->Burst];
+  hdma->Init.PeriphBurst = DMA_PBURST_SINGLE;
+  hdma->Parent = channel;
+
+  if (HAL_DMA_Init(hdma) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  hdma->XferHalfCpltCallback = DMAMgr_DmaHalf;
+  hdma->XferCpltCallback = DMAMgr_DmaCplt;
+  hdma->XferM1CpltCallback = DMAMgr_DmaM1Cplt;
+  hdma->XferErrorCallback = DMAMgr_DmaError;
+
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef DMAMgr_InitMdma(DMAMgr_ChannelTypeDef *channel)
+{
+  static const uint32_t src_inc[] =
+  {
+    MDMA_SRC_INC_BYTE, MDMA_SRC_INC_HALFWORD, MDMA_SRC_INC_WORD, MDMA_SRC_INC_DOUBLEWORD
+  };
+  static const uint32_t dst_inc[] =
+  {
+    MDMA_DEST_INC_BYTE, MDMA_DEST_INC_HALFWORD, MDMA_DEST_INC_WORD, MDMA_DEST_INC_DOUBLEWORD
+  };
+  static const uint32_t src_size[] =
+  {
+    MDMA_SRC_DATASIZE_BYTE, MDMA_SRC_DATASIZE_HALFWORD, MDMA_SRC_DATASIZE_WORD, MDMA_SRC_DATASIZE_DOUBLEWORD
+  };
+  static const uint32_t dst_size[] =
+  {
+    MDMA_DEST_DATASIZE_BYTE, MDMA_DEST_DATASIZE_HALFWORD, MDMA_DEST_DATASIZE_WORD, MDMA_DEST_DATASIZE_DOUBLEWORD
+  };
+  const DMAMgr_ConfigTypeDef *config = &channel->Config;
+  MDMA_HandleTypeDef *hmdma = &channel->Handle.mdma;
+  uint32_t periph_inc = (config->PeriphInc != 0U) ? 1U : 0U;
+
+  hmdma->Instance = dma_mgr_instance[DMA_MGR_MDMA][channel->Stream];
+  hmdma->Init.Request = config->Request;
+  /* Software requests move the whole transfer at once; hardware requests pace it one element at a time */
+  hmdma->Init.TransferTriggerMode = (config->Request == MDMA_REQUEST_SW) ? MDMA_FULL_TRANSFER : MDMA_BUFFER_TRANSFER;
+  hmdma->Init.Priority = dma_mgr_mdma_priority[config->Priority];
+  hmdma->Init.Endianness = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+  hmdma->Init.SourceInc = ((config->Direction != DMA_MGR_DIR_PERIPH_TO_MEM) || (periph_inc != 0U)) ?
+                          src_inc[config->DataSize] : MDMA_SRC_INC_DISABLE;
+  hmdma->Init.DestinationInc = ((config->Direction != DMA_MGR_DIR_MEM_TO_PERIPH) || (periph_inc != 0U)) ?
+                               dst_inc[config->DataSize] : MDMA_DEST_INC_DISABLE;
+  hmdma->Init.SourceDataSize = src_size[config->DataSize];
+  hmdma->Init.DestDataSize = dst_size[config->DataSize];
+  hmdma->Init.DataAlignment = MDMA_DATAALIGN_PACKENABLE;
+  hmdma->Init.BufferTransferLength = (config->Request == MDMA_REQUEST_SW) ? 128U : DMAMgr_ElementBytes(channel);
+  hmdma->Init.SourceBurst = dma_mgr_mdma_src_burst[config->Burst];
+  hmdma->Init.DestBurst = dma_mgr_mdma_dst_burst[config->Burst];
+  hmdma->Init.SourceBlockAddressOffset = 0;
+  hmdma->Init.DestBlockAddressOffset = 0;
+  hmdma->Parent = channel;
+
+  if (HAL_MDMA_Init(hmdma) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  hmdma->XferCpltCallback = DMAMgr_MdmaCplt;
+  hmdma->XferErrorCallback = DMAMgr_MdmaError;
+
+  return HAL_OK;
+}
+
+void DMAMgr_Init(void)
+{
+  memset(dma_mgr_pool, 0, sizeof(dma_mgr_pool));
+  memset(dma_mgr_owner, 0, sizeof(dma_mgr_owner));
+}
+
+/**
+  * @brief  Claims a stream and its request line and initialises it.
+  * @retval The channel, or NULL if no stream/line is free or the config is invalid.
+  */
+DMAMgr_ChannelTypeDef *DMAMgr_Alloc(const DMAMgr_ConfigTypeDef *config)
+{
+  DMAMgr_ChannelTypeDef *channel = NULL;
+  uint32_t streams = dma_mgr_streams[config->Controller];
+  uint32_t stream = DMA_MGR_STREAM_ANY;
+  uint32_t mdma_active = 0U;
+  HAL_StatusTypeDef status;
+  uint32_t primask;
+  uint32_t i;
+
+  IRQ_KERNEL_API_CHECK();
+
+  if ((config->Controller == DMA_MGR_MDMA) && (config->Mode != DMA_MGR_MODE_NORMAL))
+  {
+    return NULL;
+  }
+  if ((config->Controller != DMA_MGR_MDMA) && (config->DataSize == DMA_MGR_SIZE_DOUBLEWORD))
+  {
+    return NULL;
+  }
+  if ((config->Direction == DMA_MGR_DIR_MEM_TO_MEM) && (config->Mode != DMA_MGR_MODE_NORMAL))
+  {
+    return NULL;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (DMAMgr_RequestTaken(config) == 0U)
+  {
+    for (i = 0U; i < streams; i++)
+    {
+      if (dma_mgr_owner[config->Controller][i] != NULL)
+      {
+        mdma_active = 1U;
+      }
+      if ((dma_mgr_owner[config->Controller][i] == NULL) &&
+          ((config->Stream == DMA_MGR_STREAM_ANY) || (config->Stream == i)) &&
+          (stream == DMA_MGR_STREAM_ANY))
+      {
+        stream = i;
+      }
+    }
+
+    for (i = 0U; (i < DMA_MGR_MAX_CHANNELS) && (stream != DMA_MGR_STREAM_ANY); i++)
+    {
+      if (dma_mgr_pool[i].InUse == 0U)
+      {
+        channel = &dma_mgr_pool[i];
+        memset(channel, 0, sizeof(*channel));
+        channel->Config = *config;
+        channel->Stream = stream;
+        channel->InUse = 1U;
+        dma_mgr_owner[config->Controller][stream] = channel;
+        break;
+      }
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  if (channel == NULL)
+  {
+    return NULL;
+  }
+
+  DMAMgr_EnableClock(config->Controller);
+
+  if (config->Controller == DMA_MGR_MDMA)
+  {
+    status = DMAMgr_InitMdma(channel);
+    /* One vector serves all MDMA channels: it runs at the most urgent level requested.
+       mdma_active tells whether another MDMA channel already set it. */
+    if ((mdma_active == 0U) || (config->IrqPriority < NVIC_GetPriority(MDMA_IRQn)))
+    {
+      IRQ_Config_SetPriority(MDMA_IRQn, config->IrqPriority);
+    }
+    HAL_NVIC_EnableIRQ(MDMA_IRQn);
+  }
+  else
+  {
+    status = DMAMgr_InitDma(channel);
+    IRQ_Config_SetPriority(dma_mgr_irqn[config->Controller][stream], config->IrqPriority);
+    HAL_NVIC_EnableIRQ(dma_mgr_irqn[config->Controller][stream]);
+  }
+
+  if (status != HAL_OK)
+  {
+    DMAMgr_Free(channel);
+    return NULL;
+  }
+
+  return channel;
+}
+
+void DMAMgr_Free(DMAMgr_ChannelTypeDef *channel)
+{
+  DMAMgr_ControllerTypeDef controller = channel->Config.Controller;
+  uint32_t primask;
+  uint32_t i;
+
+  IRQ_KERNEL_API_CHECK();
+
+  (void)DMAMgr_Stop(channel);
+
+  if (controller == DMA_MGR_MDMA)
+  {
+    (void)HAL_MDMA_DeInit(&channel->Handle.mdma);
+  }
+  else
+  {
+    HAL_NVIC_DisableIRQ(dma_mgr_irqn[controller][channel->Stream]);
+    (void)HAL_DMA_DeInit(&channel->Handle.dma);
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  dma_mgr_owner[controller][channel->Stream] = NULL;
+  channel->InUse = 0U;
+  __set_PRIMASK(primask);
+
+  if (controller == DMA_MGR_MDMA)
+  {
+    for (i = 0U; i < DMA_MGR_MDMA_CHANNELS; i++)
+    {
+      if (dma_mgr_owner[DMA_MGR_MDMA][i] != NULL)
+      {
+        return;
+      }
+    }
+    HAL_NVIC_DisableIRQ(MDMA_IRQn);
+  }
+}
+
+/**
+  * @brief  Prepares the cache for a transfer: cleans what the DMA will read,
+  *         and writes back then drops what it will overwrite.
+  */
+static void DMAMgr_PrepareCache(DMAMgr_ChannelTypeDef *channel, uint32_t SrcAddress, uint32_t bytes)
+{
+  uint32_t i;
+
+  if (channel->Config.Direction != DMA_MGR_DIR_PERIPH_TO_MEM)
+  {
+    DMAMgr_CacheClean(SrcAddress, bytes);
+  }
+
+  if (DMAMgr_ReceivesIntoMemory(channel) != 0U)
+  {
+    for (i = 0U; i < 2U; i++)
+    {
+      if ((channel->MemAddress[i] != 0U) && (DMAMgr_IsCacheable(channel->MemAddress[i]) != 0U))
+      {
+        uint32_t start = channel->MemAddress[i] & ~(DMA_MGR_CACHE_LINE - 1U);
+
+        SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start,
+                                          (int32_t)((channel->MemAddress[i] + bytes) - start));
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Splits an MDMA transfer into equal blocks the block counters can hold.
+  */
+HAL_StatusTypeDef DMAMgr_SplitBlocks(uint32_t bytes, uint32_t *BlockDataLength, uint32_t *BlockCount)
+{
+  uint32_t block = bytes;
+  uint32_t count = 1U;
+
+  while ((block > DMA_MGR_MDMA_MAX_BLOCK) && ((block & 1U) == 0U))
+  {
+    block /= 2U;
+    count *= 2U;
+  }
+  if ((bytes == 0U) || (block > DMA_MGR_MDMA_MAX_BLOCK) || (count > DMA_MGR_MDMA_MAX_BLOCKS))
+  {
+    return HAL_ERROR;
+  }
+
+  *BlockDataLength = block;
+  *BlockCount = count;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Starts a normal or circular transfer.
+  * @param  DataLength Number of DataSize elements.
+  */
+HAL_StatusTypeDef DMAMgr_Start(DMAMgr_ChannelTypeDef *channel, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength)
+{
+  uint32_t bytes = DataLength * DMAMgr_ElementBytes(channel);
+  uint32_t mem = (channel->Config.Direction == DMA_MGR_DIR_MEM_TO_PERIPH) ? SrcAddress : DstAddress;
+
+  IRQ_KERNEL_API_CHECK();
+
+  if ((DataLength == 0U) || (channel->Config.Mode == DMA_MGR_MODE_DOUBLE_BUFFER))
+  {
+    return HAL_ERROR;
+  }
+  if ((DMAMgr_IsReachable(channel->Config.Controller, mem) == 0U) ||
+      ((channel->Config.Direction == DMA_MGR_DIR_MEM_TO_MEM) &&
+       (DMAMgr_IsReachable(channel->Config.Controller, SrcAddress) == 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  channel->MemAddress[0] = mem;
+  channel->MemAddress[1] = 0U;
+  channel->MemBytes = bytes;
+  DMAMgr_PrepareCache(channel, SrcAddress, bytes);
+
+  if (channel->Config.Controller == DMA_MGR_MDMA)
+  {
+    uint32_t block;
+    uint32_t count;
+
+    if (DMAMgr_SplitBlocks(bytes, &block, &count) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    if (HAL_MDMA_Start_IT(&channel->Handle.mdma, SrcAddress, DstAddress, block, count) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    if (channel->Config.Request == MDMA_REQUEST_SW)
+    {
+      return HAL_MDMA_GenerateSWRequest(&channel->Handle.mdma);
+    }
+    return HAL_OK;
+  }
+
+  if (DataLength > DMA_MGR_MAX_ITEMS)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_DMA_Start_IT(&channel->Handle.dma, SrcAddress, DstAddress, DataLength);
+}
+
+/**
+  * @brief  Starts a double-buffer transfer; the stream ping-pongs between
+  *         Mem0Address and Mem1Address until stopped.
+  * @param  DataLength Number of DataSize elements per buffer.
+  */
+HAL_StatusTypeDef DMAMgr_StartDoubleBuffer(DMAMgr_ChannelTypeDef *channel, uint32_t PeriphAddress, uint32_t Mem0Address, uint32_t Mem1Address, uint32_t DataLength)
+{
+  uint32_t bytes = DataLength * DMAMgr_ElementBytes(channel);
+
+  IRQ_KERNEL_API_CHECK();
+
+  if ((channel->Config.Mode != DMA_MGR_MODE_DOUBLE_BUFFER) || (DataLength == 0U) || (DataLength > DMA_MGR_MAX_ITEMS))
+  {
+    return HAL_ERROR;
+  }
+  if ((DMAMgr_IsReachable(channel->Config.Controller, Mem0Address) == 0U) ||
+      (DMAMgr_IsReachable(channel->Config.Controller, Mem1Address) == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  channel->MemAddress[0] = Mem0Address;
+  channel->MemAddress[1] = Mem1Address;
+  channel->MemBytes = bytes;
+
+  if (channel->Config.Direction == DMA_MGR_DIR_MEM_TO_PERIPH)
+  {
+    DMAMgr_CacheClean(Mem0Address, bytes);
+    DMAMgr_CacheClean(Mem1Address, bytes);
+    return HAL_DMAEx_MultiBufferStart_IT(&channel->Handle.dma, Mem0Address, PeriphAddress, Mem1Address, DataLength);
+  }
+
+  DMAMgr_PrepareCache(channel, PeriphAddress, bytes);
+  return HAL_DMAEx_MultiBufferStart_IT(&channel->Handle.dma, PeriphAddress, Mem0Address, Mem1Address, DataLength);
+}
+
+HAL_StatusTypeDef DMAMgr_Stop(DMAMgr_ChannelTypeDef *channel)
+{
+  if (DMAMgr_IsBusy(channel) == 0U)
+  {
+    return HAL_OK;
+  }
+
+  if (channel->Config.Controller == DMA_MGR_MDMA)
+  {
+    return HAL_MDMA_Abort(&channel->Handle.mdma);
+  }
+
+  return HAL_DMA_Abort(&channel->Handle.dma);
+}
+
+uint32_t DMAMgr_IsBusy(const DMAMgr_ChannelTypeDef *channel)
+{
+  if (channel->Config.Controller == DMA_MGR_MDMA)
+  {
+    return (channel->Handle.mdma.State == HAL_MDMA_STATE_BUSY) ? 1U : 0U;
+  }
+
+  return (channel->Handle.dma.State == HAL_DMA_STATE_BUSY) ? 1U : 0U;
+}
+
+static void DMAMgr_StreamIRQHandler(DMAMgr_ControllerTypeDef controller, uint32_t stream)
+{
+  DMAMgr_ChannelTypeDef *channel = dma_mgr_owner[controller][stream];
+
+  if (channel != NULL)
+  {
+    HAL_DMA_IRQHandler(&channel->Handle.dma);
+  }
+}
+
+#define DMA_MGR_STREAM_IRQ(handler, controller, stream) \
+  void handler(void);                                   \
+  void handler(void)                                    \
+  {                                                     \
+    DMAMgr_StreamIRQHandler((controller), (stream));    \
+  }
+
+DMA_MGR_STREAM_IRQ(DMA1_Stream0_IRQHandler, DMA_MGR_DMA1, 0U)
+DMA_MGR_STREAM_IRQ(DMA1_Stream1_IRQHandler, DMA_MGR_DMA1, 1U)
+DMA_MGR_STREAM_IRQ(DMA1_Stream2_IRQHandler, DMA_MGR_DMA1, 2U)
+DMA_MGR_STREAM_IRQ(DMA1_Stream3_IRQHandler, DMA_MGR_DMA1, 3U)
+DMA_MGR_STREAM_IRQ(DMA1_Stream4_IRQHandler, DMA_MGR_DMA1, 4U)
+DMA_MGR_STREAM_IRQ(DMA1_Stream5_IRQHandler, DMA_MGR_DMA1, 5U)
+DMA_MGR_STREAM_IRQ(DMA1_Stream6_IRQHandler, DMA_MGR_DMA1, 6U)
+DMA_MGR_STREAM_IRQ(DMA1_Stream7_IRQHandler, DMA_MGR_DMA1, 7U)
+DMA_MGR_STREAM_IRQ(DMA2_Stream0_IRQHandler, DMA_MGR_DMA2, 0U)
+DMA_MGR_STREAM_IRQ(DMA2_Stream1_IRQHandler, DMA_MGR_DMA2, 1U)
+DMA_MGR_STREAM_IRQ(DMA2_Stream2_IRQHandler, DMA_MGR_DMA2, 2U)
+DMA_MGR_STREAM_IRQ(DMA2_Stream3_IRQHandler, DMA_MGR_DMA2, 3U)
+DMA_MGR_STREAM_IRQ(DMA2_Stream4_IRQHandler, DMA_MGR_DMA2, 4U)
+DMA_MGR_STREAM_IRQ(DMA2_Stream5_IRQHandler, DMA_MGR_DMA2, 5U)
+DMA_MGR_STREAM_IRQ(DMA2_Stream6_IRQHandler, DMA_MGR_DMA2, 6U)
+DMA_MGR_STREAM_IRQ(DMA2_Stream7_IRQHandler, DMA_MGR_DMA2, 7U)
+DMA_MGR_STREAM_IRQ(BDMA_Channel0_IRQHandler, DMA_MGR_BDMA, 0U)
+DMA_MGR_STREAM_IRQ(BDMA_Channel1_IRQHandler, DMA_MGR_BDMA, 1U)
+DMA_MGR_STREAM_IRQ(BDMA_Channel2_IRQHandler, DMA_MGR_BDMA, 2U)
+DMA_MGR_STREAM_IRQ(BDMA_Channel3_IRQHandler, DMA_MGR_BDMA, 3U)
+DMA_MGR_STREAM_IRQ(BDMA_Channel4_IRQHandler, DMA_MGR_BDMA, 4U)
+DMA_MGR_STREAM_IRQ(BDMA_Channel5_IRQHandler, DMA_MGR_BDMA, 5U)
+DMA_MGR_STREAM_IRQ(BDMA_Channel6_IRQHandler, DMA_MGR_BDMA, 6U)
+DMA_MGR_STREAM_IRQ(BDMA_Channel7_IRQHandler, DMA_MGR_BDMA, 7U)
+
+void MDMA_IRQHandler(void);
+void MDMA_IRQHandler(void)
+{
+  uint32_t pending = MDMA->GISR0;
+
+  while (pending != 0U)
+  {
+    uint32_t index = 31U - __CLZ(pending);
+    DMAMgr_ChannelTypeDef *channel = dma_mgr_owner[DMA_MGR_MDMA][index];
+
+    pending &= ~(1UL << index);
+    if (channel != NULL)
+    {
+      HAL_MDMA_IRQHandler(&channel->Handle.mdma);
+    }
+  }
+}
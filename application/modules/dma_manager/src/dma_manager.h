@@ -0,0 +1,127 @@
+#ifndef DMA_MANAGER_H
+#define DMA_MANAGER_H
+
+#include "stm32h7xx_hal.h"
+#include "event_group.h"
+
+/*
+ * DMA resource manager.
+ *
+ * One API over DMA1/DMA2 streams, BDMA channels and MDMA channels: the
+ * manager owns every stream, its DMAMUX request line and its vector, keeps
+ * the D-cache coherent with non-TCM buffers and reports completion through a
+ * callback and/or bits in an event group.
+ *
+ * Cache: buffers written by DMA should be DMA_MGR_BUFFER_ALIGNED so that
+ * invalidating them cannot discard a neighbour's dirty cache line.
+ */
+#define DMA_MGR_MAX_CHANNELS       16U
+#define DMA_MGR_CACHE_LINE         32U
+#define DMA_MGR_BUFFER_ALIGNED     __attribute__((aligned(DMA_MGR_CACHE_LINE)))
+
+#define DMA_MGR_STREAM_ANY         0xFFU
+
+/* Events, passed to the callback and shifted into the event group */
+#define DMA_MGR_EVENT_HALF         0x01U   /*!< First half done (circular)                 */
+#define DMA_MGR_EVENT_COMPLETE     0x02U   /*!< Transfer done, or memory 0 done (double)   */
+#define DMA_MGR_EVENT_M1_COMPLETE  0x04U   /*!< Memory 1 done (double buffer)              */
+#define DMA_MGR_EVENT_ERROR        0x08U
+#define DMA_MGR_EVENT_ALL          0x0FU
+
+typedef enum
+{
+  DMA_MGR_DMA1 = 0U,
+  DMA_MGR_DMA2,
+  DMA_MGR_BDMA,
+  DMA_MGR_MDMA,
+  DMA_MGR_CONTROLLERS
+} DMAMgr_ControllerTypeDef;
+
+typedef enum
+{
+  DMA_MGR_MODE_NORMAL = 0U,
+  DMA_MGR_MODE_CIRCULAR,
+  DMA_MGR_MODE_DOUBLE_BUFFER      /*!< DMA1/DMA2/BDMA only */
+} DMAMgr_ModeTypeDef;
+
+typedef enum
+{
+  DMA_MGR_DIR_PERIPH_TO_MEM = 0U,
+  DMA_MGR_DIR_MEM_TO_PERIPH,
+  DMA_MGR_DIR_MEM_TO_MEM
+} DMAMgr_DirectionTypeDef;
+
+typedef enum
+{
+  DMA_MGR_SIZE_BYTE = 0U,
+  DMA_MGR_SIZE_HALFWORD,
+  DMA_MGR_SIZE_WORD,
+  DMA_MGR_SIZE_DOUBLEWORD         /*!< MDMA only */
+} DMAMgr_DataSizeTypeDef;
+
+typedef enum
+{
+  DMA_MGR_BURST_SINGLE = 0U,
+  DMA_MGR_BURST_INC4,
+  DMA_MGR_BURST_INC8,
+  DMA_MGR_BURST_INC16
+} DMAMgr_BurstTypeDef;
+
+typedef enum
+{
+  DMA_MGR_PRIORITY_LOW = 0U,
+  DMA_MGR_PRIORITY_MEDIUM,
+  DMA_MGR_PRIORITY_HIGH,
+  DMA_MGR_PRIORITY_VERY_HIGH
+} DMAMgr_PriorityTypeDef;
+
+typedef struct DMAMgr_Channel DMAMgr_ChannelTypeDef;
+
+typedef void (*DMAMgr_CallbackTypeDef)(DMAMgr_ChannelTypeDef *channel, uint32_t event, void *context);
+
+typedef struct
+{
+  DMAMgr_ControllerTypeDef Controller;
+  uint32_t                 Stream;       /*!< Stream/channel index or DMA_MGR_STREAM_ANY       */
+  uint32_t                 Request;      /*!< DMA_REQUEST_x, BDMA_REQUEST_x or MDMA_REQUEST_x   */
+  DMAMgr_DirectionTypeDef  Direction;
+  DMAMgr_ModeTypeDef       Mode;
+  DMAMgr_DataSizeTypeDef   DataSize;
+  DMAMgr_PriorityTypeDef   Priority;
+  DMAMgr_BurstTypeDef      Burst;        /*!< Memory-side burst (both sides on MDMA)           */
+  uint32_t                 PeriphInc;    /*!< Non-zero to increment the peripheral address      */
+  uint32_t                 IrqPriority;  /*!< One of the IRQ_PRIO_xxx levels                    */
+  DMAMgr_CallbackTypeDef   Callback;     /*!< Optional, runs in interrupt context               */
+  void                    *Context;
+  EventGroup_TypeDef      *EventGroup;   /*!< Optional                                          */
+  uint32_t                 EventShift;   /*!< Position of DMA_MGR_EVENT_HALF in the group       */
+} DMAMgr_ConfigTypeDef;
+
+struct DMAMgr_Channel
+{
+  union
+  {
+    DMA_HandleTypeDef  dma;
+    MDMA_HandleTypeDef mdma;
+  } Handle;
+  DMAMgr_ConfigTypeDef Config;
+  uint32_t             Stream;
+  uint32_t             InUse;
+  uint32_t             MemAddress[2];  /*!< Memory side of the running transfer, for cache upkeep */
+  uint32_t             MemBytes;       /*!< Bytes per memory buffer                               */
+};
+
+void                   DMAMgr_Init(void);
+DMAMgr_ChannelTypeDef *DMAMgr_Alloc(const DMAMgr_ConfigTypeDef *config);
+void                   DMAMgr_Free(DMAMgr_ChannelTypeDef *channel);
+HAL_StatusTypeDef      DMAMgr_Start(DMAMgr_ChannelTypeDef *channel, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
+HAL_StatusTypeDef      DMAMgr_StartDoubleBuffer(DMAMgr_ChannelTypeDef *channel, uint32_t PeriphAddress, uint32_t Mem0Address, uint32_t Mem1Address, uint32_t DataLength);
+HAL_StatusTypeDef      DMAMgr_Stop(DMAMgr_ChannelTypeDef *channel);
+uint32_t               DMAMgr_IsBusy(const DMAMgr_ChannelTypeDef *channel);
+
+void     DMAMgr_CacheClean(uint32_t address, uint32_t size);
+void     DMAMgr_CacheInvalidate(uint32_t address, uint32_t size);
+uint32_t DMAMgr_IsReachable(DMAMgr_ControllerTypeDef controller, uint32_t address);
+HAL_StatusTypeDef DMAMgr_SplitBlocks(uint32_t bytes, uint32_t *BlockDataLength, uint32_t *BlockCount);
+
+#endif /* DMA_MANAGER_H */
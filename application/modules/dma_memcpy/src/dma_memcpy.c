@@ -0,0 +1,414 @@
+#include <string.h>
+
+#include "dma_memcpy.h"
+#include "dma_manager.h"
+#include "irq_config.h"
+#include "memory_sections.h"
+
+#define DMA_MEM_WIDE_ALIGN    8U
+
+typedef enum
+{
+  DMA_MEM_JOB_COPY = 0U,
+  DMA_MEM_JOB_FILL
+} DMA_MemJobKindTypeDef;
+
+typedef struct
+{
+  DMA_MemJobKindTypeDef  Kind;
+  DMAMgr_ChannelTypeDef *Channel;
+  uint32_t               Count;
+  DMA_MemSegmentTypeDef  Segment[DMA_MEM_MAX_SEGMENTS];
+  uint64_t               Pattern;
+  DMA_MemFutureTypeDef  *Future;
+} DMA_MemJobTypeDef;
+
+static DMAMgr_ChannelTypeDef *dma_mem_wide;   /* 64-bit beats, 8-byte aligned copies */
+static DMAMgr_ChannelTypeDef *dma_mem_byte;   /* byte beats, mismatched alignment    */
+static DMAMgr_ChannelTypeDef *dma_mem_fill;   /* fixed 64-bit source                 */
+
+static DMA_MemJobTypeDef dma_mem_queue[DMA_MEM_QUEUE_DEPTH];
+static uint32_t          dma_mem_head;
+static uint32_t          dma_mem_count;
+static uint32_t          dma_mem_reserved;   /* Slots held by submits doing their CPU part */
+
+/* Read by the MDMA itself: kept in DTCM so no cache maintenance is needed */
+static MDMA_LinkNodeTypeDef dma_mem_node[DMA_MEM_MAX_SEGMENTS - 1U] MEM_DTCM_BSS __attribute__((aligned(8)));
+static uint64_t             dma_mem_pattern MEM_DTCM_BSS;
+static uint32_t             dma_mem_nodes;
+
+static void dma_mem_complete(DMAMgr_ChannelTypeDef *channel, uint32_t event, void *context);
+
+static DMAMgr_ChannelTypeDef *dma_mem_alloc(DMAMgr_DirectionTypeDef direction, DMAMgr_DataSizeTypeDef size)
+{
+  DMAMgr_ConfigTypeDef config = {0};
+
+  config.Controller = DMA_MGR_MDMA;
+  config.Stream = DMA_MGR_STREAM_ANY;
+  config.Request = MDMA_REQUEST_SW;
+  config.Direction = direction;
+  config.Mode = DMA_MGR_MODE_NORMAL;
+  config.DataSize = size;
+  config.Priority = DMA_MGR_PRIORITY_LOW;
+  config.Burst = DMA_MGR_BURST_INC16;
+  config.IrqPriority = IRQ_PRIO_KERNEL_LOW;
+  config.Callback = dma_mem_complete;
+
+  return DMAMgr_Alloc(&config);
+}
+
+HAL_StatusTypeDef dma_mem_init(void)
+{
+  dma_mem_wide = dma_mem_alloc(DMA_MGR_DIR_MEM_TO_MEM, DMA_MGR_SIZE_DOUBLEWORD);
+  dma_mem_byte = dma_mem_alloc(DMA_MGR_DIR_MEM_TO_MEM, DMA_MGR_SIZE_BYTE);
+  /* Peripheral-to-memory with a non-incrementing "peripheral" is a fill */
+  dma_mem_fill = dma_mem_alloc(DMA_MGR_DIR_PERIPH_TO_MEM, DMA_MGR_SIZE_DOUBLEWORD);
+
+  dma_mem_head = 0U;
+  dma_mem_count = 0U;
+  dma_mem_reserved = 0U;
+
+  return ((dma_mem_wide != NULL) && (dma_mem_byte != NULL) && (dma_mem_fill != NULL)) ? HAL_OK : HAL_ERROR;
+}
+
+static void dma_mem_resolve(DMA_MemFutureTypeDef *future, HAL_StatusTypeDef status)
+{
+  if (future != NULL)
+  {
+    future->Status = status;
+    future->Done = 1U;
+  }
+}
+
+static uint32_t dma_mem_element(const DMAMgr_ChannelTypeDef *channel)
+{
+  return (channel == dma_mem_byte) ? 1U : DMA_MEM_WIDE_ALIGN;
+}
+
+/**
+  * @brief  Starts the job at the head of the queue. Caller masks interrupts.
+  */
+static void dma_mem_start(void)
+{
+  while (dma_mem_count != 0U)
+  {
+    DMA_MemJobTypeDef *job = &dma_mem_queue[dma_mem_head];
+    DMAMgr_ChannelTypeDef *channel = job->Channel;
+    MDMA_LinkNodeConfTypeDef node = {0};
+    uint32_t src = (uint32_t)job->Segment[0].Src;
+    uint32_t element = dma_mem_element(channel);
+    HAL_StatusTypeDef status = HAL_OK;
+    uint32_t i;
+
+    if (job->Kind == DMA_MEM_JOB_FILL)
+    {
+      dma_mem_pattern = job->Pattern;
+      src = (uint32_t)&dma_mem_pattern;
+    }
+
+    /* Segments after the first ride along as MDMA linked-list nodes */
+    node.Init = channel->Handle.mdma.Init;
+    for (i = 1U; (i < job->Count) && (status == HAL_OK); i++)
+    {
+      node.SrcAddress = (uint32_t)job->Segment[i].Src;
+      node.DstAddress = (uint32_t)job->Segment[i].Dst;
+      status = DMAMgr_SplitBlocks(job->Segment[i].Length, &node.BlockDataLength, &node.BlockCount);
+      if (status == HAL_OK)
+      {
+        status = HAL_MDMA_LinkedList_CreateNode(&dma_mem_node[i - 1U], &node);
+      }
+      if (status == HAL_OK)
+      {
+        status = HAL_MDMA_LinkedList_AddNode(&channel->Handle.mdma, &dma_mem_node[i - 1U], NULL);
+      }
+      if (status == HAL_OK)
+      {
+        dma_mem_nodes++;
+        DMAMgr_CacheClean(node.SrcAddress, job->Segment[i].Length);
+        DMAMgr_CacheClean(node.DstAddress, job->Segment[i].Length);
+      }
+    }
+
+    if (status == HAL_OK)
+    {
+      status = DMAMgr_Start(channel, src, (uint32_t)job->Segment[0].Dst, job->Segment[0].Length / element);
+    }
+    if (status == HAL_OK)
+    {
+      return;
+    }
+
+    /* Could not start: fail this job and move on */
+    while (dma_mem_nodes != 0U)
+    {
+      dma_mem_nodes--;
+      (void)HAL_MDMA_LinkedList_RemoveNode(&channel->Handle.mdma, &dma_mem_node[dma_mem_nodes]);
+    }
+    dma_mem_resolve(job->Future, HAL_ERROR);
+    dma_mem_head = (dma_mem_head + 1U) % DMA_MEM_QUEUE_DEPTH;
+    dma_mem_count--;
+  }
+}
+
+static void dma_mem_complete(DMAMgr_ChannelTypeDef *channel, uint32_t event, void *context)
+{
+  DMA_MemJobTypeDef *job = &dma_mem_queue[dma_mem_head];
+  uint32_t i;
+
+  UNUSED(context);
+
+  while (dma_mem_nodes != 0U)
+  {
+    dma_mem_nodes--;
+    (void)HAL_MDMA_LinkedList_RemoveNode(&channel->Handle.mdma, &dma_mem_node[dma_mem_nodes]);
+  }
+
+  /* The manager invalidated segment 0; the linked ones are ours */
+  for (i = 1U; i < job->Count; i++)
+  {
+    DMAMgr_CacheInvalidate((uint32_t)job->Segment[i].Dst, job->Segment[i].Length);
+  }
+
+  dma_mem_resolve(job->Future, (event == DMA_MGR_EVENT_ERROR) ? HAL_ERROR : HAL_OK);
+  dma_mem_head = (dma_mem_head + 1U) % DMA_MEM_QUEUE_DEPTH;
+  dma_mem_count--;
+
+  dma_mem_start();
+}
+
+/**
+  * @brief  Copies the unaligned head and tail of a segment on the CPU and
+  *         shrinks it to its 8-byte aligned body.
+  */
+static void dma_mem_trim_copy(DMA_MemSegmentTypeDef *segment)
+{
+  uint8_t *dst = segment->Dst;
+  const uint8_t *src = segment->Src;
+  uint32_t head = (DMA_MEM_WIDE_ALIGN - ((uint32_t)dst & (DMA_MEM_WIDE_ALIGN - 1U))) & (DMA_MEM_WIDE_ALIGN - 1U);
+  uint32_t body;
+
+  if (head > segment->Length)
+  {
+    head = segment->Length;
+  }
+  body = (segment->Length - head) & ~(DMA_MEM_WIDE_ALIGN - 1U);
+
+  memcpy(dst, src, head);
+  memcpy(dst + head + body, src + head + body, segment->Length - head - body);
+
+  segment->Dst = dst + head;
+  segment->Src = src + head;
+  segment->Length = body;
+}
+
+/**
+  * @brief  Holds a queue slot for a job about to be submitted.
+  * @retval HAL_BUSY if every slot is queued or held.
+  */
+static HAL_StatusTypeDef dma_mem_reserve(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  HAL_StatusTypeDef status = HAL_BUSY;
+
+  __disable_irq();
+  if ((dma_mem_count + dma_mem_reserved) < DMA_MEM_QUEUE_DEPTH)
+  {
+    dma_mem_reserved++;
+    status = HAL_OK;
+  }
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Queues a job into the slot held by dma_mem_reserve(), or
+  *         resolves it at once if nothing was left for the MDMA.
+  */
+static void dma_mem_submit(const DMA_MemJobTypeDef *job)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t slot;
+
+  __disable_irq();
+  dma_mem_reserved--;
+
+  if (job->Count == 0U)
+  {
+    __set_PRIMASK(primask);
+    dma_mem_resolve(job->Future, HAL_OK);
+    return;
+  }
+
+  slot = (dma_mem_head + dma_mem_count) % DMA_MEM_QUEUE_DEPTH;
+  dma_mem_queue[slot] = *job;
+  dma_mem_count++;
+  if (dma_mem_count == 1U)
+  {
+    dma_mem_start();
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Scatter-gather copy in a single MDMA request.
+  * @param  future Optional; resolved when every segment has landed.
+  * @retval HAL_BUSY if the queue is full; nothing has been copied then,
+  *         not even the parts the CPU would do.
+  */
+HAL_StatusTypeDef dma_memcpy_sg(const DMA_MemSegmentTypeDef *segments, uint32_t count, DMA_MemFutureTypeDef *future)
+{
+  DMA_MemJobTypeDef job;
+  uint32_t aligned = 1U;
+  uint32_t total = 0U;
+  uint32_t i;
+
+  if ((count == 0U) || (count > DMA_MEM_MAX_SEGMENTS))
+  {
+    return HAL_ERROR;
+  }
+
+  if (future != NULL)
+  {
+    future->Done = 0U;
+  }
+
+  for (i = 0U; i < count; i++)
+  {
+    total += segments[i].Length;
+    if ((((uint32_t)segments[i].Dst ^ (uint32_t)segments[i].Src) & (DMA_MEM_WIDE_ALIGN - 1U)) != 0U)
+    {
+      aligned = 0U;
+    }
+  }
+
+  if (total < DMA_MEM_THRESHOLD)
+  {
+    for (i = 0U; i < count; i++)
+    {
+      memcpy(segments[i].Dst, segments[i].Src, segments[i].Length);
+    }
+    dma_mem_resolve(future, HAL_OK);
+    return HAL_OK;
+  }
+
+  if (dma_mem_reserve() != HAL_OK)
+  {
+    return HAL_BUSY;
+  }
+
+  job.Kind = DMA_MEM_JOB_COPY;
+  job.Channel = (aligned != 0U) ? dma_mem_wide : dma_mem_byte;
+  job.Future = future;
+  job.Pattern = 0U;
+  job.Count = 0U;
+
+  for (i = 0U; i < count; i++)
+  {
+    DMA_MemSegmentTypeDef segment = segments[i];
+    uint32_t block;
+    uint32_t blocks;
+
+    if (aligned != 0U)
+    {
+      dma_mem_trim_copy(&segment);
+    }
+
+    if (segment.Length == 0U)
+    {
+      continue;
+    }
+    if (DMAMgr_SplitBlocks(segment.Length, &block, &blocks) != HAL_OK)
+    {
+      /* No equal-block split exists: this one goes through the CPU */
+      memcpy(segment.Dst, segment.Src, segment.Length);
+      continue;
+    }
+    job.Segment[job.Count++] = segment;
+  }
+
+  dma_mem_submit(&job);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef dma_memcpy(void *dst, const void *src, uint32_t len, DMA_MemFutureTypeDef *future)
+{
+  DMA_MemSegmentTypeDef segment;
+
+  segment.Dst = dst;
+  segment.Src = src;
+  segment.Length = len;
+
+  return dma_memcpy_sg(&segment, 1U, future);
+}
+
+HAL_StatusTypeDef dma_memset(void *dst, uint8_t value, uint32_t len, DMA_MemFutureTypeDef *future)
+{
+  DMA_MemJobTypeDef job;
+  uint8_t *ptr = dst;
+  uint32_t head;
+  uint32_t body;
+  uint32_t block;
+  uint32_t blocks;
+
+  if (future != NULL)
+  {
+    future->Done = 0U;
+  }
+
+  head = (DMA_MEM_WIDE_ALIGN - ((uint32_t)ptr & (DMA_MEM_WIDE_ALIGN - 1U))) & (DMA_MEM_WIDE_ALIGN - 1U);
+  if (head > len)
+  {
+    head = len;
+  }
+  body = (len - head) & ~(DMA_MEM_WIDE_ALIGN - 1U);
+
+  if ((len < DMA_MEM_THRESHOLD) || (DMAMgr_SplitBlocks(body, &block, &blocks) != HAL_OK))
+  {
+    memset(dst, value, len);
+    dma_mem_resolve(future, HAL_OK);
+    return HAL_OK;
+  }
+
+  if (dma_mem_reserve() != HAL_OK)
+  {
+    return HAL_BUSY;
+  }
+
+  memset(ptr, value, head);
+  memset(ptr + head + body, value, len - head - body);
+
+  job.Kind = DMA_MEM_JOB_FILL;
+  job.Channel = dma_mem_fill;
+  job.Count = 1U;
+  job.Segment[0].Dst = ptr + head;
+  job.Segment[0].Src = NULL;
+  job.Segment[0].Length = body;
+  job.Pattern = (uint64_t)value * 0x0101010101010101ULL;
+  job.Future = future;
+
+  dma_mem_submit(&job);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Waits for a future to resolve.
+  * @param  Timeout Timeout in ms, HAL_MAX_DELAY to wait forever.
+  * @retval The transfer status, or HAL_TIMEOUT.
+  */
+HAL_StatusTypeDef dma_mem_wait(DMA_MemFutureTypeDef *future, uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while (future->Done == 0U)
+  {
+    if ((Timeout != HAL_MAX_DELAY) && ((HAL_GetTick() - tickstart) >= Timeout))
+    {
+      return HAL_TIMEOUT;
+    }
+    __WFE();
+  }
+
+  return future->Status;
+}
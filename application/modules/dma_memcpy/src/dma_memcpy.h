@@ -0,0 +1,46 @@
+#ifndef DMA_MEMCPY_H
+#define DMA_MEMCPY_H
+
+#include "stm32h7xx_hal.h"
+
+/*
+ * Asynchronous memcpy/memset on the MDMA.
+ *
+ * Requests shorter than DMA_MEM_THRESHOLD are done on the CPU before the call
+ * returns. Longer ones are queued and run one at a time; unaligned heads and
+ * tails are done by the CPU at submit time, the 8-byte aligned body by the
+ * MDMA in 64-bit, 16-beat bursts. Buffers may live in any RAM including the
+ * TCMs. Source and destination must not overlap.
+ *
+ * A queue slot is reserved before the CPU touches anything, so HAL_BUSY
+ * (queue full) means nothing has been written and the call may be retried.
+ */
+#define DMA_MEM_THRESHOLD       2048U
+#define DMA_MEM_QUEUE_DEPTH     8U
+#define DMA_MEM_MAX_SEGMENTS    8U
+
+typedef struct
+{
+  volatile uint32_t          Done;
+  volatile HAL_StatusTypeDef Status;
+} DMA_MemFutureTypeDef;
+
+typedef struct
+{
+  void       *Dst;
+  const void *Src;
+  uint32_t    Length;
+} DMA_MemSegmentTypeDef;
+
+HAL_StatusTypeDef dma_mem_init(void);
+HAL_StatusTypeDef dma_memcpy(void *dst, const void *src, uint32_t len, DMA_MemFutureTypeDef *future);
+HAL_StatusTypeDef dma_memset(void *dst, uint8_t value, uint32_t len, DMA_MemFutureTypeDef *future);
+HAL_StatusTypeDef dma_memcpy_sg(const DMA_MemSegmentTypeDef *segments, uint32_t count, DMA_MemFutureTypeDef *future);
+HAL_StatusTypeDef dma_mem_wait(DMA_MemFutureTypeDef *future, uint32_t Timeout);
+
+__STATIC_FORCEINLINE uint32_t dma_mem_is_done(const DMA_MemFutureTypeDef *future)
+{
+  return future->Done;
+}
+
+#endif /* DMA_MEMCPY_H */
@@ -0,0 +1,87 @@
+#ifndef DSP_H
+#define DSP_H
+
+#include <stdint.h>
+
+#include "dsp_types.h"
+
+/*
+ * Fixed- and floating-point filters for the sensor front-end: FIR,
+ * cascaded biquad IIR, polyphase decimation and interpolation, in q15,
+ * q31 and f32, and complex and real FFTs in f32 and q15 (conventions in
+ * dsp_types.h).
+ *
+ * The q15 paths use SMLALD (two 16x16 MACs per instruction into 64 bits);
+ * FIRs compute two outputs per pass so each coefficient load feeds two
+ * MACs, with independent accumulator chains for the dual-issue pipeline.
+ * Filters keep their own state and may run in place (in == out), except
+ * the interpolators, whose output is factor times longer.
+ */
+
+/* FIR and decimator: state holds 2 * (num_taps + 1) samples */
+dsp_status dsp_fir_init_q15(dsp_fir_inst_q15 *inst, uint16_t num_taps, const dsp_q15 *coeffs, dsp_q15 *state);
+dsp_status dsp_fir_init_q31(dsp_fir_inst_q31 *inst, uint16_t num_taps, const dsp_q31 *coeffs, dsp_q31 *state);
+dsp_status dsp_fir_init_f32(dsp_fir_inst_f32 *inst, uint16_t num_taps, const float *coeffs, float *state);
+void       dsp_fir_q15(dsp_fir_inst_q15 *inst, const dsp_q15 *in, dsp_q15 *out, uint32_t block);
+void       dsp_fir_q31(dsp_fir_inst_q31 *inst, const dsp_q31 *in, dsp_q31 *out, uint32_t block);
+void       dsp_fir_f32(dsp_fir_inst_f32 *inst, const float *in, float *out, uint32_t block);
+
+/* Decimate by factor: any block length, returns the number of outputs written */
+dsp_status dsp_decim_init_q15(dsp_decim_inst_q15 *inst, uint16_t factor, uint16_t num_taps,
+                              const dsp_q15 *coeffs, dsp_q15 *state);
+dsp_status dsp_decim_init_q31(dsp_decim_inst_q31 *inst, uint16_t factor, uint16_t num_taps,
+                              const dsp_q31 *coeffs, dsp_q31 *state);
+dsp_status dsp_decim_init_f32(dsp_decim_inst_f32 *inst, uint16_t factor, uint16_t num_taps,
+                              const float *coeffs, float *state);
+uint32_t   dsp_decim_q15(dsp_decim_inst_q15 *inst, const dsp_q15 *in, dsp_q15 *out, uint32_t block);
+uint32_t   dsp_decim_q31(dsp_decim_inst_q31 *inst, const dsp_q31 *in, dsp_q31 *out, uint32_t block);
+uint32_t   dsp_decim_f32(dsp_decim_inst_f32 *inst, const float *in, float *out, uint32_t block);
+
+/*
+ * Interpolate by factor: num_taps must be a multiple of factor. The
+ * prototype is time-reversed like an FIR and should have a passband gain
+ * of factor; init writes its polyphase copy to coeffs (num_taps entries).
+ * state holds 2 * num_taps / factor samples. Writes block * factor outputs.
+ */
+dsp_status dsp_interp_init_q15(dsp_interp_inst_q15 *inst, uint16_t factor, uint16_t num_taps,
+                               const dsp_q15 *prototype, dsp_q15 *coeffs, dsp_q15 *state);
+dsp_status dsp_interp_init_q31(dsp_interp_inst_q31 *inst, uint16_t factor, uint16_t num_taps,
+                               const dsp_q31 *prototype, dsp_q31 *coeffs, dsp_q31 *state);
+dsp_status dsp_interp_init_f32(dsp_interp_inst_f32 *inst, uint16_t factor, uint16_t num_taps,
+                               const float *prototype, float *coeffs, float *state);
+void       dsp_interp_q15(dsp_interp_inst_q15 *inst, const dsp_q15 *in, dsp_q15 *out, uint32_t block);
+void       dsp_interp_q31(dsp_interp_inst_q31 *inst, const dsp_q31 *in, dsp_q31 *out, uint32_t block);
+void       dsp_interp_f32(dsp_interp_inst_f32 *inst, const float *in, float *out, uint32_t block);
+
+/* Biquad cascade: post_shift 0..15 (q15) or 0..31 (q31) */
+dsp_status dsp_biquad_init_q15(dsp_biquad_inst_q15 *inst, uint8_t stages, const dsp_q15 *coeffs,
+                               dsp_q15 *state, int8_t post_shift);
+dsp_status dsp_biquad_init_q31(dsp_biquad_inst_q31 *inst, uint8_t stages, const dsp_q31 *coeffs,
+                               dsp_q31 *state, int8_t post_shift);
+dsp_status dsp_biquad_init_f32(dsp_biquad_inst_f32 *inst, uint8_t stages, const float *coeffs, float *state);
+void       dsp_biquad_q15(dsp_biquad_inst_q15 *inst, const dsp_q15 *in, dsp_q15 *out, uint32_t block);
+void       dsp_biquad_q31(dsp_biquad_inst_q31 *inst, const dsp_q31 *in, dsp_q31 *out, uint32_t block);
+void       dsp_biquad_f32(dsp_biquad_inst_f32 *inst, const float *in, float *out, uint32_t block);
+
+/*
+ * FFTs: complex n = 4..DSP_FFT_MAX_N, real n = 8..DSP_FFT_MAX_N, powers of
+ * two, in place. twiddles NULL selects the built-in table; otherwise pass a
+ * copy of dsp_fft_twiddle_f32/q15 (e.g. in DTCM), see dsp_fft_tables.h.
+ *
+ * f32: the forward transform is the plain DFT, the inverse includes 1/n.
+ * q15: the forward transform returns DFT/n (each stage halves, so nothing
+ * overflows); the inverse is the exact inverse DFT, so a round trip gives x/n.
+ *
+ * Real spectra are packed as {X[0], X[n/2], re X[1], im X[1], ...,
+ * re X[n/2-1], im X[n/2-1]}; both X[0] and X[n/2] are real.
+ */
+dsp_status dsp_cfft_init_f32(dsp_cfft_inst_f32 *inst, uint16_t n, const float *twiddles);
+dsp_status dsp_cfft_init_q15(dsp_cfft_inst_q15 *inst, uint16_t n, const dsp_q15 *twiddles);
+dsp_status dsp_rfft_init_f32(dsp_rfft_inst_f32 *inst, uint16_t n, const float *twiddles);
+dsp_status dsp_rfft_init_q15(dsp_rfft_inst_q15 *inst, uint16_t n, const dsp_q15 *twiddles);
+void       dsp_cfft_f32(const dsp_cfft_inst_f32 *inst, float *data, uint8_t inverse);
+void       dsp_cfft_q15(const dsp_cfft_inst_q15 *inst, dsp_q15 *data, uint8_t inverse);
+void       dsp_rfft_f32(const dsp_rfft_inst_f32 *inst, float *data, uint8_t inverse);
+void       dsp_rfft_q15(const dsp_rfft_inst_q15 *inst, dsp_q15 *data, uint8_t inverse);
+
+#endif /* DSP_H */
@@ -0,0 +1,168 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "dsp.h"
+#include "dsp_math.h"
+
+/*
+ * Stages run one after another over the whole block (the first reads in,
+ * the rest filter out in place), so each stage's coefficients and state
+ * stay in registers for the inner loop.
+ */
+
+dsp_status dsp_biquad_init_q15(dsp_biquad_inst_q15 *inst, uint8_t stages, const dsp_q15 *coeffs,
+                               dsp_q15 *state, int8_t post_shift)
+{
+  if ((stages == 0U) || (coeffs == NULL) || (state == NULL) || (post_shift < 0) || (post_shift > 15))
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->stages = stages;
+  inst->post_shift = post_shift;
+  inst->coeffs = coeffs;
+  inst->state = state;
+  memset(state, 0, 4U * stages * sizeof(dsp_q15));
+  return DSP_OK;
+}
+
+dsp_status dsp_biquad_init_q31(dsp_biquad_inst_q31 *inst, uint8_t stages, const dsp_q31 *coeffs,
+                               dsp_q31 *state, int8_t post_shift)
+{
+  if ((stages == 0U) || (coeffs == NULL) || (state == NULL) || (post_shift < 0) || (post_shift > 31))
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->stages = stages;
+  inst->post_shift = post_shift;
+  inst->coeffs = coeffs;
+  inst->state = state;
+  memset(state, 0, 4U * stages * sizeof(dsp_q31));
+  return DSP_OK;
+}
+
+dsp_status dsp_biquad_init_f32(dsp_biquad_inst_f32 *inst, uint8_t stages, const float *coeffs, float *state)
+{
+  if ((stages == 0U) || (coeffs == NULL) || (state == NULL))
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->stages = stages;
+  inst->coeffs = coeffs;
+  inst->state = state;
+  memset(state, 0, 2U * stages * sizeof(float));
+  return DSP_OK;
+}
+
+/**
+  * @brief  q15 direct form I. {x1, x2} and {y1, y2} are kept packed so the
+  *         feedforward and feedback pairs are one SMLALD each.
+  */
+void dsp_biquad_q15(dsp_biquad_inst_q15 *inst, const dsp_q15 *in, dsp_q15 *out, uint32_t block)
+{
+  const uint32_t shift = 15U - (uint32_t)inst->post_shift;
+  const dsp_q15 *src = in;
+  uint32_t stage;
+  uint32_t i;
+
+  for (stage = 0U; stage < inst->stages; stage++)
+  {
+    const dsp_q15 *c = &inst->coeffs[6U * stage];
+    dsp_q15 *st = &inst->state[4U * stage];
+    const int32_t b0 = c[0];
+    const uint32_t b12 = dsp_read_q15x2(&c[2]);
+    const uint32_t a12 = dsp_read_q15x2(&c[4]);
+    uint32_t x12 = dsp_pack_q15x2(st[0], (uint16_t)st[1]);
+    uint32_t y12 = dsp_pack_q15x2(st[2], (uint16_t)st[3]);
+
+    for (i = 0U; i < block; i++)
+    {
+      const int32_t x = src[i];
+      int64_t acc = (int64_t)(b0 * x);
+      dsp_q15 y;
+
+      acc = dsp_smlald(b12, x12, acc);
+      acc = dsp_smlald(a12, y12, acc);
+      y = dsp_sat_q15(acc >> shift);
+
+      x12 = dsp_pack_q15x2(x, x12);
+      y12 = dsp_pack_q15x2(y, y12);
+      out[i] = y;
+    }
+
+    st[0] = (dsp_q15)x12;
+    st[1] = (dsp_q15)(x12 >> 16);
+    st[2] = (dsp_q15)y12;
+    st[3] = (dsp_q15)(y12 >> 16);
+    src = out;
+  }
+}
+
+/**
+  * @brief  q31 direct form I with a 64-bit accumulator (SMLAL).
+  */
+void dsp_biquad_q31(dsp_biquad_inst_q31 *inst, const dsp_q31 *in, dsp_q31 *out, uint32_t block)
+{
+  const uint32_t shift = 31U - (uint32_t)inst->post_shift;
+  const dsp_q31 *src = in;
+  uint32_t stage;
+  uint32_t i;
+
+  for (stage = 0U; stage < inst->stages; stage++)
+  {
+    const dsp_q31 *c = &inst->coeffs[5U * stage];
+    dsp_q31 *st = &inst->state[4U * stage];
+    const int64_t b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+    dsp_q31 x1 = st[0], x2 = st[1], y1 = st[2], y2 = st[3];
+
+    for (i = 0U; i < block; i++)
+    {
+      const dsp_q31 x = src[i];
+      const int64_t acc = b0 * x + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2;
+      const dsp_q31 y = dsp_sat_q31(acc >> shift);
+
+      x2 = x1;
+      x1 = x;
+      y2 = y1;
+      y1 = y;
+      out[i] = y;
+    }
+
+    st[0] = x1;
+    st[1] = x2;
+    st[2] = y1;
+    st[3] = y2;
+    src = out;
+  }
+}
+
+/**
+  * @brief  f32 transposed direct form II: two state words per stage, five VFMAs per sample.
+  */
+void dsp_biquad_f32(dsp_biquad_inst_f32 *inst, const float *in, float *out, uint32_t block)
+{
+  const float *src = in;
+  uint32_t stage;
+  uint32_t i;
+
+  for (stage = 0U; stage < inst->stages; stage++)
+  {
+    const float *c = &inst->coeffs[5U * stage];
+    float *st = &inst->state[2U * stage];
+    const float b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+    float d1 = st[0], d2 = st[1];
+
+    for (i = 0U; i < block; i++)
+    {
+      const float x = src[i];
+      const float y = b0 * x + d1;
+
+      d1 = b1 * x + a1 * y + d2;
+      d2 = b2 * x + a2 * y;
+      out[i] = y;
+    }
+
+    st[0] = d1;
+    st[1] = d2;
+    src = out;
+  }
+}
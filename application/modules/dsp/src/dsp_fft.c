@@ -0,0 +1,459 @@
+#include <stddef.h>
+
+#include "dsp.h"
+#include "dsp_fft_tables.h"
+#include "dsp_math.h"
+
+/*
+ * Mixed-radix decimation in time: the input is put in bit-reversed order,
+ * one radix-2 stage runs if log2(n) is odd, then radix-4 stages of span L
+ * combine four L-point transforms into one 4L-point transform. In
+ * bit-reversed order the four inputs at k, k+L, k+2L, k+3L are the
+ * residue 0, 2, 1, 3 sub-transforms, so they take twiddles W^0, W^2k, W^k
+ * and W^3k (W = exp(-2j*pi / 4L)): three complex multiplies per butterfly.
+ *
+ * The twiddle loop is outermost so each set of three is loaded once per
+ * stage, not once per butterfly.
+ */
+
+typedef uint64_t __attribute__((may_alias, aligned(4))) dsp_f32x2;
+typedef uint32_t __attribute__((may_alias)) dsp_q15x2;
+
+static uint32_t dsp_fft_log2(uint32_t n)
+{
+  uint32_t log2n = 0U;
+
+  while ((1UL << log2n) < n)
+  {
+    log2n++;
+  }
+  return log2n;
+}
+
+static dsp_status dsp_fft_check(uint16_t n, uint16_t min)
+{
+  return ((n >= min) && (n <= DSP_FFT_MAX_N) && ((n & (n - 1U)) == 0U)) ? DSP_OK : DSP_ARG_ERROR;
+}
+
+dsp_status dsp_cfft_init_f32(dsp_cfft_inst_f32 *inst, uint16_t n, const float *twiddles)
+{
+  if (dsp_fft_check(n, 4U) != DSP_OK)
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->n = n;
+  inst->log2n = (uint8_t)dsp_fft_log2(n);
+  inst->stride = (uint16_t)(DSP_FFT_MAX_N / n);
+  inst->twiddles = (twiddles != NULL) ? twiddles : dsp_fft_twiddle_f32;
+  return DSP_OK;
+}
+
+dsp_status dsp_cfft_init_q15(dsp_cfft_inst_q15 *inst, uint16_t n, const dsp_q15 *twiddles)
+{
+  if (dsp_fft_check(n, 4U) != DSP_OK)
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->n = n;
+  inst->log2n = (uint8_t)dsp_fft_log2(n);
+  inst->stride = (uint16_t)(DSP_FFT_MAX_N / n);
+  inst->twiddles = (twiddles != NULL) ? twiddles : dsp_fft_twiddle_q15;
+  return DSP_OK;
+}
+
+dsp_status dsp_rfft_init_f32(dsp_rfft_inst_f32 *inst, uint16_t n, const float *twiddles)
+{
+  if (dsp_fft_check(n, 8U) != DSP_OK)
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->n = n;
+  inst->stride = (uint16_t)(DSP_FFT_MAX_N / n);
+  return dsp_cfft_init_f32(&inst->cfft, (uint16_t)(n / 2U), twiddles);
+}
+
+dsp_status dsp_rfft_init_q15(dsp_rfft_inst_q15 *inst, uint16_t n, const dsp_q15 *twiddles)
+{
+  if (dsp_fft_check(n, 8U) != DSP_OK)
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->n = n;
+  inst->stride = (uint16_t)(DSP_FFT_MAX_N / n);
+  return dsp_cfft_init_q15(&inst->cfft, (uint16_t)(n / 2U), twiddles);
+}
+
+/* Swaps are 64-bit (one complex f32) or 32-bit (one complex q15) moves */
+static DSP_FFT_TEXT void dsp_fft_bitrev_f32(float *data, uint32_t n, uint32_t log2n)
+{
+  dsp_f32x2 *x = (dsp_f32x2 *)data;
+  uint32_t i;
+
+  for (i = 1U; i < n - 1U; i++)
+  {
+    const uint32_t j = dsp_bit_reverse(i, log2n);
+
+    if (i < j)
+    {
+      const uint64_t t = x[i];
+
+      x[i] = x[j];
+      x[j] = t;
+    }
+  }
+}
+
+static DSP_FFT_TEXT void dsp_fft_bitrev_q15(dsp_q15 *data, uint32_t n, uint32_t log2n)
+{
+  dsp_q15x2 *x = (dsp_q15x2 *)data;
+  uint32_t i;
+
+  for (i = 1U; i < n - 1U; i++)
+  {
+    const uint32_t j = dsp_bit_reverse(i, log2n);
+
+    if (i < j)
+    {
+      const uint32_t t = x[i];
+
+      x[i] = x[j];
+      x[j] = t;
+    }
+  }
+}
+
+/**
+  * @brief  Radix-2/4 stages on bit-reversed f32 data; inverse is a constant so each
+  *         direction gets its own copy with the conjugation folded in.
+  */
+static inline __attribute__((always_inline)) void dsp_cfft_stages_f32(float *x, uint32_t n, uint32_t log2n,
+                                                                       const float *tw, uint32_t stride,
+                                                                       const uint32_t inverse)
+{
+  const float conj = inverse ? -1.0f : 1.0f;
+  uint32_t span = 1U;
+  uint32_t k, b;
+
+  if ((log2n & 1U) != 0U)
+  {
+    for (b = 0U; b < 2U * n; b += 4U)
+    {
+      const float ar = x[b], ai = x[b + 1U], br = x[b + 2U], bi = x[b + 3U];
+
+      x[b] = ar + br;
+      x[b + 1U] = ai + bi;
+      x[b + 2U] = ar - br;
+      x[b + 3U] = ai - bi;
+    }
+    span = 2U;
+  }
+
+  for (; span < n; span *= 4U)
+  {
+    const uint32_t step = stride * (n / (4U * span));
+
+    for (k = 0U; k < span; k++)
+    {
+      const float w1r = tw[2U * k * step], w1i = conj * tw[2U * k * step + 1U];
+      const float w2r = tw[4U * k * step], w2i = conj * tw[4U * k * step + 1U];
+      const float w3r = tw[6U * k * step], w3i = conj * tw[6U * k * step + 1U];
+
+      for (b = k; b < n; b += 4U * span)
+      {
+        float *p0 = &x[2U * b];
+        float *p1 = &x[2U * (b + span)];
+        float *p2 = &x[2U * (b + 2U * span)];
+        float *p3 = &x[2U * (b + 3U * span)];
+        const float y0r = p0[0], y0i = p0[1];
+        const float y2r = p1[0] * w2r - p1[1] * w2i, y2i = p1[0] * w2i + p1[1] * w2r;
+        const float y1r = p2[0] * w1r - p2[1] * w1i, y1i = p2[0] * w1i + p2[1] * w1r;
+        const float y3r = p3[0] * w3r - p3[1] * w3i, y3i = p3[0] * w3i + p3[1] * w3r;
+        const float s02r = y0r + y2r, s02i = y0i + y2i, d02r = y0r - y2r, d02i = y0i - y2i;
+        const float s13r = y1r + y3r, s13i = y1i + y3i, d13r = y1r - y3r, d13i = y1i - y3i;
+
+        p0[0] = s02r + s13r;
+        p0[1] = s02i + s13i;
+        p2[0] = s02r - s13r;
+        p2[1] = s02i - s13i;
+        if (!inverse)
+        {
+          p1[0] = d02r + d13i;   /* d02 - j d13 */
+          p1[1] = d02i - d13r;
+          p3[0] = d02r - d13i;   /* d02 + j d13 */
+          p3[1] = d02i + d13r;
+        }
+        else
+        {
+          p1[0] = d02r - d13i;
+          p1[1] = d02i + d13r;
+          p3[0] = d02r + d13i;
+          p3[1] = d02i - d13r;
+        }
+      }
+    }
+  }
+}
+
+static inline __attribute__((always_inline)) uint32_t dsp_cmul_q15(uint32_t x, uint32_t w, const uint32_t inverse)
+{
+  int32_t re, im;
+
+  if (!inverse)
+  {
+    re = dsp_smusd(x, w) >> 15;    /* xr*wr - xi*wi */
+    im = dsp_smuadx(x, w) >> 15;   /* xr*wi + xi*wr */
+  }
+  else
+  {
+    re = dsp_smuad(x, w) >> 15;    /* x * conj(w) */
+    im = dsp_smusdx(w, x) >> 15;
+  }
+  return dsp_pack_q15x2(dsp_ssat16(re), (uint32_t)dsp_ssat16(im));
+}
+
+/**
+  * @brief  q15 stages on packed {re, im} words; every add is a halving add, so each
+  *         radix-2 level scales by 1/2 and the forward result is DFT / n.
+  */
+static inline __attribute__((always_inline)) void dsp_cfft_stages_q15(dsp_q15x2 *x, uint32_t n, uint32_t log2n,
+                                                                       const dsp_q15 *tw, uint32_t stride,
+                                                                       const uint32_t inverse)
+{
+  uint32_t span = 1U;
+  uint32_t k, b;
+
+  if ((log2n & 1U) != 0U)
+  {
+    for (b = 0U; b < n; b += 2U)
+    {
+      const uint32_t a = x[b];
+      const uint32_t c = x[b + 1U];
+
+      x[b] = dsp_shadd16(a, c);
+      x[b + 1U] = dsp_shsub16(a, c);
+    }
+    span = 2U;
+  }
+
+  for (; span < n; span *= 4U)
+  {
+    const uint32_t step = stride * (n / (4U * span));
+
+    for (k = 0U; k < span; k++)
+    {
+      const uint32_t w1 = dsp_read_q15x2(&tw[2U * k * step]);
+      const uint32_t w2 = dsp_read_q15x2(&tw[4U * k * step]);
+      const uint32_t w3 = dsp_read_q15x2(&tw[6U * k * step]);
+
+      for (b = k; b < n; b += 4U * span)
+      {
+        const uint32_t y0 = x[b];
+        const uint32_t y2 = dsp_cmul_q15(x[b + span], w2, inverse);
+        const uint32_t y1 = dsp_cmul_q15(x[b + 2U * span], w1, inverse);
+        const uint32_t y3 = dsp_cmul_q15(x[b + 3U * span], w3, inverse);
+        const uint32_t s02 = dsp_shadd16(y0, y2);
+        const uint32_t d02 = dsp_shsub16(y0, y2);
+        const uint32_t s13 = dsp_shadd16(y1, y3);
+        const uint32_t d13 = dsp_shsub16(y1, y3);
+
+        x[b] = dsp_shadd16(s02, s13);
+        x[b + 2U * span] = dsp_shsub16(s02, s13);
+        if (!inverse)
+        {
+          x[b + span] = dsp_shsax(d02, d13);        /* (d02 - j d13) / 2 */
+          x[b + 3U * span] = dsp_shasx(d02, d13);   /* (d02 + j d13) / 2 */
+        }
+        else
+        {
+          x[b + span] = dsp_shasx(d02, d13);
+          x[b + 3U * span] = dsp_shsax(d02, d13);
+        }
+      }
+    }
+  }
+}
+
+DSP_FFT_TEXT void dsp_cfft_f32(const dsp_cfft_inst_f32 *inst, float *data, uint8_t inverse)
+{
+  const uint32_t n = inst->n;
+
+  dsp_fft_bitrev_f32(data, n, inst->log2n);
+  if (!inverse)
+  {
+    dsp_cfft_stages_f32(data, n, inst->log2n, inst->twiddles, inst->stride, 0U);
+  }
+  else
+  {
+    const float scale = 1.0f / (float)n;
+    uint32_t i;
+
+    dsp_cfft_stages_f32(data, n, inst->log2n, inst->twiddles, inst->stride, 1U);
+    for (i = 0U; i < 2U * n; i++)
+    {
+      data[i] *= scale;
+    }
+  }
+}
+
+/**
+  * @brief  q15 complex FFT. Forward: DFT / n. Inverse: the exact inverse DFT,
+  *         the halving stages supplying its 1/n.
+  */
+DSP_FFT_TEXT void dsp_cfft_q15(const dsp_cfft_inst_q15 *inst, dsp_q15 *data, uint8_t inverse)
+{
+  dsp_fft_bitrev_q15(data, inst->n, inst->log2n);
+  if (!inverse)
+  {
+    dsp_cfft_stages_q15((dsp_q15x2 *)data, inst->n, inst->log2n, inst->twiddles, inst->stride, 0U);
+  }
+  else
+  {
+    dsp_cfft_stages_q15((dsp_q15x2 *)data, inst->n, inst->log2n, inst->twiddles, inst->stride, 1U);
+  }
+}
+
+/*
+ * Real FFT split: z[m] = x[2m] + j x[2m+1] has the n/2-point transform Z,
+ * and with E = (Z[k] + conj Z[n/2-k]) / 2, O = (Z[k] - conj Z[n/2-k]) / 2:
+ *   X[k] = E - j W^k O,   X[n/2-k] = conj(E) - j conj(W^k O)
+ * The inverse undoes it: Z[k] = E' + j conj(W^k) O' from X[k] and X[n/2-k].
+ */
+DSP_FFT_TEXT void dsp_rfft_f32(const dsp_rfft_inst_f32 *inst, float *data, uint8_t inverse)
+{
+  const uint32_t half = inst->n / 2U;
+  const uint32_t quarter = inst->n / 4U;
+  const float *tw = inst->cfft.twiddles;
+  uint32_t k;
+
+  if (!inverse)
+  {
+    float z0r, z0i;
+
+    dsp_cfft_f32(&inst->cfft, data, 0U);
+    z0r = data[0];
+    z0i = data[1];
+    data[0] = z0r + z0i;
+    data[1] = z0r - z0i;
+  }
+  else
+  {
+    const float x0 = data[0];
+    const float xh = data[1];
+
+    data[0] = 0.5f * (x0 + xh);
+    data[1] = 0.5f * (x0 - xh);
+  }
+
+  for (k = 1U; k < quarter; k++)
+  {
+    float *pk = &data[2U * k];
+    float *pm = &data[2U * (half - k)];
+    const float wr = tw[2U * k * inst->stride];
+    const float wi = tw[2U * k * inst->stride + 1U];
+    const float er = 0.5f * (pk[0] + pm[0]);
+    const float ei = 0.5f * (pk[1] - pm[1]);
+    const float or_ = 0.5f * (pk[0] - pm[0]);
+    const float oi = 0.5f * (pk[1] + pm[1]);
+
+    if (!inverse)
+    {
+      const float tr = wr * or_ - wi * oi;
+      const float ti = wr * oi + wi * or_;
+
+      pk[0] = er + ti;
+      pk[1] = ei - tr;
+      pm[0] = er - ti;
+      pm[1] = -ei - tr;
+    }
+    else
+    {
+      const float vr = wr * or_ + wi * oi;
+      const float vi = wr * oi - wi * or_;
+
+      pk[0] = er - vi;
+      pk[1] = ei + vr;
+      pm[0] = er + vi;
+      pm[1] = vr - ei;
+    }
+  }
+  data[2U * quarter + 1U] = -data[2U * quarter + 1U];
+
+  if (inverse)
+  {
+    dsp_cfft_f32(&inst->cfft, data, 1U);
+  }
+}
+
+/**
+  * @brief  q15 real FFT. Forward: DFT / n, the split adding the last halving.
+  *         Inverse: the exact inverse DFT, saturating.
+  */
+DSP_FFT_TEXT void dsp_rfft_q15(const dsp_rfft_inst_q15 *inst, dsp_q15 *data, uint8_t inverse)
+{
+  const uint32_t half = inst->n / 2U;
+  const uint32_t quarter = inst->n / 4U;
+  const dsp_q15 *tw = inst->cfft.twiddles;
+  const uint32_t shift = inverse ? 1U : 2U;
+  uint32_t k;
+
+  if (!inverse)
+  {
+    int32_t z0r, z0i;
+
+    dsp_cfft_q15(&inst->cfft, data, 0U);
+    z0r = data[0];
+    z0i = data[1];
+    data[0] = (dsp_q15)((z0r + z0i) >> 1);
+    data[1] = (dsp_q15)((z0r - z0i) >> 1);
+    data[2U * quarter] = (dsp_q15)(data[2U * quarter] >> 1);
+    data[2U * quarter + 1U] = (dsp_q15)((-(int32_t)data[2U * quarter + 1U]) >> 1);
+  }
+  else
+  {
+    const int32_t x0 = data[0];
+    const int32_t xh = data[1];
+
+    data[0] = (dsp_q15)((x0 + xh) >> 1);
+    data[1] = (dsp_q15)((x0 - xh) >> 1);
+    data[2U * quarter + 1U] = (dsp_q15)dsp_ssat16(-(int32_t)data[2U * quarter + 1U]);
+  }
+
+  /* E and O are kept doubled (no halving) and the result shifted once at the end */
+  for (k = 1U; k < quarter; k++)
+  {
+    dsp_q15 *pk = &data[2U * k];
+    dsp_q15 *pm = &data[2U * (half - k)];
+    const int64_t wr = tw[2U * k * inst->stride];
+    const int64_t wi = tw[2U * k * inst->stride + 1U];
+    const int32_t er = (int32_t)pk[0] + pm[0];
+    const int32_t ei = (int32_t)pk[1] - pm[1];
+    const int32_t or_ = (int32_t)pk[0] - pm[0];
+    const int32_t oi = (int32_t)pk[1] + pm[1];
+
+    if (!inverse)
+    {
+      const int32_t tr = (int32_t)((wr * or_ - wi * oi) >> 15);
+      const int32_t ti = (int32_t)((wr * oi + wi * or_) >> 15);
+
+      pk[0] = (dsp_q15)dsp_ssat16((er + ti) >> shift);
+      pk[1] = (dsp_q15)dsp_ssat16((ei - tr) >> shift);
+      pm[0] = (dsp_q15)dsp_ssat16((er - ti) >> shift);
+      pm[1] = (dsp_q15)dsp_ssat16((-ei - tr) >> shift);
+    }
+    else
+    {
+      const int32_t vr = (int32_t)((wr * or_ + wi * oi) >> 15);
+      const int32_t vi = (int32_t)((wr * oi - wi * or_) >> 15);
+
+      pk[0] = (dsp_q15)dsp_ssat16((er - vi) >> shift);
+      pk[1] = (dsp_q15)dsp_ssat16((ei + vr) >> shift);
+      pm[0] = (dsp_q15)dsp_ssat16((er + vi) >> shift);
+      pm[1] = (dsp_q15)dsp_ssat16((vr - ei) >> shift);
+    }
+  }
+
+  if (inverse)
+  {
+    dsp_cfft_q15(&inst->cfft, data, 1U);
+  }
+}
@@ -0,0 +1,1550 @@
+/* Generated by tools/dsp_fft_tables.py --max 4096 - do not edit */
+#include "dsp_fft_tables.h"
+
+#if DSP_FFT_MAX_N != 4096
+#error "dsp_fft_tables.c was generated for a different DSP_FFT_MAX_N"
+#endif
+
+const float dsp_fft_twiddle_f32[2U * DSP_FFT_TWIDDLES] DSP_FFT_TABLE =
+{
+  1.0f, 0.0f, 0.999998823f, -0.00153398019f, 0.999995294f, -0.00306795676f, 0.999989411f, -0.00460192612f,
+  0.999981175f, -0.00613588465f, 0.999970586f, -0.00766982874f, 0.999957645f, -0.00920375478f, 0.99994235f, -0.0107376592f,
+  0.999924702f, -0.0122715383f, 0.999904701f, -0.0138053885f, 0.999882347f, -0.0153392063f, 0.999857641f, -0.0168729879f,
+  0.999830582f, -0.0184067299f, 0.99980117f, -0.0199404286f, 0.999769405f, -0.0214740803f, 0.999735288f, -0.0230076815f,
+  0.999698819f, -0.0245412285f, 0.999659997f, -0.0260747178f, 0.999618822f, -0.0276081458f, 0.999575296f, -0.0291415088f,
+  0.999529418f, -0.0306748032f, 0.999481187f, -0.0322080254f, 0.999430605f, -0.0337411719f, 0.99937767f, -0.0352742389f,
+  0.999322385f, -0.0368072229f, 0.999264747f, -0.0383401204f, 0.999204759f, -0.0398729276f, 0.999142419f, -0.041405641f,
+  0.999077728f, -0.0429382569f, 0.999010686f, -0.0444707719f, 0.998941293f, -0.0460031821f, 0.99886955f, -0.0475354842f,
+  0.998795456f, -0.0490676743f, 0.998719012f, -0.050599749f, 0.998640218f, -0.0521317047f, 0.998559074f, -0.0536635377f,
+  0.998475581f, -0.0551952443f, 0.998389737f, -0.0567268212f, 0.998301545f, -0.0582582645f, 0.998211003f, -0.0597895707f,
+  0.998118113f, -0.0613207363f, 0.998022874f, -0.0628517576f, 0.997925286f, -0.0643826309f, 0.99782535f, -0.0659133528f,
+  0.997723067f, -0.0674439196f, 0.997618435f, -0.0689743276f, 0.997511456f, -0.0705045734f, 0.99740213f, -0.0720346532f,
+  0.997290457f, -0.0735645636f, 0.997176437f, -0.0750943008f, 0.99706007f, -0.0766238614f, 0.996941358f, -0.0781532416f,
+  0.996820299f, -0.079682438f, 0.996696895f, -0.0812114468f, 0.996571146f, -0.0827402645f, 0.996443051f, -0.0842688876f,
+  0.996312612f, -0.0857973123f, 0.996179829f, -0.0873255352f, 0.996044701f, -0.0888535526f, 0.995907229f, -0.0903813609f,
+  0.995767414f, -0.0919089565f, 0.995625256f, -0.0934363358f, 0.995480755f, -0.0949634953f, 0.995333912f, -0.0964904314f,
+  0.995184727f, -0.0980171403f, 0.995033199f, -0.0995436187f, 0.994879331f, -0.101069863f, 0.994723121f, -0.102595869f,
+  0.994564571f, -0.104121634f, 0.99440368f, -0.105647154f, 0.994240449f, -0.107172425f, 0.994074879f, -0.108697444f,
+  0.99390697f, -0.110222207f, 0.993736722f, -0.111746711f, 0.993564136f, -0.113270952f, 0.993389211f, -0.114794927f,
+  0.993211949f, -0.116318631f, 0.99303235f, -0.117842062f, 0.992850414f, -0.119365215f, 0.992666142f, -0.120888087f,
+  0.992479535f, -0.122410675f, 0.992290591f, -0.123932975f, 0.992099313f, -0.125454983f, 0.9919057f, -0.126976696f,
+  0.991709754f, -0.128498111f, 0.991511473f, -0.130019223f, 0.99131086f, -0.131540029f, 0.991107914f, -0.133060525f,
+  0.990902635f, -0.134580709f, 0.990695025f, -0.136100575f, 0.990485084f, -0.137620122f, 0.990272812f, -0.139139344f,
+  0.99005821f, -0.140658239f, 0.989841278f, -0.142176804f, 0.989622017f, -0.143695033f, 0.989400428f, -0.145212925f,
+  0.98917651f, -0.146730474f, 0.988950265f, -0.148247679f, 0.988721692f, -0.149764535f, 0.988490793f, -0.151281038f,
+  0.988257568f, -0.152797185f, 0.988022017f, -0.154312973f, 0.987784142f, -0.155828398f, 0.987543942f, -0.157343456f,
+  0.987301418f, -0.158858143f, 0.987056571f, -0.160372457f, 0.986809402f, -0.161886394f, 0.98655991f, -0.163399949f,
+  0.986308097f, -0.16491312f, 0.986053963f, -0.166425904f, 0.985797509f, -0.167938295f, 0.985538735f, -0.169450291f,
+  0.985277642f, -0.170961889f, 0.985014231f, -0.172473084f, 0.984748502f, -0.173983873f, 0.984480455f, -0.175494253f,
+  0.984210092f, -0.17700422f, 0.983937413f, -0.178513771f, 0.983662419f, -0.180022901f, 0.98338511f, -0.181531608f,
+  0.983105487f, -0.183039888f, 0.982823551f, -0.184547737f, 0.982539302f, -0.186055152f, 0.982252741f, -0.187562129f,
+  0.981963869f, -0.189068664f, 0.981672686f, -0.190574755f, 0.981379193f, -0.192080397f, 0.981083391f, -0.193585587f,
+  0.98078528f, -0.195090322f, 0.980484862f, -0.196594598f, 0.980182136f, -0.198098411f, 0.979877104f, -0.199601758f,
+  0.979569766f, -0.201104635f, 0.979260123f, -0.202607039f, 0.978948175f, -0.204108966f, 0.978633924f, -0.205610413f,
+  0.978317371f, -0.207111376f, 0.977998515f, -0.208611852f, 0.977677358f, -0.210111837f, 0.9773539f, -0.211611327f,
+  0.977028143f, -0.21311032f, 0.976700086f, -0.214608811f, 0.976369731f, -0.216106797f, 0.976037079f, -0.217604275f,
+  0.97570213f, -0.21910124f, 0.975364885f, -0.22059769f, 0.975025345f, -0.222093621f, 0.974683511f, -0.223589029f,
+  0.974339383f, -0.225083911f, 0.973992962f, -0.226578264f, 0.97364425f, -0.228072083f, 0.973293246f, -0.229565366f,
+  0.972939952f, -0.231058108f, 0.972584369f, -0.232550307f, 0.972226497f, -0.234041959f, 0.971866337f, -0.235533059f,
+  0.971503891f, -0.237023606f, 0.971139158f, -0.238513595f, 0.970772141f, -0.240003022f, 0.970402839f, -0.241491885f,
+  0.970031253f, -0.24298018f, 0.969657385f, -0.244467903f, 0.969281235f, -0.24595505f, 0.968902805f, -0.247441619f,
+  0.968522094f, -0.248927606f, 0.968139105f, -0.250413007f, 0.967753837f, -0.251897818f, 0.967366292f, -0.253382037f,
+  0.966976471f, -0.25486566f, 0.966584374f, -0.256348682f, 0.966190003f, -0.257831102f, 0.965793359f, -0.259312915f,
+  0.965394442f, -0.260794118f, 0.964993253f, -0.262274707f, 0.964589793f, -0.263754679f, 0.964184064f, -0.26523403f,
+  0.963776066f, -0.266712757f, 0.9633658f, -0.268190857f, 0.962953267f, -0.269668326f, 0.962538468f, -0.27114516f,
+  0.962121404f, -0.272621355f, 0.961702077f, -0.27409691f, 0.961280486f, -0.275571819f, 0.960856633f, -0.27704608f,
+  0.960430519f, -0.278519689f, 0.960002146f, -0.279992643f, 0.959571513f, -0.281464938f, 0.959138622f, -0.28293657f,
+  0.958703475f, -0.284407537f, 0.958266071f, -0.285877835f, 0.957826413f, -0.28734746f, 0.957384501f, -0.288816408f,
+  0.956940336f, -0.290284677f, 0.956493919f, -0.291752263f, 0.956045251f, -0.293219163f, 0.955594334f, -0.294685372f,
+  0.955141168f, -0.296150888f, 0.954685755f, -0.297615707f, 0.954228095f, -0.299079826f, 0.95376819f, -0.300543241f,
+  0.95330604f, -0.302005949f, 0.952841648f, -0.303467947f, 0.952375013f, -0.30492923f, 0.951906137f, -0.306389795f,
+  0.951435021f, -0.30784964f, 0.950961666f, -0.30930876f, 0.950486074f, -0.310767153f, 0.950008245f, -0.312224814f,
+  0.949528181f, -0.31368174f, 0.949045882f, -0.315137929f, 0.94856135f, -0.316593376f, 0.948074586f, -0.318048077f,
+  0.947585591f, -0.319502031f, 0.947094366f, -0.320955232f, 0.946600913f, -0.322407679f, 0.946105232f, -0.323859367f,
+  0.945607325f, -0.325310292f, 0.945107193f, -0.326760452f, 0.944604837f, -0.328209844f, 0.944100258f, -0.329658463f,
+  0.943593458f, -0.331106306f, 0.943084437f, -0.33255337f, 0.942573198f, -0.333999651f, 0.94205974f, -0.335445147f,
+  0.941544065f, -0.336889853f, 0.941026175f, -0.338333767f, 0.940506071f, -0.339776884f, 0.939983753f, -0.341219202f,
+  0.939459224f, -0.342660717f, 0.938932484f, -0.344101426f, 0.938403534f, -0.345541325f, 0.937872376f, -0.346980411f,
+  0.937339012f, -0.34841868f, 0.936803442f, -0.34985613f, 0.936265667f, -0.351292756f, 0.935725689f, -0.352728556f,
+  0.93518351f, -0.354163525f, 0.93463913f, -0.355597662f, 0.93409255f, -0.357030961f, 0.933543773f, -0.358463421f,
+  0.932992799f, -0.359895037f, 0.932439629f, -0.361325806f, 0.931884266f, -0.362755724f, 0.931326709f, -0.36418479f,
+  0.930766961f, -0.365612998f, 0.930205023f, -0.367040346f, 0.929640896f, -0.36846683f, 0.929074581f, -0.369892447f,
+  0.92850608f, -0.371317194f, 0.927935395f, -0.372741067f, 0.927362526f, -0.374164063f, 0.926787474f, -0.375586178f,
+  0.926210242f, -0.37700741f, 0.925630831f, -0.378427755f, 0.925049241f, -0.379847209f, 0.924465474f, -0.381265769f,
+  0.923879533f, -0.382683432f, 0.923291417f, -0.384100195f, 0.922701128f, -0.385516054f, 0.922108669f, -0.386931006f,
+  0.921514039f, -0.388345047f, 0.920917242f, -0.389758174f, 0.920318277f, -0.391170384f, 0.919717146f, -0.392581674f,
+  0.919113852f, -0.39399204f, 0.918508394f, -0.395401479f, 0.917900776f, -0.396809987f, 0.917290997f, -0.398217562f,
+  0.91667906f, -0.3996242f, 0.916064966f, -0.401029897f, 0.915448716f, -0.402434651f, 0.914830312f, -0.403838458f,
+  0.914209756f, -0.405241314f, 0.913587048f, -0.406643217f, 0.91296219f, -0.408044163f, 0.912335185f, -0.409444149f,
+  0.911706032f, -0.410843171f, 0.911074734f, -0.412241227f, 0.910441292f, -0.413638312f, 0.909805708f, -0.415034424f,
+  0.909167983f, -0.41642956f, 0.908528119f, -0.417823716f, 0.907886116f, -0.419216888f, 0.907241978f, -0.420609074f,
+  0.906595705f, -0.422000271f, 0.905947298f, -0.423390474f, 0.905296759f, -0.424779681f, 0.904644091f, -0.426167889f,
+  0.903989293f, -0.427555093f, 0.903332368f, -0.428941292f, 0.902673318f, -0.430326481f, 0.902012144f, -0.431710658f,
+  0.901348847f, -0.433093819f, 0.900683429f, -0.434475961f, 0.900015892f, -0.43585708f, 0.899346237f, -0.437237174f,
+  0.898674466f, -0.438616239f, 0.89800058f, -0.439994271f, 0.897324581f, -0.441371269f, 0.89664647f, -0.442747228f,
+  0.89596625f, -0.444122145f, 0.895283921f, -0.445496017f, 0.894599486f, -0.44686884f, 0.893912945f, -0.448240612f,
+  0.893224301f, -0.44961133f, 0.892533555f, -0.450980989f, 0.891840709f, -0.452349587f, 0.891145765f, -0.453717121f,
+  0.890448723f, -0.455083587f, 0.889749586f, -0.456448982f, 0.889048356f, -0.457813304f, 0.888345033f, -0.459176548f,
+  0.88763962f, -0.460538711f, 0.886932119f, -0.461899791f, 0.88622253f, -0.463259784f, 0.885510856f, -0.464618686f,
+  0.884797098f, -0.465976496f, 0.884081259f, -0.467333209f, 0.883363339f, -0.468688822f, 0.88264334f, -0.470043332f,
+  0.881921264f, -0.471396737f, 0.881197113f, -0.472749032f, 0.880470889f, -0.474100215f, 0.879742593f, -0.475450282f,
+  0.879012226f, -0.47679923f, 0.878279792f, -0.478147056f, 0.87754529f, -0.479493758f, 0.876808724f, -0.480839331f,
+  0.876070094f, -0.482183772f, 0.875329403f, -0.483527079f, 0.874586652f, -0.484869248f, 0.873841843f, -0.486210276f,
+  0.873094978f, -0.48755016f, 0.872346059f, -0.488888897f, 0.871595087f, -0.490226483f, 0.870842063f, -0.491562916f,
+  0.870086991f, -0.492898192f, 0.869329871f, -0.494232309f, 0.868570706f, -0.495565262f, 0.867809497f, -0.496897049f,
+  0.867046246f, -0.498227667f, 0.866280954f, -0.499557113f, 0.865513624f, -0.500885383f, 0.864744258f, -0.502212474f,
+  0.863972856f, -0.503538384f, 0.863199422f, -0.504863109f, 0.862423956f, -0.506186645f, 0.861646461f, -0.507508991f,
+  0.860866939f, -0.508830143f, 0.86008539f, -0.510150097f, 0.859301818f, -0.51146885f, 0.858516224f, -0.512786401f,
+  0.85772861f, -0.514102744f, 0.856938977f, -0.515417878f, 0.856147328f, -0.516731799f, 0.855353665f, -0.518044504f,
+  0.854557988f, -0.51935599f, 0.853760301f, -0.520666254f, 0.852960605f, -0.521975293f, 0.852158902f, -0.523283103f,
+  0.851355193f, -0.524589683f, 0.850549481f, -0.525895027f, 0.849741768f, -0.527199135f, 0.848932055f, -0.528502002f,
+  0.848120345f, -0.529803625f, 0.847306639f, -0.531104001f, 0.846490939f, -0.532403128f, 0.845673247f, -0.533701002f,
+  0.844853565f, -0.53499762f, 0.844031895f, -0.536292979f, 0.84320824f, -0.537587076f, 0.8423826f, -0.538879909f,
+  0.841554977f, -0.540171473f, 0.840725375f, -0.541461766f, 0.839893794f, -0.542750785f, 0.839060237f, -0.544038527f,
+  0.838224706f, -0.545324988f, 0.837387202f, -0.546610167f, 0.836547727f, -0.547894059f, 0.835706284f, -0.549176662f,
+  0.834862875f, -0.550457973f, 0.834017501f, -0.551737988f, 0.833170165f, -0.553016706f, 0.832320868f, -0.554294121f,
+  0.831469612f, -0.555570233f, 0.8306164f, -0.556845037f, 0.829761234f, -0.558118531f, 0.828904115f, -0.559390712f,
+  0.828045045f, -0.560661576f, 0.827184027f, -0.561931121f, 0.826321063f, -0.563199344f, 0.825456154f, -0.564466242f,
+  0.824589303f, -0.565731811f, 0.823720511f, -0.566996049f, 0.822849781f, -0.568258953f, 0.821977115f, -0.569520519f,
+  0.821102515f, -0.570780746f, 0.820225983f, -0.572039629f, 0.81934752f, -0.573297167f, 0.81846713f, -0.574553355f,
+  0.817584813f, -0.575808191f, 0.816700573f, -0.577061673f, 0.815814411f, -0.578313796f, 0.814926329f, -0.579564559f,
+  0.81403633f, -0.580813958f, 0.813144415f, -0.58206199f, 0.812250587f, -0.583308653f, 0.811354847f, -0.584553943f,
+  0.810457198f, -0.585797857f, 0.809557642f, -0.587040394f, 0.808656182f, -0.588281548f, 0.807752818f, -0.589521319f,
+  0.806847554f, -0.590759702f, 0.805940391f, -0.591996695f, 0.805031331f, -0.593232295f, 0.804120377f, -0.594466499f,
+  0.803207531f, -0.595699304f, 0.802292796f, -0.596930708f, 0.801376172f, -0.598160707f, 0.800457662f, -0.599389298f,
+  0.799537269f, -0.600616479f, 0.798614995f, -0.601842247f, 0.797690841f, -0.603066599f, 0.79676481f, -0.604289531f,
+  0.795836905f, -0.605511041f, 0.794907126f, -0.606731127f, 0.793975478f, -0.607949785f, 0.79304196f, -0.609167012f,
+  0.792106577f, -0.610382806f, 0.79116933f, -0.611597164f, 0.790230221f, -0.612810082f, 0.789289253f, -0.614021559f,
+  0.788346428f, -0.615231591f, 0.787401747f, -0.616440175f, 0.786455214f, -0.617647308f, 0.78550683f, -0.618852988f,
+  0.784556597f, -0.620057212f, 0.783604519f, -0.621259977f, 0.782650596f, -0.622461279f, 0.781694832f, -0.623661118f,
+  0.780737229f, -0.624859488f, 0.779777788f, -0.626056388f, 0.778816512f, -0.627251815f, 0.777853404f, -0.628445767f,
+  0.776888466f, -0.629638239f, 0.775921699f, -0.63082923f, 0.774953107f, -0.632018736f, 0.773982691f, -0.633206755f,
+  0.773010453f, -0.634393284f, 0.772036397f, -0.63557832f, 0.771060524f, -0.636761861f, 0.770082837f, -0.637943904f,
+  0.769103338f, -0.639124445f, 0.768122029f, -0.640303482f, 0.767138912f, -0.641481013f, 0.76615399f, -0.642657034f,
+  0.765167266f, -0.643831543f, 0.764178741f, -0.645004537f, 0.763188417f, -0.646176013f, 0.762196298f, -0.647345969f,
+  0.761202385f, -0.648514401f, 0.760206682f, -0.649681307f, 0.759209189f, -0.650846685f, 0.75820991f, -0.652010531f,
+  0.757208847f, -0.653172843f, 0.756206001f, -0.654333618f, 0.755201377f, -0.655492853f, 0.754194975f, -0.656650546f,
+  0.753186799f, -0.657806693f, 0.75217685f, -0.658961293f, 0.751165132f, -0.660114342f, 0.750151646f, -0.661265838f,
+  0.749136395f, -0.662415778f, 0.74811938f, -0.663564159f, 0.747100606f, -0.664710978f, 0.746080074f, -0.665856234f,
+  0.745057785f, -0.666999922f, 0.744033744f, -0.668142041f, 0.743007952f, -0.669282588f, 0.741980412f, -0.67042156f,
+  0.740951125f, -0.671558955f, 0.739920095f, -0.672694769f, 0.738887324f, -0.673829f, 0.737852815f, -0.674961646f,
+  0.736816569f, -0.676092704f, 0.735778589f, -0.67722217f, 0.734738878f, -0.678350043f, 0.733697438f, -0.67947632f,
+  0.732654272f, -0.680600998f, 0.731609381f, -0.681724074f, 0.730562769f, -0.682845546f, 0.729514438f, -0.683965412f,
+  0.72846439f, -0.685083668f, 0.727412629f, -0.686200312f, 0.726359155f, -0.687315341f, 0.725303972f, -0.688428753f,
+  0.724247083f, -0.689540545f, 0.723188489f, -0.690650714f, 0.722128194f, -0.691759258f, 0.721066199f, -0.692866175f,
+  0.720002508f, -0.693971461f, 0.718937122f, -0.695075114f, 0.717870045f, -0.696177131f, 0.716801279f, -0.697277511f,
+  0.715730825f, -0.698376249f, 0.714658688f, -0.699473345f, 0.713584869f, -0.700568794f, 0.712509371f, -0.701662595f,
+  0.711432196f, -0.702754744f, 0.710353347f, -0.703845241f, 0.709272826f, -0.70493408f, 0.708190637f, -0.706021261f,
+  0.707106781f, -0.707106781f, 0.706021261f, -0.708190637f, 0.70493408f, -0.709272826f, 0.703845241f, -0.710353347f,
+  0.702754744f, -0.711432196f, 0.701662595f, -0.712509371f, 0.700568794f, -0.713584869f, 0.699473345f, -0.714658688f,
+  0.698376249f, -0.715730825f, 0.697277511f, -0.716801279f, 0.696177131f, -0.717870045f, 0.695075114f, -0.718937122f,
+  0.693971461f, -0.720002508f, 0.692866175f, -0.721066199f, 0.691759258f, -0.722128194f, 0.690650714f, -0.723188489f,
+  0.689540545f, -0.724247083f, 0.688428753f, -0.725303972f, 0.687315341f, -0.726359155f, 0.686200312f, -0.727412629f,
+  0.685083668f, -0.72846439f, 0.683965412f, -0.729514438f, 0.682845546f, -0.730562769f, 0.681724074f, -0.731609381f,
+  0.680600998f, -0.732654272f, 0.67947632f, -0.733697438f, 0.678350043f, -0.734738878f, 0.67722217f, -0.735778589f,
+  0.676092704f, -0.736816569f, 0.674961646f, -0.737852815f, 0.673829f, -0.738887324f, 0.672694769f, -0.739920095f,
+  0.671558955f, -0.740951125f, 0.67042156f, -0.741980412f, 0.669282588f, -0.743007952f, 0.668142041f, -0.744033744f,
+  0.666999922f, -0.745057785f, 0.665856234f, -0.746080074f, 0.664710978f, -0.747100606f, 0.663564159f, -0.74811938f,
+  0.662415778f, -0.749136395f, 0.661265838f, -0.750151646f, 0.660114342f, -0.751165132f, 0.658961293f, -0.75217685f,
+  0.657806693f, -0.753186799f, 0.656650546f, -0.754194975f, 0.655492853f, -0.755201377f, 0.654333618f, -0.756206001f,
+  0.653172843f, -0.757208847f, 0.652010531f, -0.75820991f, 0.650846685f, -0.759209189f, 0.649681307f, -0.760206682f,
+  0.648514401f, -0.761202385f, 0.647345969f, -0.762196298f, 0.646176013f, -0.763188417f, 0.645004537f, -0.764178741f,
+  0.643831543f, -0.765167266f, 0.642657034f, -0.76615399f, 0.641481013f, -0.767138912f, 0.640303482f, -0.768122029f,
+  0.639124445f, -0.769103338f, 0.637943904f, -0.770082837f, 0.636761861f, -0.771060524f, 0.63557832f, -0.772036397f,
+  0.634393284f, -0.773010453f, 0.633206755f, -0.773982691f, 0.632018736f, -0.774953107f, 0.63082923f, -0.775921699f,
+  0.629638239f, -0.776888466f, 0.628445767f, -0.777853404f, 0.627251815f, -0.778816512f, 0.626056388f, -0.779777788f,
+  0.624859488f, -0.780737229f, 0.623661118f, -0.781694832f, 0.622461279f, -0.782650596f, 0.621259977f, -0.783604519f,
+  0.620057212f, -0.784556597f, 0.618852988f, -0.78550683f, 0.617647308f, -0.786455214f, 0.616440175f, -0.787401747f,
+  0.615231591f, -0.788346428f, 0.614021559f, -0.789289253f, 0.612810082f, -0.790230221f, 0.611597164f, -0.79116933f,
+  0.610382806f, -0.792106577f, 0.609167012f, -0.79304196f, 0.607949785f, -0.793975478f, 0.606731127f, -0.794907126f,
+  0.605511041f, -0.795836905f, 0.604289531f, -0.79676481f, 0.603066599f, -0.797690841f, 0.601842247f, -0.798614995f,
+  0.600616479f, -0.799537269f, 0.599389298f, -0.800457662f, 0.598160707f, -0.801376172f, 0.596930708f, -0.802292796f,
+  0.595699304f, -0.803207531f, 0.594466499f, -0.804120377f, 0.593232295f, -0.805031331f, 0.591996695f, -0.805940391f,
+  0.590759702f, -0.806847554f, 0.589521319f, -0.807752818f, 0.588281548f, -0.808656182f, 0.587040394f, -0.809557642f,
+  0.585797857f, -0.810457198f, 0.584553943f, -0.811354847f, 0.583308653f, -0.812250587f, 0.58206199f, -0.813144415f,
+  0.580813958f, -0.81403633f, 0.579564559f, -0.814926329f, 0.578313796f, -0.815814411f, 0.577061673f, -0.816700573f,
+  0.575808191f, -0.817584813f, 0.574553355f, -0.81846713f, 0.573297167f, -0.81934752f, 0.572039629f, -0.820225983f,
+  0.570780746f, -0.821102515f, 0.569520519f, -0.821977115f, 0.568258953f, -0.822849781f, 0.566996049f, -0.823720511f,
+  0.565731811f, -0.824589303f, 0.564466242f, -0.825456154f, 0.563199344f, -0.826321063f, 0.561931121f, -0.827184027f,
+  0.560661576f, -0.828045045f, 0.559390712f, -0.828904115f, 0.558118531f, -0.829761234f, 0.556845037f, -0.8306164f,
+  0.555570233f, -0.831469612f, 0.554294121f, -0.832320868f, 0.553016706f, -0.833170165f, 0.551737988f, -0.834017501f,
+  0.550457973f, -0.834862875f, 0.549176662f, -0.835706284f, 0.547894059f, -0.836547727f, 0.546610167f, -0.837387202f,
+  0.545324988f, -0.838224706f, 0.544038527f, -0.839060237f, 0.542750785f, -0.839893794f, 0.541461766f, -0.840725375f,
+  0.540171473f, -0.841554977f, 0.538879909f, -0.8423826f, 0.537587076f, -0.84320824f, 0.536292979f, -0.844031895f,
+  0.53499762f, -0.844853565f, 0.533701002f, -0.845673247f, 0.532403128f, -0.846490939f, 0.531104001f, -0.847306639f,
+  0.529803625f, -0.848120345f, 0.528502002f, -0.848932055f, 0.527199135f, -0.849741768f, 0.525895027f, -0.850549481f,
+  0.524589683f, -0.851355193f, 0.523283103f, -0.852158902f, 0.521975293f, -0.852960605f, 0.520666254f, -0.853760301f,
+  0.51935599f, -0.854557988f, 0.518044504f, -0.855353665f, 0.516731799f, -0.856147328f, 0.515417878f, -0.856938977f,
+  0.514102744f, -0.85772861f, 0.512786401f, -0.858516224f, 0.51146885f, -0.859301818f, 0.510150097f, -0.86008539f,
+  0.508830143f, -0.860866939f, 0.507508991f, -0.861646461f, 0.506186645f, -0.862423956f, 0.504863109f, -0.863199422f,
+  0.503538384f, -0.863972856f, 0.502212474f, -0.864744258f, 0.500885383f, -0.865513624f, 0.499557113f, -0.866280954f,
+  0.498227667f, -0.867046246f, 0.496897049f, -0.867809497f, 0.495565262f, -0.868570706f, 0.494232309f, -0.869329871f,
+  0.492898192f, -0.870086991f, 0.491562916f, -0.870842063f, 0.490226483f, -0.871595087f, 0.488888897f, -0.872346059f,
+  0.48755016f, -0.873094978f, 0.486210276f, -0.873841843f, 0.484869248f, -0.874586652f, 0.483527079f, -0.875329403f,
+  0.482183772f, -0.876070094f, 0.480839331f, -0.876808724f, 0.479493758f, -0.87754529f, 0.478147056f, -0.878279792f,
+  0.47679923f, -0.879012226f, 0.475450282f, -0.879742593f, 0.474100215f, -0.880470889f, 0.472749032f, -0.881197113f,
+  0.471396737f, -0.881921264f, 0.470043332f, -0.88264334f, 0.468688822f, -0.883363339f, 0.467333209f, -0.884081259f,
+  0.465976496f, -0.884797098f, 0.464618686f, -0.885510856f, 0.463259784f, -0.88622253f, 0.461899791f, -0.886932119f,
+  0.460538711f, -0.88763962f, 0.459176548f, -0.888345033f, 0.457813304f, -0.889048356f, 0.456448982f, -0.889749586f,
+  0.455083587f, -0.890448723f, 0.453717121f, -0.891145765f, 0.452349587f, -0.891840709f, 0.450980989f, -0.892533555f,
+  0.44961133f, -0.893224301f, 0.448240612f, -0.893912945f, 0.44686884f, -0.894599486f, 0.445496017f, -0.895283921f,
+  0.444122145f, -0.89596625f, 0.442747228f, -0.89664647f, 0.441371269f, -0.897324581f, 0.439994271f, -0.89800058f,
+  0.438616239f, -0.898674466f, 0.437237174f, -0.899346237f, 0.43585708f, -0.900015892f, 0.434475961f, -0.900683429f,
+  0.433093819f, -0.901348847f, 0.431710658f, -0.902012144f, 0.430326481f, -0.902673318f, 0.428941292f, -0.903332368f,
+  0.427555093f, -0.903989293f, 0.426167889f, -0.904644091f, 0.424779681f, -0.905296759f, 0.423390474f, -0.905947298f,
+  0.422000271f, -0.906595705f, 0.420609074f, -0.907241978f, 0.419216888f, -0.907886116f, 0.417823716f, -0.908528119f,
+  0.41642956f, -0.909167983f, 0.415034424f, -0.909805708f, 0.413638312f, -0.910441292f, 0.412241227f, -0.911074734f,
+  0.410843171f, -0.911706032f, 0.409444149f, -0.912335185f, 0.408044163f, -0.91296219f, 0.406643217f, -0.913587048f,
+  0.405241314f, -0.914209756f, 0.403838458f, -0.914830312f, 0.402434651f, -0.915448716f, 0.401029897f, -0.916064966f,
+  0.3996242f, -0.91667906f, 0.398217562f, -0.917290997f, 0.396809987f, -0.917900776f, 0.395401479f, -0.918508394f,
+  0.39399204f, -0.919113852f, 0.392581674f, -0.919717146f, 0.391170384f, -0.920318277f, 0.389758174f, -0.920917242f,
+  0.388345047f, -0.921514039f, 0.386931006f, -0.922108669f, 0.385516054f, -0.922701128f, 0.384100195f, -0.923291417f,
+  0.382683432f, -0.923879533f, 0.381265769f, -0.924465474f, 0.379847209f, -0.925049241f, 0.378427755f, -0.925630831f,
+  0.37700741f, -0.926210242f, 0.375586178f, -0.926787474f, 0.374164063f, -0.927362526f, 0.372741067f, -0.927935395f,
+  0.371317194f, -0.92850608f, 0.369892447f, -0.929074581f, 0.36846683f, -0.929640896f, 0.367040346f, -0.930205023f,
+  0.365612998f, -0.930766961f, 0.36418479f, -0.931326709f, 0.362755724f, -0.931884266f, 0.361325806f, -0.932439629f,
+  0.359895037f, -0.932992799f, 0.358463421f, -0.933543773f, 0.357030961f, -0.93409255f, 0.355597662f, -0.93463913f,
+  0.354163525f, -0.93518351f, 0.352728556f, -0.935725689f, 0.351292756f, -0.936265667f, 0.34985613f, -0.936803442f,
+  0.34841868f, -0.937339012f, 0.346980411f, -0.937872376f, 0.345541325f, -0.938403534f, 0.344101426f, -0.938932484f,
+  0.342660717f, -0.939459224f, 0.341219202f, -0.939983753f, 0.339776884f, -0.940506071f, 0.338333767f, -0.941026175f,
+  0.336889853f, -0.941544065f, 0.335445147f, -0.94205974f, 0.333999651f, -0.942573198f, 0.33255337f, -0.943084437f,
+  0.331106306f, -0.943593458f, 0.329658463f, -0.944100258f, 0.328209844f, -0.944604837f, 0.326760452f, -0.945107193f,
+  0.325310292f, -0.945607325f, 0.323859367f, -0.946105232f, 0.322407679f, -0.946600913f, 0.320955232f, -0.947094366f,
+  0.319502031f, -0.947585591f, 0.318048077f, -0.948074586f, 0.316593376f, -0.94856135f, 0.315137929f, -0.949045882f,
+  0.31368174f, -0.949528181f, 0.312224814f, -0.950008245f, 0.310767153f, -0.950486074f, 0.30930876f, -0.950961666f,
+  0.30784964f, -0.951435021f, 0.306389795f, -0.951906137f, 0.30492923f, -0.952375013f, 0.303467947f, -0.952841648f,
+  0.302005949f, -0.95330604f, 0.300543241f, -0.95376819f, 0.299079826f, -0.954228095f, 0.297615707f, -0.954685755f,
+  0.296150888f, -0.955141168f, 0.294685372f, -0.955594334f, 0.293219163f, -0.956045251f, 0.291752263f, -0.956493919f,
+  0.290284677f, -0.956940336f, 0.288816408f, -0.957384501f, 0.28734746f, -0.957826413f, 0.285877835f, -0.958266071f,
+  0.284407537f, -0.958703475f, 0.28293657f, -0.959138622f, 0.281464938f, -0.959571513f, 0.279992643f, -0.960002146f,
+  0.278519689f, -0.960430519f, 0.27704608f, -0.960856633f, 0.275571819f, -0.961280486f, 0.27409691f, -0.961702077f,
+  0.272621355f, -0.962121404f, 0.27114516f, -0.962538468f, 0.269668326f, -0.962953267f, 0.268190857f, -0.9633658f,
+  0.266712757f, -0.963776066f, 0.26523403f, -0.964184064f, 0.263754679f, -0.964589793f, 0.262274707f, -0.964993253f,
+  0.260794118f, -0.965394442f, 0.259312915f, -0.965793359f, 0.257831102f, -0.966190003f, 0.256348682f, -0.966584374f,
+  0.25486566f, -0.966976471f, 0.253382037f, -0.967366292f, 0.251897818f, -0.967753837f, 0.250413007f, -0.968139105f,
+  0.248927606f, -0.968522094f, 0.247441619f, -0.968902805f, 0.24595505f, -0.969281235f, 0.244467903f, -0.969657385f,
+  0.24298018f, -0.970031253f, 0.241491885f, -0.970402839f, 0.240003022f, -0.970772141f, 0.238513595f, -0.971139158f,
+  0.237023606f, -0.971503891f, 0.235533059f, -0.971866337f, 0.234041959f, -0.972226497f, 0.232550307f, -0.972584369f,
+  0.231058108f, -0.972939952f, 0.229565366f, -0.973293246f, 0.228072083f, -0.97364425f, 0.226578264f, -0.973992962f,
+  0.225083911f, -0.974339383f, 0.223589029f, -0.974683511f, 0.222093621f, -0.975025345f, 0.22059769f, -0.975364885f,
+  0.21910124f, -0.97570213f, 0.217604275f, -0.976037079f, 0.216106797f, -0.976369731f, 0.214608811f, -0.976700086f,
+  0.21311032f, -0.977028143f, 0.211611327f, -0.9773539f, 0.210111837f, -0.977677358f, 0.208611852f, -0.977998515f,
+  0.207111376f, -0.978317371f, 0.205610413f, -0.978633924f, 0.204108966f, -0.978948175f, 0.202607039f, -0.979260123f,
+  0.201104635f, -0.979569766f, 0.199601758f, -0.979877104f, 0.198098411f, -0.980182136f, 0.196594598f, -0.980484862f,
+  0.195090322f, -0.98078528f, 0.193585587f, -0.981083391f, 0.192080397f, -0.981379193f, 0.190574755f, -0.981672686f,
+  0.189068664f, -0.981963869f, 0.187562129f, -0.982252741f, 0.186055152f, -0.982539302f, 0.184547737f, -0.982823551f,
+  0.183039888f, -0.983105487f, 0.181531608f, -0.98338511f, 0.180022901f, -0.983662419f, 0.178513771f, -0.983937413f,
+  0.17700422f, -0.984210092f, 0.175494253f, -0.984480455f, 0.173983873f, -0.984748502f, 0.172473084f, -0.985014231f,
+  0.170961889f, -0.985277642f, 0.169450291f, -0.985538735f, 0.167938295f, -0.985797509f, 0.166425904f, -0.986053963f,
+  0.16491312f, -0.986308097f, 0.163399949f, -0.98655991f, 0.161886394f, -0.986809402f, 0.160372457f, -0.987056571f,
+  0.158858143f, -0.987301418f, 0.157343456f, -0.987543942f, 0.155828398f, -0.987784142f, 0.154312973f, -0.988022017f,
+  0.152797185f, -0.988257568f, 0.151281038f, -0.988490793f, 0.149764535f, -0.988721692f, 0.148247679f, -0.988950265f,
+  0.146730474f, -0.98917651f, 0.145212925f, -0.989400428f, 0.143695033f, -0.989622017f, 0.142176804f, -0.989841278f,
+  0.140658239f, -0.99005821f, 0.139139344f, -0.990272812f, 0.137620122f, -0.990485084f, 0.136100575f, -0.990695025f,
+  0.134580709f, -0.990902635f, 0.133060525f, -0.991107914f, 0.131540029f, -0.99131086f, 0.130019223f, -0.991511473f,
+  0.128498111f, -0.991709754f, 0.126976696f, -0.9919057f, 0.125454983f, -0.992099313f, 0.123932975f, -0.992290591f,
+  0.122410675f, -0.992479535f, 0.120888087f, -0.992666142f, 0.119365215f, -0.992850414f, 0.117842062f, -0.99303235f,
+  0.116318631f, -0.993211949f, 0.114794927f, -0.993389211f, 0.113270952f, -0.993564136f, 0.111746711f, -0.993736722f,
+  0.110222207f, -0.99390697f, 0.108697444f, -0.994074879f, 0.107172425f, -0.994240449f, 0.105647154f, -0.99440368f,
+  0.104121634f, -0.994564571f, 0.102595869f, -0.994723121f, 0.101069863f, -0.994879331f, 0.0995436187f, -0.995033199f,
+  0.0980171403f, -0.995184727f, 0.0964904314f, -0.995333912f, 0.0949634953f, -0.995480755f, 0.0934363358f, -0.995625256f,
+  0.0919089565f, -0.995767414f, 0.0903813609f, -0.995907229f, 0.0888535526f, -0.996044701f, 0.0873255352f, -0.996179829f,
+  0.0857973123f, -0.996312612f, 0.0842688876f, -0.996443051f, 0.0827402645f, -0.996571146f, 0.0812114468f, -0.996696895f,
+  0.079682438f, -0.996820299f, 0.0781532416f, -0.996941358f, 0.0766238614f, -0.99706007f, 0.0750943008f, -0.997176437f,
+  0.0735645636f, -0.997290457f, 0.0720346532f, -0.99740213f, 0.0705045734f, -0.997511456f, 0.0689743276f, -0.997618435f,
+  0.0674439196f, -0.997723067f, 0.0659133528f, -0.99782535f, 0.0643826309f, -0.997925286f, 0.0628517576f, -0.998022874f,
+  0.0613207363f, -0.998118113f, 0.0597895707f, -0.998211003f, 0.0582582645f, -0.998301545f, 0.0567268212f, -0.998389737f,
+  0.0551952443f, -0.998475581f, 0.0536635377f, -0.998559074f, 0.0521317047f, -0.998640218f, 0.050599749f, -0.998719012f,
+  0.0490676743f, -0.998795456f, 0.0475354842f, -0.99886955f, 0.0460031821f, -0.998941293f, 0.0444707719f, -0.999010686f,
+  0.0429382569f, -0.999077728f, 0.041405641f, -0.999142419f, 0.0398729276f, -0.999204759f, 0.0383401204f, -0.999264747f,
+  0.0368072229f, -0.999322385f, 0.0352742389f, -0.99937767f, 0.0337411719f, -0.999430605f, 0.0322080254f, -0.999481187f,
+  0.0306748032f, -0.999529418f, 0.0291415088f, -0.999575296f, 0.0276081458f, -0.999618822f, 0.0260747178f, -0.999659997f,
+  0.0245412285f, -0.999698819f, 0.0230076815f, -0.999735288f, 0.0214740803f, -0.999769405f, 0.0199404286f, -0.99980117f,
+  0.0184067299f, -0.999830582f, 0.0168729879f, -0.999857641f, 0.0153392063f, -0.999882347f, 0.0138053885f, -0.999904701f,
+  0.0122715383f, -0.999924702f, 0.0107376592f, -0.99994235f, 0.00920375478f, -0.999957645f, 0.00766982874f, -0.999970586f,
+  0.00613588465f, -0.999981175f, 0.00460192612f, -0.999989411f, 0.00306795676f, -0.999995294f, 0.00153398019f, -0.999998823f,
+  6.123234e-17f, -1.0f, -0.00153398019f, -0.999998823f, -0.00306795676f, -0.999995294f, -0.00460192612f, -0.999989411f,
+  -0.00613588465f, -0.999981175f, -0.00766982874f, -0.999970586f, -0.00920375478f, -0.999957645f, -0.0107376592f, -0.99994235f,
+  -0.0122715383f, -0.999924702f, -0.0138053885f, -0.999904701f, -0.0153392063f, -0.999882347f, -0.0168729879f, -0.999857641f,
+  -0.0184067299f, -0.999830582f, -0.0199404286f, -0.99980117f, -0.0214740803f, -0.999769405f, -0.0230076815f, -0.999735288f,
+  -0.0245412285f, -0.999698819f, -0.0260747178f, -0.999659997f, -0.0276081458f, -0.999618822f, -0.0291415088f, -0.999575296f,
+  -0.0306748032f, -0.999529418f, -0.0322080254f, -0.999481187f, -0.0337411719f, -0.999430605f, -0.0352742389f, -0.99937767f,
+  -0.0368072229f, -0.999322385f, -0.0383401204f, -0.999264747f, -0.0398729276f, -0.999204759f, -0.041405641f, -0.999142419f,
+  -0.0429382569f, -0.999077728f, -0.0444707719f, -0.999010686f, -0.0460031821f, -0.998941293f, -0.0475354842f, -0.99886955f,
+  -0.0490676743f, -0.998795456f, -0.050599749f, -0.998719012f, -0.0521317047f, -0.998640218f, -0.0536635377f, -0.998559074f,
+  -0.0551952443f, -0.998475581f, -0.0567268212f, -0.998389737f, -0.0582582645f, -0.998301545f, -0.0597895707f, -0.998211003f,
+  -0.0613207363f, -0.998118113f, -0.0628517576f, -0.998022874f, -0.0643826309f, -0.997925286f, -0.0659133528f, -0.99782535f,
+  -0.0674439196f, -0.997723067f, -0.0689743276f, -0.997618435f, -0.0705045734f, -0.997511456f, -0.0720346532f, -0.99740213f,
+  -0.0735645636f, -0.997290457f, -0.0750943008f, -0.997176437f, -0.0766238614f, -0.99706007f, -0.0781532416f, -0.996941358f,
+  -0.079682438f, -0.996820299f, -0.0812114468f, -0.996696895f, -0.0827402645f, -0.996571146f, -0.0842688876f, -0.996443051f,
+  -0.0857973123f, -0.996312612f, -0.0873255352f, -0.996179829f, -0.0888535526f, -0.996044701f, -0.0903813609f, -0.995907229f,
+  -0.0919089565f, -0.995767414f, -0.0934363358f, -0.995625256f, -0.0949634953f, -0.995480755f, -0.0964904314f, -0.995333912f,
+  -0.0980171403f, -0.995184727f, -0.0995436187f, -0.995033199f, -0.101069863f, -0.994879331f, -0.102595869f, -0.994723121f,
+  -0.104121634f, -0.994564571f, -0.105647154f, -0.99440368f, -0.107172425f, -0.994240449f, -0.108697444f, -0.994074879f,
+  -0.110222207f, -0.99390697f, -0.111746711f, -0.993736722f, -0.113270952f, -0.993564136f, -0.114794927f, -0.993389211f,
+  -0.116318631f, -0.993211949f, -0.117842062f, -0.99303235f, -0.119365215f, -0.992850414f, -0.120888087f, -0.992666142f,
+  -0.122410675f, -0.992479535f, -0.123932975f, -0.992290591f, -0.125454983f, -0.992099313f, -0.126976696f, -0.9919057f,
+  -0.128498111f, -0.991709754f, -0.130019223f, -0.991511473f, -0.131540029f, -0.99131086f, -0.133060525f, -0.991107914f,
+  -0.134580709f, -0.990902635f, -0.136100575f, -0.990695025f, -0.137620122f, -0.990485084f, -0.139139344f, -0.990272812f,
+  -0.140658239f, -0.99005821f, -0.142176804f, -0.989841278f, -0.143695033f, -0.989622017f, -0.145212925f, -0.989400428f,
+  -0.146730474f, -0.98917651f, -0.148247679f, -0.988950265f, -0.149764535f, -0.988721692f, -0.151281038f, -0.988490793f,
+  -0.152797185f, -0.988257568f, -0.154312973f, -0.988022017f, -0.155828398f, -0.987784142f, -0.157343456f, -0.987543942f,
+  -0.158858143f, -0.987301418f, -0.160372457f, -0.987056571f, -0.161886394f, -0.986809402f, -0.163399949f, -0.98655991f,
+  -0.16491312f, -0.986308097f, -0.166425904f, -0.986053963f, -0.167938295f, -0.985797509f, -0.169450291f, -0.985538735f,
+  -0.170961889f, -0.985277642f, -0.172473084f, -0.985014231f, -0.173983873f, -0.984748502f, -0.175494253f, -0.984480455f,
+  -0.17700422f, -0.984210092f, -0.178513771f, -0.983937413f, -0.180022901f, -0.983662419f, -0.181531608f, -0.98338511f,
+  -0.183039888f, -0.983105487f, -0.184547737f, -0.982823551f, -0.186055152f, -0.982539302f, -0.187562129f, -0.982252741f,
+  -0.189068664f, -0.981963869f, -0.190574755f, -0.981672686f, -0.192080397f, -0.981379193f, -0.193585587f, -0.981083391f,
+  -0.195090322f, -0.98078528f, -0.196594598f, -0.980484862f, -0.198098411f, -0.980182136f, -0.199601758f, -0.979877104f,
+  -0.201104635f, -0.979569766f, -0.202607039f, -0.979260123f, -0.204108966f, -0.978948175f, -0.205610413f, -0.978633924f,
+  -0.207111376f, -0.978317371f, -0.208611852f, -0.977998515f, -0.210111837f, -0.977677358f, -0.211611327f, -0.9773539f,
+  -0.21311032f, -0.977028143f, -0.214608811f, -0.976700086f, -0.216106797f, -0.976369731f, -0.217604275f, -0.976037079f,
+  -0.21910124f, -0.97570213f, -0.22059769f, -0.975364885f, -0.222093621f, -0.975025345f, -0.223589029f, -0.974683511f,
+  -0.225083911f, -0.974339383f, -0.226578264f, -0.973992962f, -0.228072083f, -0.97364425f, -0.229565366f, -0.973293246f,
+  -0.231058108f, -0.972939952f, -0.232550307f, -0.972584369f, -0.234041959f, -0.972226497f, -0.235533059f, -0.971866337f,
+  -0.237023606f, -0.971503891f, -0.238513595f, -0.971139158f, -0.240003022f, -0.970772141f, -0.241491885f, -0.970402839f,
+  -0.24298018f, -0.970031253f, -0.244467903f, -0.969657385f, -0.24595505f, -0.969281235f, -0.247441619f, -0.968902805f,
+  -0.248927606f, -0.968522094f, -0.250413007f, -0.968139105f, -0.251897818f, -0.967753837f, -0.253382037f, -0.967366292f,
+  -0.25486566f, -0.966976471f, -0.256348682f, -0.966584374f, -0.257831102f, -0.966190003f, -0.259312915f, -0.965793359f,
+  -0.260794118f, -0.965394442f, -0.262274707f, -0.964993253f, -0.263754679f, -0.964589793f, -0.26523403f, -0.964184064f,
+  -0.266712757f, -0.963776066f, -0.268190857f, -0.9633658f, -0.269668326f, -0.962953267f, -0.27114516f, -0.962538468f,
+  -0.272621355f, -0.962121404f, -0.27409691f, -0.961702077f, -0.275571819f, -0.961280486f, -0.27704608f, -0.960856633f,
+  -0.278519689f, -0.960430519f, -0.279992643f, -0.960002146f, -0.281464938f, -0.959571513f, -0.28293657f, -0.959138622f,
+  -0.284407537f, -0.958703475f, -0.285877835f, -0.958266071f, -0.28734746f, -0.957826413f, -0.288816408f, -0.957384501f,
+  -0.290284677f, -0.956940336f, -0.291752263f, -0.956493919f, -0.293219163f, -0.956045251f, -0.294685372f, -0.955594334f,
+  -0.296150888f, -0.955141168f, -0.297615707f, -0.954685755f, -0.299079826f, -0.954228095f, -0.300543241f, -0.95376819f,
+  -0.302005949f, -0.95330604f, -0.303467947f, -0.952841648f, -0.30492923f, -0.952375013f, -0.306389795f, -0.951906137f,
+  -0.30784964f, -0.951435021f, -0.30930876f, -0.950961666f, -0.310767153f, -0.950486074f, -0.312224814f, -0.950008245f,
+  -0.31368174f, -0.949528181f, -0.315137929f, -0.949045882f, -0.316593376f, -0.94856135f, -0.318048077f, -0.948074586f,
+  -0.319502031f, -0.947585591f, -0.320955232f, -0.947094366f, -0.322407679f, -0.946600913f, -0.323859367f, -0.946105232f,
+  -0.325310292f, -0.945607325f, -0.326760452f, -0.945107193f, -0.328209844f, -0.944604837f, -0.329658463f, -0.944100258f,
+  -0.331106306f, -0.943593458f, -0.33255337f, -0.943084437f, -0.333999651f, -0.942573198f, -0.335445147f, -0.94205974f,
+  -0.336889853f, -0.941544065f, -0.338333767f, -0.941026175f, -0.339776884f, -0.940506071f, -0.341219202f, -0.939983753f,
+  -0.342660717f, -0.939459224f, -0.344101426f, -0.938932484f, -0.345541325f, -0.938403534f, -0.346980411f, -0.937872376f,
+  -0.34841868f, -0.937339012f, -0.34985613f, -0.936803442f, -0.351292756f, -0.936265667f, -0.352728556f, -0.935725689f,
+  -0.354163525f, -0.93518351f, -0.355597662f, -0.93463913f, -0.357030961f, -0.93409255f, -0.358463421f, -0.933543773f,
+  -0.359895037f, -0.932992799f, -0.361325806f, -0.932439629f, -0.362755724f, -0.931884266f, -0.36418479f, -0.931326709f,
+  -0.365612998f, -0.930766961f, -0.367040346f, -0.930205023f, -0.36846683f, -0.929640896f, -0.369892447f, -0.929074581f,
+  -0.371317194f, -0.92850608f, -0.372741067f, -0.927935395f, -0.374164063f, -0.927362526f, -0.375586178f, -0.926787474f,
+  -0.37700741f, -0.926210242f, -0.378427755f, -0.925630831f, -0.379847209f, -0.925049241f, -0.381265769f, -0.924465474f,
+  -0.382683432f, -0.923879533f, -0.384100195f, -0.923291417f, -0.385516054f, -0.922701128f, -0.386931006f, -0.922108669f,
+  -0.388345047f, -0.921514039f, -0.389758174f, -0.920917242f, -0.391170384f, -0.920318277f, -0.392581674f, -0.919717146f,
+  -0.39399204f, -0.919113852f, -0.395401479f, -0.918508394f, -0.396809987f, -0.917900776f, -0.398217562f, -0.917290997f,
+  -0.3996242f, -0.91667906f, -0.401029897f, -0.916064966f, -0.402434651f, -0.915448716f, -0.403838458f, -0.914830312f,
+  -0.405241314f, -0.914209756f, -0.406643217f, -0.913587048f, -0.408044163f, -0.91296219f, -0.409444149f, -0.912335185f,
+  -0.410843171f, -0.911706032f, -0.412241227f, -0.911074734f, -0.413638312f, -0.910441292f, -0.415034424f, -0.909805708f,
+  -0.41642956f, -0.909167983f, -0.417823716f, -0.908528119f, -0.419216888f, -0.907886116f, -0.420609074f, -0.907241978f,
+  -0.422000271f, -0.906595705f, -0.423390474f, -0.905947298f, -0.424779681f, -0.905296759f, -0.426167889f, -0.904644091f,
+  -0.427555093f, -0.903989293f, -0.428941292f, -0.903332368f, -0.430326481f, -0.902673318f, -0.431710658f, -0.902012144f,
+  -0.433093819f, -0.901348847f, -0.434475961f, -0.900683429f, -0.43585708f, -0.900015892f, -0.437237174f, -0.899346237f,
+  -0.438616239f, -0.898674466f, -0.439994271f, -0.89800058f, -0.441371269f, -0.897324581f, -0.442747228f, -0.89664647f,
+  -0.444122145f, -0.89596625f, -0.445496017f, -0.895283921f, -0.44686884f, -0.894599486f, -0.448240612f, -0.893912945f,
+  -0.44961133f, -0.893224301f, -0.450980989f, -0.892533555f, -0.452349587f, -0.891840709f, -0.453717121f, -0.891145765f,
+  -0.455083587f, -0.890448723f, -0.456448982f, -0.889749586f, -0.457813304f, -0.889048356f, -0.459176548f, -0.888345033f,
+  -0.460538711f, -0.88763962f, -0.461899791f, -0.886932119f, -0.463259784f, -0.88622253f, -0.464618686f, -0.885510856f,
+  -0.465976496f, -0.884797098f, -0.467333209f, -0.884081259f, -0.468688822f, -0.883363339f, -0.470043332f, -0.88264334f,
+  -0.471396737f, -0.881921264f, -0.472749032f, -0.881197113f, -0.474100215f, -0.880470889f, -0.475450282f, -0.879742593f,
+  -0.47679923f, -0.879012226f, -0.478147056f, -0.878279792f, -0.479493758f, -0.87754529f, -0.480839331f, -0.876808724f,
+  -0.482183772f, -0.876070094f, -0.483527079f, -0.875329403f, -0.484869248f, -0.874586652f, -0.486210276f, -0.873841843f,
+  -0.48755016f, -0.873094978f, -0.488888897f, -0.872346059f, -0.490226483f, -0.871595087f, -0.491562916f, -0.870842063f,
+  -0.492898192f, -0.870086991f, -0.494232309f, -0.869329871f, -0.495565262f, -0.868570706f, -0.496897049f, -0.867809497f,
+  -0.498227667f, -0.867046246f, -0.499557113f, -0.866280954f, -0.500885383f, -0.865513624f, -0.502212474f, -0.864744258f,
+  -0.503538384f, -0.863972856f, -0.504863109f, -0.863199422f, -0.506186645f, -0.862423956f, -0.507508991f, -0.861646461f,
+  -0.508830143f, -0.860866939f, -0.510150097f, -0.86008539f, -0.51146885f, -0.859301818f, -0.512786401f, -0.858516224f,
+  -0.514102744f, -0.85772861f, -0.515417878f, -0.856938977f, -0.516731799f, -0.856147328f, -0.518044504f, -0.855353665f,
+  -0.51935599f, -0.854557988f, -0.520666254f, -0.853760301f, -0.521975293f, -0.852960605f, -0.523283103f, -0.852158902f,
+  -0.524589683f, -0.851355193f, -0.525895027f, -0.850549481f, -0.527199135f, -0.849741768f, -0.528502002f, -0.848932055f,
+  -0.529803625f, -0.848120345f, -0.531104001f, -0.847306639f, -0.532403128f, -0.846490939f, -0.533701002f, -0.845673247f,
+  -0.53499762f, -0.844853565f, -0.536292979f, -0.844031895f, -0.537587076f, -0.84320824f, -0.538879909f, -0.8423826f,
+  -0.540171473f, -0.841554977f, -0.541461766f, -0.840725375f, -0.542750785f, -0.839893794f, -0.544038527f, -0.839060237f,
+  -0.545324988f, -0.838224706f, -0.546610167f, -0.837387202f, -0.547894059f, -0.836547727f, -0.549176662f, -0.835706284f,
+  -0.550457973f, -0.834862875f, -0.551737988f, -0.834017501f, -0.553016706f, -0.833170165f, -0.554294121f, -0.832320868f,
+  -0.555570233f, -0.831469612f, -0.556845037f, -0.8306164f, -0.558118531f, -0.829761234f, -0.559390712f, -0.828904115f,
+  -0.560661576f, -0.828045045f, -0.561931121f, -0.827184027f, -0.563199344f, -0.826321063f, -0.564466242f, -0.825456154f,
+  -0.565731811f, -0.824589303f, -0.566996049f, -0.823720511f, -0.568258953f, -0.822849781f, -0.569520519f, -0.821977115f,
+  -0.570780746f, -0.821102515f, -0.572039629f, -0.820225983f, -0.573297167f, -0.81934752f, -0.574553355f, -0.81846713f,
+  -0.575808191f, -0.817584813f, -0.577061673f, -0.816700573f, -0.578313796f, -0.815814411f, -0.579564559f, -0.814926329f,
+  -0.580813958f, -0.81403633f, -0.58206199f, -0.813144415f, -0.583308653f, -0.812250587f, -0.584553943f, -0.811354847f,
+  -0.585797857f, -0.810457198f, -0.587040394f, -0.809557642f, -0.588281548f, -0.808656182f, -0.589521319f, -0.807752818f,
+  -0.590759702f, -0.806847554f, -0.591996695f, -0.805940391f, -0.593232295f, -0.805031331f, -0.594466499f, -0.804120377f,
+  -0.595699304f, -0.803207531f, -0.596930708f, -0.802292796f, -0.598160707f, -0.801376172f, -0.599389298f, -0.800457662f,
+  -0.600616479f, -0.799537269f, -0.601842247f, -0.798614995f, -0.603066599f, -0.797690841f, -0.604289531f, -0.79676481f,
+  -0.605511041f, -0.795836905f, -0.606731127f, -0.794907126f, -0.607949785f, -0.793975478f, -0.609167012f, -0.79304196f,
+  -0.610382806f, -0.792106577f, -0.611597164f, -0.79116933f, -0.612810082f, -0.790230221f, -0.614021559f, -0.789289253f,
+  -0.615231591f, -0.788346428f, -0.616440175f, -0.787401747f, -0.617647308f, -0.786455214f, -0.618852988f, -0.78550683f,
+  -0.620057212f, -0.784556597f, -0.621259977f, -0.783604519f, -0.622461279f, -0.782650596f, -0.623661118f, -0.781694832f,
+  -0.624859488f, -0.780737229f, -0.626056388f, -0.779777788f, -0.627251815f, -0.778816512f, -0.628445767f, -0.777853404f,
+  -0.629638239f, -0.776888466f, -0.63082923f, -0.775921699f, -0.632018736f, -0.774953107f, -0.633206755f, -0.773982691f,
+  -0.634393284f, -0.773010453f, -0.63557832f, -0.772036397f, -0.636761861f, -0.771060524f, -0.637943904f, -0.770082837f,
+  -0.639124445f, -0.769103338f, -0.640303482f, -0.768122029f, -0.641481013f, -0.767138912f, -0.642657034f, -0.76615399f,
+  -0.643831543f, -0.765167266f, -0.645004537f, -0.764178741f, -0.646176013f, -0.763188417f, -0.647345969f, -0.762196298f,
+  -0.648514401f, -0.761202385f, -0.649681307f, -0.760206682f, -0.650846685f, -0.759209189f, -0.652010531f, -0.75820991f,
+  -0.653172843f, -0.757208847f, -0.654333618f, -0.756206001f, -0.655492853f, -0.755201377f, -0.656650546f, -0.754194975f,
+  -0.657806693f, -0.753186799f, -0.658961293f, -0.75217685f, -0.660114342f, -0.751165132f, -0.661265838f, -0.750151646f,
+  -0.662415778f, -0.749136395f, -0.663564159f, -0.74811938f, -0.664710978f, -0.747100606f, -0.665856234f, -0.746080074f,
+  -0.666999922f, -0.745057785f, -0.668142041f, -0.744033744f, -0.669282588f, -0.743007952f, -0.67042156f, -0.741980412f,
+  -0.671558955f, -0.740951125f, -0.672694769f, -0.739920095f, -0.673829f, -0.738887324f, -0.674961646f, -0.737852815f,
+  -0.676092704f, -0.736816569f, -0.67722217f, -0.735778589f, -0.678350043f, -0.734738878f, -0.67947632f, -0.733697438f,
+  -0.680600998f, -0.732654272f, -0.681724074f, -0.731609381f, -0.682845546f, -0.730562769f, -0.683965412f, -0.729514438f,
+  -0.685083668f, -0.72846439f, -0.686200312f, -0.727412629f, -0.687315341f, -0.726359155f, -0.688428753f, -0.725303972f,
+  -0.689540545f, -0.724247083f, -0.690650714f, -0.723188489f, -0.691759258f, -0.722128194f, -0.692866175f, -0.721066199f,
+  -0.693971461f, -0.720002508f, -0.695075114f, -0.718937122f, -0.696177131f, -0.717870045f, -0.697277511f, -0.716801279f,
+  -0.698376249f, -0.715730825f, -0.699473345f, -0.714658688f, -0.700568794f, -0.713584869f, -0.701662595f, -0.712509371f,
+  -0.702754744f, -0.711432196f, -0.703845241f, -0.710353347f, -0.70493408f, -0.709272826f, -0.706021261f, -0.708190637f,
+  -0.707106781f, -0.707106781f, -0.708190637f, -0.706021261f, -0.709272826f, -0.70493408f, -0.710353347f, -0.703845241f,
+  -0.711432196f, -0.702754744f, -0.712509371f, -0.701662595f, -0.713584869f, -0.700568794f, -0.714658688f, -0.699473345f,
+  -0.715730825f, -0.698376249f, -0.716801279f, -0.697277511f, -0.717870045f, -0.696177131f, -0.718937122f, -0.695075114f,
+  -0.720002508f, -0.693971461f, -0.721066199f, -0.692866175f, -0.722128194f, -0.691759258f, -0.723188489f, -0.690650714f,
+  -0.724247083f, -0.689540545f, -0.725303972f, -0.688428753f, -0.726359155f, -0.687315341f, -0.727412629f, -0.686200312f,
+  -0.72846439f, -0.685083668f, -0.729514438f, -0.683965412f, -0.730562769f, -0.682845546f, -0.731609381f, -0.681724074f,
+  -0.732654272f, -0.680600998f, -0.733697438f, -0.67947632f, -0.734738878f, -0.678350043f, -0.735778589f, -0.67722217f,
+  -0.736816569f, -0.676092704f, -0.737852815f, -0.674961646f, -0.738887324f, -0.673829f, -0.739920095f, -0.672694769f,
+  -0.740951125f, -0.671558955f, -0.741980412f, -0.67042156f, -0.743007952f, -0.669282588f, -0.744033744f, -0.668142041f,
+  -0.745057785f, -0.666999922f, -0.746080074f, -0.665856234f, -0.747100606f, -0.664710978f, -0.74811938f, -0.663564159f,
+  -0.749136395f, -0.662415778f, -0.750151646f, -0.661265838f, -0.751165132f, -0.660114342f, -0.75217685f, -0.658961293f,
+  -0.753186799f, -0.657806693f, -0.754194975f, -0.656650546f, -0.755201377f, -0.655492853f, -0.756206001f, -0.654333618f,
+  -0.757208847f, -0.653172843f, -0.75820991f, -0.652010531f, -0.759209189f, -0.650846685f, -0.760206682f, -0.649681307f,
+  -0.761202385f, -0.648514401f, -0.762196298f, -0.647345969f, -0.763188417f, -0.646176013f, -0.764178741f, -0.645004537f,
+  -0.765167266f, -0.643831543f, -0.76615399f, -0.642657034f, -0.767138912f, -0.641481013f, -0.768122029f, -0.640303482f,
+  -0.769103338f, -0.639124445f, -0.770082837f, -0.637943904f, -0.771060524f, -0.636761861f, -0.772036397f, -0.63557832f,
+  -0.773010453f, -0.634393284f, -0.773982691f, -0.633206755f, -0.774953107f, -0.632018736f, -0.775921699f, -0.63082923f,
+  -0.776888466f, -0.629638239f, -0.777853404f, -0.628445767f, -0.778816512f, -0.627251815f, -0.779777788f, -0.626056388f,
+  -0.780737229f, -0.624859488f, -0.781694832f, -0.623661118f, -0.782650596f, -0.622461279f, -0.783604519f, -0.621259977f,
+  -0.784556597f, -0.620057212f, -0.78550683f, -0.618852988f, -0.786455214f, -0.617647308f, -0.787401747f, -0.616440175f,
+  -0.788346428f, -0.615231591f, -0.789289253f, -0.614021559f, -0.790230221f, -0.612810082f, -0.79116933f, -0.611597164f,
+  -0.792106577f, -0.610382806f, -0.79304196f, -0.609167012f, -0.793975478f, -0.607949785f, -0.794907126f, -0.606731127f,
+  -0.795836905f, -0.605511041f, -0.79676481f, -0.604289531f, -0.797690841f, -0.603066599f, -0.798614995f, -0.601842247f,
+  -0.799537269f, -0.600616479f, -0.800457662f, -0.599389298f, -0.801376172f, -0.598160707f, -0.802292796f, -0.596930708f,
+  -0.803207531f, -0.595699304f, -0.804120377f, -0.594466499f, -0.805031331f, -0.593232295f, -0.805940391f, -0.591996695f,
+  -0.806847554f, -0.590759702f, -0.807752818f, -0.589521319f, -0.808656182f, -0.588281548f, -0.809557642f, -0.587040394f,
+  -0.810457198f, -0.585797857f, -0.811354847f, -0.584553943f, -0.812250587f, -0.583308653f, -0.813144415f, -0.58206199f,
+  -0.81403633f, -0.580813958f, -0.814926329f, -0.579564559f, -0.815814411f, -0.578313796f, -0.816700573f, -0.577061673f,
+  -0.817584813f, -0.575808191f, -0.81846713f, -0.574553355f, -0.81934752f, -0.573297167f, -0.820225983f, -0.572039629f,
+  -0.821102515f, -0.570780746f, -0.821977115f, -0.569520519f, -0.822849781f, -0.568258953f, -0.823720511f, -0.566996049f,
+  -0.824589303f, -0.565731811f, -0.825456154f, -0.564466242f, -0.826321063f, -0.563199344f, -0.827184027f, -0.561931121f,
+  -0.828045045f, -0.560661576f, -0.828904115f, -0.559390712f, -0.829761234f, -0.558118531f, -0.8306164f, -0.556845037f,
+  -0.831469612f, -0.555570233f, -0.832320868f, -0.554294121f, -0.833170165f, -0.553016706f, -0.834017501f, -0.551737988f,
+  -0.834862875f, -0.550457973f, -0.835706284f, -0.549176662f, -0.836547727f, -0.547894059f, -0.837387202f, -0.546610167f,
+  -0.838224706f, -0.545324988f, -0.839060237f, -0.544038527f, -0.839893794f, -0.542750785f, -0.840725375f, -0.541461766f,
+  -0.841554977f, -0.540171473f, -0.8423826f, -0.538879909f, -0.84320824f, -0.537587076f, -0.844031895f, -0.536292979f,
+  -0.844853565f, -0.53499762f, -0.845673247f, -0.533701002f, -0.846490939f, -0.532403128f, -0.847306639f, -0.531104001f,
+  -0.848120345f, -0.529803625f, -0.848932055f, -0.528502002f, -0.849741768f, -0.527199135f, -0.850549481f, -0.525895027f,
+  -0.851355193f, -0.524589683f, -0.852158902f, -0.523283103f, -0.852960605f, -0.521975293f, -0.853760301f, -0.520666254f,
+  -0.854557988f, -0.51935599f, -0.855353665f, -0.518044504f, -0.856147328f, -0.516731799f, -0.856938977f, -0.515417878f,
+  -0.85772861f, -0.514102744f, -0.858516224f, -0.512786401f, -0.859301818f, -0.51146885f, -0.86008539f, -0.510150097f,
+  -0.860866939f, -0.508830143f, -0.861646461f, -0.507508991f, -0.862423956f, -0.506186645f, -0.863199422f, -0.504863109f,
+  -0.863972856f, -0.503538384f, -0.864744258f, -0.502212474f, -0.865513624f, -0.500885383f, -0.866280954f, -0.499557113f,
+  -0.867046246f, -0.498227667f, -0.867809497f, -0.496897049f, -0.868570706f, -0.495565262f, -0.869329871f, -0.494232309f,
+  -0.870086991f, -0.492898192f, -0.870842063f, -0.491562916f, -0.871595087f, -0.490226483f, -0.872346059f, -0.488888897f,
+  -0.873094978f, -0.48755016f, -0.873841843f, -0.486210276f, -0.874586652f, -0.484869248f, -0.875329403f, -0.483527079f,
+  -0.876070094f, -0.482183772f, -0.876808724f, -0.480839331f, -0.87754529f, -0.479493758f, -0.878279792f, -0.478147056f,
+  -0.879012226f, -0.47679923f, -0.879742593f, -0.475450282f, -0.880470889f, -0.474100215f, -0.881197113f, -0.472749032f,
+  -0.881921264f, -0.471396737f, -0.88264334f, -0.470043332f, -0.883363339f, -0.468688822f, -0.884081259f, -0.467333209f,
+  -0.884797098f, -0.465976496f, -0.885510856f, -0.464618686f, -0.88622253f, -0.463259784f, -0.886932119f, -0.461899791f,
+  -0.88763962f, -0.460538711f, -0.888345033f, -0.459176548f, -0.889048356f, -0.457813304f, -0.889749586f, -0.456448982f,
+  -0.890448723f, -0.455083587f, -0.891145765f, -0.453717121f, -0.891840709f, -0.452349587f, -0.892533555f, -0.450980989f,
+  -0.893224301f, -0.44961133f, -0.893912945f, -0.448240612f, -0.894599486f, -0.44686884f, -0.895283921f, -0.445496017f,
+  -0.89596625f, -0.444122145f, -0.89664647f, -0.442747228f, -0.897324581f, -0.441371269f, -0.89800058f, -0.439994271f,
+  -0.898674466f, -0.438616239f, -0.899346237f, -0.437237174f, -0.900015892f, -0.43585708f, -0.900683429f, -0.434475961f,
+  -0.901348847f, -0.433093819f, -0.902012144f, -0.431710658f, -0.902673318f, -0.430326481f, -0.903332368f, -0.428941292f,
+  -0.903989293f, -0.427555093f, -0.904644091f, -0.426167889f, -0.905296759f, -0.424779681f, -0.905947298f, -0.423390474f,
+  -0.906595705f, -0.422000271f, -0.907241978f, -0.420609074f, -0.907886116f, -0.419216888f, -0.908528119f, -0.417823716f,
+  -0.909167983f, -0.41642956f, -0.909805708f, -0.415034424f, -0.910441292f, -0.413638312f, -0.911074734f, -0.412241227f,
+  -0.911706032f, -0.410843171f, -0.912335185f, -0.409444149f, -0.91296219f, -0.408044163f, -0.913587048f, -0.406643217f,
+  -0.914209756f, -0.405241314f, -0.914830312f, -0.403838458f, -0.915448716f, -0.402434651f, -0.916064966f, -0.401029897f,
+  -0.91667906f, -0.3996242f, -0.917290997f, -0.398217562f, -0.917900776f, -0.396809987f, -0.918508394f, -0.395401479f,
+  -0.919113852f, -0.39399204f, -0.919717146f, -0.392581674f, -0.920318277f, -0.391170384f, -0.920917242f, -0.389758174f,
+  -0.921514039f, -0.388345047f, -0.922108669f, -0.386931006f, -0.922701128f, -0.385516054f, -0.923291417f, -0.384100195f,
+  -0.923879533f, -0.382683432f, -0.924465474f, -0.381265769f, -0.925049241f, -0.379847209f, -0.925630831f, -0.378427755f,
+  -0.926210242f, -0.37700741f, -0.926787474f, -0.375586178f, -0.927362526f, -0.374164063f, -0.927935395f, -0.372741067f,
+  -0.92850608f, -0.371317194f, -0.929074581f, -0.369892447f, -0.929640896f, -0.36846683f, -0.930205023f, -0.367040346f,
+  -0.930766961f, -0.365612998f, -0.931326709f, -0.36418479f, -0.931884266f, -0.362755724f, -0.932439629f, -0.361325806f,
+  -0.932992799f, -0.359895037f, -0.933543773f, -0.358463421f, -0.93409255f, -0.357030961f, -0.93463913f, -0.355597662f,
+  -0.93518351f, -0.354163525f, -0.935725689f, -0.352728556f, -0.936265667f, -0.351292756f, -0.936803442f, -0.34985613f,
+  -0.937339012f, -0.34841868f, -0.937872376f, -0.346980411f, -0.938403534f, -0.345541325f, -0.938932484f, -0.344101426f,
+  -0.939459224f, -0.342660717f, -0.939983753f, -0.341219202f, -0.940506071f, -0.339776884f, -0.941026175f, -0.338333767f,
+  -0.941544065f, -0.336889853f, -0.94205974f, -0.335445147f, -0.942573198f, -0.333999651f, -0.943084437f, -0.33255337f,
+  -0.943593458f, -0.331106306f, -0.944100258f, -0.329658463f, -0.944604837f, -0.328209844f, -0.945107193f, -0.326760452f,
+  -0.945607325f, -0.325310292f, -0.946105232f, -0.323859367f, -0.946600913f, -0.322407679f, -0.947094366f, -0.320955232f,
+  -0.947585591f, -0.319502031f, -0.948074586f, -0.318048077f, -0.94856135f, -0.316593376f, -0.949045882f, -0.315137929f,
+  -0.949528181f, -0.31368174f, -0.950008245f, -0.312224814f, -0.950486074f, -0.310767153f, -0.950961666f, -0.30930876f,
+  -0.951435021f, -0.30784964f, -0.951906137f, -0.306389795f, -0.952375013f, -0.30492923f, -0.952841648f, -0.303467947f,
+  -0.95330604f, -0.302005949f, -0.95376819f, -0.300543241f, -0.954228095f, -0.299079826f, -0.954685755f, -0.297615707f,
+  -0.955141168f, -0.296150888f, -0.955594334f, -0.294685372f, -0.956045251f, -0.293219163f, -0.956493919f, -0.291752263f,
+  -0.956940336f, -0.290284677f, -0.957384501f, -0.288816408f, -0.957826413f, -0.28734746f, -0.958266071f, -0.285877835f,
+  -0.958703475f, -0.284407537f, -0.959138622f, -0.28293657f, -0.959571513f, -0.281464938f, -0.960002146f, -0.279992643f,
+  -0.960430519f, -0.278519689f, -0.960856633f, -0.27704608f, -0.961280486f, -0.275571819f, -0.961702077f, -0.27409691f,
+  -0.962121404f, -0.272621355f, -0.962538468f, -0.27114516f, -0.962953267f, -0.269668326f, -0.9633658f, -0.268190857f,
+  -0.963776066f, -0.266712757f, -0.964184064f, -0.26523403f, -0.964589793f, -0.263754679f, -0.964993253f, -0.262274707f,
+  -0.965394442f, -0.260794118f, -0.965793359f, -0.259312915f, -0.966190003f, -0.257831102f, -0.966584374f, -0.256348682f,
+  -0.966976471f, -0.25486566f, -0.967366292f, -0.253382037f, -0.967753837f, -0.251897818f, -0.968139105f, -0.250413007f,
+  -0.968522094f, -0.248927606f, -0.968902805f, -0.247441619f, -0.969281235f, -0.24595505f, -0.969657385f, -0.244467903f,
+  -0.970031253f, -0.24298018f, -0.970402839f, -0.241491885f, -0.970772141f, -0.240003022f, -0.971139158f, -0.238513595f,
+  -0.971503891f, -0.237023606f, -0.971866337f, -0.235533059f, -0.972226497f, -0.234041959f, -0.972584369f, -0.232550307f,
+  -0.972939952f, -0.231058108f, -0.973293246f, -0.229565366f, -0.97364425f, -0.228072083f, -0.973992962f, -0.226578264f,
+  -0.974339383f, -0.225083911f, -0.974683511f, -0.223589029f, -0.975025345f, -0.222093621f, -0.975364885f, -0.22059769f,
+  -0.97570213f, -0.21910124f, -0.976037079f, -0.217604275f, -0.976369731f, -0.216106797f, -0.976700086f, -0.214608811f,
+  -0.977028143f, -0.21311032f, -0.9773539f, -0.211611327f, -0.977677358f, -0.210111837f, -0.977998515f, -0.208611852f,
+  -0.978317371f, -0.207111376f, -0.978633924f, -0.205610413f, -0.978948175f, -0.204108966f, -0.979260123f, -0.202607039f,
+  -0.979569766f, -0.201104635f, -0.979877104f, -0.199601758f, -0.980182136f, -0.198098411f, -0.980484862f, -0.196594598f,
+  -0.98078528f, -0.195090322f, -0.981083391f, -0.193585587f, -0.981379193f, -0.192080397f, -0.981672686f, -0.190574755f,
+  -0.981963869f, -0.189068664f, -0.982252741f, -0.187562129f, -0.982539302f, -0.186055152f, -0.982823551f, -0.184547737f,
+  -0.983105487f, -0.183039888f, -0.98338511f, -0.181531608f, -0.983662419f, -0.180022901f, -0.983937413f, -0.178513771f,
+  -0.984210092f, -0.17700422f, -0.984480455f, -0.175494253f, -0.984748502f, -0.173983873f, -0.985014231f, -0.172473084f,
+  -0.985277642f, -0.170961889f, -0.985538735f, -0.169450291f, -0.985797509f, -0.167938295f, -0.986053963f, -0.166425904f,
+  -0.986308097f, -0.16491312f, -0.98655991f, -0.163399949f, -0.986809402f, -0.161886394f, -0.987056571f, -0.160372457f,
+  -0.987301418f, -0.158858143f, -0.987543942f, -0.157343456f, -0.987784142f, -0.155828398f, -0.988022017f, -0.154312973f,
+  -0.988257568f, -0.152797185f, -0.988490793f, -0.151281038f, -0.988721692f, -0.149764535f, -0.988950265f, -0.148247679f,
+  -0.98917651f, -0.146730474f, -0.989400428f, -0.145212925f, -0.989622017f, -0.143695033f, -0.989841278f, -0.142176804f,
+  -0.99005821f, -0.140658239f, -0.990272812f, -0.139139344f, -0.990485084f, -0.137620122f, -0.990695025f, -0.136100575f,
+  -0.990902635f, -0.134580709f, -0.991107914f, -0.133060525f, -0.99131086f, -0.131540029f, -0.991511473f, -0.130019223f,
+  -0.991709754f, -0.128498111f, -0.9919057f, -0.126976696f, -0.992099313f, -0.125454983f, -0.992290591f, -0.123932975f,
+  -0.992479535f, -0.122410675f, -0.992666142f, -0.120888087f, -0.992850414f, -0.119365215f, -0.99303235f, -0.117842062f,
+  -0.993211949f, -0.116318631f, -0.993389211f, -0.114794927f, -0.993564136f, -0.113270952f, -0.993736722f, -0.111746711f,
+  -0.99390697f, -0.110222207f, -0.994074879f, -0.108697444f, -0.994240449f, -0.107172425f, -0.99440368f, -0.105647154f,
+  -0.994564571f, -0.104121634f, -0.994723121f, -0.102595869f, -0.994879331f, -0.101069863f, -0.995033199f, -0.0995436187f,
+  -0.995184727f, -0.0980171403f, -0.995333912f, -0.0964904314f, -0.995480755f, -0.0949634953f, -0.995625256f, -0.0934363358f,
+  -0.995767414f, -0.0919089565f, -0.995907229f, -0.0903813609f, -0.996044701f, -0.0888535526f, -0.996179829f, -0.0873255352f,
+  -0.996312612f, -0.0857973123f, -0.996443051f, -0.0842688876f, -0.996571146f, -0.0827402645f, -0.996696895f, -0.0812114468f,
+  -0.996820299f, -0.079682438f, -0.996941358f, -0.0781532416f, -0.99706007f, -0.0766238614f, -0.997176437f, -0.0750943008f,
+  -0.997290457f, -0.0735645636f, -0.99740213f, -0.0720346532f, -0.997511456f, -0.0705045734f, -0.997618435f, -0.0689743276f,
+  -0.997723067f, -0.0674439196f, -0.99782535f, -0.0659133528f, -0.997925286f, -0.0643826309f, -0.998022874f, -0.0628517576f,
+  -0.998118113f, -0.0613207363f, -0.998211003f, -0.0597895707f, -0.998301545f, -0.0582582645f, -0.998389737f, -0.0567268212f,
+  -0.998475581f, -0.0551952443f, -0.998559074f, -0.0536635377f, -0.998640218f, -0.0521317047f, -0.998719012f, -0.050599749f,
+  -0.998795456f, -0.0490676743f, -0.99886955f, -0.0475354842f, -0.998941293f, -0.0460031821f, -0.999010686f, -0.0444707719f,
+  -0.999077728f, -0.0429382569f, -0.999142419f, -0.041405641f, -0.999204759f, -0.0398729276f, -0.999264747f, -0.0383401204f,
+  -0.999322385f, -0.0368072229f, -0.99937767f, -0.0352742389f, -0.999430605f, -0.0337411719f, -0.999481187f, -0.0322080254f,
+  -0.999529418f, -0.0306748032f, -0.999575296f, -0.0291415088f, -0.999618822f, -0.0276081458f, -0.999659997f, -0.0260747178f,
+  -0.999698819f, -0.0245412285f, -0.999735288f, -0.0230076815f, -0.999769405f, -0.0214740803f, -0.99980117f, -0.0199404286f,
+  -0.999830582f, -0.0184067299f, -0.999857641f, -0.0168729879f, -0.999882347f, -0.0153392063f, -0.999904701f, -0.0138053885f,
+  -0.999924702f, -0.0122715383f, -0.99994235f, -0.0107376592f, -0.999957645f, -0.00920375478f, -0.999970586f, -0.00766982874f,
+  -0.999981175f, -0.00613588465f, -0.999989411f, -0.00460192612f, -0.999995294f, -0.00306795676f, -0.999998823f, -0.00153398019f,
+  -1.0f, -1.2246468e-16f, -0.999998823f, 0.00153398019f, -0.999995294f, 0.00306795676f, -0.999989411f, 0.00460192612f,
+  -0.999981175f, 0.00613588465f, -0.999970586f, 0.00766982874f, -0.999957645f, 0.00920375478f, -0.99994235f, 0.0107376592f,
+  -0.999924702f, 0.0122715383f, -0.999904701f, 0.0138053885f, -0.999882347f, 0.0153392063f, -0.999857641f, 0.0168729879f,
+  -0.999830582f, 0.0184067299f, -0.99980117f, 0.0199404286f, -0.999769405f, 0.0214740803f, -0.999735288f, 0.0230076815f,
+  -0.999698819f, 0.0245412285f, -0.999659997f, 0.0260747178f, -0.999618822f, 0.0276081458f, -0.999575296f, 0.0291415088f,
+  -0.999529418f, 0.0306748032f, -0.999481187f, 0.0322080254f, -0.999430605f, 0.0337411719f, -0.99937767f, 0.0352742389f,
+  -0.999322385f, 0.0368072229f, -0.999264747f, 0.0383401204f, -0.999204759f, 0.0398729276f, -0.999142419f, 0.041405641f,
+  -0.999077728f, 0.0429382569f, -0.999010686f, 0.0444707719f, -0.998941293f, 0.0460031821f, -0.99886955f, 0.0475354842f,
+  -0.998795456f, 0.0490676743f, -0.998719012f, 0.050599749f, -0.998640218f, 0.0521317047f, -0.998559074f, 0.0536635377f,
+  -0.998475581f, 0.0551952443f, -0.998389737f, 0.0567268212f, -0.998301545f, 0.0582582645f, -0.998211003f, 0.0597895707f,
+  -0.998118113f, 0.0613207363f, -0.998022874f, 0.0628517576f, -0.997925286f, 0.0643826309f, -0.99782535f, 0.0659133528f,
+  -0.997723067f, 0.0674439196f, -0.997618435f, 0.0689743276f, -0.997511456f, 0.0705045734f, -0.99740213f, 0.0720346532f,
+  -0.997290457f, 0.0735645636f, -0.997176437f, 0.0750943008f, -0.99706007f, 0.0766238614f, -0.996941358f, 0.0781532416f,
+  -0.996820299f, 0.079682438f, -0.996696895f, 0.0812114468f, -0.996571146f, 0.0827402645f, -0.996443051f, 0.0842688876f,
+  -0.996312612f, 0.0857973123f, -0.996179829f, 0.0873255352f, -0.996044701f, 0.0888535526f, -0.995907229f, 0.0903813609f,
+  -0.995767414f, 0.0919089565f, -0.995625256f, 0.0934363358f, -0.995480755f, 0.0949634953f, -0.995333912f, 0.0964904314f,
+  -0.995184727f, 0.0980171403f, -0.995033199f, 0.0995436187f, -0.994879331f, 0.101069863f, -0.994723121f, 0.102595869f,
+  -0.994564571f, 0.104121634f, -0.99440368f, 0.105647154f, -0.994240449f, 0.107172425f, -0.994074879f, 0.108697444f,
+  -0.99390697f, 0.110222207f, -0.993736722f, 0.111746711f, -0.993564136f, 0.113270952f, -0.993389211f, 0.114794927f,
+  -0.993211949f, 0.116318631f, -0.99303235f, 0.117842062f, -0.992850414f, 0.119365215f, -0.992666142f, 0.120888087f,
+  -0.992479535f, 0.122410675f, -0.992290591f, 0.123932975f, -0.992099313f, 0.125454983f, -0.9919057f, 0.126976696f,
+  -0.991709754f, 0.128498111f, -0.991511473f, 0.130019223f, -0.99131086f, 0.131540029f, -0.991107914f, 0.133060525f,
+  -0.990902635f, 0.134580709f, -0.990695025f, 0.136100575f, -0.990485084f, 0.137620122f, -0.990272812f, 0.139139344f,
+  -0.99005821f, 0.140658239f, -0.989841278f, 0.142176804f, -0.989622017f, 0.143695033f, -0.989400428f, 0.145212925f,
+  -0.98917651f, 0.146730474f, -0.988950265f, 0.148247679f, -0.988721692f, 0.149764535f, -0.988490793f, 0.151281038f,
+  -0.988257568f, 0.152797185f, -0.988022017f, 0.154312973f, -0.987784142f, 0.155828398f, -0.987543942f, 0.157343456f,
+  -0.987301418f, 0.158858143f, -0.987056571f, 0.160372457f, -0.986809402f, 0.161886394f, -0.98655991f, 0.163399949f,
+  -0.986308097f, 0.16491312f, -0.986053963f, 0.166425904f, -0.985797509f, 0.167938295f, -0.985538735f, 0.169450291f,
+  -0.985277642f, 0.170961889f, -0.985014231f, 0.172473084f, -0.984748502f, 0.173983873f, -0.984480455f, 0.175494253f,
+  -0.984210092f, 0.17700422f, -0.983937413f, 0.178513771f, -0.983662419f, 0.180022901f, -0.98338511f, 0.181531608f,
+  -0.983105487f, 0.183039888f, -0.982823551f, 0.184547737f, -0.982539302f, 0.186055152f, -0.982252741f, 0.187562129f,
+  -0.981963869f, 0.189068664f, -0.981672686f, 0.190574755f, -0.981379193f, 0.192080397f, -0.981083391f, 0.193585587f,
+  -0.98078528f, 0.195090322f, -0.980484862f, 0.196594598f, -0.980182136f, 0.198098411f, -0.979877104f, 0.199601758f,
+  -0.979569766f, 0.201104635f, -0.979260123f, 0.202607039f, -0.978948175f, 0.204108966f, -0.978633924f, 0.205610413f,
+  -0.978317371f, 0.207111376f, -0.977998515f, 0.208611852f, -0.977677358f, 0.210111837f, -0.9773539f, 0.211611327f,
+  -0.977028143f, 0.21311032f, -0.976700086f, 0.214608811f, -0.976369731f, 0.216106797f, -0.976037079f, 0.217604275f,
+  -0.97570213f, 0.21910124f, -0.975364885f, 0.22059769f, -0.975025345f, 0.222093621f, -0.974683511f, 0.223589029f,
+  -0.974339383f, 0.225083911f, -0.973992962f, 0.226578264f, -0.97364425f, 0.228072083f, -0.973293246f, 0.229565366f,
+  -0.972939952f, 0.231058108f, -0.972584369f, 0.232550307f, -0.972226497f, 0.234041959f, -0.971866337f, 0.235533059f,
+  -0.971503891f, 0.237023606f, -0.971139158f, 0.238513595f, -0.970772141f, 0.240003022f, -0.970402839f, 0.241491885f,
+  -0.970031253f, 0.24298018f, -0.969657385f, 0.244467903f, -0.969281235f, 0.24595505f, -0.968902805f, 0.247441619f,
+  -0.968522094f, 0.248927606f, -0.968139105f, 0.250413007f, -0.967753837f, 0.251897818f, -0.967366292f, 0.253382037f,
+  -0.966976471f, 0.25486566f, -0.966584374f, 0.256348682f, -0.966190003f, 0.257831102f, -0.965793359f, 0.259312915f,
+  -0.965394442f, 0.260794118f, -0.964993253f, 0.262274707f, -0.964589793f, 0.263754679f, -0.964184064f, 0.26523403f,
+  -0.963776066f, 0.266712757f, -0.9633658f, 0.268190857f, -0.962953267f, 0.269668326f, -0.962538468f, 0.27114516f,
+  -0.962121404f, 0.272621355f, -0.961702077f, 0.27409691f, -0.961280486f, 0.275571819f, -0.960856633f, 0.27704608f,
+  -0.960430519f, 0.278519689f, -0.960002146f, 0.279992643f, -0.959571513f, 0.281464938f, -0.959138622f, 0.28293657f,
+  -0.958703475f, 0.284407537f, -0.958266071f, 0.285877835f, -0.957826413f, 0.28734746f, -0.957384501f, 0.288816408f,
+  -0.956940336f, 0.290284677f, -0.956493919f, 0.291752263f, -0.956045251f, 0.293219163f, -0.955594334f, 0.294685372f,
+  -0.955141168f, 0.296150888f, -0.954685755f, 0.297615707f, -0.954228095f, 0.299079826f, -0.95376819f, 0.300543241f,
+  -0.95330604f, 0.302005949f, -0.952841648f, 0.303467947f, -0.952375013f, 0.30492923f, -0.951906137f, 0.306389795f,
+  -0.951435021f, 0.30784964f, -0.950961666f, 0.30930876f, -0.950486074f, 0.310767153f, -0.950008245f, 0.312224814f,
+  -0.949528181f, 0.31368174f, -0.949045882f, 0.315137929f, -0.94856135f, 0.316593376f, -0.948074586f, 0.318048077f,
+  -0.947585591f, 0.319502031f, -0.947094366f, 0.320955232f, -0.946600913f, 0.322407679f, -0.946105232f, 0.323859367f,
+  -0.945607325f, 0.325310292f, -0.945107193f, 0.326760452f, -0.944604837f, 0.328209844f, -0.944100258f, 0.329658463f,
+  -0.943593458f, 0.331106306f, -0.943084437f, 0.33255337f, -0.942573198f, 0.333999651f, -0.94205974f, 0.335445147f,
+  -0.941544065f, 0.336889853f, -0.941026175f, 0.338333767f, -0.940506071f, 0.339776884f, -0.939983753f, 0.341219202f,
+  -0.939459224f, 0.342660717f, -0.938932484f, 0.344101426f, -0.938403534f, 0.345541325f, -0.937872376f, 0.346980411f,
+  -0.937339012f, 0.34841868f, -0.936803442f, 0.34985613f, -0.936265667f, 0.351292756f, -0.935725689f, 0.352728556f,
+  -0.93518351f, 0.354163525f, -0.93463913f, 0.355597662f, -0.93409255f, 0.357030961f, -0.933543773f, 0.358463421f,
+  -0.932992799f, 0.359895037f, -0.932439629f, 0.361325806f, -0.931884266f, 0.362755724f, -0.931326709f, 0.36418479f,
+  -0.930766961f, 0.365612998f, -0.930205023f, 0.367040346f, -0.929640896f, 0.36846683f, -0.929074581f, 0.369892447f,
+  -0.92850608f, 0.371317194f, -0.927935395f, 0.372741067f, -0.927362526f, 0.374164063f, -0.926787474f, 0.375586178f,
+  -0.926210242f, 0.37700741f, -0.925630831f, 0.378427755f, -0.925049241f, 0.379847209f, -0.924465474f, 0.381265769f,
+  -0.923879533f, 0.382683432f, -0.923291417f, 0.384100195f, -0.922701128f, 0.385516054f, -0.922108669f, 0.386931006f,
+  -0.921514039f, 0.388345047f, -0.920917242f, 0.389758174f, -0.920318277f, 0.391170384f, -0.919717146f, 0.392581674f,
+  -0.919113852f, 0.39399204f, -0.918508394f, 0.395401479f, -0.917900776f, 0.396809987f, -0.917290997f, 0.398217562f,
+  -0.91667906f, 0.3996242f, -0.916064966f, 0.401029897f, -0.915448716f, 0.402434651f, -0.914830312f, 0.403838458f,
+  -0.914209756f, 0.405241314f, -0.913587048f, 0.406643217f, -0.91296219f, 0.408044163f, -0.912335185f, 0.409444149f,
+  -0.911706032f, 0.410843171f, -0.911074734f, 0.412241227f, -0.910441292f, 0.413638312f, -0.909805708f, 0.415034424f,
+  -0.909167983f, 0.41642956f, -0.908528119f, 0.417823716f, -0.907886116f, 0.419216888f, -0.907241978f, 0.420609074f,
+  -0.906595705f, 0.422000271f, -0.905947298f, 0.423390474f, -0.905296759f, 0.424779681f, -0.904644091f, 0.426167889f,
+  -0.903989293f, 0.427555093f, -0.903332368f, 0.428941292f, -0.902673318f, 0.430326481f, -0.902012144f, 0.431710658f,
+  -0.901348847f, 0.433093819f, -0.900683429f, 0.434475961f, -0.900015892f, 0.43585708f, -0.899346237f, 0.437237174f,
+  -0.898674466f, 0.438616239f, -0.89800058f, 0.439994271f, -0.897324581f, 0.441371269f, -0.89664647f, 0.442747228f,
+  -0.89596625f, 0.444122145f, -0.895283921f, 0.445496017f, -0.894599486f, 0.44686884f, -0.893912945f, 0.448240612f,
+  -0.893224301f, 0.44961133f, -0.892533555f, 0.450980989f, -0.891840709f, 0.452349587f, -0.891145765f, 0.453717121f,
+  -0.890448723f, 0.455083587f, -0.889749586f, 0.456448982f, -0.889048356f, 0.457813304f, -0.888345033f, 0.459176548f,
+  -0.88763962f, 0.460538711f, -0.886932119f, 0.461899791f, -0.88622253f, 0.463259784f, -0.885510856f, 0.464618686f,
+  -0.884797098f, 0.465976496f, -0.884081259f, 0.467333209f, -0.883363339f, 0.468688822f, -0.88264334f, 0.470043332f,
+  -0.881921264f, 0.471396737f, -0.881197113f, 0.472749032f, -0.880470889f, 0.474100215f, -0.879742593f, 0.475450282f,
+  -0.879012226f, 0.47679923f, -0.878279792f, 0.478147056f, -0.87754529f, 0.479493758f, -0.876808724f, 0.480839331f,
+  -0.876070094f, 0.482183772f, -0.875329403f, 0.483527079f, -0.874586652f, 0.484869248f, -0.873841843f, 0.486210276f,
+  -0.873094978f, 0.48755016f, -0.872346059f, 0.488888897f, -0.871595087f, 0.490226483f, -0.870842063f, 0.491562916f,
+  -0.870086991f, 0.492898192f, -0.869329871f, 0.494232309f, -0.868570706f, 0.495565262f, -0.867809497f, 0.496897049f,
+  -0.867046246f, 0.498227667f, -0.866280954f, 0.499557113f, -0.865513624f, 0.500885383f, -0.864744258f, 0.502212474f,
+  -0.863972856f, 0.503538384f, -0.863199422f, 0.504863109f, -0.862423956f, 0.506186645f, -0.861646461f, 0.507508991f,
+  -0.860866939f, 0.508830143f, -0.86008539f, 0.510150097f, -0.859301818f, 0.51146885f, -0.858516224f, 0.512786401f,
+  -0.85772861f, 0.514102744f, -0.856938977f, 0.515417878f, -0.856147328f, 0.516731799f, -0.855353665f, 0.518044504f,
+  -0.854557988f, 0.51935599f, -0.853760301f, 0.520666254f, -0.852960605f, 0.521975293f, -0.852158902f, 0.523283103f,
+  -0.851355193f, 0.524589683f, -0.850549481f, 0.525895027f, -0.849741768f, 0.527199135f, -0.848932055f, 0.528502002f,
+  -0.848120345f, 0.529803625f, -0.847306639f, 0.531104001f, -0.846490939f, 0.532403128f, -0.845673247f, 0.533701002f,
+  -0.844853565f, 0.53499762f, -0.844031895f, 0.536292979f, -0.84320824f, 0.537587076f, -0.8423826f, 0.538879909f,
+  -0.841554977f, 0.540171473f, -0.840725375f, 0.541461766f, -0.839893794f, 0.542750785f, -0.839060237f, 0.544038527f,
+  -0.838224706f, 0.545324988f, -0.837387202f, 0.546610167f, -0.836547727f, 0.547894059f, -0.835706284f, 0.549176662f,
+  -0.834862875f, 0.550457973f, -0.834017501f, 0.551737988f, -0.833170165f, 0.553016706f, -0.832320868f, 0.554294121f,
+  -0.831469612f, 0.555570233f, -0.8306164f, 0.556845037f, -0.829761234f, 0.558118531f, -0.828904115f, 0.559390712f,
+  -0.828045045f, 0.560661576f, -0.827184027f, 0.561931121f, -0.826321063f, 0.563199344f, -0.825456154f, 0.564466242f,
+  -0.824589303f, 0.565731811f, -0.823720511f, 0.566996049f, -0.822849781f, 0.568258953f, -0.821977115f, 0.569520519f,
+  -0.821102515f, 0.570780746f, -0.820225983f, 0.572039629f, -0.81934752f, 0.573297167f, -0.81846713f, 0.574553355f,
+  -0.817584813f, 0.575808191f, -0.816700573f, 0.577061673f, -0.815814411f, 0.578313796f, -0.814926329f, 0.579564559f,
+  -0.81403633f, 0.580813958f, -0.813144415f, 0.58206199f, -0.812250587f, 0.583308653f, -0.811354847f, 0.584553943f,
+  -0.810457198f, 0.585797857f, -0.809557642f, 0.587040394f, -0.808656182f, 0.588281548f, -0.807752818f, 0.589521319f,
+  -0.806847554f, 0.590759702f, -0.805940391f, 0.591996695f, -0.805031331f, 0.593232295f, -0.804120377f, 0.594466499f,
+  -0.803207531f, 0.595699304f, -0.802292796f, 0.596930708f, -0.801376172f, 0.598160707f, -0.800457662f, 0.599389298f,
+  -0.799537269f, 0.600616479f, -0.798614995f, 0.601842247f, -0.797690841f, 0.603066599f, -0.79676481f, 0.604289531f,
+  -0.795836905f, 0.605511041f, -0.794907126f, 0.606731127f, -0.793975478f, 0.607949785f, -0.79304196f, 0.609167012f,
+  -0.792106577f, 0.610382806f, -0.79116933f, 0.611597164f, -0.790230221f, 0.612810082f, -0.789289253f, 0.614021559f,
+  -0.788346428f, 0.615231591f, -0.787401747f, 0.616440175f, -0.786455214f, 0.617647308f, -0.78550683f, 0.618852988f,
+  -0.784556597f, 0.620057212f, -0.783604519f, 0.621259977f, -0.782650596f, 0.622461279f, -0.781694832f, 0.623661118f,
+  -0.780737229f, 0.624859488f, -0.779777788f, 0.626056388f, -0.778816512f, 0.627251815f, -0.777853404f, 0.628445767f,
+  -0.776888466f, 0.629638239f, -0.775921699f, 0.63082923f, -0.774953107f, 0.632018736f, -0.773982691f, 0.633206755f,
+  -0.773010453f, 0.634393284f, -0.772036397f, 0.63557832f, -0.771060524f, 0.636761861f, -0.770082837f, 0.637943904f,
+  -0.769103338f, 0.639124445f, -0.768122029f, 0.640303482f, -0.767138912f, 0.641481013f, -0.76615399f, 0.642657034f,
+  -0.765167266f, 0.643831543f, -0.764178741f, 0.645004537f, -0.763188417f, 0.646176013f, -0.762196298f, 0.647345969f,
+  -0.761202385f, 0.648514401f, -0.760206682f, 0.649681307f, -0.759209189f, 0.650846685f, -0.75820991f, 0.652010531f,
+  -0.757208847f, 0.653172843f, -0.756206001f, 0.654333618f, -0.755201377f, 0.655492853f, -0.754194975f, 0.656650546f,
+  -0.753186799f, 0.657806693f, -0.75217685f, 0.658961293f, -0.751165132f, 0.660114342f, -0.750151646f, 0.661265838f,
+  -0.749136395f, 0.662415778f, -0.74811938f, 0.663564159f, -0.747100606f, 0.664710978f, -0.746080074f, 0.665856234f,
+  -0.745057785f, 0.666999922f, -0.744033744f, 0.668142041f, -0.743007952f, 0.669282588f, -0.741980412f, 0.67042156f,
+  -0.740951125f, 0.671558955f, -0.739920095f, 0.672694769f, -0.738887324f, 0.673829f, -0.737852815f, 0.674961646f,
+  -0.736816569f, 0.676092704f, -0.735778589f, 0.67722217f, -0.734738878f, 0.678350043f, -0.733697438f, 0.67947632f,
+  -0.732654272f, 0.680600998f, -0.731609381f, 0.681724074f, -0.730562769f, 0.682845546f, -0.729514438f, 0.683965412f,
+  -0.72846439f, 0.685083668f, -0.727412629f, 0.686200312f, -0.726359155f, 0.687315341f, -0.725303972f, 0.688428753f,
+  -0.724247083f, 0.689540545f, -0.723188489f, 0.690650714f, -0.722128194f, 0.691759258f, -0.721066199f, 0.692866175f,
+  -0.720002508f, 0.693971461f, -0.718937122f, 0.695075114f, -0.717870045f, 0.696177131f, -0.716801279f, 0.697277511f,
+  -0.715730825f, 0.698376249f, -0.714658688f, 0.699473345f, -0.713584869f, 0.700568794f, -0.712509371f, 0.701662595f,
+  -0.711432196f, 0.702754744f, -0.710353347f, 0.703845241f, -0.709272826f, 0.70493408f, -0.708190637f, 0.706021261f,
+  -0.707106781f, 0.707106781f, -0.706021261f, 0.708190637f, -0.70493408f, 0.709272826f, -0.703845241f, 0.710353347f,
+  -0.702754744f, 0.711432196f, -0.701662595f, 0.712509371f, -0.700568794f, 0.713584869f, -0.699473345f, 0.714658688f,
+  -0.698376249f, 0.715730825f, -0.697277511f, 0.716801279f, -0.696177131f, 0.717870045f, -0.695075114f, 0.718937122f,
+  -0.693971461f, 0.720002508f, -0.692866175f, 0.721066199f, -0.691759258f, 0.722128194f, -0.690650714f, 0.723188489f,
+  -0.689540545f, 0.724247083f, -0.688428753f, 0.725303972f, -0.687315341f, 0.726359155f, -0.686200312f, 0.727412629f,
+  -0.685083668f, 0.72846439f, -0.683965412f, 0.729514438f, -0.682845546f, 0.730562769f, -0.681724074f, 0.731609381f,
+  -0.680600998f, 0.732654272f, -0.67947632f, 0.733697438f, -0.678350043f, 0.734738878f, -0.67722217f, 0.735778589f,
+  -0.676092704f, 0.736816569f, -0.674961646f, 0.737852815f, -0.673829f, 0.738887324f, -0.672694769f, 0.739920095f,
+  -0.671558955f, 0.740951125f, -0.67042156f, 0.741980412f, -0.669282588f, 0.743007952f, -0.668142041f, 0.744033744f,
+  -0.666999922f, 0.745057785f, -0.665856234f, 0.746080074f, -0.664710978f, 0.747100606f, -0.663564159f, 0.74811938f,
+  -0.662415778f, 0.749136395f, -0.661265838f, 0.750151646f, -0.660114342f, 0.751165132f, -0.658961293f, 0.75217685f,
+  -0.657806693f, 0.753186799f, -0.656650546f, 0.754194975f, -0.655492853f, 0.755201377f, -0.654333618f, 0.756206001f,
+  -0.653172843f, 0.757208847f, -0.652010531f, 0.75820991f, -0.650846685f, 0.759209189f, -0.649681307f, 0.760206682f,
+  -0.648514401f, 0.761202385f, -0.647345969f, 0.762196298f, -0.646176013f, 0.763188417f, -0.645004537f, 0.764178741f,
+  -0.643831543f, 0.765167266f, -0.642657034f, 0.76615399f, -0.641481013f, 0.767138912f, -0.640303482f, 0.768122029f,
+  -0.639124445f, 0.769103338f, -0.637943904f, 0.770082837f, -0.636761861f, 0.771060524f, -0.63557832f, 0.772036397f,
+  -0.634393284f, 0.773010453f, -0.633206755f, 0.773982691f, -0.632018736f, 0.774953107f, -0.63082923f, 0.775921699f,
+  -0.629638239f, 0.776888466f, -0.628445767f, 0.777853404f, -0.627251815f, 0.778816512f, -0.626056388f, 0.779777788f,
+  -0.624859488f, 0.780737229f, -0.623661118f, 0.781694832f, -0.622461279f, 0.782650596f, -0.621259977f, 0.783604519f,
+  -0.620057212f, 0.784556597f, -0.618852988f, 0.78550683f, -0.617647308f, 0.786455214f, -0.616440175f, 0.787401747f,
+  -0.615231591f, 0.788346428f, -0.614021559f, 0.789289253f, -0.612810082f, 0.790230221f, -0.611597164f, 0.79116933f,
+  -0.610382806f, 0.792106577f, -0.609167012f, 0.79304196f, -0.607949785f, 0.793975478f, -0.606731127f, 0.794907126f,
+  -0.605511041f, 0.795836905f, -0.604289531f, 0.79676481f, -0.603066599f, 0.797690841f, -0.601842247f, 0.798614995f,
+  -0.600616479f, 0.799537269f, -0.599389298f, 0.800457662f, -0.598160707f, 0.801376172f, -0.596930708f, 0.802292796f,
+  -0.595699304f, 0.803207531f, -0.594466499f, 0.804120377f, -0.593232295f, 0.805031331f, -0.591996695f, 0.805940391f,
+  -0.590759702f, 0.806847554f, -0.589521319f, 0.807752818f, -0.588281548f, 0.808656182f, -0.587040394f, 0.809557642f,
+  -0.585797857f, 0.810457198f, -0.584553943f, 0.811354847f, -0.583308653f, 0.812250587f, -0.58206199f, 0.813144415f,
+  -0.580813958f, 0.81403633f, -0.579564559f, 0.814926329f, -0.578313796f, 0.815814411f, -0.577061673f, 0.816700573f,
+  -0.575808191f, 0.817584813f, -0.574553355f, 0.81846713f, -0.573297167f, 0.81934752f, -0.572039629f, 0.820225983f,
+  -0.570780746f, 0.821102515f, -0.569520519f, 0.821977115f, -0.568258953f, 0.822849781f, -0.566996049f, 0.823720511f,
+  -0.565731811f, 0.824589303f, -0.564466242f, 0.825456154f, -0.563199344f, 0.826321063f, -0.561931121f, 0.827184027f,
+  -0.560661576f, 0.828045045f, -0.559390712f, 0.828904115f, -0.558118531f, 0.829761234f, -0.556845037f, 0.8306164f,
+  -0.555570233f, 0.831469612f, -0.554294121f, 0.832320868f, -0.553016706f, 0.833170165f, -0.551737988f, 0.834017501f,
+  -0.550457973f, 0.834862875f, -0.549176662f, 0.835706284f, -0.547894059f, 0.836547727f, -0.546610167f, 0.837387202f,
+  -0.545324988f, 0.838224706f, -0.544038527f, 0.839060237f, -0.542750785f, 0.839893794f, -0.541461766f, 0.840725375f,
+  -0.540171473f, 0.841554977f, -0.538879909f, 0.8423826f, -0.537587076f, 0.84320824f, -0.536292979f, 0.844031895f,
+  -0.53499762f, 0.844853565f, -0.533701002f, 0.845673247f, -0.532403128f, 0.846490939f, -0.531104001f, 0.847306639f,
+  -0.529803625f, 0.848120345f, -0.528502002f, 0.848932055f, -0.527199135f, 0.849741768f, -0.525895027f, 0.850549481f,
+  -0.524589683f, 0.851355193f, -0.523283103f, 0.852158902f, -0.521975293f, 0.852960605f, -0.520666254f, 0.853760301f,
+  -0.51935599f, 0.854557988f, -0.518044504f, 0.855353665f, -0.516731799f, 0.856147328f, -0.515417878f, 0.856938977f,
+  -0.514102744f, 0.85772861f, -0.512786401f, 0.858516224f, -0.51146885f, 0.859301818f, -0.510150097f, 0.86008539f,
+  -0.508830143f, 0.860866939f, -0.507508991f, 0.861646461f, -0.506186645f, 0.862423956f, -0.504863109f, 0.863199422f,
+  -0.503538384f, 0.863972856f, -0.502212474f, 0.864744258f, -0.500885383f, 0.865513624f, -0.499557113f, 0.866280954f,
+  -0.498227667f, 0.867046246f, -0.496897049f, 0.867809497f, -0.495565262f, 0.868570706f, -0.494232309f, 0.869329871f,
+  -0.492898192f, 0.870086991f, -0.491562916f, 0.870842063f, -0.490226483f, 0.871595087f, -0.488888897f, 0.872346059f,
+  -0.48755016f, 0.873094978f, -0.486210276f, 0.873841843f, -0.484869248f, 0.874586652f, -0.483527079f, 0.875329403f,
+  -0.482183772f, 0.876070094f, -0.480839331f, 0.876808724f, -0.479493758f, 0.87754529f, -0.478147056f, 0.878279792f,
+  -0.47679923f, 0.879012226f, -0.475450282f, 0.879742593f, -0.474100215f, 0.880470889f, -0.472749032f, 0.881197113f,
+  -0.471396737f, 0.881921264f, -0.470043332f, 0.88264334f, -0.468688822f, 0.883363339f, -0.467333209f, 0.884081259f,
+  -0.465976496f, 0.884797098f, -0.464618686f, 0.885510856f, -0.463259784f, 0.88622253f, -0.461899791f, 0.886932119f,
+  -0.460538711f, 0.88763962f, -0.459176548f, 0.888345033f, -0.457813304f, 0.889048356f, -0.456448982f, 0.889749586f,
+  -0.455083587f, 0.890448723f, -0.453717121f, 0.891145765f, -0.452349587f, 0.891840709f, -0.450980989f, 0.892533555f,
+  -0.44961133f, 0.893224301f, -0.448240612f, 0.893912945f, -0.44686884f, 0.894599486f, -0.445496017f, 0.895283921f,
+  -0.444122145f, 0.89596625f, -0.442747228f, 0.89664647f, -0.441371269f, 0.897324581f, -0.439994271f, 0.89800058f,
+  -0.438616239f, 0.898674466f, -0.437237174f, 0.899346237f, -0.43585708f, 0.900015892f, -0.434475961f, 0.900683429f,
+  -0.433093819f, 0.901348847f, -0.431710658f, 0.902012144f, -0.430326481f, 0.902673318f, -0.428941292f, 0.903332368f,
+  -0.427555093f, 0.903989293f, -0.426167889f, 0.904644091f, -0.424779681f, 0.905296759f, -0.423390474f, 0.905947298f,
+  -0.422000271f, 0.906595705f, -0.420609074f, 0.907241978f, -0.419216888f, 0.907886116f, -0.417823716f, 0.908528119f,
+  -0.41642956f, 0.909167983f, -0.415034424f, 0.909805708f, -0.413638312f, 0.910441292f, -0.412241227f, 0.911074734f,
+  -0.410843171f, 0.911706032f, -0.409444149f, 0.912335185f, -0.408044163f, 0.91296219f, -0.406643217f, 0.913587048f,
+  -0.405241314f, 0.914209756f, -0.403838458f, 0.914830312f, -0.402434651f, 0.915448716f, -0.401029897f, 0.916064966f,
+  -0.3996242f, 0.91667906f, -0.398217562f, 0.917290997f, -0.396809987f, 0.917900776f, -0.395401479f, 0.918508394f,
+  -0.39399204f, 0.919113852f, -0.392581674f, 0.919717146f, -0.391170384f, 0.920318277f, -0.389758174f, 0.920917242f,
+  -0.388345047f, 0.921514039f, -0.386931006f, 0.922108669f, -0.385516054f, 0.922701128f, -0.384100195f, 0.923291417f,
+  -0.382683432f, 0.923879533f, -0.381265769f, 0.924465474f, -0.379847209f, 0.925049241f, -0.378427755f, 0.925630831f,
+  -0.37700741f, 0.926210242f, -0.375586178f, 0.926787474f, -0.374164063f, 0.927362526f, -0.372741067f, 0.927935395f,
+  -0.371317194f, 0.92850608f, -0.369892447f, 0.929074581f, -0.36846683f, 0.929640896f, -0.367040346f, 0.930205023f,
+  -0.365612998f, 0.930766961f, -0.36418479f, 0.931326709f, -0.362755724f, 0.931884266f, -0.361325806f, 0.932439629f,
+  -0.359895037f, 0.932992799f, -0.358463421f, 0.933543773f, -0.357030961f, 0.93409255f, -0.355597662f, 0.93463913f,
+  -0.354163525f, 0.93518351f, -0.352728556f, 0.935725689f, -0.351292756f, 0.936265667f, -0.34985613f, 0.936803442f,
+  -0.34841868f, 0.937339012f, -0.346980411f, 0.937872376f, -0.345541325f, 0.938403534f, -0.344101426f, 0.938932484f,
+  -0.342660717f, 0.939459224f, -0.341219202f, 0.939983753f, -0.339776884f, 0.940506071f, -0.338333767f, 0.941026175f,
+  -0.336889853f, 0.941544065f, -0.335445147f, 0.94205974f, -0.333999651f, 0.942573198f, -0.33255337f, 0.943084437f,
+  -0.331106306f, 0.943593458f, -0.329658463f, 0.944100258f, -0.328209844f, 0.944604837f, -0.326760452f, 0.945107193f,
+  -0.325310292f, 0.945607325f, -0.323859367f, 0.946105232f, -0.322407679f, 0.946600913f, -0.320955232f, 0.947094366f,
+  -0.319502031f, 0.947585591f, -0.318048077f, 0.948074586f, -0.316593376f, 0.94856135f, -0.315137929f, 0.949045882f,
+  -0.31368174f, 0.949528181f, -0.312224814f, 0.950008245f, -0.310767153f, 0.950486074f, -0.30930876f, 0.950961666f,
+  -0.30784964f, 0.951435021f, -0.306389795f, 0.951906137f, -0.30492923f, 0.952375013f, -0.303467947f, 0.952841648f,
+  -0.302005949f, 0.95330604f, -0.300543241f, 0.95376819f, -0.299079826f, 0.954228095f, -0.297615707f, 0.954685755f,
+  -0.296150888f, 0.955141168f, -0.294685372f, 0.955594334f, -0.293219163f, 0.956045251f, -0.291752263f, 0.956493919f,
+  -0.290284677f, 0.956940336f, -0.288816408f, 0.957384501f, -0.28734746f, 0.957826413f, -0.285877835f, 0.958266071f,
+  -0.284407537f, 0.958703475f, -0.28293657f, 0.959138622f, -0.281464938f, 0.959571513f, -0.279992643f, 0.960002146f,
+  -0.278519689f, 0.960430519f, -0.27704608f, 0.960856633f, -0.275571819f, 0.961280486f, -0.27409691f, 0.961702077f,
+  -0.272621355f, 0.962121404f, -0.27114516f, 0.962538468f, -0.269668326f, 0.962953267f, -0.268190857f, 0.9633658f,
+  -0.266712757f, 0.963776066f, -0.26523403f, 0.964184064f, -0.263754679f, 0.964589793f, -0.262274707f, 0.964993253f,
+  -0.260794118f, 0.965394442f, -0.259312915f, 0.965793359f, -0.257831102f, 0.966190003f, -0.256348682f, 0.966584374f,
+  -0.25486566f, 0.966976471f, -0.253382037f, 0.967366292f, -0.251897818f, 0.967753837f, -0.250413007f, 0.968139105f,
+  -0.248927606f, 0.968522094f, -0.247441619f, 0.968902805f, -0.24595505f, 0.969281235f, -0.244467903f, 0.969657385f,
+  -0.24298018f, 0.970031253f, -0.241491885f, 0.970402839f, -0.240003022f, 0.970772141f, -0.238513595f, 0.971139158f,
+  -0.237023606f, 0.971503891f, -0.235533059f, 0.971866337f, -0.234041959f, 0.972226497f, -0.232550307f, 0.972584369f,
+  -0.231058108f, 0.972939952f, -0.229565366f, 0.973293246f, -0.228072083f, 0.97364425f, -0.226578264f, 0.973992962f,
+  -0.225083911f, 0.974339383f, -0.223589029f, 0.974683511f, -0.222093621f, 0.975025345f, -0.22059769f, 0.975364885f,
+  -0.21910124f, 0.97570213f, -0.217604275f, 0.976037079f, -0.216106797f, 0.976369731f, -0.214608811f, 0.976700086f,
+  -0.21311032f, 0.977028143f, -0.211611327f, 0.9773539f, -0.210111837f, 0.977677358f, -0.208611852f, 0.977998515f,
+  -0.207111376f, 0.978317371f, -0.205610413f, 0.978633924f, -0.204108966f, 0.978948175f, -0.202607039f, 0.979260123f,
+  -0.201104635f, 0.979569766f, -0.199601758f, 0.979877104f, -0.198098411f, 0.980182136f, -0.196594598f, 0.980484862f,
+  -0.195090322f, 0.98078528f, -0.193585587f, 0.981083391f, -0.192080397f, 0.981379193f, -0.190574755f, 0.981672686f,
+  -0.189068664f, 0.981963869f, -0.187562129f, 0.982252741f, -0.186055152f, 0.982539302f, -0.184547737f, 0.982823551f,
+  -0.183039888f, 0.983105487f, -0.181531608f, 0.98338511f, -0.180022901f, 0.983662419f, -0.178513771f, 0.983937413f,
+  -0.17700422f, 0.984210092f, -0.175494253f, 0.984480455f, -0.173983873f, 0.984748502f, -0.172473084f, 0.985014231f,
+  -0.170961889f, 0.985277642f, -0.169450291f, 0.985538735f, -0.167938295f, 0.985797509f, -0.166425904f, 0.986053963f,
+  -0.16491312f, 0.986308097f, -0.163399949f, 0.98655991f, -0.161886394f, 0.986809402f, -0.160372457f, 0.987056571f,
+  -0.158858143f, 0.987301418f, -0.157343456f, 0.987543942f, -0.155828398f, 0.987784142f, -0.154312973f, 0.988022017f,
+  -0.152797185f, 0.988257568f, -0.151281038f, 0.988490793f, -0.149764535f, 0.988721692f, -0.148247679f, 0.988950265f,
+  -0.146730474f, 0.98917651f, -0.145212925f, 0.989400428f, -0.143695033f, 0.989622017f, -0.142176804f, 0.989841278f,
+  -0.140658239f, 0.99005821f, -0.139139344f, 0.990272812f, -0.137620122f, 0.990485084f, -0.136100575f, 0.990695025f,
+  -0.134580709f, 0.990902635f, -0.133060525f, 0.991107914f, -0.131540029f, 0.99131086f, -0.130019223f, 0.991511473f,
+  -0.128498111f, 0.991709754f, -0.126976696f, 0.9919057f, -0.125454983f, 0.992099313f, -0.123932975f, 0.992290591f,
+  -0.122410675f, 0.992479535f, -0.120888087f, 0.992666142f, -0.119365215f, 0.992850414f, -0.117842062f, 0.99303235f,
+  -0.116318631f, 0.993211949f, -0.114794927f, 0.993389211f, -0.113270952f, 0.993564136f, -0.111746711f, 0.993736722f,
+  -0.110222207f, 0.99390697f, -0.108697444f, 0.994074879f, -0.107172425f, 0.994240449f, -0.105647154f, 0.99440368f,
+  -0.104121634f, 0.994564571f, -0.102595869f, 0.994723121f, -0.101069863f, 0.994879331f, -0.0995436187f, 0.995033199f,
+  -0.0980171403f, 0.995184727f, -0.0964904314f, 0.995333912f, -0.0949634953f, 0.995480755f, -0.0934363358f, 0.995625256f,
+  -0.0919089565f, 0.995767414f, -0.0903813609f, 0.995907229f, -0.0888535526f, 0.996044701f, -0.0873255352f, 0.996179829f,
+  -0.0857973123f, 0.996312612f, -0.0842688876f, 0.996443051f, -0.0827402645f, 0.996571146f, -0.0812114468f, 0.996696895f,
+  -0.079682438f, 0.996820299f, -0.0781532416f, 0.996941358f, -0.0766238614f, 0.99706007f, -0.0750943008f, 0.997176437f,
+  -0.0735645636f, 0.997290457f, -0.0720346532f, 0.99740213f, -0.0705045734f, 0.997511456f, -0.0689743276f, 0.997618435f,
+  -0.0674439196f, 0.997723067f, -0.0659133528f, 0.99782535f, -0.0643826309f, 0.997925286f, -0.0628517576f, 0.998022874f,
+  -0.0613207363f, 0.998118113f, -0.0597895707f, 0.998211003f, -0.0582582645f, 0.998301545f, -0.0567268212f, 0.998389737f,
+  -0.0551952443f, 0.998475581f, -0.0536635377f, 0.998559074f, -0.0521317047f, 0.998640218f, -0.050599749f, 0.998719012f,
+  -0.0490676743f, 0.998795456f, -0.0475354842f, 0.99886955f, -0.0460031821f, 0.998941293f, -0.0444707719f, 0.999010686f,
+  -0.0429382569f, 0.999077728f, -0.041405641f, 0.999142419f, -0.0398729276f, 0.999204759f, -0.0383401204f, 0.999264747f,
+  -0.0368072229f, 0.999322385f, -0.0352742389f, 0.99937767f, -0.0337411719f, 0.999430605f, -0.0322080254f, 0.999481187f,
+  -0.0306748032f, 0.999529418f, -0.0291415088f, 0.999575296f, -0.0276081458f, 0.999618822f, -0.0260747178f, 0.999659997f,
+  -0.0245412285f, 0.999698819f, -0.0230076815f, 0.999735288f, -0.0214740803f, 0.999769405f, -0.0199404286f, 0.99980117f,
+  -0.0184067299f, 0.999830582f, -0.0168729879f, 0.999857641f, -0.0153392063f, 0.999882347f, -0.0138053885f, 0.999904701f,
+  -0.0122715383f, 0.999924702f, -0.0107376592f, 0.99994235f, -0.00920375478f, 0.999957645f, -0.00766982874f, 0.999970586f,
+  -0.00613588465f, 0.999981175f, -0.00460192612f, 0.999989411f, -0.00306795676f, 0.999995294f, -0.00153398019f, 0.999998823f,
+};
+
+const dsp_q15 dsp_fft_twiddle_q15[2U * DSP_FFT_TWIDDLES] DSP_FFT_TABLE =
+{
+   32767,      0,  32767,    -50,  32767,   -101,  32767,   -151,
+   32767,   -201,  32767,   -251,  32767,   -302,  32766,   -352,
+   32766,   -402,  32765,   -452,  32764,   -503,  32763,   -553,
+   32762,   -603,  32761,   -653,  32760,   -704,  32759,   -754,
+   32758,   -804,  32757,   -854,  32756,   -905,  32754,   -955,
+   32753,  -1005,  32751,  -1055,  32749,  -1106,  32748,  -1156,
+   32746,  -1206,  32744,  -1256,  32742,  -1307,  32740,  -1357,
+   32738,  -1407,  32736,  -1457,  32733,  -1507,  32731,  -1558,
+   32729,  -1608,  32726,  -1658,  32723,  -1708,  32721,  -1758,
+   32718,  -1809,  32715,  -1859,  32712,  -1909,  32709,  -1959,
+   32706,  -2009,  32703,  -2060,  32700,  -2110,  32697,  -2160,
+   32693,  -2210,  32690,  -2260,  32686,  -2310,  32683,  -2360,
+   32679,  -2411,  32675,  -2461,  32672,  -2511,  32668,  -2561,
+   32664,  -2611,  32660,  -2661,  32656,  -2711,  32651,  -2761,
+   32647,  -2811,  32643,  -2861,  32638,  -2912,  32634,  -2962,
+   32629,  -3012,  32625,  -3062,  32620,  -3112,  32615,  -3162,
+   32610,  -3212,  32605,  -3262,  32600,  -3312,  32595,  -3362,
+   32590,  -3412,  32585,  -3462,  32579,  -3512,  32574,  -3562,
+   32568,  -3612,  32563,  -3662,  32557,  -3712,  32551,  -3762,
+   32546,  -3812,  32540,  -3861,  32534,  -3911,  32528,  -3961,
+   32522,  -4011,  32515,  -4061,  32509,  -4111,  32503,  -4161,
+   32496,  -4211,  32490,  -4260,  32483,  -4310,  32477,  -4360,
+   32470,  -4410,  32463,  -4460,  32456,  -4510,  32449,  -4559,
+   32442,  -4609,  32435,  -4659,  32428,  -4709,  32421,  -4758,
+   32413,  -4808,  32406,  -4858,  32398,  -4907,  32391,  -4957,
+   32383,  -5007,  32376,  -5057,  32368,  -5106,  32360,  -5156,
+   32352,  -5205,  32344,  -5255,  32336,  -5305,  32328,  -5354,
+   32319,  -5404,  32311,  -5453,  32303,  -5503,  32294,  -5553,
+   32286,  -5602,  32277,  -5652,  32268,  -5701,  32259,  -5751,
+   32251,  -5800,  32242,  -5850,  32233,  -5899,  32224,  -5948,
+   32214,  -5998,  32205,  -6047,  32196,  -6097,  32186,  -6146,
+   32177,  -6195,  32167,  -6245,  32158,  -6294,  32148,  -6343,
+   32138,  -6393,  32129,  -6442,  32119,  -6491,  32109,  -6541,
+   32099,  -6590,  32088,  -6639,  32078,  -6688,  32068,  -6737,
+   32058,  -6787,  32047,  -6836,  32037,  -6885,  32026,  -6934,
+   32015,  -6983,  32005,  -7032,  31994,  -7081,  31983,  -7130,
+   31972,  -7180,  31961,  -7229,  31950,  -7278,  31938,  -7327,
+   31927,  -7376,  31916,  -7425,  31904,  -7473,  31893,  -7522,
+   31881,  -7571,  31870,  -7620,  31858,  -7669,  31846,  -7718,
+   31834,  -7767,  31822,  -7816,  31810,  -7864,  31798,  -7913,
+   31786,  -7962,  31774,  -8011,  31761,  -8059,  31749,  -8108,
+   31737,  -8157,  31724,  -8206,  31711,  -8254,  31699,  -8303,
+   31686,  -8351,  31673,  -8400,  31660,  -8449,  31647,  -8497,
+   31634,  -8546,  31621,  -8594,  31608,  -8643,  31594,  -8691,
+   31581,  -8740,  31568,  -8788,  31554,  -8836,  31540,  -8885,
+   31527,  -8933,  31513,  -8982,  31499,  -9030,  31485,  -9078,
+   31471,  -9127,  31457,  -9175,  31443,  -9223,  31429,  -9271,
+   31415,  -9319,  31400,  -9368,  31386,  -9416,  31372,  -9464,
+   31357,  -9512,  31342,  -9560,  31328,  -9608,  31313,  -9656,
+   31298,  -9704,  31283,  -9752,  31268,  -9800,  31253,  -9848,
+   31238,  -9896,  31223,  -9944,  31207,  -9992,  31192, -10040,
+   31177, -10088,  31161, -10135,  31146, -10183,  31130, -10231,
+   31114, -10279,  31098, -10326,  31082, -10374,  31067, -10422,
+   31050, -10469,  31034, -10517,  31018, -10565,  31002, -10612,
+   30986, -10660,  30969, -10707,  30953, -10755,  30936, -10802,
+   30920, -10850,  30903, -10897,  30886, -10945,  30869, -10992,
+   30853, -11039,  30836, -11087,  30819, -11134,  30801, -11181,
+   30784, -11228,  30767, -11276,  30750, -11323,  30732, -11370,
+   30715, -11417,  30697, -11464,  30680, -11511,  30662, -11558,
+   30644, -11605,  30626, -11652,  30608, -11699,  30590, -11746,
+   30572, -11793,  30554, -11840,  30536, -11887,  30518, -11934,
+   30499, -11980,  30481, -12027,  30462, -12074,  30444, -12121,
+   30425, -12167,  30407, -12214,  30388, -12261,  30369, -12307,
+   30350, -12354,  30331, -12400,  30312, -12447,  30293, -12493,
+   30274, -12540,  30254, -12586,  30235, -12633,  30216, -12679,
+   30196, -12725,  30177, -12772,  30157, -12818,  30137, -12864,
+   30118, -12910,  30098, -12957,  30078, -13003,  30058, -13049,
+   30038, -13095,  30018, -13141,  29997, -13187,  29977, -13233,
+   29957, -13279,  29936, -13325,  29916, -13371,  29895, -13417,
+   29875, -13463,  29854, -13508,  29833, -13554,  29813, -13600,
+   29792, -13646,  29771, -13691,  29750, -13737,  29729, -13783,
+   29707, -13828,  29686, -13874,  29665, -13919,  29643, -13965,
+   29622, -14010,  29600, -14056,  29579, -14101,  29557, -14146,
+   29535, -14192,  29514, -14237,  29492, -14282,  29470, -14327,
+   29448, -14373,  29426, -14418,  29404, -14463,  29381, -14508,
+   29359, -14553,  29337, -14598,  29314, -14643,  29292, -14688,
+   29269, -14733,  29247, -14778,  29224, -14823,  29201, -14867,
+   29178, -14912,  29155, -14957,  29132, -15002,  29109, -15046,
+   29086, -15091,  29063, -15136,  29040, -15180,  29016, -15225,
+   28993, -15269,  28970, -15314,  28946, -15358,  28922, -15402,
+   28899, -15447,  28875, -15491,  28851, -15535,  28827, -15580,
+   28803, -15624,  28779, -15668,  28755, -15712,  28731, -15756,
+   28707, -15800,  28683, -15844,  28658, -15888,  28634, -15932,
+   28610, -15976,  28585, -16020,  28560, -16064,  28536, -16108,
+   28511, -16151,  28486, -16195,  28461, -16239,  28436, -16282,
+   28411, -16326,  28386, -16369,  28361, -16413,  28336, -16456,
+   28311, -16500,  28285, -16543,  28260, -16587,  28234, -16630,
+   28209, -16673,  28183, -16717,  28158, -16760,  28132, -16803,
+   28106, -16846,  28080, -16889,  28054, -16932,  28028, -16975,
+   28002, -17018,  27976, -17061,  27950, -17104,  27924, -17147,
+   27897, -17190,  27871, -17233,  27844, -17275,  27818, -17318,
+   27791, -17361,  27765, -17403,  27738, -17446,  27711, -17488,
+   27684, -17531,  27657, -17573,  27630, -17616,  27603, -17658,
+   27576, -17700,  27549, -17743,  27522, -17785,  27494, -17827,
+   27467, -17869,  27440, -17911,  27412, -17953,  27384, -17995,
+   27357, -18037,  27329, -18079,  27301, -18121,  27273, -18163,
+   27246, -18205,  27218, -18247,  27190, -18288,  27162, -18330,
+   27133, -18372,  27105, -18413,  27077, -18455,  27049, -18496,
+   27020, -18538,  26992, -18579,  26963, -18621,  26935, -18662,
+   26906, -18703,  26877, -18745,  26848, -18786,  26820, -18827,
+   26791, -18868,  26762, -18909,  26733, -18950,  26704, -18991,
+   26674, -19032,  26645, -19073,  26616, -19114,  26586, -19155,
+   26557, -19195,  26528, -19236,  26498, -19277,  26468, -19317,
+   26439, -19358,  26409, -19399,  26379, -19439,  26349, -19479,
+   26320, -19520,  26290, -19560,  26259, -19601,  26229, -19641,
+   26199, -19681,  26169, -19721,  26139, -19761,  26108, -19801,
+   26078, -19841,  26048, -19881,  26017, -19921,  25986, -19961,
+   25956, -20001,  25925, -20041,  25894, -20081,  25863, -20120,
+   25833, -20160,  25802, -20200,  25771, -20239,  25739, -20279,
+   25708, -20318,  25677, -20357,  25646, -20397,  25615, -20436,
+   25583, -20475,  25552, -20515,  25520, -20554,  25489, -20593,
+   25457, -20632,  25425, -20671,  25394, -20710,  25362, -20749,
+   25330, -20788,  25298, -20827,  25266, -20865,  25234, -20904,
+   25202, -20943,  25170, -20981,  25138, -21020,  25105, -21059,
+   25073, -21097,  25041, -21136,  25008, -21174,  24976, -21212,
+   24943, -21251,  24910, -21289,  24878, -21327,  24845, -21365,
+   24812, -21403,  24779, -21441,  24746, -21479,  24713, -21517,
+   24680, -21555,  24647, -21593,  24614, -21631,  24581, -21668,
+   24548, -21706,  24514, -21744,  24481, -21781,  24448, -21819,
+   24414, -21856,  24380, -21894,  24347, -21931,  24313, -21968,
+   24279, -22006,  24246, -22043,  24212, -22080,  24178, -22117,
+   24144, -22154,  24110, -22191,  24076, -22228,  24042, -22265,
+   24008, -22302,  23973, -22339,  23939, -22375,  23905, -22412,
+   23870, -22449,  23836, -22485,  23801, -22522,  23767, -22558,
+   23732, -22595,  23697, -22631,  23663, -22668,  23628, -22704,
+   23593, -22740,  23558, -22776,  23523, -22812,  23488, -22848,
+   23453, -22884,  23418, -22920,  23383, -22956,  23348, -22992,
+   23312, -23028,  23277, -23064,  23241, -23099,  23206, -23135,
+   23170, -23170,  23135, -23206,  23099, -23241,  23064, -23277,
+   23028, -23312,  22992, -23348,  22956, -23383,  22920, -23418,
+   22884, -23453,  22848, -23488,  22812, -23523,  22776, -23558,
+   22740, -23593,  22704, -23628,  22668, -23663,  22631, -23697,
+   22595, -23732,  22558, -23767,  22522, -23801,  22485, -23836,
+   22449, -23870,  22412, -23905,  22375, -23939,  22339, -23973,
+   22302, -24008,  22265, -24042,  22228, -24076,  22191, -24110,
+   22154, -24144,  22117, -24178,  22080, -24212,  22043, -24246,
+   22006, -24279,  21968, -24313,  21931, -24347,  21894, -24380,
+   21856, -24414,  21819, -24448,  21781, -24481,  21744, -24514,
+   21706, -24548,  21668, -24581,  21631, -24614,  21593, -24647,
+   21555, -24680,  21517, -24713,  21479, -24746,  21441, -24779,
+   21403, -24812,  21365, -24845,  21327, -24878,  21289, -24910,
+   21251, -24943,  21212, -24976,  21174, -25008,  21136, -25041,
+   21097, -25073,  21059, -25105,  21020, -25138,  20981, -25170,
+   20943, -25202,  20904, -25234,  20865, -25266,  20827, -25298,
+   20788, -25330,  20749, -25362,  20710, -25394,  20671, -25425,
+   20632, -25457,  20593, -25489,  20554, -25520,  20515, -25552,
+   20475, -25583,  20436, -25615,  20397, -25646,  20357, -25677,
+   20318, -25708,  20279, -25739,  20239, -25771,  20200, -25802,
+   20160, -25833,  20120, -25863,  20081, -25894,  20041, -25925,
+   20001, -25956,  19961, -25986,  19921, -26017,  19881, -26048,
+   19841, -26078,  19801, -26108,  19761, -26139,  19721, -26169,
+   19681, -26199,  19641, -26229,  19601, -26259,  19560, -26290,
+   19520, -26320,  19479, -26349,  19439, -26379,  19399, -26409,
+   19358, -26439,  19317, -26468,  19277, -26498,  19236, -26528,
+   19195, -26557,  19155, -26586,  19114, -26616,  19073, -26645,
+   19032, -26674,  18991, -26704,  18950, -26733,  18909, -26762,
+   18868, -26791,  18827, -26820,  18786, -26848,  18745, -26877,
+   18703, -26906,  18662, -26935,  18621, -26963,  18579, -26992,
+   18538, -27020,  18496, -27049,  18455, -27077,  18413, -27105,
+   18372, -27133,  18330, -27162,  18288, -27190,  18247, -27218,
+   18205, -27246,  18163, -27273,  18121, -27301,  18079, -27329,
+   18037, -27357,  17995, -27384,  17953, -27412,  17911, -27440,
+   17869, -27467,  17827, -27494,  17785, -27522,  17743, -27549,
+   17700, -27576,  17658, -27603,  17616, -27630,  17573, -27657,
+   17531, -27684,  17488, -27711,  17446, -27738,  17403, -27765,
+   17361, -27791,  17318, -27818,  17275, -27844,  17233, -27871,
+   17190, -27897,  17147, -27924,  17104, -27950,  17061, -27976,
+   17018, -28002,  16975, -28028,  16932, -28054,  16889, -28080,
+   16846, -28106,  16803, -28132,  16760, -28158,  16717, -28183,
+   16673, -28209,  16630, -28234,  16587, -28260,  16543, -28285,
+   16500, -28311,  16456, -28336,  16413, -28361,  16369, -28386,
+   16326, -28411,  16282, -28436,  16239, -28461,  16195, -28486,
+   16151, -28511,  16108, -28536,  16064, -28560,  16020, -28585,
+   15976, -28610,  15932, -28634,  15888, -28658,  15844, -28683,
+   15800, -28707,  15756, -28731,  15712, -28755,  15668, -28779,
+   15624, -28803,  15580, -28827,  15535, -28851,  15491, -28875,
+   15447, -28899,  15402, -28922,  15358, -28946,  15314, -28970,
+   15269, -28993,  15225, -29016,  15180, -29040,  15136, -29063,
+   15091, -29086,  15046, -29109,  15002, -29132,  14957, -29155,
+   14912, -29178,  14867, -29201,  14823, -29224,  14778, -29247,
+   14733, -29269,  14688, -29292,  14643, -29314,  14598, -29337,
+   14553, -29359,  14508, -29381,  14463, -29404,  14418, -29426,
+   14373, -29448,  14327, -29470,  14282, -29492,  14237, -29514,
+   14192, -29535,  14146, -29557,  14101, -29579,  14056, -29600,
+   14010, -29622,  13965, -29643,  13919, -29665,  13874, -29686,
+   13828, -29707,  13783, -29729,  13737, -29750,  13691, -29771,
+   13646, -29792,  13600, -29813,  13554, -29833,  13508, -29854,
+   13463, -29875,  13417, -29895,  13371, -29916,  13325, -29936,
+   13279, -29957,  13233, -29977,  13187, -29997,  13141, -30018,
+   13095, -30038,  13049, -30058,  13003, -30078,  12957, -30098,
+   12910, -30118,  12864, -30137,  12818, -30157,  12772, -30177,
+   12725, -30196,  12679, -30216,  12633, -30235,  12586, -30254,
+   12540, -30274,  12493, -30293,  12447, -30312,  12400, -30331,
+   12354, -30350,  12307, -30369,  12261, -30388,  12214, -30407,
+   12167, -30425,  12121, -30444,  12074, -30462,  12027, -30481,
+   11980, -30499,  11934, -30518,  11887, -30536,  11840, -30554,
+   11793, -30572,  11746, -30590,  11699, -30608,  11652, -30626,
+   11605, -30644,  11558, -30662,  11511, -30680,  11464, -30697,
+   11417, -30715,  11370, -30732,  11323, -30750,  11276, -30767,
+   11228, -30784,  11181, -30801,  11134, -30819,  11087, -30836,
+   11039, -30853,  10992, -30869,  10945, -30886,  10897, -30903,
+   10850, -30920,  10802, -30936,  10755, -30953,  10707, -30969,
+   10660, -30986,  10612, -31002,  10565, -31018,  10517, -31034,
+   10469, -31050,  10422, -31067,  10374, -31082,  10326, -31098,
+   10279, -31114,  10231, -31130,  10183, -31146,  10135, -31161,
+   10088, -31177,  10040, -31192,   9992, -31207,   9944, -31223,
+    9896, -31238,   9848, -31253,   9800, -31268,   9752, -31283,
+    9704, -31298,   9656, -31313,   9608, -31328,   9560, -31342,
+    9512, -31357,   9464, -31372,   9416, -31386,   9368, -31400,
+    9319, -31415,   9271, -31429,   9223, -31443,   9175, -31457,
+    9127, -31471,   9078, -31485,   9030, -31499,   8982, -31513,
+    8933, -31527,   8885, -31540,   8836, -31554,   8788, -31568,
+    8740, -31581,   8691, -31594,   8643, -31608,   8594, -31621,
+    8546, -31634,   8497, -31647,   8449, -31660,   8400, -31673,
+    8351, -31686,   8303, -31699,   8254, -31711,   8206, -31724,
+    8157, -31737,   8108, -31749,   8059, -31761,   8011, -31774,
+    7962, -31786,   7913, -31798,   7864, -31810,   7816, -31822,
+    7767, -31834,   7718, -31846,   7669, -31858,   7620, -31870,
+    7571, -31881,   7522, -31893,   7473, -31904,   7425, -31916,
+    7376, -31927,   7327, -31938,   7278, -31950,   7229, -31961,
+    7180, -31972,   7130, -31983,   7081, -31994,   7032, -32005,
+    6983, -32015,   6934, -32026,   6885, -32037,   6836, -32047,
+    6787, -32058,   6737, -32068,   6688, -32078,   6639, -32088,
+    6590, -32099,   6541, -32109,   6491, -32119,   6442, -32129,
+    6393, -32138,   6343, -32148,   6294, -32158,   6245, -32167,
+    6195, -32177,   6146, -32186,   6097, -32196,   6047, -32205,
+    5998, -32214,   5948, -32224,   5899, -32233,   5850, -32242,
+    5800, -32251,   5751, -32259,   5701, -32268,   5652, -32277,
+    5602, -32286,   5553, -32294,   5503, -32303,   5453, -32311,
+    5404, -32319,   5354, -32328,   5305, -32336,   5255, -32344,
+    5205, -32352,   5156, -32360,   5106, -32368,   5057, -32376,
+    5007, -32383,   4957, -32391,   4907, -32398,   4858, -32406,
+    4808, -32413,   4758, -32421,   4709, -32428,   4659, -32435,
+    4609, -32442,   4559, -32449,   4510, -32456,   4460, -32463,
+    4410, -32470,   4360, -32477,   4310, -32483,   4260, -32490,
+    4211, -32496,   4161, -32503,   4111, -32509,   4061, -32515,
+    4011, -32522,   3961, -32528,   3911, -32534,   3861, -32540,
+    3812, -32546,   3762, -32551,   3712, -32557,   3662, -32563,
+    3612, -32568,   3562, -32574,   3512, -32579,   3462, -32585,
+    3412, -32590,   3362, -32595,   3312, -32600,   3262, -32605,
+    3212, -32610,   3162, -32615,   3112, -32620,   3062, -32625,
+    3012, -32629,   2962, -32634,   2912, -32638,   2861, -32643,
+    2811, -32647,   2761, -32651,   2711, -32656,   2661, -32660,
+    2611, -32664,   2561, -32668,   2511, -32672,   2461, -32675,
+    2411, -32679,   2360, -32683,   2310, -32686,   2260, -32690,
+    2210, -32693,   2160, -32697,   2110, -32700,   2060, -32703,
+    2009, -32706,   1959, -32709,   1909, -32712,   1859, -32715,
+    1809, -32718,   1758, -32721,   1708, -32723,   1658, -32726,
+    1608, -32729,   1558, -32731,   1507, -32733,   1457, -32736,
+    1407, -32738,   1357, -32740,   1307, -32742,   1256, -32744,
+    1206, -32746,   1156, -32748,   1106, -32749,   1055, -32751,
+    1005, -32753,    955, -32754,    905, -32756,    854, -32757,
+     804, -32758,    754, -32759,    704, -32760,    653, -32761,
+     603, -32762,    553, -32763,    503, -32764,    452, -32765,
+     402, -32766,    352, -32766,    302, -32767,    251, -32767,
+     201, -32767,    151, -32768,    101, -32768,     50, -32768,
+       0, -32768,    -50, -32768,   -101, -32768,   -151, -32768,
+    -201, -32767,   -251, -32767,   -302, -32767,   -352, -32766,
+    -402, -32766,   -452, -32765,   -503, -32764,   -553, -32763,
+    -603, -32762,   -653, -32761,   -704, -32760,   -754, -32759,
+    -804, -32758,   -854, -32757,   -905, -32756,   -955, -32754,
+   -1005, -32753,  -1055, -32751,  -1106, -32749,  -1156, -32748,
+   -1206, -32746,  -1256, -32744,  -1307, -32742,  -1357, -32740,
+   -1407, -32738,  -1457, -32736,  -1507, -32733,  -1558, -32731,
+   -1608, -32729,  -1658, -32726,  -1708, -32723,  -1758, -32721,
+   -1809, -32718,  -1859, -32715,  -1909, -32712,  -1959, -32709,
+   -2009, -32706,  -2060, -32703,  -2110, -32700,  -2160, -32697,
+   -2210, -32693,  -2260, -32690,  -2310, -32686,  -2360, -32683,
+   -2411, -32679,  -2461, -32675,  -2511, -32672,  -2561, -32668,
+   -2611, -32664,  -2661, -32660,  -2711, -32656,  -2761, -32651,
+   -2811, -32647,  -2861, -32643,  -2912, -32638,  -2962, -32634,
+   -3012, -32629,  -3062, -32625,  -3112, -32620,  -3162, -32615,
+   -3212, -32610,  -3262, -32605,  -3312, -32600,  -3362, -32595,
+   -3412, -32590,  -3462, -32585,  -3512, -32579,  -3562, -32574,
+   -3612, -32568,  -3662, -32563,  -3712, -32557,  -3762, -32551,
+   -3812, -32546,  -3861, -32540,  -3911, -32534,  -3961, -32528,
+   -4011, -32522,  -4061, -32515,  -4111, -32509,  -4161, -32503,
+   -4211, -32496,  -4260, -32490,  -4310, -32483,  -4360, -32477,
+   -4410, -32470,  -4460, -32463,  -4510, -32456,  -4559, -32449,
+   -4609, -32442,  -4659, -32435,  -4709, -32428,  -4758, -32421,
+   -4808, -32413,  -4858, -32406,  -4907, -32398,  -4957, -32391,
+   -5007, -32383,  -5057, -32376,  -5106, -32368,  -5156, -32360,
+   -5205, -32352,  -5255, -32344,  -5305, -32336,  -5354, -32328,
+   -5404, -32319,  -5453, -32311,  -5503, -32303,  -5553, -32294,
+   -5602, -32286,  -5652, -32277,  -5701, -32268,  -5751, -32259,
+   -5800, -32251,  -5850, -32242,  -5899, -32233,  -5948, -32224,
+   -5998, -32214,  -6047, -32205,  -6097, -32196,  -6146, -32186,
+   -6195, -32177,  -6245, -32167,  -6294, -32158,  -6343, -32148,
+   -6393, -32138,  -6442, -32129,  -6491, -32119,  -6541, -32109,
+   -6590, -32099,  -6639, -32088,  -6688, -32078,  -6737, -32068,
+   -6787, -32058,  -6836, -32047,  -6885, -32037,  -6934, -32026,
+   -6983, -32015,  -7032, -32005,  -7081, -31994,  -7130, -31983,
+   -7180, -31972,  -7229, -31961,  -7278, -31950,  -7327, -31938,
+   -7376, -31927,  -7425, -31916,  -7473, -31904,  -7522, -31893,
+   -7571, -31881,  -7620, -31870,  -7669, -31858,  -7718, -31846,
+   -7767, -31834,  -7816, -31822,  -7864, -31810,  -7913, -31798,
+   -7962, -31786,  -8011, -31774,  -8059, -31761,  -8108, -31749,
+   -8157, -31737,  -8206, -31724,  -8254, -31711,  -8303, -31699,
+   -8351, -31686,  -8400, -31673,  -8449, -31660,  -8497, -31647,
+   -8546, -31634,  -8594, -31621,  -8643, -31608,  -8691, -31594,
+   -8740, -31581,  -8788, -31568,  -8836, -31554,  -8885, -31540,
+   -8933, -31527,  -8982, -31513,  -9030, -31499,  -9078, -31485,
+   -9127, -31471,  -9175, -31457,  -9223, -31443,  -9271, -31429,
+   -9319, -31415,  -9368, -31400,  -9416, -31386,  -9464, -31372,
+   -9512, -31357,  -9560, -31342,  -9608, -31328,  -9656, -31313,
+   -9704, -31298,  -9752, -31283,  -9800, -31268,  -9848, -31253,
+   -9896, -31238,  -9944, -31223,  -9992, -31207, -10040, -31192,
+  -10088, -31177, -10135, -31161, -10183, -31146, -10231, -31130,
+  -10279, -31114, -10326, -31098, -10374, -31082, -10422, -31067,
+  -10469, -31050, -10517, -31034, -10565, -31018, -10612, -31002,
+  -10660, -30986, -10707, -30969, -10755, -30953, -10802, -30936,
+  -10850, -30920, -10897, -30903, -10945, -30886, -10992, -30869,
+  -11039, -30853, -11087, -30836, -11134, -30819, -11181, -30801,
+  -11228, -30784, -11276, -30767, -11323, -30750, -11370, -30732,
+  -11417, -30715, -11464, -30697, -11511, -30680, -11558, -30662,
+  -11605, -30644, -11652, -30626, -11699, -30608, -11746, -30590,
+  -11793, -30572, -11840, -30554, -11887, -30536, -11934, -30518,
+  -11980, -30499, -12027, -30481, -12074, -30462, -12121, -30444,
+  -12167, -30425, -12214, -30407, -12261, -30388, -12307, -30369,
+  -12354, -30350, -12400, -30331, -12447, -30312, -12493, -30293,
+  -12540, -30274, -12586, -30254, -12633, -30235, -12679, -30216,
+  -12725, -30196, -12772, -30177, -12818, -30157, -12864, -30137,
+  -12910, -30118, -12957, -30098, -13003, -30078, -13049, -30058,
+  -13095, -30038, -13141, -30018, -13187, -29997, -13233, -29977,
+  -13279, -29957, -13325, -29936, -13371, -29916, -13417, -29895,
+  -13463, -29875, -13508, -29854, -13554, -29833, -13600, -29813,
+  -13646, -29792, -13691, -29771, -13737, -29750, -13783, -29729,
+  -13828, -29707, -13874, -29686, -13919, -29665, -13965, -29643,
+  -14010, -29622, -14056, -29600, -14101, -29579, -14146, -29557,
+  -14192, -29535, -14237, -29514, -14282, -29492, -14327, -29470,
+  -14373, -29448, -14418, -29426, -14463, -29404, -14508, -29381,
+  -14553, -29359, -14598, -29337, -14643, -29314, -14688, -29292,
+  -14733, -29269, -14778, -29247, -14823, -29224, -14867, -29201,
+  -14912, -29178, -14957, -29155, -15002, -29132, -15046, -29109,
+  -15091, -29086, -15136, -29063, -15180, -29040, -15225, -29016,
+  -15269, -28993, -15314, -28970, -15358, -28946, -15402, -28922,
+  -15447, -28899, -15491, -28875, -15535, -28851, -15580, -28827,
+  -15624, -28803, -15668, -28779, -15712, -28755, -15756, -28731,
+  -15800, -28707, -15844, -28683, -15888, -28658, -15932, -28634,
+  -15976, -28610, -16020, -28585, -16064, -28560, -16108, -28536,
+  -16151, -28511, -16195, -28486, -16239, -28461, -16282, -28436,
+  -16326, -28411, -16369, -28386, -16413, -28361, -16456, -28336,
+  -16500, -28311, -16543, -28285, -16587, -28260, -16630, -28234,
+  -16673, -28209, -16717, -28183, -16760, -28158, -16803, -28132,
+  -16846, -28106, -16889, -28080, -16932, -28054, -16975, -28028,
+  -17018, -28002, -17061, -27976, -17104, -27950, -17147, -27924,
+  -17190, -27897, -17233, -27871, -17275, -27844, -17318, -27818,
+  -17361, -27791, -17403, -27765, -17446, -27738, -17488, -27711,
+  -17531, -27684, -17573, -27657, -17616, -27630, -17658, -27603,
+  -17700, -27576, -17743, -27549, -17785, -27522, -17827, -27494,
+  -17869, -27467, -17911, -27440, -17953, -27412, -17995, -27384,
+  -18037, -27357, -18079, -27329, -18121, -27301, -18163, -27273,
+  -18205, -27246, -18247, -27218, -18288, -27190, -18330, -27162,
+  -18372, -27133, -18413, -27105, -18455, -27077, -18496, -27049,
+  -18538, -27020, -18579, -26992, -18621, -26963, -18662, -26935,
+  -18703, -26906, -18745, -26877, -18786, -26848, -18827, -26820,
+  -18868, -26791, -18909, -26762, -18950, -26733, -18991, -26704,
+  -19032, -26674, -19073, -26645, -19114, -26616, -19155, -26586,
+  -19195, -26557, -19236, -26528, -19277, -26498, -19317, -26468,
+  -19358, -26439, -19399, -26409, -19439, -26379, -19479, -26349,
+  -19520, -26320, -19560, -26290, -19601, -26259, -19641, -26229,
+  -19681, -26199, -19721, -26169, -19761, -26139, -19801, -26108,
+  -19841, -26078, -19881, -26048, -19921, -26017, -19961, -25986,
+  -20001, -25956, -20041, -25925, -20081, -25894, -20120, -25863,
+  -20160, -25833, -20200, -25802, -20239, -25771, -20279, -25739,
+  -20318, -25708, -20357, -25677, -20397, -25646, -20436, -25615,
+  -20475, -25583, -20515, -25552, -20554, -25520, -20593, -25489,
+  -20632, -25457, -20671, -25425, -20710, -25394, -20749, -25362,
+  -20788, -25330, -20827, -25298, -20865, -25266, -20904, -25234,
+  -20943, -25202, -20981, -25170, -21020, -25138, -21059, -25105,
+  -21097, -25073, -21136, -25041, -21174, -25008, -21212, -24976,
+  -21251, -24943, -21289, -24910, -21327, -24878, -21365, -24845,
+  -21403, -24812, -21441, -24779, -21479, -24746, -21517, -24713,
+  -21555, -24680, -21593, -24647, -21631, -24614, -21668, -24581,
+  -21706, -24548, -21744, -24514, -21781, -24481, -21819, -24448,
+  -21856, -24414, -21894, -24380, -21931, -24347, -21968, -24313,
+  -22006, -24279, -22043, -24246, -22080, -24212, -22117, -24178,
+  -22154, -24144, -22191, -24110, -22228, -24076, -22265, -24042,
+  -22302, -24008, -22339, -23973, -22375, -23939, -22412, -23905,
+  -22449, -23870, -22485, -23836, -22522, -23801, -22558, -23767,
+  -22595, -23732, -22631, -23697, -22668, -23663, -22704, -23628,
+  -22740, -23593, -22776, -23558, -22812, -23523, -22848, -23488,
+  -22884, -23453, -22920, -23418, -22956, -23383, -22992, -23348,
+  -23028, -23312, -23064, -23277, -23099, -23241, -23135, -23206,
+  -23170, -23170, -23206, -23135, -23241, -23099, -23277, -23064,
+  -23312, -23028, -23348, -22992, -23383, -22956, -23418, -22920,
+  -23453, -22884, -23488, -22848, -23523, -22812, -23558, -22776,
+  -23593, -22740, -23628, -22704, -23663, -22668, -23697, -22631,
+  -23732, -22595, -23767, -22558, -23801, -22522, -23836, -22485,
+  -23870, -22449, -23905, -22412, -23939, -22375, -23973, -22339,
+  -24008, -22302, -24042, -22265, -24076, -22228, -24110, -22191,
+  -24144, -22154, -24178, -22117, -24212, -22080, -24246, -22043,
+  -24279, -22006, -24313, -21968, -24347, -21931, -24380, -21894,
+  -24414, -21856, -24448, -21819, -24481, -21781, -24514, -21744,
+  -24548, -21706, -24581, -21668, -24614, -21631, -24647, -21593,
+  -24680, -21555, -24713, -21517, -24746, -21479, -24779, -21441,
+  -24812, -21403, -24845, -21365, -24878, -21327, -24910, -21289,
+  -24943, -21251, -24976, -21212, -25008, -21174, -25041, -21136,
+  -25073, -21097, -25105, -21059, -25138, -21020, -25170, -20981,
+  -25202, -20943, -25234, -20904, -25266, -20865, -25298, -20827,
+  -25330, -20788, -25362, -20749, -25394, -20710, -25425, -20671,
+  -25457, -20632, -25489, -20593, -25520, -20554, -25552, -20515,
+  -25583, -20475, -25615, -20436, -25646, -20397, -25677, -20357,
+  -25708, -20318, -25739, -20279, -25771, -20239, -25802, -20200,
+  -25833, -20160, -25863, -20120, -25894, -20081, -25925, -20041,
+  -25956, -20001, -25986, -19961, -26017, -19921, -26048, -19881,
+  -26078, -19841, -26108, -19801, -26139, -19761, -26169, -19721,
+  -26199, -19681, -26229, -19641, -26259, -19601, -26290, -19560,
+  -26320, -19520, -26349, -19479, -26379, -19439, -26409, -19399,
+  -26439, -19358, -26468, -19317, -26498, -19277, -26528, -19236,
+  -26557, -19195, -26586, -19155, -26616, -19114, -26645, -19073,
+  -26674, -19032, -26704, -18991, -26733, -18950, -26762, -18909,
+  -26791, -18868, -26820, -18827, -26848, -18786, -26877, -18745,
+  -26906, -18703, -26935, -18662, -26963, -18621, -26992, -18579,
+  -27020, -18538, -27049, -18496, -27077, -18455, -27105, -18413,
+  -27133, -18372, -27162, -18330, -27190, -18288, -27218, -18247,
+  -27246, -18205, -27273, -18163, -27301, -18121, -27329, -18079,
+  -27357, -18037, -27384, -17995, -27412, -17953, -27440, -17911,
+  -27467, -17869, -27494, -17827, -27522, -17785, -27549, -17743,
+  -27576, -17700, -27603, -17658, -27630, -17616, -27657, -17573,
+  -27684, -17531, -27711, -17488, -27738, -17446, -27765, -17403,
+  -27791, -17361, -27818, -17318, -27844, -17275, -27871, -17233,
+  -27897, -17190, -27924, -17147, -27950, -17104, -27976, -17061,
+  -28002, -17018, -28028, -16975, -28054, -16932, -28080, -16889,
+  -28106, -16846, -28132, -16803, -28158, -16760, -28183, -16717,
+  -28209, -16673, -28234, -16630, -28260, -16587, -28285, -16543,
+  -28311, -16500, -28336, -16456, -28361, -16413, -28386, -16369,
+  -28411, -16326, -28436, -16282, -28461, -16239, -28486, -16195,
+  -28511, -16151, -28536, -16108, -28560, -16064, -28585, -16020,
+  -28610, -15976, -28634, -15932, -28658, -15888, -28683, -15844,
+  -28707, -15800, -28731, -15756, -28755, -15712, -28779, -15668,
+  -28803, -15624, -28827, -15580, -28851, -15535, -28875, -15491,
+  -28899, -15447, -28922, -15402, -28946, -15358, -28970, -15314,
+  -28993, -15269, -29016, -15225, -29040, -15180, -29063, -15136,
+  -29086, -15091, -29109, -15046, -29132, -15002, -29155, -14957,
+  -29178, -14912, -29201, -14867, -29224, -14823, -29247, -14778,
+  -29269, -14733, -29292, -14688, -29314, -14643, -29337, -14598,
+  -29359, -14553, -29381, -14508, -29404, -14463, -29426, -14418,
+  -29448, -14373, -29470, -14327, -29492, -14282, -29514, -14237,
+  -29535, -14192, -29557, -14146, -29579, -14101, -29600, -14056,
+  -29622, -14010, -29643, -13965, -29665, -13919, -29686, -13874,
+  -29707, -13828, -29729, -13783, -29750, -13737, -29771, -13691,
+  -29792, -13646, -29813, -13600, -29833, -13554, -29854, -13508,
+  -29875, -13463, -29895, -13417, -29916, -13371, -29936, -13325,
+  -29957, -13279, -29977, -13233, -29997, -13187, -30018, -13141,
+  -30038, -13095, -30058, -13049, -30078, -13003, -30098, -12957,
+  -30118, -12910, -30137, -12864, -30157, -12818, -30177, -12772,
+  -30196, -12725, -30216, -12679, -30235, -12633, -30254, -12586,
+  -30274, -12540, -30293, -12493, -30312, -12447, -30331, -12400,
+  -30350, -12354, -30369, -12307, -30388, -12261, -30407, -12214,
+  -30425, -12167, -30444, -12121, -30462, -12074, -30481, -12027,
+  -30499, -11980, -30518, -11934, -30536, -11887, -30554, -11840,
+  -30572, -11793, -30590, -11746, -30608, -11699, -30626, -11652,
+  -30644, -11605, -30662, -11558, -30680, -11511, -30697, -11464,
+  -30715, -11417, -30732, -11370, -30750, -11323, -30767, -11276,
+  -30784, -11228, -30801, -11181, -30819, -11134, -30836, -11087,
+  -30853, -11039, -30869, -10992, -30886, -10945, -30903, -10897,
+  -30920, -10850, -30936, -10802, -30953, -10755, -30969, -10707,
+  -30986, -10660, -31002, -10612, -31018, -10565, -31034, -10517,
+  -31050, -10469, -31067, -10422, -31082, -10374, -31098, -10326,
+  -31114, -10279, -31130, -10231, -31146, -10183, -31161, -10135,
+  -31177, -10088, -31192, -10040, -31207,  -9992, -31223,  -9944,
+  -31238,  -9896, -31253,  -9848, -31268,  -9800, -31283,  -9752,
+  -31298,  -9704, -31313,  -9656, -31328,  -9608, -31342,  -9560,
+  -31357,  -9512, -31372,  -9464, -31386,  -9416, -31400,  -9368,
+  -31415,  -9319, -31429,  -9271, -31443,  -9223, -31457,  -9175,
+  -31471,  -9127, -31485,  -9078, -31499,  -9030, -31513,  -8982,
+  -31527,  -8933, -31540,  -8885, -31554,  -8836, -31568,  -8788,
+  -31581,  -8740, -31594,  -8691, -31608,  -8643, -31621,  -8594,
+  -31634,  -8546, -31647,  -8497, -31660,  -8449, -31673,  -8400,
+  -31686,  -8351, -31699,  -8303, -31711,  -8254, -31724,  -8206,
+  -31737,  -8157, -31749,  -8108, -31761,  -8059, -31774,  -8011,
+  -31786,  -7962, -31798,  -7913, -31810,  -7864, -31822,  -7816,
+  -31834,  -7767, -31846,  -7718, -31858,  -7669, -31870,  -7620,
+  -31881,  -7571, -31893,  -7522, -31904,  -7473, -31916,  -7425,
+  -31927,  -7376, -31938,  -7327, -31950,  -7278, -31961,  -7229,
+  -31972,  -7180, -31983,  -7130, -31994,  -7081, -32005,  -7032,
+  -32015,  -6983, -32026,  -6934, -32037,  -6885, -32047,  -6836,
+  -32058,  -6787, -32068,  -6737, -32078,  -6688, -32088,  -6639,
+  -32099,  -6590, -32109,  -6541, -32119,  -6491, -32129,  -6442,
+  -32138,  -6393, -32148,  -6343, -32158,  -6294, -32167,  -6245,
+  -32177,  -6195, -32186,  -6146, -32196,  -6097, -32205,  -6047,
+  -32214,  -5998, -32224,  -5948, -32233,  -5899, -32242,  -5850,
+  -32251,  -5800, -32259,  -5751, -32268,  -5701, -32277,  -5652,
+  -32286,  -5602, -32294,  -5553, -32303,  -5503, -32311,  -5453,
+  -32319,  -5404, -32328,  -5354, -32336,  -5305, -32344,  -5255,
+  -32352,  -5205, -32360,  -5156, -32368,  -5106, -32376,  -5057,
+  -32383,  -5007, -32391,  -4957, -32398,  -4907, -32406,  -4858,
+  -32413,  -4808, -32421,  -4758, -32428,  -4709, -32435,  -4659,
+  -32442,  -4609, -32449,  -4559, -32456,  -4510, -32463,  -4460,
+  -32470,  -4410, -32477,  -4360, -32483,  -4310, -32490,  -4260,
+  -32496,  -4211, -32503,  -4161, -32509,  -4111, -32515,  -4061,
+  -32522,  -4011, -32528,  -3961, -32534,  -3911, -32540,  -3861,
+  -32546,  -3812, -32551,  -3762, -32557,  -3712, -32563,  -3662,
+  -32568,  -3612, -32574,  -3562, -32579,  -3512, -32585,  -3462,
+  -32590,  -3412, -32595,  -3362, -32600,  -3312, -32605,  -3262,
+  -32610,  -3212, -32615,  -3162, -32620,  -3112, -32625,  -3062,
+  -32629,  -3012, -32634,  -2962, -32638,  -2912, -32643,  -2861,
+  -32647,  -2811, -32651,  -2761, -32656,  -2711, -32660,  -2661,
+  -32664,  -2611, -32668,  -2561, -32672,  -2511, -32675,  -2461,
+  -32679,  -2411, -32683,  -2360, -32686,  -2310, -32690,  -2260,
+  -32693,  -2210, -32697,  -2160, -32700,  -2110, -32703,  -2060,
+  -32706,  -2009, -32709,  -1959, -32712,  -1909, -32715,  -1859,
+  -32718,  -1809, -32721,  -1758, -32723,  -1708, -32726,  -1658,
+  -32729,  -1608, -32731,  -1558, -32733,  -1507, -32736,  -1457,
+  -32738,  -1407, -32740,  -1357, -32742,  -1307, -32744,  -1256,
+  -32746,  -1206, -32748,  -1156, -32749,  -1106, -32751,  -1055,
+  -32753,  -1005, -32754,   -955, -32756,   -905, -32757,   -854,
+  -32758,   -804, -32759,   -754, -32760,   -704, -32761,   -653,
+  -32762,   -603, -32763,   -553, -32764,   -503, -32765,   -452,
+  -32766,   -402, -32766,   -352, -32767,   -302, -32767,   -251,
+  -32767,   -201, -32768,   -151, -32768,   -101, -32768,    -50,
+  -32768,      0, -32768,     50, -32768,    101, -32768,    151,
+  -32767,    201, -32767,    251, -32767,    302, -32766,    352,
+  -32766,    402, -32765,    452, -32764,    503, -32763,    553,
+  -32762,    603, -32761,    653, -32760,    704, -32759,    754,
+  -32758,    804, -32757,    854, -32756,    905, -32754,    955,
+  -32753,   1005, -32751,   1055, -32749,   1106, -32748,   1156,
+  -32746,   1206, -32744,   1256, -32742,   1307, -32740,   1357,
+  -32738,   1407, -32736,   1457, -32733,   1507, -32731,   1558,
+  -32729,   1608, -32726,   1658, -32723,   1708, -32721,   1758,
+  -32718,   1809, -32715,   1859, -32712,   1909, -32709,   1959,
+  -32706,   2009, -32703,   2060, -32700,   2110, -32697,   2160,
+  -32693,   2210, -32690,   2260, -32686,   2310, -32683,   2360,
+  -32679,   2411, -32675,   2461, -32672,   2511, -32668,   2561,
+  -32664,   2611, -32660,   2661, -32656,   2711, -32651,   2761,
+  -32647,   2811, -32643,   2861, -32638,   2912, -32634,   2962,
+  -32629,   3012, -32625,   3062, -32620,   3112, -32615,   3162,
+  -32610,   3212, -32605,   3262, -32600,   3312, -32595,   3362,
+  -32590,   3412, -32585,   3462, -32579,   3512, -32574,   3562,
+  -32568,   3612, -32563,   3662, -32557,   3712, -32551,   3762,
+  -32546,   3812, -32540,   3861, -32534,   3911, -32528,   3961,
+  -32522,   4011, -32515,   4061, -32509,   4111, -32503,   4161,
+  -32496,   4211, -32490,   4260, -32483,   4310, -32477,   4360,
+  -32470,   4410, -32463,   4460, -32456,   4510, -32449,   4559,
+  -32442,   4609, -32435,   4659, -32428,   4709, -32421,   4758,
+  -32413,   4808, -32406,   4858, -32398,   4907, -32391,   4957,
+  -32383,   5007, -32376,   5057, -32368,   5106, -32360,   5156,
+  -32352,   5205, -32344,   5255, -32336,   5305, -32328,   5354,
+  -32319,   5404, -32311,   5453, -32303,   5503, -32294,   5553,
+  -32286,   5602, -32277,   5652, -32268,   5701, -32259,   5751,
+  -32251,   5800, -32242,   5850, -32233,   5899, -32224,   5948,
+  -32214,   5998, -32205,   6047, -32196,   6097, -32186,   6146,
+  -32177,   6195, -32167,   6245, -32158,   6294, -32148,   6343,
+  -32138,   6393, -32129,   6442, -32119,   6491, -32109,   6541,
+  -32099,   6590, -32088,   6639, -32078,   6688, -32068,   6737,
+  -32058,   6787, -32047,   6836, -32037,   6885, -32026,   6934,
+  -32015,   6983, -32005,   7032, -31994,   7081, -31983,   7130,
+  -31972,   7180, -31961,   7229, -31950,   7278, -31938,   7327,
+  -31927,   7376, -31916,   7425, -31904,   7473, -31893,   7522,
+  -31881,   7571, -31870,   7620, -31858,   7669, -31846,   7718,
+  -31834,   7767, -31822,   7816, -31810,   7864, -31798,   7913,
+  -31786,   7962, -31774,   8011, -31761,   8059, -31749,   8108,
+  -31737,   8157, -31724,   8206, -31711,   8254, -31699,   8303,
+  -31686,   8351, -31673,   8400, -31660,   8449, -31647,   8497,
+  -31634,   8546, -31621,   8594, -31608,   8643, -31594,   8691,
+  -31581,   8740, -31568,   8788, -31554,   8836, -31540,   8885,
+  -31527,   8933, -31513,   8982, -31499,   9030, -31485,   9078,
+  -31471,   9127, -31457,   9175, -31443,   9223, -31429,   9271,
+  -31415,   9319, -31400,   9368, -31386,   9416, -31372,   9464,
+  -31357,   9512, -31342,   9560, -31328,   9608, -31313,   9656,
+  -31298,   9704, -31283,   9752, -31268,   9800, -31253,   9848,
+  -31238,   9896, -31223,   9944, -31207,   9992, -31192,  10040,
+  -31177,  10088, -31161,  10135, -31146,  10183, -31130,  10231,
+  -31114,  10279, -31098,  10326, -31082,  10374, -31067,  10422,
+  -31050,  10469, -31034,  10517, -31018,  10565, -31002,  10612,
+  -30986,  10660, -30969,  10707, -30953,  10755, -30936,  10802,
+  -30920,  10850, -30903,  10897, -30886,  10945, -30869,  10992,
+  -30853,  11039, -30836,  11087, -30819,  11134, -30801,  11181,
+  -30784,  11228, -30767,  11276, -30750,  11323, -30732,  11370,
+  -30715,  11417, -30697,  11464, -30680,  11511, -30662,  11558,
+  -30644,  11605, -30626,  11652, -30608,  11699, -30590,  11746,
+  -30572,  11793, -30554,  11840, -30536,  11887, -30518,  11934,
+  -30499,  11980, -30481,  12027, -30462,  12074, -30444,  12121,
+  -30425,  12167, -30407,  12214, -30388,  12261, -30369,  12307,
+  -30350,  12354, -30331,  12400, -30312,  12447, -30293,  12493,
+  -30274,  12540, -30254,  12586, -30235,  12633, -30216,  12679,
+  -30196,  12725, -30177,  12772, -30157,  12818, -30137,  12864,
+  -30118,  12910, -30098,  12957, -30078,  13003, -30058,  13049,
+  -30038,  13095, -30018,  13141, -29997,  13187, -29977,  13233,
+  -29957,  13279, -29936,  13325, -29916,  13371, -29895,  13417,
+  -29875,  13463, -29854,  13508, -29833,  13554, -29813,  13600,
+  -29792,  13646, -29771,  13691, -29750,  13737, -29729,  13783,
+  -29707,  13828, -29686,  13874, -29665,  13919, -29643,  13965,
+  -29622,  14010, -29600,  14056, -29579,  14101, -29557,  14146,
+  -29535,  14192, -29514,  14237, -29492,  14282, -29470,  14327,
+  -29448,  14373, -29426,  14418, -29404,  14463, -29381,  14508,
+  -29359,  14553, -29337,  14598, -29314,  14643, -29292,  14688,
+  -29269,  14733, -29247,  14778, -29224,  14823, -29201,  14867,
+  -29178,  14912, -29155,  14957, -29132,  15002, -29109,  15046,
+  -29086,  15091, -29063,  15136, -29040,  15180, -29016,  15225,
+  -28993,  15269, -28970,  15314, -28946,  15358, -28922,  15402,
+  -28899,  15447, -28875,  15491, -28851,  15535, -28827,  15580,
+  -28803,  15624, -28779,  15668, -28755,  15712, -28731,  15756,
+  -28707,  15800, -28683,  15844, -28658,  15888, -28634,  15932,
+  -28610,  15976, -28585,  16020, -28560,  16064, -28536,  16108,
+  -28511,  16151, -28486,  16195, -28461,  16239, -28436,  16282,
+  -28411,  16326, -28386,  16369, -28361,  16413, -28336,  16456,
+  -28311,  16500, -28285,  16543, -28260,  16587, -28234,  16630,
+  -28209,  16673, -28183,  16717, -28158,  16760, -28132,  16803,
+  -28106,  16846, -28080,  16889, -28054,  16932, -28028,  16975,
+  -28002,  17018, -27976,  17061, -27950,  17104, -27924,  17147,
+  -27897,  17190, -27871,  17233, -27844,  17275, -27818,  17318,
+  -27791,  17361, -27765,  17403, -27738,  17446, -27711,  17488,
+  -27684,  17531, -27657,  17573, -27630,  17616, -27603,  17658,
+  -27576,  17700, -27549,  17743, -27522,  17785, -27494,  17827,
+  -27467,  17869, -27440,  17911, -27412,  17953, -27384,  17995,
+  -27357,  18037, -27329,  18079, -27301,  18121, -27273,  18163,
+  -27246,  18205, -27218,  18247, -27190,  18288, -27162,  18330,
+  -27133,  18372, -27105,  18413, -27077,  18455, -27049,  18496,
+  -27020,  18538, -26992,  18579, -26963,  18621, -26935,  18662,
+  -26906,  18703, -26877,  18745, -26848,  18786, -26820,  18827,
+  -26791,  18868, -26762,  18909, -26733,  18950, -26704,  18991,
+  -26674,  19032, -26645,  19073, -26616,  19114, -26586,  19155,
+  -26557,  19195, -26528,  19236, -26498,  19277, -26468,  19317,
+  -26439,  19358, -26409,  19399, -26379,  19439, -26349,  19479,
+  -26320,  19520, -26290,  19560, -26259,  19601, -26229,  19641,
+  -26199,  19681, -26169,  19721, -26139,  19761, -26108,  19801,
+  -26078,  19841, -26048,  19881, -26017,  19921, -25986,  19961,
+  -25956,  20001, -25925,  20041, -25894,  20081, -25863,  20120,
+  -25833,  20160, -25802,  20200, -25771,  20239, -25739,  20279,
+  -25708,  20318, -25677,  20357, -25646,  20397, -25615,  20436,
+  -25583,  20475, -25552,  20515, -25520,  20554, -25489,  20593,
+  -25457,  20632, -25425,  20671, -25394,  20710, -25362,  20749,
+  -25330,  20788, -25298,  20827, -25266,  20865, -25234,  20904,
+  -25202,  20943, -25170,  20981, -25138,  21020, -25105,  21059,
+  -25073,  21097, -25041,  21136, -25008,  21174, -24976,  21212,
+  -24943,  21251, -24910,  21289, -24878,  21327, -24845,  21365,
+  -24812,  21403, -24779,  21441, -24746,  21479, -24713,  21517,
+  -24680,  21555, -24647,  21593, -24614,  21631, -24581,  21668,
+  -24548,  21706, -24514,  21744, -24481,  21781, -24448,  21819,
+  -24414,  21856, -24380,  21894, -24347,  21931, -24313,  21968,
+  -24279,  22006, -24246,  22043, -24212,  22080, -24178,  22117,
+  -24144,  22154, -24110,  22191, -24076,  22228, -24042,  22265,
+  -24008,  22302, -23973,  22339, -23939,  22375, -23905,  22412,
+  -23870,  22449, -23836,  22485, -23801,  22522, -23767,  22558,
+  -23732,  22595, -23697,  22631, -23663,  22668, -23628,  22704,
+  -23593,  22740, -23558,  22776, -23523,  22812, -23488,  22848,
+  -23453,  22884, -23418,  22920, -23383,  22956, -23348,  22992,
+  -23312,  23028, -23277,  23064, -23241,  23099, -23206,  23135,
+  -23170,  23170, -23135,  23206, -23099,  23241, -23064,  23277,
+  -23028,  23312, -22992,  23348, -22956,  23383, -22920,  23418,
+  -22884,  23453, -22848,  23488, -22812,  23523, -22776,  23558,
+  -22740,  23593, -22704,  23628, -22668,  23663, -22631,  23697,
+  -22595,  23732, -22558,  23767, -22522,  23801, -22485,  23836,
+  -22449,  23870, -22412,  23905, -22375,  23939, -22339,  23973,
+  -22302,  24008, -22265,  24042, -22228,  24076, -22191,  24110,
+  -22154,  24144, -22117,  24178, -22080,  24212, -22043,  24246,
+  -22006,  24279, -21968,  24313, -21931,  24347, -21894,  24380,
+  -21856,  24414, -21819,  24448, -21781,  24481, -21744,  24514,
+  -21706,  24548, -21668,  24581, -21631,  24614, -21593,  24647,
+  -21555,  24680, -21517,  24713, -21479,  24746, -21441,  24779,
+  -21403,  24812, -21365,  24845, -21327,  24878, -21289,  24910,
+  -21251,  24943, -21212,  24976, -21174,  25008, -21136,  25041,
+  -21097,  25073, -21059,  25105, -21020,  25138, -20981,  25170,
+  -20943,  25202, -20904,  25234, -20865,  25266, -20827,  25298,
+  -20788,  25330, -20749,  25362, -20710,  25394, -20671,  25425,
+  -20632,  25457, -20593,  25489, -20554,  25520, -20515,  25552,
+  -20475,  25583, -20436,  25615, -20397,  25646, -20357,  25677,
+  -20318,  25708, -20279,  25739, -20239,  25771, -20200,  25802,
+  -20160,  25833, -20120,  25863, -20081,  25894, -20041,  25925,
+  -20001,  25956, -19961,  25986, -19921,  26017, -19881,  26048,
+  -19841,  26078, -19801,  26108, -19761,  26139, -19721,  26169,
+  -19681,  26199, -19641,  26229, -19601,  26259, -19560,  26290,
+  -19520,  26320, -19479,  26349, -19439,  26379, -19399,  26409,
+  -19358,  26439, -19317,  26468, -19277,  26498, -19236,  26528,
+  -19195,  26557, -19155,  26586, -19114,  26616, -19073,  26645,
+  -19032,  26674, -18991,  26704, -18950,  26733, -18909,  26762,
+  -18868,  26791, -18827,  26820, -18786,  26848, -18745,  26877,
+  -18703,  26906, -18662,  26935, -18621,  26963, -18579,  26992,
+  -18538,  27020, -18496,  27049, -18455,  27077, -18413,  27105,
+  -18372,  27133, -18330,  27162, -18288,  27190, -18247,  27218,
+  -18205,  27246, -18163,  27273, -18121,  27301, -18079,  27329,
+  -18037,  27357, -17995,  27384, -17953,  27412, -17911,  27440,
+  -17869,  27467, -17827,  27494, -17785,  27522, -17743,  27549,
+  -17700,  27576, -17658,  27603, -17616,  27630, -17573,  27657,
+  -17531,  27684, -17488,  27711, -17446,  27738, -17403,  27765,
+  -17361,  27791, -17318,  27818, -17275,  27844, -17233,  27871,
+  -17190,  27897, -17147,  27924, -17104,  27950, -17061,  27976,
+  -17018,  28002, -16975,  28028, -16932,  28054, -16889,  28080,
+  -16846,  28106, -16803,  28132, -16760,  28158, -16717,  28183,
+  -16673,  28209, -16630,  28234, -16587,  28260, -16543,  28285,
+  -16500,  28311, -16456,  28336, -16413,  28361, -16369,  28386,
+  -16326,  28411, -16282,  28436, -16239,  28461, -16195,  28486,
+  -16151,  28511, -16108,  28536, -16064,  28560, -16020,  28585,
+  -15976,  28610, -15932,  28634, -15888,  28658, -15844,  28683,
+  -15800,  28707, -15756,  28731, -15712,  28755, -15668,  28779,
+  -15624,  28803, -15580,  28827, -15535,  28851, -15491,  28875,
+  -15447,  28899, -15402,  28922, -15358,  28946, -15314,  28970,
+  -15269,  28993, -15225,  29016, -15180,  29040, -15136,  29063,
+  -15091,  29086, -15046,  29109, -15002,  29132, -14957,  29155,
+  -14912,  29178, -14867,  29201, -14823,  29224, -14778,  29247,
+  -14733,  29269, -14688,  29292, -14643,  29314, -14598,  29337,
+  -14553,  29359, -14508,  29381, -14463,  29404, -14418,  29426,
+  -14373,  29448, -14327,  29470, -14282,  29492, -14237,  29514,
+  -14192,  29535, -14146,  29557, -14101,  29579, -14056,  29600,
+  -14010,  29622, -13965,  29643, -13919,  29665, -13874,  29686,
+  -13828,  29707, -13783,  29729, -13737,  29750, -13691,  29771,
+  -13646,  29792, -13600,  29813, -13554,  29833, -13508,  29854,
+  -13463,  29875, -13417,  29895, -13371,  29916, -13325,  29936,
+  -13279,  29957, -13233,  29977, -13187,  29997, -13141,  30018,
+  -13095,  30038, -13049,  30058, -13003,  30078, -12957,  30098,
+  -12910,  30118, -12864,  30137, -12818,  30157, -12772,  30177,
+  -12725,  30196, -12679,  30216, -12633,  30235, -12586,  30254,
+  -12540,  30274, -12493,  30293, -12447,  30312, -12400,  30331,
+  -12354,  30350, -12307,  30369, -12261,  30388, -12214,  30407,
+  -12167,  30425, -12121,  30444, -12074,  30462, -12027,  30481,
+  -11980,  30499, -11934,  30518, -11887,  30536, -11840,  30554,
+  -11793,  30572, -11746,  30590, -11699,  30608, -11652,  30626,
+  -11605,  30644, -11558,  30662, -11511,  30680, -11464,  30697,
+  -11417,  30715, -11370,  30732, -11323,  30750, -11276,  30767,
+  -11228,  30784, -11181,  30801, -11134,  30819, -11087,  30836,
+  -11039,  30853, -10992,  30869, -10945,  30886, -10897,  30903,
+  -10850,  30920, -10802,  30936, -10755,  30953, -10707,  30969,
+  -10660,  30986, -10612,  31002, -10565,  31018, -10517,  31034,
+  -10469,  31050, -10422,  31067, -10374,  31082, -10326,  31098,
+  -10279,  31114, -10231,  31130, -10183,  31146, -10135,  31161,
+  -10088,  31177, -10040,  31192,  -9992,  31207,  -9944,  31223,
+   -9896,  31238,  -9848,  31253,  -9800,  31268,  -9752,  31283,
+   -9704,  31298,  -9656,  31313,  -9608,  31328,  -9560,  31342,
+   -9512,  31357,  -9464,  31372,  -9416,  31386,  -9368,  31400,
+   -9319,  31415,  -9271,  31429,  -9223,  31443,  -9175,  31457,
+   -9127,  31471,  -9078,  31485,  -9030,  31499,  -8982,  31513,
+   -8933,  31527,  -8885,  31540,  -8836,  31554,  -8788,  31568,
+   -8740,  31581,  -8691,  31594,  -8643,  31608,  -8594,  31621,
+   -8546,  31634,  -8497,  31647,  -8449,  31660,  -8400,  31673,
+   -8351,  31686,  -8303,  31699,  -8254,  31711,  -8206,  31724,
+   -8157,  31737,  -8108,  31749,  -8059,  31761,  -8011,  31774,
+   -7962,  31786,  -7913,  31798,  -7864,  31810,  -7816,  31822,
+   -7767,  31834,  -7718,  31846,  -7669,  31858,  -7620,  31870,
+   -7571,  31881,  -7522,  31893,  -7473,  31904,  -7425,  31916,
+   -7376,  31927,  -7327,  31938,  -7278,  31950,  -7229,  31961,
+   -7180,  31972,  -7130,  31983,  -7081,  31994,  -7032,  32005,
+   -6983,  32015,  -6934,  32026,  -6885,  32037,  -6836,  32047,
+   -6787,  32058,  -6737,  32068,  -6688,  32078,  -6639,  32088,
+   -6590,  32099,  -6541,  32109,  -6491,  32119,  -6442,  32129,
+   -6393,  32138,  -6343,  32148,  -6294,  32158,  -6245,  32167,
+   -6195,  32177,  -6146,  32186,  -6097,  32196,  -6047,  32205,
+   -5998,  32214,  -5948,  32224,  -5899,  32233,  -5850,  32242,
+   -5800,  32251,  -5751,  32259,  -5701,  32268,  -5652,  32277,
+   -5602,  32286,  -5553,  32294,  -5503,  32303,  -5453,  32311,
+   -5404,  32319,  -5354,  32328,  -5305,  32336,  -5255,  32344,
+   -5205,  32352,  -5156,  32360,  -5106,  32368,  -5057,  32376,
+   -5007,  32383,  -4957,  32391,  -4907,  32398,  -4858,  32406,
+   -4808,  32413,  -4758,  32421,  -4709,  32428,  -4659,  32435,
+   -4609,  32442,  -4559,  32449,  -4510,  32456,  -4460,  32463,
+   -4410,  32470,  -4360,  32477,  -4310,  32483,  -4260,  32490,
+   -4211,  32496,  -4161,  32503,  -4111,  32509,  -4061,  32515,
+   -4011,  32522,  -3961,  32528,  -3911,  32534,  -3861,  32540,
+   -3812,  32546,  -3762,  32551,  -3712,  32557,  -3662,  32563,
+   -3612,  32568,  -3562,  32574,  -3512,  32579,  -3462,  32585,
+   -3412,  32590,  -3362,  32595,  -3312,  32600,  -3262,  32605,
+   -3212,  32610,  -3162,  32615,  -3112,  32620,  -3062,  32625,
+   -3012,  32629,  -2962,  32634,  -2912,  32638,  -2861,  32643,
+   -2811,  32647,  -2761,  32651,  -2711,  32656,  -2661,  32660,
+   -2611,  32664,  -2561,  32668,  -2511,  32672,  -2461,  32675,
+   -2411,  32679,  -2360,  32683,  -2310,  32686,  -2260,  32690,
+   -2210,  32693,  -2160,  32697,  -2110,  32700,  -2060,  32703,
+   -2009,  32706,  -1959,  32709,  -1909,  32712,  -1859,  32715,
+   -1809,  32718,  -1758,  32721,  -1708,  32723,  -1658,  32726,
+   -1608,  32729,  -1558,  32731,  -1507,  32733,  -1457,  32736,
+   -1407,  32738,  -1357,  32740,  -1307,  32742,  -1256,  32744,
+   -1206,  32746,  -1156,  32748,  -1106,  32749,  -1055,  32751,
+   -1005,  32753,   -955,  32754,   -905,  32756,   -854,  32757,
+    -804,  32758,   -754,  32759,   -704,  32760,   -653,  32761,
+    -603,  32762,   -553,  32763,   -503,  32764,   -452,  32765,
+    -402,  32766,   -352,  32766,   -302,  32767,   -251,  32767,
+    -201,  32767,   -151,  32767,   -101,  32767,    -50,  32767,
+};
@@ -0,0 +1,49 @@
+#ifndef DSP_FFT_TABLES_H
+#define DSP_FFT_TABLES_H
+
+#include "dsp_types.h"
+#include "memory_sections.h"
+
+/*
+ * Twiddle tables and placement of the FFT.
+ *
+ * The tables are generated by tools/dsp_fft_tables.py for DSP_FFT_MAX_N;
+ * smaller transforms read them with a stride. Bit reversal needs no table:
+ * RBIT gives the reversed index in one cycle.
+ *
+ * Placement is chosen at build time:
+ *  DSP_FFT_TABLES_DTCM  1: tables in DTCM, copied from flash at boot (~36 KB)
+ *                       0: tables read in place from flash (through the cache)
+ *  DSP_FFT_ITCM         1: transforms run from ITCM, 0: from flash
+ * A caller can also pass its own copy of a table to the init functions,
+ * which is how Bench_Fft compares placements in one build.
+ */
+
+#ifndef DSP_FFT_TABLES_DTCM
+#define DSP_FFT_TABLES_DTCM     0
+#endif
+
+#ifndef DSP_FFT_ITCM
+#define DSP_FFT_ITCM            1
+#endif
+
+#define DSP_FFT_MAX_N           4096U
+#define DSP_FFT_TWIDDLES        (3U * DSP_FFT_MAX_N / 4U)
+
+#if DSP_FFT_TABLES_DTCM
+#define DSP_FFT_TABLE           MEM_DTCM_DATA __attribute__((aligned(8)))
+#else
+#define DSP_FFT_TABLE           __attribute__((aligned(8)))
+#endif
+
+#if DSP_FFT_ITCM
+#define DSP_FFT_TEXT            MEM_ITCM_TEXT
+#else
+#define DSP_FFT_TEXT
+#endif
+
+/* {re, im} pairs of exp(-2j * pi * i / DSP_FFT_MAX_N) */
+extern const float   dsp_fft_twiddle_f32[2U * DSP_FFT_TWIDDLES];
+extern const dsp_q15 dsp_fft_twiddle_q15[2U * DSP_FFT_TWIDDLES];
+
+#endif /* DSP_FFT_TABLES_H */
@@ -0,0 +1,146 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "dsp.h"
+#include "dsp_math.h"
+
+/*
+ * The delay line holds num_taps + 1 samples. Two inputs are pushed, then
+ * both outputs come from one pass over the coefficients: the older
+ * sample's window is the first num_taps of the ring, the newer one's the
+ * last num_taps, and the mirror keeps both contiguous across the wrap.
+ */
+
+dsp_status dsp_fir_init_q15(dsp_fir_inst_q15 *inst, uint16_t num_taps, const dsp_q15 *coeffs, dsp_q15 *state)
+{
+  if ((num_taps == 0U) || (coeffs == NULL) || (state == NULL))
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->num_taps = num_taps;
+  inst->pos = 0U;
+  inst->coeffs = coeffs;
+  inst->state = state;
+  memset(state, 0, 2U * (num_taps + 1U) * sizeof(dsp_q15));
+  return DSP_OK;
+}
+
+dsp_status dsp_fir_init_q31(dsp_fir_inst_q31 *inst, uint16_t num_taps, const dsp_q31 *coeffs, dsp_q31 *state)
+{
+  if ((num_taps == 0U) || (coeffs == NULL) || (state == NULL))
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->num_taps = num_taps;
+  inst->pos = 0U;
+  inst->coeffs = coeffs;
+  inst->state = state;
+  memset(state, 0, 2U * (num_taps + 1U) * sizeof(dsp_q31));
+  return DSP_OK;
+}
+
+dsp_status dsp_fir_init_f32(dsp_fir_inst_f32 *inst, uint16_t num_taps, const float *coeffs, float *state)
+{
+  if ((num_taps == 0U) || (coeffs == NULL) || (state == NULL))
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->num_taps = num_taps;
+  inst->pos = 0U;
+  inst->coeffs = coeffs;
+  inst->state = state;
+  memset(state, 0, 2U * (num_taps + 1U) * sizeof(float));
+  return DSP_OK;
+}
+
+/**
+  * @brief  q15 FIR, 1.15 x 1.15 products summed in 64 bits, result >> 15 saturated.
+  */
+void dsp_fir_q15(dsp_fir_inst_q15 *inst, const dsp_q15 *in, dsp_q15 *out, uint32_t block)
+{
+  const uint16_t n = inst->num_taps;
+  const uint16_t len = (uint16_t)(n + 1U);
+  const dsp_q15 *coeffs = inst->coeffs;
+  dsp_q15 *state = inst->state;
+  uint16_t pos = inst->pos;
+  int64_t acc0;
+  int64_t acc1;
+
+  while (block >= 2U)
+  {
+    pos = dsp_ring_push_q15(state, len, pos, in[0]);
+    pos = dsp_ring_push_q15(state, len, pos, in[1]);
+    dsp_dot2_q15(&state[dsp_ring_base(pos, len)], coeffs, n, &acc0, &acc1);
+    out[0] = dsp_sat_q15(acc0 >> 15);
+    out[1] = dsp_sat_q15(acc1 >> 15);
+    in += 2;
+    out += 2;
+    block -= 2U;
+  }
+  if (block != 0U)
+  {
+    pos = dsp_ring_push_q15(state, len, pos, *in);
+    *out = dsp_sat_q15(dsp_dot_q15(&state[dsp_ring_base(pos, len) + 1U], coeffs, n) >> 15);
+  }
+
+  inst->pos = pos;
+}
+
+/**
+  * @brief  q31 FIR, 1.31 x 1.31 products summed in 64 bits, result >> 31 saturated.
+  */
+void dsp_fir_q31(dsp_fir_inst_q31 *inst, const dsp_q31 *in, dsp_q31 *out, uint32_t block)
+{
+  const uint16_t n = inst->num_taps;
+  const uint16_t len = (uint16_t)(n + 1U);
+  const dsp_q31 *coeffs = inst->coeffs;
+  dsp_q31 *state = inst->state;
+  uint16_t pos = inst->pos;
+  int64_t acc0;
+  int64_t acc1;
+
+  while (block >= 2U)
+  {
+    pos = dsp_ring_push_q31(state, len, pos, in[0]);
+    pos = dsp_ring_push_q31(state, len, pos, in[1]);
+    dsp_dot2_q31(&state[dsp_ring_base(pos, len)], coeffs, n, &acc0, &acc1);
+    out[0] = dsp_sat_q31(acc0 >> 31);
+    out[1] = dsp_sat_q31(acc1 >> 31);
+    in += 2;
+    out += 2;
+    block -= 2U;
+  }
+  if (block != 0U)
+  {
+    pos = dsp_ring_push_q31(state, len, pos, *in);
+    *out = dsp_sat_q31(dsp_dot_q31(&state[dsp_ring_base(pos, len) + 1U], coeffs, n) >> 31);
+  }
+
+  inst->pos = pos;
+}
+
+void dsp_fir_f32(dsp_fir_inst_f32 *inst, const float *in, float *out, uint32_t block)
+{
+  const uint16_t n = inst->num_taps;
+  const uint16_t len = (uint16_t)(n + 1U);
+  const float *coeffs = inst->coeffs;
+  float *state = inst->state;
+  uint16_t pos = inst->pos;
+
+  while (block >= 2U)
+  {
+    pos = dsp_ring_push_f32(state, len, pos, in[0]);
+    pos = dsp_ring_push_f32(state, len, pos, in[1]);
+    dsp_dot2_f32(&state[dsp_ring_base(pos, len)], coeffs, n, &out[0], &out[1]);
+    in += 2;
+    out += 2;
+    block -= 2U;
+  }
+  if (block != 0U)
+  {
+    pos = dsp_ring_push_f32(state, len, pos, *in);
+    *out = dsp_dot_f32(&state[dsp_ring_base(pos, len) + 1U], coeffs, n);
+  }
+
+  inst->pos = pos;
+}
@@ -0,0 +1,367 @@
+#ifndef DSP_MATH_H
+#define DSP_MATH_H
+
+#include <stdint.h>
+
+#include "dsp_types.h"
+
+/*
+ * Saturation, SIMD wrappers, delay-line and dot-product helpers shared by
+ * the filters.
+ *
+ * On a core with the DSP extension dsp_smlald is the M7 dual 16x16 MAC into
+ * a 64-bit accumulator; elsewhere it is plain C with identical results, so
+ * the library builds and can be checked on a host.
+ */
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define DSP_USE_DSP    1
+#include "cmsis_compiler.h"
+#else
+#define DSP_USE_DSP    0
+#endif
+
+typedef uint32_t __attribute__((may_alias, aligned(1))) dsp_u32_unaligned;
+
+/* Two q15 samples as one word; LDR handles the misalignment on the M7 */
+static inline uint32_t dsp_read_q15x2(const dsp_q15 *ptr)
+{
+  return *(const dsp_u32_unaligned *)ptr;
+}
+
+/* Low halfword from lo, high halfword from the low half of hi (PKHBT) */
+static inline uint32_t dsp_pack_q15x2(int32_t lo, uint32_t hi)
+{
+  return ((uint32_t)lo & 0x0000FFFFU) | (hi << 16);
+}
+
+static inline int32_t dsp_lo16(uint32_t pair)
+{
+  return (int16_t)pair;
+}
+
+static inline int32_t dsp_hi16(uint32_t pair)
+{
+  return (int16_t)(pair >> 16);
+}
+
+/*
+ * Packed complex q15 is {re, im} in the low and high halfwords. The halving
+ * add/subtract forms give the FFT its 1/2-per-radix-2-stage scaling for free.
+ */
+#if DSP_USE_DSP
+
+static inline int64_t dsp_smlald(uint32_t a, uint32_t b, int64_t acc)
+{
+  return (int64_t)__SMLALD(a, b, (uint64_t)acc);
+}
+
+static inline int32_t  dsp_smuad(uint32_t a, uint32_t b)    { return (int32_t)__SMUAD(a, b); }
+static inline int32_t  dsp_smuadx(uint32_t a, uint32_t b)   { return (int32_t)__SMUADX(a, b); }
+static inline int32_t  dsp_smusd(uint32_t a, uint32_t b)    { return (int32_t)__SMUSD(a, b); }
+static inline int32_t  dsp_smusdx(uint32_t a, uint32_t b)   { return (int32_t)__SMUSDX(a, b); }
+static inline uint32_t dsp_shadd16(uint32_t a, uint32_t b)  { return __SHADD16(a, b); }
+static inline uint32_t dsp_shsub16(uint32_t a, uint32_t b)  { return __SHSUB16(a, b); }
+static inline uint32_t dsp_shasx(uint32_t a, uint32_t b)    { return __SHASX(a, b); }
+static inline uint32_t dsp_shsax(uint32_t a, uint32_t b)    { return __SHSAX(a, b); }
+static inline int32_t  dsp_ssat16(int32_t x)                { return __SSAT(x, 16); }
+static inline uint32_t dsp_bit_reverse(uint32_t x, uint32_t bits)
+{
+  return __RBIT(x) >> (32U - bits);
+}
+
+#else
+
+static inline int64_t dsp_smlald(uint32_t a, uint32_t b, int64_t acc)
+{
+  return acc + (int32_t)(int16_t)a * (int32_t)(int16_t)b + (int32_t)(int16_t)(a >> 16) * (int32_t)(int16_t)(b >> 16);
+}
+
+static inline int32_t dsp_smuad(uint32_t a, uint32_t b)
+{
+  return dsp_lo16(a) * dsp_lo16(b) + dsp_hi16(a) * dsp_hi16(b);
+}
+
+static inline int32_t dsp_smuadx(uint32_t a, uint32_t b)
+{
+  return dsp_lo16(a) * dsp_hi16(b) + dsp_hi16(a) * dsp_lo16(b);
+}
+
+static inline int32_t dsp_smusd(uint32_t a, uint32_t b)
+{
+  return dsp_lo16(a) * dsp_lo16(b) - dsp_hi16(a) * dsp_hi16(b);
+}
+
+static inline int32_t dsp_smusdx(uint32_t a, uint32_t b)
+{
+  return dsp_lo16(a) * dsp_hi16(b) - dsp_hi16(a) * dsp_lo16(b);
+}
+
+static inline uint32_t dsp_halves(int32_t lo, int32_t hi)
+{
+  return ((uint32_t)(lo >> 1) & 0x0000FFFFU) | ((uint32_t)(hi >> 1) << 16);
+}
+
+static inline uint32_t dsp_shadd16(uint32_t a, uint32_t b)
+{
+  return dsp_halves(dsp_lo16(a) + dsp_lo16(b), dsp_hi16(a) + dsp_hi16(b));
+}
+
+static inline uint32_t dsp_shsub16(uint32_t a, uint32_t b)
+{
+  return dsp_halves(dsp_lo16(a) - dsp_lo16(b), dsp_hi16(a) - dsp_hi16(b));
+}
+
+/* lo = (a.lo - b.hi) / 2, hi = (a.hi + b.lo) / 2 */
+static inline uint32_t dsp_shasx(uint32_t a, uint32_t b)
+{
+  return dsp_halves(dsp_lo16(a) - dsp_hi16(b), dsp_hi16(a) + dsp_lo16(b));
+}
+
+/* lo = (a.lo + b.hi) / 2, hi = (a.hi - b.lo) / 2 */
+static inline uint32_t dsp_shsax(uint32_t a, uint32_t b)
+{
+  return dsp_halves(dsp_lo16(a) + dsp_hi16(b), dsp_hi16(a) - dsp_lo16(b));
+}
+
+static inline int32_t dsp_ssat16(int32_t x)
+{
+  return (x > 32767) ? 32767 : ((x < -32768) ? -32768 : x);
+}
+
+static inline uint32_t dsp_bit_reverse(uint32_t x, uint32_t bits)
+{
+  uint32_t r = 0U;
+
+  while (bits-- != 0U)
+  {
+    r = (r << 1) | (x & 1U);
+    x >>= 1;
+  }
+  return r;
+}
+
+#endif /* DSP_USE_DSP */
+
+static inline dsp_q15 dsp_sat_q15(int64_t x)
+{
+  return (dsp_q15)((x > 32767) ? 32767 : ((x < -32768) ? -32768 : x));
+}
+
+static inline dsp_q31 dsp_sat_q31(int64_t x)
+{
+  return (dsp_q31)((x > INT32_MAX) ? INT32_MAX : ((x < INT32_MIN) ? INT32_MIN : x));
+}
+
+/*
+ * Mirrored delay line (see dsp_types.h): push writes both copies and
+ * returns the next position; the newest len samples, oldest first, start
+ * at dsp_ring_base().
+ */
+static inline uint16_t dsp_ring_next(uint16_t pos, uint16_t len)
+{
+  return (uint16_t)((pos + 1U == len) ? 0U : (pos + 1U));
+}
+
+static inline uint32_t dsp_ring_base(uint16_t pos, uint16_t len)
+{
+  return (pos == 0U) ? len : pos;
+}
+
+static inline uint16_t dsp_ring_push_q15(dsp_q15 *state, uint16_t len, uint16_t pos, dsp_q15 x)
+{
+  state[pos] = x;
+  state[pos + len] = x;
+  return dsp_ring_next(pos, len);
+}
+
+static inline uint16_t dsp_ring_push_q31(dsp_q31 *state, uint16_t len, uint16_t pos, dsp_q31 x)
+{
+  state[pos] = x;
+  state[pos + len] = x;
+  return dsp_ring_next(pos, len);
+}
+
+static inline uint16_t dsp_ring_push_f32(float *state, uint16_t len, uint16_t pos, float x)
+{
+  state[pos] = x;
+  state[pos + len] = x;
+  return dsp_ring_next(pos, len);
+}
+
+/**
+  * @brief  sum(w[j] * c[j]) over n taps, two SMLALD chains so they can dual-issue.
+  */
+static inline int64_t dsp_dot_q15(const dsp_q15 *w, const dsp_q15 *c, uint32_t n)
+{
+  int64_t sum0 = 0;
+  int64_t sum1 = 0;
+
+  while (n >= 4U)
+  {
+    sum0 = dsp_smlald(dsp_read_q15x2(c), dsp_read_q15x2(w), sum0);
+    sum1 = dsp_smlald(dsp_read_q15x2(c + 2), dsp_read_q15x2(w + 2), sum1);
+    c += 4;
+    w += 4;
+    n -= 4U;
+  }
+  while (n > 0U)
+  {
+    sum0 += (int32_t)*c++ * *w++;
+    n--;
+  }
+
+  return sum0 + sum1;
+}
+
+/**
+  * @brief  Two consecutive outputs: acc0 over w[0..n-1], acc1 over w[1..n].
+  *         Each coefficient pair is loaded once for both.
+  */
+static inline void dsp_dot2_q15(const dsp_q15 *w, const dsp_q15 *c, uint32_t n, int64_t *acc0, int64_t *acc1)
+{
+  int64_t sum0 = 0;
+  int64_t sum1 = 0;
+
+  while (n >= 4U)
+  {
+    const uint32_t c01 = dsp_read_q15x2(c);
+    const uint32_t c23 = dsp_read_q15x2(c + 2);
+
+    sum0 = dsp_smlald(c01, dsp_read_q15x2(w), sum0);
+    sum1 = dsp_smlald(c01, dsp_read_q15x2(w + 1), sum1);
+    sum0 = dsp_smlald(c23, dsp_read_q15x2(w + 2), sum0);
+    sum1 = dsp_smlald(c23, dsp_read_q15x2(w + 3), sum1);
+    c += 4;
+    w += 4;
+    n -= 4U;
+  }
+  while (n > 0U)
+  {
+    sum0 += (int32_t)*c * w[0];
+    sum1 += (int32_t)*c * w[1];
+    c++;
+    w++;
+    n--;
+  }
+
+  *acc0 = sum0;
+  *acc1 = sum1;
+}
+
+static inline int64_t dsp_dot_q31(const dsp_q31 *w, const dsp_q31 *c, uint32_t n)
+{
+  int64_t sum0 = 0;
+  int64_t sum1 = 0;
+
+  while (n >= 2U)
+  {
+    sum0 += (int64_t)c[0] * w[0];
+    sum1 += (int64_t)c[1] * w[1];
+    c += 2;
+    w += 2;
+    n -= 2U;
+  }
+  if (n != 0U)
+  {
+    sum0 += (int64_t)*c * *w;
+  }
+
+  return sum0 + sum1;
+}
+
+/**
+  * @brief  Two consecutive outputs; each sample is loaded once and used by both (SMLAL).
+  */
+static inline void dsp_dot2_q31(const dsp_q31 *w, const dsp_q31 *c, uint32_t n, int64_t *acc0, int64_t *acc1)
+{
+  int64_t sum0 = 0;
+  int64_t sum1 = 0;
+  dsp_q31 x0 = *w++;
+
+  while (n >= 2U)
+  {
+    const dsp_q31 x1 = w[0];
+    const dsp_q31 x2 = w[1];
+
+    sum0 += (int64_t)c[0] * x0;
+    sum1 += (int64_t)c[0] * x1;
+    sum0 += (int64_t)c[1] * x1;
+    sum1 += (int64_t)c[1] * x2;
+    x0 = x2;
+    c += 2;
+    w += 2;
+    n -= 2U;
+  }
+  if (n != 0U)
+  {
+    sum0 += (int64_t)*c * x0;
+    sum1 += (int64_t)*c * *w;
+  }
+
+  *acc0 = sum0;
+  *acc1 = sum1;
+}
+
+static inline float dsp_dot_f32(const float *w, const float *c, uint32_t n)
+{
+  float sum0 = 0.0f;
+  float sum1 = 0.0f;
+  float sum2 = 0.0f;
+  float sum3 = 0.0f;
+
+  while (n >= 4U)
+  {
+    sum0 += c[0] * w[0];
+    sum1 += c[1] * w[1];
+    sum2 += c[2] * w[2];
+    sum3 += c[3] * w[3];
+    c += 4;
+    w += 4;
+    n -= 4U;
+  }
+  while (n > 0U)
+  {
+    sum0 += *c++ * *w++;
+    n--;
+  }
+
+  return (sum0 + sum1) + (sum2 + sum3);
+}
+
+/**
+  * @brief  Two consecutive outputs, four independent VFMA chains.
+  */
+static inline void dsp_dot2_f32(const float *w, const float *c, uint32_t n, float *acc0, float *acc1)
+{
+  float sum0 = 0.0f;
+  float sum1 = 0.0f;
+  float sum2 = 0.0f;
+  float sum3 = 0.0f;
+  float x0 = *w++;
+
+  while (n >= 2U)
+  {
+    const float x1 = w[0];
+    const float x2 = w[1];
+
+    sum0 += c[0] * x0;
+    sum1 += c[0] * x1;
+    sum2 += c[1] * x1;
+    sum3 += c[1] * x2;
+    x0 = x2;
+    c += 2;
+    w += 2;
+    n -= 2U;
+  }
+  if (n != 0U)
+  {
+    sum0 += *c * x0;
+    sum1 += *c * *w;
+  }
+
+  *acc0 = sum0 + sum2;
+  *acc1 = sum1 + sum3;
+}
+
+#endif /* DSP_MATH_H */
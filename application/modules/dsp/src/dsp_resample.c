@@ -0,0 +1,286 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "dsp.h"
+#include "dsp_math.h"
+
+/*
+ * Polyphase resampling. The decimator pushes every input but evaluates the
+ * FIR only for the outputs it keeps, so it costs num_taps / factor MACs per
+ * input. The interpolator evaluates each of its factor sub-filters of
+ * num_taps / factor taps once per input instead of filtering the
+ * zero-stuffed signal.
+ *
+ * Sub-filter p holds the prototype taps h[p], h[p + L], ... time-reversed,
+ * so output p of input n is one contiguous dot product over the delay line.
+ */
+
+dsp_status dsp_decim_init_q15(dsp_decim_inst_q15 *inst, uint16_t factor, uint16_t num_taps,
+                              const dsp_q15 *coeffs, dsp_q15 *state)
+{
+  if (factor == 0U)
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->factor = factor;
+  inst->phase = 0U;
+  return dsp_fir_init_q15(&inst->fir, num_taps, coeffs, state);
+}
+
+dsp_status dsp_decim_init_q31(dsp_decim_inst_q31 *inst, uint16_t factor, uint16_t num_taps,
+                              const dsp_q31 *coeffs, dsp_q31 *state)
+{
+  if (factor == 0U)
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->factor = factor;
+  inst->phase = 0U;
+  return dsp_fir_init_q31(&inst->fir, num_taps, coeffs, state);
+}
+
+dsp_status dsp_decim_init_f32(dsp_decim_inst_f32 *inst, uint16_t factor, uint16_t num_taps,
+                              const float *coeffs, float *state)
+{
+  if (factor == 0U)
+  {
+    return DSP_ARG_ERROR;
+  }
+  inst->factor = factor;
+  inst->phase = 0U;
+  return dsp_fir_init_f32(&inst->fir, num_taps, coeffs, state);
+}
+
+uint32_t dsp_decim_q15(dsp_decim_inst_q15 *inst, const dsp_q15 *in, dsp_q15 *out, uint32_t block)
+{
+  const uint16_t n = inst->fir.num_taps;
+  const uint16_t len = (uint16_t)(n + 1U);
+  dsp_q15 *state = inst->fir.state;
+  uint16_t pos = inst->fir.pos;
+  uint16_t phase = inst->phase;
+  uint32_t count = 0U;
+
+  while (block-- != 0U)
+  {
+    pos = dsp_ring_push_q15(state, len, pos, *in++);
+    if (++phase == inst->factor)
+    {
+      phase = 0U;
+      out[count++] = dsp_sat_q15(dsp_dot_q15(&state[dsp_ring_base(pos, len) + 1U], inst->fir.coeffs, n) >> 15);
+    }
+  }
+
+  inst->fir.pos = pos;
+  inst->phase = phase;
+  return count;
+}
+
+uint32_t dsp_decim_q31(dsp_decim_inst_q31 *inst, const dsp_q31 *in, dsp_q31 *out, uint32_t block)
+{
+  const uint16_t n = inst->fir.num_taps;
+  const uint16_t len = (uint16_t)(n + 1U);
+  dsp_q31 *state = inst->fir.state;
+  uint16_t pos = inst->fir.pos;
+  uint16_t phase = inst->phase;
+  uint32_t count = 0U;
+
+  while (block-- != 0U)
+  {
+    pos = dsp_ring_push_q31(state, len, pos, *in++);
+    if (++phase == inst->factor)
+    {
+      phase = 0U;
+      out[count++] = dsp_sat_q31(dsp_dot_q31(&state[dsp_ring_base(pos, len) + 1U], inst->fir.coeffs, n) >> 31);
+    }
+  }
+
+  inst->fir.pos = pos;
+  inst->phase = phase;
+  return count;
+}
+
+uint32_t dsp_decim_f32(dsp_decim_inst_f32 *inst, const float *in, float *out, uint32_t block)
+{
+  const uint16_t n = inst->fir.num_taps;
+  const uint16_t len = (uint16_t)(n + 1U);
+  float *state = inst->fir.state;
+  uint16_t pos = inst->fir.pos;
+  uint16_t phase = inst->phase;
+  uint32_t count = 0U;
+
+  while (block-- != 0U)
+  {
+    pos = dsp_ring_push_f32(state, len, pos, *in++);
+    if (++phase == inst->factor)
+    {
+      phase = 0U;
+      out[count++] = dsp_dot_f32(&state[dsp_ring_base(pos, len) + 1U], inst->fir.coeffs, n);
+    }
+  }
+
+  inst->fir.pos = pos;
+  inst->phase = phase;
+  return count;
+}
+
+/* Index into the time-reversed prototype of sub-filter p, tap j (oldest sample first) */
+static uint32_t dsp_interp_tap(uint16_t factor, uint16_t num_taps, uint16_t phase_len, uint32_t p, uint32_t j)
+{
+  return (uint32_t)num_taps - 1U - p - ((uint32_t)phase_len - 1U - j) * factor;
+}
+
+dsp_status dsp_interp_init_q15(dsp_interp_inst_q15 *inst, uint16_t factor, uint16_t num_taps,
+                               const dsp_q15 *prototype, dsp_q15 *coeffs, dsp_q15 *state)
+{
+  const uint16_t phase_len = (factor != 0U) ? (uint16_t)(num_taps / factor) : 0U;
+  uint32_t p, j;
+
+  if ((phase_len == 0U) || ((num_taps % factor) != 0U) || (prototype == NULL) || (coeffs == NULL) ||
+      (state == NULL))
+  {
+    return DSP_ARG_ERROR;
+  }
+
+  for (p = 0U; p < factor; p++)
+  {
+    for (j = 0U; j < phase_len; j++)
+    {
+      coeffs[p * phase_len + j] = prototype[dsp_interp_tap(factor, num_taps, phase_len, p, j)];
+    }
+  }
+  inst->factor = factor;
+  inst->phase_len = phase_len;
+  inst->pos = 0U;
+  inst->coeffs = coeffs;
+  inst->state = state;
+  memset(state, 0, 2U * phase_len * sizeof(dsp_q15));
+  return DSP_OK;
+}
+
+dsp_status dsp_interp_init_q31(dsp_interp_inst_q31 *inst, uint16_t factor, uint16_t num_taps,
+                               const dsp_q31 *prototype, dsp_q31 *coeffs, dsp_q31 *state)
+{
+  const uint16_t phase_len = (factor != 0U) ? (uint16_t)(num_taps / factor) : 0U;
+  uint32_t p, j;
+
+  if ((phase_len == 0U) || ((num_taps % factor) != 0U) || (prototype == NULL) || (coeffs == NULL) ||
+      (state == NULL))
+  {
+    return DSP_ARG_ERROR;
+  }
+
+  for (p = 0U; p < factor; p++)
+  {
+    for (j = 0U; j < phase_len; j++)
+    {
+      coeffs[p * phase_len + j] = prototype[dsp_interp_tap(factor, num_taps, phase_len, p, j)];
+    }
+  }
+  inst->factor = factor;
+  inst->phase_len = phase_len;
+  inst->pos = 0U;
+  inst->coeffs = coeffs;
+  inst->state = state;
+  memset(state, 0, 2U * phase_len * sizeof(dsp_q31));
+  return DSP_OK;
+}
+
+dsp_status dsp_interp_init_f32(dsp_interp_inst_f32 *inst, uint16_t factor, uint16_t num_taps,
+                               const float *prototype, float *coeffs, float *state)
+{
+  const uint16_t phase_len = (factor != 0U) ? (uint16_t)(num_taps / factor) : 0U;
+  uint32_t p, j;
+
+  if ((phase_len == 0U) || ((num_taps % factor) != 0U) || (prototype == NULL) || (coeffs == NULL) ||
+      (state == NULL))
+  {
+    return DSP_ARG_ERROR;
+  }
+
+  for (p = 0U; p < factor; p++)
+  {
+    for (j = 0U; j < phase_len; j++)
+    {
+      coeffs[p * phase_len + j] = prototype[dsp_interp_tap(factor, num_taps, phase_len, p, j)];
+    }
+  }
+  inst->factor = factor;
+  inst->phase_len = phase_len;
+  inst->pos = 0U;
+  inst->coeffs = coeffs;
+  inst->state = state;
+  memset(state, 0, 2U * phase_len * sizeof(float));
+  return DSP_OK;
+}
+
+void dsp_interp_q15(dsp_interp_inst_q15 *inst, const dsp_q15 *in, dsp_q15 *out, uint32_t block)
+{
+  const uint16_t n = inst->phase_len;
+  dsp_q15 *state = inst->state;
+  uint16_t pos = inst->pos;
+  uint32_t p;
+
+  while (block-- != 0U)
+  {
+    const dsp_q15 *window;
+    const dsp_q15 *coeffs = inst->coeffs;
+
+    pos = dsp_ring_push_q15(state, n, pos, *in++);
+    window = &state[dsp_ring_base(pos, n)];
+    for (p = 0U; p < inst->factor; p++)
+    {
+      *out++ = dsp_sat_q15(dsp_dot_q15(window, coeffs, n) >> 15);
+      coeffs += n;
+    }
+  }
+
+  inst->pos = pos;
+}
+
+void dsp_interp_q31(dsp_interp_inst_q31 *inst, const dsp_q31 *in, dsp_q31 *out, uint32_t block)
+{
+  const uint16_t n = inst->phase_len;
+  dsp_q31 *state = inst->state;
+  uint16_t pos = inst->pos;
+  uint32_t p;
+
+  while (block-- != 0U)
+  {
+    const dsp_q31 *window;
+    const dsp_q31 *coeffs = inst->coeffs;
+
+    pos = dsp_ring_push_q31(state, n, pos, *in++);
+    window = &state[dsp_ring_base(pos, n)];
+    for (p = 0U; p < inst->factor; p++)
+    {
+      *out++ = dsp_sat_q31(dsp_dot_q31(window, coeffs, n) >> 31);
+      coeffs += n;
+    }
+  }
+
+  inst->pos = pos;
+}
+
+void dsp_interp_f32(dsp_interp_inst_f32 *inst, const float *in, float *out, uint32_t block)
+{
+  const uint16_t n = inst->phase_len;
+  float *state = inst->state;
+  uint16_t pos = inst->pos;
+  uint32_t p;
+
+  while (block-- != 0U)
+  {
+    const float *window;
+    const float *coeffs = inst->coeffs;
+
+    pos = dsp_ring_push_f32(state, n, pos, *in++);
+    window = &state[dsp_ring_base(pos, n)];
+    for (p = 0U; p < inst->factor; p++)
+    {
+      *out++ = dsp_dot_f32(window, coeffs, n);
+      coeffs += n;
+    }
+  }
+
+  inst->pos = pos;
+}
@@ -0,0 +1,168 @@
+#ifndef DSP_TYPES_H
+#define DSP_TYPES_H
+
+#include <stdint.h>
+
+/*
+ * Types shared by the filter library.
+ *
+ * Conventions follow CMSIS-DSP so coefficient sets designed for it can be
+ * reused unchanged:
+ *  - FIR coefficients are stored time-reversed, {b[N-1], ..., b[1], b[0]}.
+ *  - Biquad feedback coefficients are negated: each stage computes
+ *    y = b0*x + b1*x1 + b2*x2 + a1*y1 + a2*y2.
+ *  - q15 and q31 accumulate in 64 bits; results saturate to the output type.
+ */
+
+typedef int16_t dsp_q15;   /*!< 1.15 fixed point */
+typedef int32_t dsp_q31;   /*!< 1.31 fixed point */
+
+typedef enum
+{
+  DSP_OK = 0,
+  DSP_ARG_ERROR,
+} dsp_status;
+
+/*
+ * FIR delay lines are mirrored rings of num_taps + 1 samples stored twice:
+ * each input is written at pos and pos + num_taps + 1, so the newest
+ * samples are always contiguous and no block-end memmove is needed.
+ */
+typedef struct
+{
+  uint16_t      num_taps;
+  uint16_t      pos;
+  const dsp_q15 *coeffs;   /*!< num_taps, time-reversed, 4-byte aligned */
+  dsp_q15       *state;    /*!< 2 * (num_taps + 1) */
+} dsp_fir_inst_q15;
+
+typedef struct
+{
+  uint16_t      num_taps;
+  uint16_t      pos;
+  const dsp_q31 *coeffs;
+  dsp_q31       *state;
+} dsp_fir_inst_q31;
+
+typedef struct
+{
+  uint16_t    num_taps;
+  uint16_t    pos;
+  const float *coeffs;
+  float       *state;
+} dsp_fir_inst_f32;
+
+/* Decimators are an FIR evaluated once every factor inputs */
+typedef struct
+{
+  dsp_fir_inst_q15 fir;
+  uint16_t         factor;
+  uint16_t         phase;
+} dsp_decim_inst_q15;
+
+typedef struct
+{
+  dsp_fir_inst_q31 fir;
+  uint16_t         factor;
+  uint16_t         phase;
+} dsp_decim_inst_q31;
+
+typedef struct
+{
+  dsp_fir_inst_f32 fir;
+  uint16_t         factor;
+  uint16_t         phase;
+} dsp_decim_inst_f32;
+
+/*
+ * Interpolators run factor sub-filters of phase_len taps over one delay
+ * line. The prototype is re-laid out by phase at init so every sub-filter
+ * is a contiguous dot product.
+ */
+typedef struct
+{
+  uint16_t      factor;
+  uint16_t      phase_len;
+  uint16_t      pos;
+  const dsp_q15 *coeffs;   /*!< factor * phase_len, polyphase order */
+  dsp_q15       *state;    /*!< 2 * phase_len */
+} dsp_interp_inst_q15;
+
+typedef struct
+{
+  uint16_t      factor;
+  uint16_t      phase_len;
+  uint16_t      pos;
+  const dsp_q31 *coeffs;
+  dsp_q31       *state;
+} dsp_interp_inst_q31;
+
+typedef struct
+{
+  uint16_t    factor;
+  uint16_t    phase_len;
+  uint16_t    pos;
+  const float *coeffs;
+  float       *state;
+} dsp_interp_inst_f32;
+
+/* Biquad cascades: direct form I for the fixed-point types, transposed form II for f32 */
+typedef struct
+{
+  uint8_t       stages;
+  int8_t        post_shift;   /*!< Coefficients are scaled down by 2^post_shift */
+  const dsp_q15 *coeffs;      /*!< 6 per stage: {b0, 0, b1, b2, a1, a2} */
+  dsp_q15       *state;       /*!< 4 per stage: {x1, x2, y1, y2} */
+} dsp_biquad_inst_q15;
+
+typedef struct
+{
+  uint8_t       stages;
+  int8_t        post_shift;
+  const dsp_q31 *coeffs;      /*!< 5 per stage: {b0, b1, b2, a1, a2} */
+  dsp_q31       *state;       /*!< 4 per stage: {x1, x2, y1, y2} */
+} dsp_biquad_inst_q31;
+
+typedef struct
+{
+  uint8_t     stages;
+  const float *coeffs;        /*!< 5 per stage: {b0, b1, b2, a1, a2} */
+  float       *state;         /*!< 2 per stage: {d1, d2} */
+} dsp_biquad_inst_f32;
+
+/*
+ * FFTs work in place on interleaved {re, im} data. Twiddles are read from
+ * a DSP_FFT_MAX_N table with a stride of DSP_FFT_MAX_N / n.
+ */
+typedef struct
+{
+  uint16_t    n;           /*!< Complex points, power of two */
+  uint8_t     log2n;
+  uint16_t    stride;
+  const float *twiddles;
+} dsp_cfft_inst_f32;
+
+typedef struct
+{
+  uint16_t      n;
+  uint8_t       log2n;
+  uint16_t      stride;
+  const dsp_q15 *twiddles;   /*!< 4-byte aligned */
+} dsp_cfft_inst_q15;
+
+/* Real FFTs of n points run an n/2-point complex FFT plus a split pass */
+typedef struct
+{
+  dsp_cfft_inst_f32 cfft;
+  uint16_t          n;       /*!< Real points */
+  uint16_t          stride;  /*!< Split-pass twiddle stride, DSP_FFT_MAX_N / n */
+} dsp_rfft_inst_f32;
+
+typedef struct
+{
+  dsp_cfft_inst_q15 cfft;
+  uint16_t          n;
+  uint16_t          stride;
+} dsp_rfft_inst_q15;
+
+#endif /* DSP_TYPES_H */
@@ -0,0 +1,80 @@
+#include "event_group.h"
+#include "irq_config.h"
+
+void EventGroup_Init(EventGroup_TypeDef *group)
+{
+  group->Bits = 0U;
+}
+
+/**
+  * @brief  Sets bits and wakes any waiter.
+  * @retval Bits after the update.
+  */
+uint32_t EventGroup_Set(EventGroup_TypeDef *group, uint32_t bits)
+{
+  uint32_t value;
+
+  IRQ_KERNEL_API_CHECK();
+
+  do
+  {
+    value = __LDREXW(&group->Bits) | bits;
+  } while (__STREXW(value, &group->Bits) != 0U);
+
+  __DSB();
+  __SEV();
+
+  return value;
+}
+
+/**
+  * @retval Bits before the update.
+  */
+uint32_t EventGroup_Clear(EventGroup_TypeDef *group, uint32_t bits)
+{
+  uint32_t value;
+
+  IRQ_KERNEL_API_CHECK();
+
+  do
+  {
+    value = __LDREXW(&group->Bits);
+  } while (__STREXW(value & ~bits, &group->Bits) != 0U);
+
+  return value;
+}
+
+/**
+  * @brief  Waits until any (or all) of @p bits are set.
+  * @param  Timeout Timeout in ms, HAL_MAX_DELAY to wait forever, 0 to poll.
+  * @retval The matched bits, or 0 on timeout.
+  */
+uint32_t EventGroup_Wait(EventGroup_TypeDef *group, uint32_t bits, uint32_t options, uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t match;
+
+  IRQ_KERNEL_API_CHECK();
+
+  for (;;)
+  {
+    match = group->Bits & bits;
+
+    if (((options & EVENT_GROUP_WAIT_ALL) != 0U) ? (match == bits) : (match != 0U))
+    {
+      if ((options & EVENT_GROUP_WAIT_CLEAR) != 0U)
+      {
+        (void)EventGroup_Clear(group, match);
+      }
+      return match;
+    }
+
+    if ((Timeout != HAL_MAX_DELAY) && ((HAL_GetTick() - tickstart) >= Timeout))
+    {
+      return 0U;
+    }
+
+    /* SysTick wakes us at least once per tick, so the timeout stays live */
+    __WFE();
+  }
+}
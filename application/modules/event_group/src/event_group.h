@@ -0,0 +1,31 @@
+#ifndef EVENT_GROUP_H
+#define EVENT_GROUP_H
+
+#include "stm32h7xx_hal.h"
+
+/*
+ * 32-bit event flags shared between interrupt handlers and thread code.
+ * Set/Clear are lock-free (LDREX/STREX) and safe from any kernel-aware
+ * priority. They are kernel APIs all the same: IRQ_KERNEL_API_CHECK() flags
+ * calls from the zero-latency band. Waiters sleep on WFE; every set issues SEV.
+ */
+typedef struct
+{
+  volatile uint32_t Bits;
+} EventGroup_TypeDef;
+
+#define EVENT_GROUP_WAIT_ANY     0x00U
+#define EVENT_GROUP_WAIT_ALL     0x01U
+#define EVENT_GROUP_WAIT_CLEAR   0x02U   /*!< Clear the matched bits on return */
+
+void     EventGroup_Init(EventGroup_TypeDef *group);
+uint32_t EventGroup_Set(EventGroup_TypeDef *group, uint32_t bits);
+uint32_t EventGroup_Clear(EventGroup_TypeDef *group, uint32_t bits);
+uint32_t EventGroup_Wait(EventGroup_TypeDef *group, uint32_t bits, uint32_t options, uint32_t Timeout);
+
+__STATIC_FORCEINLINE uint32_t EventGroup_Get(const EventGroup_TypeDef *group)
+{
+  return group->Bits;
+}
+
+#endif /* EVENT_GROUP_H */
@@ -0,0 +1,396 @@
+#include <string.h>
+
+#include "exti_dispatch.h"
+#include "gpio_fast.h"
+#include "irq_config.h"
+#include "perf.h"
+
+#ifdef IRQ_LATENCY_MODULE_ENABLED
+#define EXTI_DISP_RESERVED   0x0007U   /*!< irq_latency's lines 0-2 */
+#else
+#define EXTI_DISP_RESERVED   0x0000U
+#endif
+
+#define EXTI_DISP_VECTORS    7U
+
+typedef struct
+{
+  /* Called by the vector: the user's callback, or the group or debounce handler */
+  EXTIDisp_CallbackTypeDef Handler;
+  void                    *Context;
+
+  /* What a debounce window reports to */
+  EXTIDisp_CallbackTypeDef Callback;
+  void                    *CallbackContext;
+
+  EventGroup_TypeDef      *Group;
+  uint32_t                 Bits;
+  GPIO_TypeDef            *Port;
+  uint32_t                 Trigger;
+  uint32_t                 DebounceMs;
+  volatile uint32_t        Deadline;    /*!< Tick at which the window closes */
+  volatile uint32_t        Level;       /*!< Last level reported */
+} EXTIDisp_LineTypeDef;
+
+static EXTIDisp_LineTypeDef  exti_disp_line[EXTI_DISP_LINES];
+static volatile uint32_t     exti_disp_debouncing;   /* One bit per line with a window open */
+static uint32_t              exti_disp_vector_users[EXTI_DISP_VECTORS];
+static uint32_t              exti_disp_vector_prio[EXTI_DISP_VECTORS];
+static EXTIDisp_StatsTypeDef exti_disp_stats;
+
+static const IRQn_Type exti_disp_irqn[EXTI_DISP_VECTORS] =
+{
+  EXTI0_IRQn, EXTI1_IRQn, EXTI2_IRQn, EXTI3_IRQn, EXTI4_IRQn, EXTI9_5_IRQn, EXTI15_10_IRQn
+};
+
+static uint32_t EXTIDisp_Vector(uint32_t line)
+{
+  if (line < 5U)
+  {
+    return line;
+  }
+  return (line < 10U) ? 5U : 6U;
+}
+
+/* Debounce mask updates, from any priority: EventGroup_Set() is a kernel API */
+static void EXTIDisp_MaskSet(uint32_t bits)
+{
+  uint32_t value;
+
+  do
+  {
+    value = __LDREXW(&exti_disp_debouncing) | bits;
+  } while (__STREXW(value, &exti_disp_debouncing) != 0U);
+}
+
+static void EXTIDisp_MaskClear(uint32_t bits)
+{
+  uint32_t value;
+
+  do
+  {
+    value = __LDREXW(&exti_disp_debouncing) & ~bits;
+  } while (__STREXW(value, &exti_disp_debouncing) != 0U);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Handlers                                                                  */
+
+static void EXTIDisp_SetBits(uint32_t line, void *context)
+{
+  const EXTIDisp_LineTypeDef *entry = (const EXTIDisp_LineTypeDef *)context;
+
+  (void)line;
+  (void)EventGroup_Set(entry->Group, entry->Bits);
+}
+
+/* First edge opens the window; the rest are bounces */
+static void EXTIDisp_Debounce(uint32_t line, void *context)
+{
+  EXTIDisp_LineTypeDef *entry = (EXTIDisp_LineTypeDef *)context;
+
+  if ((exti_disp_debouncing & (1UL << line)) != 0U)
+  {
+    exti_disp_stats.Bounces++;
+    return;
+  }
+  entry->Deadline = HAL_GetTick() + entry->DebounceMs;
+  EXTIDisp_MaskSet(1UL << line);
+}
+
+/**
+  * @brief  Serves the pending lines of one vector, highest first.
+  */
+__STATIC_FORCEINLINE void EXTIDisp_Dispatch(uint32_t lines)
+{
+  const uint32_t start = PERF_Cycles();
+  uint32_t pending = EXTI_D1->PR1 & lines;
+  uint32_t first = 1U;
+  uint32_t cycles;
+  uint32_t line;
+  const EXTIDisp_LineTypeDef *entry;
+
+  exti_disp_stats.Entries++;
+  if (pending == 0U)
+  {
+    exti_disp_stats.Spurious++;
+    return;
+  }
+
+  do
+  {
+    line = 31U - __CLZ(pending);
+    pending &= ~(1UL << line);
+    EXTI_D1->PR1 = 1UL << line;
+
+    entry = &exti_disp_line[line];
+    if (entry->Handler != NULL)
+    {
+      if (first != 0U)
+      {
+        first = 0U;
+        cycles = PERF_Elapsed(start);
+        if (cycles > exti_disp_stats.MaxCycles)
+        {
+          exti_disp_stats.MaxCycles = cycles;
+        }
+        exti_disp_stats.TotalCycles += cycles;
+      }
+      exti_disp_stats.Dispatches++;
+      entry->Handler(line, entry->Context);
+    }
+
+    if (pending == 0U)
+    {
+      pending = EXTI_D1->PR1 & lines;
+    }
+  } while (pending != 0U);
+}
+
+/* ------------------------------------------------------------------------ */
+/* API                                                                       */
+
+/**
+  * @brief  Routes a line to a callback or event group bits, and enables it.
+  * @retval HAL_BUSY if the line is registered already, HAL_ERROR for a bad
+  *         configuration, a line of irq_latency, event group bits raised
+  *         from the zero-latency band, or a priority other than that of a
+  *         vector already in use.
+  */
+HAL_StatusTypeDef EXTIDisp_Register(uint32_t line, const EXTIDisp_LineConfigTypeDef *config)
+{
+  EXTIDisp_LineTypeDef *entry;
+  EXTI_HandleTypeDef    hexti;
+  EXTI_ConfigTypeDef    exti = {0};
+  uint32_t              vector;
+
+  if ((line >= EXTI_DISP_LINES) || (((1UL << line) & EXTI_DISP_RESERVED) != 0U) || (config == NULL) ||
+      ((config->Callback == NULL) && ((config->Group == NULL) || (config->Bits == 0U))) ||
+      ((config->Trigger & EXTI_TRIGGER_RISING_FALLING) == 0U) ||
+      ((config->Trigger & ~EXTI_TRIGGER_RISING_FALLING) != 0U) ||
+      ((config->DebounceMs != 0U) && (config->Port == NULL)) ||
+      ((config->Callback == NULL) && (config->DebounceMs == 0U) &&
+       (config->Priority < IRQ_PRIO_KERNEL_MAX_SYSCALL)))
+  {
+    return HAL_ERROR;
+  }
+
+  entry = &exti_disp_line[line];
+  vector = EXTIDisp_Vector(line);
+  if (entry->Handler != NULL)
+  {
+    return HAL_BUSY;
+  }
+  if ((exti_disp_vector_users[vector] != 0U) && (exti_disp_vector_prio[vector] != config->Priority))
+  {
+    return HAL_ERROR;
+  }
+
+  memset(entry, 0, sizeof(*entry));
+  entry->Callback = config->Callback;
+  entry->CallbackContext = config->Context;
+  entry->Group = config->Group;
+  entry->Bits = config->Bits;
+  entry->Port = config->Port;
+  entry->Trigger = config->Trigger;
+  entry->DebounceMs = config->DebounceMs;
+  EXTIDisp_MaskClear(1UL << line);
+
+  exti.Line = EXTI_GPIO | EXTI_EVENT | EXTI_REG1 | EXTI_TARGET_MSK_ALL | line;
+  exti.Mode = EXTI_MODE_INTERRUPT;
+  exti.Trigger = config->Trigger;
+  exti.GPIOSel = EXTI_GPIOA;
+
+  if (config->Port != NULL)
+  {
+    GPIOFast_InitInput(GPIO_FAST_PIN(config->Port, 1UL << line), config->Pull);
+    exti.GPIOSel = ((uint32_t)config->Port - GPIOA_BASE) / 0x400U;
+    entry->Level = (GPIOFast_Read(GPIO_FAST_PIN(config->Port, 1UL << line)) != 0U) ? 1U : 0U;
+  }
+  else
+  {
+    exti.Trigger = EXTI_TRIGGER_NONE;   /* Left on PA, but deaf to it */
+  }
+
+  if (config->DebounceMs != 0U)
+  {
+    /* Both edges, filtered by Trigger when the window closes */
+    exti.Trigger = EXTI_TRIGGER_RISING_FALLING;
+    entry->Handler = EXTIDisp_Debounce;
+    entry->Context = entry;
+  }
+  else if (config->Callback != NULL)
+  {
+    entry->Handler = config->Callback;
+    entry->Context = config->Context;
+  }
+  else
+  {
+    entry->Handler = EXTIDisp_SetBits;
+    entry->Context = entry;
+  }
+
+  __HAL_RCC_SYSCFG_CLK_ENABLE();
+  EXTI_D1->PR1 = 1UL << line;
+  (void)HAL_EXTI_SetConfigLine(&hexti, &exti);
+
+  if (exti_disp_vector_users[vector]++ == 0U)
+  {
+    exti_disp_vector_prio[vector] = config->Priority;
+    IRQ_Config_SetPriority(exti_disp_irqn[vector], config->Priority);
+    HAL_NVIC_EnableIRQ(exti_disp_irqn[vector]);
+  }
+  return HAL_OK;
+}
+
+void EXTIDisp_Unregister(uint32_t line)
+{
+  EXTI_HandleTypeDef hexti;
+  uint32_t           vector;
+
+  if ((line >= EXTI_DISP_LINES) || (exti_disp_line[line].Handler == NULL))
+  {
+    return;
+  }
+
+  hexti.Line = EXTI_GPIO | EXTI_EVENT | EXTI_REG1 | EXTI_TARGET_MSK_ALL | line;
+  (void)HAL_EXTI_ClearConfigLine(&hexti);
+  EXTI_D1->PR1 = 1UL << line;
+
+  vector = EXTIDisp_Vector(line);
+  if (--exti_disp_vector_users[vector] == 0U)
+  {
+    HAL_NVIC_DisableIRQ(exti_disp_irqn[vector]);
+  }
+  __DSB();
+
+  /* The vector may be serving the line still, from a higher priority */
+  exti_disp_line[line].Handler = NULL;
+  EXTIDisp_MaskClear(1UL << line);
+}
+
+void EXTIDisp_Trigger(uint32_t line)
+{
+  if (line < EXTI_DISP_LINES)
+  {
+    EXTI->SWIER1 = 1UL << line;
+  }
+}
+
+uint32_t EXTIDisp_GetLevel(uint32_t line)
+{
+  return (line < EXTI_DISP_LINES) ? exti_disp_line[line].Level : 0U;
+}
+
+/**
+  * @brief  Closes the debounce windows that are due and reports the lines
+  *         whose level has changed as their Trigger asks.
+  */
+void EXTIDisp_Tick(void)
+{
+  uint32_t open = exti_disp_debouncing;
+  uint32_t now;
+  uint32_t line;
+  uint32_t level;
+  EXTIDisp_LineTypeDef *entry;
+
+  if (open == 0U)
+  {
+    return;
+  }
+
+  now = HAL_GetTick();
+  do
+  {
+    line = 31U - __CLZ(open);
+    open &= ~(1UL << line);
+    entry = &exti_disp_line[line];
+    if ((int32_t)(now - entry->Deadline) < 0)
+    {
+      continue;
+    }
+
+    /* Closed before the read: a later edge opens a new window and is not lost */
+    EXTIDisp_MaskClear(1UL << line);
+    level = (GPIOFast_Read(GPIO_FAST_PIN(entry->Port, 1UL << line)) != 0U) ? 1U : 0U;
+    if (level == entry->Level)
+    {
+      exti_disp_stats.Filtered++;
+      continue;
+    }
+    entry->Level = level;
+    if ((entry->Trigger & ((level != 0U) ? EXTI_TRIGGER_RISING : EXTI_TRIGGER_FALLING)) == 0U)
+    {
+      continue;
+    }
+
+    exti_disp_stats.Dispatches++;
+    if (entry->Callback != NULL)
+    {
+      entry->Callback(line, entry->CallbackContext);
+    }
+    else
+    {
+      (void)EventGroup_Set(entry->Group, entry->Bits);
+    }
+  } while (open != 0U);
+}
+
+void EXTIDisp_GetStats(EXTIDisp_StatsTypeDef *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *stats = exti_disp_stats;
+  __set_PRIMASK(primask);
+}
+
+void EXTIDisp_ResetStats(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  memset(&exti_disp_stats, 0, sizeof(exti_disp_stats));
+  __set_PRIMASK(primask);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Vectors                                                                   */
+
+#ifndef IRQ_LATENCY_MODULE_ENABLED
+void EXTI0_IRQHandler(void)
+{
+  EXTIDisp_Dispatch(EXTI_IMR1_IM0);
+}
+
+void EXTI1_IRQHandler(void)
+{
+  EXTIDisp_Dispatch(EXTI_IMR1_IM1);
+}
+
+void EXTI2_IRQHandler(void)
+{
+  EXTIDisp_Dispatch(EXTI_IMR1_IM2);
+}
+#endif
+
+void EXTI3_IRQHandler(void)
+{
+  EXTIDisp_Dispatch(EXTI_IMR1_IM3);
+}
+
+void EXTI4_IRQHandler(void)
+{
+  EXTIDisp_Dispatch(EXTI_IMR1_IM4);
+}
+
+void EXTI9_5_IRQHandler(void)
+{
+  EXTIDisp_Dispatch(EXTI_IMR1_IM5 | EXTI_IMR1_IM6 | EXTI_IMR1_IM7 | EXTI_IMR1_IM8 | EXTI_IMR1_IM9);
+}
+
+void EXTI15_10_IRQHandler(void)
+{
+  EXTIDisp_Dispatch(EXTI_IMR1_IM10 | EXTI_IMR1_IM11 | EXTI_IMR1_IM12 | EXTI_IMR1_IM13 | EXTI_IMR1_IM14 |
+                    EXTI_IMR1_IM15);
+}
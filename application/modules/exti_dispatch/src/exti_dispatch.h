@@ -0,0 +1,90 @@
+#ifndef EXTI_DISPATCH_H
+#define EXTI_DISPATCH_H
+
+#include "stm32h7xx_hal.h"
+#include "event_group.h"
+
+/*
+ * EXTI lines 0-15 (GPIO pins and software triggers), routed to handlers
+ * registered per line.
+ *
+ * The module owns the EXTI0-4, EXTI9_5 and EXTI15_10 vectors. A vector
+ * takes the pending bits of its lines and serves them highest line first,
+ * by __CLZ, clearing each bit before calling the line's handler. Pending
+ * bits are read back once the batch is done, so a line that fires again
+ * meanwhile is served in the same entry. Dispatch costs the same whatever
+ * the number of lines registered.
+ *
+ * A line either calls a callback, in its vector's interrupt, or sets bits
+ * in an event group, for a thread to EventGroup_Wait() on. EventGroup_Set()
+ * is a kernel API, so the second form needs a kernel-aware priority, unless
+ * the line is debounced (the bits are then set from the SysTick).
+ * Lines that share a vector (5-9, 10-15) share its priority.
+ *
+ * Debounce: a line with DebounceMs reacts to the first edge by opening a
+ * window, and the edges within it only count as bounces. When it closes,
+ * on the SysTick (EXTIDisp_Tick(), in SysTick_Handler()), the pin is read.
+ * If its level differs from the last reported one and Trigger covers the
+ * change, the line's callback or bits fire, at SysTick priority. A pulse
+ * shorter than the window is thus filtered out. The window is 1 ms coarse,
+ * as is the tick.
+ *
+ * Stats count each vector entry and the cycles from entry to the first
+ * handler's call (DWT, started by the bootloader or PERF_Init()).
+ * Bench_Exti() (benchmark module) times trigger to callback on top.
+ *
+ * With the irq_latency module built, lines 0-2 and their vectors are its.
+ */
+#define EXTI_DISP_LINES   16U
+
+/* line is the EXTI line, i.e. the pin number */
+typedef void (*EXTIDisp_CallbackTypeDef)(uint32_t line, void *context);
+
+typedef struct
+{
+  GPIO_TypeDef            *Port;         /*!< Pin's port; NULL: software line, EXTIDisp_Trigger() only */
+  uint32_t                 Pull;         /*!< GPIO_NOPULL, GPIO_PULLUP or GPIO_PULLDOWN */
+  uint32_t                 Trigger;      /*!< EXTI_TRIGGER_RISING, _FALLING or _RISING_FALLING */
+  uint32_t                 DebounceMs;   /*!< 0: every edge, at once */
+  uint32_t                 Priority;     /*!< IRQ_PRIO_xxx of the vector */
+  EXTIDisp_CallbackTypeDef Callback;     /*!< NULL to set Bits in Group instead */
+  void                    *Context;
+  EventGroup_TypeDef      *Group;
+  uint32_t                 Bits;
+} EXTIDisp_LineConfigTypeDef;
+
+typedef struct
+{
+  uint32_t Entries;       /*!< Vector entries */
+  uint32_t Dispatches;    /*!< Handlers called */
+  uint32_t Spurious;      /*!< Entries with nothing pending */
+  uint32_t Bounces;       /*!< Edges inside a debounce window */
+  uint32_t Filtered;      /*!< Debounce windows that ended with nothing to report */
+  uint32_t MaxCycles;     /*!< Entry to the first handler's call */
+  uint64_t TotalCycles;
+} EXTIDisp_StatsTypeDef;
+
+HAL_StatusTypeDef EXTIDisp_Register(uint32_t line, const EXTIDisp_LineConfigTypeDef *config);
+void              EXTIDisp_Unregister(uint32_t line);
+
+/* Raises the line as an edge would (SWIER) */
+void              EXTIDisp_Trigger(uint32_t line);
+
+/* Last level reported for a debounced line */
+uint32_t          EXTIDisp_GetLevel(uint32_t line);
+
+/* From SysTick_Handler(), every tick */
+void              EXTIDisp_Tick(void);
+
+void              EXTIDisp_GetStats(EXTIDisp_StatsTypeDef *stats);
+void              EXTIDisp_ResetStats(void);
+
+void EXTI0_IRQHandler(void);
+void EXTI1_IRQHandler(void);
+void EXTI2_IRQHandler(void);
+void EXTI3_IRQHandler(void);
+void EXTI4_IRQHandler(void);
+void EXTI9_5_IRQHandler(void);
+void EXTI15_10_IRQHandler(void);
+
+#endif /* EXTI_DISPATCH_H */
@@ -0,0 +1,231 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "feat.h"
+#include "fmath.h"
+
+#define FEAT_ALIGN       8U
+#define FEAT_NO_BAND     0xFFU
+
+static uint32_t feat_align(uint32_t bytes)
+{
+  return (bytes + (FEAT_ALIGN - 1U)) & ~(FEAT_ALIGN - 1U);
+}
+
+static float feat_hz_to_mel(float hz)
+{
+  return 1127.01048f * fmath_logf(1.0f + hz / 700.0f);   /* 2595 log10(.) */
+}
+
+static float feat_mel_to_hz(float mel)
+{
+  return 700.0f * (fmath_expf(mel / 1127.01048f) - 1.0f);
+}
+
+static feat_status feat_check(const feat_config *config)
+{
+  /* fft_len itself is checked by dsp_rfft_init_f32() */
+  if ((config->frame_len == 0U) || (config->frame_len > config->fft_len) ||
+      (config->hop == 0U) || (config->hop > config->frame_len) ||
+      (config->num_mel == 0U) || (config->num_mel > FEAT_MAX_MEL) ||
+      (config->sample_rate == 0U) || !(config->f_min >= 0.0f) || !(config->f_max > config->f_min) ||
+      (config->f_max > 0.5f * (float)config->sample_rate) || !(config->log_floor > 0.0f))
+  {
+    return FEAT_ARG_ERROR;
+  }
+  return FEAT_OK;
+}
+
+uint32_t feat_workspace_size(const feat_config *config)
+{
+  const uint32_t bins = config->fft_len / 2U + 1U;
+
+  return feat_align(config->fft_len * sizeof(float)) +     /* work   */
+         feat_align(config->frame_len * sizeof(float)) +   /* window */
+         feat_align(bins * sizeof(float)) +                /* weight */
+         feat_align(config->frame_len * sizeof(dsp_q15)) + /* ring   */
+         feat_align(bins);                                 /* band   */
+}
+
+/* Edge j of num_mel + 2 is f_min, the centres of filters 0..num_mel-1, then f_max */
+static void feat_init_bank(feat_inst *inst)
+{
+  const feat_config *c = &inst->config;
+  const uint32_t bins = c->fft_len / 2U + 1U;
+  const float mel_lo = feat_hz_to_mel(c->f_min);
+  const float mel_step = (feat_hz_to_mel(c->f_max) - mel_lo) / (float)(c->num_mel + 1U);
+  const float bin_hz = (float)c->sample_rate / (float)c->fft_len;
+  float lo = c->f_min;
+  float hi = feat_mel_to_hz(mel_lo + mel_step);
+  uint32_t j = 0U;
+  uint32_t k;
+
+  for (k = 0U; k < bins; k++)
+  {
+    const float f = (float)k * bin_hz;
+
+    while ((f >= hi) && (j <= c->num_mel))
+    {
+      j++;
+      lo = hi;
+      hi = (j == c->num_mel) ? c->f_max : feat_mel_to_hz(mel_lo + (float)(j + 1U) * mel_step);
+    }
+    if ((f < c->f_min) || (j > c->num_mel))
+    {
+      inst->band[k] = FEAT_NO_BAND;
+      inst->weight[k] = 0.0f;
+    }
+    else
+    {
+      inst->band[k] = (uint8_t)j;
+      inst->weight[k] = (f - lo) / (hi - lo);
+    }
+  }
+}
+
+feat_status feat_init(feat_inst *inst, const feat_config *config, void *workspace,
+                      feat_frame_cb callback, void *context)
+{
+  uint8_t *next = (uint8_t *)workspace;
+  uint32_t bins;
+  uint32_t i;
+
+  if ((inst == NULL) || (config == NULL) || (workspace == NULL) || (callback == NULL) ||
+      (((uint32_t)(uintptr_t)workspace & (FEAT_ALIGN - 1U)) != 0U) || (feat_check(config) != FEAT_OK))
+  {
+    return FEAT_ARG_ERROR;
+  }
+  if (dsp_rfft_init_f32(&inst->rfft, config->fft_len, NULL) != DSP_OK)
+  {
+    return FEAT_ARG_ERROR;
+  }
+
+  inst->config = *config;
+  bins = config->fft_len / 2U + 1U;
+  inst->work = (float *)next;
+  next += feat_align(config->fft_len * sizeof(float));
+  inst->window = (float *)next;
+  next += feat_align(config->frame_len * sizeof(float));
+  inst->weight = (float *)next;
+  next += feat_align(bins * sizeof(float));
+  inst->ring = (dsp_q15 *)next;
+  next += feat_align(config->frame_len * sizeof(dsp_q15));
+  inst->band = next;
+
+  /* Periodic Hann, with the q15 to float conversion folded in */
+  for (i = 0U; i < config->frame_len; i++)
+  {
+    const float w = 0.5f - 0.5f * fmath_cosf(6.28318531f * (float)i / (float)config->frame_len);
+
+    inst->window[i] = w * (1.0f / 32768.0f);
+  }
+  feat_init_bank(inst);
+
+  inst->callback = callback;
+  inst->context = context;
+  inst->frames = 0U;
+  feat_reset(inst);
+  return FEAT_OK;
+}
+
+void feat_reset(feat_inst *inst)
+{
+  inst->pos = 0U;
+  inst->due = inst->config.frame_len;
+}
+
+static void feat_frame(feat_inst *inst)
+{
+  const feat_config *c = &inst->config;
+  const uint32_t n = c->fft_len;
+  const uint32_t len = c->frame_len;
+  const uint32_t head = len - inst->pos;   /* Oldest samples run from pos to the end of the ring */
+  float *work = inst->work;
+  float mel[FEAT_MAX_MEL];
+  float nyquist;
+  uint32_t k;
+
+  for (k = 0U; k < head; k++)
+  {
+    work[k] = (float)inst->ring[inst->pos + k] * inst->window[k];
+  }
+  for (k = head; k < len; k++)
+  {
+    work[k] = (float)inst->ring[k - head] * inst->window[k];
+  }
+  for (k = len; k < n; k++)
+  {
+    work[k] = 0.0f;
+  }
+
+  dsp_rfft_f32(&inst->rfft, work, 0U);
+
+  /* Power in place: bin k is read from 2k and 2k+1 before k is overwritten */
+  nyquist = work[1] * work[1];
+  work[0] = work[0] * work[0];
+  for (k = 1U; k < n / 2U; k++)
+  {
+    work[k] = work[2U * k] * work[2U * k] + work[2U * k + 1U] * work[2U * k + 1U];
+  }
+  work[n / 2U] = nyquist;
+
+  memset(mel, 0, c->num_mel * sizeof(float));
+  for (k = 0U; k <= n / 2U; k++)
+  {
+    const uint32_t j = inst->band[k];
+    const float p = work[k];
+
+    if (j == FEAT_NO_BAND)
+    {
+      continue;
+    }
+    if (j > 0U)
+    {
+      mel[j - 1U] += p * (1.0f - inst->weight[k]);
+    }
+    if (j < c->num_mel)
+    {
+      mel[j] += p * inst->weight[k];
+    }
+  }
+
+  for (k = 0U; k < c->num_mel; k++)
+  {
+    work[k] = fmath_logf(mel[k] + c->log_floor);
+  }
+  inst->callback(work, inst->frames++, inst->context);
+}
+
+uint32_t feat_push(feat_inst *inst, const dsp_q15 *samples, uint32_t count)
+{
+  const uint32_t len = inst->config.frame_len;
+  uint32_t frames = 0U;
+
+  while (count > 0U)
+  {
+    uint32_t take = (count < inst->due) ? count : inst->due;
+    const uint32_t chunk = take;
+
+    /* Copy up to the frame boundary, wrapping at the end of the ring */
+    while (take > 0U)
+    {
+      const uint32_t room = len - inst->pos;
+      const uint32_t part = (take < room) ? take : room;
+
+      memcpy(&inst->ring[inst->pos], samples, part * sizeof(dsp_q15));
+      samples += part;
+      take -= part;
+      inst->pos = (uint16_t)((inst->pos + part == len) ? 0U : (inst->pos + part));
+    }
+    count -= chunk;
+    inst->due = (uint16_t)(inst->due - chunk);
+
+    if (inst->due == 0U)
+    {
+      feat_frame(inst);
+      inst->due = inst->config.hop;
+      frames++;
+    }
+  }
+  return frames;
+}
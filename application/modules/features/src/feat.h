@@ -0,0 +1,82 @@
+#ifndef FEAT_H
+#define FEAT_H
+
+#include <stdint.h>
+
+#include "dsp.h"
+
+/*
+ * Streaming log-mel front-end: framing -> window -> real FFT -> power ->
+ * mel filterbank -> log, one frame per hop.
+ *
+ * Samples are pushed in whatever blocks arrive (typically DMA half
+ * buffers). They go into a ring of frame_len samples, so overlapping
+ * frames are never re-copied: every hop samples, the ring is windowed
+ * straight into the FFT buffer and the frame is finished before the push
+ * returns. Latency from the last sample of a frame to its features is one
+ * frame's compute, whatever the block size.
+ *
+ * All intermediates share one work buffer of fft_len floats: windowed
+ * frame, spectrum, power (written over the spectrum) and log energies
+ * (written over the power). The features are handed to the callback from
+ * that buffer and are only valid during the call.
+ *
+ * Filters are HTK-style triangles with peak 1 on the mel scale
+ * 2595 * log10(1 + f / 700). Each FFT bin lies between two adjacent filter
+ * centres, on the falling edge of one filter and the rising edge of the
+ * next, so the bank is stored as one segment index and one weight per bin
+ * rather than a dense matrix.
+ *
+ * HAL-free: the same code runs on the host (tools/feat_wav.c).
+ */
+
+#define FEAT_MAX_MEL    64U
+
+typedef enum
+{
+  FEAT_OK = 0,
+  FEAT_ARG_ERROR,
+} feat_status;
+
+typedef struct
+{
+  uint32_t sample_rate;   /*!< Hz */
+  uint16_t frame_len;     /*!< Samples per frame, <= fft_len (zero padded) */
+  uint16_t hop;           /*!< Samples between frame starts, 1..frame_len */
+  uint16_t fft_len;       /*!< Real FFT size, power of two, 8..DSP_FFT_MAX_N */
+  uint16_t num_mel;       /*!< 1..FEAT_MAX_MEL */
+  float    f_min;         /*!< Filterbank edges, Hz, 0 <= f_min < f_max <= sample_rate / 2 */
+  float    f_max;
+  float    log_floor;     /*!< Added to each energy before the log, > 0 */
+} feat_config;
+
+/* Called with num_mel log energies once per hop; index counts frames from init */
+typedef void (*feat_frame_cb)(const float *features, uint32_t index, void *context);
+
+typedef struct
+{
+  feat_config       config;
+  dsp_rfft_inst_f32 rfft;
+  dsp_q15           *ring;     /*!< frame_len newest samples */
+  float             *window;   /*!< frame_len, Hann scaled by 1/32768 */
+  float             *work;     /*!< fft_len */
+  uint8_t           *band;     /*!< fft_len / 2 + 1: j if the bin lies between edges j and j + 1, 0xFF outside */
+  float             *weight;   /*!< fft_len / 2 + 1: share of the bin going to filter j (rest to filter j - 1) */
+  uint16_t          pos;       /*!< Next ring slot */
+  uint16_t          due;       /*!< Samples until the next frame */
+  uint32_t          frames;
+  feat_frame_cb     callback;
+  void              *context;
+} feat_inst;
+
+/* Bytes of workspace feat_init() carves the buffers above from */
+uint32_t    feat_workspace_size(const feat_config *config);
+/* workspace: feat_workspace_size() bytes, 8-byte aligned, best in DTCM */
+feat_status feat_init(feat_inst *inst, const feat_config *config, void *workspace,
+                      feat_frame_cb callback, void *context);
+/* Drops buffered samples; the next frame needs a full frame_len again */
+void        feat_reset(feat_inst *inst);
+/* Returns the number of frames completed (and passed to the callback) */
+uint32_t    feat_push(feat_inst *inst, const dsp_q15 *samples, uint32_t count);
+
+#endif /* FEAT_H */
@@ -0,0 +1,111 @@
+#include <stddef.h>
+
+#include "feat_stream.h"
+#include "perf.h"
+
+static void feat_stream_dma_event(DMAMgr_ChannelTypeDef *channel, uint32_t event, void *context)
+{
+  feat_stream *stream = (feat_stream *)context;
+  uint32_t bit;
+
+  (void)channel;
+  if (event == DMA_MGR_EVENT_COMPLETE)
+  {
+    bit = FEAT_STREAM_BUFFER0;
+  }
+  else if (event == DMA_MGR_EVENT_M1_COMPLETE)
+  {
+    bit = FEAT_STREAM_BUFFER1;
+  }
+  else
+  {
+    return;
+  }
+
+  if ((EventGroup_Get(&stream->events) & bit) != 0U)
+  {
+    stream->overruns++;
+  }
+  (void)EventGroup_Set(&stream->events, bit);
+}
+
+HAL_StatusTypeDef feat_stream_start(feat_stream *stream, feat_inst *feat, const DMAMgr_ConfigTypeDef *config,
+                                    uint32_t periph_address, dsp_q15 *buffer0, dsp_q15 *buffer1,
+                                    uint32_t samples)
+{
+  DMAMgr_ConfigTypeDef dma = *config;
+
+  if ((feat == NULL) || (buffer0 == NULL) || (buffer1 == NULL) || (samples == 0U) ||
+      (config->Controller == DMA_MGR_MDMA))
+  {
+    return HAL_ERROR;
+  }
+
+  stream->feat = feat;
+  stream->buffer[0] = buffer0;
+  stream->buffer[1] = buffer1;
+  stream->samples = samples;
+  stream->next = 0U;
+  stream->overruns = 0U;
+  stream->max_cycles = 0U;
+  EventGroup_Init(&stream->events);
+
+  dma.Direction = DMA_MGR_DIR_PERIPH_TO_MEM;
+  dma.Mode = DMA_MGR_MODE_DOUBLE_BUFFER;
+  dma.DataSize = DMA_MGR_SIZE_HALFWORD;
+  dma.Callback = feat_stream_dma_event;
+  dma.Context = stream;
+
+  stream->channel = DMAMgr_Alloc(&dma);
+  if (stream->channel == NULL)
+  {
+    return HAL_ERROR;
+  }
+  if (DMAMgr_StartDoubleBuffer(stream->channel, periph_address, (uint32_t)buffer0, (uint32_t)buffer1,
+                               samples) != HAL_OK)
+  {
+    DMAMgr_Free(stream->channel);
+    stream->channel = NULL;
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+void feat_stream_stop(feat_stream *stream)
+{
+  if (stream->channel != NULL)
+  {
+    (void)DMAMgr_Stop(stream->channel);
+    DMAMgr_Free(stream->channel);
+    stream->channel = NULL;
+  }
+}
+
+uint32_t feat_stream_process(feat_stream *stream)
+{
+  uint32_t frames = 0U;
+
+  for (;;)
+  {
+    const uint32_t bit = (stream->next == 0U) ? FEAT_STREAM_BUFFER0 : FEAT_STREAM_BUFFER1;
+    uint32_t start;
+    uint32_t cycles;
+
+    if ((EventGroup_Get(&stream->events) & bit) == 0U)
+    {
+      return frames;
+    }
+
+    start = PERF_Cycles();
+    frames += feat_push(stream->feat, stream->buffer[stream->next], stream->samples);
+    cycles = PERF_Elapsed(start);
+    if (cycles > stream->max_cycles)
+    {
+      stream->max_cycles = cycles;
+    }
+
+    /* Cleared after the push: the DMA refilling the buffer meanwhile shows up as an overrun */
+    (void)EventGroup_Clear(&stream->events, bit);
+    stream->next ^= 1U;
+  }
+}
@@ -0,0 +1,56 @@
+#ifndef FEAT_STREAM_H
+#define FEAT_STREAM_H
+
+#include <stdint.h>
+
+#include "dma_manager.h"
+#include "event_group.h"
+#include "feat.h"
+
+/*
+ * Feeds a feat_inst from a peripheral through a DMA1/DMA2/BDMA stream in
+ * double-buffer mode (HAL_DMAEx_MultiBufferStart_IT): while the stream
+ * fills one buffer, feat_stream_process() runs the other through the
+ * front-end in thread context. The interrupt only sets a bit in
+ * stream->events, so callers can sleep in EventGroup_Wait() on
+ * FEAT_STREAM_READY.
+ *
+ * With samples == hop each buffer completes exactly one frame, so the
+ * features of a hop are out one buffer period plus one frame's compute
+ * after its last sample. A buffer refilled before its processing finished
+ * counts as an overrun: samples were lost and the frames around the gap
+ * are not continuous.
+ *
+ * Buffers: 16-bit samples, DMA_MGR_BUFFER_ALIGNED, outside DTCM (DMA1/2
+ * cannot reach it). The manager invalidates them on each completion.
+ * Target only.
+ */
+
+#define FEAT_STREAM_BUFFER0    0x01U
+#define FEAT_STREAM_BUFFER1    0x02U
+#define FEAT_STREAM_READY      (FEAT_STREAM_BUFFER0 | FEAT_STREAM_BUFFER1)
+
+typedef struct
+{
+  feat_inst             *feat;
+  DMAMgr_ChannelTypeDef *channel;
+  const dsp_q15         *buffer[2];
+  uint32_t              samples;       /*!< Per buffer */
+  uint32_t              next;          /*!< Buffer the DMA fills first, processed next */
+  EventGroup_TypeDef    events;        /*!< FEAT_STREAM_BUFFERx: filled, not yet processed */
+  volatile uint32_t     overruns;
+  uint32_t              max_cycles;    /*!< Worst feat_push() time for one buffer */
+} feat_stream;
+
+/*
+ * config: controller, stream, request, priorities and burst of the input;
+ * mode, direction, data size and callback are set here.
+ */
+HAL_StatusTypeDef feat_stream_start(feat_stream *stream, feat_inst *feat, const DMAMgr_ConfigTypeDef *config,
+                                    uint32_t periph_address, dsp_q15 *buffer0, dsp_q15 *buffer1,
+                                    uint32_t samples);
+void              feat_stream_stop(feat_stream *stream);
+/* Thread context: runs every filled buffer in arrival order, returns the frames produced */
+uint32_t          feat_stream_process(feat_stream *stream);
+
+#endif /* FEAT_STREAM_H */
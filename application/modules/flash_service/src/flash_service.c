@@ -0,0 +1,337 @@
+#include <string.h>
+
+#include "flash_service.h"
+#include "irq_config.h"
+#include "perf.h"
+
+typedef struct
+{
+  FlashSvc_OpTypeDef       Op;
+  uint32_t                 Start;       /*!< First address, reported to the callback */
+  uint32_t                 Length;      /*!< Bytes covered, for the cache */
+  uint32_t                 Address;     /*!< Next flash word or sector */
+  const uint8_t           *Data;        /*!< Next source byte (program) */
+  uint32_t                 Remaining;   /*!< Bytes (program) or sectors (erase) left */
+  FlashSvc_CallbackTypeDef Callback;
+  void                    *Context;
+} FlashSvc_JobTypeDef;
+
+static FlashSvc_JobTypeDef flash_svc_queue[FLASH_SVC_QUEUE_DEPTH];
+static uint32_t            flash_svc_head;
+static volatile uint32_t   flash_svc_count;
+
+static volatile uint32_t   flash_svc_running;   /* A HAL operation is in flight */
+static volatile uint32_t   flash_svc_done;      /* Set by the HAL callbacks */
+static volatile uint32_t   flash_svc_error;
+static uint32_t            flash_svc_started;   /* PERF_Cycles() at the start of the operation */
+static uint32_t            flash_svc_word[FLASH_NB_32BITWORD_IN_FLASHWORD];   /* Padded or unaligned source */
+
+static FlashSvc_StatsTypeDef flash_svc_stats;
+
+static uint32_t flash_svc_in_bank2(uint32_t address, uint32_t length)
+{
+  return ((address >= FLASH_BANK2_BASE) && (length <= FLASH_BANK_SIZE) &&
+          ((address - FLASH_BANK2_BASE) <= (FLASH_BANK_SIZE - length))) ? 1U : 0U;
+}
+
+HAL_StatusTypeDef FlashSvc_Init(void)
+{
+  flash_svc_head = 0U;
+  flash_svc_count = 0U;
+  flash_svc_running = 0U;
+  FlashSvc_ResetStats();
+  PERF_Init();
+
+  IRQ_Config_SetPriority(FLASH_IRQn, IRQ_PRIO_KERNEL_LOW);
+  HAL_NVIC_EnableIRQ(FLASH_IRQn);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Starts the next flash operation of the head job. Caller masks interrupts.
+  */
+static HAL_StatusTypeDef flash_svc_step(FlashSvc_JobTypeDef *job)
+{
+  flash_svc_done = 0U;
+  flash_svc_error = 0U;
+  flash_svc_started = PERF_Cycles();
+
+  if (job->Op == FLASH_SVC_PROGRAM)
+  {
+    uint32_t source = (uint32_t)job->Data;
+
+    /* HAL_FLASH_Program_IT() reads the source a word at a time */
+    if ((job->Remaining < FLASH_SVC_WORD) || ((source & 3U) != 0U))
+    {
+      const uint32_t size = (job->Remaining < FLASH_SVC_WORD) ? job->Remaining : FLASH_SVC_WORD;
+
+      memset(flash_svc_word, 0xFF, sizeof(flash_svc_word));
+      memcpy(flash_svc_word, job->Data, size);
+      source = (uint32_t)flash_svc_word;
+    }
+    return HAL_FLASH_Program_IT(FLASH_TYPEPROGRAM_FLASHWORD, job->Address, source);
+  }
+  else
+  {
+    FLASH_EraseInitTypeDef erase = {0};
+
+    erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase.Banks = FLASH_BANK_2;
+    erase.Sector = (job->Address - FLASH_BANK2_BASE) / FLASH_SECTOR_SIZE;
+    erase.NbSectors = 1U;
+    erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+    return HAL_FLASHEx_Erase_IT(&erase);
+  }
+}
+
+/**
+  * @brief  Retires the head job and reports it. The callback may queue more work.
+  */
+static void flash_svc_complete(HAL_StatusTypeDef status)
+{
+  const FlashSvc_JobTypeDef job = flash_svc_queue[flash_svc_head];
+
+  SCB_InvalidateDCache_by_Addr((uint32_t *)(job.Start & ~31U), (int32_t)((job.Start & 31U) + job.Length));
+  if (status != HAL_OK)
+  {
+    flash_svc_stats.Errors++;
+  }
+
+  flash_svc_head = (flash_svc_head + 1U) % FLASH_SVC_QUEUE_DEPTH;
+  flash_svc_count--;
+
+  if (job.Callback != NULL)
+  {
+    job.Callback(status, job.Start, job.Context);
+  }
+}
+
+/**
+  * @brief  Keeps the queue moving: starts the head job's next operation, failing
+  *         jobs that cannot start. Locks the flash once the queue is empty.
+  *         Caller masks interrupts.
+  */
+static void flash_svc_start(void)
+{
+  while ((flash_svc_running == 0U) && (flash_svc_count != 0U))
+  {
+    (void)HAL_FLASH_Unlock();
+    if (flash_svc_step(&flash_svc_queue[flash_svc_head]) == HAL_OK)
+    {
+      flash_svc_running = 1U;
+      return;
+    }
+    flash_svc_complete(HAL_ERROR);
+  }
+
+  if ((flash_svc_running == 0U) && (flash_svc_count == 0U))
+  {
+    (void)HAL_FLASH_Lock();
+  }
+}
+
+/**
+  * @brief  Accounts for the operation that just ended and moves its job on.
+  */
+static void flash_svc_advance(void)
+{
+  FlashSvc_JobTypeDef *job = &flash_svc_queue[flash_svc_head];
+  const uint32_t cycles = PERF_Cycles() - flash_svc_started;
+
+  /* The interrupt-driven HAL paths leave PG/SER set, which the next operation would trip on */
+  CLEAR_BIT(FLASH->CR2, FLASH_CR_PG | FLASH_CR_SER);
+  flash_svc_running = 0U;
+
+  if (flash_svc_error != 0U)
+  {
+    flash_svc_complete(HAL_ERROR);
+  }
+  else if (job->Op == FLASH_SVC_PROGRAM)
+  {
+    const uint32_t size = (job->Remaining < FLASH_SVC_WORD) ? job->Remaining : FLASH_SVC_WORD;
+
+    flash_svc_stats.ProgramBytes += FLASH_SVC_WORD;
+    flash_svc_stats.ProgramCycles += cycles;
+    job->Address += FLASH_SVC_WORD;
+    job->Data += size;
+    job->Remaining -= size;
+    if (job->Remaining == 0U)
+    {
+      flash_svc_complete(HAL_OK);
+    }
+  }
+  else
+  {
+    flash_svc_stats.EraseSectors++;
+    flash_svc_stats.EraseCycles += cycles;
+    job->Address += FLASH_SECTOR_SIZE;
+    job->Remaining--;
+    if (job->Remaining == 0U)
+    {
+      flash_svc_complete(HAL_OK);
+    }
+  }
+
+  flash_svc_start();
+}
+
+static HAL_StatusTypeDef flash_svc_submit(const FlashSvc_JobTypeDef *job)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+
+  if (flash_svc_count == FLASH_SVC_QUEUE_DEPTH)
+  {
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+
+  flash_svc_queue[(flash_svc_head + flash_svc_count) % FLASH_SVC_QUEUE_DEPTH] = *job;
+  flash_svc_count++;
+  flash_svc_start();
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queues programming of @p length bytes at a flash-word aligned bank 2 address.
+  * @retval HAL_BUSY if the queue is full, HAL_ERROR for a bad range.
+  */
+HAL_StatusTypeDef FlashSvc_Program(uint32_t address, const void *data, uint32_t length,
+                                   FlashSvc_CallbackTypeDef callback, void *context)
+{
+  FlashSvc_JobTypeDef job;
+
+  if ((data == NULL) || (length == 0U) || ((address % FLASH_SVC_WORD) != 0U) ||
+      (flash_svc_in_bank2(address, length) == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  job.Op = FLASH_SVC_PROGRAM;
+  job.Start = address;
+  job.Length = length;
+  job.Address = address;
+  job.Data = data;
+  job.Remaining = length;
+  job.Callback = callback;
+  job.Context = context;
+
+  return flash_svc_submit(&job);
+}
+
+/**
+  * @brief  Queues erasing of @p sectors bank 2 sectors from a sector-aligned address.
+  * @retval HAL_BUSY if the queue is full, HAL_ERROR for a bad range.
+  */
+HAL_StatusTypeDef FlashSvc_Erase(uint32_t address, uint32_t sectors, FlashSvc_CallbackTypeDef callback,
+                                 void *context)
+{
+  FlashSvc_JobTypeDef job;
+
+  if ((sectors == 0U) || (sectors > FLASH_SECTOR_TOTAL) || ((address % FLASH_SECTOR_SIZE) != 0U) ||
+      (flash_svc_in_bank2(address, sectors * FLASH_SECTOR_SIZE) == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  job.Op = FLASH_SVC_ERASE;
+  job.Start = address;
+  job.Length = sectors * FLASH_SECTOR_SIZE;
+  job.Address = address;
+  job.Data = NULL;
+  job.Remaining = sectors;
+  job.Callback = callback;
+  job.Context = context;
+
+  return flash_svc_submit(&job);
+}
+
+uint32_t FlashSvc_IsIdle(void)
+{
+  return (flash_svc_count == 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  Sleeps until every queued job has finished.
+  * @param  Timeout In ms, or HAL_MAX_DELAY.
+  */
+HAL_StatusTypeDef FlashSvc_WaitIdle(uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while (flash_svc_count != 0U)
+  {
+    if ((Timeout != HAL_MAX_DELAY) && ((HAL_GetTick() - tickstart) > Timeout))
+    {
+      return HAL_TIMEOUT;
+    }
+    __WFI();
+  }
+
+  return HAL_OK;
+}
+
+void FlashSvc_GetStats(FlashSvc_StatsTypeDef *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *stats = flash_svc_stats;
+  __set_PRIMASK(primask);
+}
+
+void FlashSvc_ResetStats(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  memset(&flash_svc_stats, 0, sizeof(flash_svc_stats));
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Throughput in KB/s (1024 bytes per second) at the current core clock.
+  */
+uint32_t FlashSvc_KBps(uint64_t bytes, uint64_t cycles)
+{
+  if (cycles == 0U)
+  {
+    return 0U;
+  }
+
+  return (uint32_t)((bytes * SystemCoreClock) / (cycles * 1024U));
+}
+
+void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
+{
+  UNUSED(ReturnValue);
+  flash_svc_done = 1U;
+}
+
+void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue)
+{
+  UNUSED(ReturnValue);
+  flash_svc_error = 1U;
+  flash_svc_done = 1U;
+}
+
+/*
+ * The next operation is started here rather than in the HAL callbacks:
+ * the HAL keeps its lock until HAL_FLASH_IRQHandler() returns.
+ */
+void FLASH_IRQHandler(void);
+void FLASH_IRQHandler(void)
+{
+  HAL_FLASH_IRQHandler();
+
+  if ((flash_svc_done != 0U) && (flash_svc_running != 0U))
+  {
+    flash_svc_done = 0U;
+    flash_svc_advance();
+  }
+}
@@ -0,0 +1,55 @@
+#ifndef FLASH_SERVICE_H
+#define FLASH_SERVICE_H
+
+#include "stm32h7xx_hal.h"
+
+/*
+ * Non-blocking flash programming and sector erase for bank 2.
+ *
+ * Jobs are queued and run one flash operation at a time from the FLASH
+ * interrupt: HAL_FLASH_Program_IT() for each 256-bit flash word and
+ * HAL_FLASHEx_Erase_IT() for each sector. The caller returns at once and is
+ * told through its callback, from interrupt context, when the whole job is
+ * done. Only bank 2 (FLASH_BANK2_BASE and up) is accepted: code, vectors
+ * and constants stay in bank 1, which keeps serving reads while bank 2 is
+ * busy, so the core never stalls on read-while-write.
+ *
+ * Program data must stay valid until the callback; a tail shorter than a
+ * flash word is padded with 0xFF. The D-cache is invalidated over the range
+ * of every finished job. Busy time is counted in core cycles per operation,
+ * for the KB/s figures.
+ */
+#define FLASH_SVC_QUEUE_DEPTH   8U
+#define FLASH_SVC_WORD          (FLASH_NB_32BITWORD_IN_FLASHWORD * 4U)   /*!< 32 bytes */
+
+typedef enum
+{
+  FLASH_SVC_PROGRAM = 0U,
+  FLASH_SVC_ERASE
+} FlashSvc_OpTypeDef;
+
+/* Called from the FLASH interrupt; may queue the next job */
+typedef void (*FlashSvc_CallbackTypeDef)(HAL_StatusTypeDef status, uint32_t address, void *context);
+
+typedef struct
+{
+  uint32_t ProgramBytes;    /*!< Flash words programmed, in bytes */
+  uint64_t ProgramCycles;   /*!< Core cycles from starting each word to its interrupt */
+  uint32_t EraseSectors;
+  uint64_t EraseCycles;
+  uint32_t Errors;          /*!< Jobs ended with an error */
+} FlashSvc_StatsTypeDef;
+
+HAL_StatusTypeDef FlashSvc_Init(void);
+HAL_StatusTypeDef FlashSvc_Program(uint32_t address, const void *data, uint32_t length,
+                                   FlashSvc_CallbackTypeDef callback, void *context);
+HAL_StatusTypeDef FlashSvc_Erase(uint32_t address, uint32_t sectors, FlashSvc_CallbackTypeDef callback,
+                                 void *context);
+HAL_StatusTypeDef FlashSvc_WaitIdle(uint32_t Timeout);
+uint32_t          FlashSvc_IsIdle(void);
+
+void     FlashSvc_GetStats(FlashSvc_StatsTypeDef *stats);
+void     FlashSvc_ResetStats(void);
+uint32_t FlashSvc_KBps(uint64_t bytes, uint64_t cycles);
+
+#endif /* FLASH_SERVICE_H */
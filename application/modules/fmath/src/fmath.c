@@ -0,0 +1,39 @@
+#include "fmath.h"
+
+const uint32_t fmath_inv_pio4[24] =
+{
+  0x000000A2U, 0x0000A2F9U, 0x00A2F983U, 0xA2F9836EU,
+  0xF9836E4EU, 0x836E4E44U, 0x6E4E4415U, 0x4E441529U,
+  0x441529FCU, 0x1529FC27U, 0x29FC2757U, 0xFC2757D1U,
+  0x2757D1F5U, 0x57D1F534U, 0xD1F534DDU, 0xF534DDC0U,
+  0x34DDC0DBU, 0xDDC0DB62U, 0xC0DB6295U, 0xDB629599U,
+  0x6295993CU, 0x95993C43U, 0x993C4390U, 0x3C439041U,
+};
+
+/* Two independent elements per iteration keep both FPU issue slots busy */
+#define FMATH_VEC(name, fn)                                 \
+  void name(const float *in, float *out, uint32_t n)        \
+  {                                                         \
+    uint32_t i;                                             \
+                                                            \
+    for (i = 0U; (i + 1U) < n; i += 2U)                     \
+    {                                                       \
+      const float a = in[i];                                \
+      const float b = in[i + 1U];                           \
+                                                            \
+      out[i] = fn(a);                                       \
+      out[i + 1U] = fn(b);                                  \
+    }                                                       \
+    if (i < n)                                              \
+    {                                                       \
+      out[i] = fn(in[i]);                                   \
+    }                                                       \
+  }
+
+FMATH_VEC(fmath_expf_vec, fmath_expf)
+FMATH_VEC(fmath_logf_vec, fmath_logf)
+FMATH_VEC(fmath_sinf_vec, fmath_sinf)
+FMATH_VEC(fmath_cosf_vec, fmath_cosf)
+FMATH_VEC(fmath_tanhf_vec, fmath_tanhf)
+FMATH_VEC(fmath_sigmoidf_vec, fmath_sigmoidf)
+FMATH_VEC(fmath_sqrtf_vec, fmath_sqrtf)
@@ -0,0 +1,385 @@
+#ifndef FMATH_H
+#define FMATH_H
+
+#include <stdint.h>
+
+/*
+ * Fast elementary functions for the Cortex-M7 FPv5 FPU (single and double
+ * precision), replacing libm, which the linker scripts discard.
+ *
+ * Each function reduces its argument exactly (or in double precision) and
+ * evaluates a minimax polynomial with FMAs, so results are bit-identical on
+ * the host. Square roots are one VSQRT.
+ *
+ * Max error in ULP, measured by tools/fmath_ulp.c against glibc over every
+ * float in the domain (doubles: 10^7 random arguments, log and sqrt with a
+ * uniformly distributed exponent):
+ *
+ *   fmath_expf      1.1   x in [-87.33, 88.72]; below: 0, above: +inf
+ *   fmath_logf      1.1   x > 0 (subnormals included)
+ *   fmath_sinf/cosf 0.9   all finite x; inf gives NaN
+ *   fmath_tanhf     1.5   all x
+ *   fmath_sigmoidf  2.5   x >= -87.33 (smaller x: result flushes to 0)
+ *   fmath_sqrtf     0.5   correctly rounded (VSQRT.F32)
+ *   fmath_exp       1.3   x in [-708.39, 709.78]; below: 0, above: +inf
+ *   fmath_log       1.2   x > 0
+ *   fmath_sqrt      0.5   correctly rounded (VSQRT.F64)
+ *
+ * Results that would be subnormal flush to zero. NaN in gives NaN out,
+ * log of a negative number is NaN and log(0) is -inf; errno is never set.
+ *
+ * The _vec variants run the scalar kernel over an array two elements per
+ * iteration (independent chains for the dual-issue pipeline); in == out is
+ * allowed.
+ */
+
+/* Coefficients: minimax fits on the reduced ranges (degree in brackets) */
+#define FMATH_LOG2E_F      1.44269502f
+#define FMATH_LN2_F        0.693147182f
+#define FMATH_LN2_HI_F     0.693145752f      /* 16 significant bits, k * hi exact */
+#define FMATH_LN2_LO_F     1.42860677e-06f
+#define FMATH_SHIFT_F      12582912.0f       /* 1.5 * 2^23: adding it rounds to an integer */
+#define FMATH_SQRT_HALF_U  0x3F3504F3U       /* bits of sqrt(0.5) */
+
+#define FMATH_LOG2E        1.4426950408889634
+#define FMATH_LN2_HI       6.93147180369123816490e-01
+#define FMATH_LN2_LO       1.90821492927058770002e-10
+#define FMATH_SHIFT        6755399441055744.0   /* 1.5 * 2^52 */
+#define FMATH_PIO2_HI      1.5707963267948966
+#define FMATH_PIO2_LO      6.123233995736766e-17
+#define FMATH_2_OVER_PI    0.6366197723675814
+#define FMATH_PIO2_2M62    3.4061215800865545e-19   /* pi/2 * 2^-62 */
+#define FMATH_REDUCE_LARGE 0x49800000U              /* bits of 2^20 */
+
+/* 4/pi in bits, the window starting at byte i in entry i + 3 (first entries zero-padded) */
+extern const uint32_t fmath_inv_pio4[24];
+
+typedef union
+{
+  float    f;
+  uint32_t u;
+} fmath_bits_f;
+
+typedef union
+{
+  double   d;
+  uint64_t u;
+} fmath_bits;
+
+static inline uint32_t fmath_asuint(float x)      { fmath_bits_f b; b.f = x; return b.u; }
+static inline float    fmath_asfloat(uint32_t u)  { fmath_bits_f b; b.u = u; return b.f; }
+static inline uint64_t fmath_asuint64(double x)   { fmath_bits b; b.d = x; return b.u; }
+static inline double   fmath_asdouble(uint64_t u) { fmath_bits b; b.u = u; return b.d; }
+
+static inline float fmath_sqrtf(float x)
+{
+#if defined(__ARM_FP) && (__ARM_FP & 4)
+  float y;
+
+  __asm ("vsqrt.f32 %0, %1" : "=t" (y) : "t" (x));
+  return y;
+#else
+  return __builtin_sqrtf(x);
+#endif
+}
+
+static inline double fmath_sqrt(double x)
+{
+#if defined(__ARM_FP) && (__ARM_FP & 8)
+  double y;
+
+  __asm ("vsqrt.f64 %P0, %P1" : "=w" (y) : "w" (x));
+  return y;
+#else
+  return __builtin_sqrt(x);
+#endif
+}
+
+/* e^r - 1 = r + r^2 p(r) on |r| <= ln2 / 2 [6], relative error 3.1e-9 */
+static inline float fmath_expm1_poly_f(float r)
+{
+  float p = 0.00138146142f;
+
+  p = __builtin_fmaf(p, r, 0.00836870982f);
+  p = __builtin_fmaf(p, r, 0.0416683873f);
+  p = __builtin_fmaf(p, r, 0.166665207f);
+  p = __builtin_fmaf(p, r, 0.499999935f);
+  return __builtin_fmaf(r * r, p, r);
+}
+
+static inline float fmath_expf(float x)
+{
+  float t, k, r;
+  int32_t n;
+
+  if (!(x <= 88.7228317f))
+  {
+    return (x == x) ? __builtin_inff() : x;   /* above ln(FLT_MAX), or NaN */
+  }
+  if (x < -87.3365402f)
+  {
+    return 0.0f;   /* below ln(FLT_MIN) */
+  }
+  /* x = n ln2 + r: n is exact, so r is x - n ln2 to the last bit (two-part ln2) */
+  t = __builtin_fmaf(x, FMATH_LOG2E_F, FMATH_SHIFT_F);
+  n = (int32_t)(fmath_asuint(t) - fmath_asuint(FMATH_SHIFT_F));
+  k = t - FMATH_SHIFT_F;
+  r = __builtin_fmaf(k, -FMATH_LN2_HI_F, x);
+  r = __builtin_fmaf(k, -FMATH_LN2_LO_F, r);
+  /* 1 + p rounded once (in double), then scaled by 2^n in the exponent field */
+  return fmath_asfloat(fmath_asuint((float)(1.0 + (double)fmath_expm1_poly_f(r))) + ((uint32_t)n << 23));
+}
+
+static inline float fmath_logf(float x)
+{
+  uint32_t u = fmath_asuint(x);
+  int32_t e = 0;
+  float f, q;
+
+  if ((u - 0x00800000U) >= (0x7F800000U - 0x00800000U))
+  {
+    /* Zero, subnormal, negative, inf or NaN */
+    if ((u << 1) == 0U)
+    {
+      return -__builtin_inff();
+    }
+    if ((u >> 31) != 0U)
+    {
+      return __builtin_nanf("");
+    }
+    if (u >= 0x7F800000U)
+    {
+      return x;
+    }
+    u = fmath_asuint(x * 8388608.0f);
+    e = -23;
+  }
+  /* x = 2^e * m, m in [sqrt(1/2), sqrt(2)); f = m - 1 is exact */
+  u -= FMATH_SQRT_HALF_U;
+  e += (int32_t)u >> 23;
+  f = fmath_asfloat((u & 0x007FFFFFU) + FMATH_SQRT_HALF_U) - 1.0f;
+
+  /* log1p(f) = f + f^2 * q(f) on [sqrt(1/2) - 1, sqrt(2) - 1] [9], relative error 3.0e-8 */
+  q = 0.0873484467f;
+  q = __builtin_fmaf(q, f, -0.143075214f);
+  q = __builtin_fmaf(q, f, 0.149179729f);
+  q = __builtin_fmaf(q, f, -0.165705082f);
+  q = __builtin_fmaf(q, f, 0.199620722f);
+  q = __builtin_fmaf(q, f, -0.250017553f);
+  q = __builtin_fmaf(q, f, 0.333339502f);
+  q = __builtin_fmaf(q, f, -0.499999916f);
+  /* Summed in double so the result is rounded once */
+  return (float)__builtin_fma((double)e, FMATH_LN2_HI + FMATH_LN2_LO, __builtin_fma((double)f * f, q, f));
+}
+
+/*
+ * sin and cos on |r| <= pi/4 [7] and [8], relative error 1.2e-8 and 8.0e-10.
+ * The tail is evaluated in float, the leading terms in double.
+ */
+static inline float fmath_sin_poly_f(double r)
+{
+  const float rf = (float)r;
+  const float z = rf * rf;
+  float p = -0.000195669039f;
+
+  p = __builtin_fmaf(p, z, 0.00833264706f);
+  p = __builtin_fmaf(p, z, -0.166666644f);
+  return (float)__builtin_fma(r * z, p, r);
+}
+
+static inline float fmath_cos_poly_f(double r)
+{
+  const double z = r * r;
+  const float zf = (float)z;
+  float p = 2.45269251e-05f;
+
+  p = __builtin_fmaf(p, zf, -0.00138882017f);
+  p = __builtin_fmaf(p, zf, 0.0416666644f);
+  return (float)__builtin_fma(z * z, p, __builtin_fma(z, -0.5, 1.0));
+}
+
+/*
+ * |x| = q pi/2 + r for 2^20 <= |x| < inf (Payne-Hanek): the 24-bit mantissa
+ * times the 96 bits of 4/pi that matter at x's exponent, in integers. The
+ * top bits of the 64-bit product are q, the rest r in units of pi/2 * 2^-62.
+ */
+static inline double fmath_reduce_large_f(uint32_t a, uint32_t *quadrant)
+{
+  const uint32_t *w = &fmath_inv_pio4[(a >> 26) & 15U];
+  const uint32_t m = ((a & 0x007FFFFFU) | 0x00800000U) << ((a >> 23) & 7U);
+  uint64_t p = (uint64_t)(uint32_t)(m * w[0]) << 32;
+  uint64_t q;
+
+  p = (p | (((uint64_t)m * w[8]) >> 32)) + (uint64_t)m * w[4];
+  q = (p + (1ULL << 61)) >> 62;
+  p -= q << 62;
+  *quadrant = (uint32_t)q;
+  return (double)(int64_t)p * FMATH_PIO2_2M62;
+}
+
+/*
+ * x = q pi/2 + r, only q mod 4 kept. Below 2^20 in double precision, with
+ * the FMA shift trick; above, by fmath_reduce_large_f(). inf and NaN take
+ * the first path and come out NaN.
+ */
+static inline double fmath_reduce_pio2_f(float x, uint32_t *quadrant)
+{
+  const uint32_t u = fmath_asuint(x);
+  double t, k, r;
+
+  if (((u & 0x7FFFFFFFU) - FMATH_REDUCE_LARGE) < (0x7F800000U - FMATH_REDUCE_LARGE))
+  {
+    r = fmath_reduce_large_f(u & 0x7FFFFFFFU, quadrant);
+    if ((u >> 31) != 0U)
+    {
+      *quadrant = 0U - *quadrant;
+      r = -r;
+    }
+    return r;
+  }
+  t = __builtin_fma((double)x, FMATH_2_OVER_PI, FMATH_SHIFT);
+  k = t - FMATH_SHIFT;
+  *quadrant = (uint32_t)fmath_asuint64(t) & 3U;
+  r = __builtin_fma(k, -FMATH_PIO2_HI, (double)x);
+  return __builtin_fma(k, -FMATH_PIO2_LO, r);
+}
+
+static inline float fmath_sinf(float x)
+{
+  uint32_t q;
+  const double r = fmath_reduce_pio2_f(x, &q);
+  const float y = ((q & 1U) != 0U) ? fmath_cos_poly_f(r) : fmath_sin_poly_f(r);
+
+  return ((q & 2U) != 0U) ? -y : y;
+}
+
+static inline float fmath_cosf(float x)
+{
+  uint32_t q;
+  const double r = fmath_reduce_pio2_f(x, &q);
+  const float y = ((q & 1U) != 0U) ? fmath_sin_poly_f(r) : fmath_cos_poly_f(r);
+
+  return (((q + 1U) & 2U) != 0U) ? -y : y;
+}
+
+static inline float fmath_tanhf(float x)
+{
+  const float a = __builtin_fabsf(x);
+  float y;
+
+  if (a < 0.55f)
+  {
+    /* x + x^3 p(x^2) [11], relative error 5.9e-9 */
+    const float z = x * x;
+    float p = -0.00671150281f;
+
+    p = __builtin_fmaf(p, z, 0.0213825471f);
+    p = __builtin_fmaf(p, z, -0.0539257774f);
+    p = __builtin_fmaf(p, z, 0.133332266f);
+    p = __builtin_fmaf(p, z, -0.333333331f);
+    return __builtin_fmaf(x * z, p, x);
+  }
+  if (!(a <= 9.01091290f))
+  {
+    y = (a == a) ? 1.0f : a;   /* tanh rounds to 1 beyond here; NaN stays NaN */
+  }
+  else
+  {
+    y = 1.0f - 2.0f / (fmath_expf(2.0f * a) + 1.0f);
+  }
+  return __builtin_copysignf(y, x);
+}
+
+static inline float fmath_sigmoidf(float x)
+{
+  /* e = exp(-|x|) <= 1, so 1 + e never hides the error of e */
+  const float e = fmath_expf(-__builtin_fabsf(x));
+
+  return ((x >= 0.0f) ? 1.0f : e) / (1.0f + e);
+}
+
+static inline double fmath_exp(double x)
+{
+  double t, k, r, p;
+  int64_t n;
+
+  if (!(x <= 709.782712893384))
+  {
+    return (x == x) ? __builtin_inf() : x;
+  }
+  if (x < -708.3964185322641)
+  {
+    return 0.0;
+  }
+  t = __builtin_fma(x, FMATH_LOG2E, FMATH_SHIFT);
+  n = (int64_t)(fmath_asuint64(t) - fmath_asuint64(FMATH_SHIFT));
+  k = t - FMATH_SHIFT;
+  r = __builtin_fma(k, -FMATH_LN2_HI, x);
+  r = __builtin_fma(k, -FMATH_LN2_LO, r);
+
+  /* e^r - 1 on |r| <= ln2 / 2 [11], relative error 1.8e-17 */
+  p = 2.29812595239814e-08;
+  p = __builtin_fma(p, r, 2.7626296670046303e-07);
+  p = __builtin_fma(p, r, 2.7564255099700332e-06);
+  p = __builtin_fma(p, r, 2.4801504510761085e-05);
+  p = __builtin_fma(p, r, 0.00019841261491190348);
+  p = __builtin_fma(p, r, 0.0013888888932341004);
+  p = __builtin_fma(p, r, 0.008333333337715566);
+  p = __builtin_fma(p, r, 0.041666666666573635);
+  p = __builtin_fma(p, r, 0.166666666666573);
+  p = __builtin_fma(p, r, 0.5000000000000006);
+  p = __builtin_fma(p, r, 1.0000000000000007);
+  return fmath_asdouble(fmath_asuint64(__builtin_fma(p, r, 1.0)) + ((uint64_t)n << 52));
+}
+
+static inline double fmath_log(double x)
+{
+  uint64_t u = fmath_asuint64(x);
+  int64_t e = 0;
+  double f, s, z, R;
+
+  if ((u - 0x0010000000000000ULL) >= (0x7FF0000000000000ULL - 0x0010000000000000ULL))
+  {
+    if ((u << 1) == 0U)
+    {
+      return -__builtin_inf();
+    }
+    if ((u >> 63) != 0U)
+    {
+      return __builtin_nan("");
+    }
+    if (u >= 0x7FF0000000000000ULL)
+    {
+      return x;
+    }
+    u = fmath_asuint64(x * 18014398509481984.0);   /* 2^54 */
+    e = -54;
+  }
+  u -= 0x3FE6A09E667F3BCDULL;                     /* bits of sqrt(0.5) */
+  e += (int64_t)u >> 52;
+  f = fmath_asdouble((u & 0x000FFFFFFFFFFFFFULL) + 0x3FE6A09E667F3BCDULL) - 1.0;
+
+  /* log1p(f) = 2 atanh(s) = f - s (f - R(s^2)), s = f / (2 + f) [8 in s^2], relative error 1.4e-19 */
+  s = f / (2.0 + f);
+  z = s * s;
+  R = 0.12913829525787235;
+  R = __builtin_fma(R, z, 0.13286257228557505);
+  R = __builtin_fma(R, z, 0.153855543198705);
+  R = __builtin_fma(R, z, 0.18181808701274396);
+  R = __builtin_fma(R, z, 0.2222222226751193);
+  R = __builtin_fma(R, z, 0.2857142857134405);
+  R = __builtin_fma(R, z, 0.4000000000000004);
+  R = __builtin_fma(R, z, 0.6666666666666666);
+  R *= z;
+  return __builtin_fma((double)e, FMATH_LN2_HI, __builtin_fma((double)e, FMATH_LN2_LO, f - s * (f - R)));
+}
+
+void fmath_expf_vec(const float *in, float *out, uint32_t n);
+void fmath_logf_vec(const float *in, float *out, uint32_t n);
+void fmath_sinf_vec(const float *in, float *out, uint32_t n);
+void fmath_cosf_vec(const float *in, float *out, uint32_t n);
+void fmath_tanhf_vec(const float *in, float *out, uint32_t n);
+void fmath_sigmoidf_vec(const float *in, float *out, uint32_t n);
+void fmath_sqrtf_vec(const float *in, float *out, uint32_t n);
+
+#endif /* FMATH_H */
@@ -0,0 +1,266 @@
+#include <string.h>
+
+#include "fw_decode.h"
+
+/**
+  * @brief  Check the base and start the session.
+  */
+fw_status fw_decode_begin(fw_decoder *decoder, fw_session *session, const fw_flash *flash,
+                          const fw_image_header *header, const void *base, uint32_t base_capacity)
+{
+  if ((decoder == NULL) || (header == NULL))
+  {
+    return FW_ARG_ERROR;
+  }
+  memset(decoder, 0, sizeof(*decoder));   /* As heatshrink: references before the start read zeros */
+  decoder->session = session;
+  decoder->encoding = header->encoding;
+
+  if ((header->encoding & FW_ENCODING_DELTA) != 0U)
+  {
+    if ((base == NULL) || (header->base_size > base_capacity) ||
+        (fw_crc32(base, header->base_size, 0U) != header->base_crc))
+    {
+      return FW_BAD_IMAGE;   /* Made against another image */
+    }
+    decoder->base = base;
+    decoder->base_size = header->base_size;
+  }
+
+  return fw_update_begin(session, flash, header);
+}
+
+/* Hand the output chunk to the session */
+static fw_status fw_decode_flush(fw_decoder *decoder)
+{
+  fw_status status;
+
+  if (decoder->out_fill == 0U)
+  {
+    return FW_OK;
+  }
+  status = fw_update_write(decoder->session, decoder->out, decoder->out_fill);
+  if (status == FW_OK)
+  {
+    decoder->out_fill = 0U;
+  }
+  return (status == FW_ARG_ERROR) ? FW_BAD_IMAGE : status;   /* More than the header's size */
+}
+
+/* Take the next @p count payload bits, MSB first; 0 when the chunk is used up */
+static uint32_t fw_lz_bits(fw_decoder *decoder, uint32_t count, const uint8_t *data, uint32_t size,
+                           uint32_t *taken, uint32_t *value)
+{
+  while (decoder->bit_count < count)
+  {
+    if (*taken == size)
+    {
+      return 0U;
+    }
+    decoder->bits = (decoder->bits << 8) | data[(*taken)++];
+    decoder->bit_count += 8U;
+  }
+  decoder->bit_count -= count;
+  *value = (decoder->bits >> decoder->bit_count) & ((1U << count) - 1U);
+  return 1U;
+}
+
+/* Next decompressed byte; 0 when the chunk is used up */
+static uint32_t fw_lz_next(fw_decoder *decoder, const uint8_t *data, uint32_t size, uint32_t *taken,
+                           uint8_t *value)
+{
+  uint32_t field;
+
+  for (;;)
+  {
+    switch (decoder->lz)
+    {
+      case FW_LZ_TAG:
+        if (!fw_lz_bits(decoder, 1U, data, size, taken, &field))
+        {
+          return 0U;
+        }
+        decoder->lz = (field != 0U) ? FW_LZ_LITERAL : FW_LZ_OFFSET;
+        break;
+
+      case FW_LZ_LITERAL:
+        if (!fw_lz_bits(decoder, 8U, data, size, taken, &field))
+        {
+          return 0U;
+        }
+        *value = (uint8_t)field;
+        decoder->window[decoder->head++ & (FW_LZ_WINDOW - 1U)] = *value;
+        decoder->lz = FW_LZ_TAG;
+        return 1U;
+
+      case FW_LZ_OFFSET:
+        if (!fw_lz_bits(decoder, FW_LZ_WINDOW_BITS, data, size, taken, &field))
+        {
+          return 0U;
+        }
+        decoder->copy_offset = field + 1U;
+        decoder->lz = FW_LZ_LENGTH;
+        break;
+
+      case FW_LZ_LENGTH:
+        if (!fw_lz_bits(decoder, FW_LZ_LENGTH_BITS, data, size, taken, &field))
+        {
+          return 0U;
+        }
+        decoder->copy_left = field + 1U;
+        decoder->lz = FW_LZ_COPY;
+        break;
+
+      default:
+        *value = decoder->window[(decoder->head - decoder->copy_offset) & (FW_LZ_WINDOW - 1U)];
+        decoder->window[decoder->head++ & (FW_LZ_WINDOW - 1U)] = *value;
+        if (--decoder->copy_left == 0U)
+        {
+          decoder->lz = FW_LZ_TAG;
+        }
+        return 1U;
+    }
+  }
+}
+
+/* Delta seek once a record's bytes are done */
+static fw_status fw_delta_seek(fw_decoder *decoder)
+{
+  const int32_t seek = (int32_t)decoder->control[2];
+
+  if ((seek < -(int32_t)decoder->base_offset) || (seek > (int32_t)(decoder->base_size - decoder->base_offset)))
+  {
+    return FW_BAD_IMAGE;
+  }
+  decoder->base_offset = (uint32_t)((int32_t)decoder->base_offset + seek);
+  return FW_OK;
+}
+
+/* One byte of the patch: control, difference or extra */
+static fw_status fw_delta_byte(fw_decoder *decoder, uint8_t value)
+{
+  if ((decoder->diff_left == 0U) && (decoder->extra_left == 0U))
+  {
+    if ((decoder->control_fill % 4U) == 0U)
+    {
+      decoder->control[decoder->control_fill / 4U] = 0U;
+    }
+    decoder->control[decoder->control_fill / 4U] |= (uint32_t)value << (8U * (decoder->control_fill % 4U));
+    if (++decoder->control_fill < sizeof(decoder->control))
+    {
+      return FW_OK;
+    }
+    decoder->control_fill = 0U;
+    decoder->diff_left = decoder->control[0];
+    decoder->extra_left = decoder->control[1];
+    if (decoder->diff_left > decoder->base_size - decoder->base_offset)
+    {
+      return FW_BAD_IMAGE;
+    }
+    return ((decoder->diff_left == 0U) && (decoder->extra_left == 0U)) ? fw_delta_seek(decoder) : FW_OK;
+  }
+
+  if (decoder->diff_left > 0U)
+  {
+    value = (uint8_t)(value + decoder->base[decoder->base_offset++]);
+    decoder->diff_left--;
+  }
+  else
+  {
+    decoder->extra_left--;
+  }
+  decoder->out[decoder->out_fill++] = value;
+  return ((decoder->diff_left == 0U) && (decoder->extra_left == 0U)) ? fw_delta_seek(decoder) : FW_OK;
+}
+
+/**
+  * @brief  Decode the next payload chunk into the slot.
+  * @param  taken Receives the payload bytes used.
+  * @retval FW_BUSY when the flash is erasing: pass the unused rest again later.
+  */
+fw_status fw_decode_write(fw_decoder *decoder, const void *data, uint32_t size, uint32_t *taken)
+{
+  const uint8_t *byte = data;
+  uint8_t value;
+  fw_status status;
+
+  if ((decoder == NULL) || (taken == NULL) || ((data == NULL) && (size != 0U)))
+  {
+    return FW_ARG_ERROR;
+  }
+  *taken = 0U;
+  for (;;)
+  {
+    if (decoder->out_fill == FW_DECODE_CHUNK)
+    {
+      status = fw_decode_flush(decoder);
+      if (status != FW_OK)
+      {
+        return status;
+      }
+    }
+
+    if ((decoder->encoding & FW_ENCODING_LZ) != 0U)
+    {
+      if (!fw_lz_next(decoder, byte, size, taken, &value))
+      {
+        return FW_OK;
+      }
+    }
+    else
+    {
+      if (*taken == size)
+      {
+        return FW_OK;
+      }
+      value = byte[(*taken)++];
+    }
+
+    if ((decoder->encoding & FW_ENCODING_DELTA) != 0U)
+    {
+      status = fw_delta_byte(decoder, value);
+      if (status != FW_OK)
+      {
+        return status;
+      }
+    }
+    else
+    {
+      decoder->out[decoder->out_fill++] = value;
+    }
+  }
+}
+
+/**
+  * @brief  Write out what is still buffered, check the payload ended cleanly
+  *         and finish the session (fw_update_finish()).
+  * @retval FW_BUSY while the rest waits for an erase: call again.
+  */
+fw_status fw_decode_finish(fw_decoder *decoder)
+{
+  uint32_t taken;
+  fw_status status;
+
+  if (decoder == NULL)
+  {
+    return FW_ARG_ERROR;
+  }
+  /* The last payload byte may hold whole tokens not decoded yet */
+  status = fw_decode_write(decoder, NULL, 0U, &taken);
+  if (status == FW_OK)
+  {
+    status = fw_decode_flush(decoder);
+  }
+  if (status != FW_OK)
+  {
+    return status;
+  }
+  /* Padding bits may leave a token started, but never a copy or a patch record */
+  if ((decoder->lz == FW_LZ_COPY) ||
+      (decoder->control_fill != 0U) || (decoder->diff_left != 0U) || (decoder->extra_left != 0U))
+  {
+    fw_update_abort(decoder->session);
+    return FW_BAD_IMAGE;
+  }
+  return fw_update_finish(decoder->session);
+}
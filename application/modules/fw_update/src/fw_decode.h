@@ -0,0 +1,81 @@
+#ifndef FW_DECODE_H
+#define FW_DECODE_H
+
+#include <stdint.h>
+
+#include "fw_update.h"
+
+/*
+ * Streaming decoder for compressed and delta updates, in front of
+ * fw_update_write(). Its RAM is fixed: the LZ window and one output chunk.
+ *
+ * FW_ENCODING_LZ: the payload is heatshrink's bitstream with a 2^10 byte
+ * window and 8-bit lengths (heatshrink -w 10 -l 8). Each token is a 1 bit
+ * and a literal byte, or a 0 bit, (offset - 1) in 10 bits and
+ * (length - 1) in 8 bits, all MSB first, copying from the bytes already
+ * decoded. The last byte is padded with zero bits. Long lengths suit the
+ * zero runs of a delta payload.
+ *
+ * FW_ENCODING_DELTA: the payload patches the running image (the base) as
+ * bsdiff does, but without bsdiff's bzip2 so it can stream. It is a
+ * sequence of records:
+ *   diff_size, extra_size, seek   three little-endian 32-bit words
+ *   diff_size bytes               each added to the next base byte
+ *   extra_size bytes              copied as they are
+ * after which the base position moves by the signed seek. Differences
+ * against a similar image are mostly zero, so delta is normally combined
+ * with LZ, which undoes first. The base is checked against the header's
+ * base_crc before anything is erased.
+ *
+ * Payload chunks of any size go to fw_decode_write(). FW_BUSY means the
+ * flash is erasing: *taken says how much was used, and the rest is passed
+ * again later. tools/fw_pack.c builds these payloads.
+ */
+#define FW_LZ_WINDOW_BITS     10U
+#define FW_LZ_LENGTH_BITS     8U
+#define FW_LZ_WINDOW          (1U << FW_LZ_WINDOW_BITS)
+#define FW_DECODE_CHUNK       64U    /*!< Decoded bytes per fw_update_write() */
+
+typedef enum
+{
+  FW_LZ_TAG = 0,
+  FW_LZ_LITERAL,
+  FW_LZ_OFFSET,
+  FW_LZ_LENGTH,
+  FW_LZ_COPY,
+} fw_lz_state;
+
+typedef struct
+{
+  fw_session    *session;
+  const uint8_t *base;
+  uint32_t      base_size;
+  uint32_t      encoding;
+
+  /* LZ */
+  fw_lz_state   lz;
+  uint32_t      bits;             /*!< Payload bits not used yet, the low bit_count of them */
+  uint32_t      bit_count;
+  uint32_t      copy_offset;
+  uint32_t      copy_left;        /*!< Back-reference bytes still to copy */
+  uint32_t      head;             /*!< Next window position */
+  uint8_t       window[FW_LZ_WINDOW];
+
+  /* Delta */
+  uint32_t      control[3];       /*!< diff_size, extra_size, seek */
+  uint32_t      control_fill;     /*!< Control bytes taken */
+  uint32_t      diff_left;
+  uint32_t      extra_left;
+  uint32_t      base_offset;
+
+  uint32_t      out_fill;
+  uint8_t       out[FW_DECODE_CHUNK];
+} fw_decoder;
+
+/* base is the running image (FW_ENCODING_DELTA only), base_capacity its slot size */
+fw_status fw_decode_begin(fw_decoder *decoder, fw_session *session, const fw_flash *flash,
+                          const fw_image_header *header, const void *base, uint32_t base_capacity);
+fw_status fw_decode_write(fw_decoder *decoder, const void *data, uint32_t size, uint32_t *taken);
+fw_status fw_decode_finish(fw_decoder *decoder);
+
+#endif /* FW_DECODE_H */
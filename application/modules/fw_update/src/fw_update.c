@@ -0,0 +1,315 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "fw_update.h"
+
+#define FW_ROUND_UP(value, align)    (((value) + (align) - 1U) & ~((align) - 1U))
+
+/* CRC-32 (IEEE 802.3, reflected), four bits per step */
+static const uint32_t fw_crc_nibble[16] =
+{
+  0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+  0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU,
+};
+
+/**
+  * @brief  CRC-32 as zlib's crc32(): start from 0, chain by passing the previous result.
+  */
+uint32_t fw_crc32(const void *data, uint32_t size, uint32_t crc)
+{
+  const uint8_t *byte = data;
+
+  crc = ~crc;
+  while (size-- > 0U)
+  {
+    crc ^= *byte++;
+    crc = (crc >> 4) ^ fw_crc_nibble[crc & 0x0FU];
+    crc = (crc >> 4) ^ fw_crc_nibble[crc & 0x0FU];
+  }
+  return ~crc;
+}
+
+/**
+  * @brief  Fill in magic and header_crc (host packer).
+  */
+void fw_image_header_seal(fw_image_header *header)
+{
+  header->magic = FW_IMAGE_MAGIC;
+  header->header_crc = fw_crc32(header, offsetof(fw_image_header, header_crc), 0U);
+}
+
+fw_status fw_image_header_check(const fw_image_header *header, uint32_t slot_size)
+{
+  if ((header->magic != FW_IMAGE_MAGIC) ||
+      (header->header_crc != fw_crc32(header, offsetof(fw_image_header, header_crc), 0U)))
+  {
+    return FW_BAD_IMAGE;
+  }
+  /* The CRC unit pads the image to FW_CRC_ALIGN, which must stay clear of the trailer */
+  if ((header->size == 0U) || (slot_size < FW_CRC_ALIGN) || (header->size > slot_size - FW_CRC_ALIGN))
+  {
+    return FW_BAD_IMAGE;
+  }
+  if (((header->encoding & ~(FW_ENCODING_LZ | FW_ENCODING_DELTA)) != 0U) ||
+      (((header->encoding & FW_ENCODING_DELTA) != 0U) && (header->base_size == 0U)))
+  {
+    return FW_BAD_IMAGE;
+  }
+  return FW_OK;
+}
+
+/**
+  * @brief  Erase slot sectors until the first @p end bytes are erased.
+  * @retval FW_BUSY while an erase runs.
+  */
+static fw_status fw_update_erase_to(fw_session *session, uint32_t end)
+{
+  const fw_flash *flash = session->flash;
+  const uint32_t last = (flash->slot_size / flash->sector_size) - 1U;
+  fw_status status;
+
+  /* The trailer's sector goes first, so an interrupted update never leaves the old seal behind */
+  if (!session->trailer_erased)
+  {
+    status = flash->erase(flash->context, last);
+    if (status != FW_OK)
+    {
+      return status;
+    }
+    session->trailer_erased = 1U;
+  }
+  while (session->erased < end)
+  {
+    if (session->erased / flash->sector_size != last)
+    {
+      status = flash->erase(flash->context, session->erased / flash->sector_size);
+      if (status != FW_OK)
+      {
+        return status;
+      }
+    }
+    session->erased += flash->sector_size;
+  }
+  return FW_OK;
+}
+
+static fw_status fw_update_fail(fw_session *session, fw_status status)
+{
+  if (status != FW_BUSY)
+  {
+    session->state = FW_SESSION_FAILED;
+  }
+  return status;
+}
+
+/**
+  * @brief  Start taking in an image. Nothing is erased until data arrives.
+  */
+fw_status fw_update_begin(fw_session *session, const fw_flash *flash, const fw_image_header *header)
+{
+  if ((session == NULL) || (flash == NULL) || (header == NULL) || (flash->sector_size == 0U) ||
+      ((flash->sector_size % FW_CRC_ALIGN) != 0U) || ((flash->slot_size % flash->sector_size) != 0U))
+  {
+    return FW_ARG_ERROR;
+  }
+  memset(session, 0, sizeof(*session));
+  session->flash = flash;
+  if (fw_image_header_check(header, flash->slot_size) != FW_OK)
+  {
+    session->state = FW_SESSION_FAILED;
+    return FW_BAD_IMAGE;
+  }
+  session->header = *header;
+  session->state = FW_SESSION_RECEIVING;
+  return FW_OK;
+}
+
+/**
+  * @brief  Take in the next chunk of the image.
+  * @retval FW_BUSY when a sector erase has to finish first: nothing was taken,
+  *         call again with the same chunk.
+  */
+fw_status fw_update_write(fw_session *session, const void *data, uint32_t size)
+{
+  const uint8_t *byte = data;
+  const fw_flash *flash;
+  fw_status status;
+
+  if ((session == NULL) || (session->state != FW_SESSION_RECEIVING) || ((data == NULL) && (size != 0U)) ||
+      (size > session->header.size - session->written))
+  {
+    return FW_ARG_ERROR;
+  }
+  flash = session->flash;
+
+  /* Every flash word this chunk completes must be erased before any byte is taken */
+  status = fw_update_erase_to(session, FW_ROUND_UP(session->written + size, FW_FLASH_WORD));
+  if (status != FW_OK)
+  {
+    return fw_update_fail(session, status);
+  }
+
+  session->crc = fw_crc32(byte, size, session->crc);
+  while (size > 0U)
+  {
+    const uint32_t fill = session->written % FW_FLASH_WORD;
+    const uint32_t take = ((FW_FLASH_WORD - fill) < size) ? (FW_FLASH_WORD - fill) : size;
+
+    memcpy((uint8_t *)session->word + fill, byte, take);
+    session->written += take;
+    byte += take;
+    size -= take;
+    if ((session->written % FW_FLASH_WORD) == 0U)
+    {
+      status = flash->program(flash->context, session->written - FW_FLASH_WORD, session->word);
+      if (status != FW_OK)
+      {
+        return fw_update_fail(session, FW_IO_ERROR);
+      }
+    }
+  }
+  return FW_OK;
+}
+
+/**
+  * @brief  Verify the image in the slot and seal it with its trailer.
+  */
+fw_status fw_update_finish(fw_session *session)
+{
+  const fw_flash *flash;
+  fw_slot_trailer trailer;
+  uint32_t word[FW_FLASH_WORD / 4U];
+  uint32_t offset;
+  uint32_t crc = 0U;
+  fw_status status;
+
+  if ((session == NULL) || (session->state != FW_SESSION_RECEIVING))
+  {
+    return FW_ARG_ERROR;
+  }
+  flash = session->flash;
+  if ((session->written != session->header.size) || (session->crc != session->header.crc))
+  {
+    return fw_update_fail(session, FW_BAD_IMAGE);
+  }
+
+  if ((session->written % FW_FLASH_WORD) != 0U)
+  {
+    const uint32_t fill = session->written % FW_FLASH_WORD;
+
+    memset((uint8_t *)session->word + fill, 0xFF, FW_FLASH_WORD - fill);
+    status = flash->program(flash->context, session->written - fill, session->word);
+    session->written = FW_ROUND_UP(session->written, FW_FLASH_WORD);   /* Padded word is in */
+    if (status != FW_OK)
+    {
+      return fw_update_fail(session, FW_IO_ERROR);
+    }
+  }
+
+  /* Read back what landed in flash */
+  for (offset = 0U; offset < session->header.size; offset += FW_FLASH_WORD)
+  {
+    const uint32_t chunk = session->header.size - offset;
+
+    status = flash->read(flash->context, offset, word, FW_FLASH_WORD);
+    if (status != FW_OK)
+    {
+      return fw_update_fail(session, FW_IO_ERROR);
+    }
+    crc = fw_crc32(word, (chunk < FW_FLASH_WORD) ? chunk : FW_FLASH_WORD, crc);
+  }
+  if (crc != session->header.crc)
+  {
+    return fw_update_fail(session, FW_BAD_IMAGE);
+  }
+
+  memset(&trailer, 0xFF, sizeof(trailer));
+  trailer.magic = FW_TRAILER_MAGIC;
+  trailer.version = session->header.version;
+  trailer.size = session->header.size;
+  trailer.crc = session->header.crc;
+  status = flash->crc(flash->context, 0U, FW_ROUND_UP(session->header.size, FW_CRC_ALIGN), &trailer.hw_crc);
+  if (status != FW_OK)
+  {
+    return fw_update_fail(session, FW_IO_ERROR);
+  }
+  trailer.trailer_crc = fw_crc32(&trailer, offsetof(fw_slot_trailer, trailer_crc), 0U);
+  status = flash->program(flash->context, flash->slot_size - FW_FLASH_WORD, &trailer);
+  if (status != FW_OK)
+  {
+    return fw_update_fail(session, FW_IO_ERROR);
+  }
+
+  session->state = FW_SESSION_DONE;
+  return FW_OK;
+}
+
+void fw_update_abort(fw_session *session)
+{
+  if (session != NULL)
+  {
+    session->state = FW_SESSION_IDLE;
+  }
+}
+
+/**
+  * @brief  Whether the slot holds a sealed image the flash CRC unit still agrees with.
+  * @param  trailer Receives the slot's trailer (may be NULL).
+  */
+fw_status fw_update_slot_check(const fw_flash *flash, fw_slot_trailer *trailer)
+{
+  fw_slot_trailer local;
+  uint32_t hw_crc;
+  fw_status status;
+
+  if (flash == NULL)
+  {
+    return FW_ARG_ERROR;
+  }
+  trailer = (trailer != NULL) ? trailer : &local;
+  status = flash->read(flash->context, flash->slot_size - FW_FLASH_WORD, trailer, sizeof(*trailer));
+  if (status != FW_OK)
+  {
+    return status;
+  }
+  if ((trailer->magic != FW_TRAILER_MAGIC) ||
+      (trailer->trailer_crc != fw_crc32(trailer, offsetof(fw_slot_trailer, trailer_crc), 0U)) ||
+      (trailer->size == 0U) || (trailer->size > flash->slot_size - FW_CRC_ALIGN))
+  {
+    return FW_BAD_IMAGE;
+  }
+  status = flash->crc(flash->context, 0U, FW_ROUND_UP(trailer->size, FW_CRC_ALIGN), &hw_crc);
+  if (status != FW_OK)
+  {
+    return status;
+  }
+  return (hw_crc == trailer->hw_crc) ? FW_OK : FW_BAD_IMAGE;
+}
+
+/**
+  * @brief  Decide what this boot is. A missing or damaged record counts as confirmed.
+  */
+fw_boot_action fw_boot_next(fw_boot_record *record)
+{
+  if ((record->magic != FW_BOOT_MAGIC) || (record->trial == 0U))
+  {
+    return FW_BOOT_RUN;
+  }
+  record->attempts++;
+  return (record->attempts > FW_BOOT_MAX_ATTEMPTS) ? FW_BOOT_ROLLBACK : FW_BOOT_TRIAL;
+}
+
+void fw_boot_start_trial(fw_boot_record *record, uint32_t version)
+{
+  record->magic = FW_BOOT_MAGIC;
+  record->version = version;
+  record->trial = 1U;
+  record->attempts = 0U;
+}
+
+void fw_update_confirm(fw_boot_record *record)
+{
+  record->magic = FW_BOOT_MAGIC;
+  record->trial = 0U;
+  record->attempts = 0U;
+}
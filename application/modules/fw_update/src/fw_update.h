@@ -0,0 +1,151 @@
+#ifndef FW_UPDATE_H
+#define FW_UPDATE_H
+
+#include <stdint.h>
+
+/*
+ * A/B firmware update: streams an image into the inactive slot while the
+ * application keeps running.
+ *
+ * An update is a fw_image_header followed by the image bytes, in chunks of
+ * any size. fw_update_write() erases the slot's last sector (the old
+ * trailer) first, then sectors just ahead of the data, and programs whole
+ * flash words. fw_update_finish() then checks the image three ways:
+ *  - the CRC-32 of the stream against the header;
+ *  - the CRC-32 of the slot, read back;
+ *  - the flash's own CRC unit (fw_flash.crc).
+ * The hardware CRC goes into a fw_slot_trailer, programmed last into the
+ * final flash word of the slot. A slot is bootable only with a valid
+ * trailer whose hardware CRC still matches (fw_update_slot_check()), so an
+ * update cut short by a reset or power loss leaves no bootable image and
+ * is restarted from the beginning.
+ *
+ * Activation and rollback are the target's business (fw_update_hal.h); the
+ * trial-boot bookkeeping is here so that it runs on the host too: a new
+ * image boots as a trial and is rolled back after FW_BOOT_MAX_ATTEMPTS
+ * boots without fw_update_confirm().
+ *
+ * A compressed or delta update goes through fw_decode.h, which decodes the
+ * payload into fw_update_write() as it arrives.
+ *
+ * HAL-free: flash is reached through fw_flash. Host builds use a simulated
+ * flash (tools/fw_update_sim.c), and tools/fw_pack.c builds update files.
+ */
+
+#define FW_FLASH_WORD          32U
+#define FW_CRC_ALIGN           128U          /*!< CRC unit burst (4 flash words): the image is hashed to this */
+#define FW_BOOT_MAX_ATTEMPTS   3U
+
+#define FW_IMAGE_MAGIC         0x31574655U   /* "UFW1" */
+#define FW_TRAILER_MAGIC       0x54574655U   /* "UFWT" */
+#define FW_BOOT_MAGIC          0x42574655U   /* "UFWB" */
+
+typedef enum
+{
+  FW_OK        =  0,
+  FW_BUSY      = -1,   /*!< Erase running: call again later with the same arguments */
+  FW_ARG_ERROR = -2,   /*!< Bad argument or call out of sequence */
+  FW_BAD_IMAGE = -3,   /*!< Header, size or CRC mismatch */
+  FW_IO_ERROR  = -4,   /*!< Backend failed */
+} fw_status;
+
+/*
+ * Flash backend for one slot. Offsets are bytes from the start of the slot;
+ * sector s spans [s * sector_size, (s + 1) * sector_size). program() writes
+ * one erased, word-aligned flash word. erase() may return FW_BUSY and is
+ * then called again with the same sector until it returns FW_OK. crc()
+ * runs the flash CRC unit over [offset, offset + size), both FW_CRC_ALIGN
+ * multiples; its algorithm does not matter as long as it is repeatable.
+ */
+typedef struct
+{
+  fw_status (*read)(void *context, uint32_t offset, void *data, uint32_t size);
+  fw_status (*program)(void *context, uint32_t offset, const void *word);
+  fw_status (*erase)(void *context, uint32_t sector);
+  fw_status (*crc)(void *context, uint32_t offset, uint32_t size, uint32_t *crc);
+  void     *context;
+  uint32_t slot_size;
+  uint32_t sector_size;
+} fw_flash;
+
+#define FW_ENCODING_LZ         0x1U          /*!< Payload is compressed (fw_decode.h) */
+#define FW_ENCODING_DELTA      0x2U          /*!< Payload patches the running image (fw_decode.h) */
+
+/* Sent ahead of the payload; one flash word */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;          /*!< Image bytes, once decoded */
+  uint32_t crc;           /*!< fw_crc32 of the image */
+  uint32_t encoding;      /*!< FW_ENCODING_xxx, 0 for the plain image */
+  uint32_t base_size;     /*!< FW_ENCODING_DELTA: bytes of the image patched */
+  uint32_t base_crc;      /*!< FW_ENCODING_DELTA: its fw_crc32 */
+  uint32_t header_crc;    /*!< fw_crc32 of the fields above */
+} fw_image_header;
+
+/* Last flash word of a slot, programmed once the image is verified */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;
+  uint32_t crc;           /*!< fw_crc32 of the image */
+  uint32_t hw_crc;        /*!< Flash CRC unit over the image, padded to FW_CRC_ALIGN */
+  uint32_t reserved[2];   /*!< Erased */
+  uint32_t trailer_crc;   /*!< fw_crc32 of the fields above */
+} fw_slot_trailer;
+
+typedef enum
+{
+  FW_SESSION_IDLE = 0,
+  FW_SESSION_RECEIVING,
+  FW_SESSION_DONE,
+  FW_SESSION_FAILED,
+} fw_session_state;
+
+typedef struct
+{
+  const fw_flash   *flash;
+  fw_image_header  header;
+  fw_session_state state;
+  uint32_t         written;          /*!< Image bytes taken in */
+  uint32_t         erased;           /*!< Slot bytes erased, from the start */
+  uint32_t         trailer_erased;   /*!< Last sector erased, before anything else */
+  uint32_t         crc;              /*!< Running fw_crc32 of the image */
+  uint32_t         word[FW_FLASH_WORD / 4U];   /*!< Flash word being filled */
+} fw_session;
+
+/* Trial-boot record, kept by the application (fw_update_hal.c: in kv_store) */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t version;    /*!< Image on trial */
+  uint32_t trial;      /*!< 1 until fw_update_confirm() */
+  uint32_t attempts;   /*!< Boots of the trial image so far */
+} fw_boot_record;
+
+typedef enum
+{
+  FW_BOOT_RUN = 0,     /*!< Confirmed image */
+  FW_BOOT_TRIAL,       /*!< Trial image, attempts left */
+  FW_BOOT_ROLLBACK,    /*!< Trial image failed to confirm: go back */
+} fw_boot_action;
+
+uint32_t  fw_crc32(const void *data, uint32_t size, uint32_t crc);
+void      fw_image_header_seal(fw_image_header *header);
+fw_status fw_image_header_check(const fw_image_header *header, uint32_t slot_size);
+
+fw_status fw_update_begin(fw_session *session, const fw_flash *flash, const fw_image_header *header);
+fw_status fw_update_write(fw_session *session, const void *data, uint32_t size);
+fw_status fw_update_finish(fw_session *session);
+void      fw_update_abort(fw_session *session);
+
+fw_status fw_update_slot_check(const fw_flash *flash, fw_slot_trailer *trailer);
+
+/* Counts this boot against the record; the record must then be stored */
+fw_boot_action fw_boot_next(fw_boot_record *record);
+void           fw_boot_start_trial(fw_boot_record *record, uint32_t version);
+void           fw_update_confirm(fw_boot_record *record);
+
+#endif /* FW_UPDATE_H */
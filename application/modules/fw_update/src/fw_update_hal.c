@@ -0,0 +1,283 @@
+#include <string.h>
+
+#include "fw_update_hal.h"
+#include "flash_service.h"
+#include "boot_header.h"
+
+/* Result of the backend's flash service job */
+typedef struct
+{
+  volatile uint32_t          pending;
+  volatile HAL_StatusTypeDef status;
+} fw_update_hal_job;
+
+static fw_update_hal_job fw_update_hal_program_job;
+static fw_update_hal_job fw_update_hal_erase_job;
+static uint32_t          fw_update_hal_erasing;   /* 1 + sector being erased, 0 for none */
+
+static void fw_update_hal_done(HAL_StatusTypeDef status, uint32_t address, void *context)
+{
+  fw_update_hal_job *job = context;
+
+  UNUSED(address);
+  job->status = status;
+  job->pending = 0U;
+}
+
+static fw_status fw_update_hal_read(void *context, uint32_t offset, void *data, uint32_t size)
+{
+  UNUSED(context);
+  if (offset + size > FW_UPDATE_SLOT_SECTORS * FLASH_SECTOR_SIZE)
+  {
+    return FW_ARG_ERROR;
+  }
+  memcpy(data, (const void *)(FW_UPDATE_SLOT_BASE + offset), size);
+  return FW_OK;
+}
+
+static fw_status fw_update_hal_program(void *context, uint32_t offset, const void *word)
+{
+  HAL_StatusTypeDef status;
+
+  UNUSED(context);
+  fw_update_hal_program_job.pending = 1U;
+  do
+  {
+    status = FlashSvc_Program(FW_UPDATE_SLOT_BASE + offset, word, FW_FLASH_WORD, fw_update_hal_done,
+                              &fw_update_hal_program_job);
+  } while (status == HAL_BUSY);
+  if (status != HAL_OK)
+  {
+    return FW_IO_ERROR;
+  }
+  while (fw_update_hal_program_job.pending != 0U)
+  {
+    __WFI();
+  }
+  return (fw_update_hal_program_job.status == HAL_OK) ? FW_OK : FW_IO_ERROR;
+}
+
+/**
+  * @brief  Queue a sector erase, or poll the one already queued.
+  * @retval FW_BUSY until the erase is done.
+  */
+static fw_status fw_update_hal_erase(void *context, uint32_t sector)
+{
+  UNUSED(context);
+  if ((sector >= FW_UPDATE_SLOT_SECTORS) || ((fw_update_hal_erasing != 0U) && (fw_update_hal_erasing != sector + 1U)))
+  {
+    return FW_ARG_ERROR;
+  }
+
+  if (fw_update_hal_erasing == 0U)
+  {
+    fw_update_hal_erase_job.pending = 1U;
+    switch (FlashSvc_Erase(FW_UPDATE_SLOT_BASE + (sector * FLASH_SECTOR_SIZE), 1U, fw_update_hal_done,
+                           &fw_update_hal_erase_job))
+    {
+      case HAL_OK:
+        fw_update_hal_erasing = sector + 1U;
+        return FW_BUSY;
+      case HAL_BUSY:
+        return FW_BUSY;
+      default:
+        return FW_IO_ERROR;
+    }
+  }
+
+  if (fw_update_hal_erase_job.pending != 0U)
+  {
+    return FW_BUSY;
+  }
+  fw_update_hal_erasing = 0U;
+  return (fw_update_hal_erase_job.status == HAL_OK) ? FW_OK : FW_IO_ERROR;
+}
+
+/**
+  * @brief  Flash CRC unit over part of the slot. Waits for the flash service
+  *         to drain first: the unit reads bank 2 through its own port.
+  */
+static fw_status fw_update_hal_crc(void *context, uint32_t offset, uint32_t size, uint32_t *crc)
+{
+  FLASH_CRCInitTypeDef init = {0};
+  HAL_StatusTypeDef status;
+
+  UNUSED(context);
+  if ((size == 0U) || (offset + size > FW_UPDATE_SLOT_SECTORS * FLASH_SECTOR_SIZE))
+  {
+    return FW_ARG_ERROR;
+  }
+  if (FlashSvc_WaitIdle(HAL_MAX_DELAY) != HAL_OK)
+  {
+    return FW_IO_ERROR;
+  }
+
+  init.TypeCRC = FLASH_CRC_ADDR;
+  init.BurstSize = FLASH_CRC_BURST_SIZE_4;
+  init.Bank = FLASH_BANK_2;
+  init.CRCStartAddr = FW_UPDATE_SLOT_BASE + offset;
+  init.CRCEndAddr = FW_UPDATE_SLOT_BASE + offset + size - 1U;
+
+  (void)HAL_FLASH_Unlock();
+  status = HAL_FLASHEx_ComputeCRC(&init, crc);
+  (void)HAL_FLASH_Lock();
+  return (status == HAL_OK) ? FW_OK : FW_IO_ERROR;
+}
+
+void fw_update_hal_init(fw_flash *flash)
+{
+  flash->read = fw_update_hal_read;
+  flash->program = fw_update_hal_program;
+  flash->erase = fw_update_hal_erase;
+  flash->crc = fw_update_hal_crc;
+  flash->context = NULL;
+  flash->slot_size = FW_UPDATE_SLOT_SECTORS * FLASH_SECTOR_SIZE;
+  flash->sector_size = FLASH_SECTOR_SIZE;
+}
+
+/**
+  * @brief  Whether the banks are swapped, i.e. physical bank 2 runs.
+  */
+uint32_t fw_update_hal_swapped(void)
+{
+  return ((FLASH->OPTCR & FLASH_OPTCR_SWAP_BANK) != 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  Flip SWAP_BANK and reset into the other bank.
+  * @retval Only on failure.
+  */
+static fw_status fw_update_hal_swap(void)
+{
+  FLASH_OBProgramInitTypeDef ob = {0};
+  HAL_StatusTypeDef status;
+
+  (void)FlashSvc_WaitIdle(HAL_MAX_DELAY);
+
+  ob.OptionType = OPTIONBYTE_USER;
+  ob.USERType = OB_USER_SWAP_BANK;
+  ob.USERConfig = (fw_update_hal_swapped() != 0U) ? OB_SWAP_BANK_DISABLE : OB_SWAP_BANK_ENABLE;
+
+  (void)HAL_FLASH_Unlock();
+  (void)HAL_FLASH_OB_Unlock();
+  status = HAL_FLASHEx_OBProgram(&ob);
+  if (status == HAL_OK)
+  {
+    status = HAL_FLASH_OB_Launch();
+  }
+  (void)HAL_FLASH_OB_Lock();
+  (void)HAL_FLASH_Lock();
+  if (status != HAL_OK)
+  {
+    return FW_IO_ERROR;
+  }
+
+  NVIC_SystemReset();
+  return FW_OK;
+}
+
+static fw_status fw_update_hal_store(kv_store *kv, const fw_boot_record *record)
+{
+  return (kv_set(kv, FW_UPDATE_KV_KEY, record, (uint16_t)sizeof(*record)) == KV_OK) ? FW_OK : FW_IO_ERROR;
+}
+
+/**
+  * @brief  Put the sealed image in the slot on trial and boot it.
+  * @retval Only on failure: FW_BAD_IMAGE if the slot does not check out.
+  */
+fw_status fw_update_hal_activate(const fw_flash *flash, kv_store *kv)
+{
+  boot_app_header header;
+  fw_slot_trailer trailer;
+  fw_boot_record record;
+  fw_status status;
+
+  status = fw_update_slot_check(flash, &trailer);
+  if (status != FW_OK)
+  {
+    return status;
+  }
+  /* fw_update_hal_boot() tells the trial image by its header's version */
+  status = flash->read(flash->context, (BOOT_APP_BASE - FW_UPDATE_ACTIVE_BASE) + BOOT_HEADER_OFFSET,
+                       &header, sizeof(header));
+  if (status != FW_OK)
+  {
+    return status;
+  }
+  if ((header.magic != BOOT_APP_MAGIC) || (header.version != trailer.version))
+  {
+    return FW_BAD_IMAGE;
+  }
+  fw_boot_start_trial(&record, trailer.version);
+  status = fw_update_hal_store(kv, &record);
+  if (status != FW_OK)
+  {
+    return status;
+  }
+  return fw_update_hal_swap();
+}
+
+/**
+  * @brief  Count this boot of a trial image, rolling back once it has had
+  *         FW_BOOT_MAX_ATTEMPTS. Call early, right after kv_mount().
+  * @retval FW_OK to carry on. FW_BAD_IMAGE if a rollback was due but the old
+  *         slot is no longer sealed: the trial image is then kept.
+  */
+fw_status fw_update_hal_boot(const fw_flash *flash, kv_store *kv)
+{
+  fw_boot_record record;
+  uint16_t size = 0U;
+
+  if ((kv_get(kv, FW_UPDATE_KV_KEY, &record, (uint16_t)sizeof(record), &size) != KV_OK) ||
+      (size != sizeof(record)))
+  {
+    return FW_OK;   /* Never updated */
+  }
+
+  /* The bootloader refused the trial image and went back to this one */
+  if ((record.magic == FW_BOOT_MAGIC) && (record.trial != 0U) && (record.version != BOOT_APP_HEADER->version))
+  {
+    fw_update_confirm(&record);
+    return fw_update_hal_store(kv, &record);
+  }
+
+  switch (fw_boot_next(&record))
+  {
+    case FW_BOOT_RUN:
+      return FW_OK;
+
+    case FW_BOOT_TRIAL:
+      return fw_update_hal_store(kv, &record);
+
+    default:
+      /* The old image is confirmed either way: it ran before the update */
+      fw_update_confirm(&record);
+      if (fw_update_slot_check(flash, NULL) != FW_OK)
+      {
+        (void)fw_update_hal_store(kv, &record);
+        return FW_BAD_IMAGE;
+      }
+      if (fw_update_hal_store(kv, &record) != FW_OK)
+      {
+        return FW_IO_ERROR;
+      }
+      return fw_update_hal_swap();
+  }
+}
+
+/**
+  * @brief  The running image works: stop counting its boots.
+  */
+fw_status fw_update_hal_confirm(kv_store *kv)
+{
+  fw_boot_record record;
+  uint16_t size = 0U;
+
+  if ((kv_get(kv, FW_UPDATE_KV_KEY, &record, (uint16_t)sizeof(record), &size) != KV_OK) ||
+      (size != sizeof(record)) || (record.trial == 0U))
+  {
+    return FW_OK;
+  }
+  fw_update_confirm(&record);
+  return fw_update_hal_store(kv, &record);
+}
@@ -0,0 +1,47 @@
+#ifndef FW_UPDATE_HAL_H
+#define FW_UPDATE_HAL_H
+
+#include "stm32h7xx_hal.h"
+#include "fw_update.h"
+#include "kv_store.h"
+
+/*
+ * STM32H7 side of the A/B update: the two flash banks are the two slots.
+ *
+ * The running image is always mapped at 0x08000000 and the other bank at
+ * FW_UPDATE_SLOT_BASE; the SWAP_BANK option bit decides which physical
+ * bank is which. An image occupies sectors 0-5 of its bank: the bootloader
+ * in sector 0, then the application (tools/app_seal.c writes the pair as
+ * one binary, which the linker script keeps to 768 KB less the CRC
+ * padding). Sectors 6-7 belong to kv_store, whose kv_flash_hal_init()
+ * carries the store across a swap. The image's version must be its
+ * application header's (boot_header.h).
+ * Programming goes through the flash service; the slot is checked with
+ * HAL_FLASHEx_ComputeCRC().
+ *
+ * fw_update_hal_activate() marks the new image as on trial in kv_store,
+ * flips SWAP_BANK and resets. Early in every boot, after kv_mount(),
+ * fw_update_hal_boot() counts trial boots. Once there have been
+ * FW_BOOT_MAX_ATTEMPTS of them without fw_update_hal_confirm(), it flips
+ * SWAP_BANK back, but only if the old slot is still sealed. An image that
+ * hangs must therefore be reset by the watchdog. One that fails the
+ * bootloader's check never runs: the bootloader swaps back itself, and
+ * fw_update_hal_boot() then finds a different version running and
+ * confirms it. An image flashed by a
+ * debugger has no trailer, so it cannot be rolled back to.
+ */
+#define FW_UPDATE_ACTIVE_BASE    FLASH_BANK1_BASE   /*!< The running image: base of delta updates */
+#define FW_UPDATE_SLOT_BASE      FLASH_BANK2_BASE   /*!< The bank not running */
+#define FW_UPDATE_SLOT_SECTORS   6U
+#define FW_UPDATE_KV_KEY         0xFF00U            /*!< fw_boot_record in kv_store */
+
+void      fw_update_hal_init(fw_flash *flash);
+uint32_t  fw_update_hal_swapped(void);
+
+/* Both reset the core on success */
+fw_status fw_update_hal_activate(const fw_flash *flash, kv_store *kv);
+fw_status fw_update_hal_boot(const fw_flash *flash, kv_store *kv);
+
+fw_status fw_update_hal_confirm(kv_store *kv);
+
+#endif /* FW_UPDATE_HAL_H */
@@ -0,0 +1,44 @@
+#include "gpio_fast.h"
+
+/* GPIO ports sit 0x400 apart, clocked by consecutive AHB4ENR bits */
+static void GPIOFast_EnablePort(const GPIO_TypeDef *port)
+{
+  RCC->AHB4ENR |= 1UL << (((uint32_t)port - GPIOA_BASE) / 0x400U);
+  (void)RCC->AHB4ENR;
+}
+
+/**
+  * @brief  Push-pull output, driven to @p level before it is enabled so
+  *         that it starts without a glitch.
+  * @param  speed GPIO_SPEED_FREQ_xxx: LOW for slow signals, VERY_HIGH only
+  *         where the edges must be sharp.
+  */
+void GPIOFast_InitOutput(GPIOFast_PinTypeDef pin, GPIO_PinState level, uint32_t speed)
+{
+  GPIO_InitTypeDef init = {0};
+
+  GPIOFast_EnablePort(pin.Port);
+  GPIOFast_Write(pin, (uint32_t)level);
+
+  init.Pin = pin.Mask;
+  init.Mode = GPIO_MODE_OUTPUT_PP;
+  init.Pull = GPIO_NOPULL;
+  init.Speed = speed;
+  HAL_GPIO_Init(pin.Port, &init);
+}
+
+/**
+  * @param  pull GPIO_NOPULL, GPIO_PULLUP or GPIO_PULLDOWN.
+  */
+void GPIOFast_InitInput(GPIOFast_PinTypeDef pin, uint32_t pull)
+{
+  GPIO_InitTypeDef init = {0};
+
+  GPIOFast_EnablePort(pin.Port);
+
+  init.Pin = pin.Mask;
+  init.Mode = GPIO_MODE_INPUT;
+  init.Pull = pull;
+  init.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(pin.Port, &init);
+}
@@ -0,0 +1,103 @@
+#ifndef GPIO_FAST_H
+#define GPIO_FAST_H
+
+#include "stm32h7xx_hal.h"
+
+/*
+ * Pin access for strobes, bit-banged buses and timing probes, without
+ * HAL_GPIO_WritePin()'s call, parameter checks and branch.
+ *
+ * A pin is a GPIOFast_PinTypeDef: its port and a GPIO_PIN_x mask, which
+ * may hold several pins of that port. Declare pins as constants:
+ *
+ *   #define PIN_STROBE   GPIO_FAST_PIN(GPIOB, GPIO_PIN_0)
+ *   static const GPIOFast_PinTypeDef pin_probe = { GPIOE, GPIO_PIN_1 };
+ *
+ * Every access below is force-inlined, so with a constant pin the port
+ * address and mask fold into the instruction stream. A set or reset is a
+ * single store to BSRR, and a write of a variable level adds a shift.
+ * Toggle and port writes are one load from ODR and one store to BSRR.
+ * Using BSRR keeps all of these atomic against interrupts that drive other
+ * pins of the same port. An ODR read-modify-write would undo their changes.
+ * Only two writers of the same pin can race, in a toggle.
+ *
+ * Stores to GPIO go through the AHB4 bridge and are buffered, so two in a
+ * row give a pulse a few bus cycles wide. GPIOFast_Pulse() reads the port
+ * back between them, so the pin is high for at least the store's round
+ * trip. Use __DSB() where a pin must have changed before what follows,
+ * such as a timestamp.
+ *
+ * GPIOFast_InitOutput() and GPIOFast_InitInput() set the pins up once,
+ * through HAL_GPIO_Init(). Bench_Gpio() (benchmark module) compares the
+ * cycles and code size against HAL_GPIO_WritePin().
+ */
+typedef struct
+{
+  GPIO_TypeDef *Port;
+  uint16_t      Mask;   /*!< GPIO_PIN_x, or several of them or'ed */
+} GPIOFast_PinTypeDef;
+
+#define GPIO_FAST_PIN(port, mask)  ((GPIOFast_PinTypeDef){ (port), (uint16_t)(mask) })
+
+void GPIOFast_InitOutput(GPIOFast_PinTypeDef pin, GPIO_PinState level, uint32_t speed);
+void GPIOFast_InitInput(GPIOFast_PinTypeDef pin, uint32_t pull);
+
+__STATIC_FORCEINLINE void GPIOFast_Set(GPIOFast_PinTypeDef pin)
+{
+  pin.Port->BSRR = pin.Mask;
+}
+
+__STATIC_FORCEINLINE void GPIOFast_Reset(GPIOFast_PinTypeDef pin)
+{
+  pin.Port->BSRR = (uint32_t)pin.Mask << 16U;
+}
+
+/**
+  * @brief  Drives every pin of @p pin to @p level (0 or not), branch-free.
+  */
+__STATIC_FORCEINLINE void GPIOFast_Write(GPIOFast_PinTypeDef pin, uint32_t level)
+{
+  pin.Port->BSRR = (uint32_t)pin.Mask << ((level != 0U) ? 0U : 16U);
+}
+
+__STATIC_FORCEINLINE void GPIOFast_Toggle(GPIOFast_PinTypeDef pin)
+{
+  const uint32_t odr = pin.Port->ODR;
+
+  pin.Port->BSRR = ((odr & pin.Mask) << 16U) | (~odr & pin.Mask);
+}
+
+/**
+  * @brief  The pins go high, then low.
+  */
+__STATIC_FORCEINLINE void GPIOFast_Pulse(GPIOFast_PinTypeDef pin)
+{
+  pin.Port->BSRR = pin.Mask;
+  (void)pin.Port->ODR;
+  pin.Port->BSRR = (uint32_t)pin.Mask << 16U;
+}
+
+/**
+  * @brief  Reads the pins' input levels: non-zero if any of them is high.
+  */
+__STATIC_FORCEINLINE uint32_t GPIOFast_Read(GPIOFast_PinTypeDef pin)
+{
+  return pin.Port->IDR & pin.Mask;
+}
+
+/**
+  * @brief  Drives the pins of @p mask to the matching bits of @p value in one
+  *         store, e.g. a nibble of a parallel bus; the port's other pins
+  *         are untouched.
+  */
+__STATIC_FORCEINLINE void GPIOFast_WritePort(GPIO_TypeDef *port, uint32_t mask, uint32_t value)
+{
+  port->BSRR = ((mask & ~value) << 16U) | (mask & value);
+}
+
+__STATIC_FORCEINLINE uint32_t GPIOFast_ReadPort(const GPIO_TypeDef *port)
+{
+  return port->IDR;
+}
+
+#endif /* GPIO_FAST_H */
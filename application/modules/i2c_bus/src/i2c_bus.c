@@ -0,0 +1,683 @@
+#include <string.h>
+
+#include "i2c_bus.h"
+#include "irq_config.h"
+#include "perf.h"
+
+#define I2C_BUS_INSTANCES      3U
+#define I2C_BUS_CHUNK          255U       /* NBYTES */
+#define I2C_BUS_RECOVERY_PULSES  9U
+#define I2C_BUS_RECOVERY_STRETCH 10U      /* Ticks a slave may hold SCL low in the recovery */
+#define I2C_BUS_ICR_ALL        (I2C_ICR_ADDRCF | I2C_ICR_NACKCF | I2C_ICR_STOPCF | I2C_ICR_BERRCF | \
+                                I2C_ICR_ARLOCF | I2C_ICR_OVRCF | I2C_ICR_PECCF | I2C_ICR_TIMOUTCF | \
+                                I2C_ICR_ALERTCF)
+
+typedef struct
+{
+  I2C_TypeDef *Instance;
+  uint32_t     TxRequest;
+  uint32_t     RxRequest;
+  IRQn_Type    EvIRQn;
+  IRQn_Type    ErIRQn;
+  uint32_t     FastModePlus;   /*!< SYSCFG_PMCR bit */
+} I2CBus_PortTypeDef;
+
+static const I2CBus_PortTypeDef i2c_bus_ports[I2C_BUS_INSTANCES] =
+{
+  { I2C1, DMA_REQUEST_I2C1_TX, DMA_REQUEST_I2C1_RX, I2C1_EV_IRQn, I2C1_ER_IRQn, SYSCFG_PMCR_I2C1_FMP },
+  { I2C2, DMA_REQUEST_I2C2_TX, DMA_REQUEST_I2C2_RX, I2C2_EV_IRQn, I2C2_ER_IRQn, SYSCFG_PMCR_I2C2_FMP },
+  { I2C3, DMA_REQUEST_I2C3_TX, DMA_REQUEST_I2C3_RX, I2C3_EV_IRQn, I2C3_ER_IRQn, SYSCFG_PMCR_I2C3_FMP },
+};
+
+/* Bus recovery steps, one per I2CBus_Tick(); IDLE when the pins are with the I2C */
+#define I2C_BUS_RECOVERY_IDLE      0U
+#define I2C_BUS_RECOVERY_HIGH      1U   /* SCL released: wait out a stretch, then pulse or STOP */
+#define I2C_BUS_RECOVERY_LOW       2U   /* SCL low for a pulse */
+#define I2C_BUS_RECOVERY_STOP_SDA  3U   /* SCL low: take SDA low */
+#define I2C_BUS_RECOVERY_STOP_SCL  4U   /* Release SCL, SDA still low */
+#define I2C_BUS_RECOVERY_STOP_END  5U   /* Release SDA: the STOP */
+#define I2C_BUS_RECOVERY_DONE      6U   /* Pins back to the I2C, queue restarted */
+
+static I2CBus_HandleTypeDef *i2c_bus_owner[I2C_BUS_INSTANCES];
+
+static void i2c_bus_start(I2CBus_HandleTypeDef *bus);
+
+static uint32_t i2c_bus_index(const I2C_TypeDef *instance)
+{
+  uint32_t i;
+
+  for (i = 0U; i < I2C_BUS_INSTANCES; i++)
+  {
+    if (i2c_bus_ports[i].Instance == instance)
+    {
+      return i;
+    }
+  }
+  return I2C_BUS_INSTANCES;
+}
+
+static void i2c_bus_enable_clock(uint32_t index)
+{
+  switch (index)
+  {
+    case 0U: __HAL_RCC_I2C1_CLK_ENABLE(); __HAL_RCC_I2C1_FORCE_RESET(); __HAL_RCC_I2C1_RELEASE_RESET(); break;
+    case 1U: __HAL_RCC_I2C2_CLK_ENABLE(); __HAL_RCC_I2C2_FORCE_RESET(); __HAL_RCC_I2C2_RELEASE_RESET(); break;
+    case 2U: __HAL_RCC_I2C3_CLK_ENABLE(); __HAL_RCC_I2C3_FORCE_RESET(); __HAL_RCC_I2C3_RELEASE_RESET(); break;
+    default: break;
+  }
+}
+
+/* GPIO ports sit 0x400 apart, clocked by consecutive AHB4ENR bits */
+static void i2c_bus_enable_port(const GPIO_TypeDef *port)
+{
+  RCC->AHB4ENR |= 1UL << (((uint32_t)port - GPIOA_BASE) / 0x400U);
+  (void)RCC->AHB4ENR;
+}
+
+/**
+  * @brief  Hands both pins to the I2C (GPIO_MODE_AF_OD) or to the bus
+  *         recovery (GPIO_MODE_OUTPUT_OD, released high).
+  */
+static void i2c_bus_pins(const I2CBus_HandleTypeDef *bus, uint32_t mode)
+{
+  const I2CBus_ConfigTypeDef *config = &bus->Config;
+  GPIO_InitTypeDef init = {0};
+
+  HAL_GPIO_WritePin(config->SclPort, config->SclPin, GPIO_PIN_SET);
+  HAL_GPIO_WritePin(config->SdaPort, config->SdaPin, GPIO_PIN_SET);
+
+  init.Mode = mode;
+  init.Pull = GPIO_NOPULL;
+  init.Speed = GPIO_SPEED_FREQ_HIGH;
+  init.Alternate = config->Alternate;
+  init.Pin = config->SclPin;
+  HAL_GPIO_Init(config->SclPort, &init);
+  init.Pin = config->SdaPin;
+  HAL_GPIO_Init(config->SdaPort, &init);
+}
+
+/* PE low resets the I2C state machine and flags; it must stay low for three APB cycles */
+static void i2c_bus_disable(I2C_TypeDef *i2c)
+{
+  i2c->CR1 &= ~I2C_CR1_PE;
+  (void)i2c->CR1;
+  (void)i2c->CR1;
+  (void)i2c->CR1;
+}
+
+/**
+  * @brief  Starts freeing a bus held by a slave stuck mid-byte: stops the
+  *         I2C and hands the pins to I2CBus_Tick(), which clocks SCL until
+  *         the slave lets SDA go, nine pulses at most, then sends a STOP.
+  *         Returns at once; the queue holds until the tick gives the pins
+  *         back to the I2C.
+  */
+static void i2c_bus_recover(I2CBus_HandleTypeDef *bus)
+{
+  if (bus->Recovery != I2C_BUS_RECOVERY_IDLE)
+  {
+    return;
+  }
+  i2c_bus_disable(bus->Config.Instance);
+  bus->Stats.Recoveries++;
+  i2c_bus_pins(bus, GPIO_MODE_OUTPUT_OD);
+  bus->Recovery = I2C_BUS_RECOVERY_HIGH;
+}
+
+/**
+  * @brief  One half SCL period of the recovery, from I2CBus_Tick().
+  */
+static void i2c_bus_recover_step(I2CBus_HandleTypeDef *bus)
+{
+  const I2CBus_ConfigTypeDef *config = &bus->Config;
+  uint32_t primask;
+
+  switch (bus->Recovery)
+  {
+    case I2C_BUS_RECOVERY_HIGH:
+      /* A slave may stretch the clock, but not for ever */
+      if ((HAL_GPIO_ReadPin(config->SclPort, config->SclPin) == GPIO_PIN_RESET) &&
+          (bus->Stretch < I2C_BUS_RECOVERY_STRETCH))
+      {
+        bus->Stretch++;
+        break;
+      }
+      bus->Stretch = 0U;
+      /* SDA is read with SCL high, before the falling edge lets the slave change it */
+      if ((bus->Pulses < I2C_BUS_RECOVERY_PULSES) &&
+          (HAL_GPIO_ReadPin(config->SdaPort, config->SdaPin) == GPIO_PIN_RESET))
+      {
+        bus->Pulses++;
+        bus->Recovery = I2C_BUS_RECOVERY_LOW;
+      }
+      else
+      {
+        bus->Recovery = I2C_BUS_RECOVERY_STOP_SDA;
+      }
+      HAL_GPIO_WritePin(config->SclPort, config->SclPin, GPIO_PIN_RESET);
+      break;
+
+    case I2C_BUS_RECOVERY_LOW:
+      HAL_GPIO_WritePin(config->SclPort, config->SclPin, GPIO_PIN_SET);
+      bus->Recovery = I2C_BUS_RECOVERY_HIGH;
+      break;
+
+    /* STOP: SDA rises while SCL is high */
+    case I2C_BUS_RECOVERY_STOP_SDA:
+      HAL_GPIO_WritePin(config->SdaPort, config->SdaPin, GPIO_PIN_RESET);
+      bus->Recovery = I2C_BUS_RECOVERY_STOP_SCL;
+      break;
+
+    case I2C_BUS_RECOVERY_STOP_SCL:
+      HAL_GPIO_WritePin(config->SclPort, config->SclPin, GPIO_PIN_SET);
+      bus->Recovery = I2C_BUS_RECOVERY_STOP_END;
+      break;
+
+    case I2C_BUS_RECOVERY_STOP_END:
+      HAL_GPIO_WritePin(config->SdaPort, config->SdaPin, GPIO_PIN_SET);
+      bus->Recovery = I2C_BUS_RECOVERY_DONE;
+      break;
+
+    case I2C_BUS_RECOVERY_DONE:
+      primask = __get_PRIMASK();
+      __disable_irq();
+      i2c_bus_pins(bus, GPIO_MODE_AF_OD);
+      config->Instance->CR1 |= I2C_CR1_PE;
+      bus->Pulses = 0U;
+      bus->Recovery = I2C_BUS_RECOVERY_IDLE;
+      i2c_bus_start(bus);
+      __set_PRIMASK(primask);
+      break;
+
+    default:
+      break;
+  }
+}
+
+/* TIMINGR can only be written with PE low */
+static void i2c_bus_set_timing(I2CBus_HandleTypeDef *bus, uint32_t timing)
+{
+  I2C_TypeDef *i2c = bus->Config.Instance;
+
+  i2c_bus_disable(i2c);
+  i2c->TIMINGR = timing;
+  i2c->CR1 |= I2C_CR1_PE;
+  bus->Timing = timing;
+}
+
+/* NBYTES, RELOAD and AUTOEND for the next chunk of the phase */
+static uint32_t i2c_bus_count(I2CBus_HandleTypeDef *bus, const I2CBus_JobTypeDef *job)
+{
+  const uint32_t chunk = (bus->Remaining < I2C_BUS_CHUNK) ? bus->Remaining : I2C_BUS_CHUNK;
+  uint32_t cr2 = chunk << I2C_CR2_NBYTES_Pos;
+
+  bus->Remaining -= chunk;
+  if (bus->Remaining != 0U)
+  {
+    cr2 |= I2C_CR2_RELOAD;
+  }
+  else if ((bus->Reading != 0U) || (job->RxSize == 0U))
+  {
+    cr2 |= I2C_CR2_AUTOEND;   /* Last phase: STOP after the last byte */
+  }
+  return cr2;
+}
+
+/**
+  * @brief  Starts the write or read phase of @p job: its DMA, then a START
+  *         (a repeated one for the read after a write).
+  */
+static HAL_StatusTypeDef i2c_bus_phase(I2CBus_HandleTypeDef *bus, const I2CBus_JobTypeDef *job, uint32_t reading)
+{
+  I2C_TypeDef *i2c = bus->Config.Instance;
+  const uint32_t size = (reading != 0U) ? job->RxSize : job->TxSize;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t cr2;
+
+  if ((size != 0U) && (reading != 0U))
+  {
+    status = DMAMgr_Start(bus->RxChannel, (uint32_t)&i2c->RXDR, (uint32_t)job->RxData, size);
+  }
+  else if (size != 0U)
+  {
+    status = DMAMgr_Start(bus->TxChannel, (uint32_t)job->TxData, (uint32_t)&i2c->TXDR, size);
+  }
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  bus->Reading = reading;
+  bus->Remaining = size;
+  cr2 = ((uint32_t)job->Device->Address << 1) | I2C_CR2_START | i2c_bus_count(bus, job);
+  if (reading != 0U)
+  {
+    cr2 |= I2C_CR2_RD_WRN;
+  }
+  i2c->CR2 = cr2;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Retires the head job and reports it. The callback may queue more.
+  */
+static void i2c_bus_complete(I2CBus_HandleTypeDef *bus)
+{
+  const I2CBus_JobTypeDef job = bus->Queue[bus->Head];
+  const uint32_t cycles = PERF_Cycles() - bus->Started;
+
+  if (bus->Status != HAL_OK)
+  {
+    if (DMAMgr_IsBusy(bus->TxChannel) != 0U)
+    {
+      (void)DMAMgr_Stop(bus->TxChannel);
+    }
+    if (DMAMgr_IsBusy(bus->RxChannel) != 0U)
+    {
+      (void)DMAMgr_Stop(bus->RxChannel);
+    }
+    bus->Stats.Errors++;
+    job.Device->Errors++;
+  }
+  bus->Stats.Transfers++;
+  bus->Stats.BusyCycles += cycles;
+  job.Device->Transfers++;
+  job.Device->Cycles += cycles;
+
+  bus->Head = (bus->Head + 1U) % I2C_BUS_QUEUE_DEPTH;
+  bus->Count--;
+  bus->Running = 0U;
+
+  if (job.Callback != NULL)
+  {
+    job.Callback(bus->Status, job.Context);
+  }
+}
+
+/* The head job is done once the STOP is out and its received bytes are in memory */
+static void i2c_bus_try_complete(I2CBus_HandleTypeDef *bus)
+{
+  const I2CBus_JobTypeDef *job = &bus->Queue[bus->Head];
+
+  if ((bus->Stopped != 0U) && ((bus->Status != HAL_OK) || (job->RxSize == 0U) || (bus->RxDone != 0U)))
+  {
+    i2c_bus_complete(bus);
+    i2c_bus_start(bus);
+  }
+}
+
+/**
+  * @brief  Keeps the queue moving: starts the head job, failing jobs that
+  *         cannot start. Does nothing while the bus is being recovered.
+  *         Caller masks interrupts.
+  */
+static void i2c_bus_start(I2CBus_HandleTypeDef *bus)
+{
+  I2C_TypeDef *i2c = bus->Config.Instance;
+
+  while ((bus->Running == 0U) && (bus->Count != 0U) && (bus->Recovery == I2C_BUS_RECOVERY_IDLE))
+  {
+    const I2CBus_JobTypeDef *job = &bus->Queue[bus->Head];
+
+    if ((i2c->ISR & I2C_ISR_BUSY) != 0U)
+    {
+      /* Nobody else masters this bus: it is held by a stuck slave. The job waits for the recovery */
+      i2c_bus_recover(bus);
+      return;
+    }
+    if (job->Device->Timing != bus->Timing)
+    {
+      i2c_bus_set_timing(bus, job->Device->Timing);
+    }
+
+    bus->Status = HAL_OK;
+    bus->Stopped = 0U;
+    bus->RxDone = 0U;
+    bus->Started = PERF_Cycles();
+    bus->Running = 1U;
+    /* A read-only job skips the write phase; one with neither probes with a write */
+    if (i2c_bus_phase(bus, job, ((job->TxSize == 0U) && (job->RxSize != 0U)) ? 1U : 0U) == HAL_OK)
+    {
+      return;
+    }
+    bus->Status = HAL_ERROR;
+    i2c_bus_complete(bus);
+  }
+}
+
+/**
+  * @brief  Abandons the head job after a bus error, a clock timeout or a DMA
+  *         error: stops the I2C and starts the bus recovery, after which
+  *         I2CBus_Tick() moves on to the next job.
+  */
+static void i2c_bus_fail(I2CBus_HandleTypeDef *bus)
+{
+  i2c_bus_recover(bus);
+
+  if (bus->Running != 0U)
+  {
+    bus->Status = HAL_ERROR;
+    i2c_bus_complete(bus);
+  }
+}
+
+static void i2c_bus_event(I2CBus_HandleTypeDef *bus)
+{
+  I2C_TypeDef *i2c = bus->Config.Instance;
+  const uint32_t isr = i2c->ISR;
+  const I2CBus_JobTypeDef *job = &bus->Queue[bus->Head];
+
+  if (bus->Running == 0U)
+  {
+    i2c->ICR = I2C_BUS_ICR_ALL;
+    return;
+  }
+
+  if ((isr & I2C_ISR_NACKF) != 0U)
+  {
+    i2c->ICR = I2C_ICR_NACKCF;
+    bus->Status = HAL_ERROR;
+    if ((i2c->CR2 & I2C_CR2_AUTOEND) == 0U)
+    {
+      i2c->CR2 |= I2C_CR2_STOP;
+    }
+    i2c->ISR = I2C_ISR_TXE;   /* Drop the byte the DMA had already put in TXDR */
+  }
+  else if ((isr & I2C_ISR_TCR) != 0U)
+  {
+    /* Writing NBYTES clears TCR */
+    i2c->CR2 = (i2c->CR2 & ~(I2C_CR2_NBYTES | I2C_CR2_RELOAD | I2C_CR2_AUTOEND)) | i2c_bus_count(bus, job);
+  }
+  else if ((isr & I2C_ISR_TC) != 0U)
+  {
+    /* Write phase done, the read follows after a repeated START */
+    if (i2c_bus_phase(bus, job, 1U) != HAL_OK)
+    {
+      bus->Status = HAL_ERROR;
+      i2c->CR2 |= I2C_CR2_STOP;
+    }
+  }
+
+  if ((isr & I2C_ISR_STOPF) != 0U)
+  {
+    i2c->ICR = I2C_ICR_STOPCF;
+    bus->Stopped = 1U;
+    i2c_bus_try_complete(bus);
+  }
+}
+
+static void i2c_bus_error(I2CBus_HandleTypeDef *bus)
+{
+  bus->Config.Instance->ICR = I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF | I2C_ICR_TIMOUTCF;
+  i2c_bus_fail(bus);
+}
+
+static void i2c_bus_dma(DMAMgr_ChannelTypeDef *channel, uint32_t event, void *context)
+{
+  I2CBus_HandleTypeDef *bus = context;
+
+  if (bus->Running == 0U)
+  {
+    return;
+  }
+  if (event == DMA_MGR_EVENT_ERROR)
+  {
+    i2c_bus_fail(bus);
+  }
+  else if ((event == DMA_MGR_EVENT_COMPLETE) && (channel == bus->RxChannel))
+  {
+    bus->RxDone = 1U;
+    i2c_bus_try_complete(bus);
+  }
+}
+
+static DMAMgr_ChannelTypeDef *i2c_bus_alloc(I2CBus_HandleTypeDef *bus, uint32_t request,
+                                            DMAMgr_DirectionTypeDef direction)
+{
+  DMAMgr_ConfigTypeDef config = {0};
+
+  config.Controller = DMA_MGR_DMA1;
+  config.Stream = DMA_MGR_STREAM_ANY;
+  config.Request = request;
+  config.Direction = direction;
+  config.Mode = DMA_MGR_MODE_NORMAL;
+  config.DataSize = DMA_MGR_SIZE_BYTE;
+  config.Priority = DMA_MGR_PRIORITY_MEDIUM;
+  config.Burst = DMA_MGR_BURST_SINGLE;
+  config.IrqPriority = bus->Config.IrqPriority;
+  config.Callback = i2c_bus_dma;
+  config.Context = bus;
+
+  return DMAMgr_Alloc(&config);
+}
+
+/**
+  * @brief  Takes over an I2C instance, its pins and two DMA1 streams. The
+  *         kernel clock is the reset default, PCLK1.
+  * @retval HAL_ERROR for an unknown or taken instance, or no DMA stream.
+  */
+HAL_StatusTypeDef I2CBus_Init(I2CBus_HandleTypeDef *bus, const I2CBus_ConfigTypeDef *config)
+{
+  const uint32_t index = i2c_bus_index(config->Instance);
+  const I2CBus_PortTypeDef *port;
+  uint32_t timeout;
+  I2C_TypeDef *i2c;
+
+  if ((index == I2C_BUS_INSTANCES) || (i2c_bus_owner[index] != NULL))
+  {
+    return HAL_ERROR;
+  }
+  port = &i2c_bus_ports[index];
+  i2c = config->Instance;
+
+  memset(bus, 0, sizeof(*bus));
+  bus->Config = *config;
+  PERF_Init();
+
+  bus->TxChannel = i2c_bus_alloc(bus, port->TxRequest, DMA_MGR_DIR_MEM_TO_PERIPH);
+  bus->RxChannel = i2c_bus_alloc(bus, port->RxRequest, DMA_MGR_DIR_PERIPH_TO_MEM);
+  if ((bus->TxChannel == NULL) || (bus->RxChannel == NULL))
+  {
+    if (bus->TxChannel != NULL)
+    {
+      DMAMgr_Free(bus->TxChannel);
+    }
+    if (bus->RxChannel != NULL)
+    {
+      DMAMgr_Free(bus->RxChannel);
+    }
+    return HAL_ERROR;
+  }
+
+  i2c_bus_enable_clock(index);
+  i2c_bus_enable_port(config->SclPort);
+  i2c_bus_enable_port(config->SdaPort);
+  i2c_bus_pins(bus, GPIO_MODE_AF_OD);
+  if (config->FastModePlus != 0U)
+  {
+    __HAL_RCC_SYSCFG_CLK_ENABLE();
+    SYSCFG->PMCR |= port->FastModePlus;
+  }
+
+  /* Clock timeout: SCL low for I2C_BUS_TIMEOUT_MS, in units of 2048 kernel clocks */
+  timeout = ((HAL_RCC_GetPCLK1Freq() / 1000U) * I2C_BUS_TIMEOUT_MS) / 2048U;
+  timeout = (timeout > 4096U) ? 4096U : ((timeout == 0U) ? 1U : timeout);
+  i2c->CR1 = 0U;
+  i2c->TIMINGR = I2C_BUS_TIMING_SM;
+  bus->Timing = I2C_BUS_TIMING_SM;
+  i2c->TIMEOUTR = ((timeout - 1U) << I2C_TIMEOUTR_TIMEOUTA_Pos) | I2C_TIMEOUTR_TIMOUTEN;
+  i2c->CR1 = I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN | I2C_CR1_TCIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE |
+             I2C_CR1_ERRIE | I2C_CR1_PE;
+
+  i2c_bus_owner[index] = bus;
+  IRQ_Config_SetPriority(port->EvIRQn, config->IrqPriority);
+  IRQ_Config_SetPriority(port->ErIRQn, config->IrqPriority);
+  HAL_NVIC_EnableIRQ(port->EvIRQn);
+  HAL_NVIC_EnableIRQ(port->ErIRQn);
+
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef i2c_bus_submit(I2CBus_HandleTypeDef *bus, const I2CBus_JobTypeDef *job)
+{
+  uint32_t primask = __get_PRIMASK();
+  I2CBus_JobTypeDef *slot;
+
+  __disable_irq();
+
+  if (bus->Count == I2C_BUS_QUEUE_DEPTH)
+  {
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+
+  slot = &bus->Queue[(bus->Head + bus->Count) % I2C_BUS_QUEUE_DEPTH];
+  *slot = *job;
+  if (slot->TxData == NULL)
+  {
+    slot->TxData = slot->Reg;   /* I2CBus_MemRead(): the register address travels in the slot */
+  }
+  bus->Count++;
+  i2c_bus_start(bus);
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queues a write of @p tx_size bytes followed by a read of
+  *         @p rx_size bytes after a repeated START.
+  * @retval HAL_BUSY if the queue is full, HAL_ERROR for bad arguments.
+  */
+HAL_StatusTypeDef I2CBus_Transfer(I2CBus_HandleTypeDef *bus, I2CBus_DeviceTypeDef *device,
+                                  const void *tx, uint32_t tx_size, void *rx, uint32_t rx_size,
+                                  I2CBus_CallbackTypeDef callback, void *context)
+{
+  I2CBus_JobTypeDef job = {0};
+
+  if ((bus->TxChannel == NULL) || (device == NULL) || (device->Address > 0x7FU) ||
+      (tx_size > I2C_BUS_MAX_BYTES) || (rx_size > I2C_BUS_MAX_BYTES) ||
+      ((tx == NULL) && (tx_size != 0U)) || ((rx == NULL) && (rx_size != 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  job.Device = device;
+  job.TxData = tx;
+  job.TxSize = tx_size;
+  job.RxData = rx;
+  job.RxSize = rx_size;
+  job.Callback = callback;
+  job.Context = context;
+
+  return i2c_bus_submit(bus, &job);
+}
+
+/**
+  * @brief  Queues the usual register read: a 1 or 2 byte register address
+  *         (MSB first), then @p rx_size bytes.
+  */
+HAL_StatusTypeDef I2CBus_MemRead(I2CBus_HandleTypeDef *bus, I2CBus_DeviceTypeDef *device,
+                                 uint16_t reg, uint32_t reg_size, void *rx, uint32_t rx_size,
+                                 I2CBus_CallbackTypeDef callback, void *context)
+{
+  I2CBus_JobTypeDef job = {0};
+
+  if ((bus->TxChannel == NULL) || (device == NULL) || (device->Address > 0x7FU) ||
+      ((reg_size != 1U) && (reg_size != 2U)) || (rx == NULL) || (rx_size == 0U) ||
+      (rx_size > I2C_BUS_MAX_BYTES))
+  {
+    return HAL_ERROR;
+  }
+
+  job.Device = device;
+  job.TxData = NULL;
+  job.TxSize = reg_size;
+  job.Reg[0] = (reg_size == 2U) ? (uint8_t)(reg >> 8) : (uint8_t)reg;
+  job.Reg[1] = (uint8_t)reg;
+  job.RxData = rx;
+  job.RxSize = rx_size;
+  job.Callback = callback;
+  job.Context = context;
+
+  return i2c_bus_submit(bus, &job);
+}
+
+uint32_t I2CBus_IsIdle(const I2CBus_HandleTypeDef *bus)
+{
+  return (bus->Count == 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  Sleeps until every queued transaction has finished.
+  * @param  Timeout In ms, or HAL_MAX_DELAY.
+  */
+HAL_StatusTypeDef I2CBus_WaitIdle(const I2CBus_HandleTypeDef *bus, uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while (bus->Count != 0U)
+  {
+    if ((Timeout != HAL_MAX_DELAY) && ((HAL_GetTick() - tickstart) > Timeout))
+    {
+      return HAL_TIMEOUT;
+    }
+    __WFI();
+  }
+
+  return HAL_OK;
+}
+
+void I2CBus_GetStats(const I2CBus_HandleTypeDef *bus, I2CBus_StatsTypeDef *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *stats = bus->Stats;
+  __set_PRIMASK(primask);
+}
+
+void I2CBus_ResetStats(I2CBus_HandleTypeDef *bus)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  memset(&bus->Stats, 0, sizeof(bus->Stats));
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Advances the bus recoveries in progress by half an SCL period.
+  */
+void I2CBus_Tick(void)
+{
+  uint32_t i;
+
+  for (i = 0U; i < I2C_BUS_INSTANCES; i++)
+  {
+    I2CBus_HandleTypeDef *bus = i2c_bus_owner[i];
+
+    if ((bus != NULL) && (bus->Recovery != I2C_BUS_RECOVERY_IDLE))
+    {
+      i2c_bus_recover_step(bus);
+    }
+  }
+}
+
+#define I2C_BUS_IRQ(handler, index, service)      \
+  void handler(void);                             \
+  void handler(void)                              \
+  {                                               \
+    if (i2c_bus_owner[(index)] != NULL)           \
+    {                                             \
+      service(i2c_bus_owner[(index)]);            \
+    }                                             \
+  }
+
+I2C_BUS_IRQ(I2C1_EV_IRQHandler, 0U, i2c_bus_event)
+I2C_BUS_IRQ(I2C1_ER_IRQHandler, 0U, i2c_bus_error)
+I2C_BUS_IRQ(I2C2_EV_IRQHandler, 1U, i2c_bus_event)
+I2C_BUS_IRQ(I2C2_ER_IRQHandler, 1U, i2c_bus_error)
+I2C_BUS_IRQ(I2C3_EV_IRQHandler, 2U, i2c_bus_event)
+I2C_BUS_IRQ(I2C3_ER_IRQHandler, 2U, i2c_bus_error)
@@ -0,0 +1,130 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include "stm32h7xx_hal.h"
+#include "dma_manager.h"
+
+/*
+ * I2C bus manager: one queue of transactions per bus, shared by every
+ * device on it.
+ *
+ * A transaction writes TxSize bytes, then reads RxSize bytes after a
+ * repeated start (either may be 0; both 0 probes the address). The I2C
+ * registers are driven directly and both directions move by DMA through
+ * dma_manager; the bus interrupt starts the next queued transaction as
+ * soon as the STOP of the previous one is seen, so back-to-back traffic
+ * keeps the bus busy with no thread involved. Transfers longer than 255
+ * bytes use NBYTES reload.
+ *
+ * Each device carries its own TIMINGR value, loaded when the bus switches
+ * to it, and its own statistics. SCL held low for I2C_BUS_TIMEOUT_MS
+ * (clock timeout) and bus or arbitration errors fail the transaction, and
+ * the bus is then recovered: up to nine SCL pulses on the pins as GPIO
+ * until a stuck slave releases SDA, then a STOP (I2C-bus specification,
+ * 3.1.16). A bus found busy before a START is recovered the same way. The
+ * recovery is clocked by I2CBus_Tick(), in SysTick_Handler(), one half SCL
+ * period per tick (500 Hz, about 25 ms at worst), so no interrupt or
+ * masked section waits on it; the queue holds meanwhile and restarts from
+ * the tick.
+ *
+ * Buffers must be reachable by DMA1/DMA2 (not DTCM) and stay valid until
+ * the callback, which runs in interrupt context and may queue more. So
+ * must the I2CBus_HandleTypeDef: I2CBus_MemRead() sends the register
+ * address by DMA from the job's queue slot, inside the handle.
+ */
+#define I2C_BUS_QUEUE_DEPTH     8U
+#define I2C_BUS_TIMEOUT_MS      10U
+#define I2C_BUS_MAX_BYTES       65535U   /*!< Per direction: one DMA transfer */
+
+/* TIMINGR for a 64 MHz kernel clock (PCLK1 from HSI), analog filter on, 100 ns rise time */
+#define I2C_BUS_TIMING_SM       0x10707DBCU   /*!< 100 kHz */
+#define I2C_BUS_TIMING_FM       0x00602173U   /*!< 400 kHz */
+#define I2C_BUS_TIMING_FMP      0x00300B29U   /*!< 1 MHz, needs FastModePlus drive */
+
+typedef void (*I2CBus_CallbackTypeDef)(HAL_StatusTypeDef status, void *context);
+
+typedef struct
+{
+  uint16_t Address;      /*!< 7-bit */
+  uint32_t Timing;       /*!< One of I2C_BUS_TIMING_xxx, or a computed TIMINGR */
+
+  /* Kept by the bus */
+  uint32_t Transfers;
+  uint32_t Errors;       /*!< NACKs, bus errors and timeouts */
+  uint64_t Cycles;       /*!< Core cycles from START to STOP, all transfers */
+} I2CBus_DeviceTypeDef;
+
+typedef struct
+{
+  I2C_TypeDef  *Instance;       /*!< I2C1, I2C2 or I2C3 */
+  GPIO_TypeDef *SclPort;
+  uint32_t      SclPin;         /*!< GPIO_PIN_x */
+  GPIO_TypeDef *SdaPort;
+  uint32_t      SdaPin;
+  uint32_t      Alternate;      /*!< GPIO_AFx_I2Cn */
+  uint32_t      FastModePlus;   /*!< Non-zero for the 20 mA Fm+ drive on the bus pins */
+  uint32_t      IrqPriority;    /*!< One of the IRQ_PRIO_xxx levels, bus and DMA alike */
+} I2CBus_ConfigTypeDef;
+
+typedef struct
+{
+  uint32_t Transfers;
+  uint32_t Errors;
+  uint32_t Recoveries;
+  uint64_t BusyCycles;   /*!< START to STOP, for the bus utilisation */
+} I2CBus_StatsTypeDef;
+
+typedef struct
+{
+  I2CBus_DeviceTypeDef  *Device;
+  const uint8_t         *TxData;
+  uint32_t               TxSize;
+  uint8_t               *RxData;
+  uint32_t               RxSize;
+  uint8_t                Reg[2];   /*!< Register address of I2CBus_MemRead(), sent from here */
+  I2CBus_CallbackTypeDef Callback;
+  void                  *Context;
+} I2CBus_JobTypeDef;
+
+typedef struct
+{
+  I2CBus_ConfigTypeDef   Config;
+  DMAMgr_ChannelTypeDef *TxChannel;
+  DMAMgr_ChannelTypeDef *RxChannel;
+
+  I2CBus_JobTypeDef      Queue[I2C_BUS_QUEUE_DEPTH];
+  uint32_t               Head;
+  volatile uint32_t      Count;
+
+  volatile uint32_t      Running;     /*!< The head job is on the bus */
+  uint32_t               Reading;     /*!< In its read phase */
+  uint32_t               Remaining;   /*!< Bytes of the phase not yet given to NBYTES */
+  uint32_t               Stopped;     /*!< STOP seen */
+  uint32_t               RxDone;      /*!< Receive DMA finished */
+  HAL_StatusTypeDef      Status;
+  uint32_t               Timing;      /*!< TIMINGR loaded */
+  uint32_t               Started;     /*!< PERF_Cycles() at START */
+  volatile uint32_t      Recovery;    /*!< Bus recovery step, 0 when none */
+  uint32_t               Pulses;      /*!< SCL pulses of the recovery so far */
+  uint32_t               Stretch;     /*!< Ticks SCL has been held low */
+
+  I2CBus_StatsTypeDef    Stats;
+} I2CBus_HandleTypeDef;
+
+HAL_StatusTypeDef I2CBus_Init(I2CBus_HandleTypeDef *bus, const I2CBus_ConfigTypeDef *config);
+HAL_StatusTypeDef I2CBus_Transfer(I2CBus_HandleTypeDef *bus, I2CBus_DeviceTypeDef *device,
+                                  const void *tx, uint32_t tx_size, void *rx, uint32_t rx_size,
+                                  I2CBus_CallbackTypeDef callback, void *context);
+HAL_StatusTypeDef I2CBus_MemRead(I2CBus_HandleTypeDef *bus, I2CBus_DeviceTypeDef *device,
+                                 uint16_t reg, uint32_t reg_size, void *rx, uint32_t rx_size,
+                                 I2CBus_CallbackTypeDef callback, void *context);
+uint32_t          I2CBus_IsIdle(const I2CBus_HandleTypeDef *bus);
+HAL_StatusTypeDef I2CBus_WaitIdle(const I2CBus_HandleTypeDef *bus, uint32_t Timeout);
+
+void     I2CBus_GetStats(const I2CBus_HandleTypeDef *bus, I2CBus_StatsTypeDef *stats);
+void     I2CBus_ResetStats(I2CBus_HandleTypeDef *bus);
+
+/* From SysTick_Handler(), every tick */
+void     I2CBus_Tick(void);
+
+#endif /* I2C_BUS_H */
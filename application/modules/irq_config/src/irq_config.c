@@ -0,0 +1,61 @@
+#include "irq_config.h"
+
+#if (TICK_INT_PRIORITY != IRQ_PRIO_KERNEL_LOWEST)
+#error "TICK_INT_PRIORITY must match IRQ_PRIO_KERNEL_LOWEST"
+#endif
+
+/*
+ * Central priority table, applied once at boot. Always-present drivers add
+ * their line here; optional modules call IRQ_Config_SetPriority() with one
+ * of the named levels. Nobody calls HAL_NVIC_SetPriority() directly.
+ */
+static const IRQ_PriorityTypeDef IRQ_PriorityTable[] =
+{
+  { MemoryManagement_IRQn, 0U                     },
+  { BusFault_IRQn,         0U                     },
+  { UsageFault_IRQn,       0U                     },
+  { SVCall_IRQn,           IRQ_PRIO_KERNEL_LOWEST },
+  { DebugMonitor_IRQn,     IRQ_PRIO_KERNEL_LOW    },
+  { PendSV_IRQn,           IRQ_PRIO_KERNEL_LOWEST },
+  { SysTick_IRQn,          TICK_INT_PRIORITY      },
+};
+
+IRQ_ViolationTypeDef IRQ_KernelViolation = { 0U, 0 };
+
+/**
+  * @brief  Applies the priority plan. Call right after HAL_Init().
+  */
+void IRQ_Config_Init(void)
+{
+  uint32_t i;
+
+  HAL_NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_4);
+
+  for (i = 0U; i < sizeof(IRQ_PriorityTable) / sizeof(IRQ_PriorityTable[0]); i++)
+  {
+    IRQ_Config_SetPriority(IRQ_PriorityTable[i].IRQn, IRQ_PriorityTable[i].Priority);
+  }
+
+  __set_BASEPRI(0U);
+}
+
+/**
+  * @brief  Sets the preemption priority of a line owned by a driver.
+  * @param  IRQn Interrupt or system exception number.
+  * @param  Priority One of the IRQ_PRIO_xxx levels.
+  */
+void IRQ_Config_SetPriority(IRQn_Type IRQn, uint32_t Priority)
+{
+  assert_param(Priority < (1UL << __NVIC_PRIO_BITS));
+
+  NVIC_SetPriority(IRQn, Priority);
+}
+
+/**
+  * @brief  Called when a zero-latency handler enters a kernel API.
+  * @note   Override to log or trap; the default only records the offender.
+  */
+__weak void IRQ_KernelViolationCallback(IRQn_Type IRQn)
+{
+  UNUSED(IRQn);
+}
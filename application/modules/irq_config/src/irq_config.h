@@ -0,0 +1,98 @@
+#ifndef IRQ_CONFIG_H
+#define IRQ_CONFIG_H
+
+#include "stm32h7xx_hal.h"
+
+/*
+ * System-wide interrupt priority plan.
+ *
+ * NVIC grouping is NVIC_PRIORITYGROUP_4: four preemption bits, no
+ * sub-priority, so every level below is a distinct preemption level and a
+ * lower number always preempts a higher one.
+ *
+ * Levels 0 .. IRQ_PRIO_KERNEL_MAX_SYSCALL-1 form the zero-latency band.
+ * Kernel critical sections only raise BASEPRI to IRQ_PRIO_KERNEL_MAX_SYSCALL,
+ * so these handlers are never delayed by them - and for the same reason they
+ * must never call a kernel API.
+ */
+#define IRQ_PRIO_ENCODER              0U  /*!< Encoder capture, zero-latency     */
+#define IRQ_PRIO_ADC                  1U  /*!< ADC end-of-conversion, zero-latency */
+#define IRQ_PRIO_ZERO_LATENCY_LOW     3U  /*!< Lowest zero-latency level        */
+
+#define IRQ_PRIO_KERNEL_MAX_SYSCALL   4U  /*!< BASEPRI threshold of the kernel  */
+#define IRQ_PRIO_KERNEL_HIGH          5U  /*!< Kernel-aware, time-critical I/O  */
+#define IRQ_PRIO_KERNEL_NORMAL        8U  /*!< Kernel-aware, regular drivers    */
+#define IRQ_PRIO_KERNEL_LOW          12U  /*!< Kernel-aware, background work    */
+#define IRQ_PRIO_KERNEL_LOWEST       15U  /*!< SysTick, PendSV                  */
+
+#define IRQ_PRIO_TO_BASEPRI(prio)    ((uint32_t)(prio) << (8U - __NVIC_PRIO_BITS))
+
+typedef struct
+{
+  IRQn_Type IRQn;       /*!< Interrupt or system exception number */
+  uint32_t  Priority;   /*!< One of the IRQ_PRIO_xxx levels        */
+} IRQ_PriorityTypeDef;
+
+typedef struct
+{
+  volatile uint32_t Count;      /*!< Kernel calls made from the zero-latency band */
+  volatile int32_t  LastIRQn;   /*!< IRQn of the most recent offender             */
+} IRQ_ViolationTypeDef;
+
+extern IRQ_ViolationTypeDef IRQ_KernelViolation;
+
+void IRQ_Config_Init(void);
+void IRQ_Config_SetPriority(IRQn_Type IRQn, uint32_t Priority);
+void IRQ_KernelViolationCallback(IRQn_Type IRQn);
+
+/**
+  * @brief  Masks every kernel-aware interrupt, leaving the zero-latency band live.
+  * @retval Previous BASEPRI, to be passed to IRQ_Kernel_ExitCritical().
+  */
+__STATIC_FORCEINLINE uint32_t IRQ_Kernel_EnterCritical(void)
+{
+  uint32_t basepri = __get_BASEPRI();
+
+  __set_BASEPRI_MAX(IRQ_PRIO_TO_BASEPRI(IRQ_PRIO_KERNEL_MAX_SYSCALL));
+  __DSB();
+  __ISB();
+
+  return basepri;
+}
+
+__STATIC_FORCEINLINE void IRQ_Kernel_ExitCritical(uint32_t basepri)
+{
+  __set_BASEPRI(basepri);
+}
+
+/**
+  * @brief  Flags a kernel API call made from the zero-latency band.
+  * @note   Place IRQ_KERNEL_API_CHECK() at the entry of every kernel API that
+  *         may be reached from an interrupt. Thread mode always passes.
+  *         Reset, NMI and HardFault (exceptions 1-3) have fixed priorities
+  *         above any BASEPRI and no SHPR slot, so they always fail.
+  */
+__STATIC_FORCEINLINE void IRQ_Kernel_ApiCheck(void)
+{
+  uint32_t exception = __get_IPSR();
+
+  if (exception != 0U)
+  {
+    IRQn_Type irqn = (IRQn_Type)((int32_t)exception - 16);
+
+    if ((exception < 4U) || (NVIC_GetPriority(irqn) < IRQ_PRIO_KERNEL_MAX_SYSCALL))
+    {
+      IRQ_KernelViolation.Count++;
+      IRQ_KernelViolation.LastIRQn = (int32_t)irqn;
+      IRQ_KernelViolationCallback(irqn);
+    }
+  }
+}
+
+#ifdef DEBUG
+#define IRQ_KERNEL_API_CHECK()    IRQ_Kernel_ApiCheck()
+#else
+#define IRQ_KERNEL_API_CHECK()    ((void)0)
+#endif
+
+#endif /* IRQ_CONFIG_H */
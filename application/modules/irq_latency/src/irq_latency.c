@@ -0,0 +1,278 @@
+#include <stdio.h>
+
+#include "irq_latency.h"
+#include "irq_config.h"
+#include "perf.h"
+
+#define LATENCY_LINES    3U
+
+static EXTI_HandleTypeDef hexti[LATENCY_LINES];
+
+static volatile Latency_CaseTypeDef latency_case;
+static volatile uint32_t latency_trigger;
+static volatile uint32_t latency_entry[LATENCY_LINES];
+static volatile uint32_t latency_exit[LATENCY_LINES];
+static volatile uint32_t latency_done;
+
+static const char * const latency_case_name[LATENCY_CASE_COUNT] =
+{
+  "entry",
+  "entry in critical",
+  "kernel masked",
+  "tail-chain",
+  "preempt",
+  "gpio loopback",
+};
+
+/*
+ * Histogram range per case: PERF_HIST_BUCKETS buckets of width cycles from
+ * base. The masked kernel line waits out the whole critical section, and the
+ * loopback adds the GPIO input synchronizers.
+ */
+static const uint32_t latency_hist_base[LATENCY_CASE_COUNT] =
+{
+  0U, 0U, LATENCY_CRITICAL_CYCLES, 0U, 0U, 0U
+};
+static const uint32_t latency_hist_width[LATENCY_CASE_COUNT] =
+{
+  2U, 2U, 4U, 2U, 4U, 8U
+};
+
+static const IRQn_Type latency_irqn[LATENCY_LINES] = { EXTI0_IRQn, EXTI1_IRQn, EXTI2_IRQn };
+static const uint32_t latency_prio[LATENCY_LINES] =
+{
+  IRQ_PRIO_ENCODER, IRQ_PRIO_KERNEL_NORMAL, IRQ_PRIO_KERNEL_NORMAL
+};
+
+static void Latency_ConfigLine(uint32_t index, uint32_t line, uint32_t gpio)
+{
+  EXTI_ConfigTypeDef config = {0};
+
+  config.Line = line;
+  config.Mode = EXTI_MODE_INTERRUPT;
+  config.Trigger = EXTI_TRIGGER_RISING;
+  config.GPIOSel = gpio;
+
+  HAL_EXTI_GetHandle(&hexti[index], line);
+  HAL_EXTI_SetConfigLine(&hexti[index], &config);
+
+  IRQ_Config_SetPriority(latency_irqn[index], latency_prio[index]);
+  HAL_NVIC_EnableIRQ(latency_irqn[index]);
+}
+
+void Latency_Init(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  PERF_Init();
+
+  __HAL_RCC_GPIOB_CLK_ENABLE();
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+
+  HAL_GPIO_WritePin(LATENCY_LOOPBACK_OUT_PORT, LATENCY_LOOPBACK_OUT_PIN, GPIO_PIN_RESET);
+  GPIO_InitStruct.Pin = LATENCY_LOOPBACK_OUT_PIN;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  HAL_GPIO_Init(LATENCY_LOOPBACK_OUT_PORT, &GPIO_InitStruct);
+
+  GPIO_InitStruct.Pin = LATENCY_LOOPBACK_IN_PIN;
+  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Pull = GPIO_PULLDOWN;
+  HAL_GPIO_Init(LATENCY_LOOPBACK_IN_PORT, &GPIO_InitStruct);
+
+  Latency_ConfigLine(0U, EXTI_LINE_0, LATENCY_LOOPBACK_IN_EXTI);
+  Latency_ConfigLine(1U, EXTI_LINE_1, EXTI_GPIOA);
+  Latency_ConfigLine(2U, EXTI_LINE_2, EXTI_GPIOA);
+}
+
+static void Latency_Busy(uint32_t cycles)
+{
+  uint32_t start = PERF_Cycles();
+
+  while ((PERF_Cycles() - start) < cycles)
+  {
+  }
+}
+
+/**
+  * @brief  Waits for the handlers selected by @p mask to complete.
+  * @retval 0 on success, 1 on timeout.
+  */
+static uint32_t Latency_Wait(uint32_t mask)
+{
+  uint32_t start = PERF_Cycles();
+
+  while ((latency_done & mask) != mask)
+  {
+    if ((PERF_Cycles() - start) > LATENCY_TIMEOUT_CYCLES)
+    {
+      return 1U;
+    }
+  }
+
+  return 0U;
+}
+
+/**
+  * @brief  Runs one sample of a case.
+  * @retval Measured cycles, or UINT32_MAX on timeout.
+  */
+static uint32_t Latency_Sample(Latency_CaseTypeDef test)
+{
+  uint32_t basepri;
+  uint32_t sample = UINT32_MAX;
+
+  latency_case = test;
+  latency_done = 0U;
+
+  switch (test)
+  {
+    case LATENCY_CASE_ENTRY:
+      latency_trigger = PERF_Cycles();
+      HAL_EXTI_GenerateSWI(&hexti[0]);
+      if (Latency_Wait(1U << 0) == 0U)
+      {
+        sample = latency_entry[0] - latency_trigger;
+      }
+      break;
+
+    case LATENCY_CASE_ENTRY_CRITICAL:
+      basepri = IRQ_Kernel_EnterCritical();
+      latency_trigger = PERF_Cycles();
+      HAL_EXTI_GenerateSWI(&hexti[0]);
+      Latency_Busy(LATENCY_CRITICAL_CYCLES);
+      IRQ_Kernel_ExitCritical(basepri);
+      if (Latency_Wait(1U << 0) == 0U)
+      {
+        sample = latency_entry[0] - latency_trigger;
+      }
+      break;
+
+    case LATENCY_CASE_KERNEL_MASKED:
+      basepri = IRQ_Kernel_EnterCritical();
+      latency_trigger = PERF_Cycles();
+      HAL_EXTI_GenerateSWI(&hexti[1]);
+      Latency_Busy(LATENCY_CRITICAL_CYCLES);
+      IRQ_Kernel_ExitCritical(basepri);
+      if (Latency_Wait(1U << 1) == 0U)
+      {
+        sample = latency_entry[1] - latency_trigger;
+      }
+      break;
+
+    case LATENCY_CASE_TAIL_CHAIN:
+      /* Pend both kernel lines under BASEPRI so they are taken back to back */
+      basepri = IRQ_Kernel_EnterCritical();
+      HAL_EXTI_GenerateSWI(&hexti[1]);
+      HAL_EXTI_GenerateSWI(&hexti[2]);
+      __DSB();
+      IRQ_Kernel_ExitCritical(basepri);
+      if (Latency_Wait((1U << 1) | (1U << 2)) == 0U)
+      {
+        sample = latency_entry[2] - latency_exit[1];
+      }
+      break;
+
+    case LATENCY_CASE_PREEMPT:
+      HAL_EXTI_GenerateSWI(&hexti[2]);
+      if (Latency_Wait((1U << 0) | (1U << 2)) == 0U)
+      {
+        sample = latency_entry[0] - latency_trigger;
+      }
+      break;
+
+    case LATENCY_CASE_GPIO_LOOPBACK:
+      latency_trigger = PERF_Cycles();
+      LATENCY_LOOPBACK_OUT_PORT->BSRR = LATENCY_LOOPBACK_OUT_PIN;
+      if (Latency_Wait(1U << 0) == 0U)
+      {
+        sample = latency_entry[0] - latency_trigger;
+      }
+      LATENCY_LOOPBACK_OUT_PORT->BSRR = (uint32_t)LATENCY_LOOPBACK_OUT_PIN << 16U;
+      Latency_Busy(LATENCY_CRITICAL_CYCLES);
+      break;
+
+    default:
+      break;
+  }
+
+  return sample;
+}
+
+/**
+  * @brief  Runs every case LATENCY_SAMPLES times and fills the histograms.
+  */
+void Latency_Run(Latency_ResultTypeDef *result)
+{
+  uint32_t test;
+  uint32_t i;
+
+  for (test = 0U; test < LATENCY_CASE_COUNT; test++)
+  {
+    PERF_Hist_Init(&result->Hist[test], latency_hist_base[test], latency_hist_width[test]);
+    result->Timeouts[test] = 0U;
+
+    for (i = 0U; i < LATENCY_SAMPLES; i++)
+    {
+      uint32_t sample = Latency_Sample((Latency_CaseTypeDef)test);
+
+      if (sample == UINT32_MAX)
+      {
+        result->Timeouts[test]++;
+      }
+      else
+      {
+        PERF_Hist_Add(&result->Hist[test], sample);
+      }
+    }
+  }
+}
+
+void Latency_Report(const Latency_ResultTypeDef *result)
+{
+  uint32_t test;
+
+  printf("IRQ latency, cycles at %lu Hz\n", (unsigned long)SystemCoreClock);
+  for (test = 0U; test < LATENCY_CASE_COUNT; test++)
+  {
+    PERF_Hist_Print(&result->Hist[test], latency_case_name[test]);
+    if (result->Timeouts[test] != 0U)
+    {
+      printf("  timeouts: %lu\n", (unsigned long)result->Timeouts[test]);
+    }
+  }
+}
+
+/* Timestamps are taken first thing in each handler, before any HAL call. */
+
+void EXTI0_IRQHandler(void)
+{
+  latency_entry[0] = PERF_Cycles();
+  HAL_EXTI_IRQHandler(&hexti[0]);
+  latency_exit[0] = PERF_Cycles();
+  latency_done |= 1U << 0;
+}
+
+void EXTI1_IRQHandler(void)
+{
+  latency_entry[1] = PERF_Cycles();
+  HAL_EXTI_IRQHandler(&hexti[1]);
+  latency_exit[1] = PERF_Cycles();
+  latency_done |= 1U << 1;
+}
+
+void EXTI2_IRQHandler(void)
+{
+  latency_entry[2] = PERF_Cycles();
+  HAL_EXTI_IRQHandler(&hexti[2]);
+  if (latency_case == LATENCY_CASE_PREEMPT)
+  {
+    latency_trigger = PERF_Cycles();
+    HAL_EXTI_GenerateSWI(&hexti[0]);
+    __DSB();
+    Latency_Busy(LATENCY_CRITICAL_CYCLES);
+  }
+  latency_exit[2] = PERF_Cycles();
+  latency_done |= 1U << 2;
+}
@@ -0,0 +1,52 @@
+#ifndef IRQ_LATENCY_H
+#define IRQ_LATENCY_H
+
+#include "stm32h7xx_hal.h"
+#include "perf_hist.h"
+
+/*
+ * Interrupt latency measurement.
+ *
+ * EXTI line 0 sits in the zero-latency band, lines 1 and 2 in the kernel
+ * band at equal priority. Each case triggers a line through the EXTI
+ * software interrupt register (or the GPIO loopback below) at a DWT
+ * timestamp and records the cycle count seen on handler entry.
+ *
+ * Loopback: wire LATENCY_LOOPBACK_OUT to LATENCY_LOOPBACK_IN (EXTI line 0).
+ */
+#define LATENCY_LOOPBACK_OUT_PORT     GPIOB
+#define LATENCY_LOOPBACK_OUT_PIN      GPIO_PIN_14
+#define LATENCY_LOOPBACK_IN_PORT      GPIOC
+#define LATENCY_LOOPBACK_IN_PIN       GPIO_PIN_0
+#define LATENCY_LOOPBACK_IN_EXTI      EXTI_GPIOC
+
+#define LATENCY_SAMPLES               1000U
+#define LATENCY_CRITICAL_CYCLES       400U    /*!< Length of the simulated kernel critical section */
+#define LATENCY_TIMEOUT_CYCLES        100000U
+
+typedef enum
+{
+  LATENCY_CASE_ENTRY = 0U,          /*!< Idle core, zero-latency line                    */
+  LATENCY_CASE_ENTRY_CRITICAL,      /*!< Zero-latency line raised inside a critical section */
+  LATENCY_CASE_KERNEL_MASKED,       /*!< Kernel line raised inside a critical section    */
+  LATENCY_CASE_TAIL_CHAIN,          /*!< Exit of line 1 to entry of line 2               */
+  LATENCY_CASE_PREEMPT,             /*!< Line 0 raised from inside the line 2 handler    */
+  LATENCY_CASE_GPIO_LOOPBACK,       /*!< Pin edge through the EXTI input path            */
+  LATENCY_CASE_COUNT
+} Latency_CaseTypeDef;
+
+typedef struct
+{
+  PERF_HistTypeDef Hist[LATENCY_CASE_COUNT];
+  uint32_t         Timeouts[LATENCY_CASE_COUNT];
+} Latency_ResultTypeDef;
+
+void Latency_Init(void);
+void Latency_Run(Latency_ResultTypeDef *result);
+void Latency_Report(const Latency_ResultTypeDef *result);
+
+void EXTI0_IRQHandler(void);
+void EXTI1_IRQHandler(void);
+void EXTI2_IRQHandler(void);
+
+#endif /* IRQ_LATENCY_H */
@@ -0,0 +1,223 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "kv_flash_hal.h"
+#include "flash_service.h"
+
+/* Result of the backend's flash service job */
+typedef struct
+{
+  volatile uint32_t          pending;
+  volatile HAL_StatusTypeDef status;
+} kv_flash_hal_job;
+
+static kv_flash_hal_job kv_flash_hal_program_job;
+static kv_flash_hal_job kv_flash_hal_erase_job;
+static uint32_t         kv_flash_hal_erasing;   /* 1 + sector being erased, 0 for none */
+
+static void kv_flash_hal_done(HAL_StatusTypeDef status, uint32_t address, void *context)
+{
+  kv_flash_hal_job *job = context;
+
+  UNUSED(address);
+  job->status = status;
+  job->pending = 0U;
+}
+
+static kv_status kv_flash_hal_read(void *context, uint32_t offset, void *data, uint32_t size)
+{
+  (void)context;
+  if (offset + size > 2U * FLASH_SECTOR_SIZE)
+  {
+    return KV_ARG_ERROR;
+  }
+  memcpy(data, (const void *)(KV_FLASH_HAL_BASE + offset), size);
+  return KV_OK;
+}
+
+/**
+  * @brief  Program one flash word and wait for it. Waits behind a running
+  *         erase too: bank 2 does one operation at a time.
+  */
+static kv_status kv_flash_hal_program(void *context, uint32_t offset, const void *word)
+{
+  HAL_StatusTypeDef status;
+
+  (void)context;
+  if ((offset + KV_FLASH_WORD > 2U * FLASH_SECTOR_SIZE) || ((offset % KV_FLASH_WORD) != 0U))
+  {
+    return KV_ARG_ERROR;
+  }
+
+  kv_flash_hal_program_job.pending = 1U;
+  do
+  {
+    status = FlashSvc_Program(KV_FLASH_HAL_BASE + offset, word, KV_FLASH_WORD, kv_flash_hal_done,
+                              &kv_flash_hal_program_job);
+  } while (status == HAL_BUSY);
+  if (status != HAL_OK)
+  {
+    return KV_IO_ERROR;
+  }
+  while (kv_flash_hal_program_job.pending != 0U)
+  {
+    __WFI();
+  }
+  return (kv_flash_hal_program_job.status == HAL_OK) ? KV_OK : KV_IO_ERROR;
+}
+
+/**
+  * @brief  Queue a sector erase, or poll the one already queued.
+  * @retval KV_BUSY until the erase is done.
+  */
+static kv_status kv_flash_hal_erase(void *context, uint32_t sector)
+{
+  (void)context;
+  if ((sector > 1U) || ((kv_flash_hal_erasing != 0U) && (kv_flash_hal_erasing != sector + 1U)))
+  {
+    return KV_ARG_ERROR;
+  }
+
+  if (kv_flash_hal_erasing == 0U)
+  {
+    kv_flash_hal_erase_job.pending = 1U;
+    switch (FlashSvc_Erase(KV_FLASH_HAL_BASE + (sector * FLASH_SECTOR_SIZE), 1U, kv_flash_hal_done,
+                           &kv_flash_hal_erase_job))
+    {
+      case HAL_OK:
+        kv_flash_hal_erasing = sector + 1U;
+        return KV_BUSY;
+      case HAL_BUSY:
+        return KV_BUSY;   /* Queue full: try again on the next step */
+      default:
+        return KV_IO_ERROR;
+    }
+  }
+
+  if (kv_flash_hal_erase_job.pending != 0U)
+  {
+    return KV_BUSY;
+  }
+  kv_flash_hal_erasing = 0U;
+  return (kv_flash_hal_erase_job.status == HAL_OK) ? KV_OK : KV_IO_ERROR;
+}
+
+static kv_status kv_flash_hal_erase_sync(uint32_t sector)
+{
+  kv_status status;
+
+  while ((status = kv_flash_hal_erase(NULL, sector)) == KV_BUSY)
+  {
+    __WFI();
+  }
+  return status;
+}
+
+/**
+  * @brief  Sequence of a sector with a valid header, 0 otherwise.
+  */
+static uint32_t kv_flash_hal_sequence(uint32_t base, uint32_t sector, kv_sector_header *header)
+{
+  memcpy(header, (const void *)(base + (sector * FLASH_SECTOR_SIZE)), sizeof(*header));
+  if ((header->magic != KV_SECTOR_MAGIC) ||
+      (header->crc != kv_crc32(header, offsetof(kv_sector_header, crc), 0U)))
+  {
+    return 0U;
+  }
+  return header->sequence;
+}
+
+/**
+  * @brief  Bring the store over from the running bank after a bank swap.
+  *
+  * The store stays at KV_FLASH_HAL_BASE, so after SWAP_BANK flips it is
+  * left behind in the running bank, at KV_FLASH_HAL_MIRROR. It is copied
+  * when its newest sequence is above anything here: both sectors are
+  * erased, the older sector then the newer one is copied, each body first
+  * and its header last with the sequence raised by one. A copy cut short
+  * is redone on the next boot; a finished one outranks the mirror, which
+  * is never written and so stays behind until the next swap.
+  */
+static kv_status kv_flash_hal_migrate(void)
+{
+  kv_sector_header mirror[2];
+  kv_sector_header live;
+  uint32_t sequence[2];
+  uint32_t newest = 0U;
+  uint32_t word[KV_FLASH_WORD / 4U];
+  uint32_t pass;
+  uint32_t offset;
+  uint32_t i;
+  kv_status status;
+
+  for (i = 0U; i < 2U; i++)
+  {
+    const uint32_t here = kv_flash_hal_sequence(KV_FLASH_HAL_BASE, i, &live);
+
+    sequence[i] = kv_flash_hal_sequence(KV_FLASH_HAL_MIRROR, i, &mirror[i]);
+    newest = (here > newest) ? here : newest;
+  }
+  if ((sequence[0] <= newest) && (sequence[1] <= newest))
+  {
+    return KV_OK;
+  }
+  newest = (sequence[1] > sequence[0]) ? 1U : 0U;
+
+  for (i = 0U; i < 2U; i++)
+  {
+    status = kv_flash_hal_erase_sync(i);
+    if (status != KV_OK)
+    {
+      return status;
+    }
+  }
+
+  for (pass = 0U; pass < 2U; pass++)
+  {
+    const uint32_t sector = newest ^ (pass ^ 1U);   /* Older one first */
+    const uint32_t base = sector * FLASH_SECTOR_SIZE;
+
+    if (sequence[sector] == 0U)
+    {
+      continue;   /* Spare */
+    }
+    for (offset = KV_FLASH_WORD; offset < FLASH_SECTOR_SIZE; offset += KV_FLASH_WORD)
+    {
+      memcpy(word, (const void *)(KV_FLASH_HAL_MIRROR + base + offset), sizeof(word));
+      for (i = 0U; (i < KV_FLASH_WORD / 4U) && (word[i] == 0xFFFFFFFFU); i++)
+      {
+      }
+      if (i == KV_FLASH_WORD / 4U)
+      {
+        continue;   /* Erased: programming it would spend the word */
+      }
+      status = kv_flash_hal_program(NULL, base + offset, word);
+      if (status != KV_OK)
+      {
+        return status;
+      }
+    }
+    mirror[sector].sequence++;
+    mirror[sector].crc = kv_crc32(&mirror[sector], offsetof(kv_sector_header, crc), 0U);
+    status = kv_flash_hal_program(NULL, base, &mirror[sector]);
+    if (status != KV_OK)
+    {
+      return status;
+    }
+  }
+  return KV_OK;
+}
+
+/**
+  * @brief  Fill @p flash with the bank 2 backend, first copying the store
+  *         over from the running bank if a bank swap left it there.
+  */
+kv_status kv_flash_hal_init(kv_flash *flash)
+{
+  flash->read = kv_flash_hal_read;
+  flash->program = kv_flash_hal_program;
+  flash->erase = kv_flash_hal_erase;
+  flash->context = NULL;
+  flash->sector_size = FLASH_SECTOR_SIZE;
+  return kv_flash_hal_migrate();
+}
@@ -0,0 +1,30 @@
+#ifndef KV_FLASH_HAL_H
+#define KV_FLASH_HAL_H
+
+#include "stm32h7xx_hal.h"
+#include "kv_store.h"
+
+/*
+ * kv_flash backend on the STM32H7's internal flash: the last two 128 KB
+ * sectors of bank 2 (KV_FLASH_HAL_BASE), kept out of the image by the
+ * linker script. Code runs from bank 1, so reads from bank 1 go on while
+ * bank 2 is programmed or erased.
+ *
+ * Reads are memcpy from the mapped address. Programs and erases go through
+ * the flash service (flash_service.h), which must be initialised first.
+ * A program waits for its flash word (about 100 us, longer if an erase is
+ * running). An erase is queued by the first call and polled by the next
+ * ones, which return KV_BUSY until it is done (about 2 s), so kv_gc_step()
+ * never blocks on it.
+ *
+ * Bank 2 is whichever bank is not running, so a bank swap (fw_update)
+ * leaves the store behind in the running bank's sectors 6-7;
+ * kv_flash_hal_init() copies it back over, once, before kv_mount().
+ */
+#define KV_FLASH_HAL_BASE    0x081C0000U   /*!< Bank 2, sector 6 */
+#define KV_FLASH_HAL_MIRROR  (KV_FLASH_HAL_BASE - FLASH_BANK_SIZE)   /*!< Same sectors of the running bank */
+
+/* Fills flash with the bank 2 backend, for kv_mount() */
+kv_status kv_flash_hal_init(kv_flash *flash);
+
+#endif /* KV_FLASH_HAL_H */
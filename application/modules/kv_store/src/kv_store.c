@@ -0,0 +1,751 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "kv_store.h"
+
+#define KV_HEADER_SIZE     ((uint32_t)sizeof(kv_record_header))
+#define KV_INLINE_VALUE    (KV_FLASH_WORD - KV_HEADER_SIZE)   /* Value bytes in a record's first word */
+
+/* CRC-32 (IEEE 802.3, reflected), four bits per step */
+static const uint32_t kv_crc_nibble[16] =
+{
+  0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+  0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU,
+};
+
+/**
+  * @brief  CRC-32 as zlib's crc32(): start from 0, chain by passing the previous result.
+  */
+uint32_t kv_crc32(const void *data, uint32_t size, uint32_t crc)
+{
+  const uint8_t *byte = data;
+
+  crc = ~crc;
+  while (size-- > 0U)
+  {
+    crc ^= *byte++;
+    crc = (crc >> 4) ^ kv_crc_nibble[crc & 0x0FU];
+    crc = (crc >> 4) ^ kv_crc_nibble[crc & 0x0FU];
+  }
+  return ~crc;
+}
+
+/* Flash bytes of a record with a value of the given size */
+static uint32_t kv_record_bytes(uint32_t size)
+{
+  return (KV_HEADER_SIZE + size + KV_FLASH_WORD - 1U) & ~(KV_FLASH_WORD - 1U);
+}
+
+static uint32_t kv_sector_base(const kv_store *store, uint32_t sector)
+{
+  return sector * store->flash->sector_size;
+}
+
+static uint32_t kv_sector_of(const kv_store *store, uint32_t offset)
+{
+  return offset / store->flash->sector_size;
+}
+
+/* Live data limit: half a sector after its header */
+static uint32_t kv_capacity(const kv_store *store)
+{
+  return (store->flash->sector_size - KV_FLASH_WORD) / 2U;
+}
+
+static uint32_t kv_is_erased(const uint32_t *word)
+{
+  uint32_t i;
+
+  for (i = 0U; i < KV_FLASH_WORD / 4U; i++)
+  {
+    if (word[i] != 0xFFFFFFFFU)
+    {
+      return 0U;
+    }
+  }
+  return 1U;
+}
+
+static uint32_t kv_record_crc(const kv_record_header *header)
+{
+  return kv_crc32(&header->key, 3U * sizeof(uint16_t), 0U);
+}
+
+/* Erase and wait: only for kv_format(), where there is nothing else to do */
+static kv_status kv_erase_sync(const kv_flash *flash, uint32_t sector)
+{
+  kv_status status;
+
+  do
+  {
+    status = flash->erase(flash->context, sector);
+  } while (status == KV_BUSY);
+  return status;
+}
+
+static kv_status kv_read_header(const kv_store *store, uint32_t sector, kv_sector_header *header)
+{
+  kv_status status = store->flash->read(store->flash->context, kv_sector_base(store, sector), header, sizeof(*header));
+
+  if (status != KV_OK)
+  {
+    return status;
+  }
+  if ((header->magic != KV_SECTOR_MAGIC) ||
+      (header->crc != kv_crc32(header, offsetof(kv_sector_header, crc), 0U)))
+  {
+    return KV_NOT_FOUND;
+  }
+  return KV_OK;
+}
+
+static kv_status kv_write_header(kv_store *store, uint32_t sector, uint32_t sequence)
+{
+  kv_sector_header header;
+
+  memset(&header, 0xFF, sizeof(header));
+  header.magic = KV_SECTOR_MAGIC;
+  header.sequence = sequence;
+  header.erase_count = store->erase_count[sector];
+  header.crc = kv_crc32(&header, offsetof(kv_sector_header, crc), 0U);
+  return store->flash->program(store->flash->context, kv_sector_base(store, sector), &header);
+}
+
+/* ---- Index: open addressing, linear probing ---- */
+
+static uint32_t kv_hash(uint16_t key)
+{
+  return ((uint32_t)key * 2654435761U) >> 24;   /* Top 8 bits: KV_INDEX_SIZE slots */
+}
+
+static kv_index_entry *kv_index_find(const kv_store *store, uint16_t key)
+{
+  uint32_t slot = kv_hash(key);
+
+  while (store->index[slot].key != KV_INDEX_EMPTY)
+  {
+    if (store->index[slot].key == key)
+    {
+      return (kv_index_entry *)&store->index[slot];
+    }
+    slot = (slot + 1U) & (KV_INDEX_SIZE - 1U);
+  }
+  return NULL;
+}
+
+static kv_index_entry *kv_index_insert(kv_store *store, uint16_t key)
+{
+  uint32_t slot = kv_hash(key);
+
+  if (store->keys >= KV_INDEX_SIZE - 1U)
+  {
+    return NULL;
+  }
+  while (store->index[slot].key != KV_INDEX_EMPTY)
+  {
+    slot = (slot + 1U) & (KV_INDEX_SIZE - 1U);
+  }
+  store->index[slot].key = key;
+  store->index[slot].deleted = 0U;
+  store->keys++;
+  return &store->index[slot];
+}
+
+/**
+  * @brief  Free a slot and shift later members of its probe run back into the hole.
+  */
+static void kv_index_remove(kv_store *store, kv_index_entry *entry)
+{
+  uint32_t hole = (uint32_t)(entry - store->index);
+  uint32_t slot = hole;
+
+  for (;;)
+  {
+    uint32_t home;
+
+    slot = (slot + 1U) & (KV_INDEX_SIZE - 1U);
+    if (store->index[slot].key == KV_INDEX_EMPTY)
+    {
+      break;
+    }
+    home = kv_hash(store->index[slot].key);
+    /* Move it if its home is not cyclically within (hole, slot] */
+    if (((slot - home) & (KV_INDEX_SIZE - 1U)) >= ((slot - hole) & (KV_INDEX_SIZE - 1U)))
+    {
+      store->index[hole] = store->index[slot];
+      hole = slot;
+    }
+  }
+  store->index[hole].key = KV_INDEX_EMPTY;
+  store->keys--;
+}
+
+static void kv_index_clear(kv_store *store)
+{
+  uint32_t i;
+
+  for (i = 0U; i < KV_INDEX_SIZE; i++)
+  {
+    store->index[i].key = KV_INDEX_EMPTY;
+  }
+  store->keys = 0U;
+}
+
+/* ---- Log ---- */
+
+/**
+  * @brief  Append a record at the tail of the active sector: header word first,
+  *         so that an interrupted append always fails the CRC.
+  */
+static kv_status kv_append(kv_store *store, uint16_t key, uint16_t flags, const uint8_t *value, uint16_t size,
+                           uint32_t *location)
+{
+  uint32_t word[KV_FLASH_WORD / 4U];
+  kv_record_header *header = (kv_record_header *)word;
+  uint32_t offset = store->tail;
+  uint32_t done;
+  kv_status status;
+
+  memset(word, 0xFF, sizeof(word));
+  header->magic = KV_RECORD_MAGIC;
+  header->key = key;
+  header->size = size;
+  header->flags = flags;
+  header->crc = kv_crc32(value, size, kv_record_crc(header));
+  done = (size < KV_INLINE_VALUE) ? size : KV_INLINE_VALUE;
+  if (done > 0U)
+  {
+    memcpy(&word[KV_HEADER_SIZE / 4U], value, done);
+  }
+
+  *location = offset;
+  for (;;)
+  {
+    status = store->flash->program(store->flash->context, offset, word);
+    offset += KV_FLASH_WORD;
+    store->tail = offset;   /* Even on failure: the word may be half written */
+    if ((status != KV_OK) || (done >= size))
+    {
+      return status;
+    }
+    memset(word, 0xFF, sizeof(word));
+    memcpy(word, &value[done], ((size - done) < KV_FLASH_WORD) ? (size - done) : KV_FLASH_WORD);
+    done += KV_FLASH_WORD;
+  }
+}
+
+/**
+  * @brief  Copy a record word for word from the old sector to the active tail.
+  */
+static kv_status kv_copy(kv_store *store, kv_index_entry *entry)
+{
+  uint32_t word[KV_FLASH_WORD / 4U];
+  const uint32_t bytes = kv_record_bytes(entry->size);
+  const uint32_t location = store->tail;
+  uint32_t done;
+  kv_status status;
+
+  for (done = 0U; done < bytes; done += KV_FLASH_WORD)
+  {
+    status = store->flash->read(store->flash->context, entry->location + done, word, KV_FLASH_WORD);
+    if (status != KV_OK)
+    {
+      return status;
+    }
+    status = store->flash->program(store->flash->context, store->tail, word);
+    store->tail += KV_FLASH_WORD;
+    if (status != KV_OK)
+    {
+      return status;
+    }
+  }
+  entry->location = location;
+  return KV_OK;
+}
+
+/**
+  * @brief  Rebuild the index from one sector.
+  * @param  older  Records only fill keys the newer sector has not set.
+  * @param  done   Set when the sector holds a GC_DONE marker.
+  * @param  tail   Set to one word past the first erased word after the log:
+  *                that word may be a program cut so early that it still reads
+  *                as erased, so it is left as a gap rather than programmed.
+  */
+static kv_status kv_scan(kv_store *store, uint32_t sector, uint32_t older, uint32_t *done, uint32_t *tail)
+{
+  const uint32_t base = kv_sector_base(store, sector);
+  const uint32_t end = base + store->flash->sector_size;
+  uint32_t word[KV_FLASH_WORD / 4U];
+  const kv_record_header *header = (const kv_record_header *)word;
+  uint32_t offset = base + KV_FLASH_WORD;
+  kv_status status;
+
+  *done = 0U;
+  while (offset < end)
+  {
+    uint32_t crc;
+    uint32_t bytes;
+    uint32_t at;
+    kv_index_entry *entry;
+
+    status = store->flash->read(store->flash->context, offset, word, KV_FLASH_WORD);
+    if (status != KV_OK)
+    {
+      return status;
+    }
+
+    if (kv_is_erased(word))
+    {
+      /* One erased word is a gap left by an earlier mount; two end the log */
+      if (offset + KV_FLASH_WORD < end)
+      {
+        status = store->flash->read(store->flash->context, offset + KV_FLASH_WORD, word, KV_FLASH_WORD);
+        if (status != KV_OK)
+        {
+          return status;
+        }
+      }
+      if ((offset + KV_FLASH_WORD >= end) || kv_is_erased(word))
+      {
+        break;
+      }
+      offset += KV_FLASH_WORD;
+      continue;
+    }
+
+    bytes = kv_record_bytes(header->size);
+    if ((header->magic != KV_RECORD_MAGIC) || (header->size > KV_MAX_VALUE) || (offset + bytes > end))
+    {
+      store->corrupt++;
+      offset += KV_FLASH_WORD;
+      continue;
+    }
+
+    /* CRC over the value, read back a word at a time */
+    crc = kv_crc32(&word[KV_HEADER_SIZE / 4U], (header->size < KV_INLINE_VALUE) ? header->size : KV_INLINE_VALUE,
+                   kv_record_crc(header));
+    for (at = KV_FLASH_WORD; (at < bytes) && (status == KV_OK); at += KV_FLASH_WORD)
+    {
+      uint32_t data[KV_FLASH_WORD / 4U];
+      const uint32_t chunk = KV_HEADER_SIZE + header->size - at;
+
+      status = store->flash->read(store->flash->context, offset + at, data, KV_FLASH_WORD);
+      crc = kv_crc32(data, (chunk < KV_FLASH_WORD) ? chunk : KV_FLASH_WORD, crc);
+    }
+    if (status != KV_OK)
+    {
+      return status;
+    }
+    if (crc != header->crc)
+    {
+      store->corrupt++;
+      offset += KV_FLASH_WORD;
+      continue;
+    }
+
+    if ((header->flags & KV_RECORD_GC_DONE) != 0U)
+    {
+      *done = 1U;
+    }
+    else
+    {
+      entry = kv_index_find(store, header->key);
+      if ((entry != NULL) && older && (kv_sector_of(store, entry->location) != sector))
+      {
+        /* The newer sector has the final word on this key */
+      }
+      else
+      {
+        if (entry == NULL)
+        {
+          entry = kv_index_insert(store, header->key);
+          if (entry == NULL)
+          {
+            return KV_FULL;
+          }
+        }
+        entry->size = header->size;
+        entry->location = offset;
+        entry->deleted = ((header->flags & KV_RECORD_DELETED) != 0U) ? 1U : 0U;
+      }
+    }
+    offset += bytes;
+  }
+
+  *tail = (offset < end) ? (offset + KV_FLASH_WORD) : end;
+  return KV_OK;
+}
+
+/**
+  * @brief  Erase both sectors and start an empty store in sector 0.
+  */
+kv_status kv_format(kv_store *store, const kv_flash *flash)
+{
+  kv_sector_header header;
+  uint32_t sector;
+  kv_status status;
+
+  if ((store == NULL) || (flash == NULL))
+  {
+    return KV_ARG_ERROR;
+  }
+  memset(store, 0, sizeof(*store));
+  store->flash = flash;
+  kv_index_clear(store);
+
+  for (sector = 0U; sector < 2U; sector++)
+  {
+    if (kv_read_header(store, sector, &header) == KV_OK)
+    {
+      store->erase_count[sector] = header.erase_count;
+    }
+    status = kv_erase_sync(flash, sector);
+    if (status != KV_OK)
+    {
+      return status;
+    }
+    store->erase_count[sector]++;
+  }
+
+  store->active = 0U;
+  store->sequence = 1U;
+  store->tail = KV_FLASH_WORD;
+  return kv_write_header(store, 0U, store->sequence);
+}
+
+/**
+  * @brief  Find the newest sector, rebuild the index and resume an interrupted GC.
+  */
+kv_status kv_mount(kv_store *store, const kv_flash *flash)
+{
+  kv_sector_header header[2];
+  kv_status valid[2];
+  uint32_t newer;
+  uint32_t done;
+  uint32_t tail;
+  uint32_t unused;
+  uint32_t i;
+  kv_status status;
+
+  if ((store == NULL) || (flash == NULL) || (flash->sector_size < 4U * KV_FLASH_WORD) ||
+      ((flash->sector_size % KV_FLASH_WORD) != 0U))
+  {
+    return KV_ARG_ERROR;
+  }
+  memset(store, 0, sizeof(*store));
+  store->flash = flash;
+  kv_index_clear(store);
+
+  for (i = 0U; i < 2U; i++)
+  {
+    valid[i] = kv_read_header(store, i, &header[i]);
+    if ((valid[i] != KV_OK) && (valid[i] != KV_NOT_FOUND))
+    {
+      return valid[i];
+    }
+    store->erase_count[i] = (valid[i] == KV_OK) ? header[i].erase_count : 0U;
+  }
+  if ((valid[0] != KV_OK) && (valid[1] != KV_OK))
+  {
+    return kv_format(store, flash);
+  }
+
+  newer = ((valid[1] == KV_OK) && ((valid[0] != KV_OK) || (header[1].sequence > header[0].sequence))) ? 1U : 0U;
+  store->active = newer;
+  store->sequence = header[newer].sequence;
+  status = kv_scan(store, newer, 0U, &done, &tail);
+  if (status != KV_OK)
+  {
+    return status;
+  }
+  store->tail = tail;
+
+  /* GC was interrupted: the older sector still has records the newer one lacks */
+  if ((valid[newer ^ 1U] == KV_OK) && !done)
+  {
+    status = kv_scan(store, newer ^ 1U, 1U, &done, &unused);
+    if (status != KV_OK)
+    {
+      return status;
+    }
+    store->gc = KV_GC_COPY;
+  }
+
+  /* Tombstones have done their job: drop them, then total the live records */
+  for (i = 0U; i < KV_INDEX_SIZE; )
+  {
+    if ((store->index[i].key != KV_INDEX_EMPTY) && store->index[i].deleted)
+    {
+      kv_index_remove(store, &store->index[i]);   /* May shift a later entry into slot i */
+    }
+    else
+    {
+      i++;
+    }
+  }
+  for (i = 0U; i < KV_INDEX_SIZE; i++)
+  {
+    const kv_index_entry *entry = &store->index[i];
+
+    if (entry->key != KV_INDEX_EMPTY)
+    {
+      store->live_bytes += kv_record_bytes(entry->size);
+      if (kv_sector_of(store, entry->location) != store->active)
+      {
+        store->gc_pending += kv_record_bytes(entry->size);
+      }
+    }
+  }
+  return KV_OK;
+}
+
+void kv_gc_request(kv_store *store, uint32_t force)
+{
+  const uint32_t used = store->tail - kv_sector_base(store, store->active);
+
+  if ((store->gc == KV_GC_IDLE) &&
+      (force || (used > (store->flash->sector_size / 100U) * KV_GC_THRESHOLD)))
+  {
+    store->gc = KV_GC_ERASE;
+  }
+}
+
+/**
+  * @brief  One bounded piece of GC: one erase (or erase poll), or up to
+  *         KV_GC_BATCH record copies. Call from the idle loop.
+  */
+kv_status kv_gc_step(kv_store *store)
+{
+  uint32_t copied = 0U;
+  uint32_t scanned = 0U;
+  kv_status status;
+
+  switch (store->gc)
+  {
+    case KV_GC_ERASE:
+    {
+      const uint32_t spare = store->active ^ 1U;
+
+      status = store->flash->erase(store->flash->context, spare);
+      if (status != KV_OK)
+      {
+        return status;
+      }
+      store->erase_count[spare]++;
+      status = kv_write_header(store, spare, store->sequence + 1U);
+      if (status != KV_OK)
+      {
+        return status;   /* A torn header leaves the spare invalid: GC restarts */
+      }
+      store->sequence++;
+      store->active = spare;
+      store->tail = kv_sector_base(store, spare) + KV_FLASH_WORD;
+      store->gc = KV_GC_COPY;
+      store->gc_cursor = 0U;
+      store->gc_pending = store->live_bytes;
+      return KV_BUSY;
+    }
+
+    case KV_GC_COPY:
+      /* The cursor wraps: kv_index_remove() can move an entry behind it */
+      while ((store->gc_pending > 0U) && (copied < KV_GC_BATCH) && (scanned < KV_INDEX_SIZE))
+      {
+        kv_index_entry *entry = &store->index[store->gc_cursor];
+
+        store->gc_cursor = (store->gc_cursor + 1U) & (KV_INDEX_SIZE - 1U);
+        scanned++;
+        if ((entry->key != KV_INDEX_EMPTY) && (kv_sector_of(store, entry->location) != store->active))
+        {
+          status = kv_copy(store, entry);
+          if (status != KV_OK)
+          {
+            return status;
+          }
+          store->gc_pending -= kv_record_bytes(entry->size);
+          copied++;
+        }
+      }
+      if (scanned >= KV_INDEX_SIZE)
+      {
+        store->gc_pending = 0U;   /* A whole sweep found nothing left in the old sector */
+      }
+      if (store->gc_pending > 0U)
+      {
+        return KV_BUSY;
+      }
+      {
+        uint32_t location;
+
+        status = kv_append(store, KV_KEY_GC_DONE, KV_RECORD_GC_DONE, NULL, 0U, &location);
+        if (status != KV_OK)
+        {
+          return status;
+        }
+      }
+      store->gc = KV_GC_IDLE;
+      return KV_OK;
+
+    case KV_GC_IDLE:
+    default:
+      return KV_OK;
+  }
+}
+
+/* Run GC to the end, waiting out a busy erase */
+static kv_status kv_gc_run(kv_store *store)
+{
+  kv_status status;
+
+  do
+  {
+    status = kv_gc_step(store);
+  } while (status == KV_BUSY);
+  return status;
+}
+
+/**
+  * @brief  Make room for bytes at the tail, finishing (or running) GC if needed.
+  * @note   While copying, the bytes still to copy and the GC_DONE word are
+  *         reserved, so the copy can always complete.
+  */
+static kv_status kv_reserve(kv_store *store, uint32_t bytes)
+{
+  uint32_t attempt;
+  kv_status status;
+
+  for (attempt = 0U; attempt < 3U; attempt++)
+  {
+    const uint32_t end = kv_sector_base(store, store->active) + store->flash->sector_size;
+    const uint32_t reserved = (store->gc == KV_GC_COPY) ? (store->gc_pending + KV_FLASH_WORD) : 0U;
+
+    if (store->tail + bytes + reserved <= end)
+    {
+      return KV_OK;
+    }
+    kv_gc_request(store, 1U);
+    status = kv_gc_run(store);
+    if (status != KV_OK)
+    {
+      return status;
+    }
+  }
+  return KV_FULL;
+}
+
+/* The old copy of a key is no longer needed: stop counting it */
+static void kv_release(kv_store *store, const kv_index_entry *entry)
+{
+  const uint32_t bytes = kv_record_bytes(entry->size);
+
+  store->live_bytes -= bytes;
+  if ((store->gc == KV_GC_COPY) && (kv_sector_of(store, entry->location) != store->active))
+  {
+    store->gc_pending -= bytes;
+  }
+}
+
+kv_status kv_set(kv_store *store, uint16_t key, const void *value, uint16_t size)
+{
+  const uint32_t bytes = kv_record_bytes(size);
+  kv_index_entry *entry;
+  uint32_t location;
+  kv_status status;
+
+  if ((store == NULL) || (key > KV_KEY_MAX) || (value == NULL) || (size == 0U) || (size > KV_MAX_VALUE))
+  {
+    return KV_ARG_ERROR;
+  }
+  entry = kv_index_find(store, key);
+  if ((entry == NULL) && (store->keys >= KV_MAX_KEYS))
+  {
+    return KV_FULL;
+  }
+  if (store->live_bytes - ((entry != NULL) ? kv_record_bytes(entry->size) : 0U) + bytes > kv_capacity(store))
+  {
+    return KV_FULL;
+  }
+
+  status = kv_reserve(store, bytes);
+  if (status != KV_OK)
+  {
+    return status;
+  }
+  status = kv_append(store, key, 0U, value, size, &location);
+  if (status != KV_OK)
+  {
+    return status;
+  }
+
+  /* Reserving may have run GC, which moves records: look the key up again */
+  entry = kv_index_find(store, key);
+  if (entry != NULL)
+  {
+    kv_release(store, entry);
+  }
+  else
+  {
+    entry = kv_index_insert(store, key);
+  }
+  entry->size = size;
+  entry->location = location;
+  store->live_bytes += bytes;
+
+  kv_gc_request(store, 0U);
+  return KV_OK;
+}
+
+kv_status kv_get(const kv_store *store, uint16_t key, void *value, uint16_t capacity, uint16_t *size)
+{
+  const kv_index_entry *entry;
+
+  if ((store == NULL) || (value == NULL))
+  {
+    return KV_ARG_ERROR;
+  }
+  entry = kv_index_find(store, key);
+  if (entry == NULL)
+  {
+    return KV_NOT_FOUND;
+  }
+  if (size != NULL)
+  {
+    *size = entry->size;
+  }
+  if (entry->size > capacity)
+  {
+    return KV_ARG_ERROR;
+  }
+  return store->flash->read(store->flash->context, entry->location + KV_HEADER_SIZE, value, entry->size);
+}
+
+kv_status kv_delete(kv_store *store, uint16_t key)
+{
+  kv_index_entry *entry;
+  uint32_t location;
+  kv_status status;
+
+  if ((store == NULL) || (key > KV_KEY_MAX))
+  {
+    return KV_ARG_ERROR;
+  }
+  if (kv_index_find(store, key) == NULL)
+  {
+    return KV_NOT_FOUND;
+  }
+
+  status = kv_reserve(store, KV_FLASH_WORD);
+  if (status == KV_OK)
+  {
+    status = kv_append(store, key, KV_RECORD_DELETED, NULL, 0U, &location);
+  }
+  if (status != KV_OK)
+  {
+    return status;
+  }
+
+  entry = kv_index_find(store, key);
+  kv_release(store, entry);
+  kv_index_remove(store, entry);
+  kv_gc_request(store, 0U);
+  return KV_OK;
+}
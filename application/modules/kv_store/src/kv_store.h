@@ -0,0 +1,150 @@
+#ifndef KV_STORE_H
+#define KV_STORE_H
+
+#include <stdint.h>
+
+/*
+ * Log-structured key-value store over two flash sectors.
+ *
+ * Records are appended in whole 256-bit flash words, so an update costs one
+ * or a few flash-word programs instead of a sector erase. One sector is
+ * active and the other is the spare. When the active sector passes
+ * KV_GC_THRESHOLD, garbage collection erases the spare, stamps it with the
+ * next sequence number, copies the live records into it and ends with a
+ * GC_DONE marker. The two sectors take turns, so they wear evenly, and each
+ * erase is spread over a whole sector's worth of updates.
+ *
+ * Layout of a sector (offsets in flash words):
+ *
+ *   0      kv_sector_header: magic, sequence, erase count, CRC
+ *   1 ..   records: kv_record_header + value, padded to a flash word
+ *
+ * Power-fail safety comes from write ordering:
+ *  - A record's header word goes first and its CRC covers the value, so an
+ *    interrupted append fails the CRC and mount skips it word by word.
+ *    Mount leaves one erased word as a gap before appending again, in case
+ *    a program cut very early reads as erased but cannot be programmed.
+ *  - During GC both sectors hold data, and the newer one (higher sequence)
+ *    wins key by key. Until the GC_DONE marker is in the new sector, the
+ *    old one is still read at mount, and an interrupted copy resumes. After
+ *    the marker the old sector is ignored and becomes the next spare.
+ *  - A sector whose header fails its CRC (an interrupted erase) is a spare.
+ *
+ * Lookups go through a RAM hash index (key to record location) rebuilt by
+ * kv_mount() in one pass over the sectors, so kv_get() reads only the value.
+ * Live data is limited to half a sector, so every GC is followed by at
+ * least a quarter sector of appends. When an append finds no room, the
+ * running GC is finished synchronously.
+ *
+ * The store is HAL-free: flash is reached through kv_flash, and
+ * kv_flash_hal.h provides the STM32H7 bank 2 backend. Host builds use a
+ * simulated flash (tools/kv_sim.c).
+ */
+
+#define KV_FLASH_WORD        32U       /*!< Program granularity, bytes */
+#define KV_MAX_KEYS          192U      /*!< Distinct live keys */
+#define KV_INDEX_SIZE        256U      /*!< Hash slots, power of two above KV_MAX_KEYS */
+#define KV_MAX_VALUE         1024U
+#define KV_KEY_MAX           0xFFFDU   /*!< 0xFFFE and 0xFFFF are reserved */
+#define KV_GC_THRESHOLD      75U       /*!< Percent of the active sector that starts GC */
+#define KV_GC_BATCH          8U        /*!< Records copied per kv_gc_step() */
+
+#define KV_SECTOR_MAGIC      0x3153564BU   /* "KVS1" */
+#define KV_RECORD_MAGIC      0x564BU       /* "KV" */
+#define KV_RECORD_DELETED    0x0001U       /*!< Tombstone, no value */
+#define KV_RECORD_GC_DONE    0x0002U       /*!< Every live record of the older sector is in this one */
+#define KV_KEY_GC_DONE       0xFFFEU
+#define KV_INDEX_EMPTY       0xFFFFU
+
+typedef enum
+{
+  KV_OK        =  0,
+  KV_NOT_FOUND = -1,
+  KV_ARG_ERROR = -2,
+  KV_FULL      = -3,   /*!< Live data or keys exceed one sector or the index */
+  KV_IO_ERROR  = -4,   /*!< Backend failed */
+  KV_BUSY      = -5,   /*!< GC has more to do; or from a backend, operation still running */
+} kv_status;
+
+/*
+ * Flash backend. Offsets are bytes from the start of the first sector;
+ * sector s spans [s * sector_size, (s + 1) * sector_size). program() writes
+ * one erased, word-aligned flash word. erase() may return KV_BUSY to say
+ * the erase is running; the store then calls it again with the same sector
+ * on a later step until it returns KV_OK.
+ */
+typedef struct
+{
+  kv_status (*read)(void *context, uint32_t offset, void *data, uint32_t size);
+  kv_status (*program)(void *context, uint32_t offset, const void *word);
+  kv_status (*erase)(void *context, uint32_t sector);
+  void     *context;
+  uint32_t sector_size;
+} kv_flash;
+
+typedef struct
+{
+  uint32_t magic;
+  uint32_t sequence;      /*!< Higher is newer */
+  uint32_t erase_count;   /*!< Erases of this sector, carried across GC */
+  uint32_t crc;           /*!< CRC-32 of the fields above */
+  uint32_t reserved[4];   /*!< Erased */
+} kv_sector_header;
+
+typedef struct
+{
+  uint16_t magic;
+  uint16_t key;
+  uint16_t size;    /*!< Value bytes */
+  uint16_t flags;   /*!< KV_RECORD_xxx */
+  uint32_t crc;     /*!< CRC-32 of key, size, flags and the value */
+} kv_record_header;
+
+typedef struct
+{
+  uint16_t key;        /*!< KV_INDEX_EMPTY when the slot is free */
+  uint16_t size;
+  uint32_t location;   /*!< Byte offset of the record header */
+  uint32_t deleted;    /*!< Tombstone, only kept while kv_mount() merges sectors */
+} kv_index_entry;
+
+typedef enum
+{
+  KV_GC_IDLE = 0,
+  KV_GC_ERASE,   /*!< Erasing the spare */
+  KV_GC_COPY,    /*!< New sector stamped, copying live records out of the old one */
+} kv_gc_state;
+
+typedef struct
+{
+  const kv_flash *flash;
+  uint32_t       active;          /*!< Sector appended to */
+  uint32_t       tail;            /*!< Next free offset in the active sector */
+  uint32_t       sequence;
+  uint32_t       erase_count[2];
+  kv_gc_state    gc;
+  uint32_t       gc_cursor;       /*!< Next index slot to look at for copying */
+  uint32_t       gc_pending;      /*!< Flash bytes still to copy from the old sector */
+  uint32_t       live_bytes;      /*!< Flash bytes of all live records */
+  uint32_t       keys;
+  uint32_t       corrupt;         /*!< Records skipped at mount (failed CRC) */
+  kv_index_entry index[KV_INDEX_SIZE];
+} kv_store;
+
+/* Rebuilds the index; formats the sectors when neither holds a store */
+kv_status kv_mount(kv_store *store, const kv_flash *flash);
+kv_status kv_format(kv_store *store, const kv_flash *flash);
+
+kv_status kv_set(kv_store *store, uint16_t key, const void *value, uint16_t size);
+kv_status kv_get(const kv_store *store, uint16_t key, void *value, uint16_t capacity, uint16_t *size);
+kv_status kv_delete(kv_store *store, uint16_t key);
+
+/* One bounded piece of GC: KV_BUSY while there is more, KV_OK when idle */
+kv_status kv_gc_step(kv_store *store);
+
+/* Starts GC if the active sector is past KV_GC_THRESHOLD (or always with force) */
+void      kv_gc_request(kv_store *store, uint32_t force);
+
+uint32_t  kv_crc32(const void *data, uint32_t size, uint32_t crc);
+
+#endif /* KV_STORE_H */
@@ -1,6 +1,17 @@
 #include "stdio.h"
 
 #include "stm32h7xx_hal.h"
+#include "irq_config.h"
+#include "dma_manager.h"
+#include "dma_memcpy.h"
+#include "flash_service.h"
+#include "boot_app.h"
+#ifdef IRQ_LATENCY_MODULE_ENABLED
+#include "irq_latency.h"
+#endif
+#ifdef BENCHMARK_MODULE_ENABLED
+#include "benchmark.h"
+#endif
 
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
@@ -27,11 +38,41 @@ void Error_Handler(void)
 
 int main(void)
 {
+  const uint32_t boot_cycles = DWT->CYCCNT;   /* Started by the bootloader */
+
   HAL_Init();
 
+  IRQ_Config_Init();
+
+  DMAMgr_Init();
+
   SystemClock_Config();
 
   MX_GPIO_Init();
+
+  Boot_Report(boot_cycles);
+
+  if (dma_mem_init() != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (FlashSvc_Init() != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+#ifdef IRQ_LATENCY_MODULE_ENABLED
+  static Latency_ResultTypeDef latency_result;
+
+  Latency_Init();
+  Latency_Run(&latency_result);
+  Latency_Report(&latency_result);
+#endif
+
+#ifdef BENCHMARK_MODULE_ENABLED
+  Benchmark_Run();
+#endif
   
   while (1)
   {
@@ -0,0 +1,356 @@
+#include "mem_string.h"
+#include "memory_sections.h"
+
+#ifndef MEM_STRING_ITCM
+#define MEM_STRING_ITCM    1     /*!< 0 keeps the primitives in flash */
+#endif
+
+#if defined(__arm__) && (MEM_STRING_ITCM != 0)
+#define MEM_STRING_TEXT    MEM_ITCM_TEXT
+#else
+#define MEM_STRING_TEXT
+#endif
+
+#if defined(__ARM_ARCH_7EM__)
+#define MEM_STRING_ASM     1
+#else
+#define MEM_STRING_ASM     0
+#endif
+
+/* Keeps GCC from turning the copy loops back into calls to memcpy/memset */
+#define MEM_STRING_FN      MEM_STRING_TEXT __attribute__((optimize("no-tree-loop-distribute-patterns")))
+
+typedef uint32_t __attribute__((may_alias)) mem_u32;
+typedef uint32_t __attribute__((may_alias, aligned(1))) mem_u32_unaligned;
+
+/* The M7 handles unaligned LDR/STR (not LDRD/LDM) as long as CCR.UNALIGN_TRP is clear */
+static inline uint32_t mem_read_unaligned(const uint8_t *ptr)
+{
+  return *(const mem_u32_unaligned *)ptr;
+}
+
+/**
+  * @brief  Bulk copy between word-aligned buffers; leaves fewer than 8 bytes.
+  */
+static inline void mem_copy_aligned(uint8_t **dst, const uint8_t **src, size_t *len)
+{
+  uint8_t *d = *dst;
+  const uint8_t *s = *src;
+  size_t n = *len;
+
+#if MEM_STRING_ASM
+  uint32_t blocks = n >> 5;
+
+  if (blocks != 0U)
+  {
+    __asm volatile(
+      "1:                                                    \n"
+      "  ldmia  %[s]!, {r3, r4, r5, r6, r8, r9, r10, r12}   \n"
+      "  subs   %[n], %[n], #1                               \n"
+      "  stmia  %[d]!, {r3, r4, r5, r6, r8, r9, r10, r12}   \n"
+      "  bne    1b                                           \n"
+      : [d] "+r" (d), [s] "+r" (s), [n] "+r" (blocks)
+      :
+      : "r3", "r4", "r5", "r6", "r8", "r9", "r10", "r12", "cc", "memory");
+    n &= 31U;
+  }
+
+  while (n >= 8U)
+  {
+    uint32_t lo;
+    uint32_t hi;
+
+    __asm volatile("ldrd %0, %1, [%2], #8" : "=&r" (lo), "=&r" (hi), "+r" (s) : : "memory");
+    __asm volatile("strd %1, %2, [%0], #8" : "+r" (d) : "r" (lo), "r" (hi) : "memory");
+    n -= 8U;
+  }
+#else
+  while (n >= 32U)
+  {
+    const mem_u32 *sw = (const mem_u32 *)s;
+    mem_u32 *dw = (mem_u32 *)d;
+
+    dw[0] = sw[0]; dw[1] = sw[1]; dw[2] = sw[2]; dw[3] = sw[3];
+    dw[4] = sw[4]; dw[5] = sw[5]; dw[6] = sw[6]; dw[7] = sw[7];
+    d += 32U;
+    s += 32U;
+    n -= 32U;
+  }
+
+  while (n >= 8U)
+  {
+    ((mem_u32 *)d)[0] = ((const mem_u32 *)s)[0];
+    ((mem_u32 *)d)[1] = ((const mem_u32 *)s)[1];
+    d += 8U;
+    s += 8U;
+    n -= 8U;
+  }
+#endif
+
+  *dst = d;
+  *src = s;
+  *len = n;
+}
+
+MEM_STRING_FN void *mem_copy(void *dst, const void *src, size_t len)
+{
+  uint8_t *d = dst;
+  const uint8_t *s = src;
+
+  if (len >= 8U)
+  {
+    while (((uintptr_t)d & 3U) != 0U)
+    {
+      *d++ = *s++;
+      len--;
+    }
+
+    if (((uintptr_t)s & 3U) == 0U)
+    {
+      mem_copy_aligned(&d, &s, &len);
+    }
+    else
+    {
+      while (len >= 16U)
+      {
+        uint32_t w0 = mem_read_unaligned(s);
+        uint32_t w1 = mem_read_unaligned(s + 4U);
+        uint32_t w2 = mem_read_unaligned(s + 8U);
+        uint32_t w3 = mem_read_unaligned(s + 12U);
+
+        ((mem_u32 *)d)[0] = w0;
+        ((mem_u32 *)d)[1] = w1;
+        ((mem_u32 *)d)[2] = w2;
+        ((mem_u32 *)d)[3] = w3;
+        d += 16U;
+        s += 16U;
+        len -= 16U;
+      }
+    }
+
+    while (len >= 4U)
+    {
+      *(mem_u32 *)d = mem_read_unaligned(s);
+      d += 4U;
+      s += 4U;
+      len -= 4U;
+    }
+  }
+
+  while (len != 0U)
+  {
+    *d++ = *s++;
+    len--;
+  }
+
+  return dst;
+}
+
+MEM_STRING_FN void *mem_set(void *dst, int value, size_t len)
+{
+  uint8_t *d = dst;
+  uint8_t byte = (uint8_t)value;
+
+  if (len >= 8U)
+  {
+    uint32_t word = (uint32_t)byte * 0x01010101U;
+
+    while (((uintptr_t)d & 3U) != 0U)
+    {
+      *d++ = byte;
+      len--;
+    }
+
+#if MEM_STRING_ASM
+    {
+      register uint32_t w0 __asm("r3") = word;
+      register uint32_t w1 __asm("r4") = word;
+      register uint32_t w2 __asm("r5") = word;
+      register uint32_t w3 __asm("r6") = word;
+      uint32_t blocks = len >> 5;
+
+      if (blocks != 0U)
+      {
+        __asm volatile(
+          "1:                                  \n"
+          "  stmia  %[d]!, {r3, r4, r5, r6}   \n"
+          "  subs   %[n], %[n], #1             \n"
+          "  stmia  %[d]!, {r3, r4, r5, r6}   \n"
+          "  bne    1b                         \n"
+          : [d] "+r" (d), [n] "+r" (blocks)
+          : "r" (w0), "r" (w1), "r" (w2), "r" (w3)
+          : "cc", "memory");
+        len &= 31U;
+      }
+    }
+
+    while (len >= 8U)
+    {
+      __asm volatile("strd %1, %1, [%0], #8" : "+r" (d) : "r" (word) : "memory");
+      len -= 8U;
+    }
+#else
+    while (len >= 32U)
+    {
+      mem_u32 *dw = (mem_u32 *)d;
+
+      dw[0] = word; dw[1] = word; dw[2] = word; dw[3] = word;
+      dw[4] = word; dw[5] = word; dw[6] = word; dw[7] = word;
+      d += 32U;
+      len -= 32U;
+    }
+#endif
+
+    while (len >= 4U)
+    {
+      *(mem_u32 *)d = word;
+      d += 4U;
+      len -= 4U;
+    }
+  }
+
+  while (len != 0U)
+  {
+    *d++ = byte;
+    len--;
+  }
+
+  return dst;
+}
+
+MEM_STRING_FN void *mem_move(void *dst, const void *src, size_t len)
+{
+  uint8_t *d = dst;
+  const uint8_t *s = src;
+
+  /* A forward copy never overwrites unread source bytes when dst is below src */
+  if (((uintptr_t)d <= (uintptr_t)s) || ((uintptr_t)d >= ((uintptr_t)s + len)))
+  {
+    return mem_copy(dst, src, len);
+  }
+
+  d += len;
+  s += len;
+
+  if ((len >= 8U) && ((((uintptr_t)d ^ (uintptr_t)s) & 3U) == 0U))
+  {
+    while (((uintptr_t)d & 3U) != 0U)
+    {
+      *--d = *--s;
+      len--;
+    }
+
+#if MEM_STRING_ASM
+    {
+      uint32_t blocks = len >> 5;
+
+      if (blocks != 0U)
+      {
+        __asm volatile(
+          "1:                                                    \n"
+          "  ldmdb  %[s]!, {r3, r4, r5, r6, r8, r9, r10, r12}   \n"
+          "  subs   %[n], %[n], #1                               \n"
+          "  stmdb  %[d]!, {r3, r4, r5, r6, r8, r9, r10, r12}   \n"
+          "  bne    1b                                           \n"
+          : [d] "+r" (d), [s] "+r" (s), [n] "+r" (blocks)
+          :
+          : "r3", "r4", "r5", "r6", "r8", "r9", "r10", "r12", "cc", "memory");
+        len &= 31U;
+      }
+    }
+#endif
+
+    while (len >= 16U)
+    {
+      uint32_t w0;
+      uint32_t w1;
+      uint32_t w2;
+      uint32_t w3;
+
+      s -= 16U;
+      d -= 16U;
+      w0 = ((const mem_u32 *)s)[0];
+      w1 = ((const mem_u32 *)s)[1];
+      w2 = ((const mem_u32 *)s)[2];
+      w3 = ((const mem_u32 *)s)[3];
+      ((mem_u32 *)d)[0] = w0;
+      ((mem_u32 *)d)[1] = w1;
+      ((mem_u32 *)d)[2] = w2;
+      ((mem_u32 *)d)[3] = w3;
+      len -= 16U;
+    }
+
+    while (len >= 4U)
+    {
+      s -= 4U;
+      d -= 4U;
+      *(mem_u32 *)d = *(const mem_u32 *)s;
+      len -= 4U;
+    }
+  }
+
+  while (len != 0U)
+  {
+    *--d = *--s;
+    len--;
+  }
+
+  return dst;
+}
+
+MEM_STRING_FN int mem_compare(const void *lhs, const void *rhs, size_t len)
+{
+  const uint8_t *a = lhs;
+  const uint8_t *b = rhs;
+
+  if ((len >= 8U) && ((((uintptr_t)a ^ (uintptr_t)b) & 3U) == 0U))
+  {
+    while (((uintptr_t)a & 3U) != 0U)
+    {
+      if (*a != *b)
+      {
+        return (int)*a - (int)*b;
+      }
+      a++;
+      b++;
+      len--;
+    }
+
+    while (len >= 4U)
+    {
+      uint32_t x = *(const mem_u32 *)a;
+      uint32_t y = *(const mem_u32 *)b;
+
+      if (x != y)
+      {
+        /* Byte-reversed, the first differing byte is the most significant */
+        x = __builtin_bswap32(x);
+        y = __builtin_bswap32(y);
+        return (x > y) ? 1 : -1;
+      }
+      a += 4U;
+      b += 4U;
+      len -= 4U;
+    }
+  }
+
+  while (len != 0U)
+  {
+    if (*a != *b)
+    {
+      return (int)*a - (int)*b;
+    }
+    a++;
+    b++;
+    len--;
+  }
+
+  return 0;
+}
+
+#if defined(__arm__)
+void *memcpy(void *dst, const void *src, size_t len) __attribute__((alias("mem_copy")));
+void *memset(void *dst, int value, size_t len) __attribute__((alias("mem_set")));
+void *memmove(void *dst, const void *src, size_t len) __attribute__((alias("mem_move")));
+int   memcmp(const void *lhs, const void *rhs, size_t len) __attribute__((alias("mem_compare")));
+#endif
@@ -0,0 +1,22 @@
+#ifndef MEM_STRING_H
+#define MEM_STRING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * String primitives tuned for the Cortex-M7: 32-byte LDM/STM bursts for
+ * co-aligned buffers, LDRD/STRD for the 8-byte steps, unaligned LDR when
+ * source and destination disagree on alignment, byte fix-up at the edges.
+ *
+ * On target they also provide memcpy/memset/memmove/memcmp, which the
+ * linker script otherwise drops along with libc.a. On any other host the
+ * portable C path is built under the mem_ names only, so it can be checked
+ * against the host libc.
+ */
+void *mem_copy(void *dst, const void *src, size_t len);
+void *mem_set(void *dst, int value, size_t len);
+void *mem_move(void *dst, const void *src, size_t len);
+int   mem_compare(const void *lhs, const void *rhs, size_t len);
+
+#endif /* MEM_STRING_H */
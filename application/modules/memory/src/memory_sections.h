@@ -0,0 +1,23 @@
+#ifndef MEMORY_SECTIONS_H
+#define MEMORY_SECTIONS_H
+
+/*
+ * Placement of buffers outside the default AXI SRAM (RAM_D1).
+ * The sections are NOLOAD: contents are undefined after reset.
+ *
+ *  DTCM   0x20000000  128K  zero wait-state, not cached, MDMA only (no DMA1/2)
+ *  RAM_D2 0x30000000  288K  SRAM1-3, cached, DMA1/2 friendly
+ *  RAM_D3 0x38000000   64K  SRAM4, cached, the only RAM BDMA can reach
+ *  ITCM   0x00000000   64K  code only, see MEM_ITCM_TEXT
+ */
+#define MEM_DTCM_BSS      __attribute__((section(".dtcm_bss")))
+#define MEM_D2_BSS        __attribute__((section(".ram_d2_bss")))
+#define MEM_D3_BSS        __attribute__((section(".ram_d3_bss")))
+
+/* Initialized data copied from flash to DTCM by the startup code (tables) */
+#define MEM_DTCM_DATA     __attribute__((section(".dtcm_data")))
+
+/* Code copied from flash to ITCM by the startup code: zero wait-state fetch */
+#define MEM_ITCM_TEXT     __attribute__((section(".itcm_text")))
+
+#endif /* MEMORY_SECTIONS_H */
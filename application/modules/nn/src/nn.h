@@ -0,0 +1,60 @@
+#ifndef NN_H
+#define NN_H
+
+#include <stdint.h>
+
+#include "nn_types.h"
+
+/*
+ * int8 inference kernels (TFLite Micro int8 semantics, see nn_types.h).
+ *
+ * These are the Cortex-M7 paths: SXTB16 unpacking, SMLAD dot products and
+ * SSAT output saturation. nn_ref.h has the same functions as plain loops;
+ * the two agree bit for bit.
+ */
+
+/* ctx may be NULL; see nn_conv.c for how the scratch is used */
+nn_status nn_conv2d_s8(const nn_context *ctx,
+                       const nn_conv_params *conv_params,
+                       const nn_per_channel_quant_params *quant_params,
+                       const nn_dims *input_dims, const int8_t *input,
+                       const nn_dims *filter_dims, const int8_t *filter,
+                       const int32_t *bias,
+                       const nn_dims *output_dims, int8_t *output);
+
+nn_status nn_depthwise_conv2d_s8(const nn_dw_conv_params *dw_conv_params,
+                                 const nn_per_channel_quant_params *quant_params,
+                                 const nn_dims *input_dims, const int8_t *input,
+                                 const nn_dims *filter_dims, const int8_t *filter,
+                                 const int32_t *bias,
+                                 const nn_dims *output_dims, int8_t *output);
+
+/* filter_dims->n is the accumulation depth, output_dims->c the output depth */
+nn_status nn_fully_connected_s8(const nn_fc_params *fc_params,
+                                const nn_per_tensor_quant_params *quant_params,
+                                const nn_dims *input_dims, const int8_t *input,
+                                const nn_dims *filter_dims, const int8_t *filter,
+                                const int32_t *bias,
+                                const nn_dims *output_dims, int8_t *output);
+
+/* filter_dims->h/w is the pooling window */
+nn_status nn_max_pool_s8(const nn_pool_params *pool_params,
+                         const nn_dims *input_dims, const int8_t *input,
+                         const nn_dims *filter_dims,
+                         const nn_dims *output_dims, int8_t *output);
+
+nn_status nn_avg_pool_s8(const nn_pool_params *pool_params,
+                         const nn_dims *input_dims, const int8_t *input,
+                         const nn_dims *filter_dims,
+                         const nn_dims *output_dims, int8_t *output);
+
+/* Output scale is 1/256 with zero point -128 */
+nn_status nn_softmax_s8(const nn_softmax_params *softmax_params,
+                        const int8_t *input, int32_t num_rows, int32_t row_size,
+                        int8_t *output);
+
+nn_status nn_add_s8(const nn_add_params *add_params,
+                    const int8_t *input_1, const int8_t *input_2, int32_t block_size,
+                    int8_t *output);
+
+#endif /* NN_H */
@@ -0,0 +1,49 @@
+#include "nn.h"
+#include "nn_math.h"
+
+static int8_t nn_add_one(const nn_add_params *add_params, int32_t a, int32_t b)
+{
+  const int32_t scale = 1 << add_params->left_shift;
+
+  a = nn_requantize(a * scale, add_params->input_1_multiplier, add_params->input_1_shift);
+  b = nn_requantize(b * scale, add_params->input_2_multiplier, add_params->input_2_shift);
+  return nn_output_s8(a + b, add_params->output_multiplier, add_params->output_shift,
+                      add_params->output_offset, &add_params->activation);
+}
+
+/**
+  * @brief  Element-wise add of two int8 tensors with independent scales.
+  * @note   Four elements per step: one LDR and two SXTB16/SADD16 per input
+  *         replace eight sign-extending byte loads and offset adds.
+  */
+nn_status nn_add_s8(const nn_add_params *add_params,
+                    const int8_t *input_1, const int8_t *input_2, int32_t block_size,
+                    int8_t *output)
+{
+  const uint32_t offset_1 = nn_pack_pair(add_params->input_1_offset);
+  const uint32_t offset_2 = nn_pack_pair(add_params->input_2_offset);
+  int32_t i = 0;
+
+  for (; i + 4 <= block_size; i += 4)
+  {
+    const uint32_t a = nn_read_s8x4(&input_1[i]);
+    const uint32_t b = nn_read_s8x4(&input_2[i]);
+    const uint32_t a02 = nn_sadd16(nn_sxtb16(a), offset_1);
+    const uint32_t a13 = nn_sadd16(nn_sxtb16_ror8(a), offset_1);
+    const uint32_t b02 = nn_sadd16(nn_sxtb16(b), offset_2);
+    const uint32_t b13 = nn_sadd16(nn_sxtb16_ror8(b), offset_2);
+
+    output[i]     = nn_add_one(add_params, nn_lo16(a02), nn_lo16(b02));
+    output[i + 1] = nn_add_one(add_params, nn_lo16(a13), nn_lo16(b13));
+    output[i + 2] = nn_add_one(add_params, nn_hi16(a02), nn_hi16(b02));
+    output[i + 3] = nn_add_one(add_params, nn_hi16(a13), nn_hi16(b13));
+  }
+
+  for (; i < block_size; i++)
+  {
+    output[i] = nn_add_one(add_params, (int32_t)input_1[i] + add_params->input_1_offset,
+                           (int32_t)input_2[i] + add_params->input_2_offset);
+  }
+
+  return NN_OK;
+}
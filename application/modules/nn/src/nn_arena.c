@@ -0,0 +1,312 @@
+#include <stddef.h>
+#include <stdio.h>
+
+#include "nn_arena.h"
+
+#define NN_ARENA_NONE    0xFFFFFFFFU
+
+typedef struct
+{
+  int32_t  first;   /*!< First layer the tensor is live in, -1 if unused */
+  int32_t  last;
+  uint32_t size;
+} nn_arena_life;
+
+static uint32_t nn_arena_align(uint32_t value)
+{
+  return (value + NN_ARENA_ALIGN - 1U) & ~(NN_ARENA_ALIGN - 1U);
+}
+
+static uint32_t nn_arena_bytes(const nn_tensor *tensor)
+{
+  return (uint32_t)(tensor->dims.n * tensor->dims.h * tensor->dims.w * tensor->dims.c);
+}
+
+static int nn_arena_overlap(const nn_arena_life *a, const nn_arena_life *b)
+{
+  return (a->first <= b->last) && (b->first <= a->last);
+}
+
+/**
+  * @brief  Live range of every tensor in layer indices.
+  * @note   A tensor read before any layer writes it is a model input and is
+  *         live from layer 0; one never read after its last write is a model
+  *         output and stays live to the end. Input and output of one layer
+  *         overlap at that layer, so a kernel never runs in place.
+  */
+static nn_status nn_arena_lifetimes(const nn_model *model, nn_arena_life *life)
+{
+  int32_t last_read[NN_ARENA_MAX_TENSORS];
+  int32_t last_write[NN_ARENA_MAX_TENSORS];
+  uint32_t t;
+  uint32_t i;
+
+  if (model->tensor_count > NN_ARENA_MAX_TENSORS)
+  {
+    return NN_ARG_ERROR;
+  }
+
+  for (t = 0U; t < model->tensor_count; t++)
+  {
+    life[t].first = -1;
+    life[t].last = -1;
+    life[t].size = nn_arena_align(nn_arena_bytes(&model->tensors[t]));
+    last_read[t] = -1;
+    last_write[t] = -1;
+  }
+
+  for (i = 0U; i < model->layer_count; i++)
+  {
+    const nn_layer *layer = &model->layers[i];
+    uint16_t operand[3] = { layer->input, layer->input_2, layer->output };
+    uint32_t count = (layer->op == NN_OP_ADD) ? 2U : 1U;
+    uint32_t k;
+
+    if ((layer->input >= model->tensor_count) || (layer->output >= model->tensor_count) ||
+        ((layer->op == NN_OP_ADD) && (layer->input_2 >= model->tensor_count)))
+    {
+      return NN_ARG_ERROR;
+    }
+
+    for (k = 0U; k < count; k++)
+    {
+      t = operand[k];
+      if (life[t].first < 0)
+      {
+        life[t].first = 0;
+      }
+      last_read[t] = (int32_t)i;
+    }
+
+    t = operand[2];
+    if (life[t].first < 0)
+    {
+      life[t].first = (int32_t)i;
+    }
+    last_write[t] = (int32_t)i;
+  }
+
+  for (t = 0U; t < model->tensor_count; t++)
+  {
+    if (life[t].first >= 0)
+    {
+      life[t].last = (last_write[t] > last_read[t]) ? ((int32_t)model->layer_count - 1) : last_read[t];
+    }
+  }
+
+  return NN_OK;
+}
+
+/**
+  * @brief  Smallest gap between tensors already placed in @p region that are
+  *         live at the same time as @p tensor; the region's tail if none fits.
+  */
+static uint32_t nn_arena_best_fit(const nn_arena_life *life, const int8_t *region_of, const uint32_t *offset_of,
+                                  uint32_t tensor_count, uint32_t tensor, int8_t region, uint32_t region_size)
+{
+  uint8_t busy[NN_ARENA_MAX_TENSORS];
+  uint32_t busy_count = 0U;
+  uint32_t best = NN_ARENA_NONE;
+  uint32_t best_gap = NN_ARENA_NONE;
+  uint32_t cursor = 0U;
+  uint32_t t;
+  uint32_t k;
+
+  /* Conflicting tensors sorted by offset */
+  for (t = 0U; t < tensor_count; t++)
+  {
+    if ((region_of[t] == region) && nn_arena_overlap(&life[t], &life[tensor]))
+    {
+      k = busy_count++;
+      while ((k > 0U) && (offset_of[busy[k - 1U]] > offset_of[t]))
+      {
+        busy[k] = busy[k - 1U];
+        k--;
+      }
+      busy[k] = (uint8_t)t;
+    }
+  }
+
+  for (k = 0U; k < busy_count; k++)
+  {
+    const uint32_t start = offset_of[busy[k]];
+    const uint32_t end = nn_arena_align(start + life[busy[k]].size);
+
+    if ((start > cursor) && ((start - cursor) >= life[tensor].size) && ((start - cursor) < best_gap))
+    {
+      best = cursor;
+      best_gap = start - cursor;
+    }
+    if (end > cursor)
+    {
+      cursor = end;
+    }
+  }
+
+  if ((best == NN_ARENA_NONE) && (cursor <= region_size) && ((region_size - cursor) >= life[tensor].size))
+  {
+    best = cursor;
+  }
+
+  return best;
+}
+
+/**
+  * @brief  Places every unbound, used tensor of @p model in the regions and
+  *         sets its data pointer. Region peaks are updated.
+  * @retval NN_NO_MEMORY if some tensor fits in none of the regions.
+  */
+nn_status nn_arena_plan(nn_model *model, nn_arena_region *regions, uint32_t region_count)
+{
+  nn_arena_life life[NN_ARENA_MAX_TENSORS];
+  int8_t region_of[NN_ARENA_MAX_TENSORS];
+  uint32_t offset_of[NN_ARENA_MAX_TENSORS];
+  uint8_t order[NN_ARENA_MAX_TENSORS];
+  uint32_t order_count = 0U;
+  nn_status status;
+  uint32_t t;
+  uint32_t k;
+  uint32_t r;
+
+  status = nn_arena_lifetimes(model, life);
+  if ((status != NN_OK) || (region_count > 127U))
+  {
+    return (status != NN_OK) ? status : NN_ARG_ERROR;
+  }
+
+  for (r = 0U; r < region_count; r++)
+  {
+    regions[r].peak = 0U;
+  }
+
+  /* Largest first; ties keep model order so the plan is stable */
+  for (t = 0U; t < model->tensor_count; t++)
+  {
+    region_of[t] = -1;
+    offset_of[t] = 0U;
+
+    if ((life[t].first < 0) || (model->tensors[t].data != NULL))
+    {
+      continue;
+    }
+
+    k = order_count++;
+    while ((k > 0U) && (life[order[k - 1U]].size < life[t].size))
+    {
+      order[k] = order[k - 1U];
+      k--;
+    }
+    order[k] = (uint8_t)t;
+  }
+
+  for (k = 0U; k < order_count; k++)
+  {
+    t = order[k];
+
+    for (r = 0U; r < region_count; r++)
+    {
+      const uint32_t offset = nn_arena_best_fit(life, region_of, offset_of, model->tensor_count, t,
+                                                (int8_t)r, regions[r].size);
+
+      if (offset != NN_ARENA_NONE)
+      {
+        region_of[t] = (int8_t)r;
+        offset_of[t] = offset;
+        if ((offset + life[t].size) > regions[r].peak)
+        {
+          regions[r].peak = offset + life[t].size;
+        }
+        break;
+      }
+    }
+
+    if (r == region_count)
+    {
+      return NN_NO_MEMORY;
+    }
+  }
+
+  for (k = 0U; k < order_count; k++)
+  {
+    t = order[k];
+    model->tensors[t].data = (int8_t *)&regions[region_of[t]].base[offset_of[t]];
+  }
+
+  return NN_OK;
+}
+
+/**
+  * @brief  Verifies that no two tensors live at the same time share a byte.
+  * @retval NN_ARG_ERROR on the first overlap found.
+  */
+nn_status nn_arena_check(const nn_model *model)
+{
+  nn_arena_life life[NN_ARENA_MAX_TENSORS];
+  nn_status status;
+  uint32_t a;
+  uint32_t b;
+
+  status = nn_arena_lifetimes(model, life);
+  if (status != NN_OK)
+  {
+    return status;
+  }
+
+  for (a = 0U; a < model->tensor_count; a++)
+  {
+    const uintptr_t a_start = (uintptr_t)model->tensors[a].data;
+    const uintptr_t a_end = a_start + nn_arena_bytes(&model->tensors[a]);
+
+    if ((life[a].first < 0) || (a_start == 0U))
+    {
+      continue;
+    }
+
+    for (b = a + 1U; b < model->tensor_count; b++)
+    {
+      const uintptr_t b_start = (uintptr_t)model->tensors[b].data;
+      const uintptr_t b_end = b_start + nn_arena_bytes(&model->tensors[b]);
+
+      if ((life[b].first < 0) || (b_start == 0U) || !nn_arena_overlap(&life[a], &life[b]))
+      {
+        continue;
+      }
+      if ((a_start < b_end) && (b_start < a_end))
+      {
+        return NN_ARG_ERROR;
+      }
+    }
+  }
+
+  return NN_OK;
+}
+
+/**
+  * @brief  Bytes needed with one buffer per tensor, for comparison with the plan.
+  */
+uint32_t nn_arena_naive_size(const nn_model *model)
+{
+  uint32_t total = 0U;
+  uint32_t t;
+
+  for (t = 0U; t < model->tensor_count; t++)
+  {
+    total += nn_arena_align(nn_arena_bytes(&model->tensors[t]));
+  }
+  return total;
+}
+
+void nn_arena_print(const nn_model *model, const nn_arena_region *regions, uint32_t region_count)
+{
+  uint32_t total = 0U;
+  uint32_t r;
+
+  for (r = 0U; r < region_count; r++)
+  {
+    printf("arena: %-6s %6lu / %6lu B\n", regions[r].name, (unsigned long)regions[r].peak,
+           (unsigned long)regions[r].size);
+    total += regions[r].peak;
+  }
+  printf("arena: peak %lu B, one buffer per tensor %lu B\n", (unsigned long)total,
+         (unsigned long)nn_arena_naive_size(model));
+}
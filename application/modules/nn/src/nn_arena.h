@@ -0,0 +1,37 @@
+#ifndef NN_ARENA_H
+#define NN_ARENA_H
+
+#include <stdint.h>
+
+#include "nn_model.h"
+
+/*
+ * Static activation planner. Tensor lifetimes are taken from the layer list
+ * (first layer writing to last layer reading); tensors whose lifetimes
+ * overlap never share bytes, all others may. Tensors are packed largest
+ * first, best-fit into the gaps left by live tensors, trying the regions
+ * in the order given: list DTCM first so activations spill to AXI SRAM
+ * only when it is full.
+ *
+ * The planner is HAL-free and deterministic, so the offsets it produces on
+ * a host are the ones the target gets.
+ */
+
+#define NN_ARENA_MAX_TENSORS    64U
+#define NN_ARENA_ALIGN          8U
+
+typedef struct
+{
+  const char *name;
+  uint8_t    *base;
+  uint32_t   size;
+  uint32_t   peak;   /*!< Highest byte used, set by nn_arena_plan() */
+} nn_arena_region;
+
+/* Tensors with data already set (model inputs bound by the caller) are left in place */
+nn_status nn_arena_plan(nn_model *model, nn_arena_region *regions, uint32_t region_count);
+nn_status nn_arena_check(const nn_model *model);
+uint32_t  nn_arena_naive_size(const nn_model *model);
+void      nn_arena_print(const nn_model *model, const nn_arena_region *regions, uint32_t region_count);
+
+#endif /* NN_ARENA_H */
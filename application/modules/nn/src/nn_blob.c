@@ -0,0 +1,328 @@
+#include <stddef.h>
+
+#include "nn_blob.h"
+
+/* Words per parameter record, indexed by nn_op */
+static const uint32_t nn_blob_record_words[NN_OP_COUNT] =
+{
+  16U,   /* conv2d */
+  17U,   /* dw_conv2d */
+  9U,    /* fully_conn */
+  8U,    /* max_pool */
+  8U,    /* avg_pool */
+  3U,    /* softmax */
+  12U,   /* add */
+};
+
+/* CRC-32 (IEEE 802.3, reflected), four bits per step */
+static const uint32_t nn_blob_crc_nibble[16] =
+{
+  0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+  0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU,
+};
+
+/**
+  * @brief  CRC-32 as zlib's crc32(): start from 0, chain by passing the previous result.
+  */
+uint32_t nn_blob_crc32(const void *data, uint32_t size, uint32_t crc)
+{
+  const uint8_t *byte = data;
+
+  crc = ~crc;
+  while (size-- != 0U)
+  {
+    crc ^= *byte++;
+    crc = (crc >> 4) ^ nn_blob_crc_nibble[crc & 0x0FU];
+    crc = (crc >> 4) ^ nn_blob_crc_nibble[crc & 0x0FU];
+  }
+  return ~crc;
+}
+
+/**
+  * @brief  Pointer to @p bytes at @p offset if the range lies in the blob and
+  *         is 4-byte aligned; NULL otherwise (and for offset 0).
+  */
+static const void *nn_blob_at(const uint8_t *blob, uint32_t size, uint32_t offset, uint64_t bytes)
+{
+  if ((offset == 0U) || ((offset & 3U) != 0U) || (offset > size) || (bytes > (size - offset)))
+  {
+    return NULL;
+  }
+  return &blob[offset];
+}
+
+/**
+  * @brief  Element count of n x h x w x c, or 0 if a dim is not positive or
+  *         the product does not fit the kernels' int32 index arithmetic.
+  */
+static uint32_t nn_blob_dims_count(const int32_t *dims)
+{
+  uint64_t count = 1U;
+  uint32_t i;
+
+  for (i = 0U; i < 4U; i++)
+  {
+    if (dims[i] <= 0)
+    {
+      return 0U;
+    }
+    count *= (uint64_t)dims[i];
+    if (count > (uint64_t)INT32_MAX)
+    {
+      return 0U;
+    }
+  }
+  return (uint32_t)count;
+}
+
+/* Shared tail of the conv2d and dw_conv2d records */
+static nn_blob_status nn_blob_conv_tail(const uint8_t *blob, uint32_t size, const int32_t *word,
+                                        nn_dims *filter_dims, const int8_t **filter, const int32_t **bias,
+                                        nn_per_channel_quant_params *quant, int32_t out_channels)
+{
+  const uint64_t channel_bytes = (uint64_t)(uint32_t)out_channels * 4U;
+  const uint32_t filter_bytes = nn_blob_dims_count(word);
+
+  filter_dims->n = word[0];
+  filter_dims->h = word[1];
+  filter_dims->w = word[2];
+  filter_dims->c = word[3];
+  if ((filter_bytes == 0U) || (out_channels <= 0))
+  {
+    return NN_BLOB_BAD_LAYOUT;
+  }
+
+  *filter = nn_blob_at(blob, size, (uint32_t)word[4], filter_bytes);
+  *bias = nn_blob_at(blob, size, (uint32_t)word[5], channel_bytes);
+  quant->multiplier = nn_blob_at(blob, size, (uint32_t)word[6], channel_bytes);
+  quant->shift = nn_blob_at(blob, size, (uint32_t)word[7], channel_bytes);
+
+  if ((*filter == NULL) || (quant->multiplier == NULL) || (quant->shift == NULL) ||
+      ((*bias == NULL) && (word[5] != 0)))
+  {
+    return NN_BLOB_BAD_LAYOUT;
+  }
+  return NN_BLOB_OK;
+}
+
+static nn_blob_status nn_blob_layer_load(const uint8_t *blob, uint32_t size, const nn_blob_layer *record,
+                                         const int32_t *word, nn_blob_layer_params *params)
+{
+  switch ((nn_op)record->op)
+  {
+    case NN_OP_CONV2D:
+    {
+      nn_conv_layer *p = &params->conv;
+
+      p->conv.input_offset = word[0];
+      p->conv.output_offset = word[1];
+      p->conv.stride.h = word[2];
+      p->conv.stride.w = word[3];
+      p->conv.padding.h = word[4];
+      p->conv.padding.w = word[5];
+      p->conv.activation.min = word[6];
+      p->conv.activation.max = word[7];
+      return nn_blob_conv_tail(blob, size, &word[8], &p->filter_dims, &p->filter, &p->bias, &p->quant, word[8]);
+    }
+
+    case NN_OP_DEPTHWISE_CONV2D:
+    {
+      nn_dw_conv_layer *p = &params->dw_conv;
+
+      p->conv.ch_mult = word[0];
+      p->conv.input_offset = word[1];
+      p->conv.output_offset = word[2];
+      p->conv.stride.h = word[3];
+      p->conv.stride.w = word[4];
+      p->conv.padding.h = word[5];
+      p->conv.padding.w = word[6];
+      p->conv.activation.min = word[7];
+      p->conv.activation.max = word[8];
+      return nn_blob_conv_tail(blob, size, &word[9], &p->filter_dims, &p->filter, &p->bias, &p->quant, word[12]);
+    }
+
+    case NN_OP_FULLY_CONNECTED:
+    {
+      nn_fc_layer *p = &params->fc;
+
+      p->fc.input_offset = word[0];
+      p->fc.filter_offset = 0;
+      p->fc.output_offset = word[1];
+      p->fc.activation.min = word[2];
+      p->fc.activation.max = word[3];
+      p->quant.multiplier = word[4];
+      p->quant.shift = word[5];
+      p->filter_dims.n = word[6];
+      p->filter_dims.h = 1;
+      p->filter_dims.w = 1;
+      p->filter_dims.c = 1;
+      p->filter = NULL;
+      p->bias = NULL;
+      return (word[6] > 0) ? NN_BLOB_OK : NN_BLOB_BAD_LAYOUT;   /* Sized against the output tensor below */
+    }
+
+    case NN_OP_MAX_POOL:
+    case NN_OP_AVG_POOL:
+    {
+      nn_pool_layer *p = &params->pool;
+
+      p->pool.stride.h = word[0];
+      p->pool.stride.w = word[1];
+      p->pool.padding.h = word[2];
+      p->pool.padding.w = word[3];
+      p->pool.activation.min = word[4];
+      p->pool.activation.max = word[5];
+      p->filter_dims.n = 1;
+      p->filter_dims.h = word[6];
+      p->filter_dims.w = word[7];
+      p->filter_dims.c = 1;
+      return ((word[6] > 0) && (word[7] > 0)) ? NN_BLOB_OK : NN_BLOB_BAD_LAYOUT;
+    }
+
+    case NN_OP_SOFTMAX:
+      params->softmax.multiplier = word[0];
+      params->softmax.shift = word[1];
+      params->softmax.diff_min = word[2];
+      return NN_BLOB_OK;
+
+    case NN_OP_ADD:
+      params->add.input_1_offset = word[0];
+      params->add.input_1_multiplier = word[1];
+      params->add.input_1_shift = word[2];
+      params->add.input_2_offset = word[3];
+      params->add.input_2_multiplier = word[4];
+      params->add.input_2_shift = word[5];
+      params->add.left_shift = word[6];
+      params->add.output_offset = word[7];
+      params->add.output_multiplier = word[8];
+      params->add.output_shift = word[9];
+      params->add.activation.min = word[10];
+      params->add.activation.max = word[11];
+      return NN_BLOB_OK;
+
+    default:
+      return NN_BLOB_BAD_LAYOUT;
+  }
+}
+
+/**
+  * @brief  Validates @p blob and builds @p out around it without copying weights.
+  * @param  blob  4-byte aligned start of the blob (flash or memory-mapped).
+  * @param  size  Bytes available at @p blob; the header's total_size must fit.
+  * @note   Tensor data pointers are left NULL: plan them with
+  *         nn_arena_plan(&out->model, ...) before invoking. The model has
+  *         no scratch; attach one with nn_model_set_scratch().
+  */
+nn_blob_status nn_blob_load(const void *blob, uint32_t size, nn_blob_model *out)
+{
+  const uint8_t *base = blob;
+  const nn_blob_header *header = blob;
+  const nn_blob_layer *layer;
+  static const uint8_t zero[4] = { 0U, 0U, 0U, 0U };
+  uint32_t crc;
+  uint32_t i;
+
+  if ((((uintptr_t)blob & 3U) != 0U) || (size < sizeof(nn_blob_header)))
+  {
+    return NN_BLOB_BAD_LAYOUT;
+  }
+  if (header->magic != NN_BLOB_MAGIC)
+  {
+    return NN_BLOB_BAD_MAGIC;
+  }
+  if ((header->version != NN_BLOB_VERSION) || (header->header_size < sizeof(nn_blob_header)))
+  {
+    return NN_BLOB_BAD_VERSION;
+  }
+  if ((header->total_size > size) || (header->total_size < header->header_size))
+  {
+    return NN_BLOB_BAD_LAYOUT;
+  }
+
+  crc = nn_blob_crc32(base, offsetof(nn_blob_header, crc32), 0U);
+  crc = nn_blob_crc32(zero, sizeof(zero), crc);
+  crc = nn_blob_crc32(&base[offsetof(nn_blob_header, crc32) + 4U],
+                      header->total_size - (offsetof(nn_blob_header, crc32) + 4U), crc);
+  if (crc != header->crc32)
+  {
+    return NN_BLOB_BAD_CRC;
+  }
+
+  size = header->total_size;
+  out->quant = nn_blob_at(base, size, header->tensor_offset, header->tensor_count * sizeof(nn_blob_tensor));
+  layer = nn_blob_at(base, size, header->layer_offset, header->layer_count * sizeof(nn_blob_layer));
+  if ((out->quant == NULL) || (layer == NULL) ||
+      (header->tensor_count > NN_BLOB_MAX_TENSORS) || (header->layer_count > NN_BLOB_MAX_LAYERS) ||
+      (header->input >= header->tensor_count) || (header->output >= header->tensor_count))
+  {
+    return NN_BLOB_BAD_LAYOUT;
+  }
+
+  for (i = 0U; i < header->tensor_count; i++)
+  {
+    if (nn_blob_dims_count(out->quant[i].dims) == 0U)
+    {
+      return NN_BLOB_BAD_LAYOUT;
+    }
+    out->tensors[i].dims.n = out->quant[i].dims[0];
+    out->tensors[i].dims.h = out->quant[i].dims[1];
+    out->tensors[i].dims.w = out->quant[i].dims[2];
+    out->tensors[i].dims.c = out->quant[i].dims[3];
+    out->tensors[i].data = NULL;
+  }
+
+  for (i = 0U; i < header->layer_count; i++)
+  {
+    const nn_blob_layer *record = &layer[i];
+    const int32_t *word;
+    nn_blob_status status;
+
+    if ((record->op >= NN_OP_COUNT) || (record->input >= header->tensor_count) ||
+        (record->input_2 >= header->tensor_count) || (record->output >= header->tensor_count))
+    {
+      return NN_BLOB_BAD_LAYOUT;
+    }
+
+    word = nn_blob_at(base, size, record->params_offset, nn_blob_record_words[record->op] * 4U);
+    if (word == NULL)
+    {
+      return NN_BLOB_BAD_LAYOUT;
+    }
+
+    status = nn_blob_layer_load(base, size, record, word, &out->params[i]);
+    if ((status == NN_BLOB_OK) && (record->op == NN_OP_FULLY_CONNECTED))
+    {
+      /* Weights and bias are [output depth][depth]; output depth is the output tensor's c */
+      nn_fc_layer *fc = &out->params[i].fc;
+      const uint32_t out_depth = (uint32_t)out->tensors[record->output].dims.c;
+
+      fc->filter = nn_blob_at(base, size, (uint32_t)word[7], (uint64_t)out_depth * (uint32_t)fc->filter_dims.n);
+      fc->bias = nn_blob_at(base, size, (uint32_t)word[8], (uint64_t)out_depth * 4U);
+      if ((fc->filter == NULL) || ((fc->bias == NULL) && (word[8] != 0)))
+      {
+        status = NN_BLOB_BAD_LAYOUT;
+      }
+    }
+    if (status != NN_BLOB_OK)
+    {
+      return status;
+    }
+
+    out->layers[i].op = (nn_op)record->op;
+    out->layers[i].input = record->input;
+    out->layers[i].input_2 = record->input_2;
+    out->layers[i].output = record->output;
+    out->layers[i].params = &out->params[i];
+  }
+
+  out->input = header->input;
+  out->output = header->output;
+  out->model.tensors = out->tensors;
+  out->model.tensor_count = header->tensor_count;
+  out->model.layers = out->layers;
+  out->model.layer_count = header->layer_count;
+  out->model.cycles = out->cycles;
+  nn_model_set_scratch(&out->model, NULL, 0);
+
+  return NN_BLOB_OK;
+}
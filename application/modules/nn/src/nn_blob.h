@@ -0,0 +1,113 @@
+#ifndef NN_BLOB_H
+#define NN_BLOB_H
+
+#include <stdint.h>
+
+#include "nn_arena.h"
+#include "nn_model.h"
+
+/*
+ * Execute-in-place model format, produced by tools/nn_convert.py.
+ *
+ * The blob is little-endian and position independent: every reference is a
+ * byte offset from the start of the blob, and every array starts on a
+ * 4-byte boundary (weights on NN_BLOB_DATA_ALIGN). It can sit in .rodata in
+ * internal flash or behind any memory-mapped window such as QUADSPI.
+ *
+ *   nn_blob_header
+ *   nn_blob_tensor[tensor_count]
+ *   nn_blob_layer[layer_count]
+ *   layer parameter records (int32 words, layout per op below)
+ *   data: weights, biases, per-channel multipliers and shifts
+ *
+ * nn_blob_load() checks the header and CRC and builds a small nn_model in
+ * RAM whose weight, bias and quantization pointers point into the blob;
+ * nothing is copied. Activations are planned with nn_arena afterwards.
+ */
+
+#define NN_BLOB_MAGIC          0x444C4E4EU   /* "NNLD" */
+#define NN_BLOB_VERSION        1U
+#define NN_BLOB_DATA_ALIGN     16U
+
+#define NN_BLOB_MAX_TENSORS    NN_ARENA_MAX_TENSORS
+#define NN_BLOB_MAX_LAYERS     48U
+
+typedef struct
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t header_size;     /*!< sizeof(nn_blob_header), for forward compatibility */
+  uint32_t total_size;      /*!< Whole blob in bytes */
+  uint32_t crc32;           /*!< CRC-32 (IEEE) of the blob with this field read as 0 */
+  uint16_t tensor_count;
+  uint16_t layer_count;
+  uint16_t input;           /*!< Model input tensor */
+  uint16_t output;          /*!< Model output tensor */
+  uint32_t tensor_offset;
+  uint32_t layer_offset;
+} nn_blob_header;
+
+typedef struct
+{
+  int32_t  dims[4];         /*!< n, h, w, c */
+  int32_t  zero_point;
+  float    scale;
+} nn_blob_tensor;
+
+typedef struct
+{
+  uint16_t op;              /*!< nn_op */
+  uint16_t input;
+  uint16_t input_2;
+  uint16_t output;
+  uint32_t params_offset;   /*!< Parameter record for op */
+} nn_blob_layer;
+
+/*
+ * Parameter records, in int32 words. "off" words are blob offsets, 0 = none.
+ *  conv2d:     input_offset output_offset stride_h stride_w pad_h pad_w act_min act_max
+ *              filter_n filter_h filter_w filter_c filter_off bias_off multiplier_off shift_off
+ *  dw_conv2d:  ch_mult, then as conv2d
+ *  fully_conn: input_offset output_offset act_min act_max multiplier shift
+ *              depth filter_off bias_off
+ *  max/avg:    stride_h stride_w pad_h pad_w act_min act_max filter_h filter_w
+ *  softmax:    multiplier shift diff_min
+ *  add:        in1_offset in1_multiplier in1_shift in2_offset in2_multiplier in2_shift
+ *              left_shift output_offset output_multiplier output_shift act_min act_max
+ */
+
+typedef union
+{
+  nn_conv_layer     conv;
+  nn_dw_conv_layer  dw_conv;
+  nn_fc_layer       fc;
+  nn_pool_layer     pool;
+  nn_softmax_params softmax;
+  nn_add_params     add;
+} nn_blob_layer_params;
+
+typedef struct
+{
+  nn_model             model;
+  nn_tensor            tensors[NN_BLOB_MAX_TENSORS];
+  nn_layer             layers[NN_BLOB_MAX_LAYERS];
+  nn_blob_layer_params params[NN_BLOB_MAX_LAYERS];
+  uint32_t             cycles[NN_BLOB_MAX_LAYERS];
+  const nn_blob_tensor *quant;   /*!< Per-tensor scale and zero point, in the blob */
+  uint16_t             input;
+  uint16_t             output;
+} nn_blob_model;
+
+typedef enum
+{
+  NN_BLOB_OK = 0,
+  NN_BLOB_BAD_MAGIC,
+  NN_BLOB_BAD_VERSION,
+  NN_BLOB_BAD_CRC,
+  NN_BLOB_BAD_LAYOUT,     /*!< Offset, count, dims or op out of range */
+} nn_blob_status;
+
+nn_blob_status nn_blob_load(const void *blob, uint32_t size, nn_blob_model *out);
+uint32_t       nn_blob_crc32(const void *data, uint32_t size, uint32_t crc);
+
+#endif /* NN_BLOB_H */
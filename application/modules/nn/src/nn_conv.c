@@ -0,0 +1,415 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "nn.h"
+#include "nn_math.h"
+
+/* Kernel taps [first, last) that land inside the input for one output coordinate */
+static void nn_tap_range(int32_t origin, int32_t kernel, int32_t extent, int32_t *first, int32_t *last)
+{
+  *first = NN_MAX(0, -origin);
+  *last = NN_MIN(kernel, extent - origin);
+}
+
+/* DTCM (0x20000000, 128K) is zero wait-state; inputs already there are not tiled */
+#if defined(__arm__)
+#define NN_IN_DTCM(ptr)    (((uintptr_t)(ptr) - 0x20000000U) < 0x00020000U)
+#else
+#define NN_IN_DTCM(ptr)    0
+#endif
+
+/**
+  * @brief  Two output pixels by two output channels over one filter row.
+  * @note   Each input word is unpacked and offset once for both channels and
+  *         each weight word once for both pixels: four loads per 16 MACs
+  *         instead of eight.
+  */
+static void nn_conv_block_2x2(const int8_t *in_0, const int8_t *in_1, const int8_t *w_0, const int8_t *w_1,
+                              int32_t len, int32_t input_offset, int32_t acc[4])
+{
+  const uint32_t offset = nn_pack_pair(input_offset);
+  int32_t acc_00 = acc[0];   /* pixel 0, channel 0 */
+  int32_t acc_01 = acc[1];
+  int32_t acc_10 = acc[2];
+  int32_t acc_11 = acc[3];
+
+  while (len >= 4)
+  {
+    const uint32_t k0 = nn_read_s8x4(w_0);
+    const uint32_t k1 = nn_read_s8x4(w_1);
+    const uint32_t k0_a = nn_sxtb16(k0);
+    const uint32_t k0_b = nn_sxtb16_ror8(k0);
+    const uint32_t k1_a = nn_sxtb16(k1);
+    const uint32_t k1_b = nn_sxtb16_ror8(k1);
+    uint32_t x = nn_read_s8x4(in_0);
+    uint32_t x_a = nn_sadd16(nn_sxtb16(x), offset);
+    uint32_t x_b = nn_sadd16(nn_sxtb16_ror8(x), offset);
+
+    acc_00 = nn_smlad(x_a, k0_a, acc_00);
+    acc_00 = nn_smlad(x_b, k0_b, acc_00);
+    acc_01 = nn_smlad(x_a, k1_a, acc_01);
+    acc_01 = nn_smlad(x_b, k1_b, acc_01);
+
+    x = nn_read_s8x4(in_1);
+    x_a = nn_sadd16(nn_sxtb16(x), offset);
+    x_b = nn_sadd16(nn_sxtb16_ror8(x), offset);
+
+    acc_10 = nn_smlad(x_a, k0_a, acc_10);
+    acc_10 = nn_smlad(x_b, k0_b, acc_10);
+    acc_11 = nn_smlad(x_a, k1_a, acc_11);
+    acc_11 = nn_smlad(x_b, k1_b, acc_11);
+
+    in_0 += 4;
+    in_1 += 4;
+    w_0 += 4;
+    w_1 += 4;
+    len -= 4;
+  }
+
+  while (len > 0)
+  {
+    const int32_t x0 = (int32_t)*in_0++ + input_offset;
+    const int32_t x1 = (int32_t)*in_1++ + input_offset;
+    const int32_t k0 = *w_0++;
+    const int32_t k1 = *w_1++;
+
+    acc_00 += x0 * k0;
+    acc_01 += x0 * k1;
+    acc_10 += x1 * k0;
+    acc_11 += x1 * k1;
+    len--;
+  }
+
+  acc[0] = acc_00;
+  acc[1] = acc_01;
+  acc[2] = acc_10;
+  acc[3] = acc_11;
+}
+
+/**
+  * @brief  Output rows [oy_first, oy_last) of one batch.
+  * @param  rows      Input rows, where row index row_base is at rows[0].
+  * @note   Output channel pairs are the outer loop so their 2 x KH*KW*C
+  *         weights stay in cache while the band of input is swept.
+  */
+static void nn_conv_band(const nn_conv_params *conv_params,
+                         const nn_per_channel_quant_params *quant_params,
+                         const nn_dims *input_dims, const int8_t *rows, int32_t row_base,
+                         const nn_dims *filter_dims, const int8_t *filter,
+                         const int32_t *bias,
+                         const nn_dims *output_dims, int8_t *output,
+                         int32_t oy_first, int32_t oy_last)
+{
+  const int32_t in_c = input_dims->c;
+  const int32_t out_c = output_dims->c;
+  const int32_t kernel = filter_dims->h * filter_dims->w * in_c;
+  const int32_t stride_w = conv_params->stride.w;
+  int32_t oc, oy, ox, ky;
+
+  for (oc = 0; oc < out_c; oc += 2)
+  {
+    const int32_t pair = (oc + 1) < out_c;
+    const int8_t *w_0 = &filter[oc * kernel];
+    const int8_t *w_1 = pair ? (w_0 + kernel) : w_0;
+    const int32_t oc_1 = pair ? (oc + 1) : oc;
+    const int32_t bias_0 = (bias != NULL) ? bias[oc] : 0;
+    const int32_t bias_1 = (bias != NULL) ? bias[oc_1] : 0;
+
+    for (oy = oy_first; oy < oy_last; oy++)
+    {
+      const int32_t iy0 = oy * conv_params->stride.h - conv_params->padding.h;
+      int8_t *out_row = &output[oy * output_dims->w * out_c];
+      int32_t ky_first, ky_last;
+
+      nn_tap_range(iy0, filter_dims->h, input_dims->h, &ky_first, &ky_last);
+
+      for (ox = 0; ox < output_dims->w; )
+      {
+        const int32_t ix0 = ox * stride_w - conv_params->padding.w;
+        int32_t acc[4] = { bias_0, bias_1, bias_0, bias_1 };
+        int32_t pixels = 1;
+
+        if (((ox + 1) < output_dims->w) && (ix0 >= 0) && ((ix0 + stride_w + filter_dims->w) <= input_dims->w))
+        {
+          /* Both pixels see the whole filter row */
+          for (ky = ky_first; ky < ky_last; ky++)
+          {
+            const int8_t *in = &rows[((iy0 + ky - row_base) * input_dims->w + ix0) * in_c];
+
+            nn_conv_block_2x2(in, in + stride_w * in_c, &w_0[ky * filter_dims->w * in_c],
+                              &w_1[ky * filter_dims->w * in_c], filter_dims->w * in_c,
+                              conv_params->input_offset, acc);
+          }
+          pixels = 2;
+        }
+        else
+        {
+          int32_t kx_first, kx_last;
+
+          nn_tap_range(ix0, filter_dims->w, input_dims->w, &kx_first, &kx_last);
+          for (ky = ky_first; (ky < ky_last) && (kx_last > kx_first); ky++)
+          {
+            nn_dot_s8_x2(&rows[((iy0 + ky - row_base) * input_dims->w + ix0 + kx_first) * in_c],
+                         &w_0[(ky * filter_dims->w + kx_first) * in_c],
+                         &w_1[(ky * filter_dims->w + kx_first) * in_c],
+                         (kx_last - kx_first) * in_c, conv_params->input_offset, &acc[0], &acc[1]);
+          }
+        }
+
+        /* Requantization and activation in the same pass */
+        out_row[ox * out_c + oc] = nn_output_s8(acc[0], quant_params->multiplier[oc], quant_params->shift[oc],
+                                                conv_params->output_offset, &conv_params->activation);
+        if (pair)
+        {
+          out_row[ox * out_c + oc_1] = nn_output_s8(acc[1], quant_params->multiplier[oc_1], quant_params->shift[oc_1],
+                                                    conv_params->output_offset, &conv_params->activation);
+        }
+        if (pixels == 2)
+        {
+          out_row[(ox + 1) * out_c + oc] = nn_output_s8(acc[2], quant_params->multiplier[oc], quant_params->shift[oc],
+                                                        conv_params->output_offset, &conv_params->activation);
+          if (pair)
+          {
+            out_row[(ox + 1) * out_c + oc_1] = nn_output_s8(acc[3], quant_params->multiplier[oc_1],
+                                                            quant_params->shift[oc_1],
+                                                            conv_params->output_offset, &conv_params->activation);
+          }
+        }
+        ox += pixels;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  2D convolution, NHWC input, OHWI filter, per-channel requantization.
+  * @param  ctx  Optional DTCM scratch. When the input is elsewhere, bands of
+  *              input rows are copied into it and the outputs depending on
+  *              them are computed before the next band; NULL computes
+  *              straight from the input.
+  * @note   No im2col buffer: padding taps are skipped (after the input offset
+  *         they are zero) and each in-bounds filter row is contiguous in both
+  *         tensors. Bias, requantization and the activation clamp are applied
+  *         to the register accumulators, so nothing but int8 outputs is
+  *         written.
+  */
+nn_status nn_conv2d_s8(const nn_context *ctx,
+                       const nn_conv_params *conv_params,
+                       const nn_per_channel_quant_params *quant_params,
+                       const nn_dims *input_dims, const int8_t *input,
+                       const nn_dims *filter_dims, const int8_t *filter,
+                       const int32_t *bias,
+                       const nn_dims *output_dims, int8_t *output)
+{
+  const int32_t row_bytes = input_dims->w * input_dims->c;
+  const int32_t in_size = input_dims->h * row_bytes;
+  const int32_t out_size = output_dims->h * output_dims->w * output_dims->c;
+  int32_t band = output_dims->h;
+  int32_t tile = 0;
+  int32_t b, oy;
+
+  if ((input_dims->c != filter_dims->c) || (output_dims->c != filter_dims->n) || (row_bytes <= 0))
+  {
+    return NN_ARG_ERROR;
+  }
+
+  if ((ctx != NULL) && (ctx->buf != NULL) && !NN_IN_DTCM(input))
+  {
+    const int32_t rows_fit = ctx->size / row_bytes;
+
+    if (rows_fit >= filter_dims->h)
+    {
+      band = NN_MIN((rows_fit - filter_dims->h) / conv_params->stride.h + 1, output_dims->h);
+      tile = 1;
+    }
+  }
+
+  for (b = 0; b < input_dims->n; b++)
+  {
+    const int8_t *in_batch = &input[b * in_size];
+    int8_t *out_batch = &output[b * out_size];
+
+    for (oy = 0; oy < output_dims->h; oy += band)
+    {
+      const int32_t oy_last = NN_MIN(oy + band, output_dims->h);
+      const int8_t *rows = in_batch;
+      int32_t row_base = 0;
+
+      if (tile)
+      {
+        const int32_t iy_first = NN_MAX(oy * conv_params->stride.h - conv_params->padding.h, 0);
+        const int32_t iy_last = NN_MIN((oy_last - 1) * conv_params->stride.h - conv_params->padding.h +
+                                       filter_dims->h, input_dims->h);
+
+        if (iy_last > iy_first)
+        {
+          memcpy(ctx->buf, &in_batch[iy_first * row_bytes], (size_t)((iy_last - iy_first) * row_bytes));
+        }
+        rows = ctx->buf;
+        row_base = iy_first;
+      }
+
+      nn_conv_band(conv_params, quant_params, input_dims, rows, row_base, filter_dims, filter, bias,
+                   output_dims, out_batch, oy, oy_last);
+    }
+  }
+
+  return NN_OK;
+}
+
+/**
+  * @brief  Depthwise convolution with channel multiplier 1, four channels per step.
+  * @note   One LDR per operand fetches four channels; SXTB16 unpacks them
+  *         into lanes (0, 2) and (1, 3) for 16x16 multiply-accumulates.
+  */
+static void nn_depthwise_conv2d_s8_mult1(const nn_dw_conv_params *dw_conv_params,
+                                         const nn_per_channel_quant_params *quant_params,
+                                         const nn_dims *input_dims, const int8_t *input,
+                                         const nn_dims *filter_dims, const int8_t *filter,
+                                         const int32_t *bias,
+                                         const nn_dims *output_dims, int8_t *output)
+{
+  const int32_t channels = input_dims->c;
+  const uint32_t offset = nn_pack_pair(dw_conv_params->input_offset);
+  int32_t oy, ox, c, ky, kx;
+
+  for (oy = 0; oy < output_dims->h; oy++)
+  {
+    const int32_t iy0 = oy * dw_conv_params->stride.h - dw_conv_params->padding.h;
+    int32_t ky_first, ky_last;
+
+    nn_tap_range(iy0, filter_dims->h, input_dims->h, &ky_first, &ky_last);
+
+    for (ox = 0; ox < output_dims->w; ox++)
+    {
+      const int32_t ix0 = ox * dw_conv_params->stride.w - dw_conv_params->padding.w;
+      int32_t kx_first, kx_last;
+
+      nn_tap_range(ix0, filter_dims->w, input_dims->w, &kx_first, &kx_last);
+
+      for (c = 0; c + 4 <= channels; c += 4)
+      {
+        int32_t acc[4] = { 0, 0, 0, 0 };
+        int32_t lane;
+
+        for (ky = ky_first; ky < ky_last; ky++)
+        {
+          for (kx = kx_first; kx < kx_last; kx++)
+          {
+            const uint32_t xv = nn_read_s8x4(&input[((iy0 + ky) * input_dims->w + ix0 + kx) * channels + c]);
+            const uint32_t wv = nn_read_s8x4(&filter[(ky * filter_dims->w + kx) * channels + c]);
+            const uint32_t x02 = nn_sadd16(nn_sxtb16(xv), offset);
+            const uint32_t x13 = nn_sadd16(nn_sxtb16_ror8(xv), offset);
+            const uint32_t w02 = nn_sxtb16(wv);
+            const uint32_t w13 = nn_sxtb16_ror8(wv);
+
+            acc[0] += nn_lo16(x02) * nn_lo16(w02);
+            acc[1] += nn_lo16(x13) * nn_lo16(w13);
+            acc[2] += nn_hi16(x02) * nn_hi16(w02);
+            acc[3] += nn_hi16(x13) * nn_hi16(w13);
+          }
+        }
+
+        for (lane = 0; lane < 4; lane++)
+        {
+          const int32_t oc = c + lane;
+
+          *output++ = nn_output_s8(acc[lane] + ((bias != NULL) ? bias[oc] : 0),
+                                   quant_params->multiplier[oc], quant_params->shift[oc],
+                                   dw_conv_params->output_offset, &dw_conv_params->activation);
+        }
+      }
+
+      for (; c < channels; c++)
+      {
+        int32_t acc = (bias != NULL) ? bias[c] : 0;
+
+        for (ky = ky_first; ky < ky_last; ky++)
+        {
+          for (kx = kx_first; kx < kx_last; kx++)
+          {
+            acc += ((int32_t)input[((iy0 + ky) * input_dims->w + ix0 + kx) * channels + c] + dw_conv_params->input_offset) *
+                   (int32_t)filter[(ky * filter_dims->w + kx) * channels + c];
+          }
+        }
+
+        *output++ = nn_output_s8(acc, quant_params->multiplier[c], quant_params->shift[c],
+                                 dw_conv_params->output_offset, &dw_conv_params->activation);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Depthwise convolution, filter 1HW(C*M), output channel ic * M + m.
+  */
+nn_status nn_depthwise_conv2d_s8(const nn_dw_conv_params *dw_conv_params,
+                                 const nn_per_channel_quant_params *quant_params,
+                                 const nn_dims *input_dims, const int8_t *input,
+                                 const nn_dims *filter_dims, const int8_t *filter,
+                                 const int32_t *bias,
+                                 const nn_dims *output_dims, int8_t *output)
+{
+  const int32_t ch_mult = dw_conv_params->ch_mult;
+  const int32_t in_size = input_dims->h * input_dims->w * input_dims->c;
+  const int32_t out_size = output_dims->h * output_dims->w * output_dims->c;
+  int32_t b, oy, ox, ic, m, ky, kx;
+
+  if ((ch_mult < 1) || (output_dims->c != input_dims->c * ch_mult) || (filter_dims->c != output_dims->c))
+  {
+    return NN_ARG_ERROR;
+  }
+
+  for (b = 0; b < input_dims->n; b++)
+  {
+    const int8_t *in_batch = &input[b * in_size];
+    int8_t *out = &output[b * out_size];
+
+    if (ch_mult == 1)
+    {
+      nn_depthwise_conv2d_s8_mult1(dw_conv_params, quant_params, input_dims, in_batch,
+                                   filter_dims, filter, bias, output_dims, out);
+      continue;
+    }
+
+    for (oy = 0; oy < output_dims->h; oy++)
+    {
+      const int32_t iy0 = oy * dw_conv_params->stride.h - dw_conv_params->padding.h;
+      int32_t ky_first, ky_last;
+
+      nn_tap_range(iy0, filter_dims->h, input_dims->h, &ky_first, &ky_last);
+
+      for (ox = 0; ox < output_dims->w; ox++)
+      {
+        const int32_t ix0 = ox * dw_conv_params->stride.w - dw_conv_params->padding.w;
+        int32_t kx_first, kx_last;
+
+        nn_tap_range(ix0, filter_dims->w, input_dims->w, &kx_first, &kx_last);
+
+        for (ic = 0; ic < input_dims->c; ic++)
+        {
+          for (m = 0; m < ch_mult; m++)
+          {
+            const int32_t oc = ic * ch_mult + m;
+            int32_t acc = (bias != NULL) ? bias[oc] : 0;
+
+            for (ky = ky_first; ky < ky_last; ky++)
+            {
+              for (kx = kx_first; kx < kx_last; kx++)
+              {
+                acc += ((int32_t)in_batch[((iy0 + ky) * input_dims->w + ix0 + kx) * input_dims->c + ic] +
+                        dw_conv_params->input_offset) *
+                       (int32_t)filter[(ky * filter_dims->w + kx) * filter_dims->c + oc];
+              }
+            }
+
+            *out++ = nn_output_s8(acc, quant_params->multiplier[oc], quant_params->shift[oc],
+                                  dw_conv_params->output_offset, &dw_conv_params->activation);
+          }
+        }
+      }
+    }
+  }
+
+  return NN_OK;
+}
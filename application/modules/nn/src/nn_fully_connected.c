@@ -0,0 +1,54 @@
+#include <stddef.h>
+
+#include "nn.h"
+#include "nn_math.h"
+
+/**
+  * @brief  Fully connected layer, weights [output][depth], per-tensor requantization.
+  */
+nn_status nn_fully_connected_s8(const nn_fc_params *fc_params,
+                                const nn_per_tensor_quant_params *quant_params,
+                                const nn_dims *input_dims, const int8_t *input,
+                                const nn_dims *filter_dims, const int8_t *filter,
+                                const int32_t *bias,
+                                const nn_dims *output_dims, int8_t *output)
+{
+  const int32_t depth = filter_dims->n;
+  const int32_t out_depth = output_dims->c;
+  int32_t b, o;
+
+  if (fc_params->filter_offset != 0)
+  {
+    return NN_NO_IMPL;
+  }
+
+  for (b = 0; b < input_dims->n; b++)
+  {
+    const int8_t *in = &input[b * depth];
+
+    for (o = 0; o + 2 <= out_depth; o += 2)
+    {
+      int32_t acc0 = (bias != NULL) ? bias[o] : 0;
+      int32_t acc1 = (bias != NULL) ? bias[o + 1] : 0;
+
+      nn_dot_s8_x2(in, &filter[o * depth], &filter[(o + 1) * depth], depth,
+                   fc_params->input_offset, &acc0, &acc1);
+
+      *output++ = nn_output_s8(acc0, quant_params->multiplier, quant_params->shift,
+                               fc_params->output_offset, &fc_params->activation);
+      *output++ = nn_output_s8(acc1, quant_params->multiplier, quant_params->shift,
+                               fc_params->output_offset, &fc_params->activation);
+    }
+
+    if (o < out_depth)
+    {
+      int32_t acc = nn_dot_s8(in, &filter[o * depth], depth, fc_params->input_offset,
+                              (bias != NULL) ? bias[o] : 0);
+
+      *output++ = nn_output_s8(acc, quant_params->multiplier, quant_params->shift,
+                               fc_params->output_offset, &fc_params->activation);
+    }
+  }
+
+  return NN_OK;
+}
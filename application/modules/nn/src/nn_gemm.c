@@ -0,0 +1,278 @@
+#include <stddef.h>
+
+#include "nn_gemm.h"
+#include "nn_math.h"
+
+/* Pair words per row or channel: two for each group of four k */
+static int32_t nn_gemm_pairs(int32_t k)
+{
+  return ((k + 3) / 4) * 2;
+}
+
+int32_t nn_gemm_packed_size(int32_t n, int32_t k)
+{
+  return n * nn_gemm_pairs(k) * (int32_t)sizeof(uint32_t);
+}
+
+int32_t nn_gemm_scratch_size(int32_t k)
+{
+  return NN_GEMM_MR * nn_gemm_pairs(k) * (int32_t)sizeof(uint32_t);
+}
+
+/* Four values of a row starting at k, zero past the end */
+static uint32_t nn_gemm_read_s8x4(const int8_t *row, int32_t k, int32_t depth)
+{
+  uint32_t word = 0U;
+  int32_t i;
+
+  if (k + 4 <= depth)
+  {
+    return nn_read_s8x4(&row[k]);
+  }
+  for (i = 0; k + i < depth; i++)
+  {
+    word |= (uint32_t)(uint8_t)row[k + i] << (8 * i);
+  }
+  return word;
+}
+
+/**
+  * @brief  Pack [n][k] weights: per panel of NN_GEMM_NR channels (the last
+  *         one narrower when n is odd), for each pair slot, one word per channel.
+  */
+nn_status nn_gemm_pack_weights_s8(const int8_t *weights, int32_t n, int32_t k, uint32_t *packed)
+{
+  int32_t n0, c, kk;
+
+  if ((n <= 0) || (k <= 0) || (weights == NULL) || (packed == NULL))
+  {
+    return NN_ARG_ERROR;
+  }
+
+  for (n0 = 0; n0 < n; n0 += NN_GEMM_NR)
+  {
+    const int32_t nr = NN_MIN(NN_GEMM_NR, n - n0);
+
+    for (kk = 0; kk < k; kk += 4)
+    {
+      for (c = 0; c < nr; c++)
+      {
+        packed[c] = nn_sxtb16(nn_gemm_read_s8x4(&weights[(n0 + c) * k], kk, k));
+        packed[nr + c] = nn_sxtb16_ror8(nn_gemm_read_s8x4(&weights[(n0 + c) * k], kk, k));
+      }
+      packed += 2 * nr;
+    }
+  }
+
+  return NN_OK;
+}
+
+/* mr input rows, offset added, interleaved like the weights (padding k are multiplied by 0) */
+static void nn_gemm_pack_input(const int8_t *input, int32_t mr, int32_t k, int32_t input_offset, uint32_t *packed)
+{
+  const uint32_t offset = nn_pack_pair(input_offset);
+  int32_t r, kk;
+
+  for (kk = 0; kk < k; kk += 4)
+  {
+    for (r = 0; r < mr; r++)
+    {
+      const uint32_t word = nn_gemm_read_s8x4(&input[r * k], kk, k);
+
+      packed[r] = nn_sadd16(nn_sxtb16(word), offset);
+      packed[mr + r] = nn_sadd16(nn_sxtb16_ror8(word), offset);
+    }
+    packed += 2 * mr;
+  }
+}
+
+/**
+  * @brief  4 rows by 2 channels: 8 accumulators; each pair slot is six loads
+  *         and eight SMLADs (16 MACs).
+  */
+static void nn_gemm_kernel_4x2(const uint32_t *a, const uint32_t *b, int32_t groups, int32_t acc[8])
+{
+  int32_t c00 = acc[0], c01 = acc[1];
+  int32_t c10 = acc[2], c11 = acc[3];
+  int32_t c20 = acc[4], c21 = acc[5];
+  int32_t c30 = acc[6], c31 = acc[7];
+  int32_t half;
+
+  while (groups > 0)
+  {
+    for (half = 0; half < 2; half++)
+    {
+      const uint32_t b0 = b[0];
+      const uint32_t b1 = b[1];
+      const uint32_t a0 = a[0];
+      const uint32_t a1 = a[1];
+      const uint32_t a2 = a[2];
+      const uint32_t a3 = a[3];
+
+      c00 = nn_smlad(a0, b0, c00);
+      c01 = nn_smlad(a0, b1, c01);
+      c10 = nn_smlad(a1, b0, c10);
+      c11 = nn_smlad(a1, b1, c11);
+      c20 = nn_smlad(a2, b0, c20);
+      c21 = nn_smlad(a2, b1, c21);
+      c30 = nn_smlad(a3, b0, c30);
+      c31 = nn_smlad(a3, b1, c31);
+      a += 4;
+      b += 2;
+    }
+    groups--;
+  }
+
+  acc[0] = c00; acc[1] = c01;
+  acc[2] = c10; acc[3] = c11;
+  acc[4] = c20; acc[5] = c21;
+  acc[6] = c30; acc[7] = c31;
+}
+
+/**
+  * @brief  2 rows by 2 channels, for the last rows when M is not a multiple of 4.
+  */
+static void nn_gemm_kernel_2x2(const uint32_t *a, const uint32_t *b, int32_t groups, int32_t acc[4])
+{
+  int32_t c00 = acc[0], c01 = acc[1];
+  int32_t c10 = acc[2], c11 = acc[3];
+  int32_t pairs = groups * 2;
+
+  while (pairs > 0)
+  {
+    const uint32_t b0 = b[0];
+    const uint32_t b1 = b[1];
+    const uint32_t a0 = a[0];
+    const uint32_t a1 = a[1];
+
+    c00 = nn_smlad(a0, b0, c00);
+    c01 = nn_smlad(a0, b1, c01);
+    c10 = nn_smlad(a1, b0, c10);
+    c11 = nn_smlad(a1, b1, c11);
+    a += 2;
+    b += 2;
+    pairs--;
+  }
+
+  acc[0] = c00; acc[1] = c01;
+  acc[2] = c10; acc[3] = c11;
+}
+
+/**
+  * @brief  Any mr <= NN_GEMM_MR by nr <= NN_GEMM_NR: the single remaining row
+  *         and the odd last channel.
+  */
+static void nn_gemm_kernel_edge(const uint32_t *a, int32_t mr, const uint32_t *b, int32_t nr, int32_t groups,
+                                int32_t acc[NN_GEMM_MR * NN_GEMM_NR])
+{
+  int32_t pairs = groups * 2;
+  int32_t r, c;
+
+  while (pairs > 0)
+  {
+    for (r = 0; r < mr; r++)
+    {
+      for (c = 0; c < nr; c++)
+      {
+        acc[r * nr + c] = nn_smlad(a[r], b[c], acc[r * nr + c]);
+      }
+    }
+    a += mr;
+    b += nr;
+    pairs--;
+  }
+}
+
+/**
+  * @brief  Output channels n0 .. n0 + nr - 1 of mr rows from one packed input panel.
+  */
+static void nn_gemm_block(const nn_fc_params *fc_params, const nn_per_channel_quant_params *quant_params,
+                          int32_t mr, int32_t nr, int32_t n0, int32_t n, int32_t groups,
+                          const uint32_t *a, const uint32_t *b, const int32_t *bias, int8_t *output)
+{
+  int32_t acc[NN_GEMM_MR * NN_GEMM_NR];
+  int32_t r, c;
+
+  for (r = 0; r < mr; r++)
+  {
+    for (c = 0; c < nr; c++)
+    {
+      acc[r * nr + c] = (bias != NULL) ? bias[n0 + c] : 0;
+    }
+  }
+
+  if ((mr == 4) && (nr == 2))
+  {
+    nn_gemm_kernel_4x2(a, b, groups, acc);
+  }
+  else if ((mr == 2) && (nr == 2))
+  {
+    nn_gemm_kernel_2x2(a, b, groups, acc);
+  }
+  else
+  {
+    nn_gemm_kernel_edge(a, mr, b, nr, groups, acc);
+  }
+
+  for (r = 0; r < mr; r++)
+  {
+    for (c = 0; c < nr; c++)
+    {
+      output[r * n + n0 + c] = nn_output_s8(acc[r * nr + c], quant_params->multiplier[n0 + c],
+                                            quant_params->shift[n0 + c], fc_params->output_offset,
+                                            &fc_params->activation);
+    }
+  }
+}
+
+/**
+  * @brief  Register-blocked int8 GEMM on weights packed by nn_gemm_pack_weights_s8().
+  * @param  ctx  Scratch of at least nn_gemm_scratch_size(k) bytes, 4-byte aligned,
+  *              for one packed panel of input rows.
+  * @note   Rows go in panels of 4, then 2, then 1; each panel is packed once
+  *         and swept across every channel panel, so the input is unpacked M
+  *         times in total rather than M * N / 2.
+  */
+nn_status nn_gemm_s8(const nn_context *ctx,
+                     const nn_fc_params *fc_params,
+                     const nn_per_channel_quant_params *quant_params,
+                     int32_t m, int32_t n, int32_t k,
+                     const int8_t *input, const uint32_t *packed_weights,
+                     const int32_t *bias, int8_t *output)
+{
+  const int32_t groups = (k + 3) / 4;
+  const int32_t pairs = nn_gemm_pairs(k);
+  int32_t m0, n0;
+
+  if ((m <= 0) || (n <= 0) || (k <= 0))
+  {
+    return NN_ARG_ERROR;
+  }
+  if ((ctx == NULL) || (ctx->buf == NULL) || (ctx->size < nn_gemm_scratch_size(k)))
+  {
+    return NN_ARG_ERROR;
+  }
+  if (fc_params->filter_offset != 0)
+  {
+    return NN_NO_IMPL;
+  }
+
+  for (m0 = 0; m0 < m; )
+  {
+    const int32_t mr = (m - m0 >= 4) ? 4 : ((m - m0 >= 2) ? 2 : 1);
+    const uint32_t *b = packed_weights;
+
+    nn_gemm_pack_input(&input[m0 * k], mr, k, fc_params->input_offset, ctx->buf);
+
+    for (n0 = 0; n0 < n; n0 += NN_GEMM_NR)
+    {
+      const int32_t nr = NN_MIN(NN_GEMM_NR, n - n0);
+
+      nn_gemm_block(fc_params, quant_params, mr, nr, n0, n, groups, ctx->buf, b, bias, &output[m0 * n]);
+      b += nr * pairs;
+    }
+    m0 += mr;
+  }
+
+  return NN_OK;
+}
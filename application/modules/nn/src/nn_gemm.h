@@ -0,0 +1,50 @@
+#ifndef NN_GEMM_H
+#define NN_GEMM_H
+
+#include <stdint.h>
+
+#include "nn_types.h"
+
+/*
+ * int8 GEMM: output[M][N] = requantize(bias[N] + (input[M][K] + input_offset)
+ * x weights[N][K]^T), per output channel (column) multiplier and shift. This
+ * is a fully connected layer over M input rows (batch, or pixels of a 1x1
+ * convolution) with per-channel quantization.
+ *
+ * Both operands are packed into 16-bit pairs ready for SMLAD:
+ *  - weights once, ahead of time, by nn_gemm_pack_weights_s8(): panels of
+ *    NN_GEMM_NR output channels, K padded to a multiple of 4;
+ *  - input rows per call, NN_GEMM_MR at a time, into the ctx scratch, with
+ *    the input offset already added.
+ * Within each group of four k the pairs are (k0, k2) then (k1, k3), the
+ * order SXTB16 produces, so packing the input is one SXTB16 and one SADD16
+ * per pair. The micro-kernels then do nothing but loads and SMLADs: the
+ * 4x2 kernel keeps eight accumulators in registers and does 16 MACs per
+ * six loads. Row and column remainders go through 2x2 and edge kernels, so
+ * any M, N and K work.
+ *
+ * nn_ref_gemm_s8() (nn_ref.h) is the same operation on unpacked weights;
+ * the two agree bit for bit.
+ */
+
+#define NN_GEMM_MR    4   /*!< Input rows per micro-kernel */
+#define NN_GEMM_NR    2   /*!< Output channels per micro-kernel */
+
+/* Bytes of packed weights for n output channels of depth k */
+int32_t nn_gemm_packed_size(int32_t n, int32_t k);
+
+/* Bytes of ctx scratch nn_gemm_s8() needs for depth k (ideally DTCM) */
+int32_t nn_gemm_scratch_size(int32_t k);
+
+/* weights is [n][k]; packed must be 4-byte aligned and nn_gemm_packed_size() long */
+nn_status nn_gemm_pack_weights_s8(const int8_t *weights, int32_t n, int32_t k, uint32_t *packed);
+
+/* fc_params->filter_offset must be 0; bias may be NULL */
+nn_status nn_gemm_s8(const nn_context *ctx,
+                     const nn_fc_params *fc_params,
+                     const nn_per_channel_quant_params *quant_params,
+                     int32_t m, int32_t n, int32_t k,
+                     const int8_t *input, const uint32_t *packed_weights,
+                     const int32_t *bias, int8_t *output);
+
+#endif /* NN_GEMM_H */
@@ -0,0 +1,329 @@
+#ifndef NN_MATH_H
+#define NN_MATH_H
+
+#include <stdint.h>
+
+#include "nn_types.h"
+
+/*
+ * Fixed-point helpers and SIMD wrappers for the int8 kernels.
+ *
+ * On a core with the DSP extension the nn_ wrappers map onto the CMSIS
+ * intrinsics (SXTB16, SADD16, SMLAD, SSAT, SSUB8/SEL). Elsewhere they are
+ * plain C with identical results, so the optimized kernels also build on a
+ * host and can be compared bit for bit with nn_ref.
+ */
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define NN_USE_DSP    1
+#include "cmsis_compiler.h"
+#else
+#define NN_USE_DSP    0
+#endif
+
+#define NN_Q31_MAX    ((int32_t)0x7FFFFFFF)
+#define NN_Q31_MIN    ((int32_t)0x80000000)
+
+#define NN_MAX(a, b)  (((a) > (b)) ? (a) : (b))
+#define NN_MIN(a, b)  (((a) < (b)) ? (a) : (b))
+
+typedef uint32_t __attribute__((may_alias, aligned(1))) nn_u32_unaligned;
+
+/* Four int8 values as one word; LDR handles the misalignment on the M7 */
+static inline uint32_t nn_read_s8x4(const int8_t *ptr)
+{
+  return *(const nn_u32_unaligned *)ptr;
+}
+
+static inline void nn_write_s8x4(int8_t *ptr, uint32_t value)
+{
+  *(nn_u32_unaligned *)ptr = value;
+}
+
+static inline int32_t nn_lo16(uint32_t pair)
+{
+  return (int16_t)pair;
+}
+
+static inline int32_t nn_hi16(uint32_t pair)
+{
+  return (int16_t)(pair >> 16);
+}
+
+#if NN_USE_DSP
+
+static inline uint32_t nn_sxtb16(uint32_t x)               { return __SXTB16(x); }
+static inline uint32_t nn_sxtb16_ror8(uint32_t x)          { return __SXTB16(__ROR(x, 8U)); }
+static inline uint32_t nn_sadd16(uint32_t a, uint32_t b)   { return __SADD16(a, b); }
+static inline int32_t  nn_smlad(uint32_t a, uint32_t b, int32_t acc)
+{
+  return (int32_t)__SMLAD(a, b, (uint32_t)acc);
+}
+static inline int32_t  nn_ssat8(int32_t x)                 { return __SSAT(x, 8); }
+
+/* Lane-wise signed byte maximum: SSUB8 sets GE per byte, SEL picks by it */
+static inline uint32_t nn_max_s8x4(uint32_t a, uint32_t b)
+{
+  (void)__SSUB8(a, b);
+  return __SEL(a, b);
+}
+
+#else
+
+static inline uint32_t nn_sxtb16(uint32_t x)
+{
+  return ((uint32_t)(uint16_t)(int16_t)(int8_t)x) | ((uint32_t)(uint16_t)(int16_t)(int8_t)(x >> 16) << 16);
+}
+
+static inline uint32_t nn_sxtb16_ror8(uint32_t x)
+{
+  return nn_sxtb16((x >> 8) | (x << 24));
+}
+
+static inline uint32_t nn_sadd16(uint32_t a, uint32_t b)
+{
+  return ((a + b) & 0x0000FFFFU) | (((a >> 16) + (b >> 16)) << 16);
+}
+
+static inline int32_t nn_smlad(uint32_t a, uint32_t b, int32_t acc)
+{
+  return acc + nn_lo16(a) * nn_lo16(b) + nn_hi16(a) * nn_hi16(b);
+}
+
+static inline int32_t nn_ssat8(int32_t x)
+{
+  return NN_MIN(NN_MAX(x, -128), 127);
+}
+
+static inline uint32_t nn_max_s8x4(uint32_t a, uint32_t b)
+{
+  uint32_t result = 0U;
+  uint32_t lane;
+
+  for (lane = 0U; lane < 32U; lane += 8U)
+  {
+    int8_t x = (int8_t)(a >> lane);
+    int8_t y = (int8_t)(b >> lane);
+
+    result |= (uint32_t)(uint8_t)NN_MAX(x, y) << lane;
+  }
+  return result;
+}
+
+#endif /* NN_USE_DSP */
+
+/* Both halfwords set to a 16-bit value, for SADD16 of an offset */
+static inline uint32_t nn_pack_pair(int32_t value)
+{
+  return ((uint32_t)value & 0xFFFFU) * 0x00010001U;
+}
+
+/**
+  * @brief  acc + sum((x[i] + x_offset) * w[i]), four MACs per SMLAD pair.
+  * @note   SXTB16 splits a word into lanes (0, 2) and, after ROR 8, (1, 3);
+  *         both operands are split the same way so the pairing still matches.
+  */
+static inline int32_t nn_dot_s8(const int8_t *x, const int8_t *w, int32_t len, int32_t x_offset, int32_t acc)
+{
+  const uint32_t offset = nn_pack_pair(x_offset);
+
+  while (len >= 4)
+  {
+    const uint32_t xv = nn_read_s8x4(x);
+    const uint32_t wv = nn_read_s8x4(w);
+
+    acc = nn_smlad(nn_sadd16(nn_sxtb16(xv), offset), nn_sxtb16(wv), acc);
+    acc = nn_smlad(nn_sadd16(nn_sxtb16_ror8(xv), offset), nn_sxtb16_ror8(wv), acc);
+    x += 4;
+    w += 4;
+    len -= 4;
+  }
+
+  while (len > 0)
+  {
+    acc += ((int32_t)*x++ + x_offset) * (int32_t)*w++;
+    len--;
+  }
+
+  return acc;
+}
+
+/**
+  * @brief  Two weight rows against one input vector; the input is unpacked once.
+  */
+static inline void nn_dot_s8_x2(const int8_t *x, const int8_t *w0, const int8_t *w1, int32_t len,
+                                int32_t x_offset, int32_t *acc0, int32_t *acc1)
+{
+  const uint32_t offset = nn_pack_pair(x_offset);
+  int32_t sum0 = *acc0;
+  int32_t sum1 = *acc1;
+
+  while (len >= 4)
+  {
+    const uint32_t xv = nn_read_s8x4(x);
+    const uint32_t x02 = nn_sadd16(nn_sxtb16(xv), offset);
+    const uint32_t x13 = nn_sadd16(nn_sxtb16_ror8(xv), offset);
+    const uint32_t wv0 = nn_read_s8x4(w0);
+    const uint32_t wv1 = nn_read_s8x4(w1);
+
+    sum0 = nn_smlad(x02, nn_sxtb16(wv0), sum0);
+    sum0 = nn_smlad(x13, nn_sxtb16_ror8(wv0), sum0);
+    sum1 = nn_smlad(x02, nn_sxtb16(wv1), sum1);
+    sum1 = nn_smlad(x13, nn_sxtb16_ror8(wv1), sum1);
+    x += 4;
+    w0 += 4;
+    w1 += 4;
+    len -= 4;
+  }
+
+  while (len > 0)
+  {
+    const int32_t xs = (int32_t)*x++ + x_offset;
+
+    sum0 += xs * (int32_t)*w0++;
+    sum1 += xs * (int32_t)*w1++;
+    len--;
+  }
+
+  *acc0 = sum0;
+  *acc1 = sum1;
+}
+
+/**
+  * @brief  Rounding doubling high multiply, (a * b * 2) >> 32 rounded (gemmlowp).
+  */
+static inline int32_t nn_doubling_high_mult(int32_t a, int32_t b)
+{
+  int64_t mult = 1 << 30;
+
+  if ((a < 0) != (b < 0))
+  {
+    mult = 1 - mult;
+  }
+  mult += (int64_t)a * b;
+
+  if ((a == NN_Q31_MIN) && (b == NN_Q31_MIN))
+  {
+    return NN_Q31_MAX;
+  }
+  return (int32_t)(mult / ((int64_t)1 << 31));
+}
+
+/**
+  * @brief  Arithmetic right shift rounding half away from zero.
+  */
+static inline int32_t nn_divide_by_power_of_two(int32_t dividend, int32_t exponent)
+{
+  const int32_t remainder_mask = (int32_t)((1U << exponent) - 1U);
+  const int32_t remainder = remainder_mask & dividend;
+  int32_t result = dividend >> exponent;
+  int32_t threshold = remainder_mask >> 1;
+
+  if (result < 0)
+  {
+    threshold++;
+  }
+  if (remainder > threshold)
+  {
+    result++;
+  }
+  return result;
+}
+
+/**
+  * @brief  Saturating left shift by a constant exponent.
+  */
+static inline int32_t nn_mult_by_power_of_two(int32_t value, int32_t exponent)
+{
+  const int32_t threshold = (int32_t)((1U << (31 - exponent)) - 1U);
+
+  if (value > threshold)
+  {
+    return NN_Q31_MAX;
+  }
+  if (value < -threshold)
+  {
+    return NN_Q31_MIN;
+  }
+  return (int32_t)((uint32_t)value << exponent);
+}
+
+/**
+  * @brief  value * multiplier * 2^shift with TFLite double rounding.
+  */
+static inline int32_t nn_requantize(int32_t value, int32_t multiplier, int32_t shift)
+{
+  const int32_t left = (shift > 0) ? shift : 0;
+  const int32_t right = (shift > 0) ? 0 : -shift;
+
+  return nn_divide_by_power_of_two(nn_doubling_high_mult((int32_t)((uint32_t)value << left), multiplier), right);
+}
+
+/* Branch-free select used by the gemmlowp exp/reciprocal below */
+#define NN_MASK_IF_NON_ZERO(x)          (((x) != 0) ? ~0 : 0)
+#define NN_MASK_IF_ZERO(x)              (((x) == 0) ? ~0 : 0)
+#define NN_SELECT_USING_MASK(m, a, b)   (((m) & (a)) ^ (~(m) & (b)))
+
+/**
+  * @brief  exp(x) for x <= 0; input Q5.26, output Q0.31 (gemmlowp).
+  */
+static inline int32_t nn_exp_on_negative_values(int32_t value)
+{
+  static const int32_t constant[7] = { 1672461947, 1302514674, 790015084, 290630308, 39332535, 720401, 242 };
+  const int32_t value_mod_minus_quarter = (value & ((1 << 24) - 1)) - (1 << 24);
+  const int32_t remainder = value_mod_minus_quarter - value;
+  const int32_t x = (int32_t)((uint32_t)value_mod_minus_quarter << 5) + (1 << 28);
+  const int32_t x2 = nn_doubling_high_mult(x, x);
+  int32_t result;
+  int32_t i;
+
+  /* exp(-1/4 + x) on [-1/4, 0) as a Taylor series around -1/8 */
+  result = nn_doubling_high_mult(nn_divide_by_power_of_two(nn_doubling_high_mult(x2, x2), 2) +
+                                 nn_doubling_high_mult(x2, x), 715827883) + x2;
+  result = 1895147668 + nn_doubling_high_mult(1895147668, x + nn_divide_by_power_of_two(result, 1));
+
+  /* Whole multiples of 1/4 by table lookup: exp(-1/4), exp(-1/2), ... exp(-16) */
+  for (i = 0; i < 7; i++)
+  {
+    const int32_t mask = NN_MASK_IF_NON_ZERO(remainder & (1 << (24 + i)));
+
+    result = NN_SELECT_USING_MASK(mask, nn_doubling_high_mult(result, constant[i]), result);
+  }
+
+  return NN_SELECT_USING_MASK(NN_MASK_IF_ZERO(value), NN_Q31_MAX, result);
+}
+
+/**
+  * @brief  1 / (1 + x) for x in [0, 1); input Q0.31, output Q2.29 (gemmlowp).
+  */
+static inline int32_t nn_one_over_one_plus_x_for_x_in_0_1(int32_t value)
+{
+  const int64_t sum = (int64_t)value + NN_Q31_MAX;
+  const int32_t half_denominator = (int32_t)((sum + ((sum >= 0) ? 1 : -1)) / 2);
+  const int32_t one = 1 << 29;
+  int32_t x = 1515870810 + nn_doubling_high_mult(half_denominator, -1010580540);
+  int32_t i;
+
+  /* Three Newton-Raphson steps */
+  for (i = 0; i < 3; i++)
+  {
+    x += nn_mult_by_power_of_two(nn_doubling_high_mult(x, one - nn_doubling_high_mult(half_denominator, x)), 2);
+  }
+
+  return nn_mult_by_power_of_two(x, 1);
+}
+
+/**
+  * @brief  Requantized accumulator to an int8 output, offset and clamped.
+  */
+static inline int8_t nn_output_s8(int32_t acc, int32_t multiplier, int32_t shift, int32_t offset,
+                                  const nn_activation *activation)
+{
+  int32_t out = nn_ssat8(nn_requantize(acc, multiplier, shift) + offset);
+
+  out = NN_MAX(out, activation->min);
+  out = NN_MIN(out, activation->max);
+  return (int8_t)out;
+}
+
+#endif /* NN_MATH_H */
@@ -0,0 +1,230 @@
+#include <stddef.h>
+#include <stdio.h>
+
+#include "nn.h"
+#include "nn_model.h"
+
+#if defined(__arm__)
+#include "perf.h"
+#define NN_CYCLES()          PERF_Cycles()
+#define NN_ELAPSED(start)    PERF_Elapsed(start)
+#else
+#define NN_CYCLES()          0U
+#define NN_ELAPSED(start)    ((void)(start), 0U)
+#endif
+
+static const char *const nn_op_names[NN_OP_COUNT] =
+{
+  "conv2d",
+  "dw_conv2d",
+  "fully_conn",
+  "max_pool",
+  "avg_pool",
+  "softmax",
+  "add",
+};
+
+const char *nn_op_name(nn_op op)
+{
+  return ((uint32_t)op < NN_OP_COUNT) ? nn_op_names[op] : "?";
+}
+
+static int32_t nn_dims_count(const nn_dims *dims)
+{
+  return dims->n * dims->h * dims->w * dims->c;
+}
+
+static nn_status nn_layer_invoke(const nn_model *model, const nn_layer *layer, const nn_tensor *in, const nn_tensor *in_2,
+                                 nn_tensor *out)
+{
+  switch (layer->op)
+  {
+    case NN_OP_CONV2D:
+    {
+      const nn_conv_layer *p = layer->params;
+
+      return nn_conv2d_s8(&model->scratch, &p->conv, &p->quant, &in->dims, in->data, &p->filter_dims, p->filter,
+                          p->bias, &out->dims, out->data);
+    }
+
+    case NN_OP_DEPTHWISE_CONV2D:
+    {
+      const nn_dw_conv_layer *p = layer->params;
+
+      return nn_depthwise_conv2d_s8(&p->conv, &p->quant, &in->dims, in->data, &p->filter_dims, p->filter,
+                                    p->bias, &out->dims, out->data);
+    }
+
+    case NN_OP_FULLY_CONNECTED:
+    {
+      const nn_fc_layer *p = layer->params;
+
+      return nn_fully_connected_s8(&p->fc, &p->quant, &in->dims, in->data, &p->filter_dims, p->filter,
+                                   p->bias, &out->dims, out->data);
+    }
+
+    case NN_OP_MAX_POOL:
+    {
+      const nn_pool_layer *p = layer->params;
+
+      return nn_max_pool_s8(&p->pool, &in->dims, in->data, &p->filter_dims, &out->dims, out->data);
+    }
+
+    case NN_OP_AVG_POOL:
+    {
+      const nn_pool_layer *p = layer->params;
+
+      return nn_avg_pool_s8(&p->pool, &in->dims, in->data, &p->filter_dims, &out->dims, out->data);
+    }
+
+    case NN_OP_SOFTMAX:
+      return nn_softmax_s8(layer->params, in->data, in->dims.n * in->dims.h * in->dims.w, in->dims.c, out->data);
+
+    case NN_OP_ADD:
+      if ((in_2 == NULL) || (nn_dims_count(&in->dims) != nn_dims_count(&in_2->dims)))
+      {
+        return NN_ARG_ERROR;
+      }
+      return nn_add_s8(layer->params, in->data, in_2->data, nn_dims_count(&out->dims), out->data);
+
+    default:
+      return NN_NO_IMPL;
+  }
+}
+
+/**
+  * @brief  Checks @p layer's operands against the model's tensor table and runs it.
+  * @note   @p layer need not be one of model->layers: the pipelined runner passes a
+  *         copy whose parameters point at weights staged in DTCM.
+  */
+nn_status nn_model_run_layer(const nn_model *model, const nn_layer *layer)
+{
+  const nn_tensor *in_2 = NULL;
+
+  if ((layer->input >= model->tensor_count) || (layer->output >= model->tensor_count) ||
+      (model->tensors[layer->input].data == NULL) || (model->tensors[layer->output].data == NULL))
+  {
+    return NN_ARG_ERROR;
+  }
+  if (layer->op == NN_OP_ADD)
+  {
+    if (layer->input_2 >= model->tensor_count)
+    {
+      return NN_ARG_ERROR;
+    }
+    in_2 = &model->tensors[layer->input_2];
+  }
+
+  return nn_layer_invoke(model, layer, &model->tensors[layer->input], in_2, &model->tensors[layer->output]);
+}
+
+/**
+  * @brief  Weight array of @p layer and its size in bytes.
+  * @retval 0 (and *weights NULL) for ops without weights.
+  */
+uint32_t nn_layer_weights(const nn_model *model, const nn_layer *layer, const int8_t **weights)
+{
+  switch (layer->op)
+  {
+    case NN_OP_CONV2D:
+    {
+      const nn_conv_layer *p = layer->params;
+
+      *weights = p->filter;
+      return (uint32_t)nn_dims_count(&p->filter_dims);
+    }
+
+    case NN_OP_DEPTHWISE_CONV2D:
+    {
+      const nn_dw_conv_layer *p = layer->params;
+
+      *weights = p->filter;
+      return (uint32_t)(p->filter_dims.h * p->filter_dims.w * p->filter_dims.c);
+    }
+
+    case NN_OP_FULLY_CONNECTED:
+    {
+      const nn_fc_layer *p = layer->params;
+
+      if (layer->output >= model->tensor_count)
+      {
+        break;
+      }
+      *weights = p->filter;
+      return (uint32_t)(p->filter_dims.n * model->tensors[layer->output].dims.c);
+    }
+
+    default:
+      break;
+  }
+
+  *weights = NULL;
+  return 0U;
+}
+
+/**
+  * @brief  Lends @p size bytes at @p buf (ideally DTCM) to the layers as kernel
+  *         scratch; NULL or 0 leaves the model without one.
+  */
+void nn_model_set_scratch(nn_model *model, void *buf, int32_t size)
+{
+  model->scratch.buf = ((buf != NULL) && (size > 0)) ? buf : NULL;
+  model->scratch.size = (model->scratch.buf != NULL) ? size : 0;
+}
+
+/**
+  * @brief  Runs every layer in order, recording its cycle count if requested.
+  * @retval NN_OK, or the first failing layer's status.
+  */
+nn_status nn_model_invoke(nn_model *model)
+{
+  uint32_t i;
+
+  for (i = 0U; i < model->layer_count; i++)
+  {
+    nn_status status;
+    uint32_t start;
+
+    start = NN_CYCLES();
+    status = nn_model_run_layer(model, &model->layers[i]);
+    if (model->cycles != NULL)
+    {
+      model->cycles[i] = NN_ELAPSED(start);
+    }
+
+    if (status != NN_OK)
+    {
+      return status;
+    }
+  }
+
+  return NN_OK;
+}
+
+/**
+  * @brief  Per-layer cycles and share of the total from the last invoke.
+  */
+void nn_model_print_profile(const nn_model *model)
+{
+  uint64_t total = 0U;
+  uint32_t i;
+
+  if (model->cycles == NULL)
+  {
+    return;
+  }
+
+  for (i = 0U; i < model->layer_count; i++)
+  {
+    total += model->cycles[i];
+  }
+
+  printf("nn: %u layers, %lu cycles\n", (unsigned)model->layer_count, (unsigned long)total);
+  for (i = 0U; i < model->layer_count; i++)
+  {
+    const uint32_t share = (total != 0U) ? (uint32_t)(((uint64_t)model->cycles[i] * 1000U) / total) : 0U;
+
+    printf("  %2lu %-10s %10lu %3lu.%lu%%\n", (unsigned long)i, nn_op_name(model->layers[i].op),
+           (unsigned long)model->cycles[i], (unsigned long)(share / 10U), (unsigned long)(share % 10U));
+  }
+}
@@ -0,0 +1,98 @@
+#ifndef NN_MODEL_H
+#define NN_MODEL_H
+
+#include <stdint.h>
+
+#include "nn_types.h"
+
+/*
+ * A model is a flat list of layers run in order. Layers name their operands
+ * by index into the tensor table; the tensor data pointers are set by the
+ * caller before nn_model_invoke(). Layer parameters, including weights,
+ * are const and can live in flash.
+ *
+ * The scratch is lent to the kernels that can use one: conv2d copies bands
+ * of an input outside DTCM into it. Attach a DTCM buffer with
+ * nn_model_set_scratch(), or leave it empty to compute in place.
+ */
+
+typedef enum
+{
+  NN_OP_CONV2D,
+  NN_OP_DEPTHWISE_CONV2D,
+  NN_OP_FULLY_CONNECTED,
+  NN_OP_MAX_POOL,
+  NN_OP_AVG_POOL,
+  NN_OP_SOFTMAX,     /*!< Rows are n*h*w, row size c */
+  NN_OP_ADD,
+  NN_OP_COUNT
+} nn_op;
+
+typedef struct
+{
+  nn_dims dims;
+  int8_t  *data;
+} nn_tensor;
+
+typedef struct
+{
+  nn_conv_params              conv;
+  nn_per_channel_quant_params quant;
+  nn_dims                     filter_dims;
+  const int8_t                *filter;
+  const int32_t               *bias;
+} nn_conv_layer;
+
+typedef struct
+{
+  nn_dw_conv_params           conv;
+  nn_per_channel_quant_params quant;
+  nn_dims                     filter_dims;
+  const int8_t                *filter;
+  const int32_t               *bias;
+} nn_dw_conv_layer;
+
+typedef struct
+{
+  nn_fc_params                fc;
+  nn_per_tensor_quant_params  quant;
+  nn_dims                     filter_dims;
+  const int8_t                *filter;
+  const int32_t               *bias;
+} nn_fc_layer;
+
+typedef struct
+{
+  nn_pool_params              pool;
+  nn_dims                     filter_dims;
+} nn_pool_layer;
+
+typedef struct
+{
+  nn_op      op;
+  uint16_t   input;
+  uint16_t   input_2;   /*!< NN_OP_ADD only */
+  uint16_t   output;
+  const void *params;   /*!< nn_conv_layer, nn_dw_conv_layer, nn_fc_layer, nn_pool_layer,
+                             nn_softmax_params or nn_add_params, by op */
+} nn_layer;
+
+typedef struct
+{
+  nn_tensor      *tensors;
+  uint16_t       tensor_count;
+  const nn_layer *layers;
+  uint16_t       layer_count;
+  uint32_t       *cycles;   /*!< layer_count entries filled per invoke, or NULL */
+  nn_context     scratch;   /*!< Shared kernel scratch (DTCM input tiles), may be empty */
+} nn_model;
+
+/* Profiling on target uses the DWT counter: PERF_Init() must have run */
+void        nn_model_set_scratch(nn_model *model, void *buf, int32_t size);
+nn_status   nn_model_invoke(nn_model *model);
+nn_status   nn_model_run_layer(const nn_model *model, const nn_layer *layer);
+uint32_t    nn_layer_weights(const nn_model *model, const nn_layer *layer, const int8_t **weights);
+void        nn_model_print_profile(const nn_model *model);
+const char *nn_op_name(nn_op op);
+
+#endif /* NN_MODEL_H */
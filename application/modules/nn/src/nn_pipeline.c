@@ -0,0 +1,200 @@
+#include <stddef.h>
+#include <stdio.h>
+
+#include "nn_pipeline.h"
+#include "perf.h"
+
+#define NN_PIPELINE_TIMEOUT_MS   100U
+
+typedef union
+{
+  nn_conv_layer    conv;
+  nn_dw_conv_layer dw_conv;
+  nn_fc_layer      fc;
+} nn_pipeline_params;
+
+/**
+  * @brief  First layer at or after @p from whose weights fit a buffer.
+  * @retval Its index, or model->layer_count if there is none.
+  */
+static uint32_t nn_pipeline_next(const nn_model *model, const nn_pipeline *pipe, uint32_t from,
+                                 const int8_t **weights, uint32_t *bytes)
+{
+  for (; from < model->layer_count; from++)
+  {
+    *bytes = nn_layer_weights(model, &model->layers[from], weights);
+    if ((*weights != NULL) && (*bytes != 0U) && (*bytes <= pipe->buffer_size))
+    {
+      break;
+    }
+  }
+  return from;
+}
+
+/**
+  * @brief  Queues the weights of the next stageable layer at or after @p from into @p slot.
+  * @retval The layer whose weights are on their way, or model->layer_count.
+  */
+static uint32_t nn_pipeline_queue(const nn_model *model, nn_pipeline *pipe, uint32_t from, uint32_t slot)
+{
+  const int8_t *weights;
+  uint32_t bytes;
+  const uint32_t next = nn_pipeline_next(model, pipe, from, &weights, &bytes);
+
+  if ((next < model->layer_count) && (dma_memcpy(pipe->buffer[slot], weights, bytes, &pipe->future[slot]) != HAL_OK))
+  {
+    return model->layer_count;   /* Queue full or MDMA error: remaining layers run in place */
+  }
+  return next;
+}
+
+/**
+  * @brief  Copy of @p layer's parameters with the filter redirected to @p filter.
+  */
+static const void *nn_pipeline_redirect(const nn_layer *layer, const int8_t *filter, nn_pipeline_params *copy)
+{
+  switch (layer->op)
+  {
+    case NN_OP_CONV2D:
+      copy->conv = *(const nn_conv_layer *)layer->params;
+      copy->conv.filter = filter;
+      return &copy->conv;
+
+    case NN_OP_DEPTHWISE_CONV2D:
+      copy->dw_conv = *(const nn_dw_conv_layer *)layer->params;
+      copy->dw_conv.filter = filter;
+      return &copy->dw_conv;
+
+    case NN_OP_FULLY_CONNECTED:
+      copy->fc = *(const nn_fc_layer *)layer->params;
+      copy->fc.filter = filter;
+      return &copy->fc;
+
+    default:
+      return layer->params;
+  }
+}
+
+/**
+  * @brief  Runs every layer in order with next-layer weights prefetched into DTCM.
+  * @retval NN_OK, the first failing layer's status, or NN_ARG_ERROR if a transfer
+  *         does not complete.
+  */
+nn_status nn_pipeline_invoke(nn_model *model, nn_pipeline *pipe)
+{
+  uint32_t slot = 0U;
+  uint32_t pending;
+  uint32_t i;
+
+  if ((pipe->buffer[0] == NULL) || (pipe->buffer[1] == NULL))
+  {
+    return NN_ARG_ERROR;
+  }
+
+  pending = nn_pipeline_queue(model, pipe, 0U, slot);
+
+  for (i = 0U; i < model->layer_count; i++)
+  {
+    nn_layer layer = model->layers[i];
+    nn_pipeline_params copy;
+    const int8_t *weights;
+    uint32_t stall = 0U;
+    uint32_t staged = 0U;
+    nn_status status;
+    uint32_t start;
+
+    if (i == pending)
+    {
+      start = PERF_Cycles();
+      if (dma_mem_wait(&pipe->future[slot], NN_PIPELINE_TIMEOUT_MS) != HAL_OK)
+      {
+        return NN_ARG_ERROR;
+      }
+      stall = PERF_Elapsed(start);
+      staged = nn_layer_weights(model, &layer, &weights);
+      layer.params = nn_pipeline_redirect(&layer, (const int8_t *)pipe->buffer[slot], &copy);
+
+      /* The other buffer's layer has finished: refill it while this one computes */
+      slot ^= 1U;
+      pending = nn_pipeline_queue(model, pipe, i + 1U, slot);
+    }
+
+    start = PERF_Cycles();
+    status = nn_model_run_layer(model, &layer);
+    if (model->cycles != NULL)
+    {
+      model->cycles[i] = PERF_Elapsed(start);
+    }
+    if (pipe->stall != NULL)
+    {
+      pipe->stall[i] = stall;
+    }
+    if (pipe->staged != NULL)
+    {
+      pipe->staged[i] = staged;
+    }
+
+    if (status != NN_OK)
+    {
+      /* Let an in-flight transfer finish before the buffers can be reused */
+      if (pending < model->layer_count)
+      {
+        (void)dma_mem_wait(&pipe->future[slot], NN_PIPELINE_TIMEOUT_MS);
+      }
+      return status;
+    }
+  }
+
+  return NN_OK;
+}
+
+/**
+  * @brief  Per-layer compute and stall cycles from the last pipelined invoke.
+  * @note   A staged layer's transfer was queued when the previous staged layer
+  *         started, so it overlapped the compute of every layer in between
+  *         ("window"; for the first, every layer before it). Overlap is
+  *         window / (window + stall): 100% means the copy was fully hidden.
+  */
+void nn_pipeline_print_profile(const nn_model *model, const nn_pipeline *pipe)
+{
+  uint64_t compute = 0U;
+  uint64_t stalled = 0U;
+  uint32_t window = 0U;
+  uint32_t bytes = 0U;
+  uint32_t i;
+
+  if ((model->cycles == NULL) || (pipe->stall == NULL) || (pipe->staged == NULL))
+  {
+    return;
+  }
+
+  printf("nn pipeline: %lu byte buffers\n", (unsigned long)pipe->buffer_size);
+  printf("  %2s %-10s %10s %8s %8s %7s\n", "#", "op", "compute", "stall", "staged", "overlap");
+  for (i = 0U; i < model->layer_count; i++)
+  {
+    if (pipe->staged[i] != 0U)
+    {
+      const uint64_t span = (uint64_t)window + pipe->stall[i];
+      const uint32_t overlap = (span != 0U) ? (uint32_t)(((uint64_t)window * 1000U) / span) : 0U;
+
+      printf("  %2lu %-10s %10lu %8lu %8lu %3lu.%lu%%\n", (unsigned long)i, nn_op_name(model->layers[i].op),
+             (unsigned long)model->cycles[i], (unsigned long)pipe->stall[i], (unsigned long)pipe->staged[i],
+             (unsigned long)(overlap / 10U), (unsigned long)(overlap % 10U));
+      bytes += pipe->staged[i];
+      window = 0U;
+    }
+    else
+    {
+      printf("  %2lu %-10s %10lu %8s %8s %7s\n", (unsigned long)i, nn_op_name(model->layers[i].op),
+             (unsigned long)model->cycles[i], "-", "-", "-");
+    }
+    window += model->cycles[i];
+    compute += model->cycles[i];
+    stalled += pipe->stall[i];
+  }
+
+  printf("nn pipeline: %lu compute + %lu stall cycles (%lu%% stalled), %lu bytes staged\n",
+         (unsigned long)compute, (unsigned long)stalled,
+         (unsigned long)(((compute + stalled) != 0U) ? ((stalled * 100U) / (compute + stalled)) : 0U),
+         (unsigned long)bytes);
+}
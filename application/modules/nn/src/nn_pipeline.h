@@ -0,0 +1,36 @@
+#ifndef NN_PIPELINE_H
+#define NN_PIPELINE_H
+
+#include <stdint.h>
+
+#include "dma_memcpy.h"
+#include "nn_model.h"
+
+/*
+ * Layer-pipelined runner: weights are staged from flash (or AXI SRAM) into
+ * two DTCM buffers by the MDMA, one layer ahead. Once layer N's weights have
+ * landed, the copy of the next weighted layer is queued into the other
+ * buffer and layer N runs on its DTCM copy, so the transfer hides behind
+ * layer N and any weightless layers that follow it.
+ *
+ * Layers whose weights do not fit a buffer run from their original location.
+ * The model's params stay const: each staged layer runs through a stack copy
+ * of its parameters with the filter pointer redirected.
+ *
+ * Target only (MDMA via dma_memcpy; dma_mem_init() must have run).
+ */
+
+typedef struct
+{
+  uint8_t  *buffer[2];      /*!< DTCM, 8-byte aligned */
+  uint32_t buffer_size;     /*!< Bytes in each buffer */
+  uint32_t *stall;          /*!< layer_count entries: cycles spent waiting for the layer's weights, or NULL */
+  uint32_t *staged;         /*!< layer_count entries: bytes staged for the layer, or NULL */
+  DMA_MemFutureTypeDef future[2];
+} nn_pipeline;
+
+/* Fills model->cycles with compute cycles only; waits go to pipe->stall */
+nn_status nn_pipeline_invoke(nn_model *model, nn_pipeline *pipe);
+void      nn_pipeline_print_profile(const nn_model *model, const nn_pipeline *pipe);
+
+#endif /* NN_PIPELINE_H */
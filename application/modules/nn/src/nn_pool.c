@@ -0,0 +1,150 @@
+#include "nn.h"
+#include "nn_math.h"
+
+static void nn_pool_range(int32_t origin, int32_t kernel, int32_t extent, int32_t *first, int32_t *last)
+{
+  *first = NN_MAX(0, -origin);
+  *last = NN_MIN(kernel, extent - origin);
+}
+
+static int8_t nn_pool_clamp(int32_t value, const nn_activation *activation)
+{
+  value = NN_MAX(value, activation->min);
+  value = NN_MIN(value, activation->max);
+  return (int8_t)value;
+}
+
+/**
+  * @brief  Max pooling; four channels per SSUB8/SEL step.
+  */
+nn_status nn_max_pool_s8(const nn_pool_params *pool_params,
+                         const nn_dims *input_dims, const int8_t *input,
+                         const nn_dims *filter_dims,
+                         const nn_dims *output_dims, int8_t *output)
+{
+  const int32_t channels = input_dims->c;
+  int32_t b, oy, ox, c, ky, kx;
+
+  if (channels != output_dims->c)
+  {
+    return NN_ARG_ERROR;
+  }
+
+  for (b = 0; b < input_dims->n; b++)
+  {
+    const int8_t *in_batch = &input[b * input_dims->h * input_dims->w * channels];
+
+    for (oy = 0; oy < output_dims->h; oy++)
+    {
+      const int32_t iy0 = oy * pool_params->stride.h - pool_params->padding.h;
+      int32_t ky_first, ky_last;
+
+      nn_pool_range(iy0, filter_dims->h, input_dims->h, &ky_first, &ky_last);
+
+      for (ox = 0; ox < output_dims->w; ox++)
+      {
+        const int32_t ix0 = ox * pool_params->stride.w - pool_params->padding.w;
+        int32_t kx_first, kx_last;
+
+        nn_pool_range(ix0, filter_dims->w, input_dims->w, &kx_first, &kx_last);
+
+        for (c = 0; c + 4 <= channels; c += 4)
+        {
+          uint32_t max = 0x80808080U;
+          int32_t lane;
+
+          for (ky = ky_first; ky < ky_last; ky++)
+          {
+            for (kx = kx_first; kx < kx_last; kx++)
+            {
+              max = nn_max_s8x4(nn_read_s8x4(&in_batch[((iy0 + ky) * input_dims->w + ix0 + kx) * channels + c]), max);
+            }
+          }
+
+          for (lane = 0; lane < 4; lane++)
+          {
+            *output++ = nn_pool_clamp((int8_t)(max >> (8 * lane)), &pool_params->activation);
+          }
+        }
+
+        for (; c < channels; c++)
+        {
+          int32_t max = -128;
+
+          for (ky = ky_first; ky < ky_last; ky++)
+          {
+            for (kx = kx_first; kx < kx_last; kx++)
+            {
+              max = NN_MAX(max, (int32_t)in_batch[((iy0 + ky) * input_dims->w + ix0 + kx) * channels + c]);
+            }
+          }
+
+          *output++ = nn_pool_clamp(max, &pool_params->activation);
+        }
+      }
+    }
+  }
+
+  return NN_OK;
+}
+
+/**
+  * @brief  Average pooling over the in-bounds taps, rounded half away from zero.
+  */
+nn_status nn_avg_pool_s8(const nn_pool_params *pool_params,
+                         const nn_dims *input_dims, const int8_t *input,
+                         const nn_dims *filter_dims,
+                         const nn_dims *output_dims, int8_t *output)
+{
+  const int32_t channels = input_dims->c;
+  int32_t b, oy, ox, c, ky, kx;
+
+  if (channels != output_dims->c)
+  {
+    return NN_ARG_ERROR;
+  }
+
+  for (b = 0; b < input_dims->n; b++)
+  {
+    const int8_t *in_batch = &input[b * input_dims->h * input_dims->w * channels];
+
+    for (oy = 0; oy < output_dims->h; oy++)
+    {
+      const int32_t iy0 = oy * pool_params->stride.h - pool_params->padding.h;
+      int32_t ky_first, ky_last;
+
+      nn_pool_range(iy0, filter_dims->h, input_dims->h, &ky_first, &ky_last);
+
+      for (ox = 0; ox < output_dims->w; ox++)
+      {
+        const int32_t ix0 = ox * pool_params->stride.w - pool_params->padding.w;
+        int32_t kx_first, kx_last, count;
+
+        nn_pool_range(ix0, filter_dims->w, input_dims->w, &kx_first, &kx_last);
+        count = NN_MAX(ky_last - ky_first, 0) * NN_MAX(kx_last - kx_first, 0);
+        if (count == 0)
+        {
+          return NN_ARG_ERROR;
+        }
+
+        for (c = 0; c < channels; c++)
+        {
+          int32_t sum = 0;
+
+          for (ky = ky_first; ky < ky_last; ky++)
+          {
+            for (kx = kx_first; kx < kx_last; kx++)
+            {
+              sum += in_batch[((iy0 + ky) * input_dims->w + ix0 + kx) * channels + c];
+            }
+          }
+
+          sum = (sum > 0) ? ((sum + count / 2) / count) : ((sum - count / 2) / count);
+          *output++ = nn_pool_clamp(sum, &pool_params->activation);
+        }
+      }
+    }
+  }
+
+  return NN_OK;
+}
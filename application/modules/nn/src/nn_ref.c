@@ -0,0 +1,350 @@
+#include <stddef.h>
+
+#include "nn_ref.h"
+#include "nn_math.h"
+
+#define NN_SOFTMAX_ACCUM_BITS    12
+
+static int8_t nn_ref_clamp(int32_t value, const nn_activation *activation)
+{
+  value = NN_MAX(value, -128);
+  value = NN_MIN(value, 127);
+  value = NN_MAX(value, activation->min);
+  value = NN_MIN(value, activation->max);
+  return (int8_t)value;
+}
+
+nn_status nn_ref_conv2d_s8(const nn_conv_params *conv_params,
+                           const nn_per_channel_quant_params *quant_params,
+                           const nn_dims *input_dims, const int8_t *input,
+                           const nn_dims *filter_dims, const int8_t *filter,
+                           const int32_t *bias,
+                           const nn_dims *output_dims, int8_t *output)
+{
+  int32_t b, oy, ox, oc, ky, kx, ic;
+
+  if ((input_dims->c != filter_dims->c) || (output_dims->c != filter_dims->n))
+  {
+    return NN_ARG_ERROR;
+  }
+
+  for (b = 0; b < input_dims->n; b++)
+  {
+    for (oy = 0; oy < output_dims->h; oy++)
+    {
+      for (ox = 0; ox < output_dims->w; ox++)
+      {
+        for (oc = 0; oc < output_dims->c; oc++)
+        {
+          int32_t acc = (bias != NULL) ? bias[oc] : 0;
+
+          for (ky = 0; ky < filter_dims->h; ky++)
+          {
+            const int32_t iy = oy * conv_params->stride.h - conv_params->padding.h + ky;
+
+            for (kx = 0; kx < filter_dims->w; kx++)
+            {
+              const int32_t ix = ox * conv_params->stride.w - conv_params->padding.w + kx;
+
+              if ((iy < 0) || (iy >= input_dims->h) || (ix < 0) || (ix >= input_dims->w))
+              {
+                continue;
+              }
+              for (ic = 0; ic < input_dims->c; ic++)
+              {
+                const int32_t x = input[((b * input_dims->h + iy) * input_dims->w + ix) * input_dims->c + ic];
+                const int32_t w = filter[((oc * filter_dims->h + ky) * filter_dims->w + kx) * filter_dims->c + ic];
+
+                acc += (x + conv_params->input_offset) * w;
+              }
+            }
+          }
+
+          acc = nn_requantize(acc, quant_params->multiplier[oc], quant_params->shift[oc]);
+          output[((b * output_dims->h + oy) * output_dims->w + ox) * output_dims->c + oc] =
+            nn_ref_clamp(acc + conv_params->output_offset, &conv_params->activation);
+        }
+      }
+    }
+  }
+
+  return NN_OK;
+}
+
+nn_status nn_ref_depthwise_conv2d_s8(const nn_dw_conv_params *dw_conv_params,
+                                     const nn_per_channel_quant_params *quant_params,
+                                     const nn_dims *input_dims, const int8_t *input,
+                                     const nn_dims *filter_dims, const int8_t *filter,
+                                     const int32_t *bias,
+                                     const nn_dims *output_dims, int8_t *output)
+{
+  const int32_t ch_mult = dw_conv_params->ch_mult;
+  int32_t b, oy, ox, ic, m, ky, kx;
+
+  if ((output_dims->c != input_dims->c * ch_mult) || (filter_dims->c != output_dims->c))
+  {
+    return NN_ARG_ERROR;
+  }
+
+  for (b = 0; b < input_dims->n; b++)
+  {
+    for (oy = 0; oy < output_dims->h; oy++)
+    {
+      for (ox = 0; ox < output_dims->w; ox++)
+      {
+        for (ic = 0; ic < input_dims->c; ic++)
+        {
+          for (m = 0; m < ch_mult; m++)
+          {
+            const int32_t oc = ic * ch_mult + m;
+            int32_t acc = (bias != NULL) ? bias[oc] : 0;
+
+            for (ky = 0; ky < filter_dims->h; ky++)
+            {
+              const int32_t iy = oy * dw_conv_params->stride.h - dw_conv_params->padding.h + ky;
+
+              for (kx = 0; kx < filter_dims->w; kx++)
+              {
+                const int32_t ix = ox * dw_conv_params->stride.w - dw_conv_params->padding.w + kx;
+
+                if ((iy < 0) || (iy >= input_dims->h) || (ix < 0) || (ix >= input_dims->w))
+                {
+                  continue;
+                }
+                acc += ((int32_t)input[((b * input_dims->h + iy) * input_dims->w + ix) * input_dims->c + ic] +
+                        dw_conv_params->input_offset) *
+                       (int32_t)filter[(ky * filter_dims->w + kx) * filter_dims->c + oc];
+              }
+            }
+
+            acc = nn_requantize(acc, quant_params->multiplier[oc], quant_params->shift[oc]);
+            output[((b * output_dims->h + oy) * output_dims->w + ox) * output_dims->c + oc] =
+              nn_ref_clamp(acc + dw_conv_params->output_offset, &dw_conv_params->activation);
+          }
+        }
+      }
+    }
+  }
+
+  return NN_OK;
+}
+
+nn_status nn_ref_fully_connected_s8(const nn_fc_params *fc_params,
+                                    const nn_per_tensor_quant_params *quant_params,
+                                    const nn_dims *input_dims, const int8_t *input,
+                                    const nn_dims *filter_dims, const int8_t *filter,
+                                    const int32_t *bias,
+                                    const nn_dims *output_dims, int8_t *output)
+{
+  const int32_t depth = filter_dims->n;
+  int32_t b, o, i;
+
+  if (fc_params->filter_offset != 0)
+  {
+    return NN_NO_IMPL;
+  }
+
+  for (b = 0; b < input_dims->n; b++)
+  {
+    for (o = 0; o < output_dims->c; o++)
+    {
+      int32_t acc = (bias != NULL) ? bias[o] : 0;
+
+      for (i = 0; i < depth; i++)
+      {
+        acc += ((int32_t)input[b * depth + i] + fc_params->input_offset) * (int32_t)filter[o * depth + i];
+      }
+
+      acc = nn_requantize(acc, quant_params->multiplier, quant_params->shift);
+      output[b * output_dims->c + o] = nn_ref_clamp(acc + fc_params->output_offset, &fc_params->activation);
+    }
+  }
+
+  return NN_OK;
+}
+
+static nn_status nn_ref_pool_s8(const nn_pool_params *pool_params,
+                                const nn_dims *input_dims, const int8_t *input,
+                                const nn_dims *filter_dims,
+                                const nn_dims *output_dims, int8_t *output, int max)
+{
+  int32_t b, oy, ox, c, ky, kx;
+
+  if (input_dims->c != output_dims->c)
+  {
+    return NN_ARG_ERROR;
+  }
+
+  for (b = 0; b < input_dims->n; b++)
+  {
+    for (oy = 0; oy < output_dims->h; oy++)
+    {
+      for (ox = 0; ox < output_dims->w; ox++)
+      {
+        for (c = 0; c < input_dims->c; c++)
+        {
+          int32_t result = max ? -128 : 0;
+          int32_t count = 0;
+
+          for (ky = 0; ky < filter_dims->h; ky++)
+          {
+            const int32_t iy = oy * pool_params->stride.h - pool_params->padding.h + ky;
+
+            for (kx = 0; kx < filter_dims->w; kx++)
+            {
+              const int32_t ix = ox * pool_params->stride.w - pool_params->padding.w + kx;
+              int32_t x;
+
+              if ((iy < 0) || (iy >= input_dims->h) || (ix < 0) || (ix >= input_dims->w))
+              {
+                continue;
+              }
+              x = input[((b * input_dims->h + iy) * input_dims->w + ix) * input_dims->c + c];
+              result = max ? NN_MAX(result, x) : (result + x);
+              count++;
+            }
+          }
+
+          if (!max)
+          {
+            if (count == 0)
+            {
+              return NN_ARG_ERROR;
+            }
+            result = (result > 0) ? ((result + count / 2) / count) : ((result - count / 2) / count);
+          }
+          output[((b * output_dims->h + oy) * output_dims->w + ox) * output_dims->c + c] =
+            nn_ref_clamp(result, &pool_params->activation);
+        }
+      }
+    }
+  }
+
+  return NN_OK;
+}
+
+nn_status nn_ref_max_pool_s8(const nn_pool_params *pool_params,
+                             const nn_dims *input_dims, const int8_t *input,
+                             const nn_dims *filter_dims,
+                             const nn_dims *output_dims, int8_t *output)
+{
+  return nn_ref_pool_s8(pool_params, input_dims, input, filter_dims, output_dims, output, 1);
+}
+
+nn_status nn_ref_avg_pool_s8(const nn_pool_params *pool_params,
+                             const nn_dims *input_dims, const int8_t *input,
+                             const nn_dims *filter_dims,
+                             const nn_dims *output_dims, int8_t *output)
+{
+  return nn_ref_pool_s8(pool_params, input_dims, input, filter_dims, output_dims, output, 0);
+}
+
+nn_status nn_ref_softmax_s8(const nn_softmax_params *softmax_params,
+                            const int8_t *input, int32_t num_rows, int32_t row_size,
+                            int8_t *output)
+{
+  const int32_t mask = 1 << softmax_params->shift;
+  int32_t row, col;
+
+  for (row = 0; row < num_rows; row++)
+  {
+    const int8_t *in = &input[row * row_size];
+    int8_t *out = &output[row * row_size];
+    int32_t max = in[0];
+    int32_t sum = 0;
+    int32_t headroom;
+    int32_t shifted_scale;
+    int32_t bits_over_unit;
+
+    for (col = 1; col < row_size; col++)
+    {
+      max = NN_MAX(max, (int32_t)in[col]);
+    }
+
+    for (col = 0; col < row_size; col++)
+    {
+      const int32_t diff = in[col] - max;
+
+      if (diff >= softmax_params->diff_min)
+      {
+        sum += nn_divide_by_power_of_two(
+          nn_exp_on_negative_values(nn_doubling_high_mult(diff * mask, softmax_params->multiplier)),
+          NN_SOFTMAX_ACCUM_BITS);
+      }
+    }
+
+    /* The row max contributes exp(0), so sum is never 0 */
+    headroom = __builtin_clz((uint32_t)sum);
+    shifted_scale = nn_one_over_one_plus_x_for_x_in_0_1((int32_t)(((uint32_t)sum << headroom) - 0x80000000U));
+    bits_over_unit = NN_SOFTMAX_ACCUM_BITS - headroom + 23;
+
+    for (col = 0; col < row_size; col++)
+    {
+      const int32_t diff = in[col] - max;
+
+      if (diff >= softmax_params->diff_min)
+      {
+        const int32_t result = nn_divide_by_power_of_two(
+          nn_doubling_high_mult(shifted_scale,
+                                nn_exp_on_negative_values(nn_doubling_high_mult(diff * mask, softmax_params->multiplier))),
+          bits_over_unit) - 128;
+
+        out[col] = (int8_t)NN_MIN(NN_MAX(result, -128), 127);
+      }
+      else
+      {
+        out[col] = -128;
+      }
+    }
+  }
+
+  return NN_OK;
+}
+
+nn_status nn_ref_gemm_s8(const nn_fc_params *fc_params,
+                         const nn_per_channel_quant_params *quant_params,
+                         int32_t m, int32_t n, int32_t k,
+                         const int8_t *input, const int8_t *weights,
+                         const int32_t *bias, int8_t *output)
+{
+  int32_t row, col, i;
+
+  for (row = 0; row < m; row++)
+  {
+    for (col = 0; col < n; col++)
+    {
+      int32_t acc = (bias != NULL) ? bias[col] : 0;
+
+      for (i = 0; i < k; i++)
+      {
+        acc += ((int32_t)input[row * k + i] + fc_params->input_offset) * (int32_t)weights[col * k + i];
+      }
+
+      acc = nn_requantize(acc, quant_params->multiplier[col], quant_params->shift[col]);
+      output[row * n + col] = nn_ref_clamp(acc + fc_params->output_offset, &fc_params->activation);
+    }
+  }
+
+  return NN_OK;
+}
+
+nn_status nn_ref_add_s8(const nn_add_params *add_params,
+                        const int8_t *input_1, const int8_t *input_2, int32_t block_size,
+                        int8_t *output)
+{
+  int32_t i;
+
+  for (i = 0; i < block_size; i++)
+  {
+    int32_t a = ((int32_t)input_1[i] + add_params->input_1_offset) * (1 << add_params->left_shift);
+    int32_t b = ((int32_t)input_2[i] + add_params->input_2_offset) * (1 << add_params->left_shift);
+    int32_t sum;
+
+    a = nn_requantize(a, add_params->input_1_multiplier, add_params->input_1_shift);
+    b = nn_requantize(b, add_params->input_2_multiplier, add_params->input_2_shift);
+    sum = nn_requantize(a + b, add_params->output_multiplier, add_params->output_shift);
+    output[i] = nn_ref_clamp(sum + add_params->output_offset, &add_params->activation);
+  }
+
+  return NN_OK;
+}
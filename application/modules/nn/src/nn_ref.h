@@ -0,0 +1,63 @@
+#ifndef NN_REF_H
+#define NN_REF_H
+
+#include <stdint.h>
+
+#include "nn_types.h"
+
+/*
+ * Reference versions of the nn.h kernels: straight loops over the TFLite
+ * Micro definitions, no SIMD, no HAL. They are the oracle for the optimized
+ * kernels, on target (bench_nn) or built on a host.
+ */
+
+nn_status nn_ref_conv2d_s8(const nn_conv_params *conv_params,
+                           const nn_per_channel_quant_params *quant_params,
+                           const nn_dims *input_dims, const int8_t *input,
+                           const nn_dims *filter_dims, const int8_t *filter,
+                           const int32_t *bias,
+                           const nn_dims *output_dims, int8_t *output);
+
+nn_status nn_ref_depthwise_conv2d_s8(const nn_dw_conv_params *dw_conv_params,
+                                     const nn_per_channel_quant_params *quant_params,
+                                     const nn_dims *input_dims, const int8_t *input,
+                                     const nn_dims *filter_dims, const int8_t *filter,
+                                     const int32_t *bias,
+                                     const nn_dims *output_dims, int8_t *output);
+
+/* filter_dims->n is the accumulation depth, output_dims->c the output depth */
+nn_status nn_ref_fully_connected_s8(const nn_fc_params *fc_params,
+                                    const nn_per_tensor_quant_params *quant_params,
+                                    const nn_dims *input_dims, const int8_t *input,
+                                    const nn_dims *filter_dims, const int8_t *filter,
+                                    const int32_t *bias,
+                                    const nn_dims *output_dims, int8_t *output);
+
+/* filter_dims->h/w is the pooling window */
+nn_status nn_ref_max_pool_s8(const nn_pool_params *pool_params,
+                             const nn_dims *input_dims, const int8_t *input,
+                             const nn_dims *filter_dims,
+                             const nn_dims *output_dims, int8_t *output);
+
+nn_status nn_ref_avg_pool_s8(const nn_pool_params *pool_params,
+                             const nn_dims *input_dims, const int8_t *input,
+                             const nn_dims *filter_dims,
+                             const nn_dims *output_dims, int8_t *output);
+
+/* Output scale is 1/256 with zero point -128 */
+nn_status nn_ref_softmax_s8(const nn_softmax_params *softmax_params,
+                            const int8_t *input, int32_t num_rows, int32_t row_size,
+                            int8_t *output);
+
+/* output[m][n] from input[m][k] and weights[n][k]; see nn_gemm.h */
+nn_status nn_ref_gemm_s8(const nn_fc_params *fc_params,
+                         const nn_per_channel_quant_params *quant_params,
+                         int32_t m, int32_t n, int32_t k,
+                         const int8_t *input, const int8_t *weights,
+                         const int32_t *bias, int8_t *output);
+
+nn_status nn_ref_add_s8(const nn_add_params *add_params,
+                        const int8_t *input_1, const int8_t *input_2, int32_t block_size,
+                        int8_t *output);
+
+#endif /* NN_REF_H */
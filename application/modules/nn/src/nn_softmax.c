@@ -0,0 +1,87 @@
+#include "nn.h"
+#include "nn_math.h"
+
+#define NN_SOFTMAX_ACCUM_BITS    12
+
+/* Row maximum, four lanes per SSUB8/SEL step */
+static int32_t nn_softmax_row_max(const int8_t *row, int32_t size)
+{
+  uint32_t max4 = 0x80808080U;
+  int32_t max;
+  int32_t i = 0;
+
+  for (; i + 4 <= size; i += 4)
+  {
+    max4 = nn_max_s8x4(nn_read_s8x4(&row[i]), max4);
+  }
+
+  max = NN_MAX(NN_MAX((int8_t)max4, (int8_t)(max4 >> 8)), NN_MAX((int8_t)(max4 >> 16), (int8_t)(max4 >> 24)));
+  for (; i < size; i++)
+  {
+    max = NN_MAX(max, (int32_t)row[i]);
+  }
+  return max;
+}
+
+/**
+  * @brief  int8 softmax per row (TFLite Micro fixed-point algorithm).
+  * @note   Two passes per row: the first sums exp(x - max), the second
+  *         scales each term by the reciprocal of that sum.
+  */
+nn_status nn_softmax_s8(const nn_softmax_params *softmax_params,
+                        const int8_t *input, int32_t num_rows, int32_t row_size,
+                        int8_t *output)
+{
+  const int32_t mask = 1 << softmax_params->shift;
+  int32_t row, col;
+
+  if (row_size < 1)
+  {
+    return NN_ARG_ERROR;
+  }
+
+  for (row = 0; row < num_rows; row++)
+  {
+    const int32_t max = nn_softmax_row_max(input, row_size);
+    int32_t sum = 0;
+    int32_t headroom;
+    int32_t shifted_scale;
+    int32_t bits_over_unit;
+
+    for (col = 0; col < row_size; col++)
+    {
+      const int32_t diff = input[col] - max;
+
+      if (diff >= softmax_params->diff_min)
+      {
+        sum += nn_divide_by_power_of_two(
+          nn_exp_on_negative_values(nn_doubling_high_mult(diff * mask, softmax_params->multiplier)),
+          NN_SOFTMAX_ACCUM_BITS);
+      }
+    }
+
+    headroom = __builtin_clz((uint32_t)sum);
+    shifted_scale = nn_one_over_one_plus_x_for_x_in_0_1((int32_t)(((uint32_t)sum << headroom) - 0x80000000U));
+    bits_over_unit = NN_SOFTMAX_ACCUM_BITS - headroom + 23;
+
+    for (col = 0; col < row_size; col++)
+    {
+      const int32_t diff = input[col] - max;
+      int32_t result = -128;
+
+      if (diff >= softmax_params->diff_min)
+      {
+        result = nn_divide_by_power_of_two(
+          nn_doubling_high_mult(shifted_scale,
+                                nn_exp_on_negative_values(nn_doubling_high_mult(diff * mask, softmax_params->multiplier))),
+          bits_over_unit) - 128;
+      }
+      output[col] = (int8_t)nn_ssat8(result);
+    }
+
+    input += row_size;
+    output += row_size;
+  }
+
+  return NN_OK;
+}
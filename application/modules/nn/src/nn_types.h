@@ -0,0 +1,120 @@
+#ifndef NN_TYPES_H
+#define NN_TYPES_H
+
+#include <stdint.h>
+
+/*
+ * Shapes and quantization parameters shared by the int8 kernels. Layouts
+ * and parameter meanings follow TensorFlow Lite for Microcontrollers so that
+ * a converted model's values drop in unchanged:
+ *  - activations are NHWC,
+ *  - conv filters are OHWI, depthwise filters 1HW(C*M), fully connected
+ *    weights [output][accumulation],
+ *  - offsets are the negated zero points,
+ *  - requantization is (multiplier, shift) with a Q31 multiplier and a
+ *    positive shift meaning a left shift.
+ */
+
+typedef enum
+{
+  NN_OK        =  0,   /*!< Kernel ran */
+  NN_ARG_ERROR = -1,   /*!< Inconsistent shapes or parameters */
+  NN_NO_IMPL   = -2,   /*!< Combination not implemented */
+  NN_NO_MEMORY = -3,   /*!< Arena too small for the plan */
+} nn_status;
+
+typedef struct
+{
+  void    *buf;    /*!< Kernel scratch, ideally in DTCM; NULL for none */
+  int32_t size;
+} nn_context;
+
+typedef struct
+{
+  int32_t n;   /*!< Batches, or output channels for a conv filter */
+  int32_t h;
+  int32_t w;
+  int32_t c;
+} nn_dims;
+
+typedef struct
+{
+  int32_t h;
+  int32_t w;
+} nn_tile;
+
+typedef struct
+{
+  int32_t min;   /*!< Fused activation clamp, within [-128, 127] */
+  int32_t max;
+} nn_activation;
+
+typedef struct
+{
+  int32_t multiplier;   /*!< Q31 */
+  int32_t shift;        /*!< > 0 left, < 0 right */
+} nn_per_tensor_quant_params;
+
+typedef struct
+{
+  const int32_t *multiplier;   /*!< One per output channel */
+  const int32_t *shift;
+} nn_per_channel_quant_params;
+
+typedef struct
+{
+  int32_t       input_offset;
+  int32_t       output_offset;
+  nn_tile       stride;
+  nn_tile       padding;   /*!< Top/left padding; bottom/right follows from the output size */
+  nn_activation activation;
+} nn_conv_params;
+
+typedef struct
+{
+  int32_t       ch_mult;   /*!< Output channels per input channel */
+  int32_t       input_offset;
+  int32_t       output_offset;
+  nn_tile       stride;
+  nn_tile       padding;
+  nn_activation activation;
+} nn_dw_conv_params;
+
+typedef struct
+{
+  int32_t       input_offset;
+  int32_t       filter_offset;   /*!< Must be 0: weights are symmetric */
+  int32_t       output_offset;
+  nn_activation activation;
+} nn_fc_params;
+
+typedef struct
+{
+  nn_tile       stride;
+  nn_tile       padding;
+  nn_activation activation;
+} nn_pool_params;
+
+typedef struct
+{
+  int32_t multiplier;   /*!< Input beta multiplier (Q31) */
+  int32_t shift;        /*!< Input beta left shift */
+  int32_t diff_min;     /*!< Differences to the row max below this give 0 */
+} nn_softmax_params;
+
+typedef struct
+{
+  int32_t       input_1_offset;
+  int32_t       input_1_multiplier;
+  int32_t       input_1_shift;
+  int32_t       input_2_offset;
+  int32_t       input_2_multiplier;
+  int32_t       input_2_shift;
+  int32_t       left_shift;   /*!< Headroom shift applied to both inputs (20 in TFLM) */
+  int32_t       output_offset;
+  int32_t       output_multiplier;
+  int32_t       output_shift;
+  nn_activation activation;
+} nn_add_params;
+
+#endif /* NN_TYPES_H */
@@ -0,0 +1,26 @@
+#include "perf.h"
+
+#define DWT_LAR_UNLOCK    0xC5ACCE55UL
+
+static uint32_t perf_overhead = 0U;
+
+/**
+  * @brief  Starts the DWT cycle counter and measures the cost of reading it.
+  * @note   Safe to call more than once; the counter is never reset.
+  */
+void PERF_Init(void)
+{
+  uint32_t start;
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = DWT_LAR_UNLOCK;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  start = DWT->CYCCNT;
+  perf_overhead = DWT->CYCCNT - start;
+}
+
+uint32_t PERF_GetOverhead(void)
+{
+  return perf_overhead;
+}
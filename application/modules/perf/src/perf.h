@@ -0,0 +1,28 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include "stm32h7xx_hal.h"
+
+void     PERF_Init(void);
+uint32_t PERF_GetOverhead(void);
+
+/**
+  * @brief  Current core cycle count (DWT CYCCNT, wraps every 2^32 cycles).
+  */
+__STATIC_FORCEINLINE uint32_t PERF_Cycles(void)
+{
+  return DWT->CYCCNT;
+}
+
+/**
+  * @brief  Cycles elapsed since @p start, corrected for the read overhead.
+  */
+__STATIC_FORCEINLINE uint32_t PERF_Elapsed(uint32_t start)
+{
+  uint32_t elapsed = DWT->CYCCNT - start;
+  uint32_t overhead = PERF_GetOverhead();
+
+  return (elapsed > overhead) ? (elapsed - overhead) : 0U;
+}
+
+#endif /* PERF_H */
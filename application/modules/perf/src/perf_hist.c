@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "perf_hist.h"
+
+void PERF_Hist_Init(PERF_HistTypeDef *hist, uint32_t base, uint32_t width)
+{
+  memset(hist, 0, sizeof(*hist));
+  hist->Base = base;
+  hist->Width = (width == 0U) ? 1U : width;
+  hist->Min = UINT32_MAX;
+}
+
+void PERF_Hist_Add(PERF_HistTypeDef *hist, uint32_t sample)
+{
+  if (sample < hist->Base)
+  {
+    hist->Underflow++;
+  }
+  else
+  {
+    uint32_t index = (sample - hist->Base) / hist->Width;
+
+    if (index < PERF_HIST_BUCKETS)
+    {
+      hist->Bucket[index]++;
+    }
+    else
+    {
+      hist->Overflow++;
+    }
+  }
+
+  if (sample < hist->Min)
+  {
+    hist->Min = sample;
+  }
+  if (sample > hist->Max)
+  {
+    hist->Max = sample;
+  }
+  hist->Sum += sample;
+  hist->Count++;
+}
+
+uint32_t PERF_Hist_Mean(const PERF_HistTypeDef *hist)
+{
+  return (hist->Count == 0U) ? 0U : (uint32_t)(hist->Sum / hist->Count);
+}
+
+/**
+  * @brief  Upper edge of the bucket holding the given percentile.
+  * @note   Resolution is one bucket; samples outside the range clamp to Min/Max.
+  */
+uint32_t PERF_Hist_Percentile(const PERF_HistTypeDef *hist, uint32_t percent)
+{
+  uint32_t target;
+  uint32_t seen;
+  uint32_t i;
+
+  if (hist->Count == 0U)
+  {
+    return 0U;
+  }
+
+  target = (uint32_t)(((uint64_t)hist->Count * percent + 99U) / 100U);
+  seen = hist->Underflow;
+  if (seen >= target)
+  {
+    return hist->Min;
+  }
+
+  for (i = 0U; i < PERF_HIST_BUCKETS; i++)
+  {
+    seen += hist->Bucket[i];
+    if (seen >= target)
+    {
+      return hist->Base + (i + 1U) * hist->Width - 1U;
+    }
+  }
+
+  return hist->Max;
+}
+
+void PERF_Hist_Print(const PERF_HistTypeDef *hist, const char *name)
+{
+  uint32_t i;
+
+  printf("%s: n=%lu min=%lu mean=%lu p99=%lu max=%lu\n", name,
+         (unsigned long)hist->Count, (unsigned long)(hist->Count ? hist->Min : 0U),
+         (unsigned long)PERF_Hist_Mean(hist), (unsigned long)PERF_Hist_Percentile(hist, 99U),
+         (unsigned long)hist->Max);
+
+  if (hist->Underflow != 0U)
+  {
+    printf("  <%lu: %lu\n", (unsigned long)hist->Base, (unsigned long)hist->Underflow);
+  }
+  for (i = 0U; i < PERF_HIST_BUCKETS; i++)
+  {
+    if (hist->Bucket[i] != 0U)
+    {
+      printf("  %lu..%lu: %lu\n", (unsigned long)(hist->Base + i * hist->Width),
+             (unsigned long)(hist->Base + (i + 1U) * hist->Width - 1U),
+             (unsigned long)hist->Bucket[i]);
+    }
+  }
+  if (hist->Overflow != 0U)
+  {
+    printf("  >=%lu: %lu\n", (unsigned long)(hist->Base + PERF_HIST_BUCKETS * hist->Width),
+           (unsigned long)hist->Overflow);
+  }
+}
@@ -0,0 +1,29 @@
+#ifndef PERF_HIST_H
+#define PERF_HIST_H
+
+#include <stdint.h>
+
+/* Pure computation, no HAL dependency: builds for the host as well. */
+
+#define PERF_HIST_BUCKETS    32U
+
+typedef struct
+{
+  uint32_t Base;                        /*!< Lower bound of bucket 0            */
+  uint32_t Width;                       /*!< Width of every bucket, in cycles   */
+  uint32_t Bucket[PERF_HIST_BUCKETS];   /*!< Sample counts                      */
+  uint32_t Underflow;                   /*!< Samples below Base                 */
+  uint32_t Overflow;                    /*!< Samples past the last bucket       */
+  uint32_t Count;
+  uint32_t Min;
+  uint32_t Max;
+  uint64_t Sum;
+} PERF_HistTypeDef;
+
+void     PERF_Hist_Init(PERF_HistTypeDef *hist, uint32_t base, uint32_t width);
+void     PERF_Hist_Add(PERF_HistTypeDef *hist, uint32_t sample);
+uint32_t PERF_Hist_Mean(const PERF_HistTypeDef *hist);
+uint32_t PERF_Hist_Percentile(const PERF_HistTypeDef *hist, uint32_t percent);
+void     PERF_Hist_Print(const PERF_HistTypeDef *hist, const char *name);
+
+#endif /* PERF_HIST_H */
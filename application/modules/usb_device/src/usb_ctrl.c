@@ -0,0 +1,460 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "usb_ctrl.h"
+
+#define USB_CTRL_STALL   (-1)
+
+static void ctrl_stall(usb_ctrl *ctrl)
+{
+  ctrl->stage = USB_CTRL_STALLED;
+  ctrl->stalls++;
+  ctrl->ops->stall(ctrl->ops->context);
+}
+
+static void ctrl_status_in(usb_ctrl *ctrl)
+{
+  ctrl->stage = USB_CTRL_STATUS_IN;
+  ctrl->ops->send(ctrl->ops->context, NULL, 0U);
+}
+
+static void ctrl_status_out(usb_ctrl *ctrl)
+{
+  ctrl->stage = USB_CTRL_STATUS_OUT;
+  ctrl->ops->receive(ctrl->ops->context, NULL, 0U);
+}
+
+/* Next packet of the reply; the first may be empty for an empty reply */
+static void ctrl_send_next(usb_ctrl *ctrl)
+{
+  uint32_t size = (ctrl->remaining < USB_FS_PACKET_SIZE) ? ctrl->remaining : USB_FS_PACKET_SIZE;
+
+  ctrl->ops->send(ctrl->ops->context, ctrl->data, size);
+  ctrl->data += size;
+  ctrl->remaining -= size;
+}
+
+/* Send @p length bytes of the control buffer, cut to what the host asked for */
+static void ctrl_reply(usb_ctrl *ctrl, uint32_t length)
+{
+  if (ctrl->setup.wLength == 0U)
+  {
+    ctrl_status_in(ctrl);
+    return;
+  }
+  if (length > ctrl->setup.wLength)
+  {
+    length = ctrl->setup.wLength;
+  }
+  ctrl->data = ctrl->buffer;
+  ctrl->remaining = length;
+  ctrl->zlp = ((length != 0U) && (length < ctrl->setup.wLength) && ((length % USB_FS_PACKET_SIZE) == 0U)) ? 1U : 0U;
+  ctrl->stage = USB_CTRL_DATA_IN;
+  ctrl_send_next(ctrl);
+}
+
+static uint32_t ctrl_is_in(const usb_ctrl *ctrl)
+{
+  return ((ctrl->setup.bmRequestType & USB_REQ_DIR_IN) != 0U) ? 1U : 0U;
+}
+
+static uint32_t ctrl_endpoint_valid(uint32_t endpoint)
+{
+  return ((endpoint == USB_EP_CDC_OUT) || (endpoint == USB_EP_CDC_IN) || (endpoint == USB_EP_VENDOR_OUT) ||
+          (endpoint == USB_EP_VENDOR_IN) || (endpoint == USB_EP_CDC_NOTIFY)) ? 1U : 0U;
+}
+
+static void ctrl_line_changed(usb_ctrl *ctrl)
+{
+  if (ctrl->ops->line_changed != NULL)
+  {
+    ctrl->ops->line_changed(ctrl->ops->context, &ctrl->line_coding, ctrl->line_state);
+  }
+}
+
+static int32_t ctrl_descriptor(usb_ctrl *ctrl)
+{
+  uint32_t type = ctrl->setup.wValue >> 8;
+  uint32_t index = ctrl->setup.wValue & 0xFFU;
+  uint32_t length;
+
+  switch (type)
+  {
+    case USB_DESC_DEVICE:
+      length = usb_desc_device(ctrl->buffer, sizeof(ctrl->buffer));
+      break;
+    case USB_DESC_CONFIGURATION:
+      length = (index == 0U) ? usb_desc_config(ctrl->buffer, sizeof(ctrl->buffer)) : 0U;
+      break;
+    case USB_DESC_STRING:
+      length = usb_desc_string(index, ctrl->serial, ctrl->buffer, sizeof(ctrl->buffer));
+      break;
+    case USB_DESC_BOS:
+      length = usb_desc_bos(ctrl->buffer, sizeof(ctrl->buffer));
+      break;
+    default:
+      /* Including the device qualifier: a full-speed-only device has none */
+      length = 0U;
+      break;
+  }
+  return (length != 0U) ? (int32_t)length : USB_CTRL_STALL;
+}
+
+static int32_t ctrl_set_configuration(usb_ctrl *ctrl)
+{
+  uint32_t config = ctrl->setup.wValue & 0xFFU;
+
+  if ((ctrl->state == USB_STATE_DEFAULT) || (config > USB_CONFIG_VALUE))
+  {
+    return USB_CTRL_STALL;
+  }
+
+  /* Setting the configuration again restarts its endpoints (data toggles, halts) */
+  if (ctrl->config != 0U)
+  {
+    ctrl->ops->configure(ctrl->ops->context, 0U);
+  }
+  ctrl->config = (uint8_t)config;
+  if (config != 0U)
+  {
+    ctrl->ops->configure(ctrl->ops->context, (uint8_t)config);
+  }
+  ctrl->state = (config != 0U) ? USB_STATE_CONFIGURED : USB_STATE_ADDRESS;
+  return 0;
+}
+
+static int32_t ctrl_standard_device(usb_ctrl *ctrl)
+{
+  switch (ctrl->setup.bRequest)
+  {
+    case USB_REQ_GET_STATUS:
+      ctrl->buffer[0] = 0U;   /* Bus powered, no remote wakeup */
+      ctrl->buffer[1] = 0U;
+      return (ctrl_is_in(ctrl) != 0U) ? 2 : USB_CTRL_STALL;
+
+    case USB_REQ_SET_ADDRESS:
+      if ((ctrl_is_in(ctrl) != 0U) || (ctrl->setup.wValue > 127U) || (ctrl->setup.wIndex != 0U) ||
+          (ctrl->state == USB_STATE_CONFIGURED))
+      {
+        return USB_CTRL_STALL;
+      }
+      ctrl->address = (uint8_t)ctrl->setup.wValue;
+      ctrl->ops->set_address(ctrl->ops->context, ctrl->address);
+      ctrl->state = (ctrl->address != 0U) ? USB_STATE_ADDRESS : USB_STATE_DEFAULT;
+      return 0;
+
+    case USB_REQ_GET_DESCRIPTOR:
+      return (ctrl_is_in(ctrl) != 0U) ? ctrl_descriptor(ctrl) : USB_CTRL_STALL;
+
+    case USB_REQ_GET_CONFIGURATION:
+      ctrl->buffer[0] = ctrl->config;
+      return (ctrl_is_in(ctrl) != 0U) ? 1 : USB_CTRL_STALL;
+
+    case USB_REQ_SET_CONFIGURATION:
+      return (ctrl_is_in(ctrl) == 0U) ? ctrl_set_configuration(ctrl) : USB_CTRL_STALL;
+
+    default:
+      /* Remote wakeup and test modes are not offered */
+      return USB_CTRL_STALL;
+  }
+}
+
+static int32_t ctrl_standard_interface(usb_ctrl *ctrl)
+{
+  if ((ctrl->state != USB_STATE_CONFIGURED) || (ctrl->setup.wIndex >= USB_IFACE_COUNT))
+  {
+    return USB_CTRL_STALL;
+  }
+
+  switch (ctrl->setup.bRequest)
+  {
+    case USB_REQ_GET_STATUS:
+      ctrl->buffer[0] = 0U;
+      ctrl->buffer[1] = 0U;
+      return (ctrl_is_in(ctrl) != 0U) ? 2 : USB_CTRL_STALL;
+
+    case USB_REQ_GET_INTERFACE:
+      ctrl->buffer[0] = 0U;   /* No alternate settings */
+      return (ctrl_is_in(ctrl) != 0U) ? 1 : USB_CTRL_STALL;
+
+    case USB_REQ_SET_INTERFACE:
+      return ((ctrl_is_in(ctrl) == 0U) && (ctrl->setup.wValue == 0U)) ? 0 : USB_CTRL_STALL;
+
+    default:
+      return USB_CTRL_STALL;
+  }
+}
+
+static int32_t ctrl_standard_endpoint(usb_ctrl *ctrl)
+{
+  uint32_t endpoint = ctrl->setup.wIndex & 0xFFU;
+  uint32_t control = ((endpoint & 0x7FU) == 0U) ? 1U : 0U;
+
+  if ((control == 0U) && ((ctrl->state != USB_STATE_CONFIGURED) || (ctrl_endpoint_valid(endpoint) == 0U)))
+  {
+    return USB_CTRL_STALL;
+  }
+
+  switch (ctrl->setup.bRequest)
+  {
+    case USB_REQ_GET_STATUS:
+      ctrl->buffer[0] = (control == 0U) ? (uint8_t)ctrl->ops->halted(ctrl->ops->context, (uint8_t)endpoint) : 0U;
+      ctrl->buffer[1] = 0U;
+      return (ctrl_is_in(ctrl) != 0U) ? 2 : USB_CTRL_STALL;
+
+    case USB_REQ_CLEAR_FEATURE:
+    case USB_REQ_SET_FEATURE:
+      if ((ctrl_is_in(ctrl) != 0U) || (ctrl->setup.wValue != USB_FEATURE_ENDPOINT_HALT))
+      {
+        return USB_CTRL_STALL;
+      }
+      /* Endpoint 0 clears its own stall on the next setup */
+      if (control == 0U)
+      {
+        ctrl->ops->set_halt(ctrl->ops->context, (uint8_t)endpoint,
+                            (ctrl->setup.bRequest == USB_REQ_SET_FEATURE) ? 1U : 0U);
+      }
+      return 0;
+
+    default:
+      return USB_CTRL_STALL;
+  }
+}
+
+static int32_t ctrl_class(usb_ctrl *ctrl)
+{
+  if ((ctrl->state != USB_STATE_CONFIGURED) ||
+      ((ctrl->setup.bmRequestType & USB_REQ_RECIPIENT_MASK) != USB_REQ_INTERFACE) ||
+      (ctrl->setup.wIndex != USB_IFACE_CDC_COMM))
+  {
+    return USB_CTRL_STALL;
+  }
+
+  switch (ctrl->setup.bRequest)
+  {
+    case USB_CDC_SET_LINE_CODING:
+      /* Applied when its data stage is in (ctrl_out_data()) */
+      return ((ctrl_is_in(ctrl) == 0U) && (ctrl->setup.wLength == 7U)) ? 0 : USB_CTRL_STALL;
+
+    case USB_CDC_GET_LINE_CODING:
+      ctrl->buffer[0] = (uint8_t)ctrl->line_coding.baud;
+      ctrl->buffer[1] = (uint8_t)(ctrl->line_coding.baud >> 8);
+      ctrl->buffer[2] = (uint8_t)(ctrl->line_coding.baud >> 16);
+      ctrl->buffer[3] = (uint8_t)(ctrl->line_coding.baud >> 24);
+      ctrl->buffer[4] = ctrl->line_coding.stop_bits;
+      ctrl->buffer[5] = ctrl->line_coding.parity;
+      ctrl->buffer[6] = ctrl->line_coding.data_bits;
+      return (ctrl_is_in(ctrl) != 0U) ? 7 : USB_CTRL_STALL;
+
+    case USB_CDC_SET_CONTROL_LINE_STATE:
+      if (ctrl_is_in(ctrl) != 0U)
+      {
+        return USB_CTRL_STALL;
+      }
+      ctrl->line_state = ctrl->setup.wValue & (USB_CDC_LINE_DTR | USB_CDC_LINE_RTS);
+      ctrl_line_changed(ctrl);
+      return 0;
+
+    case USB_CDC_SEND_BREAK:
+      return (ctrl_is_in(ctrl) == 0U) ? 0 : USB_CTRL_STALL;
+
+    default:
+      return USB_CTRL_STALL;
+  }
+}
+
+static int32_t ctrl_vendor(usb_ctrl *ctrl)
+{
+  uint32_t length;
+
+  if ((ctrl->setup.bRequest != USB_MSOS20_VENDOR_CODE) || (ctrl->setup.wIndex != USB_MSOS20_INDEX) ||
+      (ctrl_is_in(ctrl) == 0U))
+  {
+    return USB_CTRL_STALL;
+  }
+  length = usb_desc_msos20(ctrl->buffer, sizeof(ctrl->buffer));
+  return (length != 0U) ? (int32_t)length : USB_CTRL_STALL;
+}
+
+/**
+  * @brief  Carry out the setup in ctrl->setup.
+  * @retval Bytes of reply in the control buffer (IN), 0 when there is none
+  *         or the host's data stage is to follow, or USB_CTRL_STALL.
+  */
+static int32_t ctrl_request(usb_ctrl *ctrl)
+{
+  switch (ctrl->setup.bmRequestType & USB_REQ_TYPE_MASK)
+  {
+    case USB_REQ_STANDARD:
+      switch (ctrl->setup.bmRequestType & USB_REQ_RECIPIENT_MASK)
+      {
+        case USB_REQ_DEVICE:
+          return ctrl_standard_device(ctrl);
+        case USB_REQ_INTERFACE:
+          return ctrl_standard_interface(ctrl);
+        case USB_REQ_ENDPOINT:
+          return ctrl_standard_endpoint(ctrl);
+        default:
+          return USB_CTRL_STALL;
+      }
+
+    case USB_REQ_CLASS:
+      return ctrl_class(ctrl);
+
+    case USB_REQ_VENDOR:
+      return ctrl_vendor(ctrl);
+
+    default:
+      return USB_CTRL_STALL;
+  }
+}
+
+/* The data stage of SET_LINE_CODING is in the control buffer */
+static void ctrl_out_data(usb_ctrl *ctrl)
+{
+  if (ctrl->received < 7U)
+  {
+    ctrl_stall(ctrl);
+    return;
+  }
+  ctrl->line_coding.baud = (uint32_t)ctrl->buffer[0] | ((uint32_t)ctrl->buffer[1] << 8) |
+                           ((uint32_t)ctrl->buffer[2] << 16) | ((uint32_t)ctrl->buffer[3] << 24);
+  ctrl->line_coding.stop_bits = ctrl->buffer[4];
+  ctrl->line_coding.parity = ctrl->buffer[5];
+  ctrl->line_coding.data_bits = ctrl->buffer[6];
+  ctrl_line_changed(ctrl);
+  ctrl_status_in(ctrl);
+}
+
+static void ctrl_receive_next(usb_ctrl *ctrl)
+{
+  uint32_t size = ctrl->setup.wLength - ctrl->received;
+
+  ctrl->ops->receive(ctrl->ops->context, &ctrl->buffer[ctrl->received],
+                     (size < USB_FS_PACKET_SIZE) ? size : USB_FS_PACKET_SIZE);
+}
+
+void usb_ctrl_init(usb_ctrl *ctrl, const usb_ctrl_ops *ops, const char *serial)
+{
+  memset(ctrl, 0, sizeof(*ctrl));
+  ctrl->ops = ops;
+  ctrl->serial = serial;
+  usb_ctrl_reset(ctrl);
+}
+
+void usb_ctrl_reset(usb_ctrl *ctrl)
+{
+  ctrl->state = USB_STATE_DEFAULT;
+  ctrl->config = 0U;
+  ctrl->address = 0U;
+  ctrl->stage = USB_CTRL_IDLE;
+  ctrl->remaining = 0U;
+  ctrl->line_coding.baud = 115200U;
+  ctrl->line_coding.stop_bits = 0U;
+  ctrl->line_coding.parity = 0U;
+  ctrl->line_coding.data_bits = 8U;
+  ctrl->line_state = 0U;
+}
+
+void usb_ctrl_setup(usb_ctrl *ctrl, const uint8_t packet[8])
+{
+  int32_t reply;
+
+  ctrl->setups++;
+  ctrl->setup.bmRequestType = packet[0];
+  ctrl->setup.bRequest = packet[1];
+  ctrl->setup.wValue = (uint16_t)(packet[2] | (packet[3] << 8));
+  ctrl->setup.wIndex = (uint16_t)(packet[4] | (packet[5] << 8));
+  ctrl->setup.wLength = (uint16_t)(packet[6] | (packet[7] << 8));
+  ctrl->stage = USB_CTRL_IDLE;
+  ctrl->remaining = 0U;
+  ctrl->received = 0U;
+  ctrl->zlp = 0U;
+
+  /* Of the requests served, only SET_LINE_CODING has a data stage from the host */
+  if ((ctrl_is_in(ctrl) == 0U) && (ctrl->setup.wLength != 0U) &&
+      (((ctrl->setup.bmRequestType & USB_REQ_TYPE_MASK) != USB_REQ_CLASS) ||
+       (ctrl->setup.bRequest != USB_CDC_SET_LINE_CODING)))
+  {
+    ctrl_stall(ctrl);
+    return;
+  }
+
+  reply = ctrl_request(ctrl);
+  if (reply == USB_CTRL_STALL)
+  {
+    ctrl_stall(ctrl);
+  }
+  else if (ctrl_is_in(ctrl) != 0U)
+  {
+    ctrl_reply(ctrl, (uint32_t)reply);
+  }
+  else if (ctrl->setup.wLength != 0U)
+  {
+    ctrl->stage = USB_CTRL_DATA_OUT;
+    ctrl_receive_next(ctrl);
+  }
+  else
+  {
+    ctrl_status_in(ctrl);
+  }
+}
+
+void usb_ctrl_in_done(usb_ctrl *ctrl)
+{
+  switch (ctrl->stage)
+  {
+    case USB_CTRL_DATA_IN:
+      if (ctrl->remaining != 0U)
+      {
+        ctrl_send_next(ctrl);
+      }
+      else if (ctrl->zlp != 0U)
+      {
+        ctrl->zlp = 0U;
+        ctrl->ops->send(ctrl->ops->context, NULL, 0U);
+      }
+      else
+      {
+        ctrl_status_out(ctrl);
+      }
+      break;
+
+    case USB_CTRL_STATUS_IN:
+      ctrl->stage = USB_CTRL_IDLE;
+      break;
+
+    default:
+      break;
+  }
+}
+
+void usb_ctrl_out_done(usb_ctrl *ctrl, uint32_t size)
+{
+  switch (ctrl->stage)
+  {
+    case USB_CTRL_DATA_OUT:
+      if (size > ctrl->setup.wLength - ctrl->received)
+      {
+        ctrl_stall(ctrl);
+        break;
+      }
+      ctrl->received += size;
+      if ((ctrl->received == ctrl->setup.wLength) || (size < USB_FS_PACKET_SIZE))
+      {
+        ctrl_out_data(ctrl);
+      }
+      else
+      {
+        ctrl_receive_next(ctrl);
+      }
+      break;
+
+    case USB_CTRL_STATUS_OUT:
+      ctrl->stage = USB_CTRL_IDLE;
+      break;
+
+    default:
+      break;
+  }
+}
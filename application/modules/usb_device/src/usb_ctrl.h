@@ -0,0 +1,153 @@
+#ifndef USB_CTRL_H
+#define USB_CTRL_H
+
+#include <stdint.h>
+
+#include "usb_desc.h"
+
+/*
+ * Control transfers on endpoint 0: the standard requests of chapter 9, the
+ * CDC-ACM class requests and the MS OS 2.0 vendor request.
+ *
+ * The hardware is reached through usb_ctrl_ops. A request arrives as its
+ * 8-byte setup packet (usb_ctrl_setup()); replies go out from the control
+ * buffer one packet at a time, each acknowledged by usb_ctrl_in_done(),
+ * with a zero-length packet when the reply is shorter than asked and ends
+ * on a packet boundary. Data sent by the host (SET_LINE_CODING) is received
+ * a packet at a time into the buffer, each reported by usb_ctrl_out_done().
+ * Unsupported or malformed requests stall endpoint 0 until the next setup;
+ * a setup always abandons the request before it.
+ *
+ * SET_ADDRESS takes effect at once (ops->set_address()), before its status
+ * stage: the OTG core holds the new address back until the status stage is
+ * done, as the specification requires.
+ *
+ * HAL-free: the target glue is usb_device.c and the host check is
+ * tools/usb_ctrl_sim.c.
+ */
+#define USB_CTRL_BUFFER_SIZE   256U   /*!< Longest reply or host data stage */
+
+/* bmRequestType */
+#define USB_REQ_DIR_IN         0x80U
+#define USB_REQ_TYPE_MASK      0x60U
+#define USB_REQ_STANDARD       0x00U
+#define USB_REQ_CLASS          0x20U
+#define USB_REQ_VENDOR         0x40U
+#define USB_REQ_RECIPIENT_MASK 0x1FU
+#define USB_REQ_DEVICE         0x00U
+#define USB_REQ_INTERFACE      0x01U
+#define USB_REQ_ENDPOINT       0x02U
+
+/* Standard requests */
+#define USB_REQ_GET_STATUS         0x00U
+#define USB_REQ_CLEAR_FEATURE      0x01U
+#define USB_REQ_SET_FEATURE        0x03U
+#define USB_REQ_SET_ADDRESS        0x05U
+#define USB_REQ_GET_DESCRIPTOR     0x06U
+#define USB_REQ_GET_CONFIGURATION  0x08U
+#define USB_REQ_SET_CONFIGURATION  0x09U
+#define USB_REQ_GET_INTERFACE      0x0AU
+#define USB_REQ_SET_INTERFACE      0x0BU
+#define USB_FEATURE_ENDPOINT_HALT  0x00U
+
+/* CDC-ACM requests (PSTN 1.2, 6.3) */
+#define USB_CDC_SET_LINE_CODING        0x20U
+#define USB_CDC_GET_LINE_CODING        0x21U
+#define USB_CDC_SET_CONTROL_LINE_STATE 0x22U
+#define USB_CDC_SEND_BREAK             0x23U
+#define USB_CDC_LINE_DTR               0x01U
+#define USB_CDC_LINE_RTS               0x02U
+
+typedef struct
+{
+  uint8_t  bmRequestType;
+  uint8_t  bRequest;
+  uint16_t wValue;
+  uint16_t wIndex;
+  uint16_t wLength;
+} usb_setup;
+
+/* CDC line coding, 7 bytes little-endian on the wire */
+typedef struct
+{
+  uint32_t baud;
+  uint8_t  stop_bits;   /*!< 0: 1, 1: 1.5, 2: 2 */
+  uint8_t  parity;      /*!< 0: none, 1: odd, 2: even, 3: mark, 4: space */
+  uint8_t  data_bits;
+} usb_cdc_line_coding;
+
+typedef enum
+{
+  USB_CTRL_IDLE = 0,      /*!< Waiting for a setup */
+  USB_CTRL_DATA_IN,
+  USB_CTRL_DATA_OUT,
+  USB_CTRL_STATUS_IN,     /*!< Zero-length packet to the host */
+  USB_CTRL_STATUS_OUT,    /*!< Zero-length packet from the host */
+  USB_CTRL_STALLED
+} usb_ctrl_stage;
+
+typedef enum
+{
+  USB_STATE_DEFAULT = 0,
+  USB_STATE_ADDRESS,
+  USB_STATE_CONFIGURED
+} usb_device_state;
+
+typedef struct
+{
+  /* Endpoint 0. send() and receive() move at most one packet; size 0 is
+     a zero-length packet (status stages) */
+  void (*send)(void *context, const uint8_t *data, uint32_t size);
+  void (*receive)(void *context, uint8_t *data, uint32_t size);
+  void (*stall)(void *context);
+
+  void (*set_address)(void *context, uint8_t address);
+
+  /* Open the class endpoints for configuration 1, or close them for 0 */
+  void (*configure)(void *context, uint8_t config);
+
+  /* Halt or release a class endpoint; halted() reads it back */
+  void     (*set_halt)(void *context, uint8_t endpoint, uint8_t halt);
+  uint32_t (*halted)(void *context, uint8_t endpoint);
+
+  /* CDC settings from the host, may be NULL */
+  void (*line_changed)(void *context, const usb_cdc_line_coding *coding, uint16_t line_state);
+
+  void *context;
+} usb_ctrl_ops;
+
+typedef struct
+{
+  const usb_ctrl_ops *ops;
+  const char         *serial;
+
+  usb_device_state    state;
+  uint8_t             config;
+  uint8_t             address;
+
+  usb_ctrl_stage      stage;
+  usb_setup           setup;
+  const uint8_t      *data;        /*!< Next byte of the data stage */
+  uint32_t            remaining;   /*!< Bytes of the data stage still to move */
+  uint32_t            received;    /*!< Bytes of the host's data stage so far */
+  uint32_t            zlp;         /*!< A zero-length packet ends the data stage */
+
+  usb_cdc_line_coding line_coding;
+  uint16_t            line_state;  /*!< USB_CDC_LINE_xxx */
+
+  uint32_t            setups;
+  uint32_t            stalls;
+
+  uint8_t             buffer[USB_CTRL_BUFFER_SIZE] __attribute__((aligned(4)));
+} usb_ctrl;
+
+void usb_ctrl_init(usb_ctrl *ctrl, const usb_ctrl_ops *ops, const char *serial);
+
+/* Bus reset: back to the default state, configuration and address 0 */
+void usb_ctrl_reset(usb_ctrl *ctrl);
+
+void usb_ctrl_setup(usb_ctrl *ctrl, const uint8_t packet[8]);
+void usb_ctrl_in_done(usb_ctrl *ctrl);
+void usb_ctrl_out_done(usb_ctrl *ctrl, uint32_t size);
+
+#endif /* USB_CTRL_H */
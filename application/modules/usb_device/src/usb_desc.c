@@ -0,0 +1,308 @@
+#include <string.h>
+
+#include "usb_desc.h"
+
+#define USB_BCD_USB              0x0201U   /*!< 2.01: the host asks for the BOS */
+#define USB_MSOS20_WINDOWS       0x06030000U   /*!< Windows 8.1 and later */
+
+/* MS OS 2.0 descriptor types */
+#define USB_MSOS20_SET_HEADER    0x00U
+#define USB_MSOS20_CONFIG_SUBSET 0x01U
+#define USB_MSOS20_FUNCTION      0x02U
+#define USB_MSOS20_COMPATIBLE_ID 0x03U
+#define USB_MSOS20_PROPERTY      0x04U
+#define USB_MSOS20_REG_MULTI_SZ  0x07U
+
+static const char usb_desc_text[USB_STR_COUNT][20] =
+{
+  "",
+  "ML_LD",
+  "ML_LD sensor node",
+  "",
+  "ML_LD serial",
+  "ML_LD bulk",
+};
+
+/* {D8DD60DF-4589-4CC7-9CD2-659D9E648A9F}, as it goes on the wire */
+static const uint8_t usb_desc_msos20_uuid[16] =
+{
+  0xDF, 0x60, 0xDD, 0xD8, 0x89, 0x45, 0xC7, 0x4C, 0x9C, 0xD2, 0x65, 0x9D, 0x9E, 0x64, 0x8A, 0x9F
+};
+
+/* The interface GUID the host tools open the vendor interface by */
+static const char usb_desc_interface_guid[] = "{4C1C2A8B-6E0F-4E5B-9A43-3D1C5B7E2F10}";
+
+/* Descriptors are written through a cursor that stops counting room once full */
+typedef struct
+{
+  uint8_t  *buffer;
+  uint32_t capacity;
+  uint32_t length;
+} usb_desc_writer;
+
+static void put8(usb_desc_writer *w, uint32_t value)
+{
+  if (w->length < w->capacity)
+  {
+    w->buffer[w->length] = (uint8_t)value;
+  }
+  w->length++;
+}
+
+static void put16(usb_desc_writer *w, uint32_t value)
+{
+  put8(w, value);
+  put8(w, value >> 8);
+}
+
+static void put32(usb_desc_writer *w, uint32_t value)
+{
+  put16(w, value);
+  put16(w, value >> 16);
+}
+
+static void put_bytes(usb_desc_writer *w, const uint8_t *data, uint32_t size)
+{
+  while (size-- > 0U)
+  {
+    put8(w, *data++);
+  }
+}
+
+/* ASCII as UTF-16LE, with as many NULs after it as asked */
+static void put_utf16(usb_desc_writer *w, const char *text, uint32_t nuls)
+{
+  while (*text != '\0')
+  {
+    put16(w, (uint8_t)*text++);
+  }
+  while (nuls-- > 0U)
+  {
+    put16(w, 0U);
+  }
+}
+
+/* Patch a 16-bit length written earlier at @p at */
+static void patch16(usb_desc_writer *w, uint32_t at, uint32_t value)
+{
+  if (at + 1U < w->capacity)
+  {
+    w->buffer[at] = (uint8_t)value;
+    w->buffer[at + 1U] = (uint8_t)(value >> 8);
+  }
+}
+
+static uint32_t finish(const usb_desc_writer *w)
+{
+  return (w->length <= w->capacity) ? w->length : 0U;
+}
+
+static void put_endpoint(usb_desc_writer *w, uint32_t address, uint32_t type, uint32_t size, uint32_t interval)
+{
+  put8(w, 7U);
+  put8(w, USB_DESC_ENDPOINT);
+  put8(w, address);
+  put8(w, type);
+  put16(w, size);
+  put8(w, interval);
+}
+
+static void put_interface(usb_desc_writer *w, uint32_t number, uint32_t endpoints, uint32_t class,
+                          uint32_t subclass, uint32_t protocol, uint32_t string)
+{
+  put8(w, 9U);
+  put8(w, USB_DESC_INTERFACE);
+  put8(w, number);
+  put8(w, 0U);   /* bAlternateSetting */
+  put8(w, endpoints);
+  put8(w, class);
+  put8(w, subclass);
+  put8(w, protocol);
+  put8(w, string);
+}
+
+uint32_t usb_desc_device(uint8_t *buffer, uint32_t capacity)
+{
+  usb_desc_writer w = { buffer, capacity, 0U };
+
+  put8(&w, 18U);
+  put8(&w, USB_DESC_DEVICE);
+  put16(&w, USB_BCD_USB);
+  put8(&w, 0xEFU);   /* Miscellaneous: interface association */
+  put8(&w, 0x02U);
+  put8(&w, 0x01U);
+  put8(&w, USB_FS_PACKET_SIZE);
+  put16(&w, USB_DESC_VID);
+  put16(&w, USB_DESC_PID);
+  put16(&w, USB_DESC_BCD_DEVICE);
+  put8(&w, USB_STR_MANUFACTURER);
+  put8(&w, USB_STR_PRODUCT);
+  put8(&w, USB_STR_SERIAL);
+  put8(&w, 1U);      /* bNumConfigurations */
+  return finish(&w);
+}
+
+uint32_t usb_desc_config(uint8_t *buffer, uint32_t capacity)
+{
+  usb_desc_writer w = { buffer, capacity, 0U };
+
+  put8(&w, 9U);
+  put8(&w, USB_DESC_CONFIGURATION);
+  put16(&w, 0U);     /* wTotalLength, patched */
+  put8(&w, USB_IFACE_COUNT);
+  put8(&w, USB_CONFIG_VALUE);
+  put8(&w, 0U);
+  put8(&w, 0x80U);   /* Bus powered */
+  put8(&w, USB_MAX_POWER_MA / 2U);
+
+  /* CDC-ACM function (USB CDC 1.2, PSTN 1.2) */
+  put8(&w, 8U);
+  put8(&w, USB_DESC_IAD);
+  put8(&w, USB_IFACE_CDC_COMM);
+  put8(&w, 2U);
+  put8(&w, 0x02U);   /* Communications */
+  put8(&w, 0x02U);   /* Abstract control model */
+  put8(&w, 0x01U);   /* AT commands: what hosts match on */
+  put8(&w, USB_STR_CDC);
+
+  put_interface(&w, USB_IFACE_CDC_COMM, 1U, 0x02U, 0x02U, 0x01U, USB_STR_CDC);
+  put8(&w, 5U);      /* Header */
+  put8(&w, USB_DESC_CS_INTERFACE);
+  put8(&w, 0x00U);
+  put16(&w, 0x0120U);
+  put8(&w, 5U);      /* Call management: none, data on the data interface */
+  put8(&w, USB_DESC_CS_INTERFACE);
+  put8(&w, 0x01U);
+  put8(&w, 0x00U);
+  put8(&w, USB_IFACE_CDC_DATA);
+  put8(&w, 4U);      /* ACM: line coding, line state and break */
+  put8(&w, USB_DESC_CS_INTERFACE);
+  put8(&w, 0x02U);
+  put8(&w, 0x06U);
+  put8(&w, 5U);      /* Union */
+  put8(&w, USB_DESC_CS_INTERFACE);
+  put8(&w, 0x06U);
+  put8(&w, USB_IFACE_CDC_COMM);
+  put8(&w, USB_IFACE_CDC_DATA);
+  put_endpoint(&w, USB_EP_CDC_NOTIFY, 0x03U, USB_NOTIFY_PACKET_SIZE, USB_NOTIFY_INTERVAL);
+
+  put_interface(&w, USB_IFACE_CDC_DATA, 2U, 0x0AU, 0x00U, 0x00U, 0U);
+  put_endpoint(&w, USB_EP_CDC_OUT, 0x02U, USB_FS_PACKET_SIZE, 0U);
+  put_endpoint(&w, USB_EP_CDC_IN, 0x02U, USB_FS_PACKET_SIZE, 0U);
+
+  put_interface(&w, USB_IFACE_VENDOR, 2U, 0xFFU, 0x00U, 0x00U, USB_STR_VENDOR);
+  put_endpoint(&w, USB_EP_VENDOR_OUT, 0x02U, USB_FS_PACKET_SIZE, 0U);
+  put_endpoint(&w, USB_EP_VENDOR_IN, 0x02U, USB_FS_PACKET_SIZE, 0U);
+
+  patch16(&w, 2U, w.length);
+  return finish(&w);
+}
+
+/* Descriptor set for WinUSB on the vendor interface, within configuration index 0 */
+static void msos20_write(usb_desc_writer *w)
+{
+  uint32_t config;
+  uint32_t function;
+
+  put16(w, 10U);
+  put16(w, USB_MSOS20_SET_HEADER);
+  put32(w, USB_MSOS20_WINDOWS);
+  put16(w, 0U);     /* wTotalLength, patched */
+
+  config = w->length;
+  put16(w, 8U);
+  put16(w, USB_MSOS20_CONFIG_SUBSET);
+  put8(w, 0U);      /* Configuration index, not value */
+  put8(w, 0U);
+  put16(w, 0U);     /* wTotalLength, patched */
+
+  function = w->length;
+  put16(w, 8U);
+  put16(w, USB_MSOS20_FUNCTION);
+  put8(w, USB_IFACE_VENDOR);
+  put8(w, 0U);
+  put16(w, 0U);     /* wSubsetLength, patched */
+
+  put16(w, 20U);
+  put16(w, USB_MSOS20_COMPATIBLE_ID);
+  put_bytes(w, (const uint8_t *)"WINUSB\0\0\0\0\0\0\0\0\0\0", 16U);
+
+  put16(w, 10U + 42U + 80U);
+  put16(w, USB_MSOS20_PROPERTY);
+  put16(w, USB_MSOS20_REG_MULTI_SZ);
+  put16(w, 42U);
+  put_utf16(w, "DeviceInterfaceGUIDs", 1U);
+  put16(w, 80U);
+  put_utf16(w, usb_desc_interface_guid, 2U);
+
+  patch16(w, 8U, w->length);
+  patch16(w, config + 6U, w->length - config);
+  patch16(w, function + 6U, w->length - function);
+}
+
+uint32_t usb_desc_bos(uint8_t *buffer, uint32_t capacity)
+{
+  usb_desc_writer w = { buffer, capacity, 0U };
+  usb_desc_writer set = { NULL, 0U, 0U };
+
+  msos20_write(&set);   /* Length only */
+
+  put8(&w, 5U);
+  put8(&w, USB_DESC_BOS);
+  put16(&w, 0U);     /* wTotalLength, patched */
+  put8(&w, 1U);
+
+  /* Microsoft OS 2.0 platform capability */
+  put8(&w, 28U);
+  put8(&w, USB_DESC_CAPABILITY);
+  put8(&w, 0x05U);   /* Platform */
+  put8(&w, 0x00U);
+  put_bytes(&w, usb_desc_msos20_uuid, sizeof(usb_desc_msos20_uuid));
+  put32(&w, USB_MSOS20_WINDOWS);
+  put16(&w, set.length);
+  put8(&w, USB_MSOS20_VENDOR_CODE);
+  put8(&w, 0U);      /* No alternate enumeration */
+
+  patch16(&w, 2U, w.length);
+  return finish(&w);
+}
+
+uint32_t usb_desc_msos20(uint8_t *buffer, uint32_t capacity)
+{
+  usb_desc_writer w = { buffer, capacity, 0U };
+
+  msos20_write(&w);
+  return finish(&w);
+}
+
+uint32_t usb_desc_string(uint32_t index, const char *serial, uint8_t *buffer, uint32_t capacity)
+{
+  usb_desc_writer w = { buffer, capacity, 0U };
+  const char *text;
+
+  if (index >= USB_STR_COUNT)
+  {
+    return 0U;
+  }
+  text = ((index == USB_STR_SERIAL) && (serial != NULL)) ? serial : usb_desc_text[index];
+  if (strlen(text) > 126U)
+  {
+    return 0U;
+  }
+
+  put8(&w, 0U);      /* bLength, patched */
+  put8(&w, USB_DESC_STRING);
+  if (index == USB_STR_LANGID)
+  {
+    put16(&w, 0x0409U);   /* English (United States) */
+  }
+  else
+  {
+    put_utf16(&w, text, 0U);
+  }
+  if (w.capacity > 0U)
+  {
+    w.buffer[0] = (uint8_t)w.length;
+  }
+  return finish(&w);
+}
@@ -0,0 +1,87 @@
+#ifndef USB_DESC_H
+#define USB_DESC_H
+
+#include <stdint.h>
+
+/*
+ * Descriptors of the USB device: a full-speed composite of a CDC-ACM port
+ * and a vendor-specific bulk interface.
+ *
+ *  Interface 0  CDC communication   EP 0x83 interrupt IN (notifications)
+ *  Interface 1  CDC data            EP 0x01 bulk OUT, EP 0x81 bulk IN
+ *  Interface 2  vendor (0xFF)       EP 0x02 bulk OUT, EP 0x82 bulk IN
+ *
+ * Interfaces 0 and 1 are tied by an interface association, so the device
+ * class is the IAD triple (0xEF/0x02/0x01) and every host binds its own
+ * ACM driver. bcdUSB is 2.01 for the BOS descriptor, which carries a
+ * Microsoft OS 2.0 platform capability: Windows then binds WinUSB to the
+ * vendor interface with no INF; libusb and Linux need nothing.
+ *
+ * Each usb_desc_xxx() writes one descriptor into a caller's buffer and
+ * returns its full length, or 0 if it does not fit. HAL-free, built on the
+ * host by tools/usb_ctrl_sim.c.
+ */
+#ifndef USB_DESC_VID
+#define USB_DESC_VID             0x0483U   /*!< STMicroelectronics */
+#endif
+#ifndef USB_DESC_PID
+#define USB_DESC_PID             0x5750U   /*!< Development ID; set both for a product */
+#endif
+#define USB_DESC_BCD_DEVICE      0x0100U
+
+#define USB_FS_PACKET_SIZE       64U       /*!< Bulk and control, full speed */
+#define USB_NOTIFY_PACKET_SIZE   16U
+#define USB_NOTIFY_INTERVAL      16U       /*!< Frames */
+
+#define USB_IFACE_CDC_COMM       0U
+#define USB_IFACE_CDC_DATA       1U
+#define USB_IFACE_VENDOR         2U
+#define USB_IFACE_COUNT          3U
+
+#define USB_EP_CDC_OUT           0x01U
+#define USB_EP_CDC_IN            0x81U
+#define USB_EP_VENDOR_OUT        0x02U
+#define USB_EP_VENDOR_IN         0x82U
+#define USB_EP_CDC_NOTIFY        0x83U
+#define USB_EP_DIR_IN            0x80U
+
+#define USB_CONFIG_VALUE         1U
+#define USB_MAX_POWER_MA         100U
+
+/* String indices */
+#define USB_STR_LANGID           0U
+#define USB_STR_MANUFACTURER     1U
+#define USB_STR_PRODUCT          2U
+#define USB_STR_SERIAL           3U
+#define USB_STR_CDC              4U
+#define USB_STR_VENDOR           5U
+#define USB_STR_COUNT            6U
+
+/* Vendor request that returns the MS OS 2.0 descriptor set (wIndex 7) */
+#define USB_MSOS20_VENDOR_CODE   0x20U
+#define USB_MSOS20_INDEX         7U
+
+/* Descriptor types */
+#define USB_DESC_DEVICE          1U
+#define USB_DESC_CONFIGURATION   2U
+#define USB_DESC_STRING          3U
+#define USB_DESC_INTERFACE       4U
+#define USB_DESC_ENDPOINT        5U
+#define USB_DESC_QUALIFIER       6U
+#define USB_DESC_IAD             11U
+#define USB_DESC_BOS             15U
+#define USB_DESC_CAPABILITY      16U
+#define USB_DESC_CS_INTERFACE    0x24U
+
+uint32_t usb_desc_device(uint8_t *buffer, uint32_t capacity);
+uint32_t usb_desc_config(uint8_t *buffer, uint32_t capacity);
+uint32_t usb_desc_bos(uint8_t *buffer, uint32_t capacity);
+uint32_t usb_desc_msos20(uint8_t *buffer, uint32_t capacity);
+
+/**
+  * @brief  String descriptor @p index, UTF-16LE from ASCII.
+  * @param  serial  Text of USB_STR_SERIAL, at most 126 characters.
+  */
+uint32_t usb_desc_string(uint32_t index, const char *serial, uint8_t *buffer, uint32_t capacity);
+
+#endif /* USB_DESC_H */
@@ -0,0 +1,545 @@
+#include <string.h>
+
+#include "usb_device.h"
+#include "dma_manager.h"
+#include "irq_config.h"
+
+#define USB_DEV_ENDPOINTS   9U   /*!< Per direction, OTG1 and OTG2 alike */
+
+typedef struct
+{
+  uint8_t               *Data;
+  uint32_t               Size;
+  USBDev_CallbackTypeDef Callback;
+  void                  *Context;
+} USBDev_JobTypeDef;
+
+typedef struct
+{
+  USBDev_JobTypeDef Queue[USB_DEV_QUEUE_DEPTH];
+  uint32_t          Head;
+  volatile uint32_t Count;
+  uint32_t          Zlp;       /*!< The head job's zero-length packet is on the endpoint */
+  uint32_t          Halted;
+} USBDev_QueueTypeDef;
+
+static const uint8_t usb_dev_ep_in[USB_DEV_PIPES]  = { USB_EP_CDC_IN, USB_EP_VENDOR_IN };
+static const uint8_t usb_dev_ep_out[USB_DEV_PIPES] = { USB_EP_CDC_OUT, USB_EP_VENDOR_OUT };
+
+/* In AXI SRAM with the rest of .bss: the DMA reads the setup packet and the control buffer */
+static PCD_HandleTypeDef   usb_dev_pcd;
+static usb_ctrl            usb_dev_ctrl;
+static USBDev_QueueTypeDef usb_dev_tx[USB_DEV_PIPES];
+static USBDev_QueueTypeDef usb_dev_rx[USB_DEV_PIPES];
+static volatile uint32_t   usb_dev_open;   /* Class endpoints open */
+static char                usb_dev_serial[25];
+
+static USBDev_StatsTypeDef usb_dev_stats;
+
+/* ------------------------------------------------------------------------ */
+/* usb_ctrl_ops                                                              */
+
+static void usb_dev_ep0_send(void *context, const uint8_t *data, uint32_t size)
+{
+  (void)context;
+  (void)HAL_PCD_EP_Transmit(&usb_dev_pcd, 0x80U, (uint8_t *)data, size);
+}
+
+static void usb_dev_ep0_receive(void *context, uint8_t *data, uint32_t size)
+{
+  (void)context;
+  (void)HAL_PCD_EP_Receive(&usb_dev_pcd, 0x00U, data, size);
+}
+
+static void usb_dev_ep0_stall(void *context)
+{
+  (void)context;
+  usb_dev_stats.Stalls++;
+  (void)HAL_PCD_EP_SetStall(&usb_dev_pcd, 0x80U);
+  (void)HAL_PCD_EP_SetStall(&usb_dev_pcd, 0x00U);
+}
+
+static void usb_dev_set_address(void *context, uint8_t address)
+{
+  (void)context;
+  (void)HAL_PCD_SetAddress(&usb_dev_pcd, address);
+}
+
+/* Fail every job of the queue, oldest first */
+static void usb_dev_fail(USBDev_QueueTypeDef *queue)
+{
+  USBDev_JobTypeDef job;
+
+  queue->Zlp = 0U;
+  while (queue->Count != 0U)
+  {
+    job = queue->Queue[queue->Head];
+    queue->Head = (queue->Head + 1U) % USB_DEV_QUEUE_DEPTH;
+    queue->Count--;
+    usb_dev_stats.Failed++;
+    if (job.Callback != NULL)
+    {
+      job.Callback(HAL_ERROR, 0U, job.Context);
+    }
+  }
+}
+
+static void usb_dev_fail_all(void)
+{
+  uint32_t pipe;
+
+  usb_dev_open = 0U;
+  for (pipe = 0U; pipe < USB_DEV_PIPES; pipe++)
+  {
+    usb_dev_fail(&usb_dev_tx[pipe]);
+    usb_dev_fail(&usb_dev_rx[pipe]);
+    usb_dev_tx[pipe].Halted = 0U;
+    usb_dev_rx[pipe].Halted = 0U;
+  }
+}
+
+static void usb_dev_configure(void *context, uint8_t config)
+{
+  uint32_t pipe;
+
+  (void)context;
+  if (config == 0U)
+  {
+    usb_dev_fail_all();
+    for (pipe = 0U; pipe < USB_DEV_PIPES; pipe++)
+    {
+      (void)HAL_PCD_EP_Close(&usb_dev_pcd, usb_dev_ep_in[pipe]);
+      (void)HAL_PCD_EP_Close(&usb_dev_pcd, usb_dev_ep_out[pipe]);
+    }
+    (void)HAL_PCD_EP_Close(&usb_dev_pcd, USB_EP_CDC_NOTIFY);
+    return;
+  }
+
+  for (pipe = 0U; pipe < USB_DEV_PIPES; pipe++)
+  {
+    (void)HAL_PCD_EP_Open(&usb_dev_pcd, usb_dev_ep_in[pipe], USB_FS_PACKET_SIZE, EP_TYPE_BULK);
+    (void)HAL_PCD_EP_Open(&usb_dev_pcd, usb_dev_ep_out[pipe], USB_FS_PACKET_SIZE, EP_TYPE_BULK);
+  }
+  (void)HAL_PCD_EP_Open(&usb_dev_pcd, USB_EP_CDC_NOTIFY, USB_NOTIFY_PACKET_SIZE, EP_TYPE_INTR);
+  usb_dev_open = 1U;
+}
+
+static USBDev_QueueTypeDef *usb_dev_queue(uint8_t endpoint)
+{
+  uint32_t pipe;
+
+  for (pipe = 0U; pipe < USB_DEV_PIPES; pipe++)
+  {
+    if (endpoint == usb_dev_ep_in[pipe])
+    {
+      return &usb_dev_tx[pipe];
+    }
+    if (endpoint == usb_dev_ep_out[pipe])
+    {
+      return &usb_dev_rx[pipe];
+    }
+  }
+  return NULL;
+}
+
+/* A halt aborts the endpoint's transfer and fails its queue */
+static void usb_dev_set_halt(void *context, uint8_t endpoint, uint8_t halt)
+{
+  USBDev_QueueTypeDef *queue = usb_dev_queue(endpoint);
+
+  (void)context;
+  if (halt != 0U)
+  {
+    (void)HAL_PCD_EP_Abort(&usb_dev_pcd, endpoint);
+    (void)HAL_PCD_EP_SetStall(&usb_dev_pcd, endpoint);
+    if (queue != NULL)
+    {
+      queue->Halted = 1U;
+      usb_dev_fail(queue);
+    }
+  }
+  else
+  {
+    (void)HAL_PCD_EP_ClrStall(&usb_dev_pcd, endpoint);
+    if (queue != NULL)
+    {
+      queue->Halted = 0U;
+    }
+  }
+}
+
+static uint32_t usb_dev_halted(void *context, uint8_t endpoint)
+{
+  const PCD_EPTypeDef *ep = ((endpoint & USB_EP_DIR_IN) != 0U) ? &usb_dev_pcd.IN_ep[endpoint & 0x0FU]
+                                                               : &usb_dev_pcd.OUT_ep[endpoint & 0x0FU];
+
+  (void)context;
+  return (ep->is_stall != 0U) ? 1U : 0U;
+}
+
+static const usb_ctrl_ops usb_dev_ops =
+{
+  .send = usb_dev_ep0_send,
+  .receive = usb_dev_ep0_receive,
+  .stall = usb_dev_ep0_stall,
+  .set_address = usb_dev_set_address,
+  .configure = usb_dev_configure,
+  .set_halt = usb_dev_set_halt,
+  .halted = usb_dev_halted,
+  .line_changed = NULL,
+  .context = NULL,
+};
+
+/* ------------------------------------------------------------------------ */
+/* Bulk queues                                                               */
+
+/**
+  * @brief  Gives the head job of the queue to the core. Caller masks interrupts
+  *         or is the USB interrupt.
+  */
+static void usb_dev_start(const USBDev_QueueTypeDef *queue, uint8_t endpoint)
+{
+  const USBDev_JobTypeDef *job = &queue->Queue[queue->Head];
+
+  if ((endpoint & USB_EP_DIR_IN) != 0U)
+  {
+    DMAMgr_CacheClean((uint32_t)job->Data, job->Size);
+    (void)HAL_PCD_EP_Transmit(&usb_dev_pcd, endpoint, job->Data, job->Size);
+  }
+  else
+  {
+    (void)HAL_PCD_EP_Receive(&usb_dev_pcd, endpoint, job->Data, job->Size);
+  }
+}
+
+static HAL_StatusTypeDef usb_dev_submit(USBDev_QueueTypeDef *queue, uint8_t endpoint, void *data, uint32_t size,
+                                        USBDev_CallbackTypeDef callback, void *context)
+{
+  USBDev_JobTypeDef *job;
+  uint32_t primask;
+
+  if ((size > USB_DEV_MAX_TRANSFER) || (((uint32_t)data & 3U) != 0U) ||
+      ((size != 0U) && (DMAMgr_IsReachable(DMA_MGR_DMA1, (uint32_t)data) == 0U)))   /* The OTG DMA sees what DMA1 sees */
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if ((usb_dev_open == 0U) || (queue->Halted != 0U))
+  {
+    __set_PRIMASK(primask);
+    return HAL_ERROR;
+  }
+  if (queue->Count == USB_DEV_QUEUE_DEPTH)
+  {
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+
+  job = &queue->Queue[(queue->Head + queue->Count) % USB_DEV_QUEUE_DEPTH];
+  job->Data = (uint8_t *)data;
+  job->Size = size;
+  job->Callback = callback;
+  job->Context = context;
+  queue->Count++;
+  if (queue->Count == 1U)
+  {
+    usb_dev_start(queue, endpoint);
+  }
+
+  __set_PRIMASK(primask);
+  return HAL_OK;
+}
+
+/* The head transfer is done: start the next, then report this one */
+static void usb_dev_complete(USBDev_QueueTypeDef *queue, uint8_t endpoint, uint32_t size)
+{
+  USBDev_JobTypeDef job = queue->Queue[queue->Head];
+
+  queue->Head = (queue->Head + 1U) % USB_DEV_QUEUE_DEPTH;
+  queue->Count--;
+  if (queue->Count != 0U)
+  {
+    usb_dev_start(queue, endpoint);
+  }
+  if (job.Callback != NULL)
+  {
+    job.Callback(HAL_OK, size, job.Context);
+  }
+}
+
+static void usb_dev_in_done(USBDev_PipeTypeDef pipe)
+{
+  USBDev_QueueTypeDef *queue = &usb_dev_tx[pipe];
+  const USBDev_JobTypeDef *job = &queue->Queue[queue->Head];
+
+  if (queue->Count == 0U)
+  {
+    return;
+  }
+  if (queue->Zlp != 0U)
+  {
+    queue->Zlp = 0U;
+  }
+  else if ((pipe == USB_DEV_CDC) && (job->Size != 0U) && ((job->Size % USB_FS_PACKET_SIZE) == 0U))
+  {
+    queue->Zlp = 1U;
+    (void)HAL_PCD_EP_Transmit(&usb_dev_pcd, usb_dev_ep_in[pipe], job->Data, 0U);
+    return;
+  }
+
+  usb_dev_stats.TxTransfers[pipe]++;
+  usb_dev_stats.TxBytes[pipe] += job->Size;
+  usb_dev_complete(queue, usb_dev_ep_in[pipe], job->Size);
+}
+
+static void usb_dev_out_done(USBDev_PipeTypeDef pipe)
+{
+  USBDev_QueueTypeDef *queue = &usb_dev_rx[pipe];
+  const USBDev_JobTypeDef *job = &queue->Queue[queue->Head];
+  uint32_t size;
+
+  if (queue->Count == 0U)
+  {
+    return;
+  }
+  size = HAL_PCD_EP_GetRxCount(&usb_dev_pcd, usb_dev_ep_out[pipe]);
+  DMAMgr_CacheInvalidate((uint32_t)job->Data, size);
+
+  usb_dev_stats.RxTransfers[pipe]++;
+  usb_dev_stats.RxBytes[pipe] += size;
+  usb_dev_complete(queue, usb_dev_ep_out[pipe], size);
+}
+
+/* ------------------------------------------------------------------------ */
+/* API                                                                       */
+
+/* The 96-bit unique ID, in hex */
+static void usb_dev_make_serial(void)
+{
+  static const char hex[] = "0123456789ABCDEF";
+  const uint32_t *uid = (const uint32_t *)UID_BASE;
+  uint32_t i;
+
+  for (i = 0U; i < 24U; i++)
+  {
+    usb_dev_serial[i] = hex[(uid[i / 8U] >> (28U - 4U * (i % 8U))) & 0xFU];
+  }
+  usb_dev_serial[24] = '\0';
+}
+
+HAL_StatusTypeDef USBDev_Init(const USBDev_ConfigTypeDef *config)
+{
+  GPIO_InitTypeDef   gpio = {0};
+  RCC_CRSInitTypeDef crs = {0};
+  uint32_t           otg1 = (config->Instance == USB_OTG_HS) ? 1U : 0U;
+  IRQn_Type          irq = (otg1 != 0U) ? OTG_HS_IRQn : OTG_FS_IRQn;
+
+  if ((otg1 == 0U) && (config->Instance != USB_OTG_FS))
+  {
+    return HAL_ERROR;
+  }
+
+  memset(usb_dev_tx, 0, sizeof(usb_dev_tx));
+  memset(usb_dev_rx, 0, sizeof(usb_dev_rx));
+  usb_dev_open = 0U;
+  USBDev_ResetStats();
+  usb_dev_make_serial();
+  usb_ctrl_init(&usb_dev_ctrl, &usb_dev_ops, usb_dev_serial);
+
+  /* Kernel clock: HSI48 (on since SystemClock_Config()), locked to the SOFs by the CRS */
+  __HAL_RCC_USB_CONFIG(RCC_USBCLKSOURCE_HSI48);
+  __HAL_RCC_CRS_CLK_ENABLE();
+  crs.Prescaler = RCC_CRS_SYNC_DIV1;
+  crs.Source = (otg1 != 0U) ? RCC_CRS_SYNC_SOURCE_USB1 : RCC_CRS_SYNC_SOURCE_USB2;
+  crs.Polarity = RCC_CRS_SYNC_POLARITY_RISING;
+  crs.ReloadValue = __HAL_RCC_CRS_RELOADVALUE_CALCULATE(48000000U, 1000U);
+  crs.ErrorLimitValue = RCC_CRS_ERRORLIMIT_DEFAULT;
+  crs.HSI48CalibrationValue = RCC_CRS_HSI48CALIBRATION_DEFAULT;
+  HAL_RCCEx_CRSConfig(&crs);
+  HAL_PWREx_EnableUSBVoltageDetector();
+
+  gpio.Mode = GPIO_MODE_AF_PP;
+  gpio.Pull = GPIO_NOPULL;
+  gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  if (otg1 != 0U)
+  {
+    __HAL_RCC_GPIOB_CLK_ENABLE();
+    gpio.Pin = GPIO_PIN_14 | GPIO_PIN_15;
+    gpio.Alternate = GPIO_AF12_OTG1_FS;
+    HAL_GPIO_Init(GPIOB, &gpio);
+    __HAL_RCC_USB1_OTG_HS_CLK_ENABLE();
+    /* No ULPI PHY: its clock must stay off in sleep or the core stops on WFI */
+    __HAL_RCC_USB1_OTG_HS_ULPI_CLK_SLEEP_DISABLE();
+  }
+  else
+  {
+    __HAL_RCC_GPIOA_CLK_ENABLE();
+    gpio.Pin = GPIO_PIN_11 | GPIO_PIN_12;
+    gpio.Alternate = GPIO_AF10_OTG2_FS;
+    HAL_GPIO_Init(GPIOA, &gpio);
+    __HAL_RCC_USB2_OTG_FS_CLK_ENABLE();
+  }
+
+  usb_dev_pcd.Instance = config->Instance;
+  usb_dev_pcd.Init.dev_endpoints = USB_DEV_ENDPOINTS;
+  usb_dev_pcd.Init.speed = PCD_SPEED_FULL;
+  usb_dev_pcd.Init.dma_enable = ENABLE;   /* HAL_PCD_Init() turns it off on OTG2 */
+  usb_dev_pcd.Init.phy_itface = PCD_PHY_EMBEDDED;
+  usb_dev_pcd.Init.Sof_enable = DISABLE;
+  usb_dev_pcd.Init.low_power_enable = DISABLE;
+  usb_dev_pcd.Init.lpm_enable = DISABLE;
+  usb_dev_pcd.Init.battery_charging_enable = DISABLE;
+  usb_dev_pcd.Init.vbus_sensing_enable = DISABLE;   /* Bus powered: VBUS is always there */
+  usb_dev_pcd.Init.use_dedicated_ep1 = DISABLE;
+  if (HAL_PCD_Init(&usb_dev_pcd) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  (void)HAL_PCDEx_SetRxFiFo(&usb_dev_pcd, USB_DEV_RX_FIFO_WORDS);
+  (void)HAL_PCDEx_SetTxFiFo(&usb_dev_pcd, 0U, USB_DEV_EP0_FIFO_WORDS);
+  (void)HAL_PCDEx_SetTxFiFo(&usb_dev_pcd, USB_EP_CDC_IN & 0x0FU, USB_DEV_CDC_FIFO_WORDS);
+  (void)HAL_PCDEx_SetTxFiFo(&usb_dev_pcd, USB_EP_VENDOR_IN & 0x0FU, USB_DEV_VENDOR_FIFO_WORDS);
+  (void)HAL_PCDEx_SetTxFiFo(&usb_dev_pcd, USB_EP_CDC_NOTIFY & 0x0FU, USB_DEV_NOTIFY_FIFO_WORDS);
+
+  IRQ_Config_SetPriority(irq, config->IrqPriority);
+  HAL_NVIC_EnableIRQ(irq);
+
+  return HAL_PCD_Start(&usb_dev_pcd);
+}
+
+uint32_t USBDev_IsConfigured(void)
+{
+  return usb_dev_open;
+}
+
+HAL_StatusTypeDef USBDev_Transmit(USBDev_PipeTypeDef pipe, const void *data, uint32_t size,
+                                  USBDev_CallbackTypeDef callback, void *context)
+{
+  if (pipe >= USB_DEV_PIPES)
+  {
+    return HAL_ERROR;
+  }
+  return usb_dev_submit(&usb_dev_tx[pipe], usb_dev_ep_in[pipe], (void *)data, size, callback, context);
+}
+
+HAL_StatusTypeDef USBDev_Receive(USBDev_PipeTypeDef pipe, void *data, uint32_t size,
+                                 USBDev_CallbackTypeDef callback, void *context)
+{
+  if ((pipe >= USB_DEV_PIPES) || (size == 0U) || ((size % USB_FS_PACKET_SIZE) != 0U))
+  {
+    return HAL_ERROR;
+  }
+  return usb_dev_submit(&usb_dev_rx[pipe], usb_dev_ep_out[pipe], data, size, callback, context);
+}
+
+uint32_t USBDev_TxQueued(USBDev_PipeTypeDef pipe)
+{
+  return (pipe < USB_DEV_PIPES) ? usb_dev_tx[pipe].Count : 0U;
+}
+
+void USBDev_GetLineCoding(usb_cdc_line_coding *coding, uint32_t *line_state)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *coding = usb_dev_ctrl.line_coding;
+  *line_state = usb_dev_ctrl.line_state;
+  __set_PRIMASK(primask);
+}
+
+void USBDev_GetStats(USBDev_StatsTypeDef *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *stats = usb_dev_stats;
+  __set_PRIMASK(primask);
+}
+
+void USBDev_ResetStats(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  memset(&usb_dev_stats, 0, sizeof(usb_dev_stats));
+  __set_PRIMASK(primask);
+}
+
+/* ------------------------------------------------------------------------ */
+/* HAL PCD callbacks and vectors                                             */
+
+void HAL_PCD_SetupStageCallback(PCD_HandleTypeDef *hpcd)
+{
+  usb_dev_stats.Setups++;
+  usb_ctrl_setup(&usb_dev_ctrl, (const uint8_t *)hpcd->Setup);
+}
+
+void HAL_PCD_DataInStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
+{
+  (void)hpcd;
+  if (epnum == 0U)
+  {
+    usb_ctrl_in_done(&usb_dev_ctrl);
+  }
+  else if (epnum == (USB_EP_CDC_IN & 0x0FU))
+  {
+    usb_dev_in_done(USB_DEV_CDC);
+  }
+  else if (epnum == (USB_EP_VENDOR_IN & 0x0FU))
+  {
+    usb_dev_in_done(USB_DEV_VENDOR);
+  }
+}
+
+void HAL_PCD_DataOutStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
+{
+  if (epnum == 0U)
+  {
+    usb_ctrl_out_done(&usb_dev_ctrl, HAL_PCD_EP_GetRxCount(hpcd, 0x00U));
+  }
+  else if (epnum == USB_EP_CDC_OUT)
+  {
+    usb_dev_out_done(USB_DEV_CDC);
+  }
+  else if (epnum == USB_EP_VENDOR_OUT)
+  {
+    usb_dev_out_done(USB_DEV_VENDOR);
+  }
+}
+
+/* Raised at the end of a bus reset, once the speed is known */
+void HAL_PCD_ResetCallback(PCD_HandleTypeDef *hpcd)
+{
+  usb_dev_stats.Resets++;
+  usb_dev_fail_all();
+  usb_ctrl_reset(&usb_dev_ctrl);
+  (void)HAL_PCD_EP_Open(hpcd, 0x00U, USB_FS_PACKET_SIZE, EP_TYPE_CTRL);
+  (void)HAL_PCD_EP_Open(hpcd, 0x80U, USB_FS_PACKET_SIZE, EP_TYPE_CTRL);
+}
+
+void HAL_PCD_SuspendCallback(PCD_HandleTypeDef *hpcd)
+{
+  (void)hpcd;
+  usb_dev_stats.Suspends++;
+}
+
+void HAL_PCD_DisconnectCallback(PCD_HandleTypeDef *hpcd)
+{
+  (void)hpcd;
+  usb_dev_fail_all();
+  usb_ctrl_reset(&usb_dev_ctrl);
+}
+
+void OTG_HS_IRQHandler(void)
+{
+  HAL_PCD_IRQHandler(&usb_dev_pcd);
+}
+
+void OTG_FS_IRQHandler(void)
+{
+  HAL_PCD_IRQHandler(&usb_dev_pcd);
+}
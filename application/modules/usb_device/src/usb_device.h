@@ -0,0 +1,99 @@
+#ifndef USB_DEVICE_H
+#define USB_DEVICE_H
+
+#include "stm32h7xx_hal.h"
+#include "usb_ctrl.h"
+
+/*
+ * USB device, full speed, over HAL PCD: a CDC-ACM port and a vendor bulk
+ * interface (usb_desc.h), enumerated by usb_ctrl.h.
+ *
+ * Bulk data moves zero-copy. USBDev_Transmit() and USBDev_Receive() give the
+ * caller's buffer to the core as one transfer of up to USB_DEV_MAX_TRANSFER
+ * bytes; the OTG internal DMA moves it between memory and the endpoint FIFO
+ * packet by packet, and there is one interrupt at its end rather than one
+ * per packet. Each direction of each pipe queues USB_DEV_QUEUE_DEPTH
+ * transfers, and the interrupt starts the next before it runs the callback
+ * of the one done, so a producer that keeps the queue fed has the endpoint
+ * busy in every frame: up to 19 packets, 1.216 MB/s of bulk payload at full
+ * speed. The FIFOs are sized for that: the vendor IN FIFO holds a frame of
+ * packets, the CDC one half of that, and the shared receive FIFO 16. A
+ * transfer of at least USB_DEV_FIFO_BYTES keeps the FIFO topped up for a
+ * whole frame.
+ *
+ * The internal DMA is on OTG1 (USB_OTG_HS), here with its embedded
+ * full-speed PHY on PB14/PB15 (PB14 is also LD3 on the NUCLEO board).
+ * OTG2 (USB_OTG_FS, PA11/PA12, the NUCLEO user connector) has no DMA; it
+ * works the same, with the core loading the FIFO in the interrupt.
+ *
+ * Buffers are word aligned and outside the TCMs, and stay valid until the
+ * callback. Receive sizes are a multiple of USB_FS_PACKET_SIZE; a transfer
+ * ends early on a short packet and the callback gets the size received.
+ * A CDC transmit that ends on a packet boundary is followed by a zero-length
+ * packet so that the host's read returns; a vendor one is not, the host
+ * reading whole blocks. Bulk buffers get the cache maintenance DMA needs;
+ * the control buffer and the PCD handle do not, so with the D-cache on they
+ * belong in a non-cacheable MPU region.
+ *
+ * Callbacks run in the USB interrupt and may queue more. Transfers still
+ * queued when the bus resets, the host sets the configuration again or
+ * halts the endpoint fail with HAL_ERROR, and nothing can be queued until
+ * the host configures the device or clears the halt.
+ *
+ * The kernel clock is HSI48, trimmed against the host's SOF by the CRS.
+ */
+#define USB_DEV_QUEUE_DEPTH      2U
+#define USB_DEV_MAX_TRANSFER     (1023U * USB_FS_PACKET_SIZE)   /*!< Packet counter of the OTG core */
+
+/* FIFO RAM, in words (4 Kbytes) */
+#define USB_DEV_RX_FIFO_WORDS      0x120U
+#define USB_DEV_EP0_FIFO_WORDS     0x020U
+#define USB_DEV_CDC_FIFO_WORDS     0x0A0U
+#define USB_DEV_VENDOR_FIFO_WORDS  0x140U   /*!< 20 packets */
+#define USB_DEV_NOTIFY_FIFO_WORDS  0x010U
+#define USB_DEV_FIFO_BYTES         (USB_DEV_VENDOR_FIFO_WORDS * 4U)
+
+typedef enum
+{
+  USB_DEV_CDC = 0,
+  USB_DEV_VENDOR,
+  USB_DEV_PIPES
+} USBDev_PipeTypeDef;
+
+typedef void (*USBDev_CallbackTypeDef)(HAL_StatusTypeDef status, uint32_t size, void *context);
+
+typedef struct
+{
+  USB_OTG_GlobalTypeDef *Instance;      /*!< USB_OTG_HS (DMA) or USB_OTG_FS */
+  uint32_t               IrqPriority;   /*!< One of the IRQ_PRIO_xxx levels */
+} USBDev_ConfigTypeDef;
+
+typedef struct
+{
+  uint32_t Resets;
+  uint32_t Suspends;
+  uint32_t Setups;
+  uint32_t Stalls;       /*!< Control requests refused */
+  uint32_t Failed;       /*!< Transfers ended by a reset, reconfiguration or halt */
+  uint32_t TxTransfers[USB_DEV_PIPES];
+  uint32_t RxTransfers[USB_DEV_PIPES];
+  uint64_t TxBytes[USB_DEV_PIPES];
+  uint64_t RxBytes[USB_DEV_PIPES];
+} USBDev_StatsTypeDef;
+
+HAL_StatusTypeDef USBDev_Init(const USBDev_ConfigTypeDef *config);
+uint32_t          USBDev_IsConfigured(void);
+
+HAL_StatusTypeDef USBDev_Transmit(USBDev_PipeTypeDef pipe, const void *data, uint32_t size,
+                                  USBDev_CallbackTypeDef callback, void *context);
+HAL_StatusTypeDef USBDev_Receive(USBDev_PipeTypeDef pipe, void *data, uint32_t size,
+                                 USBDev_CallbackTypeDef callback, void *context);
+uint32_t          USBDev_TxQueued(USBDev_PipeTypeDef pipe);
+
+/* Line coding and USB_CDC_LINE_xxx state last set by the host */
+void              USBDev_GetLineCoding(usb_cdc_line_coding *coding, uint32_t *line_state);
+
+void              USBDev_GetStats(USBDev_StatsTypeDef *stats);
+void              USBDev_ResetStats(void);
+
+#endif /* USB_DEVICE_H */
@@ -0,0 +1,183 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "usb_stream.h"
+
+static uint8_t *usb_stream_block(const usb_stream *stream, uint32_t n)
+{
+  return &stream->blocks[(n % stream->count) * stream->block_size];
+}
+
+/* Blocks closed and not yet reported sent, plus the open one if it holds anything */
+static uint32_t usb_stream_used(const usb_stream *stream)
+{
+  return (stream->closed - stream->done) + ((stream->fill != 0U) ? 1U : 0U);
+}
+
+/* Seals the open block with its header. Caller holds the lock and fill != 0 */
+static void usb_stream_close(usb_stream *stream)
+{
+  usb_stream_header *header = (usb_stream_header *)usb_stream_block(stream, stream->closed);
+
+  header->magic = USB_STREAM_MAGIC;
+  header->seq = stream->closed;
+  header->size = stream->fill;
+  header->dropped = stream->dropped;
+  stream->dropped = 0U;
+  stream->closed++;
+  stream->fill = 0U;
+}
+
+/* Fills the free transfer slots: closed blocks first, then the open one. Caller holds the lock */
+static void usb_stream_pump(usb_stream *stream)
+{
+  const usb_stream_header *header;
+
+  while ((stream->queued - stream->done) < USB_STREAM_IN_FLIGHT)
+  {
+    if (stream->queued == stream->closed)
+    {
+      if (stream->fill == 0U)
+      {
+        return;
+      }
+      usb_stream_close(stream);
+    }
+
+    header = (const usb_stream_header *)usb_stream_block(stream, stream->queued);
+    if (stream->ops->transmit(stream->ops->context, (const uint8_t *)header,
+                              USB_STREAM_HEADER_SIZE + header->size) != 0)
+    {
+      return;   /* Not ready: the block waits for usb_stream_kick() or the next write */
+    }
+    stream->queued++;
+  }
+}
+
+usb_stream_status usb_stream_init(usb_stream *stream, const usb_stream_ops *ops, uint8_t *blocks,
+                                  uint32_t block_size, uint32_t count, usb_stream_policy policy)
+{
+  if ((ops == NULL) || (ops->transmit == NULL) || (ops->lock == NULL) || (ops->unlock == NULL) ||
+      (blocks == NULL) || (((uintptr_t)blocks & 3U) != 0U) || ((block_size & 3U) != 0U) ||
+      (block_size <= USB_STREAM_HEADER_SIZE) || (count <= USB_STREAM_IN_FLIGHT) ||
+      ((policy != USB_STREAM_BACKPRESSURE) && (policy != USB_STREAM_DROP)))
+  {
+    return USB_STREAM_ARG_ERROR;
+  }
+
+  memset(stream, 0, sizeof(*stream));
+  stream->ops = ops;
+  stream->blocks = blocks;
+  stream->block_size = block_size;
+  stream->count = count;
+  stream->policy = policy;
+  return USB_STREAM_OK;
+}
+
+usb_stream_status usb_stream_write(usb_stream *stream, const void *data, uint32_t size)
+{
+  uint32_t state;
+  uint32_t used;
+
+  if ((size == 0U) || (size > usb_stream_max_record(stream)))
+  {
+    return USB_STREAM_ARG_ERROR;
+  }
+
+  state = stream->ops->lock(stream->ops->context);
+
+  if ((stream->fill + size) > usb_stream_max_record(stream))
+  {
+    usb_stream_close(stream);   /* fill != 0: an empty block takes any record */
+  }
+
+  if ((stream->fill == 0U) && ((stream->closed - stream->done) == stream->count))
+  {
+    if (stream->policy == USB_STREAM_DROP)
+    {
+      stream->dropped += size;
+      stream->stats.overflows++;
+      stream->stats.dropped += size;
+    }
+    else
+    {
+      stream->stats.backpressure++;
+    }
+    usb_stream_pump(stream);
+    stream->ops->unlock(stream->ops->context, state);
+    return USB_STREAM_FULL;
+  }
+
+  memcpy(usb_stream_block(stream, stream->closed) + USB_STREAM_HEADER_SIZE + stream->fill, data, size);
+  stream->fill += size;
+  stream->stats.writes++;
+  stream->stats.bytes += size;
+
+  used = usb_stream_used(stream);
+  if (used > stream->stats.max_used)
+  {
+    stream->stats.max_used = used;
+  }
+
+  usb_stream_pump(stream);
+  stream->ops->unlock(stream->ops->context, state);
+  return USB_STREAM_OK;
+}
+
+void usb_stream_kick(usb_stream *stream)
+{
+  uint32_t state = stream->ops->lock(stream->ops->context);
+
+  usb_stream_pump(stream);
+  stream->ops->unlock(stream->ops->context, state);
+}
+
+void usb_stream_sent(usb_stream *stream, uint32_t sent)
+{
+  uint32_t state = stream->ops->lock(stream->ops->context);
+
+  if (stream->queued != stream->done)
+  {
+    stream->done++;
+    if (sent != 0U)
+    {
+      stream->stats.blocks++;
+    }
+    else
+    {
+      stream->stats.failed++;
+    }
+    usb_stream_pump(stream);
+  }
+  stream->ops->unlock(stream->ops->context, state);
+}
+
+uint32_t usb_stream_max_record(const usb_stream *stream)
+{
+  return stream->block_size - USB_STREAM_HEADER_SIZE;
+}
+
+uint32_t usb_stream_free(usb_stream *stream)
+{
+  uint32_t state = stream->ops->lock(stream->ops->context);
+  uint32_t unused = stream->count - usb_stream_used(stream);
+
+  stream->ops->unlock(stream->ops->context, state);
+  return unused;
+}
+
+void usb_stream_get_stats(usb_stream *stream, usb_stream_stats *stats)
+{
+  uint32_t state = stream->ops->lock(stream->ops->context);
+
+  *stats = stream->stats;
+  stream->ops->unlock(stream->ops->context, state);
+}
+
+void usb_stream_reset_stats(usb_stream *stream)
+{
+  uint32_t state = stream->ops->lock(stream->ops->context);
+
+  memset(&stream->stats, 0, sizeof(stream->stats));
+  stream->ops->unlock(stream->ops->context, state);
+}
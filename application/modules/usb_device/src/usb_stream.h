@@ -0,0 +1,134 @@
+#ifndef USB_STREAM_H
+#define USB_STREAM_H
+
+#include <stdint.h>
+
+/*
+ * Sample stream to the host over a bulk IN endpoint.
+ *
+ * Producers write records into a ring of fixed-size blocks, in the caller's
+ * memory. A record is copied whole into the open block and never split:
+ * when it does not fit, the open block is closed and the record goes into
+ * the next one. Closed blocks go to the endpoint in order, at most
+ * USB_STREAM_IN_FLIGHT at a time, so the endpoint always has the next
+ * transfer queued behind the one on the bus. The open block is also closed,
+ * however full, whenever a transfer slot would otherwise stay empty. At low
+ * rates a record thus leaves at once; at high rates blocks fill up while
+ * the transfers ahead of them are on the bus.
+ *
+ * On the wire each block is a usb_stream_header and its payload, with no
+ * padding. A full block is a whole number of packets and is not ended by a
+ * short packet, so the host reads a byte stream and walks it by the headers
+ * (tools/usb_stream_read.py). seq counts blocks, so a block lost to a bus
+ * reset shows as a gap in it.
+ *
+ * When every block is in use, a write is refused with USB_STREAM_FULL and
+ * nothing is copied. With USB_STREAM_BACKPRESSURE the producer keeps the
+ * record and tries again later, and the refusal counts in
+ * stats.backpressure. With USB_STREAM_DROP the record is lost. It counts in
+ * stats.overflows, and its bytes go into the dropped field of the next
+ * block sent, so the host knows where the gap is and how large it is.
+ *
+ * The ring is shared between the producers and the completion interrupt
+ * under ops->lock(). A write holds the lock while it copies its record.
+ * When the endpoint refuses a transfer (not configured), the block waits:
+ * the next write or usb_stream_kick() offers it again.
+ *
+ * HAL-free: the target glue is usb_stream_hal.c and the host check is
+ * tools/usb_stream_sim.c.
+ */
+#define USB_STREAM_MAGIC        0x52545355U   /*!< "USTR" */
+#define USB_STREAM_IN_FLIGHT    2U
+
+/* Little-endian on the wire, in front of every block's payload */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t seq;       /*!< Blocks closed before this one */
+  uint32_t size;      /*!< Payload bytes after the header */
+  uint32_t dropped;   /*!< Payload bytes lost to USB_STREAM_DROP just before this payload */
+} usb_stream_header;
+
+#define USB_STREAM_HEADER_SIZE  ((uint32_t)sizeof(usb_stream_header))
+
+typedef enum
+{
+  USB_STREAM_OK        =  0,
+  USB_STREAM_FULL      = -1,   /*!< No free block: backpressure, or the record was dropped */
+  USB_STREAM_ARG_ERROR = -2,
+} usb_stream_status;
+
+typedef enum
+{
+  USB_STREAM_BACKPRESSURE = 0,   /*!< Full: the producer keeps the record */
+  USB_STREAM_DROP,               /*!< Full: the record is lost and reported to the host */
+} usb_stream_policy;
+
+typedef struct
+{
+  /* Queue one block on the endpoint, 0 if taken. Each one taken is
+     reported back, in order, through usb_stream_sent() */
+  int      (*transmit)(void *context, const uint8_t *data, uint32_t size);
+
+  /* Mask the completion interrupt and other producers; unlock() gets back
+     what lock() returned */
+  uint32_t (*lock)(void *context);
+  void     (*unlock)(void *context, uint32_t state);
+
+  void *context;
+} usb_stream_ops;
+
+typedef struct
+{
+  uint32_t writes;         /*!< Records taken */
+  uint64_t bytes;          /*!< Payload bytes taken */
+  uint32_t backpressure;   /*!< Records refused with USB_STREAM_BACKPRESSURE */
+  uint32_t overflows;      /*!< Records lost with USB_STREAM_DROP */
+  uint64_t dropped;        /*!< Their bytes */
+  uint32_t blocks;         /*!< Blocks on the wire */
+  uint32_t failed;         /*!< Blocks queued but lost to a bus reset or halt */
+  uint32_t max_used;       /*!< Most blocks closed and not yet sent, plus the open one */
+} usb_stream_stats;
+
+typedef struct
+{
+  const usb_stream_ops *ops;
+  uint8_t              *blocks;
+  uint32_t              block_size;   /*!< Header included */
+  uint32_t              count;
+  usb_stream_policy     policy;
+
+  /* Free-running block counts: closed, given to ops->transmit(), reported sent */
+  uint32_t              closed;
+  uint32_t              queued;
+  uint32_t              done;
+  uint32_t              fill;         /*!< Payload bytes in the open block, block closed % count */
+  uint32_t              dropped;      /*!< For the next header */
+
+  usb_stream_stats      stats;
+} usb_stream;
+
+/*
+ * blocks: count * block_size bytes, word aligned. block_size is a multiple
+ * of 4 larger than the header and count at least USB_STREAM_IN_FLIGHT + 1.
+ */
+usb_stream_status usb_stream_init(usb_stream *stream, const usb_stream_ops *ops, uint8_t *blocks,
+                                  uint32_t block_size, uint32_t count, usb_stream_policy policy);
+
+/* Any context. size: 1 to block_size - USB_STREAM_HEADER_SIZE */
+usb_stream_status usb_stream_write(usb_stream *stream, const void *data, uint32_t size);
+
+/* Offers waiting blocks to the endpoint again, after it was not ready */
+void              usb_stream_kick(usb_stream *stream);
+
+/* From the completion of a transfer that ops->transmit() took, sent = 0 if it failed */
+void              usb_stream_sent(usb_stream *stream, uint32_t sent);
+
+/* Largest record; blocks free for writing */
+uint32_t          usb_stream_max_record(const usb_stream *stream);
+uint32_t          usb_stream_free(usb_stream *stream);
+
+void              usb_stream_get_stats(usb_stream *stream, usb_stream_stats *stats);
+void              usb_stream_reset_stats(usb_stream *stream);
+
+#endif /* USB_STREAM_H */
@@ -0,0 +1,66 @@
+#include "usb_stream_hal.h"
+#include "usb_device.h"
+#include "dma_manager.h"
+#include "event_group.h"
+
+static usb_stream_ops     usb_stream_hal_ops;
+static EventGroup_TypeDef usb_stream_hal_events;
+
+static void usb_stream_hal_done(HAL_StatusTypeDef status, uint32_t size, void *context)
+{
+  (void)size;
+  usb_stream_sent((usb_stream *)context, (status == HAL_OK) ? 1U : 0U);
+  (void)EventGroup_Set(&usb_stream_hal_events, USB_STREAM_HAL_SPACE);
+}
+
+static int usb_stream_hal_transmit(void *context, const uint8_t *data, uint32_t size)
+{
+  return (USBDev_Transmit(USB_DEV_VENDOR, data, size, usb_stream_hal_done, context) == HAL_OK) ? 0 : -1;
+}
+
+static uint32_t usb_stream_hal_lock(void *context)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  (void)context;
+  __disable_irq();
+  return primask;
+}
+
+static void usb_stream_hal_unlock(void *context, uint32_t state)
+{
+  (void)context;
+  __set_PRIMASK(state);
+}
+
+usb_stream_status usb_stream_hal_init(usb_stream *stream, uint8_t *blocks, uint32_t block_size, uint32_t count,
+                                      usb_stream_policy policy)
+{
+  if (((block_size % USB_FS_PACKET_SIZE) != 0U) || (block_size > USB_DEV_MAX_TRANSFER) ||
+      (DMAMgr_IsReachable(DMA_MGR_DMA1, (uint32_t)blocks) == 0U) ||
+      (DMAMgr_IsReachable(DMA_MGR_DMA1, (uint32_t)blocks + block_size * count - 1U) == 0U))
+  {
+    return USB_STREAM_ARG_ERROR;
+  }
+
+  usb_stream_hal_ops.transmit = usb_stream_hal_transmit;
+  usb_stream_hal_ops.lock = usb_stream_hal_lock;
+  usb_stream_hal_ops.unlock = usb_stream_hal_unlock;
+  usb_stream_hal_ops.context = stream;
+  EventGroup_Init(&usb_stream_hal_events);
+
+  return usb_stream_init(stream, &usb_stream_hal_ops, blocks, block_size, count, policy);
+}
+
+uint32_t usb_stream_hal_wait(usb_stream *stream, uint32_t timeout)
+{
+  /* Cleared before looking, so a block sent after the look still wakes the wait */
+  (void)EventGroup_Clear(&usb_stream_hal_events, USB_STREAM_HAL_SPACE);
+  if (usb_stream_free(stream) != 0U)
+  {
+    return 1U;
+  }
+  usb_stream_kick(stream);
+  return (EventGroup_Wait(&usb_stream_hal_events, USB_STREAM_HAL_SPACE, EVENT_GROUP_WAIT_CLEAR, timeout) != 0U)
+         ? 1U : 0U;
+}
@@ -0,0 +1,31 @@
+#ifndef USB_STREAM_HAL_H
+#define USB_STREAM_HAL_H
+
+#include "stm32h7xx_hal.h"
+#include "usb_stream.h"
+
+/*
+ * usb_stream on the vendor bulk IN endpoint (USB_EP_VENDOR_IN), which it
+ * then owns: nothing else may USBDev_Transmit() on USB_DEV_VENDOR. Its two
+ * transfers in flight are the endpoint's USB_DEV_QUEUE_DEPTH, so the
+ * interrupt of one starts the other before the stream refills its slot.
+ *
+ * Blocks are DMA_MGR_BUFFER_ALIGNED in AXI SRAM or SRAM1-3, where the OTG
+ * DMA reaches them. block_size is a multiple of USB_FS_PACKET_SIZE, up to
+ * USB_DEV_MAX_TRANSFER. 4 KB blocks take the vendor FIFO a frame and a bit
+ * to empty, so two in flight cover the completion interrupt with
+ * frames to spare. The lock masks every interrupt (PRIMASK), so records
+ * stay short.
+ *
+ * USB_STREAM_HAL_SPACE is set in the event group whenever a block is sent
+ * or lost, for a producer with USB_STREAM_BACKPRESSURE to wait on.
+ */
+#define USB_STREAM_HAL_SPACE   0x01U
+
+usb_stream_status usb_stream_hal_init(usb_stream *stream, uint8_t *blocks, uint32_t block_size, uint32_t count,
+                                      usb_stream_policy policy);
+
+/* Waits up to timeout ms for a block to come free; 0 on timeout */
+uint32_t          usb_stream_hal_wait(usb_stream *stream, uint32_t timeout);
+
+#endif /* USB_STREAM_HAL_H */
@@ -22,6 +22,12 @@
 #include "stm32h7xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#ifdef EXTI_DISPATCH_MODULE_ENABLED
+#include "exti_dispatch.h"
+#endif
+#ifdef I2C_BUS_MODULE_ENABLED
+#include "i2c_bus.h"
+#endif
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -192,7 +198,12 @@ void SysTick_Handler(void)
   /* USER CODE END SysTick_IRQn 0 */
   HAL_IncTick();
   /* USER CODE BEGIN SysTick_IRQn 1 */
-
+#ifdef EXTI_DISPATCH_MODULE_ENABLED
+  EXTIDisp_Tick();
+#endif
+#ifdef I2C_BUS_MODULE_ENABLED
+  I2CBus_Tick();
+#endif
   /* USER CODE END SysTick_IRQn 1 */
 }
 
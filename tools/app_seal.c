@@ -0,0 +1,255 @@
+/*
+ * Seals the application for the bootloader: fills in the CRC of the
+ * application header (boot_header.h) and, given the bootloader too, writes
+ * the whole bank as one binary for fw_pack.
+ *
+ * The flash image is rebuilt from the ELF's loadable segments at their
+ * load addresses, with gaps left erased (0xFF) as the programmer leaves
+ * them. The CRC follows the CRC unit's reset configuration over that image,
+ * less the header's words, and is written into a copy of the ELF; the
+ * sealed ELF is what gets flashed. An fw_update image is the whole bank:
+ * the bootloader padded to its sector, then the application.
+ *
+ * The meson build runs it after linking. By hand, from the repository root:
+ *
+ *   cc -O2 -o app_seal tools/app_seal.c -Iapplication/modules/boot/src
+ *
+ * Usage: app_seal <app.elf> <sealed.elf> [<boot.elf> <bank.bin>]
+ */
+#include <elf.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "boot_header.h"
+
+#define SEAL_BANK_BASE   0x08000000U
+#define SEAL_BOOT_SIZE   (BOOT_APP_BASE - SEAL_BANK_BASE)   /*!< Sector 0 */
+
+typedef struct
+{
+  uint8_t  *data;
+  uint32_t size;
+} seal_file;
+
+static int read_file(const char *name, seal_file *file)
+{
+  FILE *in = fopen(name, "rb");
+  long length;
+
+  if ((in == NULL) || (fseek(in, 0, SEEK_END) != 0) || ((length = ftell(in)) <= 0) ||
+      (fseek(in, 0, SEEK_SET) != 0) || ((file->data = malloc((size_t)length)) == NULL) ||
+      (fread(file->data, 1, (size_t)length, in) != (size_t)length))
+  {
+    printf("%s: cannot read\n", name);
+    return 0;
+  }
+  fclose(in);
+  file->size = (uint32_t)length;
+  return 1;
+}
+
+static int write_file(const char *name, const uint8_t *data, uint32_t size)
+{
+  FILE *out = fopen(name, "wb");
+
+  if ((out == NULL) || (fwrite(data, 1, size, out) != size) || (fclose(out) != 0))
+  {
+    printf("%s: cannot write\n", name);
+    return 0;
+  }
+  return 1;
+}
+
+/* Program headers of a 32-bit little-endian ARM executable, NULL if it is not one */
+static const Elf32_Phdr *elf_segments(const char *name, const seal_file *file, uint32_t *count)
+{
+  const Elf32_Ehdr *ehdr = (const Elf32_Ehdr *)file->data;
+
+  if ((file->size < sizeof(*ehdr)) || (memcmp(ehdr->e_ident, ELFMAG, SELFMAG) != 0) ||
+      (ehdr->e_ident[EI_CLASS] != ELFCLASS32) || (ehdr->e_ident[EI_DATA] != ELFDATA2LSB) ||
+      (ehdr->e_machine != EM_ARM) || (ehdr->e_phentsize != sizeof(Elf32_Phdr)) ||
+      (ehdr->e_phoff + (uint64_t)ehdr->e_phnum * sizeof(Elf32_Phdr) > file->size))
+  {
+    printf("%s: not an ARM ELF executable\n", name);
+    return NULL;
+  }
+  *count = ehdr->e_phnum;
+  return (const Elf32_Phdr *)(file->data + ehdr->e_phoff);
+}
+
+/**
+  * @brief  Copy the ELF's bytes loaded into [base, base + capacity) into
+  *         @p image, which starts erased.
+  * @retval 0 if a segment is cut by the range or lies past the file.
+  */
+static int elf_load(const char *name, const seal_file *file, uint32_t base, uint8_t *image, uint32_t capacity,
+                    uint32_t *end)
+{
+  const Elf32_Phdr *segment;
+  uint32_t count;
+  uint32_t i;
+
+  segment = elf_segments(name, file, &count);
+  if (segment == NULL)
+  {
+    return 0;
+  }
+  *end = 0U;
+  for (i = 0U; i < count; i++, segment++)
+  {
+    if ((segment->p_type != PT_LOAD) || (segment->p_filesz == 0U) ||
+        (segment->p_paddr + segment->p_filesz <= base) || (segment->p_paddr >= base + capacity))
+    {
+      continue;
+    }
+    if ((segment->p_paddr < base) || (segment->p_paddr + segment->p_filesz > base + capacity) ||
+        ((uint64_t)segment->p_offset + segment->p_filesz > file->size))
+    {
+      printf("%s: segment at 0x%08x does not fit 0x%08x-0x%08x\n", name, (unsigned)segment->p_paddr,
+             (unsigned)base, (unsigned)(base + capacity));
+      return 0;
+    }
+    memcpy(image + (segment->p_paddr - base), file->data + segment->p_offset, segment->p_filesz);
+    if (segment->p_paddr + segment->p_filesz - base > *end)
+    {
+      *end = segment->p_paddr + segment->p_filesz - base;
+    }
+  }
+  return 1;
+}
+
+/* File offset of the byte loaded at @p address, 0 if none */
+static uint32_t elf_offset(const seal_file *file, uint32_t address)
+{
+  const Elf32_Ehdr *ehdr = (const Elf32_Ehdr *)file->data;
+  const Elf32_Phdr *segment = (const Elf32_Phdr *)(file->data + ehdr->e_phoff);
+  uint32_t i;
+
+  for (i = 0U; i < ehdr->e_phnum; i++, segment++)
+  {
+    if ((segment->p_type == PT_LOAD) && (address >= segment->p_paddr) &&
+        (address - segment->p_paddr < segment->p_filesz))
+    {
+      return segment->p_offset + (address - segment->p_paddr);
+    }
+  }
+  return 0U;
+}
+
+/* CRC unit, reset configuration: CRC-32/MPEG-2 fed 32-bit little-endian words */
+static uint32_t seal_crc(uint32_t crc, const uint8_t *data, uint32_t size)
+{
+  uint32_t word;
+  uint32_t bit;
+
+  for (; size >= 4U; data += 4, size -= 4U)
+  {
+    memcpy(&word, data, 4U);
+    crc ^= word;
+    for (bit = 0U; bit < 32U; bit++)
+    {
+      crc = ((crc & 0x80000000U) != 0U) ? ((crc << 1) ^ 0x04C11DB7U) : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+int main(int argc, char **argv)
+{
+  const uint32_t skip = BOOT_HEADER_OFFSET + sizeof(boot_app_header);
+  seal_file app;
+  seal_file boot;
+  boot_app_header header;
+  uint8_t *bank;
+  uint8_t *image;
+  uint32_t end;
+  uint32_t offset;
+
+  if ((argc != 3) && (argc != 5))
+  {
+    printf("usage: %s <app.elf> <sealed.elf> [<boot.elf> <bank.bin>]\n", argv[0]);
+    return 1;
+  }
+  if (!read_file(argv[1], &app))
+  {
+    return 1;
+  }
+
+  /* The bank as flashed: bootloader sector, then the application */
+  bank = malloc(SEAL_BOOT_SIZE + BOOT_APP_MAX_SIZE);
+  if (bank == NULL)
+  {
+    printf("out of memory\n");
+    return 1;
+  }
+  memset(bank, 0xFF, SEAL_BOOT_SIZE + BOOT_APP_MAX_SIZE);
+  image = bank + SEAL_BOOT_SIZE;
+  if (!elf_load(argv[1], &app, BOOT_APP_BASE, image, BOOT_APP_MAX_SIZE, &end))
+  {
+    return 1;
+  }
+
+  memcpy(&header, image + BOOT_HEADER_OFFSET, sizeof(header));
+  if (header.magic != BOOT_APP_MAGIC)
+  {
+    printf("%s: no application header at 0x%08x\n", argv[1], (unsigned)(BOOT_APP_BASE + BOOT_HEADER_OFFSET));
+    return 1;
+  }
+  if ((header.size < skip) || (header.size > BOOT_APP_MAX_SIZE) || ((header.size % 4U) != 0U) || (end > header.size))
+  {
+    printf("%s: header size %u does not cover the %u bytes loaded\n", argv[1], (unsigned)header.size,
+           (unsigned)end);
+    return 1;
+  }
+  if (header.version < BOOT_MIN_VERSION)
+  {
+    printf("%s: version %u is below BOOT_MIN_VERSION, the bootloader would refuse it\n", argv[1],
+           (unsigned)header.version);
+    return 1;
+  }
+
+  header.crc = seal_crc(0xFFFFFFFFU, image, BOOT_HEADER_OFFSET);
+  header.crc = seal_crc(header.crc, image + skip, header.size - skip);
+  memcpy(image + BOOT_HEADER_OFFSET, &header, sizeof(header));
+
+  offset = elf_offset(&app, BOOT_APP_BASE + BOOT_HEADER_OFFSET + offsetof(boot_app_header, crc));
+  if (offset == 0U)
+  {
+    printf("%s: header is not in a loaded segment\n", argv[1]);
+    return 1;
+  }
+  memcpy(app.data + offset, &header.crc, sizeof(header.crc));
+  if (!write_file(argv[2], app.data, app.size))
+  {
+    return 1;
+  }
+  printf("%s: v%u, %u bytes, crc 0x%08x\n", argv[2], (unsigned)header.version, (unsigned)header.size,
+         (unsigned)header.crc);
+
+  if (argc == 5)
+  {
+    if (!read_file(argv[3], &boot) ||
+        !elf_load(argv[3], &boot, SEAL_BANK_BASE, bank, SEAL_BOOT_SIZE, &end))
+    {
+      return 1;
+    }
+    if (end == 0U)
+    {
+      printf("%s: nothing loaded into sector 0\n", argv[3]);
+      return 1;
+    }
+    if (!write_file(argv[4], bank, SEAL_BOOT_SIZE + header.size))
+    {
+      return 1;
+    }
+    printf("%s: %u byte bootloader, %u bytes in all\n", argv[4], (unsigned)end,
+           (unsigned)(SEAL_BOOT_SIZE + header.size));
+    free(boot.data);
+  }
+  free(bank);
+  free(app.data);
+  return 0;
+}
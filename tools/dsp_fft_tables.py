@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Generate the FFT twiddle tables (application/modules/dsp/src/dsp_fft_tables.c).
+
+One table serves every size up to --max: a transform of n points reads it
+with a stride of max / n. Entries are W^i = exp(-2j*pi*i/max) for
+i < 3 * max / 4, the most a radix-4 stage needs, stored as {re, im} pairs:
+float for f32 and Q15 (1.0 saturated to 0x7FFF) for q15.
+"""
+
+import argparse
+import math
+
+WRAP = 8
+
+
+def rows(values, fmt):
+    lines = []
+    for i in range(0, len(values), WRAP):
+        lines.append("  " + ", ".join(fmt(v) for v in values[i:i + WRAP]) + ",")
+    return lines
+
+
+def q15(x):
+    return max(-32768, min(32767, int(round(x * 32768.0))))
+
+
+def f32(x):
+    text = "%.9g" % (x if x != 0.0 else 0.0)
+    if "." not in text and "e" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def generate(size):
+    count = 3 * size // 4
+    pairs = [(math.cos(2.0 * math.pi * i / size), -math.sin(2.0 * math.pi * i / size)) for i in range(count)]
+    flat = [v for pair in pairs for v in pair]
+
+    lines = ["/* Generated by tools/dsp_fft_tables.py --max %d - do not edit */" % size,
+             "#include \"dsp_fft_tables.h\"",
+             "",
+             "#if DSP_FFT_MAX_N != %d" % size,
+             "#error \"dsp_fft_tables.c was generated for a different DSP_FFT_MAX_N\"",
+             "#endif",
+             "",
+             "const float dsp_fft_twiddle_f32[2U * DSP_FFT_TWIDDLES] DSP_FFT_TABLE =",
+             "{"]
+    lines += rows(flat, f32)
+    lines += ["};",
+              "",
+              "const dsp_q15 dsp_fft_twiddle_q15[2U * DSP_FFT_TWIDDLES] DSP_FFT_TABLE =",
+              "{"]
+    lines += rows([q15(v) for v in flat], lambda v: "%6d" % v)
+    lines += ["};", ""]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--max", type=int, default=4096, help="largest complex FFT size (power of two)")
+    parser.add_argument("--out", default="application/modules/dsp/src/dsp_fft_tables.c")
+    args = parser.parse_args()
+
+    if args.max < 16 or args.max & (args.max - 1):
+        parser.error("--max must be a power of two >= 16")
+    with open(args.out, "w") as handle:
+        handle.write(generate(args.max))
+    print("%s: %d twiddles" % (args.out, 3 * args.max // 4))
+
+
+if __name__ == "__main__":
+    main()
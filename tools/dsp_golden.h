@@ -0,0 +1,746 @@
+/* Generated by tools/dsp_golden.py - do not edit */
+#ifndef DSP_GOLDEN_H
+#define DSP_GOLDEN_H
+
+#include "dsp_types.h"
+
+#define GOLDEN_LEN          128U
+#define GOLDEN_FIR_A_TAPS   29U
+#define GOLDEN_FIR_B_TAPS   3U
+#define GOLDEN_DECIM        3U
+#define GOLDEN_DECIM_TAPS   24U
+#define GOLDEN_INTERP       4U
+#define GOLDEN_INTERP_TAPS  32U
+#define GOLDEN_STAGES       2U
+#define GOLDEN_POST_SHIFT   1
+
+static const dsp_q15 golden_in_q15[128] __attribute__((aligned(4))) =
+{
+    3849,   7128,  -7163,   2587,  11684,  -1281,
+     168,  15630,   5456,  -1149,  13579,  14349,
+     562,  12113,  19085,   6421,   8131,  21261,
+   11682,   4075,  19044,  15938,   1924,  14627,
+   20213,   6024,   9461,  21874,   8512,   4583,
+   20729,  12580,    -86,  14808,  16215,    107,
+    5424,  18255,   3083,  -1103,  14659,   6443,
+   -8161,   6174,   7921, -10291,  -1687,   6482,
+   -8039,  -8441,   4183,  -7125, -14056,  -1840,
+   -1398, -19622,  -8741,  -2323, -17581, -16845,
+    -718, -13724, -22037,  -4965,  -7763, -21303,
+  -12352,  -6342, -19130, -15363,  -3195, -16044,
+  -19728,  -2452,  -8297, -21111,  -7330,  -3955,
+  -16797, -10074,   1916, -11668, -13558,   1409,
+   -4211, -13698,   3083,   3313,  -9849,  -1889,
+   11006,  -3068,  -3961,  12115,   3066,  -6075,
+   12317,  12349,  -2625,   8923,  18648,   1776,
+    3744,  19715,  32113,  32113,  32113,  32113,
+  -32113, -32113, -32113, -32113,  32113,  32113,
+   32113,  32113, -32113, -32113, -32113, -32113,
+   32113,  32113,  32113,  32113, -32113, -32113,
+  -32113, -32113,
+};
+
+static const dsp_q15 golden_fir_a_q15[29] __attribute__((aligned(4))) =
+{
+      35,    -23,   -104,   -138,      0,    319,
+     543,    249,   -657,  -1544,  -1268,    967,
+    4738,   8348,   9838,   8348,   4738,    967,
+   -1268,  -1544,   -657,    249,    543,    319,
+       0,   -138,   -104,    -23,     35,
+};
+
+static const dsp_q15 golden_fir_b_q15[3] __attribute__((aligned(4))) =
+{
+    8192,  16384,   8192,
+};
+
+static const dsp_q15 golden_decim_q15[24] __attribute__((aligned(4))) =
+{
+     -72,    -44,     73,    275,    324,   -112,
+    -967,  -1436,   -376,   2651,   6620,   9449,
+    9449,   6620,   2651,   -376,  -1436,   -967,
+    -112,    324,    275,     73,    -44,    -72,
+};
+
+static const dsp_q15 golden_interp_q15[32] __attribute__((aligned(4))) =
+{
+    -194,   -170,    -38,    272,    702,    965,
+     630,   -565,  -2349,  -3766,  -3447,   -270,
+    5915,  13904,  21417,  25976,  25976,  21417,
+   13904,   5915,   -270,  -3447,  -3766,  -2349,
+    -565,    630,    965,    702,    272,    -38,
+    -170,   -194,
+};
+
+static const dsp_q15 golden_biquad_q15[12] __attribute__((aligned(4))) =
+{
+     756,      0,   1512,    756,  21418,  -8057,
+   19373,      0,  -8270,   7389,   8270, -10378,
+};
+
+static const double golden_ref_fir_a_q15[128] =
+{
+  4.111175537109375, 4.911895751953125, -24.870147705078125, -31.0418701171875, 3.379119873046875, 49.85687255859375,
+  86.2744140625, 49.07000732421875, -116.80300903320312, -277.46609497070312, -208.21560668945312, 179.06137084960938,
+  785.3857421875, 1398.0931701660156, 1764.6859741210938, 1850.1721801757812, 1928.7906494140625, 2316.2625732421875,
+  3103.5927734375, 4163.4560241699219, 5239.7326354980469, 6090.8109130859375, 6716.766845703125, 7323.5741882324219,
+  8047.3134765625, 8900.3180847167969, 9835.7772216796875, 10743.641662597656, 11506.628875732422, 12102.436004638672,
+  12520.463439941406, 12719.271942138672, 12652.949310302734, 12402.880676269531, 12110.868896484375, 11915.326171875,
+  11933.126983642578, 12181.560424804688, 12489.155822753906, 12686.829986572266, 12715.723114013672, 12567.910797119141,
+  12270.736206054688, 11918.342834472656, 11520.004211425781, 11012.85595703125, 10406.877380371094, 9761.4617004394531,
+  9132.2903442382812, 8585.2990112304688, 8166.5901794433594, 7787.4491271972656, 7283.1380920410156, 6541.6566162109375,
+  5510.6522216796875, 4199.5437927246094, 2778.8086547851562, 1447.836669921875, 303.73300170898438, -630.58197021484375,
+  -1380.368408203125, -2094.796630859375, -2893.8130187988281, -3748.9505004882812, -4610.0206298828125, -5453.0230407714844,
+  -6272.4007873535156, -7108.9153747558594, -8049.7074279785156, -9067.6201171875, -10006.678802490234, -10756.567413330078,
+  -11284.955841064453, -11590.982330322266, -11757.466857910156, -11903.355316162109, -12062.433410644531, -12265.875274658203,
+  -12552.466979980469, -12870.819641113281, -13101.922027587891, -13197.190551757812, -13122.345703125, -12864.798553466797,
+  -12475.688201904297, -12070.36865234375, -11703.306915283203, -11441.004516601562, -11304.289337158203, -11171.430816650391,
+  -10816.879302978516, -10161.03369140625, -9294.0007629394531, -8414.1612243652344, -7757.9130249023438, -7358.0836791992188,
+  -6971.0212097167969, -6351.0072021484375, -5441.6604919433594, -4332.9907531738281, -3176.90625, -2102.3054809570312,
+  -1087.4247741699219, -59.005035400390625, 932.62649536132812, 1694.108642578125, 2165.57373046875, 2532.8817443847656,
+  3072.9032897949219, 4255.6898803710938, 6037.5133361816406, 7673.812744140625, 8158.6761474609375, 6957.9817504882812,
+  5261.9996337890625, 5754.1698913574219, 11019.181121826172, 21224.233856201172, 32109.980438232422, 32767.0,
+  28677.647430419922, 8706.7552185058594, -15517.52880859375, -31777.052825927734, -30798.263244628906, -12323.776885986328,
+  13574.686584472656, 31997.876373291016,
+};
+
+static const double golden_ref_fir_b_q15[128] =
+{
+  962.25, 3706.5, 2735.5, -1152.75, 2423.75, 6168.5,
+  2322.5, 3671.25, 9221.0, 6348.25, 4184.25, 10089.5,
+  10709.75, 6896.5, 10968.25, 14176.0, 10014.5, 10986.0,
+  15583.75, 12175.0, 9719.0, 14525.25, 13211.0, 8603.25,
+  12847.75, 15269.25, 10430.5, 11705.0, 15430.25, 10870.25,
+  9601.75, 14655.25, 11450.75, 6804.0, 11436.25, 11836.25,
+  5463.25, 7302.5, 11254.25, 5829.5, 3884.0, 8664.5,
+  4846.0, -926.25, 3027.0, 2931.25, -3587.0, -1795.75,
+  809.5, -4509.25, -5184.5, -1800.0, -6030.75, -9269.25,
+  -4783.5, -6064.5, -12345.75, -9856.75, -7742.0, -13582.5,
+  -12997.25, -8001.25, -12550.75, -15690.75, -9932.5, -10448.5,
+  -15680.25, -13087.25, -11041.5, -14991.25, -13262.75, -9449.25,
+  -13752.75, -14488.0, -8232.25, -10039.25, -14462.25, -9931.5,
+  -8009.25, -11905.75, -8757.25, -4477.5, -8744.5, -9343.75,
+  -3737.75, -5177.75, -7131.0, -1054.75, -35.0, -4568.5,
+  -655.25, 4263.75, 227.25, 281.25, 5833.75, 3043.0,
+  808.25, 7727.0, 8597.5, 4005.5, 8467.25, 11998.75,
+  6486.0, 7244.75, 18821.75, 29013.5, 32113.0, 32113.0,
+  16056.5, -16056.5, -32113.0, -32113.0, -16056.5, 16056.5,
+  32113.0, 32113.0, 16056.5, -16056.5, -32113.0, -32113.0,
+  -16056.5, 16056.5, 32113.0, 32113.0, 16056.5, -16056.5,
+  -32113.0, -32113.0,
+};
+
+static const double golden_ref_decim_q15[42] =
+{
+  14.742462158203125, -9.90155029296875, -81.82073974609375, 1613.9667358398438, 2042.5102844238281, 4733.4823608398438,
+  6986.1024780273438, 9399.919677734375, 11826.367279052734, 12723.794464111328, 12015.7880859375, 12356.3388671875,
+  12656.362640380859, 11735.711181640625, 10074.685821533203, 8365.4346618652344, 6927.5188903808594, 3478.066162109375,
+  -184.04876708984375, -2480.8823852539062, -5034.877685546875, -7537.7120361328125, -10416.404144287109, -11662.286895751953,
+  -12173.898193359375, -13019.195861816406, -12997.43896484375, -11939.795623779297, -11224.401824951172, -9764.8027648925781,
+  -7530.4333801269531, -5917.3863830566406, -2604.0520935058594, 428.88522338867188, 2446.0597839355469, 4945.93017578125,
+  7538.3914794921875, 8525.3806762695312, 32767.0, -3145.3224792480469, -22515.307373046875, 32767.0,
+};
+
+static const double golden_ref_interp_q15[512] =
+{
+  -22.78765869140625, -19.96856689453125, -4.46356201171875, 31.94970703125, 40.25775146484375, 76.371002197265625,
+  65.73504638671875, -7.198150634765625, -80.805145263671875, -195.28515625, -259.54190063476562, -214.07733154296875,
+  15.040863037109375, 589.61068725585938, 1625.1471252441406, 3137.4457702636719, 4837.6162414550781, 6379.0215454101562,
+  7081.7123718261719, 6456.7311401367188, 4398.2657470703125, 1267.9659729003906, -2145.550048828125, -4900.9292907714844,
+  -6202.4169311523438, -5641.2456665039062, -3308.3037719726562, 256.46588134765625, 4130.8341979980469, 7605.7318115234375,
+  9867.3532409667969, 10509.980346679688, 9482.8202514648438, 7087.6160583496094, 3851.7131958007812, 486.91421508789062,
+  -2182.2527770996094, -3566.7193298339844, -3201.1845397949219, -1070.2037048339844, 2289.014404296875, 6366.9215698242188,
+  10153.088195800781, 12835.007080078125, 13781.168395996094, 12932.414398193359, 10445.729064941406, 6932.2796325683594,
+  3306.035400390625, 298.03756713867188, -1373.8677368164062, -1389.8698425292969, 138.9705810546875, 3041.7710266113281,
+  6707.3243408203125, 10472.359283447266, 13505.923065185547, 15364.440460205078, 15503.502471923828, 13877.619537353516,
+  10931.985473632812, 7296.6451110839844, 3918.337158203125, 1629.7513122558594, 991.43911743164062, 2213.5260009765625,
+  5018.5899963378906, 8772.3357543945312, 12496.033477783203, 15607.274597167969, 17357.357330322266, 17485.784790039062,
+  16101.265197753906, 13549.374237060547, 10384.667846679688, 7257.2851867675781, 4898.4056091308594, 3750.8323364257812,
+  4182.6400451660156, 6149.97265625, 9139.184814453125, 12691.806732177734, 15934.824035644531, 18190.273223876953,
+  18965.0693359375, 18108.745056152344, 15731.273132324219, 12310.510437011719, 8698.9791259765625, 5547.4073791503906,
+  3683.7732543945312, 3535.3975524902344, 5084.7514343261719, 8063.5745544433594, 11760.935638427734, 15359.057098388672,
+  17970.885681152344, 19085.863586425781, 18318.45458984375, 15804.104736328125, 12200.355346679688, 8177.8042907714844,
+  4733.917236328125, 2636.1075744628906, 2363.7355346679688, 3954.0811767578125, 7063.0294189453125, 10991.934509277344,
+  14752.626190185547, 17691.593994140625, 19089.875030517578, 18723.26171875, 16829.344635009766, 13759.70361328125,
+  10222.307586669922, 6937.9014892578125, 4667.5750122070312, 3817.3500061035156, 4694.7777709960938, 7151.3907775878906,
+  10537.003082275391, 14252.271789550781, 17306.899932861328, 18985.382202148438, 18903.600494384766, 17024.126342773438,
+  13731.935211181641, 9736.5882568359375, 6065.6330261230469, 3370.4920043945312, 2402.0100402832031, 3380.1118774414062,
+  6014.7961730957031, 9780.0822448730469, 13767.661407470703, 17082.829010009766, 18927.666076660156, 18904.300109863281,
+  16903.293151855469, 13318.59423828125, 9063.0068664550781, 4858.5035400390625, 1744.0431823730469, 363.76190185546875,
+  989.60260009765625, 3408.3835144042969, 7072.860107421875, 11147.856964111328, 14621.97802734375, 16838.326538085938,
+  17225.992858886719, 15737.116027832031, 12841.243499755859, 8967.717529296875, 4957.3800354003906, 1540.1090698242188,
+  -561.77725219726562, -1051.0133972167969, 303.69277954101562, 3261.6831359863281, 7106.0010070800781, 11111.457580566406,
+  14258.750946044922, 15817.618041992188, 15470.733428955078, 13177.264465332031, 9446.9735412597656, 5066.4896240234375,
+  1137.3195190429688, -1721.8127746582031, -2760.3040771484375, -1810.5378723144531, 803.34213256835938, 4506.6509704589844,
+  8426.3319396972656, 11698.285186767578, 13561.446136474609, 13547.716735839844, 11522.024505615234, 7817.22314453125,
+  3346.2269287109375, -1241.4696960449219, -4818.5868530273438, -6671.9875183105469, -6448.251953125, -4313.5769348144531,
+  -759.75921630859375, 3378.0024108886719, 7065.1470642089844, 9461.09521484375, 9891.0856628417969, 8197.609375,
+  4872.2474670410156, 423.12478637695312, -4037.0633239746094, -7548.2616882324219, -9288.8316345214844, -9084.9676818847656,
+  -6982.0866394042969, -3567.0740051269531, 202.89849853515625, 3529.1181335449219, 5583.2728881835938, 5951.2830505371094,
+  4681.2984924316406, 1926.2130737304688, -1677.4753112792969, -5410.783447265625, -8375.4415588378906, -10155.927001953125,
+  -10230.049835205078, -8610.6920166015625, -5775.3101196289062, -2355.3697509765625, 757.2923583984375, 2803.199951171875,
+  3268.2653198242188, 2005.1119384765625, -737.35064697265625, -4362.6424560546875, -7922.9632873535156, -10941.949096679688,
+  -12708.376739501953, -12985.395141601562, -11826.563751220703, -9499.7919006347656, -6401.0127258300781, -3068.2402648925781,
+  -204.46566772460938, 1550.7370910644531, 1588.2053527832031, -317.04733276367188, -3770.9216613769531, -8280.6891784667969,
+  -12688.314849853516, -15968.097259521484, -17316.511962890625, -16569.183380126953, -13933.716918945312, -10144.733428955078,
+  -6274.339599609375, -3131.1674194335938, -1477.3477783203125, -1602.4359741210938, -3342.9044799804688, -6448.301513671875,
+  -10268.443176269531, -14104.447387695312, -17082.703491210938, -18746.71484375, -18521.126220703125, -16371.956359863281,
+  -12829.588775634766, -8545.5057678222656, -4593.6272277832031, -1895.7599182128906, -1104.5277099609375, -2429.1722412109375,
+  -5612.6062622070312, -9961.5542602539062, -14391.121978759766, -18096.016754150391, -20151.196685791016, -20153.998931884766,
+  -18206.631713867188, -14731.673828125, -10530.851501464844, -6516.896484375, -3624.88525390625, -2366.451904296875,
+  -3037.509521484375, -5424.317626953125, -8829.5416870117188, -12666.468017578125, -16025.046203613281, -18271.322509765625,
+  -19014.682525634766, -18172.754211425781, -15934.948883056641, -12801.993041992188, -9607.2290954589844, -6904.025146484375,
+  -5420.0787048339844, -5470.9285278320312, -6948.1417846679688, -9608.6829528808594, -12788.493286132812, -15786.084869384766,
+  -17847.498229980469, -18570.61962890625, -17632.201538085938, -15176.474243164062, -11848.911712646484, -8216.4490051269531,
+  -5219.8142395019531, -3545.3379821777344, -3614.2809448242188, -5402.15380859375, -8569.0288696289062, -12430.219665527344,
+  -16024.166595458984, -18647.294555664062, -19564.942169189453, -18533.803894042969, -15835.816589355469, -11920.534820556641,
+  -7668.5787353515625, -3960.7311706542969, -1649.0532836914062, -1121.7327880859375, -2567.477783203125, -5662.9265747070312,
+  -9620.6563415527344, -13670.270446777344, -16820.020660400391, -18395.629028320312, -18128.160858154297, -16047.605560302734,
+  -12660.103912353516, -8723.8170471191406, -5250.9940490722656, -2781.0935974121094, -1929.5185241699219, -2780.2412414550781,
+  -4979.4572143554688, -8062.6426086425781, -11282.744506835938, -13953.890594482422, -15457.179016113281, -15446.882873535156,
+  -13773.513305664062, -10693.633605957031, -6956.6653137207031, -3137.5108947753906, -205.15084838867188, 1204.7713317871094,
+  779.48348999023438, -1335.7134704589844, -4671.3088684082031, -8465.4554138183594, -11788.521820068359, -13969.666229248047,
+  -14455.394378662109, -13160.397735595703, -10523.777465820312, -6923.0809326171875, -3206.245361328125, -96.83074951171875,
+  1714.0044250488281, 1981.6937255859375, 546.60763549804688, -2286.0076293945312, -5777.2215881347656, -9165.5932922363281,
+  -11489.613739013672, -12105.540802001953, -10841.673675537109, -7819.9998779296875, -3737.1279602050781, 510.48931884765625,
+  3839.5808410644531, 5798.3558959960938, 5903.4814758300781, 4271.2925415039062, 1413.6317749023438, -2039.3821411132812,
+  -5353.5037841796875, -7898.7156372070312, -9173.9415283203125, -8846.8515625, -6844.794189453125, -3436.3296508789062,
+  602.22128295898438, 4704.6637878417969, 7837.9733581542969, 9336.6379089355469, 8909.1431274414062, 6693.2839965820312,
+  3220.704833984375, -691.37237548828125, -4053.7780456542969, -6139.16748046875, -6368.5710144042969, -4668.0408325195312,
+  -1556.1136169433594, 2493.052978515625, 6470.5023498535156, 9537.4790649414062, 10960.453948974609, 10561.039520263672,
+  8313.8409729003906, 4710.6385192871094, 674.03640747070312, -2959.1160888671875, -5217.9438781738281, -5533.7265014648438,
+  -3853.7886047363281, -372.14996337890625, 4137.7060241699219, 8748.164306640625, 12359.812194824219, 14441.885528564453,
+  14449.247192382812, 12464.733489990234, 9093.5580749511719, 5055.8306274414062, 1331.6230773925781, -1263.3364868164062,
+  -2155.6679077148438, -1095.0220947265625, 1761.3270263671875, 5861.02978515625, 10186.777069091797, 14047.817260742188,
+  16438.169281005859, 16857.703186035156, 15141.408782958984, 11922.088256835938, 7854.5074157714844, 3900.8359985351562,
+  838.97552490234375, -524.35617065429688, -159.8931884765625, 1708.8644104003906, 4460.441650390625, 8062.2002868652344,
+  11975.101013183594, 15972.015106201172, 19714.451232910156, 23218.75830078125, 26081.623596191406, 28123.055358886719,
+  29617.314331054688, 30032.580474853516, 29726.733276367188, 28825.067169189453, 27880.179595947266, 27141.740325927734,
+  27527.154632568359, 29374.219940185547, 32403.071319580078, 32767.0, 32767.0, 30074.477569580078,
+  20912.454437255859, 7476.5038146972656, -7476.5038146972656, -20912.454437255859, -30381.320587158203, -32768.0,
+  -32768.0, -31972.858428955078, -28476.179229736328, -26186.873565673828, -26186.873565673828, -28476.179229736328,
+  -31972.858428955078, -32768.0, -32768.0, -30381.320587158203, -20912.454437255859, -7476.5038146972656,
+  7476.5038146972656, 20912.454437255859, 30381.320587158203, 32767.0, 32767.0, 31972.858428955078,
+  28476.179229736328, 26186.873565673828, 26186.873565673828, 28476.179229736328, 31972.858428955078, 32767.0,
+  32767.0, 30381.320587158203, 20912.454437255859, 7476.5038146972656, -7476.5038146972656, -20912.454437255859,
+  -30381.320587158203, -32768.0, -32768.0, -31972.858428955078, -28476.179229736328, -26186.873565673828,
+  -26186.873565673828, -28476.179229736328, -31972.858428955078, -32768.0, -32768.0, -30381.320587158203,
+  -20912.454437255859, -7476.5038146972656, 7476.5038146972656, 20912.454437255859, 30381.320587158203, 32767.0,
+  32767.0, 31972.858428955078, 28476.179229736328, 26186.873565673828, 26186.873565673828, 28476.179229736328,
+  31972.858428955078, 32767.0, 32767.0, 30381.320587158203, 20912.454437255859, 7476.5038146972656,
+  -7476.5038146972656, -20912.454437255859,
+};
+
+static const double golden_ref_biquad_q15[128] =
+{
+  210.00358392298222, 1099.7968605812566, 1949.7683388029182, 1597.947112531318, 1397.4169483788639, 2460.10359701262,
+  3209.714922454662, 3529.2279806023225, 4741.7013319051184, 5812.4145910813695, 5955.9547133114138, 6761.465324735429,
+  8144.60977432455, 8635.5405560965482, 9173.8999602811273, 10514.119479417524, 11211.02414369385, 11374.718448989883,
+  12268.587276318256, 12837.263464004795, 12395.506869941528, 12484.978478725876, 12830.235364881466, 12160.453398490063,
+  11810.612618313793, 12465.491604866378, 12519.902720755646, 12212.137003230469, 12662.62777338299, 12646.710139586334,
+  11923.614431983286, 12063.978567169113, 12175.86355915778, 11059.837857343831, 10391.297273649445, 10517.678219809473,
+  9661.5201141342168, 8541.0956039218054, 8544.0114513961016, 8189.4977670053386, 7012.4646188884026, 6637.6324799927243,
+  6236.3461642619695, 4515.8501426062485, 3160.5009156030878, 2590.9263338248697, 1166.9102945860282, -329.2854621105414,
+  -830.20496543492095, -1676.7074566834865, -2918.1482268069462, -3370.866108552168, -4025.060768252697, -5505.6938508439198,
+  -6192.8775059258414, -6325.2007892385345, -7606.2038343485046, -8947.8194077753633, -9313.7763608322039, -10184.027258348488,
+  -11304.717488608425, -11208.303206525818, -11265.382186847852, -12321.56359040823, -12510.104068830811, -11968.332891463013,
+  -12383.441104001737, -12966.26737972905, -12870.147474570396, -13107.890053565901, -13292.739365068463, -12575.854900419732,
+  -12383.311168024557, -12881.07264836678, -12222.035122657941, -11193.78225276692, -11378.892775625343, -11434.980903206091,
+  -10675.551296163745, -10371.18667070505, -9967.8307378491227, -8629.0734891655575, -7900.0918071426631, -8006.5916727866315,
+  -7261.4995067519403, -6240.1402272448895, -5886.6198012114755, -4845.9037740139393, -3230.1188542949894, -2676.2964539271284,
+  -2185.747619963814, -539.02658341488109, 648.4883558500245, 1013.5723990779835, 2045.6253435931544, 2907.312539636675,
+  2883.9428885314101, 3786.3597339240669, 5428.5754412182714, 5992.5291391207666, 6535.5405992528904, 7971.9845033454258,
+  8540.2397271152695, 8387.7221836000899, 10470.87936064036, 15890.85488504867, 22342.854117782736, 27208.248214988682,
+  26445.60399380068, 16122.045774924711, 154.71755846609449, -13863.897497257989, -19469.237511374089, -13059.325839540057,
+  296.15430098364595, 12565.579813175176, 17435.061239538274, 11222.157106084014, -1531.8312056874674, -13310.130425339828,
+  -17922.121162260075, -11533.319428304429, 1420.9897587959404, 13372.435828680618, 18049.69740165714, 11630.901907047852,
+  -1370.3135422393352, -13336.899728848812,
+};
+
+static const dsp_q31 golden_in_q31[128] =
+{
+    252271801,   467170369,  -469457824,   169534086,   765714422,   -83956681,
+     11036649,  1024302259,   357583417,   -75314072,   889904649,   940353858,
+     36850436,   793832962,  1250772607,   420828880,   532847781,  1393331403,
+    765570706,   267069693,  1248045483,  1044527858,   126116934,   958587096,
+   1324653799,   394799013,   620005112,  1433505646,   557815920,   300348805,
+   1358521247,   824423117,    -5650178,   970431548,  1062687376,     6989200,
+    355471046,  1196360415,   202047418,   -72298499,   960723574,   422225386,
+   -534826844,   404607111,   519110013,  -674408580,  -110542982,   424777793,
+   -526812496,  -553218284,   274137719,  -466945405,  -921157894,  -120609240,
+    -91651424, -1285957416,  -572839664,  -152231310, -1152188525, -1103961430,
+    -47023697,  -899404420, -1444212995,  -325377970,  -508766766, -1396101110,
+   -809489036,  -415605872, -1253706788, -1006845042,  -209366936, -1051431591,
+  -1292902248,  -160669984,  -543727841, -1383506693,  -480367972,  -259166645,
+  -1100834497,  -660233406,   125587004,  -764686046,  -888526993,    92370112,
+   -275989378,  -897696445,   202054711,   217149083,  -645454321,  -123777563,
+    721299708,  -201095032,  -259570685,   793976080,   200935946,  -398102754,
+    807175536,   809330815,  -172056189,   584766966,  1222108064,   116372685,
+    245381683,  1292041748,  2104533975,  2104533975,  2104533975,  2104533975,
+  -2104533975, -2104533975, -2104533975, -2104533975,  2104533975,  2104533975,
+   2104533975,  2104533975, -2104533975, -2104533975, -2104533975, -2104533975,
+   2104533975,  2104533975,  2104533975,  2104533975, -2104533975, -2104533975,
+  -2104533975, -2104533975,
+};
+
+static const dsp_q31 golden_fir_a_q31[29] =
+{
+      2297761,    -1488476,    -6807396,    -9074517,           0,    20933709,
+     35592460,    16308063,   -43049684,  -101191324,   -83116308,    63395052,
+    310493020,   547071442,   644756045,   547071442,   310493020,    63395052,
+    -83116308,  -101191324,   -43049684,    16308063,    35592460,    20933709,
+            0,    -9074517,    -6807396,    -1488476,     2297761,
+};
+
+static const dsp_q31 golden_fir_b_q31[3] =
+{
+    536870912,  1073741824,   536870912,
+};
+
+static const dsp_q31 golden_decim_q31[24] =
+{
+     -4706299,    -2874461,     4810726,    17989785,    21205805,    -7359031,
+    -63404402,   -94128946,   -24653293,   173748552,   433844195,   619269194,
+    619269194,   433844195,   173748552,   -24653293,   -94128946,   -63404402,
+     -7359031,    21205805,    17989785,     4810726,    -2874461,    -4706299,
+};
+
+static const dsp_q31 golden_interp_q31[32] =
+{
+    -12713236,   -11162667,    -2517079,    17798291,    46022140,    63252987,
+     41307385,   -37025704,  -153941811,  -246796443,  -225920907,   -17669019,
+    387647603,   911191296,  1403605645,  1702392086,  1702392086,  1403605645,
+    911191296,   387647603,   -17669019,  -225920907,  -246796443,  -153941811,
+    -37025704,    41307385,    63252987,    46022140,    17798291,    -2517079,
+    -11162667,   -12713236,
+};
+
+static const dsp_q31 golden_biquad_q31[10] =
+{
+     49531744,    99063489,    49531744,  1403632744,  -528017898,  1269620778,
+   -541972817,   484240101,   541972817,  -680119055,
+};
+
+static const double golden_ref_fir_a_q31[128] =
+{
+  269925.36417095037, 325006.1222252124, -1625804.1422534287, -2040124.0014594845, 215843.86736887367, 3284933.9253822099,
+  5661485.8990947492, 3201200.371083647, -7645241.784385208, -18165500.578347806, -13663870.723456522, 11736532.884873709,
+  51512365.528369956, 91622341.8141087, 115648893.39694695, 121299429.32590893, 126399623.04610299, 151772058.81966186,
+  203427541.23743916, 272856539.88787657, 343363649.17965508, 399190201.49095303, 440203029.14039707, 479922284.67231566,
+  527383941.14262998, 583299229.06582212, 644571687.56729794, 704101803.88300371, 754126579.3045733, 793121511.77129364,
+  820511124.71046531, 833574361.81788588, 829193454.12858427, 812787497.95281482, 793715896.51117682, 780902771.48464262,
+  782019859.98518741, 798334197.88438416, 818506326.41923332, 831396985.01464331, 833294239.67858803, 823656136.1919663,
+  804146690.05655468, 781038660.41310179, 754991518.83680665, 721738456.32040155, 681981272.41683352, 639723234.76267111,
+  598502648.43491852, 562607940.17518067, 535190249.41163892, 510384086.62476981, 477292070.52925313, 428688685.3200627,
+  361173644.88587224, 275221090.9843322, 182075472.51709765, 94904323.827684939, 19930897.391353603, -41352222.496067837,
+  -90454562.342642501, -137247484.77283257, -189669123.77489126, -245708627.93221137, -302091806.92598212, -357369672.96189928,
+  -411101195.74253964, -465878944.2809, -527538035.53239918, -594290126.02697575, -655793256.54521799, -704903943.39007032,
+  -739580235.33385062, -759625417.61565244, -770485271.73441911, -780086343.36643958, -790539491.72938049, -803822141.09725022,
+  -822615135.69065595, -843520104.48594308, -858622911.48899341, -864851079.65111363, -859998715.52450585, -843107323.64010131,
+  -817562629.12544429, -791040589.57350552, -766992411.73549664, -749739947.09779823, -740801815.2906816, -732140834.49145865,
+  -708863145.97162056, -665876148.05303943, -609115114.33644247, -551443481.17885363, -508396899.18822253, -482226285.58949256,
+  -456862816.83598131, -416178314.59427273, -356608833.43862528, -283986285.46946245, -208172735.90129992, -137735490.76913938,
+  -71276206.411627829, -3863599.9042332028, 61157359.761718467, 111026874.23743662, 141923542.43778136, 166024826.47572827,
+  201376480.8965643, 278859696.0894407, 395666520.76292986, 502915907.86564279, 534662672.15438813, 456015003.28608519,
+  344856802.10789585, 377029671.5026201, 722099350.00049269, 1390914170.2034743, 2104288024.8327556, 2147483647.0,
+  1879436548.9299726, 570617702.39302433, -1016973552.551077, -2082466611.517802, -2018371687.4533491, -807718169.24051607,
+  889669938.40671194, 2097008698.9438472,
+};
+
+static const double golden_ref_fir_b_q31[128] =
+{
+  63067950.25, 242928492.75, 179288678.75, -75552798.25, 158831192.5, 404251562.25,
+  152209427.25, 240604719.0, 604306146.0, 416038755.25, 274214980.5, 661212271.0,
+  701865700.25, 451971923.0, 718822241.75, 929051764.0, 656319537.0, 719963961.25,
+  1021270323.25, 797885627.0, 636938893.75, 951922129.25, 865804533.25, 563837205.5,
+  841986231.25, 1000673426.75, 683564234.25, 767078720.75, 1011208081.0, 712371572.75,
+  629258694.25, 960453604.0, 750429325.75, 445888577.25, 749475073.5, 775698875.0,
+  358034205.5, 478572926.75, 737559823.5, 382039188.0, 254543498.5, 567843508.75,
+  317586875.5, -60705297.75, 198374347.75, 192104639.25, -235062532.25, -117679187.75,
+  53050027.0, -295516370.75, -339777836.25, -117972062.75, -395227746.25, -607467608.25,
+  -313506949.5, -397467376.0, -809101480.0, -645967013.5, -507372702.25, -890142447.5,
+  -851783770.5, -524353311.0, -822511383.0, -1028302095.0, -650933925.25, -684753153.0,
+  -1027614505.5, -857671263.5, -723601892.0, -982466122.5, -869190952.0, -619252626.25,
+  -901283091.5, -949476517.75, -539492514.25, -657908089.75, -947777299.75, -650852320.5,
+  -524883939.75, -780267261.25, -573928576.25, -293436361.0, -573078020.25, -612342480.0,
+  -244944036.75, -339326272.25, -467331889.25, -69109485.0, -2275361.0, -299384280.5,
+  -42927434.75, 279431705.25, 14884739.75, 18434919.5, 382329355.25, 199436304.5,
+  52976493.5, 506394783.25, 563445244.25, 262496350.75, 554896451.75, 786338944.75,
+  425058779.25, 474794449.75, 1233499788.5, 1901410918.25, 2104533975.0, 2104533975.0,
+  1052266987.5, -1052266987.5, -2104533975.0, -2104533975.0, -1052266987.5, 1052266987.5,
+  2104533975.0, 2104533975.0, 1052266987.5, -1052266987.5, -2104533975.0, -2104533975.0,
+  -1052266987.5, 1052266987.5, 2104533975.0, 2104533975.0, 1052266987.5, -1052266987.5,
+  -2104533975.0, -2104533975.0,
+};
+
+static const double golden_ref_decim_q31[42] =
+{
+  968648.30410331162, -645176.75966821285, -5365530.0581450425, 105765803.85422128, 133822213.13470289, 310171863.37358993,
+  457786842.13489181, 615981173.68773842, 775026159.36929035, 833825623.76221251, 787452018.99460578, 809762370.31697202,
+  829398212.18778777, 769065035.65510762, 660183404.01423454, 548167977.49461973, 453950304.91962314, 227898083.57406673,
+  -12068954.90316317, -162566389.91746485, -329914975.22557425, -493937213.09187549, -682589338.13769388, -764230949.30068517,
+  -797776876.4058243, -853191751.30901337, -851779079.07747114, -782460247.90364969, -735553904.76602769, -639914681.18452561,
+  -493471082.74142474, -387743812.247693, -170599187.83670035, 28144825.411981978, 160313712.31290761, 324123931.98958743,
+  493841736.68117177, 558713440.60084856, 2147483647.0, -206275961.35112116, -1475549637.133044, 2147483647.0,
+};
+
+static const double golden_ref_interp_q31[512] =
+{
+  -1493464.6628135983, -1311314.3425682872, -295689.35399375809, 2090822.4048521793, 2640691.1156932153, 5002169.7244166695,
+  4304937.8708555521, -477631.97558630491, -5293018.0335619897, -12791464.346929003, -17003261.19055615, -14021179.642983144,
+  984745.92303814739, 38642818.931284815, 106509665.35556453, 205640913.38134557, 317068673.75350374, 418074587.95117044,
+  464137094.03402883, 423167760.66688061, 288278952.60166085, 83117794.900033727, -140616749.17032328, -321203791.73527187,
+  -406502013.9622305, -369729398.93118817, -216827090.41866499, 16809388.838674255, 270706870.72894251, 498433885.41705906,
+  646653911.05703902, 688775187.90882564, 621470363.57047963, 464481302.10765183, 252406173.93325049, 31898236.178981323,
+  -142995106.24426568, -233727985.2276085, -209767389.66370612, -70100823.935688019, 150026768.27431118, 417255349.60038257,
+  665382415.02169275, 841152161.90887535, 903157857.66139364, 847519394.4696945, 684553471.53965521, 454315910.98770916,
+  216702741.48521122, 19548479.619756307, -90031183.365856171, -91078928.714281738, 9104642.6688446309, 199328005.03976154,
+  439558543.25921178, 686326003.84720325, 885116881.68906009, 1006890479.6786678, 1016002362.3633037, 909467782.75464094,
+  716454437.25420141, 478190835.95712954, 256788184.52105212, 106826037.2050854, 65007909.763030723, 145074550.66140044,
+  328908910.86005962, 574931190.67247999, 818944651.01934779, 1022821153.8124089, 1137520411.4142051, 1145972757.9492524,
+  1055257572.8725338, 887988375.97880626, 680580836.21128511, 475642059.93663192, 321065340.26788229, 245823044.27224362,
+  274110253.17075408, 403056454.80036563, 598929359.27484584, 831724552.37511718, 1044264489.6801729, 1192111128.4647374,
+  1242886500.9204073, 1186734911.6631503, 1030923011.1809429, 806769264.99673617, 570115763.79521477, 363554832.82213008,
+  241421628.74641073, 231726219.38339376, 333249526.66714054, 528439442.889844, 770751176.75076306, 1006584648.5889229,
+  1177735003.4275699, 1250780171.8836203, 1200494768.0980299, 1035751731.7179497, 799609417.88154995, 535963403.80122292,
+  310259158.80861509, 172799574.81353351, 154948755.47824377, 259143625.35867748, 462891101.6751259, 720395657.14587367,
+  966821649.24772108, 1159396274.5852394, 1251031523.6953712, 1227039047.0940039, 1102939074.1059735, 901742025.30269063,
+  669916622.02393091, 454698002.88722253, 305925590.6288836, 250173924.49980554, 307668451.6829679, 468684121.60498083,
+  690532096.41181004, 933985500.74226916, 1134182162.1666553, 1244216885.6571715, 1238860833.4486864, 1115658374.7731738,
+  899894479.90130472, 638080217.29648578, 397522567.09834945, 220872009.70645931, 157405153.33760497, 221541439.76652241,
+  394196623.4914397, 640945888.77444422, 902292533.41043317, 1119589118.4527762, 1240473221.645, 1238905157.7817941,
+  1107753278.5251992, 872841562.95495367, 593966441.3340348, 318392101.21155387, 114277028.28908023, 23839869.187375341,
+  64846053.135199696, 223345736.40302286, 463509283.564237, 730597658.60129523, 958252484.20828867, 1103492248.896534,
+  1128908697.1621113, 1031367326.4074385, 841601011.22470105, 587712126.93353343, 324875103.40238404, 100924936.77553329,
+  -36817205.589651167, -68890503.074637532, 19899181.646687374, 213782926.57416314, 465695905.80545682, 728186044.7001406,
+  934456278.06210554, 1036642144.4861498, 1013906942.6519933, 863580994.17937696, 619103532.5577141, 332035424.98797917,
+  74551193.791113183, -112841725.14753646, -180902869.21228111, -118642877.92488161, 52641437.750675291, 295346509.44554108,
+  552246245.06752443, 766702718.24167383, 888782583.3752687, 887860034.84419084, 755090556.28883457, 512293737.37399668,
+  219300988.94103521, -81363292.798092172, -315791980.43418002, -437244124.42024654, -422589330.5686695, -282690389.75866252,
+  -49782170.974217996, 221394921.3530519, 462997500.04879081, 620017078.45535636, 648202338.25836074, 537230245.01511884,
+  319316978.50958318, 27742679.005740743, -264563997.16059479, -494669484.09316283, -608728495.19644845, -595361253.08698487,
+  -457540490.09258956, -233742865.30280185, 13283750.895601561, 231268515.10952064, 365884526.72455239, 390002381.33745766,
+  306777599.04412246, 126234960.02584305, -109929467.02058423, -354593426.89630014, -548870836.8859967, -665555191.8175832,
+  -670425593.68842196, -564319267.94811332, -378531596.80202627, -154387645.04830655, 49619526.701297246, 183703145.82355407,
+  214176051.44672582, 131405174.31420359, -48330820.519481838, -285928550.65367651, -519234748.38157582, -717069141.66416168,
+  -832829705.65270877, -851000458.55625486, -775075837.27229452, -622569749.91414225, -419493141.50005114, -201090957.28952852,
+  -13445452.823125944, 101591423.52151895, 104050841.9511455, -20828512.903984815, -247160076.7336596, -542688925.6357429,
+  -831553917.50972271, -1046513974.982572, -1134877162.9500716, -1085869559.365526, -913135782.91573668, -664836303.07338071,
+  -411216282.64815009, -205197548.99702778, -96811145.62896356, -105026782.8878679, -219084653.62130332, -422583032.52098435,
+  -672947396.88299417, -924376277.41611338, -1119545607.6683919, -1228570587.294076, -1213789368.0943527, -1072963124.0814624,
+  -840834388.63418996, -560034944.05060375, -301024321.25339979, -124229455.17369917, -72377474.124022633, -159167805.34437355,
+  -367809555.44900829, -652858336.0235194, -943132744.10492527, -1185916404.1844943, -1320610341.2633581, -1320825008.2592709,
+  -1193212610.2446809, -965439794.90325761, -690123428.9778527, -427088856.63747293, -237586684.60553539, -155089664.45073566,
+  -199075456.91858292, -355523019.48352879, -578665969.54788101, -830097485.02562284, -1050205701.7328724, -1197447403.0388844,
+  -1246153665.9647806, -1190942991.8911784, -1044280629.9611756, -838988398.43760896, -629639194.59973967, -452448946.58127606,
+  -355190980.96831185, -358547868.73894447, -455348808.91764605, -629686830.57610357, -838092646.44099712, -1034583047.8530914,
+  -1169674275.768858, -1217038846.9639273, -1155541100.8611932, -994629200.55999649, -776570981.4447937, -538479085.28412223,
+  -342075035.70203924, -232353296.84831709, -236857406.40236914, -353999224.48781341, -561549748.68128371, -814633736.23879302,
+  -1050147928.1234064, -1222038029.273716, -1282188719.4959962, -1214646234.400882, -1037848529.4134469, -781220544.19815421,
+  -502547917.6101346, -259562871.05406401, -108072234.94958328, -73488712.288499534, -168240299.56723776, -371131370.64310288,
+  -630476854.0552429, -895853898.63684833, -1102284383.5767345, -1205576749.4022007, -1188047325.7819386, -1051671640.1500232,
+  -829662451.08894801, -571718102.97758067, -344142325.6809541, -182246621.87141904, -126434655.20582595, -182207016.97457892,
+  -326318965.58741289, -528372313.22526437, -739425095.13690162, -914522596.91885877, -1013035993.4153771, -1012343170.1903986,
+  -902675671.62220466, -700845538.44322205, -455949894.14083582, -205626563.14483047, -13434238.740588607, 78956656.232546657,
+  51093742.787116081, -87521783.398123279, -306140449.78538591, -554823859.45379484, -772581349.40444553, -915510185.14948392,
+  -947338459.32033014, -862481147.50949645, -689691102.99481571, -453689517.36931872, -210092238.35418522, -6325560.561201117,
+  112337311.4981409, 129877828.56044942, 35813775.612423643, -149848708.55277264, -378620370.37138104, -600668504.42698908,
+  -752977768.76480663, -793349946.05046773, -710516733.53534496, -512476228.19989836, -244892589.26415917, 33471013.578703146,
+  251631091.5824672, 380007494.95637125, 386897168.44577658, 279928266.34689927, 92678946.450841904, -133625645.90056998,
+  -350829887.23685443, -517651260.45862043, -601209196.7098763, -579765775.41077018, -448556454.12794858, -225176270.07030603,
+  39473997.629576474, 308332059.14536309, 513681153.92340434, 611895461.98887646, 583881480.74021935, 438643212.52404112,
+  211044507.00191945, -45345467.576451495, -265674514.07781422, -402339924.24988687, -417364311.56359673, -305905978.91447383,
+  -101970722.64835918, 163393864.62493715, 424065816.63461995, 625065985.5548141, 718312463.84875715, 692118367.27416658,
+  544839282.32563114, 308706025.00092459, 44204066.572562844, -193901173.88018581, -341937846.98226023, -362629319.84287292,
+  -252545634.68986827, -24393079.262781277, 271160672.34477121, 573318431.63561344, 809995468.1571604, 946438793.86529899,
+  946931548.93476379, 816898551.97854364, 595999893.59381878, 331355986.62675494, 87265866.465835869, -82802274.159456789,
+  -141278308.98165852, -71784002.170164168, 115416917.20752639, 384119291.63207227, 667591867.62836897, 920614822.92004979,
+  1077274998.75969, 1104789361.2016265, 992321514.28668678, 781293070.08716464, 514703131.31876719, 255608095.47412276,
+  55007109.16415707, -34377880.91550608, -10481985.996068288, 112000695.88711664, 292350966.71814448, 528371809.2397843,
+  784796708.77549756, 1046773325.2814633, 1292028532.774163, 1521631393.8635063, 1709242287.4258389, 1843084277.0006683,
+  1941039717.1317139, 1968225228.2708793, 1948183143.4186563, 1889145837.1054196, 1827174616.7591701, 1778754618.2723842,
+  1804004401.392504, 1925139868.2883408, 2123566725.3340538, 2147483647.0, 2147483647.0, 1970987153.9122949,
+  1370511338.8139513, 489990073.57068694, -489990073.57068694, -1370511338.8139513, -1991095092.242156, -2147483648.0,
+  -2147483648.0, -2095415990.3201733, -1866260420.6045287, -1716174985.6673813, -1716174985.6673813, -1866260420.6045287,
+  -2095415990.3201733, -2147483648.0, -2147483648.0, -1991095092.242156, -1370511338.8139513, -489990073.57068694,
+  489990073.57068694, 1370511338.8139513, 1991095092.242156, 2147483647.0, 2147483647.0, 2095415990.3201733,
+  1866260420.6045287, 1716174985.6673813, 1716174985.6673813, 1866260420.6045287, 2095415990.3201733, 2147483647.0,
+  2147483647.0, 1991095092.242156, 1370511338.8139513, 489990073.57068694, -489990073.57068694, -1370511338.8139513,
+  -1991095092.242156, -2147483648.0, -2147483648.0, -2095415990.3201733, -1866260420.6045287, -1716174985.6673813,
+  -1716174985.6673813, -1866260420.6045287, -2095415990.3201733, -2147483648.0, -2147483648.0, -1991095092.242156,
+  -1370511338.8139513, -489990073.57068694, 489990073.57068694, 1370511338.8139513, 1991095092.242156, 2147483647.0,
+  2147483647.0, 2095415990.3201733, 1866260420.6045287, 1716174985.6673813, 1716174985.6673813, 1866260420.6045287,
+  2095415990.3201733, 2147483647.0, 2147483647.0, 1991095092.242156, 1370511338.8139513, 489990073.57068694,
+  -489990073.57068694, -1370511338.8139513,
+};
+
+static const double golden_ref_biquad_q31[128] =
+{
+  13760259.011274423, 72061953.447251186, 127753418.93515679, 104699340.16482106, 91554230.773149714, 161173346.91144386,
+  210283561.81194067, 231218097.33977684, 310656637.91332501, 380804325.32140648, 390203984.35448539, 442974113.83423305,
+  533590038.15847492, 565752578.26485896, 601025856.74327219, 688836759.83221507, 734496205.5095942, 745214469.06851149,
+  803767957.06215656, 841017624.71301818, 812072206.81319618, 817936029.27639925, 840560332.36281705, 796682370.733886,
+  773763591.51100504, 816667757.46929944, 820228904.84403467, 800060423.49563575, 829570145.54196906, 828522370.07142162,
+  781148332.64094114, 790352489.80970562, 797687121.63161802, 724565426.70421648, 680763235.36964154, 689046798.21885633,
+  632956802.36594367, 559552792.84553695, 559748022.03942919, 536523031.76318949, 459409249.42608041, 434856730.62924916,
+  408568540.87285495, 295846010.16519541, 207048088.40756315, 169734460.45931309, 76442810.639634058, -21577537.630315229,
+  -54392793.123111062, -109852369.19035351, -191188380.67974067, -220848109.3128711, -263706303.05555427, -360710291.98567116,
+  -405732387.74837184, -414405890.06821835, -498336036.85381371, -586228847.1428231, -610195177.34416366, -667206375.84944201,
+  -740627918.28129399, -734304050.41973543, -738036704.73787284, -807231674.27406669, -819583734.69608569, -784090455.93309188,
+  -811289084.9016118, -849471348.92878509, -843169240.28135073, -858746566.25966787, -870861697.32774079, -823892794.64471316,
+  -811274157.07862246, -843883900.3963834, -800703333.73844445, -733333114.81726456, -745460509.53338206, -749134021.19612765,
+  -699379504.8655901, -679447745.76241207, -653031851.67738914, -565324532.60799575, -517564980.43347335, -524541702.81072789,
+  -475722822.79838985, -408807505.6130237, -385648821.48358274, -317462849.36956477, -211598129.23473075, -175313214.3660256,
+  -143175517.13589883, -35291627.738985598, 42501255.684102103, 66413185.933925621, 134028940.898312, 190483776.55714852,
+  188949999.28836578, 248069952.89773193, 355659222.58568555, 392601842.08213651, 428172775.29700553, 522280046.77253187,
+  559505587.0405252, 549511872.39247501, 685996472.01253283, 1041095117.5614203, 1463800867.7355902, 1782553044.3154793,
+  1732573483.5764713, 1056196470.8422241, 10068321.150903225, -908373215.42903304, -1275593604.4823134, -855608570.9712075,
+  19421779.953069687, 823284298.56208313, 1142311410.9689782, 735244740.88780808, -100372385.4866147, -872055554.85886443,
+  -1174211994.6102724, -755621991.62595701, 93117053.702075601, 876141296.97234809, 1182571896.6041038, 762015749.07249618,
+  -89796919.012321591, -873813537.14015961,
+};
+
+static const float golden_in_f32[128] =
+{
+  0.117473215f, 0.217543155f, -0.218608335f, 0.0789454579f, 0.356563568f, -0.0390953757f,
+  0.00513934018f, 0.476977915f, 0.166512758f, -0.0350708477f, 0.41439414f, 0.437886387f,
+  0.0171598215f, 0.369657278f, 0.582436383f, 0.195963711f, 0.248126581f, 0.648820519f,
+  0.356496632f, 0.124364018f, 0.581166446f, 0.486396194f, 0.0587277748f, 0.44637689f,
+  0.616840005f, 0.183842614f, 0.288712382f, 0.667528093f, 0.259753287f, 0.139860809f,
+  0.632610738f, 0.383901924f, -0.00263106916f, 0.451892406f, 0.494852364f, 0.00325459964f,
+  0.165529102f, 0.557098746f, 0.0940856636f, -0.0336666107f, 0.447371781f, 0.196614012f,
+  -0.249048159f, 0.188409865f, 0.241729438f, -0.314045966f, -0.0514755882f, 0.197802573f,
+  -0.245316193f, -0.257612348f, 0.127655327f, -0.2174384f, -0.428947568f, -0.056163054f,
+  -0.0426785201f, -0.598820567f, -0.266749263f, -0.0708882287f, -0.536529601f, -0.51407212f,
+  -0.0218971148f, -0.418817818f, -0.672514081f, -0.151515931f, -0.236912981f, -0.650110245f,
+  -0.376947701f, -0.193531558f, -0.5838027f, -0.468848765f, -0.0974940807f, -0.489611f,
+  -0.602054536f, -0.0748177916f, -0.253193021f, -0.644245505f, -0.223688766f, -0.120683871f,
+  -0.512616038f, -0.307445139f, 0.0584810041f, -0.356084675f, -0.413752615f, 0.0430131853f,
+  -0.128517568f, -0.418022484f, 0.0940890536f, 0.101117924f, -0.300563097f, -0.0576384179f,
+  0.335881352f, -0.0936421752f, -0.120872021f, 0.369723916f, 0.0935680941f, -0.18538104f,
+  0.375870407f, 0.37687403f, -0.0801199079f, 0.272303343f, 0.569088399f, 0.0541902557f,
+  0.114264749f, 0.601653814f, 0.980000019f, 0.980000019f, 0.980000019f, 0.980000019f,
+  -0.980000019f, -0.980000019f, -0.980000019f, -0.980000019f, 0.980000019f, 0.980000019f,
+  0.980000019f, 0.980000019f, -0.980000019f, -0.980000019f, -0.980000019f, -0.980000019f,
+  0.980000019f, 0.980000019f, 0.980000019f, 0.980000019f, -0.980000019f, -0.980000019f,
+  -0.980000019f, -0.980000019f,
+};
+
+static const float golden_fir_a_f32[29] =
+{
+  0.00106997858f, -0.000693125534f, -0.00316994102f, -0.00422565127f, 2.96333753e-18f, 0.00974801742f,
+  0.0165740307f, 0.00759403361f, -0.0200465713f, -0.0471208803f, -0.0387040488f, 0.0295206215f,
+  0.144584581f, 0.254749984f, 0.300237924f, 0.254749984f, 0.144584581f, 0.0295206215f,
+  -0.0387040488f, -0.0471208803f, -0.0200465713f, 0.00759403361f, 0.0165740307f, 0.00974801742f,
+  2.96333753e-18f, -0.00422565127f, -0.00316994102f, -0.000693125534f, 0.00106997858f,
+};
+
+static const float golden_fir_b_f32[3] =
+{
+  0.25f, 0.5f, 0.25f,
+};
+
+static const float golden_decim_f32[24] =
+{
+  -0.00219154125f, -0.00133852533f, 0.00224016886f, 0.00837714691f, 0.00987472199f, -0.00342681608f,
+  -0.0295249745f, -0.0438322052f, -0.0114800846f, 0.0809079781f, 0.202024445f, 0.288369685f,
+  0.288369685f, 0.202024445f, 0.0809079781f, -0.0114800846f, -0.0438322052f, -0.0295249745f,
+  -0.00342681608f, 0.00987472199f, 0.00837714691f, 0.00224016886f, -0.00133852533f, -0.00219154125f,
+};
+
+static const float golden_interp_f32[32] =
+{
+  -0.00592006184f, -0.00519802189f, -0.00117210625f, 0.00828797463f, 0.021430729f, 0.0294544678f,
+  0.0192352496f, -0.017241437f, -0.0716847405f, -0.114923552f, -0.105202623f, -0.0082277786f,
+  0.180512488f, 0.424306512f, 0.653604805f, 0.79273808f, 0.79273808f, 0.653604805f,
+  0.424306512f, 0.180512488f, -0.0082277786f, -0.105202623f, -0.114923552f, -0.0716847405f,
+  -0.017241437f, 0.0192352496f, 0.0294544678f, 0.021430729f, 0.00828797463f, -0.00117210625f,
+  -0.00519802189f, -0.00592006184f,
+};
+
+static const float golden_biquad_f32[10] =
+{
+  0.0461300313f, 0.0922600627f, 0.0461300313f, 1.30723488f, -0.491754979f, 1.18242645f,
+  -0.504751503f, 0.450983733f, 0.504751503f, -0.633410215f,
+};
+
+static const double golden_ref_fir_a_f32[128] =
+{
+  0.00012569382339595175, 0.00015134283082710379, -0.00075707411272678271, -0.00095000684179361201, 0.00010051028513134407, 0.0015296665576398202,
+  0.0026363346703803196, 0.0014906753106419613, -0.0035600931735495353, -0.0084589705975909833, -0.0063627354565749823, 0.0054652485567454126,
+  0.023987315525961811, 0.042664978275756396, 0.053853209767654224, 0.056484448267483806, 0.05885941142790839, 0.070674370591667882,
+  0.09472832796893127, 0.12705872805608345, 0.15989115970973677, 0.18588742017619364, 0.20498550720507708, 0.22348122771599468,
+  0.24558227803299798, 0.27161986135600968, 0.30015207501188979, 0.32787294360925917, 0.35116754380271159, 0.3693259798098556,
+  0.38208026327384759, 0.3881633037954213, 0.38612328542628732, 0.37848366482790929, 0.36960275276829818, 0.36363617653767327,
+  0.36415636555288694, 0.3717533215610439, 0.38114670228314018, 0.38714938917458053, 0.38803286700928979, 0.38354477194391878,
+  0.37445997824975141, 0.36369946028355227, 0.35157030889081364, 0.3360856455539174, 0.3175722677948008, 0.29789433424880241,
+  0.27869950435854135, 0.2619847358351558, 0.24921737927376941, 0.23766610864453103, 0.22225644200540107, 0.19962372654036772,
+  0.1681845797519326, 0.12815980325625442, 0.084785497273356894, 0.04419326637807993, 0.0092810454639726033, -0.019256126892330989,
+  -0.042121187127299758, -0.063910843675389295, -0.088321569823281459, -0.11441699706600156, -0.14067246239681791, -0.16641321939956333,
+  -0.19143390376359068, -0.21694178196344097, -0.24565403092260896, -0.27673789365377788, -0.30537752619717318, -0.32824647826450476,
+  -0.34439388390298986, -0.35372815023703202, -0.35878516467990879, -0.36325600638022432, -0.36812362862414888, -0.37430884677253062,
+  -0.38306001627765801, -0.39279464486819432, -0.39982743675364774, -0.40272765346870315, -0.40046809375089487, -0.39260243274452045,
+  -0.38070726558972878, -0.36835697991237604, -0.35715867478255192, -0.34912487094262962, -0.3449627245904856, -0.34092963689327294,
+  -0.33009012297317031, -0.31007274665670054, -0.2836413285011975, -0.25678588148875975, -0.2367407524492165, -0.22455410298587239,
+  -0.21274331494054613, -0.19379812225414694, -0.16605892331485306, -0.13224141620990068, -0.096937986187746128, -0.064138088756778344,
+  -0.033190567909991739, -0.0017991293956581703, 0.028478611105918025, 0.051700915453146909, 0.066088296466696395, 0.077311328546720265,
+  0.093773228983028603, 0.12985416592990784, 0.18424657973730524, 0.23418846685387365, 0.2489717073282175, 0.212348527648937,
+  0.16058644951903031, 0.17556811118907997, 0.33625370687763606, 0.64769487172450257, 0.97988546671690613, 1.1138850582851365,
+  0.87518083701240879, 0.26571457778836705, -0.47356521662473128, -0.96972407923499238, -0.93987755416486285, -0.37612308886069945,
+  0.41428485349318034, 0.97649576603030619,
+};
+
+static const double golden_ref_fir_b_f32[128] =
+{
+  0.029368303716182709, 0.11312239617109299, 0.083487797528505325, -0.035182014107704163, 0.073961537331342697, 0.18824430461972952,
+  0.070878039230592549, 0.11204030481167138, 0.28140198171604425, 0.19373314548283815, 0.12769130058586597, 0.30790095496922731,
+  0.32683168398216367, 0.21046582702547312, 0.33472769008949399, 0.43262343853712082, 0.30562259629368782, 0.33525934815406799,
+  0.47556606307625771, 0.37154445052146912, 0.29659777879714966, 0.44327327609062195, 0.40317165199667215, 0.26255715824663639,
+  0.39208038989454508, 0.46597487851977348, 0.31830940395593643, 0.35719886794686317, 0.47088046371936798, 0.33172386884689331,
+  0.29302141070365906, 0.44724605232477188, 0.34944587922655046, 0.20763304783031344, 0.34900152659974992, 0.36121293337782845,
+  0.16672266635578126, 0.2228528875275515, 0.3434530645608902, 0.17790086567401886, 0.11853105574846268, 0.26442274078726768,
+  0.14788791164755821, -0.028268110007047653, 0.092375252395868301, 0.089455693960189819, -0.10945952031761408, -0.054798642173409462,
+  0.024703341536223888, -0.1376105397939682, -0.15822139009833336, -0.054935023188591003, -0.18404226005077362, -0.28287414740771055,
+  -0.14598804898560047, -0.18508516531437635, -0.37676722928881645, -0.30080183036625385, -0.23626383021473885, -0.4145048875361681,
+  -0.39664273895323277, -0.24417104199528694, -0.3830117080360651, -0.47884047776460648, -0.30311473086476326, -0.31886303424835205,
+  -0.47852029278874397, -0.39938430115580559, -0.33695337921380997, -0.45749643072485924, -0.4047485776245594, -0.28836198151111603,
+  -0.41969265416264534, -0.44213446602225304, -0.25122078508138657, -0.306362334638834, -0.44134319946169853, -0.3030767273157835,
+  -0.24441813677549362, -0.36334027163684368, -0.26725632790476084, -0.13664195127785206, -0.26686024013906717, -0.28514418005943298,
+  -0.11406095325946808, -0.15801110863685608, -0.21761837042868137, -0.032181613147258759, -0.0010595489293336868, -0.13941167201846838,
+  -0.019989645108580589, 0.13012052793055773, 0.0069312453269958496, 0.0085844248533248901, 0.17803597636520863, 0.092869766056537628,
+  0.024669105187058449, 0.23580845072865486, 0.2623746395111084, 0.12223438918590546, 0.258393794298172, 0.36616759933531284,
+  0.19793341495096684, 0.22109339199960232, 0.57439309917390347, 0.88541346788406372, 0.98000001907348633, 0.98000001907348633,
+  0.49000000953674316, -0.49000000953674316, -0.98000001907348633, -0.98000001907348633, -0.49000000953674316, 0.49000000953674316,
+  0.98000001907348633, 0.98000001907348633, 0.49000000953674316, -0.49000000953674316, -0.98000001907348633, -0.98000001907348633,
+  -0.49000000953674316, 0.49000000953674316, 0.98000001907348633, 0.98000001907348633, 0.49000000953674316, -0.49000000953674316,
+  -0.98000001907348633, -0.98000001907348633,
+};
+
+static const double golden_ref_decim_f32[42] =
+{
+  0.00045106199883726897, -0.00030043414168872025, -0.0024985199206087275, 0.049251039530331567, 0.062315824683811721, 0.14443503278144409,
+  0.21317361284374381, 0.28683858403204043, 0.36089967755703689, 0.38828031336762808, 0.3666859131671909, 0.37707498558770586,
+  0.38621864240755072, 0.35812380956584833, 0.30742184951755891, 0.25526060946965878, 0.21138708953034932, 0.10612331421859526,
+  -0.0056200445721515018, -0.075700878618110923, -0.15362863531095367, -0.23000743495165432, -0.31785543294256802, -0.35587277517913951,
+  -0.37149380583538383, -0.39729836229127963, -0.3966405361425398, -0.36436145314115592, -0.34251897895361172, -0.2979835007667937,
+  -0.22979037766872124, -0.18055728004176458, -0.079441441977212465, 0.013105952798979026, 0.074651886204245663, 0.15093197100127548,
+  0.22996297928713111, 0.26017121938776955, 1.0528767889028761, -0.096054729529025384, -0.68710634746860144, 1.0047254710893494,
+};
+
+static const double golden_ref_interp_f32[512] =
+{
+  -0.00069544869673160425, -0.00061062834176907332, -0.00013769108904455873, 0.00097361502488832463, 0.0012296676969287823, 0.0023293169463375479,
+  0.0020046429192652898, -0.00022241488197236037, -0.0024647536707884943, -0.005956490314878167, -0.0079177612211177931, -0.0065291205338207231,
+  0.0004585597075577319, 0.017994465651557767, 0.049597428947116357, 0.095759013671480486, 0.14764660900561055, 0.19468115247703432,
+  0.21613067686998855, 0.19705284290355882, 0.13424034457715664, 0.038704737571677056, -0.065479775924909445, -0.14957216781672245,
+  -0.18929224888112511, -0.17216866954330018, -0.10096798594679496, 0.0078274774908295222, 0.12605770984041775, 0.23210136479622745,
+  0.30112169297717672, 0.32073594018722013, 0.28939468940855084, 0.21629096273647253, 0.11753578631148807, 0.014853777646719857,
+  -0.066587284203784111, -0.10883807698319037, -0.097680555712634398, -0.032643240327844505, 0.069861661870696784, 0.19429966498042195,
+  0.30984283264602064, 0.3916919981760586, 0.42056565187844186, 0.39465697486510348, 0.31877005424773175, 0.21155733667984597,
+  0.10091007883851609, 0.0091029692500865754, -0.04192403770063443, -0.042411929156807679, 0.0042396822098634754, 0.092819332121402573,
+  0.20468539056305762, 0.3195954424369376, 0.4121646612496529, 0.46886991146415929, 0.47311296292123728, 0.42350393473598746,
+  0.33362509085701519, 0.2226749560496471, 0.11957631453774735, 0.049744752844310174, 0.030271669366015264, 0.067555598796693858,
+  0.15316014151171442, 0.26772319424776631, 0.38135081990429398, 0.47628821258278164, 0.52969921579793244, 0.53363514609967289,
+  0.49139259478474462, 0.41350180388269647, 0.31692014155752435, 0.22148808945506987, 0.1495076915092162, 0.11447026217154459,
+  0.12764252146973007, 0.18768778340701706, 0.2788982214709162, 0.38730193359527842, 0.48627355850356635, 0.5551200169601177,
+  0.57876414092959316, 0.55261651393387601, 0.48006093779634906, 0.37568121303912, 0.26548083295493818, 0.16929340151816574,
+  0.11242069941963122, 0.10790592899297588, 0.1551814029604473, 0.24607378136268673, 0.35890896850666293, 0.46872748346891291,
+  0.54842557978197515, 0.58243988992063933, 0.5590239306087732, 0.4823094845266015, 0.37234715290545001, 0.24957741189512675,
+  0.14447568347570822, 0.080466078617093997, 0.07215363773819658, 0.12067314444116825, 0.21555045167393155, 0.33546035549693681,
+  0.45021140605871141, 0.53988595638374304, 0.58255694894253951, 0.57138458574237438, 0.51359603263962594, 0.41990635474690224,
+  0.31195423794888455, 0.21173526050441227, 0.14245770333887803, 0.11649630542956174, 0.14326928166271249, 0.21824805128482952,
+  0.32155406978855683, 0.43492089322326694, 0.52814472774033328, 0.57938363907452328, 0.57688953299540702, 0.51951891822600982,
+  0.41904602701608956, 0.29712926418261321, 0.185110875240449, 0.10285154437000105, 0.073297484614251118, 0.10316327202758371,
+  0.18356210562150882, 0.29846367741614688, 0.42016268720285038, 0.52134929231885008, 0.5776403402333925, 0.57691015503358867,
+  0.51583780537072643, 0.40644851846253072, 0.27658716908605391, 0.14826286811122055, 0.05321438407245703, 0.011101307157039213,
+  0.030196300950970242, 0.10400346282113565, 0.21583832745775786, 0.34021104344884945, 0.44622108342190303, 0.51385361613772562,
+  0.52568907004807885, 0.48026782886649938, 0.39190099957777813, 0.27367477702350457, 0.15128175423683443, 0.046996837607051922,
+  -0.017144347541889461, -0.032079645189602192, 0.0092662726789161012, 0.099550429718499214, 0.21685655709440146, 0.33908805376874224,
+  0.4351401184056542, 0.48272412204113946, 0.4721372193120506, 0.40213624549973837, 0.28829255551163235, 0.15461605109344018,
+  0.034715606031755046, -0.052546025801854863, -0.08423946543023661, -0.055247393185774291, 0.024513084825707243, 0.13753143833290099,
+  0.25715969861961985, 0.35702377405661806, 0.41387164090065565, 0.41344204583590932, 0.35161643880521321, 0.23855535897659955,
+  0.10211997349298238, -0.037887742100366203, -0.14705210356552489, -0.20360766003960007, -0.19678348987146488, -0.13163797279560502,
+  -0.023181633993257775, 0.10309503828266167, 0.21560000854669634, 0.28871794928537076, 0.30184273460189226, 0.25016732636682693,
+  0.14869355220817576, 0.012918692193104535, -0.12319720786699545, -0.23034842176865666, -0.2834612902421117, -0.27723668635260357,
+  -0.21305889427038077, -0.10884500507005604, 0.006185729403796747, 0.10769279542968674, 0.17037825980228233, 0.18160900785980602,
+  0.14285444676690362, 0.058782731584285736, -0.051189898977504089, -0.1651204336787376, -0.25558790718296703, -0.30992329607594393,
+  -0.31219125382515045, -0.26278164390729208, -0.17626751381194206, -0.071892350482667094, 0.023105893111485941, 0.085543442418250432,
+  0.099733495702829217, 0.06119030620627107, -0.0225057878484997, -0.13314585397856718, -0.24178752238808593, -0.33391133878178014,
+  -0.38781655001789023, -0.39627796380818081, -0.36092280540914412, -0.2899066256678533, -0.1953417131188544, -0.093640275851825855,
+  -0.0062610287028461581, 0.047307193085495677, 0.048452449196905972, -0.0096990326092654192, -0.11509287906684146, -0.2527092137087521,
+  -0.38722245044307702, -0.48732102376596376, -0.52846834255797692, -0.50564740423886412, -0.42521197908662101, -0.30958853198006853,
+  -0.19148750769615386, -0.095552557565766916, -0.045081204763860794, -0.048906911391025272, -0.10201924612473343, -0.19678055737136721,
+  -0.31336554903444741, -0.43044624824950162, -0.52132905645626282, -0.57209777198901435, -0.56521473302960801, -0.49963740467950934,
+  -0.39154403435918061, -0.2607865997306425, -0.14017537743622971, -0.057848853985657381, -0.033703390018129199, -0.074118279463358444,
+  -0.17127466282876869, -0.30401084638543913, -0.43918040483071907, -0.552235353982933, -0.61495710526226366, -0.61505706801114557,
+  -0.55563291489755251, -0.44956793534001704, -0.32136376615148199, -0.19887875444543479, -0.11063492548894027, -0.072219249725589171,
+  -0.092701727070539142, -0.16555330202502921, -0.26946233803795672, -0.38654425809445647, -0.48904013402491009, -0.5576048957846883,
+  -0.58028551849377696, -0.5545760437918219, -0.4862810586986146, -0.39068441517956726, -0.29319859132169745, -0.21068794852190748,
+  -0.1653986791681436, -0.16696185563784569, -0.21203830497803117, -0.29322076473097891, -0.39026728144598227, -0.48176525504441869,
+  -0.54467201358606421, -0.56672786435832445, -0.538090750630141, -0.46316031499222321, -0.36161904439464487, -0.25074886535428298,
+  -0.15929110412862496, -0.10819794262938706, -0.11029533161310569, -0.16484373627581372, -0.26149198043069855, -0.37934339927868632,
+  -0.4890132457767451, -0.5690558109264735, -0.59706565812221635, -0.56561373639680468, -0.48328588410951995, -0.36378416358911836,
+  -0.2340171097298589, -0.12086838514240131, -0.050325059874112843, -0.034220850282059602, -0.078342998848969392, -0.17282152105972237,
+  -0.2935886756699394, -0.41716448586850524, -0.51329116565343313, -0.56139041699853287, -0.55322764021257176, -0.48972276249362001,
+  -0.3863416794622162, -0.26622698609565876, -0.16025375299326072, -0.084865187489286426, -0.058875716164172122, -0.08484675293948693,
+  -0.15195411534347877, -0.24604254034043965, -0.3443216558678554, -0.4258577879144218, -0.47173166402494926, -0.47140903983891874,
+  -0.42034112602722612, -0.32635664192667113, -0.21231821299399722, -0.095752325993856469, -0.006255802600512804, 0.036767055397898971,
+  0.023792375911190967, -0.04075550141434868, -0.14255774563065288, -0.25835997869228683, -0.35976121197895333, -0.42631763662066585,
+  -0.44113883283791133, -0.40162407003164785, -0.32116243612916529, -0.21126563774666052, -0.097831819493167924, -0.0029455717180672247,
+  0.052311135310923282, 0.060479078611750586, 0.016677091561672172, -0.069778740811309331, -0.176308849214449, -0.27970806768679418,
+  -0.35063259510702272, -0.36943235442628569, -0.33086013350872095, -0.2386403405878246, -0.11403700196704233, 0.0155861487393507,
+  0.11717485578723269, 0.176954780280973, 0.18016303562834257, 0.1303517572204303, 0.043156995196066653, -0.062224291846633972,
+  -0.16336789888880002, -0.2410501534216816, -0.27995985059883, -0.26997448119530904, -0.20887537911351711, -0.10485587332455058,
+  0.018381516855671708, 0.14357830765580434, 0.23920142946181935, 0.28493602648084526, 0.27189099861600369, 0.20425916098649791,
+  0.098275255457569793, -0.021115628597873026, -0.12371433821686834, -0.18735413032189574, -0.19435040537445392, -0.14244857270295017,
+  -0.047483816965222594, 0.076086193847892683, 0.19747102681051873, 0.29106902077982133, 0.33449029780398032, 0.32229272506663548,
+  0.25371056026232092, 0.14375244677013474, 0.020584122781825365, -0.090292270162780741, -0.15922721699507369, -0.16886243136127393,
+  -0.11760071855369646, -0.011358909657923022, 0.1262690292403712, 0.26697219954990253, 0.37718353680953609, 0.44071991094230639,
+  0.44094936605645146, 0.38039803080095264, 0.27753407290341015, 0.15429964981158353, 0.040636332004061915, -0.038557811425692992,
+  -0.065787835339058673, -0.033427029809038507, 0.053745190750918041, 0.17886948440178288, 0.31087169006129295, 0.4286946785600394,
+  0.50164525165348073, 0.5144576205713548, 0.4620856963378388, 0.36381792287676251, 0.23967731512279031, 0.11902679592687909,
+  0.02561468386357918, -0.016008447493780859, -0.0048810559783498964, 0.052154387668773006, 0.13613652761916045, 0.24604228692462199,
+  0.36544943047459555, 0.48744179945081639, 0.60164766548447446, 0.70856482838952595, 0.79592796211462669, 0.85825300323838893,
+  0.90386706819878648, 0.91652630429455373, 0.90719348043991432, 0.87970209771825569, 0.85084449783702976, 0.82829716985310353,
+  0.84005501786678305, 0.89646312361184433, 0.98886282788068658, 1.0602536474459172, 1.0548626894788722, 0.91781243153753955,
+  0.63819406848117088, 0.22816940602685776, -0.22816940602685776, -0.63819406848117088, -0.92717592004321903, -1.063084160719336,
+  -1.0621075137852496, -0.97575412103093173, -0.8690452441026193, -0.79915625814416869, -0.79915625814416869, -0.8690452441026193,
+  -0.97575412103093173, -1.0621075137852496, -1.063084160719336, -0.92717592004321903, -0.63819406848117088, -0.22816940602685776,
+  0.22816940602685776, 0.63819406848117088, 0.92717592004321903, 1.063084160719336, 1.0621075137852496, 0.97575412103093173,
+  0.8690452441026193, 0.79915625814416869, 0.79915625814416869, 0.8690452441026193, 0.97575412103093173, 1.0621075137852496,
+  1.063084160719336, 0.92717592004321903, 0.63819406848117088, 0.22816940602685776, -0.22816940602685776, -0.63819406848117088,
+  -0.92717592004321903, -1.063084160719336, -1.0621075137852496, -0.97575412103093173, -0.8690452441026193, -0.79915625814416869,
+  -0.79915625814416869, -0.8690452441026193, -0.97575412103093173, -1.0621075137852496, -1.063084160719336, -0.92717592004321903,
+  -0.63819406848117088, -0.22816940602685776, 0.22816940602685776, 0.63819406848117088, 0.92717592004321903, 1.063084160719336,
+  1.0621075137852496, 0.97575412103093173, 0.8690452441026193, 0.79915625814416869, 0.79915625814416869, 0.8690452441026193,
+  0.97575412103093173, 1.0621075137852496, 1.063084160719336, 0.92717592004321903, 0.63819406848117088, 0.22816940602685776,
+  -0.22816940602685776, -0.63819406848117088,
+};
+
+static const double golden_ref_biquad_f32[128] =
+{
+  0.0064076198907068007, 0.033556461382270565, 0.059489820446663504, 0.048754430625194092, 0.042633265084273717, 0.075052193017757132,
+  0.097920919088126682, 0.10766932384777224, 0.14466077930631138, 0.17732584436996535, 0.18170290532468861, 0.20627591408946674,
+  0.24847224296469739, 0.26344909576447956, 0.27987450045804019, 0.32076464141901462, 0.342026479943071, 0.34701756541854767,
+  0.3742836644980404, 0.39162939750260189, 0.37815063941945931, 0.38088119409180621, 0.39141645580925533, 0.37098419002472061,
+  0.36031180358999598, 0.38029061216547205, 0.38194890025410599, 0.37255722077172099, 0.38629875765812338, 0.38581085063698711,
+  0.36375059553066896, 0.3680366114493544, 0.37145206123582647, 0.33740211891662919, 0.31700513554281989, 0.32086246818303044,
+  0.29474352617533006, 0.26056212051973593, 0.26065303136070073, 0.24983805198639711, 0.21392914800132448, 0.2024959874604052,
+  0.19025459054347624, 0.13776406896730539, 0.096414311802596672, 0.079038795210949475, 0.035596481332442503, -0.010047804009611389,
+  -0.025328604151011243, -0.051153988889918095, -0.089029026531567981, -0.1028404186915257, -0.12279782369696207, -0.16796882754768613,
+  -0.18893387732949685, -0.19297279549518498, -0.23205581689360172, -0.27298409745826374, -0.28414429528261076, -0.31069221132592362,
+  -0.34488178859897672, -0.34193701402418586, -0.34367516944094706, -0.37589658794175185, -0.38164846542950259, -0.36512062251061833,
+  -0.37778597206350034, -0.39556597261625315, -0.39263132249679544, -0.3998850786889922, -0.40552662750662249, -0.38365503303005527,
+  -0.37777902711153394, -0.39296412373636047, -0.37285660648487373, -0.34148490536578291, -0.3471321619079949, -0.34884276949792647,
+  -0.32567401547586761, -0.31639256825238921, -0.30409170978873445, -0.26324980471647264, -0.24101002382909084, -0.24425880496054439,
+  -0.22152573807815859, -0.19036586478704318, -0.17958176093190764, -0.14783019161621014, -0.0985330885052179, -0.081636605631985285,
+  -0.066671319852585564, -0.016433965853232722, 0.019791171537774981, 0.030926036493450576, 0.062412080166374298, 0.088700915923442786,
+  0.087986701672536721, 0.11551658076035644, 0.16561674082250205, 0.18281949141465031, 0.1993835015775583, 0.24320561613028874,
+  0.26054011144054062, 0.25588643001893885, 0.31944202702664115, 0.48479771965825658, 0.68163542731392934, 0.8300659900180174,
+  0.80679246840749741, 0.49182991071497817, 0.0046885545960091424, -0.42299411634852691, -0.59399447266476801, -0.39842376305840521,
+  0.0090439380076348108, 0.38337156499182368, 0.53193015151767786, 0.3423750013370056, -0.046739503506945779, -0.40608246256945357,
+  -0.5467850324474941, -0.35186391087935487, 0.043360966040859927, 0.40798502658865143, 0.55067790982265152, 0.35484123350834534,
+  -0.041814908408556783, -0.40690107838144829,
+};
+
+#endif /* DSP_GOLDEN_H */
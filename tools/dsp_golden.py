@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+"""Generate the DSP golden vectors (tools/dsp_golden.h) for tools/dsp_golden_check.c.
+
+One test signal (two tones, LCG noise and a closing full-scale square
+burst that drives the outputs into saturation) is filtered by a 29-tap and
+a 3-tap FIR, a decimator by 3, an interpolator by 4 and a two-stage biquad.
+Each type gets its own input and coefficients, quantized as the library
+stores them, and a reference computed from exactly those values in double
+precision (fixed point: exact integer sums, ideal recursion for the
+biquad, clamped to the output range). References for q15 and q31 are in
+LSBs of the output; f32 references are plain values.
+"""
+
+import argparse
+import math
+
+WRAP = 6
+LENGTH = 128
+BURST = 24
+DECIM = 3
+INTERP = 4
+POST_SHIFT = 1
+
+
+def q(x, bits):
+    scale = float(1 << bits)
+    return max(-(1 << bits), min((1 << bits) - 1, int(round(x * scale))))
+
+
+def f32(x):
+    """Round a double to the nearest float, as the C initializer will."""
+    if x == 0.0:
+        return 0.0
+    m, e = math.frexp(x)
+    return math.ldexp(round(m * (1 << 24)) / float(1 << 24), e)
+
+
+def clamp(x, bits):
+    return max(-float(1 << bits), min(float((1 << bits) - 1), x))
+
+
+def signal():
+    seed = 1
+    values = []
+    for n in range(LENGTH):
+        seed = (seed * 1664525 + 1013904223) & 0xFFFFFFFF
+        noise = ((seed >> 8) / float(1 << 24) - 0.5) * 0.1
+        if n < LENGTH - BURST:
+            values.append(0.4 * math.sin(0.07 * n) + 0.3 * math.sin(1.9 * n + 0.5) + noise)
+        else:
+            values.append(0.98 if (n // 4) % 2 == 0 else -0.98)
+    return values
+
+
+def lowpass(taps, cutoff, gain):
+    """Hamming-windowed sinc, cutoff in cycles/sample, DC gain `gain`."""
+    mid = (taps - 1) / 2.0
+    h = []
+    for i in range(taps):
+        t = i - mid
+        sinc = 2.0 * cutoff if t == 0 else math.sin(2.0 * math.pi * cutoff * t) / (math.pi * t)
+        h.append(sinc * (0.54 - 0.46 * math.cos(2.0 * math.pi * i / (taps - 1))))
+    total = sum(h)
+    return [v * gain / total for v in h]
+
+
+def biquad_sections():
+    """RBJ low-pass (f0 = 0.08 fs, Q 0.707) then peaking EQ (f0 = 0.2 fs, +6 dB, Q 1.5)."""
+    sections = []
+    w = 2.0 * math.pi * 0.08
+    alpha = math.sin(w) / (2.0 * 0.707)
+    cw = math.cos(w)
+    a0 = 1.0 + alpha
+    sections.append([(1.0 - cw) / 2.0 / a0, (1.0 - cw) / a0, (1.0 - cw) / 2.0 / a0,
+                     2.0 * cw / a0, -(1.0 - alpha) / a0])
+    w = 2.0 * math.pi * 0.2
+    amp = 10.0 ** (6.0 / 40.0)
+    alpha = math.sin(w) / (2.0 * 1.5)
+    cw = math.cos(w)
+    a0 = 1.0 + alpha / amp
+    sections.append([(1.0 + alpha * amp) / a0, -2.0 * cw / a0, (1.0 - alpha * amp) / a0,
+                     2.0 * cw / a0, -(1.0 - alpha / amp) / a0])
+    return sections
+
+
+def fir_exact(x, h):
+    """y[n] = sum h[k] x[n - k], h in natural order; exact for integer inputs."""
+    return [sum(h[k] * x[n - k] for k in range(len(h)) if n - k >= 0) for n in range(len(x))]
+
+
+def interp_exact(x, h, factor):
+    stuffed = []
+    for v in x:
+        stuffed += [v] + [0] * (factor - 1)
+    return fir_exact(stuffed, h)
+
+
+def biquad_ideal(x, sections, bits):
+    """Direct form I in double; bits clamps each stage output like the fixed-point paths."""
+    for b0, b1, b2, a1, a2 in sections:
+        x1 = x2 = y1 = y2 = 0.0
+        out = []
+        for v in x:
+            y = b0 * v + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2
+            if bits is not None:
+                y = clamp(y, bits)
+            x2, x1, y2, y1 = x1, v, y1, y
+            out.append(y)
+        x = out
+    return x
+
+
+def fixed_vectors(bits, src, fir_a, fir_b, decim, interp, sections):
+    one = float(1 << bits)
+    x = [q(v, bits) for v in src]
+    ca = [q(v, bits) for v in fir_a]
+    cb = [q(v, bits) for v in fir_b]
+    cd = [q(v, bits) for v in decim]
+    ci = [q(v, bits) for v in interp]
+    cs = [[q(c / (1 << POST_SHIFT), bits) for c in s] for s in sections]
+    ref = {
+        "fir_a": [clamp(v / one, bits) for v in fir_exact(x, ca)],
+        "fir_b": [clamp(v / one, bits) for v in fir_exact(x, cb)],
+        "decim": [clamp(v / one, bits) for v in fir_exact(x, cd)[DECIM - 1::DECIM]],
+        "interp": [clamp(v / one, bits) for v in interp_exact(x, ci, INTERP)],
+        "biquad": biquad_ideal([float(v) for v in x],
+                               [[c * (1 << POST_SHIFT) / one for c in s] for s in cs], bits),
+    }
+    return x, {"fir_a": ca, "fir_b": cb, "decim": cd, "interp": ci, "biquad": cs}, ref
+
+
+def f32_vectors(src, fir_a, fir_b, decim, interp, sections):
+    x = [f32(v) for v in src]
+    coeffs = {
+        "fir_a": [f32(v) for v in fir_a],
+        "fir_b": [f32(v) for v in fir_b],
+        "decim": [f32(v) for v in decim],
+        "interp": [f32(v) for v in interp],
+        "biquad": [[f32(c) for c in s] for s in sections],
+    }
+    ref = {
+        "fir_a": fir_exact(x, coeffs["fir_a"]),
+        "fir_b": fir_exact(x, coeffs["fir_b"]),
+        "decim": fir_exact(x, coeffs["decim"])[DECIM - 1::DECIM],
+        "interp": interp_exact(x, coeffs["interp"], INTERP),
+        "biquad": biquad_ideal(x, coeffs["biquad"], None),
+    }
+    return x, coeffs, ref
+
+
+def rows(values, fmt):
+    lines = []
+    for i in range(0, len(values), WRAP):
+        lines.append("  " + ", ".join(fmt(v) for v in values[i:i + WRAP]) + ",")
+    return lines
+
+
+def fmt_f32(x):
+    text = "%.9g" % (x if x != 0.0 else 0.0)
+    if "." not in text and "e" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def fmt_double(x):
+    text = "%.17g" % (x if x != 0.0 else 0.0)
+    if "." not in text and "e" not in text:
+        text += ".0"
+    return text
+
+
+def array(ctype, name, values, fmt, aligned=False):
+    attr = " __attribute__((aligned(4)))" if aligned else ""
+    return ["static const %s %s[%d]%s =" % (ctype, name, len(values), attr), "{"] + rows(values, fmt) + ["};", ""]
+
+
+def biquad_layout(sections, q15):
+    """q15 stages are {b0, 0, b1, b2, a1, a2}; q31 and f32 stages {b0, b1, b2, a1, a2}."""
+    flat = []
+    for b0, b1, b2, a1, a2 in sections:
+        flat += [b0, 0, b1, b2, a1, a2] if q15 else [b0, b1, b2, a1, a2]
+    return flat
+
+
+def generate():
+    src = signal()
+    fir_a = lowpass(29, 0.15, 1.0)
+    fir_b = [0.25, 0.5, 0.25]
+    decim = lowpass(24, 0.9 / (2.0 * DECIM), 1.0)
+    interp = lowpass(32, 0.9 / (2.0 * INTERP), INTERP * 0.9)
+    sections = biquad_sections()
+
+    lines = ["/* Generated by tools/dsp_golden.py - do not edit */",
+             "#ifndef DSP_GOLDEN_H",
+             "#define DSP_GOLDEN_H",
+             "",
+             "#include \"dsp_types.h\"",
+             "",
+             "#define GOLDEN_LEN          %dU" % LENGTH,
+             "#define GOLDEN_FIR_A_TAPS   %dU" % len(fir_a),
+             "#define GOLDEN_FIR_B_TAPS   %dU" % len(fir_b),
+             "#define GOLDEN_DECIM        %dU" % DECIM,
+             "#define GOLDEN_DECIM_TAPS   %dU" % len(decim),
+             "#define GOLDEN_INTERP       %dU" % INTERP,
+             "#define GOLDEN_INTERP_TAPS  %dU" % len(interp),
+             "#define GOLDEN_STAGES       %dU" % len(sections),
+             "#define GOLDEN_POST_SHIFT   %d" % POST_SHIFT,
+             ""]
+
+    types = [
+        ("q15", "dsp_q15", fixed_vectors(15, src, fir_a, fir_b, decim, interp, sections), lambda v: "%6d" % v),
+        ("q31", "dsp_q31", fixed_vectors(31, src, fir_a, fir_b, decim, interp, sections),
+         lambda v: ("(-2147483647 - 1)" if v == -2147483648 else "%11d" % v)),
+        ("f32", "float", f32_vectors(src, fir_a, fir_b, decim, interp, sections), fmt_f32),
+    ]
+    for suffix, ctype, (x, coeffs, ref), fmt in types:
+        aligned = suffix == "q15"
+        lines += array(ctype, "golden_in_%s" % suffix, x, fmt, aligned)
+        for name in ("fir_a", "fir_b", "decim", "interp"):
+            # The library takes FIR coefficients and the interpolator prototype time-reversed
+            lines += array(ctype, "golden_%s_%s" % (name, suffix), list(reversed(coeffs[name])), fmt, aligned)
+        lines += array(ctype, "golden_biquad_%s" % suffix, biquad_layout(coeffs["biquad"], suffix == "q15"), fmt,
+                       aligned)
+        for name in ("fir_a", "fir_b", "decim", "interp", "biquad"):
+            lines += array("double", "golden_ref_%s_%s" % (name, suffix), ref[name], fmt_double)
+
+    lines += ["#endif /* DSP_GOLDEN_H */", ""]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--out", default="tools/dsp_golden.h")
+    args = parser.parse_args()
+
+    with open(args.out, "w") as handle:
+        handle.write(generate())
+    print("%s: %d samples" % (args.out, LENGTH))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,297 @@
+/*
+ * Host golden-vector check of application/modules/dsp: FIR, decimator,
+ * interpolator and biquad cascade in q15, q31 and f32, against the
+ * double-precision references in tools/dsp_golden.h.
+ *
+ * Every filter runs the test signal once as a single block and once split
+ * into blocks of 1, 2, 3, 5, ... samples, so both the two-output and the
+ * odd-sample paths run and the state has to carry across calls. Fixed-point
+ * FIR, decimator and interpolator outputs must be exactly the truncated
+ * reference, biquad outputs within a few LSB of it (the rounding feeds
+ * back), and f32 outputs within a small relative bound. The end of the
+ * signal saturates the outputs. Exits non-zero on the first mismatch.
+ *
+ * Regenerate the vectors after changing the test filters:
+ *
+ *   python3 tools/dsp_golden.py
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -o dsp_golden_check tools/dsp_golden_check.c \
+ *      application/modules/dsp/src/dsp_fir.c application/modules/dsp/src/dsp_resample.c \
+ *      application/modules/dsp/src/dsp_biquad.c -Iapplication/modules/dsp/src -Itools -lm
+ *
+ * Usage: dsp_golden_check
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dsp.h"
+#include "dsp_golden.h"
+
+/*
+ * Allowed error. Fixed-point FIR outputs are the reference truncated, so
+ * ref - out must lie in [0, 1) LSB (less a hair for the double rounding of
+ * the q31 references); the biquad's truncation recirculates, so it gets a
+ * symmetric bound. f32 errors are relative to max(1, |ref|).
+ */
+#define TOL_FIR_FIXED_LO   (-1e-6)
+#define TOL_FIR_FIXED_HI   1.0
+#define TOL_BIQUAD_FIXED   8.0
+#define TOL_FIR_F32        1e-6
+#define TOL_BIQUAD_F32     2e-6
+
+#define MAX_TAPS           32U
+#define MAX_OUT            (GOLDEN_LEN * GOLDEN_INTERP)
+
+typedef enum
+{
+  MODE_WHOLE,
+  MODE_SPLIT,
+} check_mode;
+
+static const uint32_t split_blocks[] = { 1U, 2U, 3U, 5U, 8U, 13U, 4U, 7U };
+
+static dsp_q15 state_q15[2U * (MAX_TAPS + 1U)] __attribute__((aligned(4)));
+static dsp_q31 state_q31[2U * (MAX_TAPS + 1U)];
+static float   state_f32[2U * (MAX_TAPS + 1U)];
+static dsp_q15 poly_q15[MAX_TAPS] __attribute__((aligned(4)));
+static dsp_q31 poly_q31[MAX_TAPS];
+static float   poly_f32[MAX_TAPS];
+static dsp_q15 out_q15[MAX_OUT] __attribute__((aligned(4)));
+static dsp_q31 out_q31[MAX_OUT];
+static float   out_f32[MAX_OUT];
+
+static uint32_t checked;
+
+/* Length of the next block: the whole signal, or the next entry of split_blocks */
+static uint32_t next_block(check_mode mode, uint32_t *index, uint32_t left)
+{
+  uint32_t block = left;
+
+  if (mode == MODE_SPLIT)
+  {
+    block = split_blocks[*index % (sizeof(split_blocks) / sizeof(split_blocks[0]))];
+    (*index)++;
+  }
+  return (block < left) ? block : left;
+}
+
+static const char *mode_name(check_mode mode)
+{
+  return (mode == MODE_WHOLE) ? "one block" : "split blocks";
+}
+
+/* Requires lo <= ref - out < hi, in LSB */
+static int compare_fixed(const char *name, check_mode mode, const double *ref, uint32_t count, uint32_t bits,
+                         double lo, double hi)
+{
+  uint32_t i;
+
+  for (i = 0U; i < count; i++)
+  {
+    const double got = (bits == 15U) ? (double)out_q15[i] : (double)out_q31[i];
+    const double err = ref[i] - got;
+
+    if ((err < lo) || (err >= hi))
+    {
+      printf("%s (%s): output %u is %.0f, reference %.3f (ref - out %.3f LSB, allowed [%g, %g))\n", name,
+             mode_name(mode), (unsigned)i, got, ref[i], err, lo, hi);
+      return 1;
+    }
+  }
+  checked += count;
+  return 0;
+}
+
+static int compare_f32(const char *name, check_mode mode, const double *ref, uint32_t count, double tol)
+{
+  uint32_t i;
+
+  for (i = 0U; i < count; i++)
+  {
+    const double scale = (fabs(ref[i]) > 1.0) ? fabs(ref[i]) : 1.0;
+    const double err = fabs((double)out_f32[i] - ref[i]) / scale;
+
+    if (err > tol)
+    {
+      printf("%s (%s): output %u is %.9g, reference %.9g (relative error %.3g, limit %.1g)\n", name,
+             mode_name(mode), (unsigned)i, (double)out_f32[i], ref[i], err, tol);
+      return 1;
+    }
+  }
+  checked += count;
+  return 0;
+}
+
+static int check_fir(const char *name, uint16_t taps, const dsp_q15 *c15, const dsp_q31 *c31, const float *c32,
+                     const double *ref15, const double *ref31, const double *ref32, check_mode mode)
+{
+  dsp_fir_inst_q15 fir15;
+  dsp_fir_inst_q31 fir31;
+  dsp_fir_inst_f32 fir32;
+  uint32_t index = 0U;
+  uint32_t done;
+  uint32_t block;
+
+  if ((dsp_fir_init_q15(&fir15, taps, c15, state_q15) != DSP_OK) ||
+      (dsp_fir_init_q31(&fir31, taps, c31, state_q31) != DSP_OK) ||
+      (dsp_fir_init_f32(&fir32, taps, c32, state_f32) != DSP_OK))
+  {
+    printf("%s: init failed\n", name);
+    return 1;
+  }
+  for (done = 0U; done < GOLDEN_LEN; done += block)
+  {
+    block = next_block(mode, &index, GOLDEN_LEN - done);
+    dsp_fir_q15(&fir15, &golden_in_q15[done], &out_q15[done], block);
+    dsp_fir_q31(&fir31, &golden_in_q31[done], &out_q31[done], block);
+    dsp_fir_f32(&fir32, &golden_in_f32[done], &out_f32[done], block);
+  }
+
+  if ((compare_fixed(name, mode, ref15, GOLDEN_LEN, 15U, TOL_FIR_FIXED_LO, TOL_FIR_FIXED_HI) != 0) ||
+      (compare_fixed(name, mode, ref31, GOLDEN_LEN, 31U, TOL_FIR_FIXED_LO, TOL_FIR_FIXED_HI) != 0) ||
+      (compare_f32(name, mode, ref32, GOLDEN_LEN, TOL_FIR_F32) != 0))
+  {
+    return 1;
+  }
+  return 0;
+}
+
+static int check_decim(check_mode mode)
+{
+  dsp_decim_inst_q15 dec15;
+  dsp_decim_inst_q31 dec31;
+  dsp_decim_inst_f32 dec32;
+  const uint32_t expected = GOLDEN_LEN / GOLDEN_DECIM;
+  uint32_t index = 0U;
+  uint32_t done;
+  uint32_t block;
+  uint32_t n15 = 0U;
+  uint32_t n31 = 0U;
+  uint32_t n32 = 0U;
+
+  if ((dsp_decim_init_q15(&dec15, GOLDEN_DECIM, GOLDEN_DECIM_TAPS, golden_decim_q15, state_q15) != DSP_OK) ||
+      (dsp_decim_init_q31(&dec31, GOLDEN_DECIM, GOLDEN_DECIM_TAPS, golden_decim_q31, state_q31) != DSP_OK) ||
+      (dsp_decim_init_f32(&dec32, GOLDEN_DECIM, GOLDEN_DECIM_TAPS, golden_decim_f32, state_f32) != DSP_OK))
+  {
+    printf("decim: init failed\n");
+    return 1;
+  }
+  for (done = 0U; done < GOLDEN_LEN; done += block)
+  {
+    block = next_block(mode, &index, GOLDEN_LEN - done);
+    n15 += dsp_decim_q15(&dec15, &golden_in_q15[done], &out_q15[n15], block);
+    n31 += dsp_decim_q31(&dec31, &golden_in_q31[done], &out_q31[n31], block);
+    n32 += dsp_decim_f32(&dec32, &golden_in_f32[done], &out_f32[n32], block);
+  }
+
+  if ((n15 != expected) || (n31 != expected) || (n32 != expected))
+  {
+    printf("decim (%s): %u/%u/%u outputs, expected %u\n", mode_name(mode), (unsigned)n15, (unsigned)n31,
+           (unsigned)n32, (unsigned)expected);
+    return 1;
+  }
+  if ((compare_fixed("decim q15", mode, golden_ref_decim_q15, expected, 15U, TOL_FIR_FIXED_LO, TOL_FIR_FIXED_HI) != 0) ||
+      (compare_fixed("decim q31", mode, golden_ref_decim_q31, expected, 31U, TOL_FIR_FIXED_LO, TOL_FIR_FIXED_HI) != 0) ||
+      (compare_f32("decim f32", mode, golden_ref_decim_f32, expected, TOL_FIR_F32) != 0))
+  {
+    return 1;
+  }
+  return 0;
+}
+
+static int check_interp(check_mode mode)
+{
+  dsp_interp_inst_q15 int15;
+  dsp_interp_inst_q31 int31;
+  dsp_interp_inst_f32 int32;
+  uint32_t index = 0U;
+  uint32_t done;
+  uint32_t block;
+
+  if ((dsp_interp_init_q15(&int15, GOLDEN_INTERP, GOLDEN_INTERP_TAPS, golden_interp_q15, poly_q15, state_q15) !=
+       DSP_OK) ||
+      (dsp_interp_init_q31(&int31, GOLDEN_INTERP, GOLDEN_INTERP_TAPS, golden_interp_q31, poly_q31, state_q31) !=
+       DSP_OK) ||
+      (dsp_interp_init_f32(&int32, GOLDEN_INTERP, GOLDEN_INTERP_TAPS, golden_interp_f32, poly_f32, state_f32) !=
+       DSP_OK))
+  {
+    printf("interp: init failed\n");
+    return 1;
+  }
+  for (done = 0U; done < GOLDEN_LEN; done += block)
+  {
+    block = next_block(mode, &index, GOLDEN_LEN - done);
+    dsp_interp_q15(&int15, &golden_in_q15[done], &out_q15[done * GOLDEN_INTERP], block);
+    dsp_interp_q31(&int31, &golden_in_q31[done], &out_q31[done * GOLDEN_INTERP], block);
+    dsp_interp_f32(&int32, &golden_in_f32[done], &out_f32[done * GOLDEN_INTERP], block);
+  }
+
+  if ((compare_fixed("interp q15", mode, golden_ref_interp_q15, MAX_OUT, 15U, TOL_FIR_FIXED_LO, TOL_FIR_FIXED_HI) != 0) ||
+      (compare_fixed("interp q31", mode, golden_ref_interp_q31, MAX_OUT, 31U, TOL_FIR_FIXED_LO, TOL_FIR_FIXED_HI) != 0) ||
+      (compare_f32("interp f32", mode, golden_ref_interp_f32, MAX_OUT, TOL_FIR_F32) != 0))
+  {
+    return 1;
+  }
+  return 0;
+}
+
+/* In place: the input is copied to the output buffer first, as a caller filtering a buffer would */
+static int check_biquad(check_mode mode)
+{
+  dsp_biquad_inst_q15 bq15;
+  dsp_biquad_inst_q31 bq31;
+  dsp_biquad_inst_f32 bq32;
+  uint32_t index = 0U;
+  uint32_t done;
+  uint32_t block;
+
+  if ((dsp_biquad_init_q15(&bq15, GOLDEN_STAGES, golden_biquad_q15, state_q15, GOLDEN_POST_SHIFT) != DSP_OK) ||
+      (dsp_biquad_init_q31(&bq31, GOLDEN_STAGES, golden_biquad_q31, state_q31, GOLDEN_POST_SHIFT) != DSP_OK) ||
+      (dsp_biquad_init_f32(&bq32, GOLDEN_STAGES, golden_biquad_f32, state_f32) != DSP_OK))
+  {
+    printf("biquad: init failed\n");
+    return 1;
+  }
+  memcpy(out_q15, golden_in_q15, sizeof(golden_in_q15));
+  memcpy(out_q31, golden_in_q31, sizeof(golden_in_q31));
+  memcpy(out_f32, golden_in_f32, sizeof(golden_in_f32));
+  for (done = 0U; done < GOLDEN_LEN; done += block)
+  {
+    block = next_block(mode, &index, GOLDEN_LEN - done);
+    dsp_biquad_q15(&bq15, &out_q15[done], &out_q15[done], block);
+    dsp_biquad_q31(&bq31, &out_q31[done], &out_q31[done], block);
+    dsp_biquad_f32(&bq32, &out_f32[done], &out_f32[done], block);
+  }
+
+  if ((compare_fixed("biquad q15", mode, golden_ref_biquad_q15, GOLDEN_LEN, 15U, -TOL_BIQUAD_FIXED, TOL_BIQUAD_FIXED) != 0) ||
+      (compare_fixed("biquad q31", mode, golden_ref_biquad_q31, GOLDEN_LEN, 31U, -TOL_BIQUAD_FIXED, TOL_BIQUAD_FIXED) != 0) ||
+      (compare_f32("biquad f32", mode, golden_ref_biquad_f32, GOLDEN_LEN, TOL_BIQUAD_F32) != 0))
+  {
+    return 1;
+  }
+  return 0;
+}
+
+int main(void)
+{
+  check_mode mode;
+
+  for (mode = MODE_WHOLE; mode <= MODE_SPLIT; mode++)
+  {
+    if ((check_fir("fir 29 taps", GOLDEN_FIR_A_TAPS, golden_fir_a_q15, golden_fir_a_q31, golden_fir_a_f32,
+                   golden_ref_fir_a_q15, golden_ref_fir_a_q31, golden_ref_fir_a_f32, mode) != 0) ||
+        (check_fir("fir 3 taps", GOLDEN_FIR_B_TAPS, golden_fir_b_q15, golden_fir_b_q31, golden_fir_b_f32,
+                   golden_ref_fir_b_q15, golden_ref_fir_b_q31, golden_ref_fir_b_f32, mode) != 0) ||
+        (check_decim(mode) != 0) || (check_interp(mode) != 0) || (check_biquad(mode) != 0))
+    {
+      return 1;
+    }
+  }
+
+  printf("fir, decim, interp, biquad (q15, q31, f32): %u outputs within tolerance: ok\n", (unsigned)checked);
+  return 0;
+}
@@ -0,0 +1,170 @@
+/*
+ * Host driver for the log-mel front-end (application/modules/features).
+ *
+ * Reads a 16-bit PCM WAV file (first channel), pushes it through feat_push()
+ * in blocks the size of one DMA buffer, exactly as feat_stream does on the
+ * target, and prints one CSV line of log-mel energies per frame.
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -DDSP_FFT_ITCM=0 -o feat_wav tools/feat_wav.c \
+ *      application/modules/features/src/feat.c application/modules/fmath/src/fmath.c \
+ *      application/modules/dsp/src/dsp_fft.c application/modules/dsp/src/dsp_fft_tables.c \
+ *      -Iapplication/modules/features/src -Iapplication/modules/dsp/src \
+ *      -Iapplication/modules/fmath/src -Iapplication/modules/memory/src -lm
+ *
+ * Usage: feat_wav in.wav [frame_len hop fft_len num_mel f_min f_max block] > out.csv
+ * Defaults: 400 160 512 40 20 (rate / 2) 160, log floor 1e-6.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "feat.h"
+
+typedef struct
+{
+  uint32_t rate;
+  uint16_t channels;
+  dsp_q15  *samples;   /* First channel only */
+  uint32_t count;
+} wav_data;
+
+static uint32_t le32(const uint8_t *p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+static uint16_t le16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+static int wav_read(const char *path, wav_data *wav)
+{
+  FILE *file = fopen(path, "rb");
+  uint8_t header[12];
+  uint8_t chunk[8];
+  int have_format = 0;
+
+  memset(wav, 0, sizeof(*wav));
+  if ((file == NULL) || (fread(header, 1, 12, file) != 12) ||
+      (memcmp(header, "RIFF", 4) != 0) || (memcmp(header + 8, "WAVE", 4) != 0))
+  {
+    fprintf(stderr, "%s: not a RIFF/WAVE file\n", path);
+    if (file != NULL)
+    {
+      fclose(file);
+    }
+    return -1;
+  }
+
+  while (fread(chunk, 1, 8, file) == 8)
+  {
+    const uint32_t size = le32(chunk + 4);
+
+    if (memcmp(chunk, "fmt ", 4) == 0)
+    {
+      uint8_t format[16];
+
+      if ((size < 16) || (fread(format, 1, 16, file) != 16))
+      {
+        break;
+      }
+      if ((le16(format) != 1) || (le16(format + 14) != 16))
+      {
+        fprintf(stderr, "%s: only 16-bit PCM is supported\n", path);
+        fclose(file);
+        return -1;
+      }
+      wav->channels = le16(format + 2);
+      wav->rate = le32(format + 4);
+      have_format = 1;
+      fseek(file, (long)(size - 16 + (size & 1U)), SEEK_CUR);
+    }
+    else if ((memcmp(chunk, "data", 4) == 0) && have_format)
+    {
+      const uint32_t frames = size / (2U * wav->channels);
+      int16_t *raw = malloc(size);
+      uint32_t i;
+
+      wav->samples = malloc(frames * sizeof(dsp_q15) + 1U);
+      if ((raw == NULL) || (wav->samples == NULL) || (fread(raw, 1, size, file) != size))
+      {
+        break;
+      }
+      for (i = 0; i < frames; i++)
+      {
+        const uint8_t *p = (const uint8_t *)&raw[i * wav->channels];
+
+        wav->samples[i] = (dsp_q15)le16(p);
+      }
+      wav->count = frames;
+      free(raw);
+      fclose(file);
+      return 0;
+    }
+    else
+    {
+      fseek(file, (long)(size + (size & 1U)), SEEK_CUR);
+    }
+  }
+  fprintf(stderr, "%s: no usable data chunk\n", path);
+  fclose(file);
+  return -1;
+}
+
+static void print_frame(const float *features, uint32_t index, void *context)
+{
+  const feat_config *config = context;
+  uint16_t m;
+
+  (void)index;
+  for (m = 0; m < config->num_mel; m++)
+  {
+    printf("%s%.6f", (m == 0) ? "" : ",", features[m]);
+  }
+  printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+  feat_config config;
+  feat_inst inst;
+  wav_data wav;
+  uint32_t block;
+  uint32_t done = 0;
+  uint32_t frames = 0;
+  void *workspace;
+
+  if ((argc < 2) || (wav_read(argv[1], &wav) != 0))
+  {
+    fprintf(stderr, "usage: %s in.wav [frame_len hop fft_len num_mel f_min f_max block]\n", argv[0]);
+    return 1;
+  }
+
+  config.sample_rate = wav.rate;
+  config.frame_len = (uint16_t)((argc > 2) ? atoi(argv[2]) : 400);
+  config.hop = (uint16_t)((argc > 3) ? atoi(argv[3]) : 160);
+  config.fft_len = (uint16_t)((argc > 4) ? atoi(argv[4]) : 512);
+  config.num_mel = (uint16_t)((argc > 5) ? atoi(argv[5]) : 40);
+  config.f_min = (argc > 6) ? (float)atof(argv[6]) : 20.0f;
+  config.f_max = (argc > 7) ? (float)atof(argv[7]) : 0.5f * (float)wav.rate;
+  config.log_floor = 1e-6f;
+  block = (argc > 8) ? (uint32_t)atoi(argv[8]) : config.hop;
+
+  workspace = aligned_alloc(8, (feat_workspace_size(&config) + 7U) & ~7U);
+  if ((block == 0) || (feat_init(&inst, &config, workspace, print_frame, &config) != FEAT_OK))
+  {
+    fprintf(stderr, "invalid configuration\n");
+    return 1;
+  }
+
+  while (done < wav.count)
+  {
+    const uint32_t n = (wav.count - done < block) ? (wav.count - done) : block;
+
+    frames += feat_push(&inst, &wav.samples[done], n);
+    done += n;
+  }
+  fprintf(stderr, "%u Hz, %u samples, %u frames of %u mel bands\n", (unsigned)wav.rate, (unsigned)wav.count,
+          (unsigned)frames, (unsigned)config.num_mel);
+
+  free(workspace);
+  free(wav.samples);
+  return 0;
+}
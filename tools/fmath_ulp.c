@@ -0,0 +1,191 @@
+/*
+ * Host accuracy test for application/modules/fmath against glibc.
+ *
+ * Single-precision functions are checked on every float of their domain
+ * (or every step-th one), against the double-precision glibc result;
+ * double-precision ones on random arguments against long double.
+ * Prints the max error in ULP per function and exits non-zero if one
+ * exceeds the bound documented in fmath.h.
+ *
+ * Build from the repository root (FMA hardware is not needed: fmaf is exact
+ * in software, so results match the target bit for bit):
+ *
+ *   cc -O2 -o fmath_ulp tools/fmath_ulp.c application/modules/fmath/src/fmath.c \
+ *      -Iapplication/modules/fmath/src -lm
+ *
+ * Usage: fmath_ulp [step] [double_samples]   (defaults: 1 = exhaustive, 10000000)
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fmath.h"
+
+typedef struct
+{
+  const char *name;
+  float      (*fn)(float);
+  double     (*ref)(double);
+  float      lo;
+  float      hi;
+  double     bound;
+} test_f32;
+
+typedef struct
+{
+  const char  *name;
+  double      (*fn)(double);
+  long double (*ref)(long double);
+  double      lo;
+  double      hi;
+  double      bound;
+} test_f64;
+
+static float  f_expf(float x)     { return fmath_expf(x); }
+static float  f_logf(float x)     { return fmath_logf(x); }
+static float  f_sinf(float x)     { return fmath_sinf(x); }
+static float  f_cosf(float x)     { return fmath_cosf(x); }
+static float  f_tanhf(float x)    { return fmath_tanhf(x); }
+static float  f_sigmoidf(float x) { return fmath_sigmoidf(x); }
+static float  f_sqrtf(float x)    { return fmath_sqrtf(x); }
+static double f_exp(double x)     { return fmath_exp(x); }
+static double f_log(double x)     { return fmath_log(x); }
+static double f_sqrt(double x)    { return fmath_sqrt(x); }
+
+static double r_sigmoid(double x) { return 1.0 / (1.0 + exp(-x)); }
+
+/* Error of got in units of the float spacing at the reference value */
+static double ulp_f32(float got, double ref)
+{
+  int e;
+
+  if (isnan(ref) || isnan(got))
+  {
+    return (isnan(ref) && isnan(got)) ? 0.0 : INFINITY;
+  }
+  if (isinf((float)ref) || isinf(got))
+  {
+    return (got == (float)ref) ? 0.0 : INFINITY;   /* overflow: the reference rounds to inf too */
+  }
+  frexp(ref, &e);
+  if (e < -125)
+  {
+    e = -125;   /* subnormal range: fixed spacing */
+  }
+  return fabs((double)got - ref) / ldexp(1.0, e - 24);
+}
+
+static double ulp_f64(double got, long double ref)
+{
+  int e;
+
+  if (isnan(ref) || isnan(got))
+  {
+    return (isnan(ref) && isnan(got)) ? 0.0 : INFINITY;
+  }
+  if (isinf(ref) || isinf(got))
+  {
+    return ((long double)got == ref) ? 0.0 : INFINITY;
+  }
+  frexpl(ref, &e);
+  if (e < -1021)
+  {
+    e = -1021;
+  }
+  return (double)(fabsl((long double)got - ref) / ldexpl(1.0L, e - 53));
+}
+
+static uint32_t order_f32(float x)
+{
+  const uint32_t u = fmath_asuint(x);
+
+  return ((u >> 31) != 0U) ? (0x80000000U - (u & 0x7FFFFFFFU)) : (u + 0x80000000U);
+}
+
+static float unorder_f32(uint32_t o)
+{
+  return fmath_asfloat((o >= 0x80000000U) ? (o - 0x80000000U) : ((0x80000000U - o) | 0x80000000U));
+}
+
+static double rand_uniform(double lo, double hi)
+{
+  const double u = (double)(((uint64_t)rand() << 31) ^ (uint64_t)rand()) / 4611686018427387904.0;
+
+  return lo + (hi - lo) * u;
+}
+
+int main(int argc, char **argv)
+{
+  static const test_f32 tests32[] =
+  {
+    {"expf",     f_expf,     exp,       -87.3365402f, 89.0f,       1.1},
+    {"logf",     f_logf,     log,       1e-45f,       3.40282347e38f, 1.1},
+    {"sinf",     f_sinf,     sin,       -INFINITY,    INFINITY,    0.9},
+    {"cosf",     f_cosf,     cos,       -INFINITY,    INFINITY,    0.9},
+    {"tanhf",    f_tanhf,    tanh,      -3.40282347e38f, 3.40282347e38f, 1.5},
+    {"sigmoidf", f_sigmoidf, r_sigmoid, -87.3365402f, 3.40282347e38f, 2.5},
+    {"sqrtf",    f_sqrtf,    sqrt,      0.0f,         3.40282347e38f, 0.5},
+  };
+  static const test_f64 tests64[] =
+  {
+    {"exp",  f_exp,  expl,  -708.39, 709.78, 1.3},
+    {"log",  f_log,  logl,  -1022.0, 1023.0, 1.2},   /* log2 of the argument */
+    {"sqrt", f_sqrt, sqrtl, -1022.0, 1023.0, 0.5},
+  };
+  const uint32_t step = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 1U;
+  const uint32_t samples = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 10000000U;
+  int fail = 0;
+  uint32_t t;
+
+  for (t = 0U; t < sizeof(tests32) / sizeof(tests32[0]); t++)
+  {
+    const test_f32 *test = &tests32[t];
+    const uint32_t end = order_f32(test->hi);
+    double worst = 0.0;
+    float worst_x = 0.0f;
+    uint32_t o;
+
+    for (o = order_f32(test->lo); (o <= end) && (o >= order_f32(test->lo)); o += (step != 0U) ? step : 1U)
+    {
+      const float x = unorder_f32(o);
+      const double err = ulp_f32(test->fn(x), test->ref((double)x));
+
+      if (err > worst)
+      {
+        worst = err;
+        worst_x = x;
+      }
+    }
+    printf("%-9s max %.3f ULP at %.9g (bound %.1f)%s\n", test->name, worst, worst_x, test->bound,
+           (worst <= test->bound) ? "" : "  FAIL");
+    fail |= (worst > test->bound);
+  }
+
+  for (t = 0U; t < sizeof(tests64) / sizeof(tests64[0]); t++)
+  {
+    const test_f64 *test = &tests64[t];
+    double worst = 0.0;
+    double worst_x = 0.0;
+    uint32_t i;
+
+    srand(1);
+    for (i = 0U; i < samples; i++)
+    {
+      /* exp: uniform argument; log and sqrt: uniform exponent, so every binade is covered */
+      const double x = (test->fn == f_exp) ? rand_uniform(test->lo, test->hi)
+                                           : exp2(rand_uniform(test->lo, test->hi));
+      const double err = ulp_f64(test->fn(x), test->ref((long double)x));
+
+      if (err > worst)
+      {
+        worst = err;
+        worst_x = x;
+      }
+    }
+    printf("%-9s max %.3f ULP at %.17g (bound %.1f)%s\n", test->name, worst, worst_x, test->bound,
+           (worst <= test->bound) ? "" : "  FAIL");
+    fail |= (worst > test->bound);
+  }
+  return fail;
+}
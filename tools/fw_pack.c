@@ -0,0 +1,660 @@
+/*
+ * Packs a firmware image into an fw_update stream: an fw_image_header
+ * followed by the payload, ready to be fed to fw_decode_write() in chunks.
+ *
+ * The payload is the image itself, or with -b a bsdiff-style patch against
+ * the image running on the target, and with -z it is compressed; both as
+ * described in fw_decode.h. The patch is found greedily: runs of the new
+ * image that mostly match the base at some offset become difference bytes,
+ * which are mostly zero, and the rest become extra bytes. A new offset is
+ * taken from an exact match of at least DELTA_MIN bytes, looked up through
+ * a hash of DELTA_BLOCK-byte blocks of the base.
+ *
+ * Every packed file is decoded again, through the target's decoder into a
+ * simulated slot, and must give the image back bit for bit. With -t the
+ * tool instead does this for random images and edits of them, with every
+ * encoding, and checks that damaged payloads and wrong bases are refused.
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -o fw_pack tools/fw_pack.c application/modules/fw_update/src/fw_update.c \
+ *      application/modules/fw_update/src/fw_decode.c -Iapplication/modules/fw_update/src \
+ *      -Iapplication/modules/boot/src
+ *
+ * The image is the bank binary from app_seal; version must match its
+ * application header.
+ *
+ * Usage: fw_pack [-z] [-b base.bin] <image.bin> <update.ufw> <version>
+ *        fw_pack -t [cycles]   (default: 200)
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fw_update.h"
+#include "fw_decode.h"
+#include "boot_header.h"
+
+/* FW_UPDATE_SLOT_SECTORS 128 KB sectors, as fw_update_hal.h */
+#define PACK_SECTOR_SIZE   (128U * 1024U)
+#define PACK_SLOT_SIZE     (6U * PACK_SECTOR_SIZE)
+#define PACK_APP_HEADER    (BOOT_APP_BASE - 0x08000000U + BOOT_HEADER_OFFSET)   /*!< In a bank image */
+
+#define DELTA_BLOCK        8U
+#define DELTA_WINDOW       32U     /*!< A run continues while half of the next bytes match */
+#define DELTA_MIN          12U
+#define DELTA_CHAIN        64U
+#define DELTA_HASH_BITS    20U
+
+#define LZ_CHAIN           128U
+#define LZ_MAX_LENGTH      (1U << FW_LZ_LENGTH_BITS)
+
+typedef struct
+{
+  uint8_t  *data;
+  uint32_t size;
+  uint32_t capacity;
+} pack_buffer;
+
+typedef struct
+{
+  uint8_t  *bytes;
+  uint32_t busy;   /*!< Next erase poll returns FW_BUSY */
+} pack_flash;
+
+static uint32_t seed = 12345U;
+
+static uint32_t pack_random(uint32_t range)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed % range;
+}
+
+static void pack_put(pack_buffer *buffer, uint8_t value)
+{
+  if (buffer->size == buffer->capacity)
+  {
+    buffer->capacity = (buffer->capacity != 0U) ? (2U * buffer->capacity) : 4096U;
+    buffer->data = realloc(buffer->data, buffer->capacity);
+    if (buffer->data == NULL)
+    {
+      printf("out of memory\n");
+      exit(1);
+    }
+  }
+  buffer->data[buffer->size++] = value;
+}
+
+static void pack_put32(pack_buffer *buffer, uint32_t value)
+{
+  uint32_t i;
+
+  for (i = 0U; i < 4U; i++)
+  {
+    pack_put(buffer, (uint8_t)(value >> (8U * i)));
+  }
+}
+
+/* ---- Delta ---- */
+
+static uint32_t delta_hash(const uint8_t *block)
+{
+  uint64_t value;
+
+  memcpy(&value, block, sizeof(value));
+  return (uint32_t)((value * 0x9E3779B97F4A7C15ULL) >> (64U - DELTA_HASH_BITS));
+}
+
+/* One patch record: differences over [start, end), extra bytes over [end, extra_end) */
+static void delta_record(pack_buffer *out, const uint8_t *base, const uint8_t *image, uint32_t start,
+                         uint32_t end, uint32_t extra_end, int64_t offset, int64_t next_base)
+{
+  uint32_t i;
+
+  pack_put32(out, end - start);
+  pack_put32(out, extra_end - end);
+  pack_put32(out, (uint32_t)(int32_t)(next_base - ((int64_t)end + offset)));
+  for (i = start; i < end; i++)
+  {
+    pack_put(out, (uint8_t)(image[i] - base[(int64_t)i + offset]));
+  }
+  for (i = end; i < extra_end; i++)
+  {
+    pack_put(out, image[i]);
+  }
+}
+
+static void delta_encode(pack_buffer *out, const uint8_t *base, uint32_t base_size, const uint8_t *image,
+                         uint32_t size)
+{
+  int32_t *head = malloc((1U << DELTA_HASH_BITS) * sizeof(int32_t));
+  int32_t *chain = malloc((base_size + 1U) * sizeof(int32_t));
+  int64_t offset = 0;   /* Base position minus image position in the current run */
+  uint32_t start = 0U;
+  uint32_t end = 0U;
+  uint32_t i = 0U;
+  uint32_t p;
+
+  if ((head == NULL) || (chain == NULL))
+  {
+    printf("out of memory\n");
+    exit(1);
+  }
+  memset(head, 0xFF, (1U << DELTA_HASH_BITS) * sizeof(int32_t));
+  for (p = 0U; p + DELTA_BLOCK <= base_size; p++)
+  {
+    const uint32_t hash = delta_hash(&base[p]);
+
+    chain[p] = head[hash];
+    head[hash] = (int32_t)p;
+  }
+
+  while (i < size)
+  {
+    const uint32_t window = ((size - i) < DELTA_WINDOW) ? (size - i) : DELTA_WINDOW;
+    uint32_t matches = 0U;
+    uint32_t best = 0U;
+    int64_t best_offset = 0;
+    uint32_t k;
+    int32_t candidate;
+    uint32_t steps = 0U;
+
+    /* Carry on with the current run while it mostly matches */
+    for (k = 0U; k < window; k++)
+    {
+      const int64_t at = (int64_t)(i + k) + offset;
+
+      matches += ((at >= 0) && (at < (int64_t)base_size) && (base[at] == image[i + k])) ? 1U : 0U;
+    }
+    if (((int64_t)i + offset >= 0) && ((int64_t)i + offset < (int64_t)base_size) && (2U * matches >= window))
+    {
+      end = ++i;
+      continue;
+    }
+
+    /* Otherwise look for a better offset; no luck makes this an extra byte */
+    if (i + DELTA_BLOCK <= size)
+    {
+      for (candidate = head[delta_hash(&image[i])]; (candidate >= 0) && (steps < DELTA_CHAIN);
+           candidate = chain[candidate], steps++)
+      {
+        for (k = 0U; (i + k < size) && ((uint32_t)candidate + k < base_size) && (k < 256U) &&
+                     (base[(uint32_t)candidate + k] == image[i + k]); k++)
+        {
+        }
+        if (k > best)
+        {
+          best = k;
+          best_offset = (int64_t)candidate - (int64_t)i;
+        }
+      }
+    }
+    if ((best >= DELTA_MIN) && (best_offset != offset))
+    {
+      delta_record(out, base, image, start, end, i, offset, (int64_t)i + best_offset);
+      start = i;
+      end = i;
+      offset = best_offset;
+      continue;
+    }
+    i++;
+  }
+  delta_record(out, base, image, start, end, size, offset, (int64_t)end + offset);
+  free(head);
+  free(chain);
+}
+
+/* ---- LZ, heatshrink's bitstream ---- */
+
+typedef struct
+{
+  pack_buffer *out;
+  uint32_t    bits;
+  uint32_t    count;
+} lz_writer;
+
+static void lz_bits(lz_writer *writer, uint32_t value, uint32_t count)
+{
+  while (count-- > 0U)
+  {
+    writer->bits = (writer->bits << 1) | ((value >> count) & 1U);
+    if (++writer->count == 8U)
+    {
+      pack_put(writer->out, (uint8_t)writer->bits);
+      writer->bits = 0U;
+      writer->count = 0U;
+    }
+  }
+}
+
+static void lz_encode(pack_buffer *out, const uint8_t *data, uint32_t size)
+{
+  int32_t *head = malloc(65536U * sizeof(int32_t));
+  int32_t *chain = malloc((size + 1U) * sizeof(int32_t));
+  lz_writer writer = { out, 0U, 0U };
+  uint32_t i = 0U;
+
+  if ((head == NULL) || (chain == NULL))
+  {
+    printf("out of memory\n");
+    exit(1);
+  }
+  memset(head, 0xFF, 65536U * sizeof(int32_t));
+
+  while (i < size)
+  {
+    uint32_t best = 0U;
+    uint32_t best_offset = 0U;
+    uint32_t length;
+    uint32_t steps = 0U;
+    int32_t candidate;
+
+    if (i + 1U < size)
+    {
+      for (candidate = head[(data[i] << 8) | data[i + 1U]];
+           (candidate >= 0) && (i - (uint32_t)candidate <= FW_LZ_WINDOW) && (steps < LZ_CHAIN);
+           candidate = chain[candidate], steps++)
+      {
+        for (length = 0U; (length < LZ_MAX_LENGTH) && (i + length < size) &&
+                          (data[(uint32_t)candidate + length] == data[i + length]); length++)
+        {
+        }
+        if (length > best)
+        {
+          best = length;
+          best_offset = i - (uint32_t)candidate;
+        }
+      }
+    }
+
+    length = (best >= 2U) ? best : 1U;   /* A reference is 15 bits, a literal 9 */
+    if (best >= 2U)
+    {
+      lz_bits(&writer, 0U, 1U);
+      lz_bits(&writer, best_offset - 1U, FW_LZ_WINDOW_BITS);
+      lz_bits(&writer, best - 1U, FW_LZ_LENGTH_BITS);
+    }
+    else
+    {
+      lz_bits(&writer, 1U, 1U);
+      lz_bits(&writer, data[i], 8U);
+    }
+    while (length-- > 0U)
+    {
+      if (i + 1U < size)
+      {
+        const uint32_t hash = (data[i] << 8) | data[i + 1U];
+
+        chain[i] = head[hash];
+        head[hash] = (int32_t)i;
+      }
+      i++;
+    }
+  }
+  lz_bits(&writer, 0U, (8U - writer.count) % 8U);
+  free(head);
+  free(chain);
+}
+
+/* ---- Packing and checking ---- */
+
+static void pack(pack_buffer *file, const uint8_t *image, uint32_t size, const uint8_t *base, uint32_t base_size,
+                 uint32_t encoding, uint32_t version)
+{
+  fw_image_header header = { 0 };
+  pack_buffer delta = { 0 };
+  const uint8_t *payload = image;
+  uint32_t payload_size = size;
+  uint32_t i;
+
+  header.version = version;
+  header.size = size;
+  header.crc = fw_crc32(image, size, 0U);
+  header.encoding = encoding;
+  if ((encoding & FW_ENCODING_DELTA) != 0U)
+  {
+    header.base_size = base_size;
+    header.base_crc = fw_crc32(base, base_size, 0U);
+    delta_encode(&delta, base, base_size, image, size);
+    payload = delta.data;
+    payload_size = delta.size;
+  }
+  fw_image_header_seal(&header);
+
+  file->size = 0U;
+  for (i = 0U; i < sizeof(header); i++)
+  {
+    pack_put(file, ((const uint8_t *)&header)[i]);
+  }
+  if ((encoding & FW_ENCODING_LZ) != 0U)
+  {
+    lz_encode(file, payload, payload_size);
+  }
+  else
+  {
+    for (i = 0U; i < payload_size; i++)
+    {
+      pack_put(file, payload[i]);
+    }
+  }
+  free(delta.data);
+}
+
+static fw_status flash_read(void *context, uint32_t offset, void *data, uint32_t size)
+{
+  memcpy(data, &((pack_flash *)context)->bytes[offset], size);
+  return FW_OK;
+}
+
+static fw_status flash_program(void *context, uint32_t offset, const void *word)
+{
+  memcpy(&((pack_flash *)context)->bytes[offset], word, FW_FLASH_WORD);
+  return FW_OK;
+}
+
+/* Every other poll is busy, to exercise the decoder's FW_BUSY path */
+static fw_status flash_erase(void *context, uint32_t sector)
+{
+  pack_flash *flash = context;
+
+  flash->busy ^= 1U;
+  if (flash->busy)
+  {
+    return FW_BUSY;
+  }
+  memset(&flash->bytes[sector * PACK_SECTOR_SIZE], 0xFF, PACK_SECTOR_SIZE);
+  return FW_OK;
+}
+
+static fw_status flash_crc(void *context, uint32_t offset, uint32_t size, uint32_t *crc)
+{
+  *crc = fw_crc32(&((pack_flash *)context)->bytes[offset], size, 0U);
+  return FW_OK;
+}
+
+/* Decode a packed file into a simulated slot, in random chunks; the slot must then hold image */
+static fw_status unpack(const pack_buffer *file, const uint8_t *base, uint32_t base_size, const uint8_t *image,
+                        uint32_t size)
+{
+  static uint8_t slot[PACK_SLOT_SIZE];
+  static fw_decoder decoder;
+  pack_flash sim = { slot, 0U };
+  fw_flash flash = { flash_read, flash_program, flash_erase, flash_crc, &sim, PACK_SLOT_SIZE, PACK_SECTOR_SIZE };
+  fw_image_header header;
+  fw_session session;
+  uint32_t done = sizeof(header);
+  fw_status status;
+
+  memset(slot, 0xFF, sizeof(slot));
+  memcpy(&header, file->data, sizeof(header));
+  status = fw_decode_begin(&decoder, &session, &flash, &header, base, base_size);
+  while ((status == FW_OK) && (done < file->size))
+  {
+    uint32_t chunk = 1U + pack_random(600U);
+    uint32_t taken;
+
+    chunk = (chunk < file->size - done) ? chunk : (file->size - done);
+    status = fw_decode_write(&decoder, &file->data[done], chunk, &taken);
+    done += taken;
+    status = (status == FW_BUSY) ? FW_OK : status;
+  }
+  while (status == FW_OK)
+  {
+    status = fw_decode_finish(&decoder);
+    if (status == FW_OK)
+    {
+      return (memcmp(slot, image, size) == 0) ? FW_OK : FW_IO_ERROR;
+    }
+    status = (status == FW_BUSY) ? FW_OK : status;
+  }
+  return status;
+}
+
+static int read_file(const char *name, uint8_t **data, uint32_t *size)
+{
+  FILE *file = fopen(name, "rb");
+  long length;
+
+  if ((file == NULL) || (fseek(file, 0, SEEK_END) != 0) || ((length = ftell(file)) <= 0) ||
+      (fseek(file, 0, SEEK_SET) != 0) || ((*data = malloc((size_t)length)) == NULL) ||
+      (fread(*data, 1, (size_t)length, file) != (size_t)length))
+  {
+    printf("%s: cannot read\n", name);
+    return 0;
+  }
+  fclose(file);
+  *size = (uint32_t)length;
+  return 1;
+}
+
+/* Firmware-like bytes: words from a small vocabulary, so LZ has something to find */
+static void make_base(uint8_t *data, uint32_t size)
+{
+  uint32_t vocabulary[64];
+  uint32_t i;
+
+  for (i = 0U; i < 64U; i++)
+  {
+    vocabulary[i] = (pack_random(4U) == 0U) ? 0U : ((pack_random(65536U) << 16) | pack_random(65536U));
+  }
+  for (i = 0U; i + 4U <= size; i += 4U)
+  {
+    const uint32_t word = vocabulary[pack_random(64U)] ^ ((pack_random(8U) == 0U) ? i : 0U);
+
+    memcpy(&data[i], &word, 4U);
+  }
+  for (; i < size; i++)
+  {
+    data[i] = (uint8_t)pack_random(256U);
+  }
+}
+
+/* A new build: patched, inserted, deleted and relocated ranges of the base */
+static uint32_t make_image(uint8_t *image, const uint8_t *base, uint32_t base_size, uint32_t capacity)
+{
+  uint32_t size = base_size;
+  uint32_t edits = 1U + pack_random(12U);
+
+  memcpy(image, base, base_size);
+  while (edits-- > 0U)
+  {
+    const uint32_t at = pack_random(size);
+    const uint32_t length = 1U + pack_random(((size - at) < 2048U) ? (size - at) : 2048U);
+    uint32_t i;
+
+    switch (pack_random(4U))
+    {
+      case 0:   /* Patched bytes */
+        for (i = 0U; i < length; i++)
+        {
+          image[at + i] = (uint8_t)pack_random(256U);
+        }
+        break;
+      case 1:   /* Inserted code */
+        if (size + length <= capacity)
+        {
+          memmove(&image[at + length], &image[at], size - at);
+          for (i = 0U; i < length; i++)
+          {
+            image[at + i] = (uint8_t)pack_random(256U);
+          }
+          size += length;
+        }
+        break;
+      case 2:   /* Deleted code */
+        if (length < size)
+        {
+          memmove(&image[at], &image[at + length], size - at - length);
+          size -= length;
+        }
+        break;
+      default:   /* Addresses moved by a few bytes */
+        for (i = at & ~3U; i + 4U <= at + length; i += 4U)
+        {
+          if (pack_random(3U) == 0U)
+          {
+            image[i] = (uint8_t)(image[i] + 4U * (1U + pack_random(8U)));
+          }
+        }
+        break;
+    }
+  }
+  return size;
+}
+
+static int self_test(uint32_t cycles)
+{
+  static uint8_t base[PACK_SLOT_SIZE / 4U];
+  static uint8_t image[PACK_SLOT_SIZE / 4U];
+  static const uint32_t encodings[4] = { 0U, FW_ENCODING_LZ, FW_ENCODING_DELTA,
+                                         FW_ENCODING_LZ | FW_ENCODING_DELTA };
+  uint64_t total[4] = { 0U };
+  uint64_t raw = 0U;
+  pack_buffer file = { 0 };
+  uint32_t cycle;
+  uint32_t e;
+
+  for (cycle = 0U; cycle < cycles; cycle++)
+  {
+    const uint32_t base_size = 1U + pack_random(((cycle % 4U) == 0U) ? 256U : (uint32_t)(sizeof(base) / 2U));
+    uint32_t size;
+
+    make_base(base, base_size);
+    size = make_image(image, base, base_size, sizeof(image));
+    raw += size;
+
+    for (e = 0U; e < 4U; e++)
+    {
+      fw_status status;
+
+      pack(&file, image, size, base, base_size, encodings[e], cycle);
+      total[e] += file.size - sizeof(fw_image_header);
+      status = unpack(&file, base, base_size, image, size);
+      if (status != FW_OK)
+      {
+        printf("cycle %u, encoding %u: %s (%d)\n", (unsigned)cycle, (unsigned)encodings[e],
+               (status == FW_IO_ERROR) ? "image differs" : "refused", (int)status);
+        return 1;
+      }
+
+      /* A damaged payload may decode to the same image, but never to another one */
+      if (file.size > sizeof(fw_image_header))
+      {
+        file.data[sizeof(fw_image_header) + pack_random(file.size - sizeof(fw_image_header))] ^=
+          (uint8_t)(1U << pack_random(8U));
+        status = unpack(&file, base, base_size, image, size);
+        if ((status != FW_OK) && (status != FW_BAD_IMAGE))
+        {
+          printf("cycle %u, encoding %u: damaged payload gave another image\n", (unsigned)cycle,
+                 (unsigned)encodings[e]);
+          return 1;
+        }
+      }
+    }
+
+    /* A patch for another base is refused before anything is written */
+    pack(&file, image, size, base, base_size, FW_ENCODING_DELTA, cycle);
+    base[pack_random(base_size)] ^= 0x01U;
+    if (unpack(&file, base, base_size, image, size) != FW_BAD_IMAGE)
+    {
+      printf("cycle %u: patch applied to the wrong base\n", (unsigned)cycle);
+      return 1;
+    }
+  }
+
+  printf("%u cycles, %llu image bytes: lz %.1f%%, delta %.1f%%, lz+delta %.1f%%: ok\n", (unsigned)cycles,
+         (unsigned long long)raw, 100.0 * (double)total[1] / (double)raw, 100.0 * (double)total[2] / (double)raw,
+         100.0 * (double)total[3] / (double)raw);
+  free(file.data);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  pack_buffer file = { 0 };
+  uint8_t *image;
+  uint8_t *base = NULL;
+  uint32_t size;
+  uint32_t base_size = 0U;
+  uint32_t encoding = 0U;
+  uint32_t version;
+  boot_app_header app;
+  FILE *out;
+  int arg = 1;
+
+  if ((argc > 1) && (strcmp(argv[1], "-t") == 0))
+  {
+    return self_test((argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 200U);
+  }
+  for (; (arg < argc) && (argv[arg][0] == '-'); arg++)
+  {
+    if (strcmp(argv[arg], "-z") == 0)
+    {
+      encoding |= FW_ENCODING_LZ;
+    }
+    else if ((strcmp(argv[arg], "-b") == 0) && (arg + 1 < argc))
+    {
+      if (!read_file(argv[++arg], &base, &base_size))
+      {
+        return 1;
+      }
+      encoding |= FW_ENCODING_DELTA;
+    }
+    else
+    {
+      break;
+    }
+  }
+  if (argc - arg != 3)
+  {
+    printf("usage: %s [-z] [-b base.bin] <image.bin> <update.ufw> <version>\n"
+           "       %s -t [cycles]\n", argv[0], argv[0]);
+    return 1;
+  }
+  if (!read_file(argv[arg], &image, &size))
+  {
+    return 1;
+  }
+  if ((size > PACK_SLOT_SIZE - FW_CRC_ALIGN) || (base_size > PACK_SLOT_SIZE))
+  {
+    printf("%s: %u bytes do not fit a %u byte slot\n", argv[arg], (unsigned)size,
+           (unsigned)(PACK_SLOT_SIZE - FW_CRC_ALIGN));
+    return 1;
+  }
+
+  version = (uint32_t)strtoul(argv[arg + 2], NULL, 0);
+  if (size >= PACK_APP_HEADER + sizeof(app))
+  {
+    memcpy(&app, image + PACK_APP_HEADER, sizeof(app));
+    if ((app.magic == BOOT_APP_MAGIC) && (app.version != version))
+    {
+      printf("%s: version %u is not the application header's (%u)\n", argv[arg], (unsigned)version,
+             (unsigned)app.version);
+      return 1;
+    }
+  }
+
+  pack(&file, image, size, base, base_size, encoding, version);
+  if (unpack(&file, base, base_size, image, size) != FW_OK)
+  {
+    printf("%s: does not decode back to the image\n", argv[arg + 1]);
+    return 1;
+  }
+
+  out = fopen(argv[arg + 1], "wb");
+  if ((out == NULL) || (fwrite(file.data, 1, file.size, out) != file.size) || (fclose(out) != 0))
+  {
+    printf("%s: cannot write\n", argv[arg + 1]);
+    return 1;
+  }
+  printf("%s: %u bytes, %u byte payload (%.1f%%)\n", argv[arg + 1], (unsigned)size,
+         (unsigned)(file.size - sizeof(fw_image_header)),
+         100.0 * (double)(file.size - sizeof(fw_image_header)) / (double)size);
+  free(file.data);
+  free(image);
+  free(base);
+  return 0;
+}
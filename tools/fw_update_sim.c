@@ -0,0 +1,439 @@
+/*
+ * Host test of the A/B firmware update (application/modules/fw_update) on
+ * a simulated slot with power-cut injection.
+ *
+ * The simulated flash behaves like the STM32H7's: it programs whole 256-bit
+ * words, refuses to program a word twice between erases, and its erases
+ * take a few polls (FW_BUSY). Its CRC unit is a plain MSB-first CRC-32
+ * over 32-bit words, standing in for the hardware one.
+ *
+ * Each cycle streams a random image in random chunks, then one of:
+ *  - a clean update, which must seal the slot with the image in it;
+ *  - a power cut at a random flash operation, after which the slot must be
+ *    unbootable or still hold the previous image intact, and a restarted
+ *    update must then succeed;
+ *  - a corrupted byte, a truncated stream or a damaged header, which must
+ *    be refused and leave the slot unbootable;
+ *  - a bit flipped in a sealed slot, which fw_update_slot_check() must see.
+ * The trial-boot bookkeeping is checked once at the start.
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -o fw_update_sim tools/fw_update_sim.c application/modules/fw_update/src/fw_update.c \
+ *      -Iapplication/modules/fw_update/src
+ *
+ * Usage: fw_update_sim [cycles] [sector_bytes]   (defaults: 500, 16384)
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fw_update.h"
+
+#define SIM_SECTORS   6U
+
+typedef struct
+{
+  uint8_t  *bytes;
+  uint8_t  *programmed;   /*!< Per flash word, since its last erase */
+  uint32_t slot_size;
+  uint32_t sector_size;
+  uint32_t erase_polls;   /*!< Polls left on the running erase */
+  int32_t  erasing;       /*!< Sector being erased, -1 for none */
+  uint32_t cut_after;     /*!< Flash operations until the power cut, 0 for never */
+  uint32_t powered;
+  uint32_t programs;
+  uint32_t erases;
+} sim_flash;
+
+static uint32_t seed = 12345U;
+
+static uint32_t sim_random(uint32_t range)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed % range;
+}
+
+/* Count one flash operation; 1 when the power goes now */
+static uint32_t sim_cut(sim_flash *sim)
+{
+  if ((sim->cut_after != 0U) && (--sim->cut_after == 0U))
+  {
+    sim->powered = 0U;
+    return 1U;
+  }
+  return 0U;
+}
+
+static fw_status sim_read(void *context, uint32_t offset, void *data, uint32_t size)
+{
+  sim_flash *sim = context;
+
+  if (!sim->powered || (offset + size > sim->slot_size))
+  {
+    return FW_IO_ERROR;
+  }
+  memcpy(data, &sim->bytes[offset], size);
+  return FW_OK;
+}
+
+static fw_status sim_program(void *context, uint32_t offset, const void *word)
+{
+  sim_flash *sim = context;
+  uint8_t *target = &sim->bytes[offset];
+  uint32_t i;
+
+  if (!sim->powered || ((offset % FW_FLASH_WORD) != 0U) || (offset + FW_FLASH_WORD > sim->slot_size) ||
+      (sim->erasing >= 0))
+  {
+    return FW_IO_ERROR;
+  }
+  if (sim->programmed[offset / FW_FLASH_WORD])
+  {
+    printf("program over a programmed word at 0x%05x\n", (unsigned)offset);
+    exit(1);
+  }
+  sim->programmed[offset / FW_FLASH_WORD] = 1U;
+  if (sim_cut(sim))
+  {
+    for (i = 0U; i < FW_FLASH_WORD; i++)
+    {
+      target[i] = (uint8_t)sim_random(256U);
+    }
+    return FW_IO_ERROR;
+  }
+  memcpy(target, word, FW_FLASH_WORD);
+  sim->programs++;
+  return FW_OK;
+}
+
+static fw_status sim_erase(void *context, uint32_t sector)
+{
+  sim_flash *sim = context;
+  uint8_t *base = &sim->bytes[sector * sim->sector_size];
+  uint32_t i;
+
+  if (!sim->powered || (sector >= SIM_SECTORS) || ((sim->erasing >= 0) && ((uint32_t)sim->erasing != sector)))
+  {
+    return FW_IO_ERROR;
+  }
+  if (sim->erasing < 0)
+  {
+    sim->erasing = (int32_t)sector;
+    sim->erase_polls = 1U + sim_random(4U);
+  }
+  if (sim_cut(sim))
+  {
+    for (i = 0U; i < sim->sector_size; i += FW_FLASH_WORD)
+    {
+      if (sim_random(2U) == 0U)
+      {
+        memset(&base[i], 0xFF, FW_FLASH_WORD);
+        sim->programmed[(sector * sim->sector_size + i) / FW_FLASH_WORD] = 0U;
+      }
+    }
+    sim->erasing = -1;
+    return FW_IO_ERROR;
+  }
+  if (--sim->erase_polls > 0U)
+  {
+    return FW_BUSY;
+  }
+  memset(base, 0xFF, sim->sector_size);
+  memset(&sim->programmed[sector * sim->sector_size / FW_FLASH_WORD], 0, sim->sector_size / FW_FLASH_WORD);
+  sim->erasing = -1;
+  sim->erases++;
+  return FW_OK;
+}
+
+static fw_status sim_crc(void *context, uint32_t offset, uint32_t size, uint32_t *crc)
+{
+  sim_flash *sim = context;
+  uint32_t value = 0xFFFFFFFFU;
+  uint32_t i;
+  uint32_t bit;
+
+  if (!sim->powered || ((offset % FW_CRC_ALIGN) != 0U) || ((size % FW_CRC_ALIGN) != 0U) ||
+      (offset + size > sim->slot_size) || (sim->erasing >= 0))
+  {
+    return FW_IO_ERROR;
+  }
+  for (i = offset; i < offset + size; i += 4U)
+  {
+    uint32_t word;
+
+    memcpy(&word, &sim->bytes[i], 4U);
+    value ^= word;
+    for (bit = 0U; bit < 32U; bit++)
+    {
+      value = (value & 0x80000000U) ? ((value << 1) ^ 0x04C11DB7U) : (value << 1);
+    }
+  }
+  *crc = value;
+  return FW_OK;
+}
+
+static void fail(uint32_t cycle, const char *what)
+{
+  printf("cycle %u: %s\n", (unsigned)cycle, what);
+  exit(1);
+}
+
+/*
+ * Stream header and image in random chunks, retrying a chunk while the
+ * backend erases. Stops after @p limit image bytes; returns the first error.
+ */
+static fw_status stream(fw_session *session, const fw_flash *flash, const fw_image_header *header,
+                        const uint8_t *image, uint32_t limit, uint32_t *busy)
+{
+  uint32_t done = 0U;
+  fw_status status;
+
+  status = fw_update_begin(session, flash, header);
+  while ((status == FW_OK) && (done < limit))
+  {
+    uint32_t chunk = 1U + ((sim_random(4U) == 0U) ? sim_random(8U) : sim_random(700U));
+
+    chunk = (chunk < limit - done) ? chunk : (limit - done);
+    while ((status = fw_update_write(session, &image[done], chunk)) == FW_BUSY)
+    {
+      (*busy)++;
+    }
+    done += (status == FW_OK) ? chunk : 0U;
+  }
+  return status;
+}
+
+static void make_image(fw_image_header *header, uint8_t *image, uint32_t max_size, uint32_t version)
+{
+  uint32_t i;
+
+  memset(header, 0, sizeof(*header));
+  header->version = version;
+  header->size = 1U + ((sim_random(4U) == 0U) ? sim_random(3U * FW_FLASH_WORD) : sim_random(max_size));
+  for (i = 0U; i < header->size; i++)
+  {
+    image[i] = (uint8_t)sim_random(256U);
+  }
+  header->crc = fw_crc32(image, header->size, 0U);
+  fw_image_header_seal(header);
+}
+
+/* The slot is sealed and holds exactly this image */
+static uint32_t slot_holds(const fw_flash *flash, const sim_flash *sim, const fw_image_header *header,
+                           const uint8_t *image)
+{
+  fw_slot_trailer trailer;
+
+  return (fw_update_slot_check(flash, &trailer) == FW_OK) && (trailer.version == header->version) &&
+         (trailer.size == header->size) && (memcmp(sim->bytes, image, header->size) == 0);
+}
+
+static void check_boot(void)
+{
+  fw_boot_record record;
+  uint32_t i;
+
+  memset(&record, 0xFF, sizeof(record));
+  if (fw_boot_next(&record) != FW_BOOT_RUN)
+  {
+    fail(0U, "erased boot record not taken as confirmed");
+  }
+  fw_boot_start_trial(&record, 7U);
+  for (i = 1U; i <= FW_BOOT_MAX_ATTEMPTS; i++)
+  {
+    if ((fw_boot_next(&record) != FW_BOOT_TRIAL) || (record.attempts != i))
+    {
+      fail(0U, "trial boot not counted");
+    }
+  }
+  if (fw_boot_next(&record) != FW_BOOT_ROLLBACK)
+  {
+    fail(0U, "no rollback after the last trial boot");
+  }
+  fw_boot_start_trial(&record, 8U);
+  (void)fw_boot_next(&record);
+  fw_update_confirm(&record);
+  if ((fw_boot_next(&record) != FW_BOOT_RUN) || (record.attempts != 0U))
+  {
+    fail(0U, "confirmed image still on trial");
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const uint32_t cycles = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 500U;
+  sim_flash sim = { 0 };
+  fw_flash flash;
+  fw_session session;
+  fw_image_header header;
+  fw_image_header sealed = { 0 };   /* Image the slot holds, size 0 for none */
+  uint8_t *image;
+  uint8_t *sealed_image;
+  uint32_t counts[5] = { 0U };
+  uint32_t busy = 0U;
+  uint32_t cycle;
+
+  sim.sector_size = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 16384U;
+  sim.slot_size = SIM_SECTORS * sim.sector_size;
+  sim.bytes = malloc(sim.slot_size);
+  sim.programmed = calloc(sim.slot_size / FW_FLASH_WORD, 1U);
+  image = malloc(sim.slot_size);
+  sealed_image = malloc(sim.slot_size);
+  if ((sim.bytes == NULL) || (sim.programmed == NULL) || (image == NULL) || (sealed_image == NULL) ||
+      ((sim.sector_size % FW_CRC_ALIGN) != 0U))
+  {
+    printf("bad sector size\n");
+    return 1;
+  }
+  memset(sim.bytes, 0xFF, sim.slot_size);
+  sim.erasing = -1;
+  sim.powered = 1U;
+
+  flash.read = sim_read;
+  flash.program = sim_program;
+  flash.erase = sim_erase;
+  flash.crc = sim_crc;
+  flash.context = &sim;
+  flash.slot_size = sim.slot_size;
+  flash.sector_size = sim.sector_size;
+
+  check_boot();
+
+  for (cycle = 0U; cycle < cycles; cycle++)
+  {
+    const uint32_t scenario = cycle % 5U;
+    fw_status status;
+
+    sim.powered = 1U;
+    sim.erasing = -1;
+    sim.cut_after = 0U;
+    make_image(&header, image, sim.slot_size - FW_CRC_ALIGN, cycle);
+
+    switch (scenario)
+    {
+      case 0:   /* Clean update */
+        status = stream(&session, &flash, &header, image, header.size, &busy);
+        status = (status == FW_OK) ? fw_update_finish(&session) : status;
+        if ((status != FW_OK) || !slot_holds(&flash, &sim, &header, image))
+        {
+          fail(cycle, "clean update did not seal the image");
+        }
+        break;
+
+      case 1:   /* Power cut, then the update again from the start */
+        sim.cut_after = 1U + sim_random(sim.programs / (cycle + 1U) + 8U);
+        status = stream(&session, &flash, &header, image, header.size, &busy);
+        status = (status == FW_OK) ? fw_update_finish(&session) : status;
+        if (sim.powered)
+        {
+          sim.cut_after = 0U;
+          if ((status != FW_OK) || !slot_holds(&flash, &sim, &header, image))
+          {
+            fail(cycle, "update did not seal the image");
+          }
+          break;   /* The update beat the cut */
+        }
+        sim.powered = 1U;
+        sim.erasing = -1;
+        if ((fw_update_slot_check(&flash, NULL) == FW_OK) &&
+            ((sealed.size == 0U) || !slot_holds(&flash, &sim, &sealed, sealed_image)))
+        {
+          fail(cycle, "cut update left a bootable slot");
+        }
+        status = stream(&session, &flash, &header, image, header.size, &busy);
+        status = (status == FW_OK) ? fw_update_finish(&session) : status;
+        if ((status != FW_OK) || !slot_holds(&flash, &sim, &header, image))
+        {
+          fail(cycle, "restarted update did not seal the image");
+        }
+        break;
+
+      case 2:   /* Corrupted byte */
+        image[sim_random(header.size)] ^= (uint8_t)(1U << sim_random(8U));
+        status = stream(&session, &flash, &header, image, header.size, &busy);
+        status = (status == FW_OK) ? fw_update_finish(&session) : status;
+        if ((status != FW_BAD_IMAGE) || (fw_update_slot_check(&flash, NULL) == FW_OK))
+        {
+          fail(cycle, "corrupted image accepted");
+        }
+        break;
+
+      case 3:   /* Truncated stream, or a damaged or oversized header */
+        if (sim_random(2U) == 0U)
+        {
+          const uint32_t limit = sim_random(header.size);
+
+          status = stream(&session, &flash, &header, image, limit, &busy);
+          status = (status == FW_OK) ? fw_update_finish(&session) : status;
+          if (status != FW_BAD_IMAGE)
+          {
+            fail(cycle, "truncated image accepted");
+          }
+          if ((limit == 0U) && (sealed.size != 0U))
+          {
+            continue;   /* No data, so nothing was erased */
+          }
+          if (fw_update_slot_check(&flash, NULL) == FW_OK)
+          {
+            fail(cycle, "truncated image left a bootable slot");
+          }
+        }
+        else
+        {
+          if (sim_random(2U) == 0U)
+          {
+            ((uint8_t *)&header)[sim_random(sizeof(header))] ^= (uint8_t)(1U << sim_random(8U));
+          }
+          else
+          {
+            header.size = sim.slot_size - FW_CRC_ALIGN + 1U + sim_random(FW_CRC_ALIGN);
+            fw_image_header_seal(&header);
+          }
+          if (fw_update_begin(&session, &flash, &header) != FW_BAD_IMAGE)
+          {
+            fail(cycle, "bad header accepted");
+          }
+          continue;   /* Nothing was erased: the slot is as it was */
+        }
+        break;
+
+      default:   /* Bit rot in a sealed slot */
+        if (sealed.size != 0U)
+        {
+          const uint32_t offset = sim_random(sealed.size);
+
+          sim.bytes[offset] ^= (uint8_t)(1U << sim_random(8U));
+          if (fw_update_slot_check(&flash, NULL) != FW_BAD_IMAGE)
+          {
+            fail(cycle, "flipped bit in the slot not seen");
+          }
+          sim.bytes[offset] = sealed_image[offset];
+          if (!slot_holds(&flash, &sim, &sealed, sealed_image))
+          {
+            fail(cycle, "repaired slot not accepted");
+          }
+        }
+        continue;
+    }
+
+    counts[scenario]++;
+    if (fw_update_slot_check(&flash, NULL) == FW_OK)
+    {
+      sealed = header;
+      memcpy(sealed_image, image, header.size);
+    }
+    else
+    {
+      sealed.size = 0U;
+    }
+  }
+
+  printf("%u cycles: %u clean, %u cut, %u corrupted, %u truncated, %u programs, %u erases, %u busy polls: ok\n",
+         (unsigned)cycles, (unsigned)counts[0], (unsigned)counts[1], (unsigned)counts[2], (unsigned)counts[3],
+         (unsigned)sim.programs, (unsigned)sim.erases, (unsigned)busy);
+  return 0;
+}
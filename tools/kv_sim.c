@@ -0,0 +1,322 @@
+/*
+ * Host test of the flash key-value store (application/modules/kv_store)
+ * on a simulated flash with power-cut injection.
+ *
+ * The simulated flash behaves like the STM32H7's: it programs whole 256-bit
+ * words, refuses to program a word twice between erases (its ECC would be
+ * corrupted), and its erases take a few polls (KV_BUSY).
+ * Each power cycle mounts the store, checks every key against a model of
+ * what was acknowledged, then runs random set/delete/GC steps until a cut
+ * lands at a random flash operation. A cut during a program leaves a torn
+ * word of random bits that cannot be programmed again. A cut during an
+ * erase leaves a random mix of erased and old words. The operation that
+ * was interrupted may show up either as done or as not done, but nothing
+ * else may change. A few keys take most of the writes, so the rest stay
+ * deleted or unchanged across many GCs.
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -o kv_sim tools/kv_sim.c application/modules/kv_store/src/kv_store.c \
+ *      -Iapplication/modules/kv_store/src
+ *
+ * Usage: kv_sim [cycles] [sector_bytes]   (defaults: 2000, 16384)
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "kv_store.h"
+
+#define SIM_KEYS        48U
+#define SIM_HOT_KEYS    6U
+#define SIM_MAX_VALUE   300U
+
+typedef struct
+{
+  uint8_t  *bytes;
+  uint8_t  *programmed;   /*!< Per flash word, since its last erase */
+  uint32_t sector_size;
+  uint32_t erase_polls;   /*!< Polls left on the running erase */
+  int32_t  erasing;       /*!< Sector being erased, -1 for none */
+  uint32_t cut_after;     /*!< Flash operations until the power cut, 0 for never */
+  uint32_t cut_erases;    /*!< Count only erase polls towards the cut */
+  uint32_t powered;
+  uint32_t programs;
+  uint32_t erases[2];
+} sim_flash;
+
+typedef struct
+{
+  uint16_t size;   /*!< 0: absent */
+  uint8_t  data[SIM_MAX_VALUE];
+} sim_value;
+
+static uint32_t seed = 12345U;
+
+static uint32_t sim_random(uint32_t range)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed % range;
+}
+
+/* Count one flash operation; 1 when the power goes now */
+static uint32_t sim_cut(sim_flash *sim, uint32_t erase)
+{
+  if ((sim->cut_after != 0U) && (erase || !sim->cut_erases) && (--sim->cut_after == 0U))
+  {
+    sim->powered = 0U;
+    return 1U;
+  }
+  return 0U;
+}
+
+static kv_status sim_read(void *context, uint32_t offset, void *data, uint32_t size)
+{
+  sim_flash *sim = context;
+
+  if (!sim->powered || (offset + size > 2U * sim->sector_size))
+  {
+    return KV_IO_ERROR;
+  }
+  memcpy(data, &sim->bytes[offset], size);
+  return KV_OK;
+}
+
+static kv_status sim_program(void *context, uint32_t offset, const void *word)
+{
+  sim_flash *sim = context;
+  uint8_t *target = &sim->bytes[offset];
+  uint32_t i;
+
+  if (!sim->powered || ((offset % KV_FLASH_WORD) != 0U) || (offset + KV_FLASH_WORD > 2U * sim->sector_size) ||
+      ((sim->erasing >= 0) && (offset / sim->sector_size == (uint32_t)sim->erasing)))
+  {
+    return KV_IO_ERROR;
+  }
+  if (sim->programmed[offset / KV_FLASH_WORD])
+  {
+    printf("program over a programmed word at 0x%05x\n", (unsigned)offset);
+    exit(1);
+  }
+  sim->programmed[offset / KV_FLASH_WORD] = 1U;
+  if (sim_cut(sim, 0U))
+  {
+    for (i = 0U; i < KV_FLASH_WORD; i++)
+    {
+      target[i] = (uint8_t)sim_random(256U);
+    }
+    return KV_IO_ERROR;
+  }
+  memcpy(target, word, KV_FLASH_WORD);
+  sim->programs++;
+  return KV_OK;
+}
+
+static kv_status sim_erase(void *context, uint32_t sector)
+{
+  sim_flash *sim = context;
+  uint8_t *base = &sim->bytes[sector * sim->sector_size];
+  uint32_t i;
+
+  if (!sim->powered || (sector > 1U) || ((sim->erasing >= 0) && ((uint32_t)sim->erasing != sector)))
+  {
+    return KV_IO_ERROR;
+  }
+  if (sim->erasing < 0)
+  {
+    sim->erasing = (int32_t)sector;
+    sim->erase_polls = 1U + sim_random(4U);
+  }
+  if (sim_cut(sim, 1U))
+  {
+    for (i = 0U; i < sim->sector_size; i += KV_FLASH_WORD)
+    {
+      if (sim_random(2U) == 0U)
+      {
+        memset(&base[i], 0xFF, KV_FLASH_WORD);
+        sim->programmed[(sector * sim->sector_size + i) / KV_FLASH_WORD] = 0U;
+      }
+    }
+    sim->erasing = -1;
+    return KV_IO_ERROR;
+  }
+  if (--sim->erase_polls > 0U)
+  {
+    return KV_BUSY;
+  }
+  memset(base, 0xFF, sim->sector_size);
+  memset(&sim->programmed[sector * sim->sector_size / KV_FLASH_WORD], 0, sim->sector_size / KV_FLASH_WORD);
+  sim->erasing = -1;
+  sim->erases[sector]++;
+  return KV_OK;
+}
+
+static void fail(uint32_t cycle, const char *what, uint32_t key)
+{
+  printf("cycle %u: key %u: %s\n", (unsigned)cycle, (unsigned)key, what);
+  exit(1);
+}
+
+/* Check one key; the interrupted operation may have landed or not */
+static void check_key(kv_store *store, uint32_t cycle, uint16_t key, sim_value *model, const sim_value *pending)
+{
+  uint8_t data[KV_MAX_VALUE];
+  uint16_t size = 0U;
+  const kv_status status = kv_get(store, key, data, sizeof(data), &size);
+  const uint32_t matches_model = (model->size == 0U) ? (status == KV_NOT_FOUND)
+                                 : ((status == KV_OK) && (size == model->size) && (memcmp(data, model->data, size) == 0));
+  uint32_t matches_pending = 0U;
+
+  if (pending != NULL)
+  {
+    matches_pending = (pending->size == 0U) ? (status == KV_NOT_FOUND)
+                      : ((status == KV_OK) && (size == pending->size) && (memcmp(data, pending->data, size) == 0));
+  }
+  if (matches_pending && !matches_model)
+  {
+    *model = *pending;
+  }
+  else if (!matches_model)
+  {
+    fail(cycle, (status == KV_OK) ? "wrong value" : "lost", key);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const uint32_t cycles = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 2000U;
+  static sim_value model[SIM_KEYS];
+  sim_flash sim = { 0 };
+  kv_flash flash;
+  kv_store store;
+  uint32_t cycle;
+  uint32_t ops = 0U;
+  uint32_t corrupt = 0U;
+  uint32_t resumed = 0U;
+
+  sim.sector_size = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 16384U;
+  sim.bytes = malloc(2U * sim.sector_size);
+  sim.programmed = malloc(2U * sim.sector_size / KV_FLASH_WORD);
+  memset(sim.bytes, 0x5A, 2U * sim.sector_size);   /* Not a store, not erased */
+  memset(sim.programmed, 1, 2U * sim.sector_size / KV_FLASH_WORD);
+  sim.erasing = -1;
+  flash.read = sim_read;
+  flash.program = sim_program;
+  flash.erase = sim_erase;
+  flash.context = &sim;
+  flash.sector_size = sim.sector_size;
+
+  for (cycle = 0U; cycle < cycles; cycle++)
+  {
+    sim_value pending;
+    int32_t pending_key = -1;
+    uint16_t key;
+    kv_status status;
+
+    sim.powered = 1U;
+    sim.erasing = -1;
+    sim.cut_after = 0U;
+    status = kv_mount(&store, &flash);
+    if (status != KV_OK)
+    {
+      printf("cycle %u: mount failed (%d)\n", (unsigned)cycle, (int)status);
+      return 1;
+    }
+    corrupt += store.corrupt;
+    resumed += (store.gc == KV_GC_COPY) ? 1U : 0U;
+    for (key = 0U; key < SIM_KEYS; key++)
+    {
+      check_key(&store, cycle, key, &model[key], NULL);
+    }
+
+    /* Random work until the cut: every tenth cycle runs without one, every fourth cuts an erase */
+    sim.cut_erases = ((cycle % 4U) == 1U);
+    sim.cut_after = ((cycle % 10U) == 9U) ? 0U : 1U + sim_random(sim.cut_erases ? 12U : 4000U);
+    for (;;)
+    {
+      const uint32_t action = sim_random(16U);
+
+      key = (uint16_t)sim_random((sim_random(4U) != 0U) ? SIM_HOT_KEYS : SIM_KEYS);
+      if (action < 10U)
+      {
+        uint32_t i;
+
+        pending.size = (uint16_t)(1U + ((sim_random(8U) == 0U) ? sim_random(SIM_MAX_VALUE) : sim_random(24U)));
+        for (i = 0U; i < pending.size; i++)
+        {
+          pending.data[i] = (uint8_t)sim_random(256U);
+        }
+        pending_key = key;
+        status = kv_set(&store, key, pending.data, pending.size);
+      }
+      else if (action < 12U)
+      {
+        pending.size = 0U;
+        pending_key = key;
+        status = kv_delete(&store, key);
+        if ((status == KV_NOT_FOUND) && (model[key].size == 0U))
+        {
+          status = KV_OK;
+        }
+      }
+      else
+      {
+        pending_key = -1;
+        status = kv_gc_step(&store);
+        status = (status == KV_BUSY) ? KV_OK : status;
+      }
+
+      if (!sim.powered)
+      {
+        break;
+      }
+      if (status == KV_FULL)
+      {
+        continue;   /* Refused, nothing written */
+      }
+      if (status != KV_OK)
+      {
+        printf("cycle %u: operation failed (%d) with power on\n", (unsigned)cycle, (int)status);
+        return 1;
+      }
+      if (pending_key >= 0)
+      {
+        model[pending_key] = pending;
+      }
+      if ((++ops % 50000U) == 0U)
+      {
+        break;   /* Uncut cycle: remount anyway */
+      }
+      if ((sim.cut_after == 0U) && (sim_random(3000U) == 0U))
+      {
+        break;
+      }
+    }
+
+    /* Power back: only the interrupted key may differ */
+    sim.powered = 1U;
+    sim.erasing = -1;
+    sim.cut_after = 0U;
+    status = kv_mount(&store, &flash);
+    if (status != KV_OK)
+    {
+      printf("cycle %u: remount failed (%d)\n", (unsigned)cycle, (int)status);
+      return 1;
+    }
+    for (key = 0U; key < SIM_KEYS; key++)
+    {
+      check_key(&store, cycle, key, &model[key], (pending_key == (int32_t)key) ? &pending : NULL);
+    }
+  }
+
+  printf("%u power cycles, %u operations, %u programs, erases %u/%u, %u torn records skipped, "
+         "%u interrupted GCs resumed: all keys intact\n",
+         (unsigned)cycles, (unsigned)ops, (unsigned)sim.programs, (unsigned)sim.erases[0], (unsigned)sim.erases[1],
+         (unsigned)corrupt, (unsigned)resumed);
+  free(sim.programmed);
+  free(sim.bytes);
+  return 0;
+}
@@ -0,0 +1,297 @@
+/*
+ * Host correctness check of application/modules/memory (mem_string.c)
+ * against the host libc.
+ *
+ * mem_copy, mem_set and mem_compare run over every length 0..MAX_LEN and
+ * every source and destination misalignment 0..7. mem_move also runs
+ * forward and backward overlaps at every distance up to 40 bytes and at a
+ * few larger ones. Each destination sits inside a guard buffer, so a store
+ * outside [dst, dst + len) is caught as well as a wrong byte inside it.
+ * mem_compare is checked for the sign of the result, with the first
+ * difference placed at every offset. Exits non-zero on the first failure.
+ *
+ * On a host mem_string.c builds its portable C path; the LDM/LDRD paths are
+ * only compiled for the target, where bench_memory exercises them.
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -o mem_string_check tools/mem_string_check.c \
+ *      application/modules/memory/src/mem_string.c -Iapplication/modules/memory/src
+ *
+ * Usage: mem_string_check
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mem_string.h"
+
+#define MAX_LEN     300U
+#define MAX_MIS     8U
+#define GUARD       64U
+#define SHIFT       256U   /* Room for the overlap distances either side */
+#define BUF_LEN     (GUARD + SHIFT + MAX_MIS + MAX_LEN + SHIFT + GUARD)
+#define FILL        0xA5U
+
+static uint8_t src_buf[BUF_LEN];
+static uint8_t dst_buf[BUF_LEN];
+static uint8_t ref_buf[BUF_LEN];
+
+static uint32_t seed = 1U;
+
+static uint8_t random_byte(void)
+{
+  seed = seed * 1664525U + 1013904223U;
+  return (uint8_t)(seed >> 24);
+}
+
+static void randomize(uint8_t *buf, size_t len)
+{
+  size_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    buf[i] = random_byte();
+  }
+}
+
+static int sign(int value)
+{
+  return (value > 0) - (value < 0);
+}
+
+/* Reports the first differing byte of the whole buffer, guards included */
+static int compare(const char *name, size_t len, size_t dmis, size_t smis, size_t start)
+{
+  size_t i;
+
+  for (i = 0U; i < BUF_LEN; i++)
+  {
+    if (dst_buf[i] != ref_buf[i])
+    {
+      long offset = (long)i - (long)start;
+
+      printf("%s: len %zu dst+%zu src+%zu: byte %ld %s is 0x%02x, expected 0x%02x\n", name, len, dmis, smis,
+             offset, ((offset < 0) || ((size_t)offset >= len)) ? "(outside dst)" : "", dst_buf[i], ref_buf[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int check_copy(void)
+{
+  size_t len;
+  size_t dmis;
+  size_t smis;
+
+  for (len = 0U; len <= MAX_LEN; len++)
+  {
+    for (dmis = 0U; dmis < MAX_MIS; dmis++)
+    {
+      for (smis = 0U; smis < MAX_MIS; smis++)
+      {
+        uint8_t *src = &src_buf[GUARD + smis];
+        void *ret;
+
+        randomize(src_buf, BUF_LEN);
+        memset(dst_buf, FILL, BUF_LEN);
+        memset(ref_buf, FILL, BUF_LEN);
+
+        ret = mem_copy(&dst_buf[GUARD + dmis], src, len);
+        memcpy(&ref_buf[GUARD + dmis], src, len);
+        if (ret != &dst_buf[GUARD + dmis])
+        {
+          printf("mem_copy: len %zu dst+%zu src+%zu: wrong return value\n", len, dmis, smis);
+          return 1;
+        }
+        if (compare("mem_copy", len, dmis, smis, GUARD + dmis) != 0)
+        {
+          return 1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+static int check_set(void)
+{
+  static const int values[] = { 0x00, 0xFF, 0x5A, 0x1234 };   /* 0x1234: only the low byte counts */
+  size_t len;
+  size_t dmis;
+  size_t v;
+
+  for (len = 0U; len <= MAX_LEN; len++)
+  {
+    for (dmis = 0U; dmis < MAX_MIS; dmis++)
+    {
+      for (v = 0U; v < (sizeof(values) / sizeof(values[0])); v++)
+      {
+        void *ret;
+
+        randomize(dst_buf, BUF_LEN);
+        memcpy(ref_buf, dst_buf, BUF_LEN);
+
+        ret = mem_set(&dst_buf[GUARD + dmis], values[v], len);
+        memset(&ref_buf[GUARD + dmis], values[v], len);
+        if (ret != &dst_buf[GUARD + dmis])
+        {
+          printf("mem_set: len %zu dst+%zu: wrong return value\n", len, dmis);
+          return 1;
+        }
+        if (compare("mem_set", len, dmis, 0U, GUARD + dmis) != 0)
+        {
+          return 1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+/* Source and destination in the same buffer, dst = src + distance */
+static int check_move_overlap(size_t len, size_t base, long distance)
+{
+  const size_t src = GUARD + SHIFT + base;
+  const size_t dst = (size_t)((long)src + distance);
+  void *ret;
+
+  randomize(dst_buf, BUF_LEN);
+  memcpy(ref_buf, dst_buf, BUF_LEN);
+
+  ret = mem_move(&dst_buf[dst], &dst_buf[src], len);
+  memmove(&ref_buf[dst], &ref_buf[src], len);
+  if (ret != &dst_buf[dst])
+  {
+    printf("mem_move: len %zu distance %ld: wrong return value\n", len, distance);
+    return 1;
+  }
+  if (compare((distance > 0) ? "mem_move (backward)" : "mem_move (forward)", len, dst & 7U, src & 7U, dst) != 0)
+  {
+    printf("  overlap distance %ld\n", distance);
+    return 1;
+  }
+  return 0;
+}
+
+static int check_move(void)
+{
+  static const long far[] = { 64, 100, 255 };
+  size_t len;
+  size_t dmis;
+  size_t smis;
+  long distance;
+  size_t i;
+
+  /* Disjoint buffers: same as mem_copy */
+  for (len = 0U; len <= MAX_LEN; len++)
+  {
+    for (dmis = 0U; dmis < MAX_MIS; dmis++)
+    {
+      for (smis = 0U; smis < MAX_MIS; smis++)
+      {
+        uint8_t *src = &src_buf[GUARD + smis];
+
+        randomize(src_buf, BUF_LEN);
+        memset(dst_buf, FILL, BUF_LEN);
+        memset(ref_buf, FILL, BUF_LEN);
+
+        (void)mem_move(&dst_buf[GUARD + dmis], src, len);
+        memmove(&ref_buf[GUARD + dmis], src, len);
+        if (compare("mem_move", len, dmis, smis, GUARD + dmis) != 0)
+        {
+          return 1;
+        }
+      }
+    }
+  }
+
+  /* Overlaps: distance < 0 copies forward (dst below src), > 0 backward */
+  for (len = 0U; len <= MAX_LEN; len++)
+  {
+    for (smis = 0U; smis < MAX_MIS; smis++)
+    {
+      for (distance = -40; distance <= 40; distance++)
+      {
+        if (check_move_overlap(len, smis, distance) != 0)
+        {
+          return 1;
+        }
+      }
+      for (i = 0U; i < (sizeof(far) / sizeof(far[0])); i++)
+      {
+        if (check_move_overlap(len, smis, -far[i]) != 0)
+        {
+          return 1;
+        }
+        if (check_move_overlap(len, smis, far[i]) != 0)
+        {
+          return 1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+static int check_compare(void)
+{
+  size_t len;
+  size_t lmis;
+  size_t rmis;
+  size_t diff;
+
+  for (len = 0U; len <= MAX_LEN; len++)
+  {
+    for (lmis = 0U; lmis < MAX_MIS; lmis++)
+    {
+      for (rmis = 0U; rmis < MAX_MIS; rmis++)
+      {
+        uint8_t *lhs = &src_buf[GUARD + lmis];
+        uint8_t *rhs = &dst_buf[GUARD + rmis];
+
+        randomize(src_buf, BUF_LEN);
+        memcpy(rhs, lhs, len);
+        if (mem_compare(lhs, rhs, len) != 0)
+        {
+          printf("mem_compare: len %zu lhs+%zu rhs+%zu: equal buffers compare unequal\n", len, lmis, rmis);
+          return 1;
+        }
+
+        /* One differing byte at each offset, either way round and across the sign bit */
+        for (diff = 0U; diff < len; diff++)
+        {
+          const uint8_t saved = rhs[diff];
+          int got;
+          int want;
+
+          rhs[diff] = (uint8_t)(saved ^ ((diff & 1U) ? 0x80U : 0x01U));
+          got = sign(mem_compare(lhs, rhs, len));
+          want = sign(memcmp(lhs, rhs, len));
+          if ((got != want) || (want == 0))
+          {
+            printf("mem_compare: len %zu lhs+%zu rhs+%zu: difference at %zu gives %d, expected %d\n", len, lmis,
+                   rmis, diff, got, want);
+            return 1;
+          }
+          rhs[diff] = saved;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+int main(void)
+{
+  if ((check_copy() != 0) || (check_set() != 0) || (check_move() != 0) || (check_compare() != 0))
+  {
+    return 1;
+  }
+
+  printf("mem_copy, mem_set, mem_move, mem_compare: lengths 0..%u, misalignments 0..%u: ok\n", MAX_LEN,
+         MAX_MIS - 1U);
+  return 0;
+}
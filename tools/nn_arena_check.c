@@ -0,0 +1,419 @@
+/*
+ * Host check of the activation arena planner (application/modules/nn,
+ * nn_arena.c).
+ *
+ * Plans the model bench_nn runs (same tensors, layers and regions) and a
+ * set of adversarial layer lists, and requires nn_arena_check() to pass on
+ * every plan. The lists are: a long residual skip kept live across a chain,
+ * one tensor read by every layer, odd and one-byte sizes, equal sizes, a
+ * bound model input, a first region too small for most tensors (spill), and
+ * random graphs with ADD fan-in over tight and roomy regions. Every placed
+ * tensor must also lie inside its region and under the region's peak.
+ *
+ * Then it corrupts plans on purpose and requires nn_arena_check() to reject
+ * them: a layer's output on its input, and two tensors live together
+ * overlapping by a single byte. Tensors that are never live together may
+ * share bytes, which the check must accept.
+ *
+ * Exits non-zero on the first failure.
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -o nn_arena_check tools/nn_arena_check.c \
+ *      application/modules/nn/src/nn_arena.c -Iapplication/modules/nn/src
+ *
+ * Usage: nn_arena_check [random_graphs]   (default 20000)
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nn_arena.h"
+
+#define MAX_TENSORS   NN_ARENA_MAX_TENSORS
+
+static uint8_t   region_a[8192] __attribute__((aligned(8)));
+static uint8_t   region_b[65536] __attribute__((aligned(8)));
+static int8_t    bound_input[16 * 16 * 8];
+static nn_tensor tensors[MAX_TENSORS];
+static nn_layer  layers[MAX_TENSORS];
+
+static uint32_t seed = 1U;
+
+static int32_t random_range(int32_t lo, int32_t hi)
+{
+  seed = seed * 1664525U + 1013904223U;
+  return lo + (int32_t)((seed >> 8) % (uint32_t)(hi - lo + 1));
+}
+
+static uint32_t tensor_bytes(const nn_tensor *tensor)
+{
+  return (uint32_t)(tensor->dims.n * tensor->dims.h * tensor->dims.w * tensor->dims.c);
+}
+
+static void set_dims(uint32_t t, int32_t h, int32_t w, int32_t c)
+{
+  tensors[t].dims.n = 1;
+  tensors[t].dims.h = h;
+  tensors[t].dims.w = w;
+  tensors[t].dims.c = c;
+  tensors[t].data = NULL;
+}
+
+static void set_layer(uint32_t i, nn_op op, uint16_t input, uint16_t input_2, uint16_t output)
+{
+  layers[i].op = op;
+  layers[i].input = input;
+  layers[i].input_2 = input_2;
+  layers[i].output = output;
+  layers[i].params = NULL;
+}
+
+static nn_model make_model(uint32_t tensor_count, uint32_t layer_count)
+{
+  nn_model model;
+
+  memset(&model, 0, sizeof(model));
+  model.tensors = tensors;
+  model.tensor_count = (uint16_t)tensor_count;
+  model.layers = layers;
+  model.layer_count = (uint16_t)layer_count;
+  return model;
+}
+
+/* Every planned tensor inside its region and under its peak */
+static int check_bounds(const nn_model *model, const nn_arena_region *regions, uint32_t region_count)
+{
+  uint32_t t;
+  uint32_t r;
+
+  for (t = 0U; t < model->tensor_count; t++)
+  {
+    const uint8_t *data = (const uint8_t *)model->tensors[t].data;
+    const uint32_t bytes = tensor_bytes(&model->tensors[t]);
+
+    if ((data == NULL) || (data == (const uint8_t *)bound_input))
+    {
+      continue;
+    }
+    for (r = 0U; r < region_count; r++)
+    {
+      if ((data >= regions[r].base) && (data < (regions[r].base + regions[r].size)))
+      {
+        break;
+      }
+    }
+    if ((r == region_count) || (((uintptr_t)data & (NN_ARENA_ALIGN - 1U)) != 0U) ||
+        ((uint32_t)(data - regions[r].base) + bytes > regions[r].peak) || (regions[r].peak > regions[r].size))
+    {
+      printf("tensor %lu (%lu B) outside its region or peak\n", (unsigned long)t, (unsigned long)bytes);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* Plans and checks; NN_NO_MEMORY is accepted only when allowed */
+static int plan_and_check(const char *name, nn_model *model, uint32_t size_a, uint32_t size_b, int may_not_fit)
+{
+  nn_arena_region regions[2] =
+  {
+    { "A", region_a, size_a, 0U },
+    { "B", region_b, size_b, 0U },
+  };
+  const uint32_t region_count = (size_b != 0U) ? 2U : 1U;
+  nn_status status;
+
+  status = nn_arena_plan(model, regions, region_count);
+  if (status == NN_NO_MEMORY && may_not_fit)
+  {
+    return 0;
+  }
+  if (status != NN_OK)
+  {
+    printf("%s: plan failed (%d)\n", name, (int)status);
+    return 1;
+  }
+  if (nn_arena_check(model) != NN_OK)
+  {
+    printf("%s: nn_arena_check() rejects the plan\n", name);
+    return 1;
+  }
+  if (check_bounds(model, regions, region_count) != 0)
+  {
+    printf("%s: bad placement\n", name);
+    return 1;
+  }
+  return 0;
+}
+
+/* The synthetic model of bench_nn.c: keep in step with its tables */
+static int check_bench_model(void)
+{
+  static const nn_op ops[] =
+  {
+    NN_OP_CONV2D, NN_OP_DEPTHWISE_CONV2D, NN_OP_AVG_POOL, NN_OP_ADD, NN_OP_MAX_POOL, NN_OP_FULLY_CONNECTED,
+    NN_OP_SOFTMAX
+  };
+  nn_model model = make_model(8U, 7U);
+  nn_arena_region regions[2] =
+  {
+    { "DTCM", region_a, 8192U, 0U },
+    { "AXI",  region_b, 16384U, 0U },
+  };
+  uint32_t i;
+
+  set_dims(0U, 16, 16, 8);
+  set_dims(1U, 16, 16, 16);
+  set_dims(2U, 16, 16, 16);
+  set_dims(3U, 8, 8, 16);
+  set_dims(4U, 8, 8, 16);
+  set_dims(5U, 4, 4, 16);
+  set_dims(6U, 1, 1, 10);
+  set_dims(7U, 1, 1, 10);
+  tensors[0].data = bound_input;
+  for (i = 0U; i < 7U; i++)
+  {
+    set_layer(i, ops[i], (uint16_t)i, (uint16_t)((ops[i] == NN_OP_ADD) ? i : 0U), (uint16_t)(i + 1U));
+  }
+
+  if ((nn_arena_plan(&model, regions, 2U) != NN_OK) || (nn_arena_check(&model) != NN_OK) ||
+      (check_bounds(&model, regions, 2U) != 0))
+  {
+    printf("bench_nn model: plan rejected\n");
+    return 1;
+  }
+  printf("bench_nn model: DTCM %lu B, AXI %lu B, one buffer per tensor %lu B\n", (unsigned long)regions[0].peak,
+         (unsigned long)regions[1].peak, (unsigned long)nn_arena_naive_size(&model));
+  return 0;
+}
+
+static int check_patterns(void)
+{
+  nn_model model;
+  uint32_t i;
+
+  /* Residual skip: tensor 1 stays live across a chain of 20 and is added at the end */
+  set_dims(0U, 8, 8, 8);
+  for (i = 1U; i <= 21U; i++)
+  {
+    set_dims(i, 8, 8, (int32_t)(4U + (i % 5U) * 4U));
+    set_layer(i - 1U, NN_OP_CONV2D, (uint16_t)(i - 1U), 0U, (uint16_t)i);
+  }
+  set_dims(22U, 8, 8, 8);
+  set_layer(21U, NN_OP_ADD, 21U, 1U, 22U);
+  model = make_model(23U, 22U);
+  if (plan_and_check("residual skip", &model, 1024U, 65536U, 0) != 0)
+  {
+    return 1;
+  }
+
+  /* Fan-out: tensor 0 read by every layer */
+  set_dims(0U, 1, 1, 3000);
+  for (i = 1U; i < 40U; i++)
+  {
+    set_dims(i, 1, 1, (int32_t)(100U + (i * 37U) % 900U));
+    set_layer(i - 1U, NN_OP_ADD, 0U, (uint16_t)(i - 1U), (uint16_t)i);
+  }
+  model = make_model(40U, 39U);
+  if (plan_and_check("fan-out", &model, 8192U, 65536U, 0) != 0)
+  {
+    return 1;
+  }
+
+  /* Odd, one-byte and equal sizes */
+  for (i = 0U; i < 30U; i++)
+  {
+    set_dims(i, 1, 1, (i % 3U == 0U) ? 1 : ((i % 3U == 1U) ? 13 : 64));
+    if (i != 0U)
+    {
+      set_layer(i - 1U, (i % 4U == 0U) ? NN_OP_ADD : NN_OP_MAX_POOL, (uint16_t)(i - 1U),
+                (uint16_t)((i >= 4U) ? (i - 4U) : 0U), (uint16_t)i);
+    }
+  }
+  model = make_model(30U, 29U);
+  if (plan_and_check("odd sizes", &model, 256U, 0U, 0) != 0)
+  {
+    return 1;
+  }
+
+  /* Bound input, and a first region too small for most tensors */
+  set_dims(0U, 16, 16, 8);
+  tensors[0].data = bound_input;
+  for (i = 1U; i < 12U; i++)
+  {
+    set_dims(i, 1, 1, (int32_t)((i & 1U) ? 40U : 3000U));
+    set_layer(i - 1U, NN_OP_CONV2D, (uint16_t)(i - 1U), 0U, (uint16_t)i);
+  }
+  model = make_model(12U, 11U);
+  if (plan_and_check("spill", &model, 100U, 65536U, 0) != 0)
+  {
+    return 1;
+  }
+  if (tensors[0].data != bound_input)
+  {
+    printf("spill: bound input moved\n");
+    return 1;
+  }
+
+  /* Unused tensors are left alone */
+  set_dims(0U, 1, 1, 64);
+  set_dims(1U, 1, 1, 64);
+  set_dims(2U, 1, 1, 64);
+  set_layer(0U, NN_OP_SOFTMAX, 0U, 0U, 2U);
+  model = make_model(3U, 1U);
+  if ((plan_and_check("unused tensor", &model, 1024U, 0U, 0) != 0) || (tensors[1].data != NULL))
+  {
+    printf("unused tensor: placed\n");
+    return 1;
+  }
+  return 0;
+}
+
+/* Random DAGs: each layer writes a fresh tensor from one or two earlier ones */
+static int check_random(long graphs)
+{
+  long g;
+  long planned = 0;
+
+  for (g = 0; g < graphs; g++)
+  {
+    const uint32_t layer_count = (uint32_t)random_range(1, MAX_TENSORS - 1);
+    const int tight = random_range(0, 1);
+    nn_model model;
+    uint32_t i;
+
+    for (i = 0U; i <= layer_count; i++)
+    {
+      const int32_t kind = random_range(0, 9);
+
+      set_dims(i, random_range(1, 8), random_range(1, 8),
+               (kind == 0) ? 1 : ((kind < 3) ? random_range(1, 7) : random_range(1, 64)));
+    }
+    if (random_range(0, 3) == 0)
+    {
+      set_dims(0U, 1, 1, (int32_t)sizeof(bound_input));
+      tensors[0].data = bound_input;
+    }
+    for (i = 0U; i < layer_count; i++)
+    {
+      /* Mostly the previous tensor, sometimes one far back, keeping it live */
+      const uint16_t input = (uint16_t)((random_range(0, 3) != 0) ? i : (uint32_t)random_range(0, (int32_t)i));
+      const uint16_t input_2 = (uint16_t)random_range(0, (int32_t)i);
+
+      set_layer(i, (random_range(0, 2) == 0) ? NN_OP_ADD : NN_OP_CONV2D, input, input_2, (uint16_t)(i + 1U));
+    }
+    model = make_model(layer_count + 1U, layer_count);
+
+    if (plan_and_check("random", &model, tight ? (uint32_t)random_range(0, 4096) : 8192U,
+                       tight ? (uint32_t)random_range(0, 16384) : 65536U, tight) != 0)
+    {
+      printf("  graph %ld, %lu layers\n", g, (unsigned long)layer_count);
+      return 1;
+    }
+    planned += (tensors[layer_count].data != NULL) ? 1 : 0;
+  }
+  printf("random graphs: %ld, %ld planned\n", graphs, planned);
+  return 0;
+}
+
+/* Plans that must be rejected, and one sharing bytes legitimately */
+static int check_rejects(void)
+{
+  nn_model model;
+  int8_t *planned_2;
+  int8_t *planned_4;
+  uint32_t i;
+
+  for (i = 0U; i < 6U; i++)
+  {
+    set_dims(i, 1, 1, 64);
+    if (i != 0U)
+    {
+      set_layer(i - 1U, NN_OP_CONV2D, (uint16_t)(i - 1U), 0U, (uint16_t)i);
+    }
+  }
+  model = make_model(6U, 5U);
+  if (plan_and_check("chain", &model, 1024U, 0U, 0) != 0)
+  {
+    return 1;
+  }
+
+  /* 0, 2 and 4 are never live together: a plan sharing their bytes is fine */
+  planned_2 = tensors[2].data;
+  planned_4 = tensors[4].data;
+  tensors[2].data = tensors[0].data;
+  tensors[4].data = tensors[0].data;
+  if (nn_arena_check(&model) != NN_OK)
+  {
+    printf("reject: disjoint lifetimes sharing bytes refused\n");
+    return 1;
+  }
+  tensors[2].data = planned_2;
+  tensors[4].data = planned_4;
+
+  /* Layer 2 runs in place */
+  tensors[3].data = tensors[2].data;
+  if (nn_arena_check(&model) != NN_ARG_ERROR)
+  {
+    printf("reject: output on its own input accepted\n");
+    return 1;
+  }
+
+  /* One byte of overlap between a layer's input and output */
+  tensors[3].data = (int8_t *)&region_a[512];
+  tensors[2].data = (int8_t *)&region_a[512 + 63];
+  if (nn_arena_check(&model) != NN_ARG_ERROR)
+  {
+    printf("reject: one-byte overlap accepted\n");
+    return 1;
+  }
+  tensors[2].data = (int8_t *)&region_a[512];
+  tensors[3].data = (int8_t *)&region_a[512 + 63];
+  if (nn_arena_check(&model) != NN_ARG_ERROR)
+  {
+    printf("reject: one-byte overlap (mirrored) accepted\n");
+    return 1;
+  }
+  tensors[3].data = (int8_t *)&region_a[512];
+  tensors[2].data = (int8_t *)&region_a[512 + 64];
+  if (nn_arena_check(&model) != NN_OK)
+  {
+    printf("reject: adjacent tensors refused\n");
+    return 1;
+  }
+
+  /* A skip connection overlapping a tensor of the chain it spans */
+  for (i = 0U; i < 6U; i++)
+  {
+    tensors[i].data = NULL;
+  }
+  set_layer(4U, NN_OP_ADD, 4U, 1U, 5U);
+  if (plan_and_check("skip", &model, 1024U, 0U, 0) != 0)
+  {
+    return 1;
+  }
+  tensors[3].data = tensors[1].data + 32;
+  if (nn_arena_check(&model) != NN_ARG_ERROR)
+  {
+    printf("reject: overlap with a skip tensor accepted\n");
+    return 1;
+  }
+
+  printf("corrupted plans rejected\n");
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  const long graphs = (argc > 1) ? strtol(argv[1], NULL, 0) : 20000;
+
+  if ((check_bench_model() != 0) || (check_patterns() != 0) || (check_random(graphs) != 0) ||
+      (check_rejects() != 0))
+  {
+    return 1;
+  }
+  printf("arena plans ok\n");
+  return 0;
+}
@@ -0,0 +1,576 @@
+/*
+ * Host round-trip check of tools/nn_convert.py against nn_blob_load()
+ * (application/modules/nn, nn_blob.c).
+ *
+ * The test model (every op: conv2d, dw_conv2d, add, max/avg pool, fully
+ * connected, softmax) is defined here as C layer parameters with random
+ * weights. "--json" writes it as a converter input; the converted blob is
+ * then loaded, planned with nn_arena and run with nn_model_invoke(), and
+ * every layer's output is compared with nn_ref run on the C parameters. A
+ * field the converter and the loader disagree on shows up as a mismatch.
+ *
+ * Then the blob is corrupted on purpose: every byte flipped in turn must be
+ * refused (NN_BLOB_BAD_CRC past the header's CRC field), and zero, negative
+ * and overflowing tensor or filter dims, behind a valid CRC, must give
+ * NN_BLOB_BAD_LAYOUT. Exits non-zero on the first failure.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -o nn_blob_check tools/nn_blob_check.c \
+ *      application/modules/nn/src/nn_blob.c application/modules/nn/src/nn_model.c \
+ *      application/modules/nn/src/nn_arena.c application/modules/nn/src/nn_conv.c \
+ *      application/modules/nn/src/nn_fully_connected.c application/modules/nn/src/nn_pool.c \
+ *      application/modules/nn/src/nn_softmax.c application/modules/nn/src/nn_add.c \
+ *      application/modules/nn/src/nn_ref.c -Iapplication/modules/nn/src
+ *   ./nn_blob_check --json /tmp/nn_blob_check.json
+ *   python3 tools/nn_convert.py /tmp/nn_blob_check.json /tmp/nn_blob_check
+ *   ./nn_blob_check /tmp/nn_blob_check.bin
+ *
+ * Usage: nn_blob_check --json <model.json> | nn_blob_check <blob.bin>
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nn.h"
+#include "nn_arena.h"
+#include "nn_blob.h"
+#include "nn_ref.h"
+
+#define IN_C        4
+#define MID_C       8
+#define CLASSES     10
+#define TENSORS     8
+#define LAYERS      7
+#define MAX_BLOB    (64 * 1024)
+
+typedef struct
+{
+  nn_dims dims;
+  int32_t zero_point;
+  double  scale;
+} check_tensor;
+
+/* Scales of the add operands are equal powers of two, so its derived multipliers are exact */
+static const check_tensor tensors[TENSORS] =
+{
+  { { 1, 8, 8, IN_C },    -128, 0.05 },
+  { { 1, 8, 8, MID_C },   -128, 0.0625 },
+  { { 1, 8, 8, MID_C },   0,    0.0625 },
+  { { 1, 8, 8, MID_C },   -128, 0.0625 },
+  { { 1, 4, 4, MID_C },   -128, 0.0625 },
+  { { 1, 2, 2, MID_C },   -128, 0.0625 },
+  { { 1, 1, 1, CLASSES }, 5,    0.1 },
+  { { 1, 1, 1, CLASSES }, -128, 0.00390625 },
+};
+
+static int8_t  conv_w[MID_C * 3 * 5 * IN_C];
+static int32_t conv_bias[MID_C];
+static int32_t conv_mult[MID_C];
+static int32_t conv_shift[MID_C];
+static int8_t  dw_w[3 * 3 * MID_C];
+static int32_t dw_bias[MID_C];
+static int32_t dw_mult[MID_C];
+static int32_t dw_shift[MID_C];
+static int8_t  fc_w[CLASSES * 2 * 2 * MID_C];
+static int32_t fc_bias[CLASSES];
+
+static const nn_conv_layer conv =
+{
+  .conv        = { .input_offset = 128, .output_offset = -128, .stride = { 1, 1 }, .padding = { 1, 2 },
+                   .activation = { -100, 110 } },
+  .quant       = { conv_mult, conv_shift },
+  .filter_dims = { MID_C, 3, 5, IN_C },
+  .filter      = conv_w,
+  .bias        = conv_bias,
+};
+
+static const nn_dw_conv_layer dw =
+{
+  .conv        = { .ch_mult = 1, .input_offset = 128, .output_offset = 0, .stride = { 1, 1 },
+                   .padding = { 1, 1 }, .activation = { -128, 127 } },
+  .quant       = { dw_mult, dw_shift },
+  .filter_dims = { 1, 3, 3, MID_C },
+  .filter      = dw_w,
+  .bias        = dw_bias,
+};
+
+/* As nn_convert.py derives them for equal scales and left_shift 20 */
+static const nn_add_params add =
+{
+  .input_1_offset = 0, .input_1_multiplier = 1073741824, .input_1_shift = 0,
+  .input_2_offset = 128, .input_2_multiplier = 1073741824, .input_2_shift = 0,
+  .left_shift = 20, .output_offset = -128, .output_multiplier = 1073741824, .output_shift = -18,
+  .activation = { -128, 127 },
+};
+
+static const nn_pool_layer pool =
+{
+  .pool        = { .stride = { 2, 2 }, .padding = { 0, 0 }, .activation = { -120, 120 } },
+  .filter_dims = { 1, 2, 2, 1 },
+};
+
+static const nn_fc_layer fc =
+{
+  .fc          = { .input_offset = 128, .filter_offset = 0, .output_offset = 5, .activation = { -128, 127 } },
+  .quant       = { 1288490189, -8 },
+  .filter_dims = { 2 * 2 * MID_C, 1, 1, 1 },
+  .filter      = fc_w,
+  .bias        = fc_bias,
+};
+
+static const nn_softmax_params softmax = { 1073741824, 23, -20 };
+
+static const nn_layer layers[LAYERS] =
+{
+  { NN_OP_CONV2D,           0, 0, 1, &conv    },
+  { NN_OP_DEPTHWISE_CONV2D, 1, 0, 2, &dw      },
+  { NN_OP_ADD,              2, 1, 3, &add     },
+  { NN_OP_MAX_POOL,         3, 0, 4, &pool    },
+  { NN_OP_AVG_POOL,         4, 0, 5, &pool    },
+  { NN_OP_FULLY_CONNECTED,  5, 0, 6, &fc      },
+  { NN_OP_SOFTMAX,          6, 0, 7, &softmax },
+};
+
+static uint32_t      blob_words[MAX_BLOB / 4];
+static uint32_t      bad_words[MAX_BLOB / 4];
+static nn_blob_model model;
+static uint8_t       arena[65536] __attribute__((aligned(8)));
+static int8_t        ref[TENSORS][8 * 8 * MID_C];
+static uint32_t      seed = 1U;
+
+static int8_t random_s8(void)
+{
+  seed = seed * 1664525U + 1013904223U;
+  return (int8_t)(seed >> 24);
+}
+
+static void fill(int8_t *data, size_t size)
+{
+  size_t i;
+
+  for (i = 0U; i < size; i++)
+  {
+    data[i] = random_s8();
+  }
+}
+
+/* Same values in both modes: the JSON and the reference must agree */
+static void make_params(void)
+{
+  int32_t i;
+
+  fill(conv_w, sizeof(conv_w));
+  fill(dw_w, sizeof(dw_w));
+  fill(fc_w, sizeof(fc_w));
+  for (i = 0; i < MID_C; i++)
+  {
+    conv_bias[i] = i * 97 - 350;
+    conv_mult[i] = 1518500250 - i * 20000000;
+    conv_shift[i] = -8 - (i & 1);
+    dw_bias[i] = 200 - i * 61;
+    dw_mult[i] = 1300000000 + i * 15000000;
+    dw_shift[i] = -7 - (i % 3);
+  }
+  for (i = 0; i < CLASSES; i++)
+  {
+    fc_bias[i] = i * 113 - 500;
+  }
+}
+
+static int32_t dims_count(const nn_dims *dims)
+{
+  return dims->n * dims->h * dims->w * dims->c;
+}
+
+static void json_ints(FILE *file, const char *key, const int32_t *values, int32_t count)
+{
+  int32_t i;
+
+  fprintf(file, "\"%s\": [", key);
+  for (i = 0; i < count; i++)
+  {
+    fprintf(file, "%s%ld", (i != 0) ? ", " : "", (long)values[i]);
+  }
+  fprintf(file, "]");
+}
+
+static void json_s8(FILE *file, const char *key, const int8_t *values, int32_t count)
+{
+  int32_t i;
+
+  fprintf(file, "\"%s\": [", key);
+  for (i = 0; i < count; i++)
+  {
+    fprintf(file, "%s%d", (i != 0) ? ", " : "", values[i]);
+  }
+  fprintf(file, "]");
+}
+
+static void json_dims(FILE *file, const char *key, const nn_dims *dims)
+{
+  const int32_t values[4] = { dims->n, dims->h, dims->w, dims->c };
+
+  json_ints(file, key, values, 4);
+}
+
+static void json_pair(FILE *file, const char *key, int32_t first, int32_t second)
+{
+  const int32_t values[2] = { first, second };
+
+  json_ints(file, key, values, 2);
+}
+
+static int write_json(const char *path)
+{
+  FILE *file = fopen(path, "w");
+  int32_t i;
+
+  if (file == NULL)
+  {
+    printf("%s: cannot write\n", path);
+    return 1;
+  }
+
+  fprintf(file, "{\n  \"input\": 0, \"output\": %d,\n  \"tensors\": [\n", TENSORS - 1);
+  for (i = 0; i < TENSORS; i++)
+  {
+    fprintf(file, "    {");
+    json_dims(file, "dims", &tensors[i].dims);
+    fprintf(file, ", \"scale\": %.17g, \"zero_point\": %ld}%s\n", tensors[i].scale, (long)tensors[i].zero_point,
+            (i != TENSORS - 1) ? "," : "");
+  }
+  fprintf(file, "  ],\n  \"layers\": [\n");
+
+  fprintf(file, "    {\"op\": \"conv2d\", \"input\": 0, \"output\": 1, \"input_offset\": %ld, \"output_offset\": %ld, ",
+          (long)conv.conv.input_offset, (long)conv.conv.output_offset);
+  json_pair(file, "stride", conv.conv.stride.h, conv.conv.stride.w);
+  fprintf(file, ", ");
+  json_pair(file, "padding", conv.conv.padding.h, conv.conv.padding.w);
+  fprintf(file, ", ");
+  json_pair(file, "activation", conv.conv.activation.min, conv.conv.activation.max);
+  fprintf(file, ",\n     \"filter\": {");
+  json_dims(file, "dims", &conv.filter_dims);
+  fprintf(file, ", ");
+  json_s8(file, "data", conv_w, (int32_t)sizeof(conv_w));
+  fprintf(file, "},\n     ");
+  json_ints(file, "bias", conv_bias, MID_C);
+  fprintf(file, ", ");
+  json_ints(file, "multiplier", conv_mult, MID_C);
+  fprintf(file, ", ");
+  json_ints(file, "shift", conv_shift, MID_C);
+  fprintf(file, "},\n");
+
+  fprintf(file, "    {\"op\": \"dw_conv2d\", \"input\": 1, \"output\": 2, \"ch_mult\": %ld, \"input_offset\": %ld, "
+          "\"output_offset\": %ld, ", (long)dw.conv.ch_mult, (long)dw.conv.input_offset, (long)dw.conv.output_offset);
+  json_pair(file, "stride", dw.conv.stride.h, dw.conv.stride.w);
+  fprintf(file, ", ");
+  json_pair(file, "padding", dw.conv.padding.h, dw.conv.padding.w);
+  fprintf(file, ", ");
+  json_pair(file, "activation", dw.conv.activation.min, dw.conv.activation.max);
+  fprintf(file, ",\n     \"filter\": {");
+  json_dims(file, "dims", &dw.filter_dims);
+  fprintf(file, ", ");
+  json_s8(file, "data", dw_w, (int32_t)sizeof(dw_w));
+  fprintf(file, "},\n     ");
+  json_ints(file, "bias", dw_bias, MID_C);
+  fprintf(file, ", ");
+  json_ints(file, "multiplier", dw_mult, MID_C);
+  fprintf(file, ", ");
+  json_ints(file, "shift", dw_shift, MID_C);
+  fprintf(file, "},\n");
+
+  /* Offsets and multipliers derived by the converter from the tensor zero points and scales */
+  fprintf(file, "    {\"op\": \"add\", \"input\": 2, \"input_2\": 1, \"output\": 3, \"left_shift\": %ld},\n",
+          (long)add.left_shift);
+
+  fprintf(file, "    {\"op\": \"max_pool\", \"input\": 3, \"output\": 4, ");
+  json_pair(file, "size", pool.filter_dims.h, pool.filter_dims.w);
+  fprintf(file, ", ");
+  json_pair(file, "stride", pool.pool.stride.h, pool.pool.stride.w);
+  fprintf(file, ", ");
+  json_pair(file, "padding", pool.pool.padding.h, pool.pool.padding.w);
+  fprintf(file, ", ");
+  json_pair(file, "activation", pool.pool.activation.min, pool.pool.activation.max);
+  fprintf(file, "},\n");
+
+  fprintf(file, "    {\"op\": \"avg_pool\", \"input\": 4, \"output\": 5, ");
+  json_pair(file, "size", pool.filter_dims.h, pool.filter_dims.w);
+  fprintf(file, ", ");
+  json_pair(file, "activation", pool.pool.activation.min, pool.pool.activation.max);
+  fprintf(file, "},\n");
+
+  fprintf(file, "    {\"op\": \"fully_conn\", \"input\": 5, \"output\": 6, \"input_offset\": %ld, "
+          "\"output_offset\": %ld, ", (long)fc.fc.input_offset, (long)fc.fc.output_offset);
+  json_pair(file, "activation", fc.fc.activation.min, fc.fc.activation.max);
+  fprintf(file, ",\n     \"filter\": {");
+  json_pair(file, "dims", CLASSES, fc.filter_dims.n);
+  fprintf(file, ", ");
+  json_s8(file, "data", fc_w, (int32_t)sizeof(fc_w));
+  fprintf(file, "},\n     ");
+  json_ints(file, "bias", fc_bias, CLASSES);
+  fprintf(file, ", ");
+  json_ints(file, "multiplier", &fc.quant.multiplier, 1);
+  fprintf(file, ", ");
+  json_ints(file, "shift", &fc.quant.shift, 1);
+  fprintf(file, "},\n");
+
+  fprintf(file, "    {\"op\": \"softmax\", \"input\": 6, \"output\": 7, \"multiplier\": %ld, \"shift\": %ld, "
+          "\"diff_min\": %ld}\n", (long)softmax.multiplier, (long)softmax.shift, (long)softmax.diff_min);
+  fprintf(file, "  ]\n}\n");
+
+  fclose(file);
+  printf("%s: %d tensors, %d layers\n", path, TENSORS, LAYERS);
+  return 0;
+}
+
+static nn_status ref_layer(const nn_layer *layer)
+{
+  const nn_dims *in = &tensors[layer->input].dims;
+  const nn_dims *out = &tensors[layer->output].dims;
+  const int8_t *src = ref[layer->input];
+  int8_t *dst = ref[layer->output];
+
+  switch (layer->op)
+  {
+    case NN_OP_CONV2D:
+      return nn_ref_conv2d_s8(&conv.conv, &conv.quant, in, src, &conv.filter_dims, conv.filter, conv.bias, out, dst);
+    case NN_OP_DEPTHWISE_CONV2D:
+      return nn_ref_depthwise_conv2d_s8(&dw.conv, &dw.quant, in, src, &dw.filter_dims, dw.filter, dw.bias, out, dst);
+    case NN_OP_ADD:
+      return nn_ref_add_s8(&add, src, ref[layer->input_2], dims_count(out), dst);
+    case NN_OP_MAX_POOL:
+      return nn_ref_max_pool_s8(&pool.pool, in, src, &pool.filter_dims, out, dst);
+    case NN_OP_AVG_POOL:
+      return nn_ref_avg_pool_s8(&pool.pool, in, src, &pool.filter_dims, out, dst);
+    case NN_OP_FULLY_CONNECTED:
+      return nn_ref_fully_connected_s8(&fc.fc, &fc.quant, in, src, &fc.filter_dims, fc.filter, fc.bias, out, dst);
+    case NN_OP_SOFTMAX:
+      return nn_ref_softmax_s8(&softmax, src, in->n * in->h * in->w, in->c, dst);
+    default:
+      return NN_NO_IMPL;
+  }
+}
+
+/* Shapes, quantization and wiring of the loaded model against the definition */
+static int check_structure(void)
+{
+  int32_t i;
+
+  if ((model.model.tensor_count != TENSORS) || (model.model.layer_count != LAYERS) || (model.input != 0U) ||
+      (model.output != TENSORS - 1) || (model.model.scratch.buf != NULL))
+  {
+    printf("loaded model: wrong counts, input/output or scratch\n");
+    return 1;
+  }
+  for (i = 0; i < TENSORS; i++)
+  {
+    const nn_dims *dims = &model.tensors[i].dims;
+
+    if ((memcmp(dims, &tensors[i].dims, sizeof(*dims)) != 0) || (model.quant[i].zero_point != tensors[i].zero_point) ||
+        (model.quant[i].scale != (float)tensors[i].scale))
+    {
+      printf("tensor %ld: dims or quantization differ\n", (long)i);
+      return 1;
+    }
+  }
+  for (i = 0; i < LAYERS; i++)
+  {
+    const nn_layer *got = &model.layers[i];
+
+    if ((got->op != layers[i].op) || (got->input != layers[i].input) || (got->output != layers[i].output) ||
+        ((got->op == NN_OP_ADD) && (got->input_2 != layers[i].input_2)))
+    {
+      printf("layer %ld: op or operands differ\n", (long)i);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int check_run(void)
+{
+  nn_arena_region region = { "host", arena, sizeof(arena), 0U };
+  nn_status status;
+  uint32_t i;
+
+  status = nn_arena_plan(&model.model, &region, 1U);
+  if ((status != NN_OK) || (nn_arena_check(&model.model) != NN_OK))
+  {
+    printf("arena plan failed (%d)\n", (int)status);
+    return 1;
+  }
+
+  fill(ref[0], (size_t)dims_count(&tensors[0].dims));
+  memcpy(model.tensors[0].data, ref[0], (size_t)dims_count(&tensors[0].dims));
+  for (i = 0U; i < LAYERS; i++)
+  {
+    if (ref_layer(&layers[i]) != NN_OK)
+    {
+      printf("nn_ref: layer %lu failed\n", (unsigned long)i);
+      return 1;
+    }
+  }
+
+  /* The arena reuses bytes, so only the model output survives a whole invoke */
+  status = nn_model_invoke(&model.model);
+  if (status != NN_OK)
+  {
+    printf("nn_model_invoke: %d\n", (int)status);
+    return 1;
+  }
+  if (memcmp(model.tensors[model.output].data, ref[model.output],
+             (size_t)dims_count(&tensors[model.output].dims)) != 0)
+  {
+    printf("nn_model_invoke: output differs from nn_ref\n");
+    return 1;
+  }
+
+  /* Layer by layer, each output compared before a later layer can reuse its bytes */
+  memcpy(model.tensors[0].data, ref[0], (size_t)dims_count(&tensors[0].dims));
+  for (i = 0U; i < LAYERS; i++)
+  {
+    const uint16_t t = layers[i].output;
+
+    status = nn_model_run_layer(&model.model, &model.model.layers[i]);
+    if (status != NN_OK)
+    {
+      printf("nn_model_run_layer: layer %lu: %d\n", (unsigned long)i, (int)status);
+      return 1;
+    }
+    if (memcmp(model.tensors[t].data, ref[t], (size_t)dims_count(&tensors[t].dims)) != 0)
+    {
+      printf("layer %lu (%s): output differs from nn_ref\n", (unsigned long)i, nn_op_name(layers[i].op));
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* Rewrites the CRC so only the layout checks can refuse the blob */
+static void reseal(uint8_t *blob, uint32_t size)
+{
+  static const uint8_t zero[4] = { 0U, 0U, 0U, 0U };
+  uint32_t crc;
+
+  crc = nn_blob_crc32(blob, offsetof(nn_blob_header, crc32), 0U);
+  crc = nn_blob_crc32(zero, sizeof(zero), crc);
+  crc = nn_blob_crc32(&blob[offsetof(nn_blob_header, crc32) + 4U], size - (offsetof(nn_blob_header, crc32) + 4U),
+                      crc);
+  memcpy(&blob[offsetof(nn_blob_header, crc32)], &crc, sizeof(crc));
+}
+
+static int check_corrupt(uint32_t size)
+{
+  static const int32_t bad_dims[][4] =
+  {
+    { 1, 0, 8, 8 },
+    { 1, 8, -3, 8 },
+    { 1, 65536, 65536, 8 },        /* 2^35: wraps a 32-bit product */
+    { 65536, 65536, 2, 1 },        /* 2^33 */
+    { 2147483647, 2, 1, 1 },
+  };
+  const nn_blob_header *header = (const nn_blob_header *)blob_words;
+  uint8_t *bad = (uint8_t *)bad_words;
+  const uint32_t conv_params = ((const nn_blob_layer *)((const uint8_t *)blob_words + header->layer_offset))->params_offset;
+  uint32_t i;
+  uint32_t d;
+
+  for (i = 0U; i < size; i++)
+  {
+    nn_blob_status status;
+
+    memcpy(bad, blob_words, size);
+    bad[i] ^= (uint8_t)(1U << (i & 7U));
+    status = nn_blob_load(bad, size, &model);
+    if ((status == NN_BLOB_OK) || ((i >= offsetof(nn_blob_header, crc32)) && (status != NN_BLOB_BAD_CRC)))
+    {
+      printf("byte %lu flipped: status %d, expected %s\n", (unsigned long)i, (int)status,
+             (i >= offsetof(nn_blob_header, crc32)) ? "NN_BLOB_BAD_CRC" : "a refusal");
+      return 1;
+    }
+  }
+
+  for (d = 0U; d < (sizeof(bad_dims) / sizeof(bad_dims[0])); d++)
+  {
+    nn_blob_status status;
+
+    /* Tensor 1's dims */
+    memcpy(bad, blob_words, size);
+    memcpy(&bad[header->tensor_offset + sizeof(nn_blob_tensor)], bad_dims[d], sizeof(bad_dims[d]));
+    reseal(bad, size);
+    status = nn_blob_load(bad, size, &model);
+    if (status != NN_BLOB_BAD_LAYOUT)
+    {
+      printf("tensor dims {%ld, %ld, %ld, %ld}: status %d, expected NN_BLOB_BAD_LAYOUT\n", (long)bad_dims[d][0],
+             (long)bad_dims[d][1], (long)bad_dims[d][2], (long)bad_dims[d][3], (int)status);
+      return 1;
+    }
+
+    /* The conv filter dims, words 8..11 of its record */
+    memcpy(bad, blob_words, size);
+    memcpy(&bad[conv_params + 8U * 4U], bad_dims[d], sizeof(bad_dims[d]));
+    reseal(bad, size);
+    status = nn_blob_load(bad, size, &model);
+    if (status != NN_BLOB_BAD_LAYOUT)
+    {
+      printf("filter dims {%ld, %ld, %ld, %ld}: status %d, expected NN_BLOB_BAD_LAYOUT\n", (long)bad_dims[d][0],
+             (long)bad_dims[d][1], (long)bad_dims[d][2], (long)bad_dims[d][3], (int)status);
+      return 1;
+    }
+  }
+
+  /* Resealing alone must not break anything */
+  memcpy(bad, blob_words, size);
+  reseal(bad, size);
+  if (nn_blob_load(bad, size, &model) != NN_BLOB_OK)
+  {
+    printf("resealed blob refused\n");
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  FILE *file;
+  size_t size;
+  nn_blob_status status;
+
+  make_params();
+  if ((argc == 3) && (strcmp(argv[1], "--json") == 0))
+  {
+    return write_json(argv[2]);
+  }
+  if (argc != 2)
+  {
+    printf("usage: nn_blob_check --json <model.json> | nn_blob_check <blob.bin>\n");
+    return 2;
+  }
+
+  file = fopen(argv[1], "rb");
+  if (file == NULL)
+  {
+    printf("%s: cannot read\n", argv[1]);
+    return 1;
+  }
+  size = fread(blob_words, 1U, sizeof(blob_words), file);
+  fclose(file);
+
+  status = nn_blob_load(blob_words, (uint32_t)size, &model);
+  if (status != NN_BLOB_OK)
+  {
+    printf("nn_blob_load: %d\n", (int)status);
+    return 1;
+  }
+  if ((check_structure() != 0) || (check_run() != 0) || (check_corrupt((uint32_t)size) != 0))
+  {
+    return 1;
+  }
+
+  printf("%s: %lu bytes, %d layers bit-exact with nn_ref, %lu flipped bytes and bad dims refused: ok\n", argv[1],
+         (unsigned long)size, LAYERS, (unsigned long)size);
+  return 0;
+}
@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+"""Convert a JSON model description into the nn blob format (nn_blob.h).
+
+Writes <out>.bin and <out>.c; the C file holds the blob as a const array in
+.rodata.nn_model (internal flash, consumed in place by nn_blob_load()).
+
+Input JSON:
+
+  {
+    "input": 0, "output": 3,
+    "tensors": [ {"dims": [1, 16, 16, 8], "scale": 0.05, "zero_point": -128}, ... ],
+    "layers":  [ {"op": "conv2d", "input": 0, "output": 1, ...}, ... ]
+  }
+
+Layer keys, per op (offsets default from the tensor zero points, activation
+to [-128, 127]):
+
+  conv2d / dw_conv2d: stride [h, w], padding [h, w], filter {dims, data|file},
+      bias [..], and either multiplier/shift lists or filter_scale [..] to
+      derive them from the tensor scales; dw_conv2d also ch_mult
+  fully_conn: filter {dims [out, depth], data|file}, bias, multiplier/shift
+      or filter_scale (one value)
+  max_pool / avg_pool: stride, padding, size [h, w]
+  softmax: beta (default 1.0) or multiplier/shift/diff_min
+  add: left_shift (default 20); multipliers derived from the tensor scales
+
+"data" is a flat list of ints, "file" a raw little-endian file of int8.
+"""
+
+import argparse
+import json
+import math
+import struct
+import sys
+import zlib
+
+MAGIC = 0x444C4E4E
+VERSION = 1
+DATA_ALIGN = 16
+HEADER = struct.Struct("<IHHIIHHHHII")
+TENSOR = struct.Struct("<iiiiif")
+LAYER = struct.Struct("<HHHHI")
+OPS = ["conv2d", "dw_conv2d", "fully_conn", "max_pool", "avg_pool", "softmax", "add"]
+
+
+def quantize_multiplier(real):
+    """Q31 multiplier and shift as TFLite's QuantizeMultiplier()."""
+    if real == 0.0:
+        return 0, 0
+    mantissa, shift = math.frexp(real)
+    q = int(round(mantissa * (1 << 31)))
+    if q == (1 << 31):
+        q //= 2
+        shift += 1
+    if shift < -31:
+        return 0, 0
+    return q, shift
+
+
+class Blob:
+    def __init__(self):
+        self.data = bytearray()
+
+    def align(self, boundary):
+        while len(self.data) % boundary:
+            self.data.append(0)
+
+    def put(self, payload, boundary=4):
+        self.align(boundary)
+        offset = len(self.data)
+        self.data += payload
+        return offset
+
+    def words(self, values):
+        return self.put(struct.pack("<%di" % len(values), *values))
+
+
+def load_int8(spec):
+    if "file" in spec:
+        with open(spec["file"], "rb") as handle:
+            return bytes(handle.read())
+    return struct.pack("<%db" % len(spec["data"]), *spec["data"])
+
+
+def activation(layer):
+    return layer.get("activation", [-128, 127])
+
+
+def per_channel(layer, tensors, count):
+    if "multiplier" in layer:
+        return layer["multiplier"], layer["shift"]
+    in_scale = tensors[layer["input"]]["scale"]
+    out_scale = tensors[layer["output"]]["scale"]
+    scales = layer["filter_scale"]
+    if len(scales) == 1:
+        scales = scales * count
+    pairs = [quantize_multiplier(in_scale * s / out_scale) for s in scales]
+    return [p[0] for p in pairs], [p[1] for p in pairs]
+
+
+def layer_record(blob, layer, tensors):
+    op = layer["op"]
+    zp_in = tensors[layer["input"]]["zero_point"]
+    zp_out = tensors[layer["output"]]["zero_point"]
+    in_off = layer.get("input_offset", -zp_in)
+    out_off = layer.get("output_offset", zp_out)
+    act = activation(layer)
+
+    if op in ("conv2d", "dw_conv2d"):
+        dims = layer["filter"]["dims"]
+        weights = load_int8(layer["filter"])
+        if len(weights) != dims[0] * dims[1] * dims[2] * dims[3]:
+            sys.exit("%s: filter size does not match dims" % op)
+        channels = dims[0] if op == "conv2d" else dims[3]
+        mult, shift = per_channel(layer, tensors, channels)
+        filter_off = blob.put(weights, DATA_ALIGN)
+        bias_off = blob.words(layer["bias"]) if "bias" in layer else 0
+        mult_off = blob.words(mult)
+        shift_off = blob.words(shift)
+        stride = layer.get("stride", [1, 1])
+        pad = layer.get("padding", [0, 0])
+        head = [in_off, out_off, stride[0], stride[1], pad[0], pad[1], act[0], act[1]]
+        if op == "dw_conv2d":
+            head = [layer.get("ch_mult", 1)] + head
+        return head + list(dims) + [filter_off, bias_off, mult_off, shift_off]
+
+    if op == "fully_conn":
+        dims = layer["filter"]["dims"]
+        weights = load_int8(layer["filter"])
+        if len(weights) != dims[0] * dims[1]:
+            sys.exit("fully_conn: filter size does not match dims")
+        mult, shift = per_channel(layer, tensors, 1)
+        filter_off = blob.put(weights, DATA_ALIGN)
+        bias_off = blob.words(layer["bias"]) if "bias" in layer else 0
+        return [in_off, out_off, act[0], act[1], mult[0], shift[0], dims[1], filter_off, bias_off]
+
+    if op in ("max_pool", "avg_pool"):
+        stride = layer.get("stride", layer["size"])
+        pad = layer.get("padding", [0, 0])
+        return [stride[0], stride[1], pad[0], pad[1], act[0], act[1], layer["size"][0], layer["size"][1]]
+
+    if op == "softmax":
+        if "multiplier" in layer:
+            return [layer["multiplier"], layer["shift"], layer["diff_min"]]
+        # TFLite PreprocessSoftmaxScaling with 5 integer bits
+        beta = layer.get("beta", 1.0)
+        real = min(beta * tensors[layer["input"]]["scale"] * (1 << 26), (1 << 31) - 1.0)
+        mult, shift = quantize_multiplier(real)
+        max_input = ((1 << 5) - 1) * (1 << (31 - 5)) / (1 << shift)
+        return [mult, shift, -int(math.floor(max_input))]
+
+    if op == "add":
+        left = layer.get("left_shift", 20)
+        s1 = tensors[layer["input"]]["scale"]
+        s2 = tensors[layer["input_2"]]["scale"]
+        so = tensors[layer["output"]]["scale"]
+        twice_max = 2 * max(s1, s2)
+        m1, sh1 = quantize_multiplier(s1 / twice_max)
+        m2, sh2 = quantize_multiplier(s2 / twice_max)
+        mo, sho = quantize_multiplier(twice_max / ((1 << left) * so))
+        zp2 = tensors[layer["input_2"]]["zero_point"]
+        return [in_off, m1, sh1, -zp2, m2, sh2, left, out_off, mo, sho, act[0], act[1]]
+
+    sys.exit("unknown op %r" % op)
+
+
+def convert(model):
+    tensors = model["tensors"]
+    layers = model["layers"]
+    blob = Blob()
+    blob.put(bytes(HEADER.size))
+
+    tensor_off = blob.put(b"".join(
+        TENSOR.pack(*(list(t["dims"]) + [t.get("zero_point", 0), t.get("scale", 1.0)])) for t in tensors))
+    layer_off = blob.put(bytes(LAYER.size * len(layers)))
+
+    records = []
+    for layer in layers:
+        words = layer_record(blob, layer, tensors)
+        records.append(LAYER.pack(OPS.index(layer["op"]), layer["input"], layer.get("input_2", 0),
+                                  layer["output"], blob.words(words)))
+    blob.data[layer_off:layer_off + LAYER.size * len(layers)] = b"".join(records)
+    blob.align(DATA_ALIGN)
+
+    header = HEADER.pack(MAGIC, VERSION, HEADER.size, len(blob.data), 0, len(tensors), len(layers),
+                         model["input"], model["output"], tensor_off, layer_off)
+    blob.data[0:HEADER.size] = header
+    crc = zlib.crc32(bytes(blob.data)) & 0xFFFFFFFF
+    struct.pack_into("<I", blob.data, 12, crc)
+    return bytes(blob.data)
+
+
+def emit_c(blob, name, path):
+    lines = ["/* Generated by tools/nn_convert.py - do not edit */",
+             "#include <stdint.h>",
+             "",
+             "const uint8_t %s[%d] __attribute__((aligned(%d), section(\".rodata.nn_model\"))) =" %
+             (name, len(blob), DATA_ALIGN),
+             "{"]
+    for i in range(0, len(blob), 16):
+        lines.append("  " + ", ".join("0x%02X" % b for b in blob[i:i + 16]) + ",")
+    lines += ["};", "", "const uint32_t %s_size = %dU;" % (name, len(blob)), ""]
+    with open(path, "w") as handle:
+        handle.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("model", help="JSON model description")
+    parser.add_argument("out", help="output path without extension")
+    parser.add_argument("--name", default="nn_model_blob", help="C symbol name")
+    args = parser.parse_args()
+
+    with open(args.model) as handle:
+        blob = convert(json.load(handle))
+    with open(args.out + ".bin", "wb") as handle:
+        handle.write(blob)
+    emit_c(blob, args.name, args.out + ".c")
+    print("%s: %d bytes" % (args.out, len(blob)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,105 @@
+/*
+ * Host bit-exactness check of the packed int8 GEMM (application/modules/nn)
+ * against nn_ref_gemm_s8.
+ *
+ * Runs random M x N x K shapes (every remainder of the 4x2 blocking and of
+ * the groups of four k) with random data, offsets and per-channel
+ * requantization, and exits non-zero on the first mismatch. On a host the
+ * nn_math.h wrappers are plain C with the SMLAD/SXTB16 semantics, so this
+ * checks the packing and the blocking; bench_gemm repeats the comparison on
+ * the target.
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -o nn_gemm_check tools/nn_gemm_check.c \
+ *      application/modules/nn/src/nn_gemm.c application/modules/nn/src/nn_ref.c \
+ *      -Iapplication/modules/nn/src
+ *
+ * Usage: nn_gemm_check [cases]   (default 2000)
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nn_gemm.h"
+#include "nn_ref.h"
+
+#define MAX_M    33
+#define MAX_N    33
+#define MAX_K    300
+
+static int8_t   input[MAX_M * MAX_K];
+static int8_t   weights[MAX_N * MAX_K];
+static uint32_t packed[MAX_N * (MAX_K + 3) / 2];
+static uint32_t scratch[NN_GEMM_MR * (MAX_K + 3) / 2];
+static int32_t  bias[MAX_N];
+static int32_t  multiplier[MAX_N];
+static int32_t  shift[MAX_N];
+static int8_t   out[MAX_M * MAX_N];
+static int8_t   ref[MAX_M * MAX_N];
+
+static uint32_t seed = 1U;
+
+static int32_t random_range(int32_t lo, int32_t hi)
+{
+  seed = seed * 1664525U + 1013904223U;
+  return lo + (int32_t)((seed >> 8) % (uint32_t)(hi - lo + 1));
+}
+
+int main(int argc, char **argv)
+{
+  const long cases = (argc > 1) ? strtol(argv[1], NULL, 0) : 2000;
+  const nn_context ctx = { scratch, (int32_t)sizeof(scratch) };
+  long t;
+  int32_t i;
+
+  for (t = 0; t < cases; t++)
+  {
+    const int32_t m = random_range(1, MAX_M);
+    const int32_t n = random_range(1, MAX_N);
+    const int32_t k = (t & 1) ? random_range(1, 16) : random_range(1, MAX_K);
+    const int32_t out_min = random_range(-128, 0);
+    const nn_fc_params params =
+    {
+      .input_offset = random_range(-127, 128), .filter_offset = 0, .output_offset = random_range(-128, 127),
+      .activation = { out_min, random_range(out_min, 127) },
+    };
+    const nn_per_channel_quant_params quant = { multiplier, shift };
+    const int with_bias = random_range(0, 3) != 0;
+    nn_status status;
+
+    for (i = 0; i < m * k; i++)
+    {
+      input[i] = (int8_t)random_range(-128, 127);
+    }
+    for (i = 0; i < n * k; i++)
+    {
+      weights[i] = (int8_t)random_range(-127, 127);
+    }
+    for (i = 0; i < n; i++)
+    {
+      bias[i] = random_range(-20000, 20000);
+      multiplier[i] = random_range(1 << 30, 0x7FFFFFFF);
+      shift[i] = random_range(-14, 1);
+    }
+    memset(out, 0, sizeof(out));
+
+    status = nn_gemm_pack_weights_s8(weights, n, k, packed);
+    if (status == NN_OK)
+    {
+      status = nn_gemm_s8(&ctx, &params, &quant, m, n, k, input, packed, with_bias ? bias : NULL, out);
+    }
+    (void)nn_ref_gemm_s8(&params, &quant, m, n, k, input, weights, with_bias ? bias : NULL, ref);
+
+    if ((status != NN_OK) || (memcmp(out, ref, (size_t)(m * n)) != 0))
+    {
+      printf("case %ld: M %d N %d K %d: %s\n", t, (int)m, (int)n, (int)k,
+             (status != NN_OK) ? "error" : "MISMATCH");
+      return 1;
+    }
+  }
+
+  printf("%ld shapes bit-exact\n", cases);
+  return 0;
+}
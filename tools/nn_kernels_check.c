@@ -0,0 +1,334 @@
+/*
+ * Host bit-exactness check of the nn.h kernels (application/modules/nn)
+ * against their nn_ref.h counterparts.
+ *
+ * Each case draws a kernel and a random shape (batches, sizes, channel
+ * counts off the groups of four, strides, padding, depthwise multipliers),
+ * random data, offsets, requantization and activation clamp, runs both
+ * versions and requires the same status and identical outputs. Conv runs
+ * without scratch and with a scratch of random size, so the DTCM banding
+ * is covered too. Exits non-zero on the first mismatch.
+ *
+ * On a host the nn_math.h wrappers are plain C with the SMLAD/SXTB16/SSAT
+ * semantics, so this checks the blocking, the tails and the index
+ * arithmetic; bench_nn repeats the comparison on the target.
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -o nn_kernels_check tools/nn_kernels_check.c \
+ *      application/modules/nn/src/nn_conv.c application/modules/nn/src/nn_fully_connected.c \
+ *      application/modules/nn/src/nn_pool.c application/modules/nn/src/nn_softmax.c \
+ *      application/modules/nn/src/nn_add.c application/modules/nn/src/nn_ref.c \
+ *      -Iapplication/modules/nn/src
+ *
+ * Usage: nn_kernels_check [cases]   (default 3000)
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nn.h"
+#include "nn_ref.h"
+
+#define MAX_TENSOR   (64 * 1024)
+#define MAX_CHANNELS 64
+#define GUARD        16
+
+#define MIN(a, b)    (((a) < (b)) ? (a) : (b))
+
+static int8_t  input[MAX_TENSOR];
+static int8_t  input_2[MAX_TENSOR];
+static int8_t  filter[MAX_TENSOR];
+static int32_t bias[MAX_CHANNELS];
+static int32_t multiplier[MAX_CHANNELS];
+static int32_t shift[MAX_CHANNELS];
+static int8_t  scratch[8 * 1024];
+static int8_t  out[MAX_TENSOR + GUARD];
+static int8_t  ref[MAX_TENSOR + GUARD];
+
+static uint32_t seed = 1U;
+
+static int32_t random_range(int32_t lo, int32_t hi)
+{
+  seed = seed * 1664525U + 1013904223U;
+  return lo + (int32_t)((seed >> 8) % (uint32_t)(hi - lo + 1));
+}
+
+static void random_s8(int8_t *buf, int32_t len, int32_t lo, int32_t hi)
+{
+  int32_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    buf[i] = (int8_t)random_range(lo, hi);
+  }
+}
+
+static nn_activation random_activation(void)
+{
+  const int32_t lo = (random_range(0, 2) == 0) ? random_range(-128, 0) : -128;
+  const nn_activation act = { lo, (random_range(0, 2) == 0) ? random_range(lo, 127) : 127 };
+
+  return act;
+}
+
+static void random_channel_quant(int32_t channels)
+{
+  int32_t i;
+
+  for (i = 0; i < channels; i++)
+  {
+    bias[i] = random_range(-20000, 20000);
+    multiplier[i] = random_range(1 << 30, 0x7FFFFFFF);
+    shift[i] = random_range(-12, 1);
+  }
+}
+
+/* Output size along one axis for a window that always overlaps the input (pad < kernel) */
+static int32_t random_geometry(int32_t in, int32_t kernel, int32_t *stride, int32_t *pad)
+{
+  *stride = random_range(1, 3);
+  *pad = random_range(0, kernel - 1);
+  return (in + 2 * *pad - kernel) / *stride + 1;
+}
+
+static void clear_outputs(void)
+{
+  memset(out, 0x55, sizeof(out));
+  memset(ref, 0x55, sizeof(ref));
+}
+
+static const char *check_conv(int32_t *size)
+{
+  nn_dims in_dims = { random_range(1, 2), random_range(1, 12), random_range(1, 12), random_range(1, 19) };
+  nn_dims f_dims = { random_range(1, 17), random_range(1, 5), random_range(1, 5), in_dims.c };
+  nn_dims out_dims;
+  nn_conv_params params;
+  nn_context ctx = { scratch, random_range(1, (int32_t)sizeof(scratch)) };
+  const nn_per_channel_quant_params quant = { multiplier, shift };
+  const int with_bias = random_range(0, 3) != 0;
+  nn_status status;
+  nn_status expect;
+
+  f_dims.h = MIN(f_dims.h, in_dims.h);
+  f_dims.w = MIN(f_dims.w, in_dims.w);
+  out_dims.n = in_dims.n;
+  out_dims.h = random_geometry(in_dims.h, f_dims.h, &params.stride.h, &params.padding.h);
+  out_dims.w = random_geometry(in_dims.w, f_dims.w, &params.stride.w, &params.padding.w);
+  out_dims.c = f_dims.n;
+  params.input_offset = random_range(-127, 128);
+  params.output_offset = random_range(-128, 127);
+  params.activation = random_activation();
+
+  random_s8(input, in_dims.n * in_dims.h * in_dims.w * in_dims.c, -128, 127);
+  random_s8(filter, f_dims.n * f_dims.h * f_dims.w * f_dims.c, -127, 127);
+  random_channel_quant(f_dims.n);
+  clear_outputs();
+
+  status = nn_conv2d_s8((random_range(0, 1) != 0) ? &ctx : NULL, &params, &quant, &in_dims, input, &f_dims, filter,
+                        with_bias ? bias : NULL, &out_dims, out);
+  expect = nn_ref_conv2d_s8(&params, &quant, &in_dims, input, &f_dims, filter, with_bias ? bias : NULL, &out_dims,
+                            ref);
+  *size = out_dims.n * out_dims.h * out_dims.w * out_dims.c;
+  return (status == expect) ? NULL : "status";
+}
+
+static const char *check_depthwise(int32_t *size)
+{
+  const int32_t ch_mult = (random_range(0, 2) == 0) ? random_range(2, 3) : 1;
+  nn_dims in_dims = { random_range(1, 2), random_range(1, 12), random_range(1, 12), random_range(1, 21) };
+  nn_dims f_dims = { 1, random_range(1, 5), random_range(1, 5), in_dims.c * ch_mult };
+  nn_dims out_dims;
+  nn_dw_conv_params params;
+  const nn_per_channel_quant_params quant = { multiplier, shift };
+  const int with_bias = random_range(0, 3) != 0;
+  nn_status status;
+  nn_status expect;
+
+  f_dims.h = MIN(f_dims.h, in_dims.h);
+  f_dims.w = MIN(f_dims.w, in_dims.w);
+  out_dims.n = in_dims.n;
+  out_dims.h = random_geometry(in_dims.h, f_dims.h, &params.stride.h, &params.padding.h);
+  out_dims.w = random_geometry(in_dims.w, f_dims.w, &params.stride.w, &params.padding.w);
+  out_dims.c = f_dims.c;
+  params.ch_mult = ch_mult;
+  params.input_offset = random_range(-127, 128);
+  params.output_offset = random_range(-128, 127);
+  params.activation = random_activation();
+
+  random_s8(input, in_dims.n * in_dims.h * in_dims.w * in_dims.c, -128, 127);
+  random_s8(filter, f_dims.h * f_dims.w * f_dims.c, -127, 127);
+  random_channel_quant(f_dims.c);
+  clear_outputs();
+
+  status = nn_depthwise_conv2d_s8(&params, &quant, &in_dims, input, &f_dims, filter, with_bias ? bias : NULL,
+                                  &out_dims, out);
+  expect = nn_ref_depthwise_conv2d_s8(&params, &quant, &in_dims, input, &f_dims, filter, with_bias ? bias : NULL,
+                                      &out_dims, ref);
+  *size = out_dims.n * out_dims.h * out_dims.w * out_dims.c;
+  return (status == expect) ? NULL : "status";
+}
+
+static const char *check_fully_connected(int32_t *size)
+{
+  const int32_t depth = (random_range(0, 1) != 0) ? random_range(1, 17) : random_range(1, 600);
+  const nn_dims in_dims = { random_range(1, 4), 1, 1, depth };
+  const nn_dims f_dims = { depth, 1, 1, random_range(1, 40) };
+  const nn_dims out_dims = { in_dims.n, 1, 1, f_dims.c };
+  const nn_fc_params params =
+  {
+    .input_offset = random_range(-127, 128), .filter_offset = 0, .output_offset = random_range(-128, 127),
+    .activation = random_activation(),
+  };
+  const nn_per_tensor_quant_params quant = { random_range(1 << 30, 0x7FFFFFFF), random_range(-12, 1) };
+  const int with_bias = random_range(0, 3) != 0;
+  nn_status status;
+  nn_status expect;
+
+  random_s8(input, in_dims.n * depth, -128, 127);
+  random_s8(filter, depth * out_dims.c, -127, 127);
+  random_channel_quant(out_dims.c);
+  clear_outputs();
+
+  status = nn_fully_connected_s8(&params, &quant, &in_dims, input, &f_dims, filter, with_bias ? bias : NULL,
+                                 &out_dims, out);
+  expect = nn_ref_fully_connected_s8(&params, &quant, &in_dims, input, &f_dims, filter, with_bias ? bias : NULL,
+                                     &out_dims, ref);
+  *size = out_dims.n * out_dims.c;
+  return (status == expect) ? NULL : "status";
+}
+
+static const char *check_pool(int32_t *size, int max)
+{
+  const nn_dims in_dims = { random_range(1, 2), random_range(1, 14), random_range(1, 14), random_range(1, 37) };
+  nn_dims f_dims = { 1, random_range(1, 4), random_range(1, 4), 1 };
+  nn_dims out_dims;
+  nn_pool_params params;
+  nn_status status;
+  nn_status expect;
+
+  f_dims.h = MIN(f_dims.h, in_dims.h);
+  f_dims.w = MIN(f_dims.w, in_dims.w);
+  out_dims.n = in_dims.n;
+  out_dims.h = random_geometry(in_dims.h, f_dims.h, &params.stride.h, &params.padding.h);
+  out_dims.w = random_geometry(in_dims.w, f_dims.w, &params.stride.w, &params.padding.w);
+  out_dims.c = in_dims.c;
+  params.activation = random_activation();
+
+  random_s8(input, in_dims.n * in_dims.h * in_dims.w * in_dims.c, -128, 127);
+  clear_outputs();
+
+  if (max)
+  {
+    status = nn_max_pool_s8(&params, &in_dims, input, &f_dims, &out_dims, out);
+    expect = nn_ref_max_pool_s8(&params, &in_dims, input, &f_dims, &out_dims, ref);
+  }
+  else
+  {
+    status = nn_avg_pool_s8(&params, &in_dims, input, &f_dims, &out_dims, out);
+    expect = nn_ref_avg_pool_s8(&params, &in_dims, input, &f_dims, &out_dims, ref);
+  }
+  *size = out_dims.n * out_dims.h * out_dims.w * out_dims.c;
+  return (status == expect) ? NULL : "status";
+}
+
+static const char *check_softmax(int32_t *size)
+{
+  const int32_t rows = random_range(1, 8);
+  const int32_t row_size = (random_range(0, 1) != 0) ? random_range(1, 12) : random_range(1, 1000);
+  const nn_softmax_params params =
+  {
+    random_range(1 << 30, 0x7FFFFFFF), random_range(18, 23), random_range(-255, -1)
+  };
+  nn_status status;
+  nn_status expect;
+
+  /* Narrow ranges too, so that many values sit near the row max */
+  if (random_range(0, 1) != 0)
+  {
+    random_s8(input, rows * row_size, -128, 127);
+  }
+  else
+  {
+    random_s8(input, rows * row_size, 100, 127);
+  }
+  clear_outputs();
+
+  status = nn_softmax_s8(&params, input, rows, row_size, out);
+  expect = nn_ref_softmax_s8(&params, input, rows, row_size, ref);
+  *size = rows * row_size;
+  return (status == expect) ? NULL : "status";
+}
+
+static const char *check_add(int32_t *size)
+{
+  const int32_t block = random_range(1, 2000);
+  const nn_add_params params =
+  {
+    .input_1_offset = random_range(-127, 128), .input_1_multiplier = random_range(1 << 30, 0x7FFFFFFF),
+    .input_1_shift = random_range(-3, 0),
+    .input_2_offset = random_range(-127, 128), .input_2_multiplier = random_range(1 << 30, 0x7FFFFFFF),
+    .input_2_shift = random_range(-3, 0),
+    .left_shift = 20, .output_offset = random_range(-128, 127),
+    .output_multiplier = random_range(1 << 30, 0x7FFFFFFF), .output_shift = random_range(-22, -16),
+    .activation = random_activation(),
+  };
+  nn_status status;
+  nn_status expect;
+
+  random_s8(input, block, -128, 127);
+  random_s8(input_2, block, -128, 127);
+  clear_outputs();
+
+  status = nn_add_s8(&params, input, input_2, block, out);
+  expect = nn_ref_add_s8(&params, input, input_2, block, ref);
+  *size = block;
+  return (status == expect) ? NULL : "status";
+}
+
+int main(int argc, char **argv)
+{
+  static const char * const names[] = { "conv2d", "depthwise", "fully_connected", "max_pool", "avg_pool", "softmax",
+                                        "add" };
+  const long cases = (argc > 1) ? strtol(argv[1], NULL, 0) : 3000;
+  long counts[7] = { 0 };
+  long t;
+
+  for (t = 0; t < cases; t++)
+  {
+    const int32_t kernel = (int32_t)(t % 7);
+    const char *error = NULL;
+    int32_t size = 0;
+
+    switch (kernel)
+    {
+      case 0:  error = check_conv(&size);             break;
+      case 1:  error = check_depthwise(&size);        break;
+      case 2:  error = check_fully_connected(&size);  break;
+      case 3:  error = check_pool(&size, 1);          break;
+      case 4:  error = check_pool(&size, 0);          break;
+      case 5:  error = check_softmax(&size);          break;
+      default: error = check_add(&size);              break;
+    }
+
+    /* Whole buffers, so writes past the output are caught too */
+    if ((error == NULL) && (memcmp(out, ref, sizeof(out)) != 0))
+    {
+      error = "MISMATCH";
+    }
+    if (error != NULL)
+    {
+      printf("case %ld: %s, %d outputs: %s\n", t, names[kernel], (int)size, error);
+      return 1;
+    }
+    counts[kernel]++;
+  }
+
+  for (t = 0; t < 7; t++)
+  {
+    printf("  %-16s %ld cases\n", names[t], counts[t]);
+  }
+  printf("%ld cases bit-exact\n", cases);
+  return 0;
+}
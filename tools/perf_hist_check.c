@@ -0,0 +1,202 @@
+/*
+ * Host check of the cycle histogram (application/modules/perf, perf_hist.c).
+ *
+ * Samples on every bucket edge, just below Base and just past the last
+ * bucket must land where the documented layout says; Count, Min, Max and
+ * Mean must match the samples, UINT32_MAX included. PERF_Hist_Percentile() is compared, for
+ * every percent, with the sorted samples of random sets that spill over
+ * both ends: the sample of rank ceil(n * percent / 100) gives Min below
+ * Base, the upper edge of its bucket inside the range and Max past it.
+ * Exits non-zero on the first mismatch.
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -o perf_hist_check tools/perf_hist_check.c \
+ *      application/modules/perf/src/perf_hist.c -Iapplication/modules/perf/src
+ *
+ * Usage: perf_hist_check [sets]   (default 2000)
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "perf_hist.h"
+
+#define MAX_SAMPLES   512U
+
+static uint32_t seed = 1U;
+
+static uint32_t random_u32(void)
+{
+  seed = seed * 1664525U + 1013904223U;
+  return seed;
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+  const uint32_t x = *(const uint32_t *)a;
+  const uint32_t y = *(const uint32_t *)b;
+
+  return (x > y) - (x < y);
+}
+
+static int expect(const char *what, uint32_t got, uint32_t want)
+{
+  if (got != want)
+  {
+    printf("%s: %lu, expected %lu\n", what, (unsigned long)got, (unsigned long)want);
+    return 1;
+  }
+  return 0;
+}
+
+/* One sample per edge: where it lands and what the counters say */
+static int check_buckets(uint32_t base, uint32_t width)
+{
+  PERF_HistTypeDef hist;
+  const uint32_t end = base + PERF_HIST_BUCKETS * width;
+  uint64_t sum = (uint64_t)end + UINT32_MAX;
+  uint32_t i;
+
+  PERF_Hist_Init(&hist, base, width);
+  if ((expect("empty count", hist.Count, 0U) != 0) || (expect("empty mean", PERF_Hist_Mean(&hist), 0U) != 0) ||
+      (expect("empty p50", PERF_Hist_Percentile(&hist, 50U), 0U) != 0))
+  {
+    return 1;
+  }
+
+  for (i = 0U; i < PERF_HIST_BUCKETS; i++)
+  {
+    PERF_Hist_Add(&hist, base + i * width);
+    PERF_Hist_Add(&hist, base + (i + 1U) * width - 1U);
+    sum += 2U * (uint64_t)(base + i * width) + width - 1U;
+    if (expect("bucket edges", hist.Bucket[i], 2U) != 0)
+    {
+      printf("  base %lu width %lu bucket %lu\n", (unsigned long)base, (unsigned long)width, (unsigned long)i);
+      return 1;
+    }
+  }
+  PERF_Hist_Add(&hist, end);
+  PERF_Hist_Add(&hist, UINT32_MAX);
+  if (base != 0U)
+  {
+    PERF_Hist_Add(&hist, base - 1U);
+    PERF_Hist_Add(&hist, 0U);
+    sum += base - 1U;
+  }
+
+  if ((expect("overflow", hist.Overflow, 2U) != 0) ||
+      (expect("underflow", hist.Underflow, (base != 0U) ? 2U : 0U) != 0) ||
+      (expect("count", hist.Count, 2U * PERF_HIST_BUCKETS + ((base != 0U) ? 4U : 2U)) != 0) ||
+      (expect("min", hist.Min, 0U) != 0) ||
+      (expect("max", hist.Max, UINT32_MAX) != 0) ||
+      (expect("mean", PERF_Hist_Mean(&hist), (uint32_t)(sum / hist.Count)) != 0))
+  {
+    printf("  base %lu width %lu\n", (unsigned long)base, (unsigned long)width);
+    return 1;
+  }
+  return 0;
+}
+
+/* Random sets against the sorted samples */
+static int check_percentiles(uint32_t sets)
+{
+  static uint32_t samples[MAX_SAMPLES];
+  uint32_t set;
+
+  for (set = 0U; set < sets; set++)
+  {
+    PERF_HistTypeDef hist;
+    const uint32_t base = random_u32() % 1000U;
+    const uint32_t width = 1U + random_u32() % 16U;
+    const uint32_t span = PERF_HIST_BUCKETS * width;
+    const uint32_t count = 1U + random_u32() % MAX_SAMPLES;
+    uint64_t sum = 0U;
+    uint32_t percent;
+    uint32_t i;
+
+    PERF_Hist_Init(&hist, base, width);
+    for (i = 0U; i < count; i++)
+    {
+      /* Mostly in range, a tenth on either side */
+      const uint32_t r = random_u32();
+
+      samples[i] = ((r & 15U) == 0U) ? (r >> 8) % (base + 1U)
+                 : ((r & 15U) == 1U) ? base + span + (r >> 8) % 5000U
+                 : base + (r >> 8) % span;
+      sum += samples[i];
+      PERF_Hist_Add(&hist, samples[i]);
+    }
+    qsort(samples, count, sizeof(samples[0]), compare_u32);
+
+    if ((expect("count", hist.Count, count) != 0) || (expect("min", hist.Min, samples[0]) != 0) ||
+        (expect("max", hist.Max, samples[count - 1U]) != 0) ||
+        (expect("mean", PERF_Hist_Mean(&hist), (uint32_t)(sum / count)) != 0))
+    {
+      printf("  set %lu\n", (unsigned long)set);
+      return 1;
+    }
+
+    for (percent = 0U; percent <= 100U; percent++)
+    {
+      const uint32_t rank = (uint32_t)(((uint64_t)count * percent + 99U) / 100U);
+      const uint32_t sample = samples[(rank == 0U) ? 0U : (rank - 1U)];
+      uint32_t want;
+
+      if ((rank == 0U) || (sample < base))
+      {
+        want = samples[0];
+      }
+      else if (sample >= base + span)
+      {
+        want = samples[count - 1U];
+      }
+      else
+      {
+        want = base + ((sample - base) / width + 1U) * width - 1U;
+      }
+      if (expect("percentile", PERF_Hist_Percentile(&hist, percent), want) != 0)
+      {
+        printf("  set %lu: p%lu, base %lu width %lu, %lu samples\n", (unsigned long)set, (unsigned long)percent,
+               (unsigned long)base, (unsigned long)width, (unsigned long)count);
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  static const uint32_t ranges[][2] =
+  {
+    { 0U, 1U }, { 0U, 4U }, { 400U, 4U }, { 1U, 7U }, { 100000U, 1000U },
+  };
+  const uint32_t sets = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 2000U;
+  PERF_HistTypeDef hist;
+  uint32_t i;
+
+  /* Width 0 would divide by zero: it becomes 1 */
+  PERF_Hist_Init(&hist, 10U, 0U);
+  PERF_Hist_Add(&hist, 12U);
+  if ((expect("width 0", hist.Width, 1U) != 0) || (expect("width 0 bucket 2", hist.Bucket[2], 1U) != 0))
+  {
+    return 1;
+  }
+
+  for (i = 0U; i < sizeof(ranges) / sizeof(ranges[0]); i++)
+  {
+    if (check_buckets(ranges[i][0], ranges[i][1]) != 0)
+    {
+      return 1;
+    }
+  }
+  if (check_percentiles(sets) != 0)
+  {
+    return 1;
+  }
+
+  printf("perf_hist: bucket edges, underflow/overflow, %lu random sets x 101 percentiles: ok\n",
+         (unsigned long)sets);
+  return 0;
+}
@@ -0,0 +1,577 @@
+/*
+ * Host test of the USB device's descriptors and control transfers
+ * (application/modules/usb_device: usb_desc.c, usb_ctrl.c).
+ *
+ * The simulated host drives endpoint 0 the way the OTG core presents it:
+ * one setup, then data and status packets through usb_ctrl_ops, and it
+ * checks every stage against the USB 2.0 rules (chapter 8.5.3 and 9): no
+ * packet over 64 bytes, no more data than wLength, a zero-length packet
+ * after a full last packet of a short reply, status in the other direction.
+ *
+ *  - the descriptors are walked and cross-checked: lengths, wTotalLength,
+ *    interfaces and endpoints, the IAD, the BOS and the MS OS 2.0 set;
+ *  - an enumeration as Windows and Linux run it, then the CDC requests,
+ *    endpoint halts, reconfiguration and bus reset;
+ *  - requests the device must refuse, a setup that cuts a data stage short;
+ *  - random setup packets, after which the device must still enumerate.
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -o usb_ctrl_sim tools/usb_ctrl_sim.c application/modules/usb_device/src/usb_ctrl.c \
+ *      application/modules/usb_device/src/usb_desc.c -Iapplication/modules/usb_device/src
+ *
+ * Usage: usb_ctrl_sim [random_setups]   (default: 200000)
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "usb_ctrl.h"
+
+typedef struct
+{
+  /* Endpoint 0 as the core holds it */
+  uint8_t        in_packet[USB_FS_PACKET_SIZE];
+  uint32_t       in_size;
+  uint32_t       in_pending;
+  uint8_t       *out_target;
+  uint32_t       out_size;
+  uint32_t       out_armed;
+  uint32_t       stalled;
+  uint32_t       violation;   /*!< A packet the core could not have sent */
+
+  uint8_t        address;
+  uint8_t        config;
+  uint32_t       configures;
+  uint8_t        halted[16][2];
+  uint32_t       line_changes;
+  usb_cdc_line_coding coding;
+  uint16_t       line_state;
+} sim_device;
+
+typedef enum
+{
+  SIM_OK = 0,
+  SIM_STALL,
+  SIM_PROTOCOL   /*!< The device broke the control transfer rules */
+} sim_result;
+
+static sim_device sim;
+static usb_ctrl   ctrl;
+static uint32_t   seed = 12345U;
+static uint32_t   zlps;
+
+static uint32_t sim_random(uint32_t range)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed % range;
+}
+
+static void sim_send(void *context, const uint8_t *data, uint32_t size)
+{
+  (void)context;
+  if ((sim.in_pending != 0U) || (size > USB_FS_PACKET_SIZE) || ((size != 0U) && (data == NULL)))
+  {
+    sim.violation++;
+    return;
+  }
+  if (size != 0U)
+  {
+    memcpy(sim.in_packet, data, size);
+  }
+  sim.in_size = size;
+  sim.in_pending = 1U;
+}
+
+static void sim_receive(void *context, uint8_t *data, uint32_t size)
+{
+  (void)context;
+  if ((sim.out_armed != 0U) || (size > USB_FS_PACKET_SIZE) || ((size != 0U) && (data == NULL)))
+  {
+    sim.violation++;
+    return;
+  }
+  sim.out_target = data;
+  sim.out_size = size;
+  sim.out_armed = 1U;
+}
+
+static void sim_stall(void *context)
+{
+  (void)context;
+  sim.stalled = 1U;
+}
+
+static void sim_set_address(void *context, uint8_t address)
+{
+  (void)context;
+  sim.address = address;
+}
+
+static void sim_configure(void *context, uint8_t config)
+{
+  (void)context;
+  sim.config = config;
+  sim.configures++;
+  memset(sim.halted, 0, sizeof(sim.halted));
+}
+
+static void sim_set_halt(void *context, uint8_t endpoint, uint8_t halt)
+{
+  (void)context;
+  sim.halted[endpoint & 0x0FU][endpoint >> 7] = halt;
+}
+
+static uint32_t sim_halted(void *context, uint8_t endpoint)
+{
+  (void)context;
+  return sim.halted[endpoint & 0x0FU][endpoint >> 7];
+}
+
+static void sim_line_changed(void *context, const usb_cdc_line_coding *coding, uint16_t line_state)
+{
+  (void)context;
+  sim.coding = *coding;
+  sim.line_state = line_state;
+  sim.line_changes++;
+}
+
+static const usb_ctrl_ops sim_ops =
+{
+  sim_send, sim_receive, sim_stall, sim_set_address, sim_configure, sim_set_halt, sim_halted,
+  sim_line_changed, NULL
+};
+
+static void fail(const char *what)
+{
+  printf("FAIL: %s\n", what);
+  exit(1);
+}
+
+static void expect(int condition, const char *what)
+{
+  if (!condition)
+  {
+    fail(what);
+  }
+}
+
+/* A new setup clears the stall and whatever endpoint 0 held, as on the core */
+static void sim_setup(uint32_t type, uint32_t request, uint32_t value, uint32_t index, uint32_t length)
+{
+  uint8_t packet[8];
+
+  packet[0] = (uint8_t)type;
+  packet[1] = (uint8_t)request;
+  packet[2] = (uint8_t)value;
+  packet[3] = (uint8_t)(value >> 8);
+  packet[4] = (uint8_t)index;
+  packet[5] = (uint8_t)(index >> 8);
+  packet[6] = (uint8_t)length;
+  packet[7] = (uint8_t)(length >> 8);
+  sim.stalled = 0U;
+  sim.in_pending = 0U;
+  sim.out_armed = 0U;
+  usb_ctrl_setup(&ctrl, packet);
+}
+
+/**
+  * @brief  One control transfer from the host's side.
+  * @param  data    Data stage: filled for IN, sent for OUT.
+  * @param  actual  Bytes of an IN data stage received.
+  */
+static sim_result sim_control(uint32_t type, uint32_t request, uint32_t value, uint32_t index, uint32_t length,
+                              uint8_t *data, uint32_t *actual)
+{
+  uint32_t done = 0U;
+  uint32_t packet;
+
+  sim_setup(type, request, value, index, length);
+  if (sim.violation != 0U)
+  {
+    return SIM_PROTOCOL;
+  }
+
+  if (((type & USB_REQ_DIR_IN) != 0U) && (length != 0U))
+  {
+    /* IN tokens until a short packet or wLength bytes */
+    for (;;)
+    {
+      if (sim.stalled != 0U)
+      {
+        return (done == 0U) ? SIM_STALL : SIM_PROTOCOL;
+      }
+      if ((sim.in_pending == 0U) || (done + sim.in_size > length))
+      {
+        return SIM_PROTOCOL;
+      }
+      packet = sim.in_size;
+      memcpy(data + done, sim.in_packet, packet);
+      done += packet;
+      sim.in_pending = 0U;
+      zlps += (packet == 0U) ? 1U : 0U;
+      usb_ctrl_in_done(&ctrl);
+      if ((packet < USB_FS_PACKET_SIZE) || (done == length))
+      {
+        break;
+      }
+    }
+    *actual = done;
+
+    /* Status: zero-length OUT */
+    if ((sim.out_armed == 0U) || (sim.in_pending != 0U))
+    {
+      return SIM_PROTOCOL;
+    }
+    sim.out_armed = 0U;
+    usb_ctrl_out_done(&ctrl, 0U);
+  }
+  else
+  {
+    while (done < length)
+    {
+      uint32_t size = (length - done < USB_FS_PACKET_SIZE) ? (length - done) : USB_FS_PACKET_SIZE;
+
+      if (sim.stalled != 0U)
+      {
+        return (done == 0U) ? SIM_STALL : SIM_PROTOCOL;
+      }
+      if ((sim.out_armed == 0U) || (sim.out_size < size))
+      {
+        return SIM_PROTOCOL;
+      }
+      memcpy(sim.out_target, data + done, size);
+      sim.out_armed = 0U;
+      done += size;
+      usb_ctrl_out_done(&ctrl, size);
+    }
+
+    /* Status: zero-length IN */
+    if (sim.stalled != 0U)
+    {
+      return SIM_STALL;
+    }
+    if ((sim.in_pending == 0U) || (sim.in_size != 0U) || (sim.out_armed != 0U))
+    {
+      return SIM_PROTOCOL;
+    }
+    sim.in_pending = 0U;
+    usb_ctrl_in_done(&ctrl);
+  }
+
+  return ((sim.violation == 0U) && (ctrl.stage == USB_CTRL_IDLE)) ? SIM_OK : SIM_PROTOCOL;
+}
+
+static uint32_t get_descriptor(uint32_t type, uint32_t index, uint32_t length, uint8_t *data)
+{
+  uint32_t actual = 0U;
+
+  expect(sim_control(0x80U, USB_REQ_GET_DESCRIPTOR, (type << 8) | index, (type == USB_DESC_STRING) ? 0x0409U : 0U,
+                     length, data, &actual) == SIM_OK, "GET_DESCRIPTOR refused");
+  return actual;
+}
+
+static uint32_t rd16(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+/* ------------------------------------------------------------------------ */
+
+static void check_config(const uint8_t *config, uint32_t size)
+{
+  uint32_t offset = 0U;
+  uint32_t interfaces = 0U;
+  uint32_t endpoints = 0U;
+  uint32_t expected = 0U;
+  uint32_t seen = 0U;
+  uint32_t iad = 0U;
+
+  expect((size >= 9U) && (config[0] == 9U) && (config[1] == USB_DESC_CONFIGURATION), "configuration header");
+  expect(rd16(&config[2]) == size, "wTotalLength");
+  while (offset < size)
+  {
+    const uint8_t *d = &config[offset];
+
+    expect((d[0] >= 2U) && (offset + d[0] <= size), "descriptor runs past wTotalLength");
+    switch (d[1])
+    {
+      case USB_DESC_INTERFACE:
+        expect(d[0] == 9U, "interface length");
+        expect(endpoints == expected, "interface endpoint count");
+        expect(d[2] == interfaces, "interfaces numbered in order");
+        interfaces++;
+        endpoints = 0U;
+        expected = d[4];
+        break;
+
+      case USB_DESC_ENDPOINT:
+      {
+        uint32_t bit = ((d[2] & 0x0FU) * 2U) + (d[2] >> 7);
+
+        expect((d[0] == 7U) && (interfaces != 0U), "endpoint outside an interface");
+        expect(((d[2] & 0x70U) == 0U) && ((d[2] & 0x0FU) != 0U), "endpoint address");
+        expect((seen & (1U << bit)) == 0U, "endpoint used twice");
+        seen |= 1U << bit;
+        expect(rd16(&d[4]) <= USB_FS_PACKET_SIZE, "endpoint packet size");
+        expect(((d[3] & 3U) != 2U) || (rd16(&d[4]) == USB_FS_PACKET_SIZE), "bulk packet size");
+        endpoints++;
+        break;
+      }
+
+      case USB_DESC_IAD:
+        expect((d[0] == 8U) && (d[2] == interfaces) && (d[3] == 2U), "IAD must lead the CDC pair");
+        iad++;
+        break;
+
+      case USB_DESC_CS_INTERFACE:
+      case USB_DESC_CONFIGURATION:
+        break;
+
+      default:
+        fail("unexpected descriptor in the configuration");
+    }
+    offset += d[0];
+  }
+  expect(endpoints == expected, "last interface endpoint count");
+  expect(interfaces == config[4], "bNumInterfaces");
+  expect(iad == 1U, "one IAD");
+  expect(seen == ((1U << 2) | (1U << 3) | (1U << 4) | (1U << 5) | (1U << 7)), "endpoint set");
+}
+
+static void check_msos20(const uint8_t *set, uint32_t size)
+{
+  uint32_t offset = 10U;
+
+  expect((size >= 10U) && (rd16(&set[0]) == 10U) && (rd16(&set[2]) == 0U) && (rd16(&set[8]) == size),
+         "MS OS 2.0 set header");
+  expect((rd16(&set[10]) == 8U) && (rd16(&set[12]) == 1U) && (rd16(&set[16]) == size - 10U),
+         "MS OS 2.0 configuration subset");
+  expect((rd16(&set[18]) == 8U) && (rd16(&set[20]) == 2U) && (set[22] == USB_IFACE_VENDOR) &&
+         (rd16(&set[24]) == size - 18U), "MS OS 2.0 function subset");
+  while (offset < size)
+  {
+    expect((rd16(&set[offset]) >= 4U) && (offset + rd16(&set[offset]) <= size), "MS OS 2.0 descriptor length");
+    offset += (rd16(&set[offset + 2U]) <= 2U) ? 8U : rd16(&set[offset]);   /* Headers nest */
+  }
+  expect(offset == size, "MS OS 2.0 descriptors fill the set");
+  expect(memcmp(&set[30], "WINUSB", 6U) == 0, "WinUSB compatible ID");
+}
+
+static void check_descriptors(void)
+{
+  uint8_t data[USB_CTRL_BUFFER_SIZE];
+  uint32_t size;
+  uint32_t msos20;
+  uint32_t i;
+
+  size = get_descriptor(USB_DESC_DEVICE, 0U, 18U, data);
+  expect((size == 18U) && (data[0] == 18U) && (data[1] == USB_DESC_DEVICE), "device descriptor");
+  expect((rd16(&data[2]) >= 0x0201U) && (data[4] == 0xEFU) && (data[7] == USB_FS_PACKET_SIZE), "device class");
+
+  size = get_descriptor(USB_DESC_CONFIGURATION, 0U, 9U, data);
+  expect(size == 9U, "configuration header alone");
+  size = get_descriptor(USB_DESC_CONFIGURATION, 0U, rd16(&data[2]), data);
+  check_config(data, size);
+
+  for (i = 0U; i < USB_STR_COUNT; i++)
+  {
+    size = get_descriptor(USB_DESC_STRING, i, 255U, data);
+    expect((size >= 4U) && (data[0] == size) && ((size % 2U) == 0U) && (data[1] == USB_DESC_STRING),
+           "string descriptor");
+  }
+
+  size = get_descriptor(USB_DESC_BOS, 0U, 5U, data);
+  expect((size == 5U) && (data[1] == USB_DESC_BOS), "BOS header");
+  size = get_descriptor(USB_DESC_BOS, 0U, rd16(&data[2]), data);
+  expect((size == 33U) && (data[5] == 28U) && (data[7] == 0x05U), "BOS platform capability");
+  msos20 = rd16(&data[29]);
+  expect(data[31] == USB_MSOS20_VENDOR_CODE, "BOS vendor code");
+
+  expect(sim_control(0xC0U, USB_MSOS20_VENDOR_CODE, 0U, USB_MSOS20_INDEX, msos20, data, &size) == SIM_OK,
+         "MS OS 2.0 request");
+  expect(size == msos20, "MS OS 2.0 length from the BOS");
+  check_msos20(data, size);
+}
+
+/* Reset, address, descriptors, configuration */
+static void enumerate(void)
+{
+  uint8_t data[USB_CTRL_BUFFER_SIZE];
+  uint32_t size;
+
+  usb_ctrl_reset(&ctrl);
+  size = get_descriptor(USB_DESC_DEVICE, 0U, 64U, data);   /* Windows, before the address */
+  expect(size == 18U, "first device descriptor");
+  usb_ctrl_reset(&ctrl);
+  expect(sim_control(0x00U, USB_REQ_SET_ADDRESS, 23U, 0U, 0U, NULL, NULL) == SIM_OK, "SET_ADDRESS");
+  expect((sim.address == 23U) && (ctrl.state == USB_STATE_ADDRESS), "address");
+  check_descriptors();
+  expect(sim_control(0x00U, USB_REQ_SET_CONFIGURATION, 1U, 0U, 0U, NULL, NULL) == SIM_OK, "SET_CONFIGURATION");
+  expect((sim.config == 1U) && (ctrl.state == USB_STATE_CONFIGURED), "configured");
+  expect((sim_control(0x80U, USB_REQ_GET_CONFIGURATION, 0U, 0U, 1U, data, &size) == SIM_OK) && (size == 1U) &&
+         (data[0] == 1U), "GET_CONFIGURATION");
+}
+
+static void check_cdc(void)
+{
+  static const uint8_t coding[7] = { 0x00, 0x10, 0x0E, 0x00, 0x00, 0x00, 0x08 };   /* 921600 8N1 */
+  uint8_t data[8];
+  uint32_t size;
+
+  expect(sim_control(0x21U, USB_CDC_SET_LINE_CODING, 0U, USB_IFACE_CDC_COMM, 7U, (uint8_t *)coding, NULL) ==
+         SIM_OK, "SET_LINE_CODING");
+  expect((sim.coding.baud == 921600U) && (sim.coding.data_bits == 8U) && (sim.line_changes != 0U),
+         "line coding applied");
+  expect((sim_control(0xA1U, USB_CDC_GET_LINE_CODING, 0U, USB_IFACE_CDC_COMM, 7U, data, &size) == SIM_OK) &&
+         (size == 7U) && (memcmp(data, coding, 7U) == 0), "GET_LINE_CODING");
+  expect(sim_control(0x21U, USB_CDC_SET_CONTROL_LINE_STATE, 3U, USB_IFACE_CDC_COMM, 0U, NULL, NULL) == SIM_OK,
+         "SET_CONTROL_LINE_STATE");
+  expect(sim.line_state == (USB_CDC_LINE_DTR | USB_CDC_LINE_RTS), "DTR and RTS");
+  expect(sim_control(0x21U, USB_CDC_SET_LINE_CODING, 0U, USB_IFACE_CDC_COMM, 8U, data, NULL) == SIM_STALL,
+         "SET_LINE_CODING of 8 bytes");
+  expect(sim_control(0x21U, USB_CDC_SET_LINE_CODING, 0U, USB_IFACE_VENDOR, 7U, (uint8_t *)coding, NULL) ==
+         SIM_STALL, "CDC request to the vendor interface");
+}
+
+static void check_halt(void)
+{
+  uint8_t data[2];
+  uint32_t size;
+
+  expect(sim_control(0x02U, USB_REQ_SET_FEATURE, USB_FEATURE_ENDPOINT_HALT, USB_EP_VENDOR_IN, 0U, NULL, NULL) ==
+         SIM_OK, "SET_FEATURE(ENDPOINT_HALT)");
+  expect(sim.halted[2][1] == 1U, "endpoint halted");
+  expect((sim_control(0x82U, USB_REQ_GET_STATUS, 0U, USB_EP_VENDOR_IN, 2U, data, &size) == SIM_OK) &&
+         (size == 2U) && (data[0] == 1U), "GET_STATUS of a halted endpoint");
+  expect(sim_control(0x02U, USB_REQ_CLEAR_FEATURE, USB_FEATURE_ENDPOINT_HALT, USB_EP_VENDOR_IN, 0U, NULL, NULL) ==
+         SIM_OK, "CLEAR_FEATURE(ENDPOINT_HALT)");
+  expect((sim.halted[2][1] == 0U) &&
+         (sim_control(0x82U, USB_REQ_GET_STATUS, 0U, USB_EP_VENDOR_IN, 2U, data, &size) == SIM_OK) &&
+         (data[0] == 0U), "endpoint released");
+  expect(sim_control(0x02U, USB_REQ_CLEAR_FEATURE, USB_FEATURE_ENDPOINT_HALT, 0x84U, 0U, NULL, NULL) == SIM_STALL,
+         "halt of an endpoint that does not exist");
+  expect(sim_control(0x02U, USB_REQ_CLEAR_FEATURE, USB_FEATURE_ENDPOINT_HALT, 0x00U, 0U, NULL, NULL) == SIM_OK,
+         "halt of endpoint 0");
+}
+
+static void check_refused(void)
+{
+  uint8_t data[USB_CTRL_BUFFER_SIZE];
+  uint32_t size;
+
+  expect(sim_control(0x80U, USB_REQ_GET_DESCRIPTOR, USB_DESC_QUALIFIER << 8, 0U, 10U, data, &size) == SIM_STALL,
+         "device qualifier of a full-speed device");
+  expect(sim_control(0x80U, USB_REQ_GET_DESCRIPTOR, (USB_DESC_STRING << 8) | USB_STR_COUNT, 0x0409U, 255U, data,
+                     &size) == SIM_STALL, "string past the last");
+  expect(sim_control(0x80U, USB_REQ_GET_DESCRIPTOR, (USB_DESC_CONFIGURATION << 8) | 1U, 0U, 255U, data, &size) ==
+         SIM_STALL, "second configuration");
+  expect(sim_control(0x00U, USB_REQ_SET_CONFIGURATION, 2U, 0U, 0U, NULL, NULL) == SIM_STALL, "configuration 2");
+  expect(sim_control(0x00U, USB_REQ_SET_ADDRESS, 9U, 0U, 0U, NULL, NULL) == SIM_STALL, "SET_ADDRESS when configured");
+  expect(sim_control(0x00U, USB_REQ_SET_FEATURE, 1U, 0U, 0U, NULL, NULL) == SIM_STALL, "remote wakeup");
+  expect(sim_control(0x01U, USB_REQ_SET_INTERFACE, 1U, USB_IFACE_VENDOR, 0U, NULL, NULL) == SIM_STALL,
+         "alternate setting");
+  expect(sim_control(0x40U, 0x55U, 0U, 0U, 16U, data, NULL) == SIM_STALL, "vendor data to the device");
+  expect(sim_control(0xC0U, USB_MSOS20_VENDOR_CODE, 0U, 4U, 16U, data, &size) == SIM_STALL,
+         "MS OS 1.0 style request");
+  expect(ctrl.config == 1U, "refused requests left the configuration");
+}
+
+static void check_zlp(void)
+{
+  static const char serial[] = "0123456789ABCDEF0123456789ABCDE";   /* 31: a 64-byte descriptor */
+  uint8_t data[USB_CTRL_BUFFER_SIZE];
+  uint32_t size;
+  uint32_t before;
+
+  ctrl.serial = serial;
+  before = zlps;
+  size = get_descriptor(USB_DESC_STRING, USB_STR_SERIAL, 255U, data);
+  expect((size == 64U) && (zlps == before + 1U), "zero-length packet after a full short reply");
+  size = get_descriptor(USB_DESC_STRING, USB_STR_SERIAL, 64U, data);
+  expect((size == 64U) && (zlps == before + 1U), "no zero-length packet when wLength is met");
+  ctrl.serial = "SIM";
+
+  /* A setup in the middle of a data stage starts over */
+  sim_setup(0x80U, USB_REQ_GET_DESCRIPTOR, USB_DESC_CONFIGURATION << 8, 0U, 255U);
+  expect((sim.in_pending != 0U) && (sim.in_size == USB_FS_PACKET_SIZE), "first packet of the configuration");
+  sim.in_pending = 0U;
+  usb_ctrl_in_done(&ctrl);
+  expect((sim_control(0x80U, USB_REQ_GET_STATUS, 0U, 0U, 2U, data, &size) == SIM_OK) && (size == 2U),
+         "setup after an abandoned data stage");
+}
+
+/* Random setups: the device may refuse them but must keep to the protocol */
+static void check_random(uint32_t count)
+{
+  uint8_t data[65536];
+  uint32_t size;
+  uint32_t stalls = 0U;
+  uint32_t i;
+  sim_result result;
+
+  for (i = 0U; i < count; i++)
+  {
+    uint32_t type = sim_random(256U);
+    uint32_t request = (sim_random(4U) == 0U) ? sim_random(256U) : sim_random(12U);
+    uint32_t value = (sim_random(2U) == 0U) ? sim_random(65536U) : ((sim_random(16U) << 8) | sim_random(8U));
+    uint32_t index = (sim_random(2U) == 0U) ? sim_random(65536U) : sim_random(8U);
+    uint32_t length = (sim_random(2U) == 0U) ? sim_random(65536U) : sim_random(300U);
+
+    if ((type & 0x80U) == 0U)
+    {
+      memset(data, (int)sim_random(256U), (length < sizeof(data)) ? length : sizeof(data));
+    }
+    if ((type == 0x00U) && (request == USB_REQ_SET_ADDRESS))
+    {
+      continue;   /* Would only move the address */
+    }
+    result = sim_control(type, request, value, index, length, data, &size);
+    if (result == SIM_PROTOCOL)
+    {
+      printf("setup %02x %02x %04x %04x %04x: ", (unsigned)type, (unsigned)request, (unsigned)value,
+             (unsigned)index, (unsigned)length);
+      fail("protocol broken");
+    }
+    stalls += (result == SIM_STALL) ? 1U : 0U;
+  }
+  printf("%u random setups, %u refused\n", (unsigned)count, (unsigned)stalls);
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t count = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 200000U;
+  uint8_t data[8];
+  uint32_t size;
+
+  usb_ctrl_init(&ctrl, &sim_ops, "SIM");
+
+  /* Before configuration, class requests are refused */
+  expect(sim_control(0x21U, USB_CDC_SET_CONTROL_LINE_STATE, 1U, USB_IFACE_CDC_COMM, 0U, NULL, NULL) == SIM_STALL,
+         "class request before configuration");
+  enumerate();
+  check_cdc();
+  check_halt();
+  check_refused();
+  check_zlp();
+
+  /* Deconfigure, configure again, reset */
+  expect((sim_control(0x00U, USB_REQ_SET_CONFIGURATION, 0U, 0U, 0U, NULL, NULL) == SIM_OK) && (sim.config == 0U) &&
+         (ctrl.state == USB_STATE_ADDRESS), "SET_CONFIGURATION(0)");
+  expect(sim_control(0x01U, USB_REQ_SET_INTERFACE, 0U, USB_IFACE_VENDOR, 0U, NULL, NULL) == SIM_STALL,
+         "interface request when not configured");
+  expect((sim_control(0x80U, USB_REQ_GET_CONFIGURATION, 0U, 0U, 1U, data, &size) == SIM_OK) && (data[0] == 0U),
+         "GET_CONFIGURATION(0)");
+  usb_ctrl_reset(&ctrl);
+  expect((ctrl.state == USB_STATE_DEFAULT) && (ctrl.config == 0U), "bus reset");
+
+  check_random(count);
+  enumerate();
+
+  printf("%u setups, %u stalls, %u configurations: ok\n", (unsigned)ctrl.setups, (unsigned)ctrl.stalls,
+         (unsigned)sim.configures);
+  return 0;
+}
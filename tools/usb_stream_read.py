@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+"""Read the sample stream from the device's vendor bulk endpoint (usb_stream.h).
+
+Reads the bulk IN endpoint of the vendor interface for a while and walks the
+bytes by their block headers:
+
+  magic u32 "USTR", seq u32, size u32, dropped u32   (little-endian)
+
+followed by size bytes of records. It reports, every second and at the end:
+
+  - throughput: payload bytes received, and the bus bytes including headers;
+  - gaps in the data: blocks missing from seq (lost to a bus reset or a
+    halt) and bytes the device dropped because its ring was full (the
+    dropped field). seq going back means the device itself restarted;
+  - gaps in time: the longest wait between two reads that returned data.
+
+The payload can be saved with --out, as the records exactly as written,
+with nothing from lost blocks or drops. --raw saves the bytes as received.
+--file reads a saved raw stream instead of the device, such as the one
+written by tools/usb_stream_sim.c -o.
+
+The device binds to WinUSB on Windows by itself (MS OS 2.0 descriptors).
+Linux needs read access to the device node, e.g. a udev rule for
+0483:5750. Needs pyusb (libusb backend) for the device.
+
+Usage: usb_stream_read.py [--seconds 10] [--out payload.bin] [--raw raw.bin]
+       usb_stream_read.py --file raw.bin
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+VID = 0x0483
+PID = 0x5750
+INTERFACE = 2
+ENDPOINT = 0x82
+MAGIC = 0x52545355
+HEADER = struct.Struct("<IIII")
+READ_SIZE = 64 * 1024       # Bytes asked per read: 53 ms of data at full speed
+MAX_BLOCK = 1023 * 64       # USB_DEV_MAX_TRANSFER
+
+
+class Stats:
+    def __init__(self):
+        self.blocks = 0
+        self.payload = 0
+        self.wire = 0
+        self.lost_blocks = 0
+        self.dropped = 0
+        self.resyncs = 0
+        self.restarts = 0
+        self.max_gap = 0.0
+
+    def line(self, seconds):
+        rate = self.payload / seconds / 1000.0 if seconds > 0 else 0.0
+        wire = self.wire / seconds / 1000.0 if seconds > 0 else 0.0
+        return ("%8.1f kB/s payload, %8.1f kB/s on the bus, %d blocks, %d lost, %d bytes dropped, "
+                "%d resyncs, %d restarts, max gap %.1f ms"
+                % (rate, wire, self.blocks, self.lost_blocks, self.dropped, self.resyncs, self.restarts,
+                   self.max_gap * 1000.0))
+
+
+class Parser:
+    """Walks received bytes by block headers; bytes of a block cut short wait for the rest."""
+
+    def __init__(self, stats, out=None):
+        self.stats = stats
+        self.out = out
+        self.pending = bytearray()
+        self.next_seq = None
+
+    def feed(self, data):
+        self.pending += data
+        self.stats.wire += len(data)
+        offset = 0
+        while len(self.pending) - offset >= HEADER.size:
+            magic, seq, size, dropped = HEADER.unpack_from(self.pending, offset)
+            if magic != MAGIC or size == 0 or size > MAX_BLOCK - HEADER.size:
+                # Not on a header: a block cut short by a reset, or a stream joined mid-block
+                found = self.pending.find(struct.pack("<I", MAGIC), offset + 1)
+                self.stats.resyncs += 1
+                offset = found if found >= 0 else max(offset, len(self.pending) - 3)
+                continue
+            if len(self.pending) - offset < HEADER.size + size:
+                break
+            if self.next_seq is not None and seq > self.next_seq:
+                self.stats.lost_blocks += seq - self.next_seq
+            elif self.next_seq is not None and seq < self.next_seq:
+                self.stats.restarts += 1   # The device started over: seq counts from 0 again
+            self.next_seq = (seq + 1) & 0xFFFFFFFF
+            self.stats.blocks += 1
+            self.stats.payload += size
+            self.stats.dropped += dropped
+            if self.out is not None:
+                self.out.write(self.pending[offset + HEADER.size:offset + HEADER.size + size])
+            offset += HEADER.size + size
+        del self.pending[:offset]
+
+    def reopen(self):
+        """The device was opened again: a block in progress will not be completed. seq goes on
+        across a bus reset, so blocks lost to it still show."""
+        self.pending.clear()
+
+
+def open_device(vid, pid):
+    try:
+        import usb.core
+        import usb.util
+    except ImportError:
+        sys.exit("usb_stream_read: needs pyusb (pip install pyusb)")
+
+    dev = usb.core.find(idVendor=vid, idProduct=pid)
+    if dev is None:
+        sys.exit("usb_stream_read: no device %04x:%04x" % (vid, pid))
+    try:
+        if dev.is_kernel_driver_active(INTERFACE):
+            dev.detach_kernel_driver(INTERFACE)
+    except (NotImplementedError, usb.core.USBError):
+        pass
+    usb.util.claim_interface(dev, INTERFACE)
+    return dev
+
+
+def read_device(args, parser, stats):
+    import usb.core
+
+    dev = open_device(args.vid, args.pid)
+    start = time.monotonic()
+    last_data = start
+    last_report = start
+    raw = open(args.raw, "wb") if args.raw else None
+    try:
+        while True:
+            now = time.monotonic()
+            if now - start >= args.seconds:
+                break
+            try:
+                data = dev.read(ENDPOINT, READ_SIZE, timeout=1000)
+            except usb.core.USBTimeoutError:
+                data = b""
+            except usb.core.USBError as error:
+                print("usb_stream_read: %s, opening again" % error, file=sys.stderr)
+                time.sleep(1.0)
+                dev = open_device(args.vid, args.pid)
+                parser.reopen()
+                continue
+            now = time.monotonic()
+            if data:
+                stats.max_gap = max(stats.max_gap, now - last_data)
+                last_data = now
+                if raw is not None:
+                    raw.write(data)
+                parser.feed(bytes(data))
+            if not args.quiet and now - last_report >= 1.0:
+                print("%6.1f s %s" % (now - start, stats.line(now - start)))
+                last_report = now
+    finally:
+        if raw is not None:
+            raw.close()
+    return time.monotonic() - start
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("--seconds", type=float, default=10.0)
+    ap.add_argument("--out", help="save the payload")
+    ap.add_argument("--raw", help="save the bytes as received")
+    ap.add_argument("--file", help="parse a saved raw stream instead of the device")
+    ap.add_argument("--vid", type=lambda v: int(v, 0), default=VID)
+    ap.add_argument("--pid", type=lambda v: int(v, 0), default=PID)
+    ap.add_argument("--quiet", action="store_true", help="only the summary")
+    args = ap.parse_args()
+
+    stats = Stats()
+    out = open(args.out, "wb") if args.out else None
+    parser = Parser(stats, out)
+    try:
+        if args.file:
+            with open(args.file, "rb") as f:
+                while True:
+                    data = f.read(READ_SIZE)
+                    if not data:
+                        break
+                    parser.feed(data)
+            seconds = 0.0
+        else:
+            seconds = read_device(args, parser, stats)
+    finally:
+        if out is not None:
+            out.close()
+
+    print("total %s" % stats.line(seconds))
+    if parser.pending:
+        print("%d bytes of an unfinished block at the end" % len(parser.pending))
+    return 0 if stats.lost_blocks == 0 and stats.dropped == 0 and stats.resyncs == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,615 @@
+/*
+ * Host test of the USB sample stream's block ring
+ * (application/modules/usb_device/src/usb_stream.c).
+ *
+ * The simulated bulk IN endpoint behaves as usb_device.c drives the OTG
+ * core: it queues two transfers, and in each 1 ms frame it sends up to 19
+ * packets of 64 bytes, the most a full-speed bulk endpoint gets on an
+ * otherwise idle bus. A transfer is done with its last packet; the
+ * interrupt then reports it (usb_stream_sent()) and the next one carries on
+ * within the same frame. A producer writes numbered records of random size
+ * at a set rate. The host now and then stops reading for a while, and the
+ * bus now and then resets, which fails the queued transfers.
+ *
+ * The host side walks the received bytes by their block headers and checks
+ * the following:
+ *
+ *  - Every record arrives whole and in order, and its contents are intact.
+ *    A block changed while the endpoint owned it would break this.
+ *  - Each record that is missing was dropped or was in a block lost to a
+ *    reset. Lost blocks show as gaps in seq, as many as stats.failed.
+ *  - A block's dropped field is exactly the size of the records dropped
+ *    since the block before it.
+ *  - With the host reading and data waiting, no frame goes out short.
+ *
+ * It prints the link throughput, the largest gap between frames that carry
+ * data, and the worst latency of a record, under a light load and under an
+ * overload with either policy. With -o it also saves the received bytes of
+ * the last run, for tools/usb_stream_read.py --file.
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -o usb_stream_sim tools/usb_stream_sim.c application/modules/usb_device/src/usb_stream.c \
+ *      -Iapplication/modules/usb_device/src
+ *
+ * Usage: usb_stream_sim [-o stream.bin] [frames]   (default: 200000 frames per run)
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "usb_stream.h"
+
+#define SIM_PACKET          64U
+#define SIM_FRAME_PACKETS   19U
+#define SIM_BLOCK_SIZE      4096U
+#define SIM_BLOCKS          8U
+#define SIM_RECORD_MIN      8U     /* Index and size */
+#define SIM_RECORD_MAX      512U
+
+typedef struct
+{
+  const uint8_t *data;
+  uint32_t       size;
+  uint32_t       offset;
+  uint8_t        copy[SIM_BLOCK_SIZE];   /* As given, to catch writes into a queued block */
+} sim_transfer;
+
+typedef struct
+{
+  uint32_t size;
+  uint32_t written;    /* Frame it was taken in */
+  uint8_t  fate;
+} sim_record;
+
+enum { SIM_WAITING = 0, SIM_TAKEN, SIM_DROPPED };
+
+typedef struct
+{
+  usb_stream   stream;
+  uint8_t      blocks[SIM_BLOCKS * SIM_BLOCK_SIZE] __attribute__((aligned(4)));
+
+  /* The endpoint and its two-deep queue */
+  sim_transfer queue[2];
+  uint32_t     head;
+  uint32_t     count;
+  uint32_t     configured;
+  uint32_t     locked;
+
+  /* The host: received bytes, walked as they come */
+  uint8_t     *wire;
+  uint64_t     wire_size;
+  uint64_t     wire_cap;
+  uint64_t     parsed;
+  uint32_t     next_seq;
+  uint32_t     seq_gaps;
+  uint32_t     received;      /* Blocks */
+  uint32_t     next_record;   /* First record not yet accounted for */
+  uint32_t     frame;
+
+  sim_record  *records;
+  uint32_t     record_count;
+  uint32_t     record_cap;
+  uint32_t     max_latency;
+  int32_t      credit;        /* Bytes the producer may still write */
+} sim;
+
+static uint32_t rng_state = 0x2545F491U;
+
+static uint32_t rng(void)
+{
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+
+static void fail(const char *what, uint32_t frame)
+{
+  fprintf(stderr, "usb_stream_sim: FAIL at frame %u: %s\n", (unsigned)frame, what);
+  exit(1);
+}
+
+static uint8_t record_byte(uint32_t index, uint32_t i)
+{
+  return (uint8_t)((index * 131U) + (i * 7U) + (index >> 8));
+}
+
+/* ------------------------------------------------------------------------ */
+/* usb_stream_ops                                                            */
+
+static int sim_transmit(void *context, const uint8_t *data, uint32_t size)
+{
+  sim *s = (sim *)context;
+  sim_transfer *t;
+
+  if (s->locked == 0U)
+  {
+    fail("transmit outside the lock", s->frame);
+  }
+  if ((s->configured == 0U) || (s->count == 2U))
+  {
+    return -1;
+  }
+  if ((size > SIM_BLOCK_SIZE) || (((uintptr_t)data & 3U) != 0U))
+  {
+    fail("transfer not aligned or too large", s->frame);
+  }
+  t = &s->queue[(s->head + s->count) % 2U];
+  t->data = data;
+  t->size = size;
+  t->offset = 0U;
+  memcpy(t->copy, data, size);
+  s->count++;
+  return 0;
+}
+
+static uint32_t sim_lock(void *context)
+{
+  sim *s = (sim *)context;
+  uint32_t state = s->locked;
+
+  s->locked = 1U;
+  return state;
+}
+
+static void sim_unlock(void *context, uint32_t state)
+{
+  ((sim *)context)->locked = state;
+}
+
+static const usb_stream_ops sim_ops_template =
+{
+  .transmit = sim_transmit,
+  .lock = sim_lock,
+  .unlock = sim_unlock,
+  .context = NULL,
+};
+
+/* ------------------------------------------------------------------------ */
+/* Host side                                                                 */
+
+static uint32_t get32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* Records before index that were dropped, back to the last one accounted for */
+static uint32_t account_dropped(sim *s, uint32_t index, uint32_t lost_blocks)
+{
+  uint32_t dropped = 0U;
+
+  for (; s->next_record < index; s->next_record++)
+  {
+    const sim_record *r = &s->records[s->next_record];
+
+    if (r->fate == SIM_DROPPED)
+    {
+      dropped += r->size;
+    }
+    else if (lost_blocks == 0U)
+    {
+      fail("record missing with no block lost", s->frame);
+    }
+  }
+  return dropped;
+}
+
+static void host_parse(sim *s)
+{
+  while ((s->wire_size - s->parsed) >= USB_STREAM_HEADER_SIZE)
+  {
+    const uint8_t *h = &s->wire[s->parsed];
+    uint32_t seq = get32(h + 4);
+    uint32_t size = get32(h + 8);
+    uint32_t dropped = get32(h + 12);
+    uint32_t lost;
+    uint32_t before;
+    uint32_t offset;
+
+    if (get32(h) != USB_STREAM_MAGIC)
+    {
+      fail("bad block magic", s->frame);
+    }
+    if ((size == 0U) || (size > (SIM_BLOCK_SIZE - USB_STREAM_HEADER_SIZE)))
+    {
+      fail("bad block size", s->frame);
+    }
+    if ((s->wire_size - s->parsed) < (USB_STREAM_HEADER_SIZE + size))
+    {
+      return;
+    }
+    if (seq < s->next_seq)
+    {
+      fail("seq went back", s->frame);
+    }
+    lost = seq - s->next_seq;
+    s->seq_gaps += lost;
+    s->next_seq = seq + 1U;
+
+    before = 1U;
+    for (offset = 0U; offset < size; )
+    {
+      const uint8_t *r = &h[USB_STREAM_HEADER_SIZE + offset];
+      uint32_t index = get32(r);
+      uint32_t rsize = get32(r + 4);
+      uint32_t i;
+      uint32_t drops;
+
+      if ((index >= s->record_count) || (index < s->next_record) ||
+          (rsize != s->records[index].size) || ((offset + rsize) > size))
+      {
+        fail("record out of order or torn", s->frame);
+      }
+      if (s->records[index].fate != SIM_TAKEN)
+      {
+        fail("record received that was not taken", s->frame);
+      }
+      for (i = 8U; i < rsize; i++)
+      {
+        if (r[i] != record_byte(index, i))
+        {
+          fail("record contents changed", s->frame);
+        }
+      }
+
+      drops = account_dropped(s, index, before ? lost : 0U);
+      if (before && (lost == 0U) && (drops != dropped))
+      {
+        fail("dropped field does not match", s->frame);
+      }
+      if (!before && (drops != 0U))
+      {
+        fail("records dropped inside a block", s->frame);
+      }
+      if ((s->frame - s->records[index].written) > s->max_latency)
+      {
+        s->max_latency = s->frame - s->records[index].written;
+      }
+      s->next_record = index + 1U;
+      before = 0U;
+      offset += rsize;
+    }
+    s->parsed += USB_STREAM_HEADER_SIZE + size;
+    s->received++;
+  }
+}
+
+static void host_receive(sim *s, const uint8_t *data, uint32_t size)
+{
+  if ((s->wire_size + size) > s->wire_cap)
+  {
+    s->wire_cap = (s->wire_cap * 2U) + size;
+    s->wire = realloc(s->wire, (size_t)s->wire_cap);
+    if (s->wire == NULL)
+    {
+      fail("out of memory", s->frame);
+    }
+  }
+  memcpy(&s->wire[s->wire_size], data, size);
+  s->wire_size += size;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Endpoint and interrupt                                                    */
+
+/* One frame of the host reading; returns the packets sent */
+static uint32_t endpoint_frame(sim *s)
+{
+  uint32_t packets = 0U;
+
+  while ((packets < SIM_FRAME_PACKETS) && (s->count != 0U))
+  {
+    sim_transfer *t = &s->queue[s->head];
+    uint32_t n = t->size - t->offset;
+
+    if (n > SIM_PACKET)
+    {
+      n = SIM_PACKET;
+    }
+    if (memcmp(&t->data[t->offset], &t->copy[t->offset], n) != 0)
+    {
+      fail("queued block written", s->frame);
+    }
+    host_receive(s, &t->data[t->offset], n);
+    t->offset += n;
+    packets++;
+
+    if (t->offset == t->size)
+    {
+      /* The interrupt: the core moves on to the next queued transfer, then the callback */
+      s->head = (s->head + 1U) % 2U;
+      s->count--;
+      usb_stream_sent(&s->stream, 1U);
+      if (s->locked != 0U)
+      {
+        fail("lock left held", s->frame);
+      }
+    }
+  }
+  return packets;
+}
+
+/* The host re-opens the device after it enumerates again: a block cut short by the reset is discarded */
+static void bus_reset(sim *s)
+{
+  s->configured = 0U;
+  s->wire_size = s->parsed;
+  while (s->count != 0U)
+  {
+    s->head = (s->head + 1U) % 2U;
+    s->count--;
+    usb_stream_sent(&s->stream, 0U);
+  }
+}
+
+/* ------------------------------------------------------------------------ */
+/* Producer                                                                  */
+
+static sim_record *new_record(sim *s)
+{
+  sim_record *r;
+
+  if (s->record_count == s->record_cap)
+  {
+    s->record_cap = (s->record_cap * 2U) + 1024U;
+    s->records = realloc(s->records, s->record_cap * sizeof(*s->records));
+    if (s->records == NULL)
+    {
+      fail("out of memory", s->frame);
+    }
+  }
+  r = &s->records[s->record_count];
+  r->size = SIM_RECORD_MIN + (rng() % (SIM_RECORD_MAX - SIM_RECORD_MIN + 1U));
+  r->written = 0U;
+  r->fate = SIM_WAITING;
+  return r;
+}
+
+/* Writes rate bytes a frame on average; a record refused with backpressure is tried again next frame */
+static void produce(sim *s, uint32_t rate)
+{
+  static uint8_t data[SIM_RECORD_MAX];
+  uint32_t i;
+
+  s->credit += (int32_t)rate;
+  while (s->credit > 0)
+  {
+    sim_record *r = (s->record_count != 0U) && (s->records[s->record_count - 1U].fate == SIM_WAITING)
+                    ? &s->records[s->record_count - 1U] : new_record(s);
+    uint32_t index = (uint32_t)(r - s->records);
+    usb_stream_status status;
+
+    if (r == &s->records[s->record_count])
+    {
+      s->record_count++;
+    }
+    data[0] = (uint8_t)index;
+    data[1] = (uint8_t)(index >> 8);
+    data[2] = (uint8_t)(index >> 16);
+    data[3] = (uint8_t)(index >> 24);
+    data[4] = (uint8_t)r->size;
+    data[5] = (uint8_t)(r->size >> 8);
+    data[6] = 0U;
+    data[7] = 0U;
+    for (i = 8U; i < r->size; i++)
+    {
+      data[i] = record_byte(index, i);
+    }
+
+    status = usb_stream_write(&s->stream, data, r->size);
+    if (s->locked != 0U)
+    {
+      fail("lock left held", s->frame);
+    }
+    if (status == USB_STREAM_OK)
+    {
+      r->fate = SIM_TAKEN;
+      r->written = s->frame;
+    }
+    else if (status != USB_STREAM_FULL)
+    {
+      fail("write refused", s->frame);
+    }
+    else if (s->stream.policy == USB_STREAM_DROP)
+    {
+      r->fate = SIM_DROPPED;
+    }
+    else
+    {
+      s->credit = 0;
+      return;   /* Backpressure: keep it for the next frame */
+    }
+    s->credit -= (int32_t)r->size;
+  }
+}
+
+/* ------------------------------------------------------------------------ */
+
+typedef struct
+{
+  const char       *name;
+  uint32_t          rate;        /* Bytes offered per frame */
+  usb_stream_policy policy;
+  uint32_t          disturb;     /* Host stalls and bus resets */
+} sim_case;
+
+static void run(const sim_case *c, uint32_t frames, const char *out)
+{
+  static sim s;
+  usb_stream_ops ops = sim_ops_template;
+  usb_stream_stats stats;
+  uint32_t busy_frames = 0U;
+  uint32_t stall = 0U;
+  uint32_t off = 0U;
+  uint32_t resets = 0U;
+  uint32_t last_data = 0U;
+  uint32_t max_gap = 0U;
+  uint32_t drain;
+  uint32_t packets;
+  uint32_t i;
+
+  free(s.wire);
+  free(s.records);
+  memset(&s, 0, sizeof(s));
+  ops.context = &s;
+  if (usb_stream_init(&s.stream, &ops, s.blocks, SIM_BLOCK_SIZE, SIM_BLOCKS, c->policy) != USB_STREAM_OK)
+  {
+    fail("init", 0U);
+  }
+  s.configured = 1U;
+
+  for (s.frame = 0U, drain = 0U; (s.frame < frames) || (drain < 64U); s.frame++)
+  {
+    if (s.frame >= frames)
+    {
+      drain++;   /* Producer stopped: everything taken must come out */
+    }
+    else if (c->disturb != 0U)
+    {
+      if ((stall == 0U) && (off == 0U) && ((rng() % 3000U) == 0U))
+      {
+        stall = 1U + (rng() % 40U);
+      }
+      if ((off == 0U) && ((rng() % 20000U) == 0U))
+      {
+        bus_reset(&s);
+        resets++;
+        off = 1U + (rng() % 20U);
+      }
+    }
+
+    if (s.frame < frames)
+    {
+      produce(&s, c->rate);
+    }
+
+    if (off != 0U)
+    {
+      off--;
+      if (off == 0U)
+      {
+        s.configured = 1U;
+        usb_stream_kick(&s.stream);
+      }
+      continue;
+    }
+    if (stall != 0U)
+    {
+      stall--;
+      continue;
+    }
+
+    packets = endpoint_frame(&s);
+    host_parse(&s);
+    if ((packets < SIM_FRAME_PACKETS) && ((s.stream.fill != 0U) || (s.stream.closed != s.stream.queued)))
+    {
+      fail("frame went out short with data waiting", s.frame);
+    }
+    if (packets != 0U)
+    {
+      if ((s.frame < frames) && ((s.frame - last_data) > max_gap))
+      {
+        max_gap = s.frame - last_data;
+      }
+      last_data = s.frame;
+    }
+    if ((packets == SIM_FRAME_PACKETS) && (s.frame < frames))
+    {
+      busy_frames++;
+    }
+  }
+
+  usb_stream_get_stats(&s.stream, &stats);
+
+  /* Everything taken arrived, or was in a lost block; lost blocks at the end leave no gap */
+  for (i = s.next_record; i < s.record_count; i++)
+  {
+    if ((s.records[i].fate == SIM_TAKEN) && (s.next_seq == s.stream.closed))
+    {
+      fail("record taken but never sent", s.frame);
+    }
+  }
+  if (s.parsed != s.wire_size)
+  {
+    fail("partial block left on the wire", s.frame);
+  }
+  if ((s.stream.closed != s.stream.done) || (s.stream.fill != 0U))
+  {
+    fail("stream did not drain", s.frame);
+  }
+  if ((s.received != stats.blocks) || ((s.seq_gaps + (s.stream.closed - s.next_seq)) != stats.failed))
+  {
+    fail("seq gaps do not match the failed blocks", s.frame);
+  }
+  if ((stats.blocks + stats.failed) != s.stream.closed)
+  {
+    fail("block counts do not add up", s.frame);
+  }
+  if ((c->policy == USB_STREAM_BACKPRESSURE) && (stats.overflows != 0U))
+  {
+    fail("overflow under backpressure", s.frame);
+  }
+  if ((c->disturb == 0U) && (stats.failed != 0U))
+  {
+    fail("block lost without a reset", s.frame);
+  }
+  if ((c->rate < 1000U) && (stats.dropped != 0U) && (c->disturb == 0U))
+  {
+    fail("records dropped below the link rate", s.frame);
+  }
+
+  printf("%-22s %7.1f kB/s payload, %5.1f%% full frames, max gap %3u ms, latency %4u ms,"
+         " %u resets, %u lost blocks, %u backpressure, %u overflows, max %u blocks used\n",
+         c->name, (double)stats.bytes / frames, 100.0 * busy_frames / frames, (unsigned)max_gap,
+         (unsigned)s.max_latency, (unsigned)resets, (unsigned)stats.failed, (unsigned)stats.backpressure,
+         (unsigned)stats.overflows, (unsigned)stats.max_used);
+
+  if (out != NULL)
+  {
+    FILE *f = fopen(out, "wb");
+
+    if ((f == NULL) || (fwrite(s.wire, 1, (size_t)s.wire_size, f) != s.wire_size) || (fclose(f) != 0))
+    {
+      fprintf(stderr, "usb_stream_sim: cannot write %s\n", out);
+      exit(1);
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  static const sim_case cases[] =
+  {
+    { "light",                  100U, USB_STREAM_BACKPRESSURE, 0U },
+    { "near link rate",        1150U, USB_STREAM_BACKPRESSURE, 0U },
+    { "overload, backpressure", 4000U, USB_STREAM_BACKPRESSURE, 0U },
+    { "overload, drop",         4000U, USB_STREAM_DROP,         0U },
+    { "disturbed, backpressure", 900U, USB_STREAM_BACKPRESSURE, 1U },
+    { "disturbed, drop",         900U, USB_STREAM_DROP,         1U },
+  };
+  const char *out = NULL;
+  uint32_t frames = 200000U;
+  uint32_t i;
+  int arg;
+
+  for (arg = 1; arg < argc; arg++)
+  {
+    if ((strcmp(argv[arg], "-o") == 0) && ((arg + 1) < argc))
+    {
+      out = argv[++arg];
+    }
+    else
+    {
+      frames = (uint32_t)strtoul(argv[arg], NULL, 0);
+    }
+  }
+
+  for (i = 0U; i < (sizeof(cases) / sizeof(cases[0])); i++)
+  {
+    run(&cases[i], frames, (i == ((sizeof(cases) / sizeof(cases[0])) - 1U)) ? out : NULL);
+  }
+  printf("ok\n");
+  return 0;
+}